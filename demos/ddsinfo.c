@@ -142,13 +142,20 @@ int main(int argc, char** argv)
         "Opaque",
         "Custom"
     };
+    static const char* Supercompressions[] = {
+        "None",
+        "BasisLZ",
+        "Zstandard",
+        "ZLIB"
+    };
 
     if(argc == 1) printUsage(argv[0], 1);
     int i;
     for(i = 1; i < argc; i++)
     {
         TCTex_Texture tex;
-        if(!tctex_load_fname(&tex, argv[i]))
+        // only the headers are needed, so there's no need to read the whole file
+        if(!tctex_load_mapped(&tex, argv[i]))
         {
             fprintf(stderr, "Unable to load \"%s\": %s\n", argv[i], tex.errmsg);
             continue;
@@ -184,6 +191,7 @@ int main(int argc, char** argv)
         printf("\tPitch: Y=%u,Z=%u\n", tex.pitch.y, tex.pitch.z);
         printf("\tNumber of Bytes: %u\n", tex.nbytes);
         printf("\tInternal Format: %s (%u)\n", tex.iformat < sizeof(InternalFormatStrings)/sizeof(*InternalFormatStrings) ? InternalFormatStrings[tex.iformat] : "???", tex.iformat);
+        if(tex.supercompression) printf("\tSupercompression: %s (%u)\n", tex.supercompression < sizeof(Supercompressions)/sizeof(*Supercompressions) ? Supercompressions[tex.supercompression] : "???", tex.supercompression);
 
         tctex_close(&tex);
     }
@@ -0,0 +1,119 @@
+#define TC_TEXTURE_LOAD_IMPLEMENTATION
+#include "../tc_texture_load.h"
+
+#define TC_TEXTURE_CODEC_IMPLEMENTATION
+#include "../tc_texture_codec.h"
+
+#define STB_IMAGE_WRITE_IMPLEMENTATION
+#include "util/stb_image_write.h"
+
+#include <stdlib.h>
+
+// counts how much of the file actually gets read
+typedef struct Reader
+{
+    FILE* file;
+    size_t nbytes;
+    size_t ncalls;
+} Reader;
+static size_t read_counted(void* udata, uint64_t offset, void* buf, size_t nbytes)
+{
+    Reader* reader = udata;
+    reader->nbytes += nbytes;
+    reader->ncalls++;
+    return tctex_read_stdio(reader->file, offset, buf, nbytes);
+}
+
+// 8-bit formats only, for simplicity's sake (so no BC6H); all are decoded as RGBA8
+static int get_codec_format(TCTex_InternalFormat iformat, TCTex_CodecFormat* format, int* nchan)
+{
+    switch(iformat)
+    {
+    case TCTEX_IFORMAT_COMPRESSED_BC1_TYPELESS: case TCTEX_IFORMAT_COMPRESSED_BC1_UNORM: case TCTEX_IFORMAT_COMPRESSED_BC1_SRGB:
+        *format = TCTEX_CODEC_BC1_ALPHA; *nchan = 4; return 1;
+    case TCTEX_IFORMAT_COMPRESSED_BC2_TYPELESS: case TCTEX_IFORMAT_COMPRESSED_BC2_UNORM: case TCTEX_IFORMAT_COMPRESSED_BC2_SRGB:
+        *format = TCTEX_CODEC_BC2; *nchan = 4; return 1;
+    case TCTEX_IFORMAT_COMPRESSED_BC3_TYPELESS: case TCTEX_IFORMAT_COMPRESSED_BC3_UNORM: case TCTEX_IFORMAT_COMPRESSED_BC3_SRGB:
+        *format = TCTEX_CODEC_BC3; *nchan = 4; return 1;
+    case TCTEX_IFORMAT_COMPRESSED_BC4_TYPELESS: case TCTEX_IFORMAT_COMPRESSED_BC4_UNORM:
+        *format = TCTEX_CODEC_BC4; *nchan = 1; return 1;
+    case TCTEX_IFORMAT_COMPRESSED_BC5_TYPELESS: case TCTEX_IFORMAT_COMPRESSED_BC5_UNORM:
+        *format = TCTEX_CODEC_BC5; *nchan = 2; return 1;
+    case TCTEX_IFORMAT_COMPRESSED_BC7_TYPELESS: case TCTEX_IFORMAT_COMPRESSED_BC7_UNORM: case TCTEX_IFORMAT_COMPRESSED_BC7_SRGB:
+        *format = TCTEX_CODEC_BC7; *nchan = 4; return 1;
+    default:
+        return 0;
+    }
+}
+
+void printUsage(const char* argv0, int ecode)
+{
+    printf("Usage: %s <input> <output.png> [<minsize> | <x> <y> <w> <h>]\n", argv0 ? argv0 : "ddsregion");
+    printf("  Decodes either the smallest mipmap level that is at least <minsize> (default: 256),\n");
+    printf("  or the <x>,<y>,<w>,<h> rectangle of level 0; only the blocks needed are read.\n");
+    exit(ecode);
+}
+int main(int argc, char** argv)
+{
+    if(argc != 3 && argc != 4 && argc != 7) printUsage(argv[0], 1);
+
+    Reader reader = {0};
+    reader.file = fopen(argv[1], "rb");
+    if(!reader.file)
+    {
+        fprintf(stderr, "Unable to open \"%s\"\n", argv[1]);
+        return 1;
+    }
+    TCTex_Texture tex;
+    if(!tctex_load_reader(&tex, read_counted, &reader))
+    {
+        fprintf(stderr, "Unable to load \"%s\": %s\n", argv[1], tex.errmsg);
+        return 1;
+    }
+    TCTex_CodecFormat format;
+    int nchan;
+    if(!get_codec_format(tex.iformat, &format, &nchan))
+    {
+        fprintf(stderr, "Unsupported format (%u) in \"%s\"\n", tex.iformat, argv[1]);
+        return 1;
+    }
+
+    uint32_t level = 0, x = 0, y = 0, w = UINT32_MAX, h = UINT32_MAX;
+    if(argc == 7)
+    {
+        x = strtoul(argv[3], NULL, 10);
+        y = strtoul(argv[4], NULL, 10);
+        w = strtoul(argv[5], NULL, 10);
+        h = strtoul(argv[6], NULL, 10);
+    }
+    else
+        level = tctex_get_mipmap_for_size(&tex, argc == 4 ? strtoul(argv[3], NULL, 10) : 256);
+
+    // first query the size, then read
+    TCTex_Region region;
+    if(!tctex_read_region(&tex, NULL, 0, &region, level, 0, x, y, w, h, NULL, NULL))
+    {
+        fprintf(stderr, "Invalid region: %s\n", tex.errmsg);
+        return 1;
+    }
+    size_t blen = (size_t)(region.w / 4) * (region.h / 4) * tctex_get_block_size(tex.iformat);
+    void* blocks = malloc(blen);
+    uint8_t* pixels = malloc((size_t)region.w * region.h * 4);
+    if(!tctex_read_region(&tex, blocks, blen, &region, level, 0, x, y, w, h, read_counted, &reader))
+    {
+        fprintf(stderr, "Unable to read \"%s\": %s\n", argv[1], tex.errmsg);
+        return 1;
+    }
+    tctex_decompress(format, pixels, nchan, region.w * nchan, blocks, region.w, region.h);
+
+    fseek(reader.file, 0, SEEK_END);
+    printf("%s: level %u, %ux%u at %u,%u; read %zu of %ld bytes (%zu reads)\n", argv[1], level, region.w, region.h, region.x, region.y, reader.nbytes, ftell(reader.file), reader.ncalls);
+    if(!stbi_write_png(argv[2], region.w, region.h, nchan, pixels, 0))
+        fprintf(stderr, "Unable to write \"%s\"\n", argv[2]);
+
+    free(pixels);
+    free(blocks);
+    tctex_close(&tex);
+    fclose(reader.file);
+    return 0;
+}
@@ -1,63 +1,440 @@
+#define TC_THREAD_IMPLEMENTATION
+#include "../tc_thread.h"
+
 #define TC_HASH_IMPLEMENTATION
 #include "../tc_hash.h"
 
+#define __STDC_FORMAT_MACROS
+#include <inttypes.h>
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
 #include <ctype.h>
 #include <errno.h>
 
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <time.h>
+#define USE_POSIX_IO
+#endif
+
 #define RBUF_SIZE   65536
+// files at least this large are memory-mapped (where supported), instead of read in pieces
+#define MMAP_MIN_SIZE   (1024 * 1024)
+// number of files in flight (being hashed, or waiting to be printed) per worker
+#define JOBS_PER_WORKER 16
+
+typedef struct HashAlg
+{
+    const char* names[4];
+    size_t ssize;
+    size_t dsize;   // `0` if the digest size is variable (SHAKE)
+    void (*init)(void* state);
+    void (*process)(void* state, const void* data, size_t dlen);
+    void (*get)(void* state, void* digest, size_t dlen);
+} HashAlg;
+
+#define HASH_ALG_S(LHASH,SHASH,UHASH,...)                                      \
+    static void LHASH##_init_(void* state) { tchash_##LHASH##_init(state); }   \
+    static void LHASH##_process_(void* state, const void* data, size_t dlen) { tchash_##LHASH##_process(state, data, dlen); }\
+    static void LHASH##_get_(void* state, void* digest, size_t dlen) { (void)dlen; tchash_##LHASH##_get(state, digest); }\
+    static const HashAlg LHASH##_alg_ = { { __VA_ARGS__ }, sizeof(TCHash_##SHASH), TCHASH_##UHASH##_DIGEST_SIZE, LHASH##_init_, LHASH##_process_, LHASH##_get_ };
+#define HASH_ALG(LHASH,UHASH,...)   HASH_ALG_S(LHASH,UHASH,UHASH,__VA_ARGS__)
+#define HASH_ALG_DLEN(LHASH,UHASH,...)                                         \
+    static void LHASH##_init_(void* state) { tchash_##LHASH##_init(state); }   \
+    static void LHASH##_process_(void* state, const void* data, size_t dlen) { tchash_##LHASH##_process(state, data, dlen); }\
+    static void LHASH##_get_(void* state, void* digest, size_t dlen) { tchash_##LHASH##_get(state, digest, dlen); }\
+    static const HashAlg LHASH##_alg_ = { { __VA_ARGS__ }, sizeof(TCHash_##UHASH), 0, LHASH##_init_, LHASH##_process_, LHASH##_get_ };
+
+HASH_ALG(md5,MD5,"md5")
+HASH_ALG_S(tiger192,Tiger192,TIGER192,"tiger","tiger/192","tiger-192")
+HASH_ALG_S(tiger160,Tiger160,TIGER160,"tiger/160","tiger-160")
+HASH_ALG_S(tiger128,Tiger128,TIGER128,"tiger/128","tiger-128")
+HASH_ALG_S(tiger2_192,Tiger2_192,TIGER2_192,"tiger2","tiger2/192","tiger2-192")
+HASH_ALG_S(tiger2_160,Tiger2_160,TIGER2_160,"tiger2/160","tiger2-160")
+HASH_ALG_S(tiger2_128,Tiger2_128,TIGER2_128,"tiger2/128","tiger2-128")
+HASH_ALG(ripemd128,RIPEMD128,"ripemd-128","ripemd128")
+HASH_ALG(ripemd160,RIPEMD160,"ripemd-160","ripemd160")
+HASH_ALG(ripemd256,RIPEMD256,"ripemd-256","ripemd256")
+HASH_ALG(ripemd320,RIPEMD320,"ripemd-320","ripemd320")
+HASH_ALG(sha1,SHA1,"sha1")
+HASH_ALG(sha2_224,SHA2_224,"sha2-224","sha224")
+HASH_ALG(sha2_256,SHA2_256,"sha2-256","sha256")
+HASH_ALG(sha2_384,SHA2_384,"sha2-384","sha384")
+HASH_ALG(sha2_512,SHA2_512,"sha2-512","sha512")
+HASH_ALG(sha2_512_224,SHA2_512_224,"sha2-512/224","sha512/224","sha2-512-224","sha-512-224")
+HASH_ALG(sha2_512_256,SHA2_512_256,"sha2-512/256","sha512/256","sha2-512-256","sha-512-256")
+HASH_ALG(sha3_224,SHA3_224,"sha3-224")
+HASH_ALG(sha3_256,SHA3_256,"sha3-256")
+HASH_ALG(sha3_384,SHA3_384,"sha3-384")
+HASH_ALG(sha3_512,SHA3_512,"sha3-512")
+HASH_ALG_DLEN(shake128,SHAKE128,"shake128/")
+HASH_ALG_DLEN(shake256,SHAKE256,"shake256/")
+
+static const HashAlg* const hash_algs[] = {
+    &md5_alg_,
+    &tiger192_alg_, &tiger160_alg_, &tiger128_alg_,
+    &tiger2_192_alg_, &tiger2_160_alg_, &tiger2_128_alg_,
+    &ripemd128_alg_, &ripemd160_alg_, &ripemd256_alg_, &ripemd320_alg_,
+    &sha1_alg_,
+    &sha2_224_alg_, &sha2_256_alg_, &sha2_384_alg_, &sha2_512_alg_, &sha2_512_224_alg_, &sha2_512_256_alg_,
+    &sha3_224_alg_, &sha3_256_alg_, &sha3_384_alg_, &sha3_512_alg_,
+    &shake128_alg_, &shake256_alg_,
+};
+
+// variable-size algorithms match by prefix (the remainder being the digest size)
+static const HashAlg* find_alg(const char* name)
+{
+    size_t i, j;
+    for(i = 0; i < sizeof(hash_algs) / sizeof(*hash_algs); i++)
+        for(j = 0; j < sizeof(hash_algs[i]->names) / sizeof(*hash_algs[i]->names) && hash_algs[i]->names[j]; j++)
+        {
+            const char* aname = hash_algs[i]->names[j];
+            if(hash_algs[i]->dsize ? !strcmp(name, aname) : strstr(name, aname) == name)
+                return hash_algs[i];
+        }
+    return NULL;
+}
+
+static double get_time(void)
+{
+#ifdef _WIN32
+    LARGE_INTEGER freq, count;
+    QueryPerformanceFrequency(&freq);
+    QueryPerformanceCounter(&count);
+    return (double)count.QuadPart / (double)freq.QuadPart;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+#endif
+}
+
+// returns `0` on success, or an `errno` value
+static int hash_file(const HashAlg* alg, void* state, void* digest, size_t dlen, const char* fname, unsigned char* rbuf, uint64_t* nbytes)
+{
+    *nbytes = 0;
+    alg->init(state);
+#ifdef USE_POSIX_IO
+    int fd = open(fname, O_RDONLY);
+    if(fd < 0) return errno;
+
+    struct stat st;
+    if(fstat(fd, &st)) { int err = errno; close(fd); return err; }
+    // large files are mapped, and the kernel is told to read ahead; smaller ones are not worth the mapping cost
+    if(S_ISREG(st.st_mode) && st.st_size >= MMAP_MIN_SIZE)
+    {
+        void* map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if(map != MAP_FAILED)
+        {
+            madvise(map, st.st_size, MADV_SEQUENTIAL);
+            madvise(map, st.st_size, MADV_WILLNEED);
+            alg->process(state, map, st.st_size);
+            munmap(map, st.st_size);
+            close(fd);
+            *nbytes = st.st_size;
+            alg->get(state, digest, dlen);
+            return 0;
+        }
+    }
+#if defined(POSIX_FADV_SEQUENTIAL)
+    posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+    for(;;)
+    {
+        ssize_t rlen = read(fd, rbuf, RBUF_SIZE);
+        if(rlen < 0)
+        {
+            if(errno == EINTR) continue;
+            int err = errno;
+            close(fd);
+            return err;
+        }
+        if(!rlen) break;
+        alg->process(state, rbuf, rlen);
+        *nbytes += rlen;
+    }
+    close(fd);
+#else
+    FILE* file = fopen(fname, "rb");
+    if(!file) return errno;
+
+    size_t rlen;
+    do
+    {
+        rlen = fread(rbuf, 1, RBUF_SIZE, file);
+        alg->process(state, rbuf, rlen);
+        *nbytes += rlen;
+    }
+    while(rlen == RBUF_SIZE);
+    int err = ferror(file) ? EIO : 0;
+    fclose(file);
+    if(err) return err;
+#endif
+    alg->get(state, digest, dlen);
+    return 0;
+}
+
+static int show_stats;
+static uint64_t total_files, total_bytes, total_errors;
 
-#define HASH_FILE_S(LHASH,SHASH,UHASH,FNAME)                                   \
-    do {                                                                       \
-        const char* fname_ = (FNAME);                                          \
-        FILE* file = fopen(fname_, "rb");                                      \
-        if(!file) { fprintf(stderr, "Error: Unable to open file `%s`: %s", fname_, strerror(errno)); retval = 1; break; }\
-                                                                               \
-        char digest[TCHASH_##UHASH##_DIGEST_SIZE];                             \
-        char tdigest[2*sizeof(digest)+1];                                      \
-                                                                               \
-        TCHash_##SHASH LHASH;                                                  \
-        tchash_##LHASH##_init(&LHASH);                                         \
-        size_t rlen;                                                           \
-        do                                                                     \
-        {                                                                      \
-            rlen = fread(rbuf, 1, sizeof(rbuf), file);                         \
-            tchash_##LHASH##_process(&LHASH, rbuf, rlen);                      \
-        }                                                                      \
-        while(rlen == sizeof(rbuf));                                           \
-        tchash_##LHASH##_get(&LHASH, digest);                                  \
-        tchash_xstring_from_bytes(tdigest, digest, sizeof(digest), 0);         \
-        printf("%s\t*%s\n", tdigest, fname_);                                  \
-    } while(0)
-#define HASH_FILE(LHASH,UHASH,FNAME)    HASH_FILE_S(LHASH,UHASH,UHASH,FNAME)
-#define HASH_FILE_S_DLEN(LHASH,SHASH,UHASH,FNAME,DLEN)                         \
-    do {                                                                       \
-        const char* fname_ = (FNAME);                                          \
-        FILE* file = fopen(fname_, "rb");                                      \
-        if(!file) { fprintf(stderr, "Error: Unable to open file `%s`: %s", fname_, strerror(errno)); break; }\
-                                                                               \
-        char* digest = malloc((DLEN));                                         \
-        char* tdigest = malloc(2*(DLEN)+1);                                    \
-                                                                               \
-        TCHash_##SHASH LHASH;                                                  \
-        tchash_##LHASH##_init(&LHASH);                                         \
-        size_t rlen;                                                           \
-        do                                                                     \
-        {                                                                      \
-            rlen = fread(rbuf, 1, sizeof(rbuf), file);                         \
-            tchash_##LHASH##_process(&LHASH, rbuf, rlen);                      \
-        }                                                                      \
-        while(rlen == sizeof(rbuf));                                           \
-        tchash_##LHASH##_get(&LHASH, digest, (DLEN));                          \
-        tchash_xstring_from_bytes(tdigest, digest, (DLEN), 0);                 \
-        printf("%s\t*%s\n", tdigest, fname_);                                  \
-    } while(0)
-#define HASH_FILE_DLEN(LHASH,UHASH,FNAME,DLEN)  HASH_FILE_S_DLEN(LHASH,UHASH,UHASH,FNAME,DLEN)
+// returns the exit code contribution of this file
+static int print_result(const char* fname, int err, const unsigned char* digest, size_t dlen, uint64_t nbytes, double seconds, char* tdigest)
+{
+    if(err)
+    {
+        fprintf(stderr, "Error: Unable to read file `%s`: %s\n", fname, strerror(err));
+        total_errors++;
+        return 1;
+    }
+    tchash_xstring_from_bytes(tdigest, digest, dlen, 0);
+    printf("%s\t*%s\n", tdigest, fname);
+    if(show_stats)
+        fprintf(stderr, "%s: %" PRIu64 " bytes in %.3f ms (%.1f MB/s)\n", fname, nbytes, seconds * 1e3, seconds > 0 ? nbytes / seconds * 1e-6 : 0.0);
+    total_files++;
+    total_bytes += nbytes;
+    return 0;
+}
+
+// file names come either from the command line, or (for `-`) from stdin, one per line
+typedef struct NameSource
+{
+    char** argv;
+    int argc;
+    int i;
+    char* line;
+    size_t linesize;
+} NameSource;
+static char* next_name(NameSource* src)
+{
+    while(src->i < src->argc)
+    {
+        if(strcmp(src->argv[src->i], "-"))
+            return src->argv[src->i++];
+
+        size_t len = 0;
+        for(;;)
+        {
+            if(len + 2 > src->linesize)
+            {
+                src->linesize = src->linesize ? src->linesize * 2 : 256;
+                src->line = realloc(src->line, src->linesize);
+            }
+            if(!fgets(src->line + len, src->linesize - len, stdin))
+                break;
+            len += strlen(src->line + len);
+            if(len && src->line[len-1] == '\n')
+                break;
+        }
+        if(len && src->line[len-1] == '\n') src->line[--len] = 0;
+        if(len && src->line[len-1] == '\r') src->line[--len] = 0;
+        if(len)
+            return src->line;
+        if(feof(stdin) || ferror(stdin))
+            src->i++;
+    }
+    return NULL;
+}
+
+static int hash_serial(const HashAlg* alg, size_t dlen, NameSource* src)
+{
+    static unsigned char rbuf[RBUF_SIZE];
+    void* state = malloc(alg->ssize);
+    unsigned char* digest = malloc(dlen);
+    char* tdigest = malloc(2 * dlen + 1);
+
+    int retval = 0;
+    const char* fname;
+    while((fname = next_name(src)))
+    {
+        uint64_t nbytes;
+        double start = get_time();
+        int err = hash_file(alg, state, digest, dlen, fname, rbuf, &nbytes);
+        retval |= print_result(fname, err, digest, dlen, nbytes, get_time() - start, tdigest);
+    }
+
+    free(tdigest);
+    free(digest);
+    free(state);
+    return retval;
+}
+
+/*
+ * Parallel mode: the main thread fills a bounded ring of jobs (in input
+ * order), workers claim the next unclaimed job, and the main thread prints
+ * jobs from the head of the ring as soon as they are done (so that output
+ * order matches input order). While a slow file blocks the head, the others
+ * keep hashing until the ring is full.
+ */
+enum { JOB_QUEUED, JOB_DONE };
+typedef struct Job
+{
+    char* fname;
+    unsigned char* digest;
+    uint64_t nbytes;
+    double seconds;
+    int err;
+    int state;
+} Job;
+typedef struct Pipeline
+{
+    const HashAlg* alg;
+    size_t dlen;
+
+    Job* jobs;
+    size_t njobs;
+    size_t head, next, tail;    // printed < head <= claimed < next <= queued < tail
+    bool done;
+
+    tcthread_mutex_t mutex;
+    tcthread_cond_t work_cond;  // signalled when a job is queued
+    tcthread_cond_t done_cond;  // signalled when the job at `head` is done
+} Pipeline;
+
+static void* pipeline_worker(void* udata)
+{
+    Pipeline* pipeline = udata;
+    void* state = malloc(pipeline->alg->ssize);
+    unsigned char* rbuf = malloc(RBUF_SIZE);
+
+    tcthread_mutex_lock(pipeline->mutex);
+    for(;;)
+    {
+        while(pipeline->next == pipeline->tail && !pipeline->done)
+            tcthread_cond_wait(pipeline->work_cond, pipeline->mutex);
+        if(pipeline->next == pipeline->tail)
+            break;
+        size_t index = pipeline->next++;
+        Job* job = &pipeline->jobs[index % pipeline->njobs];
+        tcthread_mutex_unlock(pipeline->mutex);
+
+        double start = get_time();
+        job->err = hash_file(pipeline->alg, state, job->digest, pipeline->dlen, job->fname, rbuf, &job->nbytes);
+        job->seconds = get_time() - start;
+
+        tcthread_mutex_lock(pipeline->mutex);
+        job->state = JOB_DONE;
+        if(index == pipeline->head)
+            tcthread_cond_signal(pipeline->done_cond);
+    }
+    tcthread_mutex_unlock(pipeline->mutex);
+
+    free(rbuf);
+    free(state);
+    return NULL;
+}
+
+// prints finished jobs from the head of the ring; if `wait`, blocks until the head is done (unless the ring is empty)
+static int pipeline_flush(Pipeline* pipeline, bool wait, char* tdigest)
+{
+    int retval = 0;
+    while(pipeline->head < pipeline->tail)
+    {
+        Job* job = &pipeline->jobs[pipeline->head % pipeline->njobs];
+        if(job->state != JOB_DONE)
+        {
+            if(!wait) break;
+            tcthread_cond_wait(pipeline->done_cond, pipeline->mutex);
+            continue;
+        }
+        // the head job is only touched by this thread now
+        tcthread_mutex_unlock(pipeline->mutex);
+        retval |= print_result(job->fname, job->err, job->digest, pipeline->dlen, job->nbytes, job->seconds, tdigest);
+        free(job->fname);
+        job->fname = NULL;
+        tcthread_mutex_lock(pipeline->mutex);
+        pipeline->head++;
+        wait = false;
+    }
+    return retval;
+}
+
+// `*nworkers` is updated to the number of workers that were actually started
+static int hash_parallel(const HashAlg* alg, size_t dlen, NameSource* src, unsigned int* nworkers)
+{
+    Pipeline pipeline;
+    pipeline.alg = alg;
+    pipeline.dlen = dlen;
+    pipeline.njobs = (size_t)*nworkers * JOBS_PER_WORKER;
+    pipeline.jobs = calloc(pipeline.njobs, sizeof(*pipeline.jobs));
+    unsigned char* digests = malloc(pipeline.njobs * dlen);
+    size_t i;
+    for(i = 0; i < pipeline.njobs; i++)
+        pipeline.jobs[i].digest = digests + i * dlen;
+    pipeline.head = pipeline.next = pipeline.tail = 0;
+    pipeline.done = false;
+    pipeline.mutex = tcthread_mutex_create(false);
+    pipeline.work_cond = tcthread_cond_create();
+    pipeline.done_cond = tcthread_cond_create();
+
+    // keep going with however many workers we could start; none at all means that we hash serially
+    tcthread_t* workers = malloc(*nworkers * sizeof(*workers));
+    unsigned int nstarted = 0;
+    for(i = 0; i < *nworkers; i++)
+        if(tcthread_is_valid(workers[nstarted] = tcthread_create(0, pipeline_worker, &pipeline)))
+            nstarted++;
+    *nworkers = nstarted ? nstarted : 1;
+    if(!nstarted)
+    {
+        free(workers);
+        tcthread_cond_destroy(pipeline.done_cond);
+        tcthread_cond_destroy(pipeline.work_cond);
+        tcthread_mutex_destroy(pipeline.mutex);
+        free(digests);
+        free(pipeline.jobs);
+        return hash_serial(alg, dlen, src);
+    }
+
+    char* tdigest = malloc(2 * dlen + 1);
+    int retval = 0;
+    const char* fname;
+    tcthread_mutex_lock(pipeline.mutex);
+    while((fname = next_name(src)))
+    {
+        // the ring is full: wait for (at least) the head to be printed
+        if(pipeline.tail - pipeline.head == pipeline.njobs)
+            retval |= pipeline_flush(&pipeline, true, tdigest);
+
+        Job* job = &pipeline.jobs[pipeline.tail % pipeline.njobs];
+        job->fname = strdup(fname);
+        job->state = JOB_QUEUED;
+        pipeline.tail++;
+        tcthread_cond_signal(pipeline.work_cond);
+
+        retval |= pipeline_flush(&pipeline, false, tdigest);
+    }
+    pipeline.done = true;
+    tcthread_cond_broadcast(pipeline.work_cond);
+    while(pipeline.head < pipeline.tail)
+        retval |= pipeline_flush(&pipeline, true, tdigest);
+    tcthread_mutex_unlock(pipeline.mutex);
+
+    for(i = 0; i < nstarted; i++)
+        tcthread_join(workers[i], NULL);
+    free(workers);
+    free(tdigest);
+
+    tcthread_cond_destroy(pipeline.done_cond);
+    tcthread_cond_destroy(pipeline.work_cond);
+    tcthread_mutex_destroy(pipeline.mutex);
+    free(digests);
+    free(pipeline.jobs);
+    return retval;
+}
 
 void usage(FILE* file, int ecode)
 {
-    fprintf(file, "Usage: tchash -<alg> <files>...\n");
+    fprintf(file, "Usage: tchash [-j[N]] [-s] -<alg> <files>...\n");
+    fprintf(file, "\tOptions:\n");
+    fprintf(file, "\t\t-j[N]\thash N files in parallel (default: one per CPU)\n");
+    fprintf(file, "\t\t-s\tprint per-file & total throughput to stderr\n");
+    fprintf(file, "\tA file name of `-` reads further file names from stdin (one per line).\n");
     fprintf(file, "\tSupported algorithms:\n");
     fprintf(file, "\t\tMD5\n");
     fprintf(file, "\t\tTiger/{192,160,128}\n");
@@ -66,23 +443,54 @@ void usage(FILE* file, int ecode)
     fprintf(file, "\t\tSHA1\n");
     fprintf(file, "\t\tSHA2-{224,256,384,512,512/224,512/256}\n");
     fprintf(file, "\t\tSHA3-{224,256,384,512}\n");
-    fprintf(file, "\t\tSHAKE{128,256}/? (where '?' is the digest size)");
+    fprintf(file, "\t\tSHAKE{128,256}/? (where '?' is the digest size)\n");
     exit(ecode);
 }
 int main(int argc, char** argv)
 {
-    if(argc < 3)
+    unsigned int nworkers = 1;
+    int argi = 1;
+    for(; argi < argc; argi++)
+    {
+        const char* arg = argv[argi];
+        if(!strcmp(arg, "-s"))
+            show_stats = 1;
+        else if(arg[0] == '-' && arg[1] == 'j' && (!arg[2] || isdigit((unsigned char)arg[2])))
+        {
+            char* end;
+            nworkers = strtoul(arg + 2, &end, 10);
+            if(*end) usage(stderr, 2);
+            if(!nworkers) nworkers = tcthread_get_cpu_count();
+            if(!nworkers) nworkers = 1;
+        }
+        else
+            break;
+    }
+    if(argc - argi < 2)
         usage(stderr, 2);
 
-    char* alg = argv[1];
+    char* alg = argv[argi++];
     if(*alg != '-') usage(stderr, 2);
     alg++;
 
     int i;
     for(i = 0; alg[i]; i++) alg[i] = tolower((unsigned char)alg[i]);
 
-    size_t dlen = 0;
-    if(strstr(alg, "shake128/") == alg || strstr(alg, "shake256/") == alg)
+    const HashAlg* halg = find_alg(alg);
+    if(!halg)
+    {
+        if(!strcmp(alg, "shake128") || !strcmp(alg, "shake256"))
+        {
+            fprintf(stderr, "Error: SHAKE needs a provided length (use e.g. `SHAKE128/256`)\n");
+            return 2;
+        }
+
+        fprintf(stderr, "Error: Unknown algorithm `%s`\n", alg);
+        return 2;
+    }
+
+    size_t dlen = halg->dsize;
+    if(!dlen)
     {
         char* dlenstr = alg + sizeof("shake128/") - 1;
 
@@ -94,54 +502,22 @@ int main(int argc, char** argv)
             return 2;
         }
 
-        if(dlen % 8)
+        if(!dlen || dlen % 8)
         {
-            fprintf(stderr, "Error: SHAKE output length must be a multiple of 8\n");
+            fprintf(stderr, "Error: SHAKE output length must be a positive multiple of 8\n");
             return 2;
         }
         dlen /= 8;
     }
 
-    int retval = 0;
-    static char rbuf[RBUF_SIZE];
-    for(i = 2; i < argc; i++)
-    {
-        if(0) {}
-        else if(!strcmp(alg, "md5")) HASH_FILE(md5,MD5,argv[i]);
-        else if(!strcmp(alg, "tiger") || !strcmp(alg, "tiger/192") || !strcmp(alg, "tiger-192")) HASH_FILE_S(tiger192,Tiger192,TIGER192,argv[i]);
-        else if(!strcmp(alg, "tiger/160") || !strcmp(alg, "tiger-160")) HASH_FILE_S(tiger160,Tiger160,TIGER160,argv[i]);
-        else if(!strcmp(alg, "tiger/128") || !strcmp(alg, "tiger-128")) HASH_FILE_S(tiger128,Tiger128,TIGER128,argv[i]);
-        else if(!strcmp(alg, "tiger2") || !strcmp(alg, "tiger2/192") || !strcmp(alg, "tiger2-192")) HASH_FILE_S(tiger2_192,Tiger2_192,TIGER2_192,argv[i]);
-        else if(!strcmp(alg, "tiger2/160") || !strcmp(alg, "tiger2-160")) HASH_FILE_S(tiger2_160,Tiger2_160,TIGER2_160,argv[i]);
-        else if(!strcmp(alg, "tiger2/128") || !strcmp(alg, "tiger2-128")) HASH_FILE_S(tiger2_128,Tiger2_128,TIGER2_128,argv[i]);
-        else if(!strcmp(alg, "ripemd-128") || !strcmp(alg, "ripemd128")) HASH_FILE(ripemd128,RIPEMD128,argv[i]);
-        else if(!strcmp(alg, "ripemd-160") || !strcmp(alg, "ripemd160")) HASH_FILE(ripemd160,RIPEMD160,argv[i]);
-        else if(!strcmp(alg, "ripemd-256") || !strcmp(alg, "ripemd256")) HASH_FILE(ripemd256,RIPEMD256,argv[i]);
-        else if(!strcmp(alg, "ripemd-320") || !strcmp(alg, "ripemd320")) HASH_FILE(ripemd320,RIPEMD320,argv[i]);
-        else if(!strcmp(alg, "sha1")) HASH_FILE(sha1,SHA1,argv[i]);
-        else if(!strcmp(alg, "sha2-224") || !strcmp(alg, "sha224")) HASH_FILE(sha2_224,SHA2_224,argv[i]);
-        else if(!strcmp(alg, "sha2-256") || !strcmp(alg, "sha256")) HASH_FILE(sha2_256,SHA2_256,argv[i]);
-        else if(!strcmp(alg, "sha2-384") || !strcmp(alg, "sha384")) HASH_FILE(sha2_384,SHA2_384,argv[i]);
-        else if(!strcmp(alg, "sha2-512") || !strcmp(alg, "sha512")) HASH_FILE(sha2_512,SHA2_512,argv[i]);
-        else if(!strcmp(alg, "sha2-512/224") || !strcmp(alg, "sha512/224") || !strcmp(alg, "sha2-512-224") || !strcmp(alg, "sha-512-224")) HASH_FILE(sha2_512_224,SHA2_512_224,argv[i]);
-        else if(!strcmp(alg, "sha2-512/256") || !strcmp(alg, "sha512/256") || !strcmp(alg, "sha2-512-256") || !strcmp(alg, "sha-512-256")) HASH_FILE(sha2_512_256,SHA2_512_256,argv[i]);
-        else if(!strcmp(alg, "sha3-224")) HASH_FILE(sha3_224,SHA3_224,argv[i]);
-        else if(!strcmp(alg, "sha3-256")) HASH_FILE(sha3_256,SHA3_256,argv[i]);
-        else if(!strcmp(alg, "sha3-384")) HASH_FILE(sha3_384,SHA3_384,argv[i]);
-        else if(!strcmp(alg, "sha3-512")) HASH_FILE(sha3_512,SHA3_512,argv[i]);
-        else if(strstr(alg, "shake128/") == alg) HASH_FILE_DLEN(shake128,SHAKE128,argv[i],dlen);
-        else if(strstr(alg, "shake256/") == alg) HASH_FILE_DLEN(shake256,SHAKE256,argv[i],dlen);
-        else
-        {
-            if(!strcmp(alg, "shake128") || !strcmp(alg, "shake256"))
-            {
-                fprintf(stderr, "Error: SHAKE needs a provided length (use e.g. `SHAKE128/256`)\n");
-                return 2;
-            }
+    NameSource src = { argv, argc, argi, NULL, 0 };
+    double start = get_time();
+    int retval = nworkers > 1 ? hash_parallel(halg, dlen, &src, &nworkers) : hash_serial(halg, dlen, &src);
+    double seconds = get_time() - start;
+    free(src.line);
 
-            fprintf(stderr, "Error: Unknown algorithm `%s`\n", alg);
-            return 2;
-        }
-    }
+    if(show_stats)
+        fprintf(stderr, "Total: %" PRIu64 " files (%" PRIu64 " errors), %" PRIu64 " bytes in %.3f s (%.1f MB/s) using %u thread(s)\n",
+            total_files, total_errors, total_bytes, seconds, seconds > 0 ? total_bytes / seconds * 1e-6 : 0.0, nworkers);
     return retval;
 }
@@ -0,0 +1,154 @@
+#define TC_TERMINAL_IMPLEMENTATION
+#include "../tc_terminal.h"
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+// each measurement is repeated until at least this much time has passed
+#define MIN_SECONDS     0.5
+
+static double get_time(void)
+{
+#if defined(_WIN32)
+    LARGE_INTEGER freq, now;
+    QueryPerformanceFrequency(&freq);
+    QueryPerformanceCounter(&now);
+    return (double)now.QuadPart / (double)freq.QuadPart;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+#endif
+}
+
+enum
+{
+    MODE_FULL,      // redraw the whole line (what tc_editline used to do)
+    MODE_DIFF,      // redraw from the first changed character (what tc_editline does now)
+    MODE_COLOR,     // redraw the whole line, with each word highlighted (like a syntax highlighter in the echo callback)
+};
+
+// simulate typing in the middle of a line: the character before the cursor changes on each redraw
+static void redraw(const char* line, size_t len, size_t cursor, size_t diff, int mode)
+{
+    switch(mode)
+    {
+    case MODE_FULL:
+        tcterm_set_cursor_pos(0, 0);
+        tcterm_clear_to_eol(TCTERM_STDOUT);
+        tcterm_print(line, len);
+        break;
+    case MODE_DIFF:
+        tcterm_set_cursor_pos(diff, 0);
+        tcterm_clear_to_eol(TCTERM_STDOUT);
+        tcterm_print(line + diff, len - diff);
+        break;
+    case MODE_COLOR:
+        tcterm_set_cursor_pos(0, 0);
+        tcterm_clear_to_eol(TCTERM_STDOUT);
+        for(size_t head = 0, tail; head < len; head = tail)
+        {
+            tail = head + 1;
+            while(tail < len && line[tail] != ' ')
+                tail++;
+            // (a highlighter typically resets the attribute after each word, just to be sure)
+            tcterm_set_attr(((head / 8) & 1) ? TCTERM_FG_CYAN | TCTERM_BG_DEFAULT : TCTERM_FG_YELLOW | TCTERM_BG_DEFAULT);
+            tcterm_print(line + head, tail - head);
+            tcterm_set_attr_default();
+        }
+        break;
+    }
+    tcterm_set_cursor_pos(cursor, 0);
+    // (does nothing if unbuffered)
+    tcterm_flush();
+}
+
+static void benchmark(size_t linelen)
+{
+    static const struct { int buffered; const char* name; } buffering[] = {
+        { 0, "unbuffered" },
+        { 1, "buffered" },
+    };
+    static const struct { int mode; const char* name; } modes[] = {
+        { MODE_FULL, "full" },
+        { MODE_DIFF, "diff" },
+        { MODE_COLOR, "color" },
+    };
+
+    // the line being "typed", with the insertion point in the middle
+    char* line = malloc(linelen + 1);
+    for(size_t i = 0; i < linelen; i++)
+        line[i] = (i % 8 == 7) ? ' ' : 'a' + i % 26;
+    line[linelen] = 0;
+    size_t cursor = linelen / 2;
+
+    fprintf(stderr, "line of %u characters:\n", (unsigned int)linelen);
+    for(size_t b = 0; b < sizeof(buffering) / sizeof(*buffering); b++)
+    {
+        if(!tcterm_set_buffered(buffering[b].buffered))
+        {
+            fprintf(stderr, "  %-12s (not supported)\n", buffering[b].name);
+            continue;
+        }
+
+        fprintf(stderr, "  %-12s", buffering[b].name);
+        for(size_t m = 0; m < sizeof(modes) / sizeof(*modes); m++)
+        {
+            size_t nredraws = 0;
+            double start = get_time(), elapsed;
+            do
+            {
+                // (the typed character alternates, so that the line actually changes)
+                line[cursor] = (nredraws & 1) ? 'X' : 'Y';
+                redraw(line, linelen, cursor + 1, cursor, modes[m].mode);
+                nredraws++;
+            }
+            while((elapsed = get_time() - start) < MIN_SECONDS);
+
+            fprintf(stderr, "  %s %9.0f/s", modes[m].name, nredraws / elapsed);
+        }
+        fprintf(stderr, "\n");
+    }
+    tcterm_set_buffered(0);
+    tcterm_set_attr_default();
+    tcterm_print("\n", 1);
+
+    free(line);
+}
+
+static void usage(FILE* file, int ecode)
+{
+    fprintf(file, "Usage: tcterm_bench [<length>...]\n"
+                  "    <length>    length of the line being redrawn (default: 80 1000 10000)\n"
+                  "Redraws go to stdout and results to stderr; redirect stdout to a file or\n"
+                  "`/dev/null` to measure just the library and system call overhead.\n");
+    exit(ecode);
+}
+int main(int argc, char** argv)
+{
+    static const size_t deflens[] = { 80, 1000, 10000 };
+
+    for(int i = 1; i < argc; i++)
+        if(!strcmp(argv[i], "-h") || !strcmp(argv[i], "--help"))
+            usage(stdout, 0);
+
+    // (fails if stdin is not a terminal, which doesn't matter for output)
+    tcterm_init_stdio();
+
+    if(argc > 1)
+        for(int i = 1; i < argc; i++)
+            benchmark(strtoul(argv[i], NULL, 10));
+    else
+        for(size_t i = 0; i < sizeof(deflens) / sizeof(*deflens); i++)
+            benchmark(deflens[i]);
+
+    tcterm_deinit();
+    return 0;
+}
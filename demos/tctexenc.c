@@ -0,0 +1,166 @@
+#define TC_THREAD_IMPLEMENTATION
+#include "../tc_thread.h"
+
+#define TC_TEXTURE_CODEC_IMPLEMENTATION
+#include "../tc_texture_codec.h"
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <math.h>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+static double get_time(void)
+{
+#if defined(_WIN32)
+    LARGE_INTEGER freq, now;
+    QueryPerformanceFrequency(&freq);
+    QueryPerformanceCounter(&now);
+    return (double)now.QuadPart / (double)freq.QuadPart;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+#endif
+}
+
+typedef enum Format
+{
+    FORMAT_BC1,
+    FORMAT_BC3,
+    FORMAT_BC4,
+    FORMAT_BC5,
+    FORMAT_BC7,
+} Format;
+static const struct
+{
+    const char* name;
+    size_t bsize;   // bytes per block
+    size_t nchan;   // channels compared for the PSNR
+} formats[] = {
+    {"BC1", 8, 3},
+    {"BC3", 16, 4},
+    {"BC4", 8, 1},
+    {"BC5", 16, 2},
+    {"BC7", 16, 4},
+};
+static const char* const quality_names[] = { "fast", "normal", "slow" };
+
+typedef struct Job
+{
+    Format format;
+    int quality;
+    const uint8_t* image;   // RGBA8
+    uint8_t* blocks;
+    size_t w, h;
+} Job;
+
+// encodes block rows [begin,end); each row is independent, so they can go to different threads
+static void encode_rows(size_t begin, size_t end, void* udata)
+{
+    const Job* job = udata;
+    size_t pitch = job->w * 4;
+    const uint8_t* src = &job->image[begin * 4 * pitch];
+    uint8_t* dst = &job->blocks[begin * (job->w / 4) * formats[job->format].bsize];
+    size_t h = (end - begin) * 4;
+    switch(job->format)
+    {
+    case FORMAT_BC1: tctex_compress_bc1(dst, src, 4, pitch, job->w, h, job->quality, false); break;
+    case FORMAT_BC3: tctex_compress_bc3(dst, src, 4, pitch, job->w, h, job->quality); break;
+    case FORMAT_BC4: tctex_compress_bc4(dst, src, 4, pitch, job->w, h, job->quality, false); break;
+    case FORMAT_BC5: tctex_compress_bc5(dst, src, 4, pitch, job->w, h, job->quality, false); break;
+    case FORMAT_BC7: tctex_compress_bc7(dst, src, 4, pitch, job->w, h, job->quality); break;
+    }
+}
+static double get_psnr(const Job* job, uint8_t* decoded)
+{
+    size_t pitch = job->w * 4;
+    switch(job->format)
+    {
+    case FORMAT_BC1: tctex_decompress_bc1(decoded, 4, pitch, job->blocks, job->w, job->h, true, false); break;
+    case FORMAT_BC3: tctex_decompress_bc3(decoded, 4, pitch, job->blocks, job->w, job->h); break;
+    case FORMAT_BC4: tctex_decompress_bc4(decoded, 4, pitch, job->blocks, job->w, job->h, false); break;
+    case FORMAT_BC5: tctex_decompress_bc5(decoded, 4, pitch, job->blocks, job->w, job->h, false); break;
+    case FORMAT_BC7: tctex_decompress_bc7(decoded, 4, pitch, job->blocks, job->w, job->h); break;
+    }
+    double err = 0.0;
+    size_t i, c;
+    for(i = 0; i < job->w * job->h; i++)
+        for(c = 0; c < formats[job->format].nchan; c++)
+        {
+            double d = (double)decoded[i * 4 + c] - (double)job->image[i * 4 + c];
+            err += d * d;
+        }
+    err /= job->w * job->h * formats[job->format].nchan;
+    return err ? 10.0 * log10(255.0 * 255.0 / err) : INFINITY;
+}
+
+// a synthetic test image: smooth gradients, a few hard edges, and some noise
+static void make_image(uint8_t* image, size_t w, size_t h)
+{
+    uint32_t rng = 12345;
+    size_t x, y;
+    for(y = 0; y < h; y++)
+        for(x = 0; x < w; x++)
+        {
+            uint8_t* p = &image[(y * w + x) * 4];
+            rng = rng * 1664525u + 1013904223u;
+            int noise = (rng >> 24) & 15;
+            p[0] = (uint8_t)(128 + 100 * sin(x * 0.05) + noise);
+            p[1] = (uint8_t)(128 + 90 * cos(y * 0.07) + noise);
+            p[2] = (uint8_t)((x / 32 + y / 32) & 1 ? 200 - noise : 40 + noise);
+            p[3] = (uint8_t)(x < w / 2 ? 255 : (x + y) & 0xFF);
+        }
+}
+
+int main(int argc, char** argv)
+{
+    unsigned int nthreads = argc > 1 ? (unsigned int)atoi(argv[1]) : tcthread_get_cpu_count();
+    size_t size = argc > 2 ? (size_t)atoi(argv[2]) : 1024;
+    if(!nthreads || size < 4 || size % 4)
+    {
+        fprintf(stderr, "Usage: %s [threads (default: # of cores)] [size (multiple of 4, default 1024)]\n", argv[0]);
+        return 2;
+    }
+
+    tcthread_pool_t pool = tcthread_pool_create(nthreads, 0);
+    if(!tcthread_pool_is_valid(pool))
+    {
+        fprintf(stderr, "Error: unable to create a thread pool\n");
+        return 1;
+    }
+
+    Job job;
+    job.w = job.h = size;
+    uint8_t* image = malloc(size * size * 4);
+    uint8_t* decoded = malloc(size * size * 4);
+    job.blocks = malloc((size / 4) * (size / 4) * 16);
+    make_image(image, size, size);
+    job.image = image;
+
+    printf("%zux%zu image, %u threads\n\n", size, size, nthreads);
+    printf("%-6s %-8s %14s %8s\n", "format", "quality", "blocks/s", "PSNR");
+    size_t f;
+    int q;
+    for(f = 0; f < sizeof(formats) / sizeof(*formats); f++)
+        for(q = TCTEX_QUALITY_FAST; q <= TCTEX_QUALITY_SLOW; q++)
+        {
+            job.format = (Format)f;
+            job.quality = q;
+            double start = get_time();
+            tcthread_pool_parallel_for(pool, size / 4, 1, encode_rows, &job);
+            double elapsed = get_time() - start;
+            printf("%-6s %-8s %14.0f %8.2f\n", formats[f].name, quality_names[q], (size / 4) * (size / 4) / elapsed, get_psnr(&job, decoded));
+            fflush(stdout);
+        }
+
+    free(job.blocks);
+    free(decoded);
+    free(image);
+    tcthread_pool_destroy(pool);
+    return 0;
+}
@@ -0,0 +1,230 @@
+#define TC_THREAD_IMPLEMENTATION
+#include "../tc_thread.h"
+
+#include <stdlib.h>
+#include <stdio.h>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+// total number of items passed through the queue, per run
+#define NUM_ITEMS       (1u << 21)
+#define QUEUE_CAPACITY  1024
+
+static double get_time(void)
+{
+#if defined(_WIN32)
+    LARGE_INTEGER freq, now;
+    QueryPerformanceFrequency(&freq);
+    QueryPerformanceCounter(&now);
+    return (double)now.QuadPart / (double)freq.QuadPart;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+#endif
+}
+
+// spin briefly, then start yielding (so that oversubscribed runs still make progress)
+static void backoff(unsigned int* spins)
+{
+    if(++*spins < 64)
+        tcthread_cpu_relax();
+    else
+        tcthread_yield();
+}
+
+// the mutex+cond queue, written like the example in the tc_thread.h docs (but bounded)
+typedef struct MutexQueue
+{
+    tcthread_mutex_t mutex;
+    tcthread_cond_t not_empty;
+    tcthread_cond_t not_full;
+    void* items[QUEUE_CAPACITY];
+    size_t head, size;
+    size_t npopped;
+} MutexQueue;
+
+typedef enum QueueKind
+{
+    QUEUE_MUTEX,
+    QUEUE_SPSC,
+    QUEUE_MPMC,
+} QueueKind;
+static const char* const queue_names[] = { "mutex", "spsc", "mpmc" };
+
+typedef struct Bench
+{
+    QueueKind kind;
+    MutexQueue mq;
+    tcthread_spsc_queue_t spsc;
+    tcthread_mpmc_queue_t mpmc;
+    size_t items_per_producer;
+    size_t total_items;
+    tcthread_atomicsz_padded_t npopped;
+    tcthread_atomicsz_padded_t checksum;
+} Bench;
+
+static void* producer(void* udata)
+{
+    Bench* bench = udata;
+    uintptr_t i;
+    for(i = 1; i <= bench->items_per_producer; i++)
+    {
+        unsigned int spins = 0;
+        switch(bench->kind)
+        {
+        case QUEUE_MUTEX:
+            tcthread_mutex_lock(bench->mq.mutex);
+            while(bench->mq.size == QUEUE_CAPACITY)
+                tcthread_cond_wait(bench->mq.not_full, bench->mq.mutex);
+            bench->mq.items[(bench->mq.head + bench->mq.size++) % QUEUE_CAPACITY] = (void*)i;
+            tcthread_mutex_unlock(bench->mq.mutex);
+            tcthread_cond_signal(bench->mq.not_empty);
+            break;
+        case QUEUE_SPSC:
+            while(!tcthread_spsc_queue_try_push(bench->spsc, (void*)i))
+                backoff(&spins);
+            break;
+        case QUEUE_MPMC:
+            while(!tcthread_mpmc_queue_try_push(bench->mpmc, (void*)i))
+                backoff(&spins);
+            break;
+        }
+    }
+    return NULL;
+}
+static void* consumer(void* udata)
+{
+    Bench* bench = udata;
+    size_t checksum = 0;
+    for(;;)
+    {
+        void* item;
+        unsigned int spins = 0;
+        if(bench->kind == QUEUE_MUTEX)
+        {
+            tcthread_mutex_lock(bench->mq.mutex);
+            while(!bench->mq.size && bench->mq.npopped < bench->total_items)
+                tcthread_cond_wait(bench->mq.not_empty, bench->mq.mutex);
+            if(bench->mq.npopped == bench->total_items)
+            {
+                tcthread_mutex_unlock(bench->mq.mutex);
+                break;
+            }
+            item = bench->mq.items[bench->mq.head];
+            bench->mq.head = (bench->mq.head + 1) % QUEUE_CAPACITY;
+            bench->mq.size--;
+            bool last = ++bench->mq.npopped == bench->total_items;
+            tcthread_mutex_unlock(bench->mq.mutex);
+            tcthread_cond_signal(bench->mq.not_full);
+            if(last)    // wake up the other consumers, so that they can exit
+                tcthread_cond_broadcast(bench->mq.not_empty);
+        }
+        else
+        {
+            bool ok = false;
+            while(tcthread_atomicsz_load_explicit(&bench->npopped.value, TCTHREAD_MEMORDER_RELAXED) < bench->total_items)
+            {
+                ok = bench->kind == QUEUE_SPSC
+                    ? tcthread_spsc_queue_try_pop(bench->spsc, &item)
+                    : tcthread_mpmc_queue_try_pop(bench->mpmc, &item);
+                if(ok) break;
+                backoff(&spins);
+            }
+            if(!ok) break;
+            tcthread_atomicsz_inc_explicit(&bench->npopped.value, TCTHREAD_MEMORDER_RELAXED);
+        }
+        checksum += (uintptr_t)item;
+    }
+    tcthread_atomicsz_fetch_add_explicit(&bench->checksum.value, checksum, TCTHREAD_MEMORDER_RELAXED);
+    return NULL;
+}
+
+// returns throughput in millions of items per second, or a negative value on error
+static double run(QueueKind kind, unsigned int nproducers, unsigned int nconsumers)
+{
+    static Bench bench;
+    bench.kind = kind;
+    bench.items_per_producer = NUM_ITEMS / nproducers;
+    bench.total_items = bench.items_per_producer * nproducers;
+    bench.npopped.value = 0;
+    bench.checksum.value = 0;
+    switch(kind)
+    {
+    case QUEUE_MUTEX:
+        bench.mq.mutex = tcthread_mutex_create(false);
+        bench.mq.not_empty = tcthread_cond_create();
+        bench.mq.not_full = tcthread_cond_create();
+        bench.mq.head = bench.mq.size = bench.mq.npopped = 0;
+        break;
+    case QUEUE_SPSC: bench.spsc = tcthread_spsc_queue_create(QUEUE_CAPACITY); break;
+    case QUEUE_MPMC: bench.mpmc = tcthread_mpmc_queue_create(QUEUE_CAPACITY); break;
+    }
+
+    tcthread_t threads[64];
+    unsigned int i;
+    double start = get_time();
+    for(i = 0; i < nconsumers; i++)
+        threads[i] = tcthread_create(0, consumer, &bench);
+    for(i = 0; i < nproducers; i++)
+        threads[nconsumers + i] = tcthread_create(0, producer, &bench);
+    for(i = 0; i < nconsumers + nproducers; i++)
+        tcthread_join(threads[i], NULL);
+    double elapsed = get_time() - start;
+
+    switch(kind)
+    {
+    case QUEUE_MUTEX:
+        tcthread_cond_destroy(bench.mq.not_full);
+        tcthread_cond_destroy(bench.mq.not_empty);
+        tcthread_mutex_destroy(bench.mq.mutex);
+        break;
+    case QUEUE_SPSC: tcthread_spsc_queue_destroy(bench.spsc); break;
+    case QUEUE_MPMC: tcthread_mpmc_queue_destroy(bench.mpmc); break;
+    }
+
+    size_t expected = (size_t)nproducers * bench.items_per_producer * (bench.items_per_producer + 1) / 2;
+    if(bench.checksum.value != expected)
+    {
+        fprintf(stderr, "Error: %s queue checksum mismatch (%zu != %zu)\n", queue_names[kind], (size_t)bench.checksum.value, expected);
+        return -1.0;
+    }
+    return bench.total_items / elapsed * 1e-6;
+}
+
+int main(int argc, char** argv)
+{
+    unsigned int max_threads = argc > 1 ? (unsigned int)atoi(argv[1]) : 64;
+    if(max_threads < 2 || max_threads > 64)
+    {
+        fprintf(stderr, "Usage: %s [max_threads (2-64, default 64)]\n", argv[0]);
+        return 2;
+    }
+    printf("# of cores: %u\n", tcthread_get_cpu_count());
+    printf("%u items per run, queue capacity %u; throughput in Mitems/s\n\n", NUM_ITEMS, QUEUE_CAPACITY);
+    printf("%8s %10s %10s %10s\n", "threads", queue_names[QUEUE_MUTEX], queue_names[QUEUE_SPSC], queue_names[QUEUE_MPMC]);
+
+    unsigned int nthreads;
+    for(nthreads = 2; nthreads <= max_threads; nthreads *= 2)
+    {
+        // half producers, half consumers; SPSC only makes sense with one of each
+        unsigned int half = nthreads / 2;
+        double mutex = run(QUEUE_MUTEX, half, half);
+        double spsc = nthreads == 2 ? run(QUEUE_SPSC, 1, 1) : 0.0;
+        double mpmc = run(QUEUE_MPMC, half, half);
+        if(mutex < 0.0 || spsc < 0.0 || mpmc < 0.0)
+            return 1;
+        printf("%8u %10.2f ", nthreads, mutex);
+        if(nthreads == 2)
+            printf("%10.2f ", spsc);
+        else
+            printf("%10s ", "-");
+        printf("%10.2f\n", mpmc);
+        fflush(stdout);
+    }
+    return 0;
+}
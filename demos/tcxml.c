@@ -84,7 +84,7 @@ static void cb_comment(tcxml_string_t text, void* udata)
 static bool cb_unknown_entity_reference(tcxml_string_t* replacement, tcxml_string_t ref, void* udata)
 {
     //printf("{EREF %s}", ref.ptr);
-    *replacement = (tcxml_string_t){ 3, "-R-" };
+    *replacement = (tcxml_string_t){ 3, "-R-", false };
     return true;
 }
 
@@ -128,11 +128,17 @@ int main(int argc, char** argv)
     FILE* file = fopen(fname, "rb");
     assert(file);
 
-    static char src[1U*1024U*1024U];
-    size_t len = fread(src, 1, sizeof(src) - 1U, file);
-    src[len] = 0;
+    // feed the file in chunks, so that we don't need to load all of it into memory
+    tcxml_sax_context_t* ctx = tcxml_sax_begin(NULL, &callbacks, NULL);
+    assert(ctx);
 
-    tcxml_error_t error = tcxml_sax_process(NULL, src, &callbacks, NULL);
+    static char chunk[4096];
+    size_t len;
+    while((len = fread(chunk, 1, sizeof(chunk), file)))
+        if(!TCXML_ERROR_IS_OK(tcxml_sax_feed(ctx, chunk, len)))
+            break;
+
+    tcxml_error_t error = tcxml_sax_end(ctx);
     fflush(stdout);
     if(!TCXML_ERROR_IS_OK(error))
         fprintf(stderr, "Error [%u:%u]: %s\n", (unsigned int)error.line + 1, (unsigned int)error.column + 1, error.message);
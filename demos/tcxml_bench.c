@@ -0,0 +1,342 @@
+#define TC_THREAD_IMPLEMENTATION
+#include "../tc_thread.h"
+#define TC_XML_IMPLEMENTATION
+#include "../tc_xml.h"
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+// each measurement is repeated until at least this much time has passed
+#define MIN_SECONDS     0.5
+// chunk size for push-mode parsing
+#define CHUNK_SIZE      65536
+
+static double get_time(void)
+{
+#if defined(_WIN32)
+    LARGE_INTEGER freq, now;
+    QueryPerformanceFrequency(&freq);
+    QueryPerformanceCounter(&now);
+    return (double)now.QuadPart / (double)freq.QuadPart;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+#endif
+}
+
+// the callbacks do a minimal amount of work, so that we measure the parser itself
+typedef struct Stats
+{
+    size_t nelements, nattrs, ntext;
+} Stats;
+
+static void cb_element_start(tcxml_string_t tag, tcxml_string_t* attrs, size_t nattrs, void* udata)
+{
+    (void)tag; (void)attrs;
+    Stats* stats = udata;
+    stats->nelements++;
+    stats->nattrs += nattrs;
+}
+static void cb_text(tcxml_string_t text, size_t body_head, size_t body_tail, void* udata)
+{
+    (void)text;
+    Stats* stats = udata;
+    stats->ntext += body_tail - body_head;
+}
+static void cb_cdata(tcxml_string_t data, void* udata)
+{
+    Stats* stats = udata;
+    stats->ntext += data.len;
+}
+
+// parallel-mode versions; each thread has its own stats, to avoid contention
+static void cb_element_start_parallel(tcxml_string_t tag, tcxml_string_t* attrs, size_t nattrs, void* udata)
+{
+    tcxml_sax_record_t* record = udata;
+    cb_element_start(tag, attrs, nattrs, (Stats*)record->udata + record->worker);
+}
+static void cb_text_parallel(tcxml_string_t text, size_t body_head, size_t body_tail, void* udata)
+{
+    tcxml_sax_record_t* record = udata;
+    cb_text(text, body_head, body_tail, (Stats*)record->udata + record->worker);
+}
+static void cb_cdata_parallel(tcxml_string_t data, void* udata)
+{
+    tcxml_sax_record_t* record = udata;
+    cb_cdata(data, (Stats*)record->udata + record->worker);
+}
+
+// a simple PRNG, so that the corpus is the same on every platform
+static uint32_t rng_state = 12345;
+static uint32_t rng_next(void)
+{
+    rng_state = rng_state * 1664525u + 1013904223u;
+    return rng_state >> 8;
+}
+
+// generate a config/feed-like document: lots of attributes, short text with the occasional reference, some comments, CDATA and UTF-8
+static char* generate_corpus(size_t minsize, size_t* len)
+{
+    static const char* const words[] = { "alpha", "beta", "gamma", "delta", "epsilon", "zeta", "theta", "lambda", "Čas", "naïve", "über", "10.5", "true" };
+    size_t nwords = sizeof(words) / sizeof(*words);
+
+    size_t mem = minsize + 4096;
+    char* src = malloc(mem);
+    size_t pos = 0;
+    pos += sprintf(&src[pos], "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n<feed>\n");
+    for(unsigned int id = 0; pos < minsize; id++)
+    {
+        const char* w0 = words[rng_next() % nwords];
+        const char* w1 = words[rng_next() % nwords];
+        const char* w2 = words[rng_next() % nwords];
+        switch(rng_next() % 8)
+        {
+        case 0:
+            pos += sprintf(&src[pos], "    <!-- record %u: %s -->\n", id, w0);
+            break;
+        case 1:
+            pos += sprintf(&src[pos], "    <blob id=\"%u\"><![CDATA[%s <%s> & %s]]></blob>\n", id, w0, w1, w2);
+            break;
+        case 2:
+            pos += sprintf(&src[pos], "    <note id=\"%u\">%s &amp; %s &lt;%s&gt;</note>\n", id, w0, w1, w2);
+            break;
+        default:
+            pos += sprintf(&src[pos], "    <item id=\"%u\" name=\"%s\" kind='%s' value=\"%s\" enabled=\"true\">\n"
+                                      "        <label lang=\"en\">%s %s %s</label>\n"
+                                      "        <pos x=\"%u\" y=\"%u\" z=\"%u\"/>\n"
+                                      "    </item>\n",
+                id, w0, w1, w2, w2, w1, w0, rng_next() % 1000, rng_next() % 1000, rng_next() % 1000);
+            break;
+        }
+    }
+    pos += sprintf(&src[pos], "</feed>\n");
+
+    *len = pos;
+    return src;
+}
+
+// generate a text-heavy document (long paragraphs), where most of the time is spent scanning text rather than on markup
+static char* generate_prose(size_t minsize, size_t* len)
+{
+    static const char* const words[] = { "lorem", "ipsum", "dolor", "sit", "amet", "consectetur", "adipiscing", "elit", "Čas", "naïve", "über" };
+    size_t nwords = sizeof(words) / sizeof(*words);
+
+    size_t mem = minsize + 8192;
+    char* src = malloc(mem);
+    size_t pos = 0;
+    pos += sprintf(&src[pos], "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n<doc>\n");
+    for(unsigned int id = 0; pos < minsize; id++)
+    {
+        pos += sprintf(&src[pos], "    <p id=\"%u\">", id);
+        for(unsigned int i = 0; i < 300; i++)
+            pos += sprintf(&src[pos], i ? " %s" : "%s", words[rng_next() % nwords]);
+        pos += sprintf(&src[pos], "</p>\n");
+    }
+    pos += sprintf(&src[pos], "</doc>\n");
+
+    *len = pos;
+    return src;
+}
+
+static char* read_file(const char* fname, size_t* len)
+{
+    FILE* file = fopen(fname, "rb");
+    if(!file)
+        return NULL;
+    size_t mem = 65536;
+    char* src = malloc(mem);
+    *len = 0;
+    size_t nread;
+    while((nread = fread(&src[*len], 1, mem - *len - 1, file)))
+    {
+        *len += nread;
+        if(mem - *len - 1 == 0)
+            src = realloc(src, mem *= 2);
+    }
+    src[*len] = 0;
+    fclose(file);
+    return src;
+}
+
+enum
+{
+    MODE_PROCESS,
+    MODE_PUSH,      // push-mode, in chunks of CHUNK_SIZE
+    MODE_DOM,
+    MODE_PARALLEL,  // `tcxml_sax_process_parallel()`
+};
+
+static tcthread_pool_t pool;
+
+static tcxml_error_t parse(tcxml_sax_buffers_t* bufs, tcxml_dom_t* dom, const char* src, size_t len, const tcxml_sax_callbacks_t* cbs, Stats* stats, int mode)
+{
+    switch(mode)
+    {
+    case MODE_PROCESS:
+        return tcxml_sax_process(bufs, src, cbs, stats);
+    case MODE_DOM:
+        return tcxml_dom_parse(dom, bufs, src, cbs->flags & ~TCXML_BORROW_STRINGS);
+    case MODE_PARALLEL:
+        {
+            tcxml_sax_callbacks_t pcbs = {
+                .flags = cbs->flags,
+                .element_start = cb_element_start_parallel,
+                .text = cb_text_parallel,
+                .cdata = cb_cdata_parallel,
+            };
+            return tcxml_sax_process_parallel(bufs, src, &pcbs, stats, pool);
+        }
+    }
+
+    tcxml_sax_context_t* ctx = tcxml_sax_begin(bufs, cbs, stats);
+    for(size_t pos = 0; pos < len; pos += CHUNK_SIZE)
+        if(!TCXML_ERROR_IS_OK(tcxml_sax_feed(ctx, &src[pos], len - pos < CHUNK_SIZE ? len - pos : CHUNK_SIZE)))
+            break;
+    return tcxml_sax_end(ctx);
+}
+
+static void benchmark(const char* name, const char* src, size_t len)
+{
+    static const struct { unsigned int accel; const char* name; } accels[] = {
+        { TCXML_ACCEL_NONE, "scalar" },
+        { TCXML_ACCEL_X86_SSE2, "SSE2" },
+        { TCXML_ACCEL_X86_SSE2 | TCXML_ACCEL_X86_AVX2, "AVX2" },
+        { TCXML_ACCEL_ARM_NEON, "NEON" },
+    };
+    static const struct { uint32_t flags; int mode; const char* name; } modes[] = {
+        { 0, MODE_PROCESS, "copy" },
+        { TCXML_BORROW_STRINGS, MODE_PROCESS, "borrow" },
+        { TCXML_BORROW_STRINGS | TCXML_VALIDATE_UTF8, MODE_PROCESS, "borrow+utf8" },
+        { TCXML_BORROW_STRINGS, MODE_PUSH, "borrow+push" },
+        { TCXML_BORROW_STRINGS, MODE_DOM, "dom" },
+        { TCXML_BORROW_STRINGS, MODE_PARALLEL, "borrow+parallel" },
+    };
+
+    printf("%s (%.2f MiB)\n", name, len / (1024.0 * 1024.0));
+
+    tcxml_sax_buffers_t bufs;
+    tcxml_sax_buffers_init(&bufs);
+    tcxml_dom_t dom;
+    tcxml_dom_init(&dom);
+    // (one per worker, plus one for the calling thread; see `tcxml_sax_record_t`)
+    Stats* stats = malloc((tcthread_pool_get_thread_count(pool) + 1) * sizeof(*stats));
+
+    unsigned int supported = tcxml_accel_get_supported();
+    for(size_t a = 0; a < sizeof(accels) / sizeof(*accels); a++)
+    {
+        if(accels[a].accel && (accels[a].accel & supported) != accels[a].accel)
+            continue;
+        tcxml_accel_set(accels[a].accel);
+
+        printf("  %-8s", accels[a].name);
+        for(size_t m = 0; m < sizeof(modes) / sizeof(*modes); m++)
+        {
+            tcxml_sax_callbacks_t cbs = {
+                .flags = modes[m].flags,
+                .element_start = cb_element_start,
+                .text = cb_text,
+                .cdata = cb_cdata,
+            };
+
+            memset(stats, 0, (tcthread_pool_get_thread_count(pool) + 1) * sizeof(*stats));
+            size_t nruns = 0;
+            double start = get_time(), elapsed;
+            do
+            {
+                tcxml_error_t error = parse(&bufs, &dom, src, len, &cbs, stats, modes[m].mode);
+                if(!TCXML_ERROR_IS_OK(error))
+                {
+                    printf("\n    Error [%u:%u]: %s\n", (unsigned int)error.line + 1, (unsigned int)error.column + 1, error.message);
+                    goto done;
+                }
+                nruns++;
+            }
+            while((elapsed = get_time() - start) < MIN_SECONDS);
+
+            printf("  %s %7.1f MB/s", modes[m].name, (double)len * nruns / elapsed * 1e-6);
+            fflush(stdout);
+        }
+        printf("\n");
+    }
+
+done:
+    free(stats);
+    tcxml_sax_buffers_deinit(&bufs);
+    tcxml_dom_deinit(&dom);
+    tcxml_accel_set(TCXML_ACCEL_ALL);
+}
+
+static void usage(FILE* file, int ecode)
+{
+    fprintf(file, "Usage: tcxml_bench [-s <MiB>] [-j <threads>] [<xmlfile>...]\n"
+                  "    -s <MiB>    size of the synthetic documents (default: 64; 0 to skip)\n"
+                  "    -j <n>      number of threads for parallel parsing (default: # of CPU cores)\n"
+                  "If no files are given, `demos/test.xml` is used.\n");
+    exit(ecode);
+}
+int main(int argc, char** argv)
+{
+    size_t corpus_mib = 64;
+    uint32_t nthreads = 0;
+    int nfiles = 0;
+    for(int i = 1; i < argc; i++)
+    {
+        if(!strcmp(argv[i], "-h") || !strcmp(argv[i], "--help"))
+            usage(stdout, 0);
+        else if(!strcmp(argv[i], "-s"))
+        {
+            if(++i >= argc)
+                usage(stderr, 2);
+            corpus_mib = strtoul(argv[i], NULL, 10);
+        }
+        else if(!strcmp(argv[i], "-j"))
+        {
+            if(++i >= argc)
+                usage(stderr, 2);
+            nthreads = strtoul(argv[i], NULL, 10);
+        }
+        else
+            argv[1 + nfiles++] = argv[i];
+    }
+    if(!nfiles)
+        argv[1 + nfiles++] = "demos/test.xml";
+
+    if(!nthreads)
+        nthreads = tcthread_get_cpu_count();
+    pool = tcthread_pool_create(nthreads ? nthreads : 1, 0);
+
+    for(int i = 0; i < nfiles; i++)
+    {
+        size_t len;
+        char* src = read_file(argv[1 + i], &len);
+        if(!src)
+        {
+            fprintf(stderr, "Unable to read `%s`\n", argv[1 + i]);
+            continue;
+        }
+        benchmark(argv[1 + i], src, len);
+        free(src);
+    }
+
+    if(corpus_mib)
+    {
+        size_t len;
+        char* src = generate_corpus(corpus_mib * 1024 * 1024, &len);
+        benchmark("synthetic corpus", src, len);
+        free(src);
+        src = generate_prose(corpus_mib * 1024 * 1024, &len);
+        benchmark("synthetic prose", src, len);
+        free(src);
+    }
+
+    tcthread_pool_destroy(pool);
+    return 0;
+}
@@ -0,0 +1,1948 @@
+/*
+ * tc_checksum.h: Checksums & non-cryptographic hash functions.
+ *
+ * DEPENDS:
+ * VERSION: 0.0.1 (2026-10-14)
+ * LICENSE: CC0 & Boost (dual-licensed)
+ * AUTHOR: Tim Cas
+ * URL: https://github.com/darkuranium/tclib
+ *
+ * VERSION HISTORY:
+ * 0.0.1    initial public release (CRC32, CRC32C, xxHash32, xxHash64, XXH3-{64,128})
+ *
+ * TODOs:
+ * - Adler-32, CRC-64
+ * - ARMv8 PMULL folding for CRC (currently only the CRC32 instructions are used)
+ * - vectorized XXH3 accumulation on ARM (NEON)
+ * - XXH3 with custom (user-provided) secrets
+ *
+ *
+ *
+ * A library of fast checksums and non-cryptographic hash functions. These are
+ * meant for error detection, hash tables, deduplication and the like --- they
+ * offer *no* protection whatsoever against a malicious adversary. Use
+ * `tc_hash` if you need that.
+ *
+ * A single file should contain the following `#define` before including the header:
+ *
+ *      #define TC_CHECKSUM_IMPLEMENTATION
+ *      #include "tc_checksum.h"
+ *
+ */
+
+/* ========== API ==========
+ *
+ * The API mirrors that of `tc_hash`: every algorithm has a one-shot function
+ * and a streaming API, the latter consisting of a state struct plus
+ * `init()`, `process()` and `get()` functions. Since the results are small,
+ * they are returned by value (as integers) instead of via a digest buffer.
+ *
+ * For example, with CRC32C:
+ *
+ *      uint32_t crc = tcsum_crc32c(data, length_in_bytes);
+ *
+ * Or, streaming:
+ *
+ *      TCSum_CRC32C state;
+ *      tcsum_crc32c_init(&state);
+ *      while((nbytes = fread(buffer, 1, sizeof(buffer), file)))
+ *          tcsum_crc32c_process(&state, buffer, nbytes);
+ *      uint32_t crc = tcsum_crc32c_get(&state);
+ *
+ * As with `tc_hash`, there is nothing to deinitialize, the state can be
+ * copied by assignment, and `get()` does not modify the state (so it can be
+ * used to fetch intermediate results).
+ *
+ * The results are identical to those of the reference implementations (zlib's
+ * `crc32()`, the iSCSI/SSE4.2 CRC32C, and xxHash's `XXH32()`, `XXH64()`,
+ * `XXH3_64bits_withSeed()` and `XXH3_128bits_withSeed()`) --- when storing
+ * them in a file, remember to pick a byte order, since they are integers.
+ */
+
+/*
+ * SYNOPSIS:
+ *  TCSum_CRC32* tcsum_crc32_init(TCSum_CRC32* crc32);
+ *  void tcsum_crc32_process(TCSum_CRC32* crc32, const void* data, size_t dlen);
+ *  uint32_t tcsum_crc32_get(const TCSum_CRC32* crc32);
+ *  uint32_t tcsum_crc32(const void* data, size_t dlen);
+ *  uint32_t tcsum_crc32_combine(uint32_t crcA, uint32_t crcB, uint64_t lenB);
+ *
+ *  (and the same for `crc32c`)
+ * PARAMETERS:
+ *  - crc32: streaming state
+ *  - data: data to checksum
+ *  - dlen: length of `data`, in bytes
+ *  - crcA: checksum of the first chunk `A`
+ *  - crcB: checksum of the second chunk `B`
+ *  - lenB: length of `B`, in bytes
+ * RETURN VALUE:
+ *  - tcsum_crc32_init: the `crc32` parameter
+ *  - tcsum_crc32_get, tcsum_crc32: the checksum
+ *  - tcsum_crc32_combine: the checksum of `A` and `B`, concatenated
+ * DESCRIPTION:
+ *  Compute a CRC32 (IEEE 802.3; as used by zlib, gzip, PNG, ...) or a CRC32C
+ *  (Castagnoli; as used by iSCSI, ext4, Btrfs, SSE4.2, ...) checksum.
+ *
+ *  The portable implementation uses slicing-by-8 tables. Where available,
+ *  larger inputs are folded with carry-less multiplication (x86 PCLMULQDQ),
+ *  and the remainder is done via the dedicated CRC instructions (SSE4.2 for
+ *  CRC32C; ARMv8 CRC32 for both).
+ *
+ *  `tcsum_crc32_combine()` computes `crc32(A || B)` given only `crc32(A)`,
+ *  `crc32(B)` and the length of `B`, in O(log(lenB)) time. This allows
+ *  splitting a large input into chunks that are checksummed independently
+ *  (for example, in parallel) and merged afterwards.
+ *
+ *
+ * SYNOPSIS:
+ *  TCSum_XXH32* tcsum_xxh32_init(TCSum_XXH32* state, uint32_t seed);
+ *  void tcsum_xxh32_process(TCSum_XXH32* state, const void* data, size_t dlen);
+ *  uint32_t tcsum_xxh32_get(const TCSum_XXH32* state);
+ *  uint32_t tcsum_xxh32(const void* data, size_t dlen, uint32_t seed);
+ *
+ *  TCSum_XXH64* tcsum_xxh64_init(TCSum_XXH64* state, uint64_t seed);
+ *  void tcsum_xxh64_process(TCSum_XXH64* state, const void* data, size_t dlen);
+ *  uint64_t tcsum_xxh64_get(const TCSum_XXH64* state);
+ *  uint64_t tcsum_xxh64(const void* data, size_t dlen, uint64_t seed);
+ * PARAMETERS:
+ *  - state: streaming state
+ *  - seed: seed value (use `0` if unsure)
+ *  - data: data to hash
+ *  - dlen: length of `data`, in bytes
+ * RETURN VALUE:
+ *  - tcsum_xxh*_init: the `state` parameter
+ *  - tcsum_xxh*_get, tcsum_xxh*: the hash
+ * DESCRIPTION:
+ *  Compute the xxHash32 or xxHash64 hash of data. For new code, XXH3 (below)
+ *  is generally preferable, as it is both faster and of better quality.
+ *
+ *
+ * SYNOPSIS:
+ *  TCSum_XXH3* tcsum_xxh3_init(TCSum_XXH3* state, uint64_t seed);
+ *  void tcsum_xxh3_process(TCSum_XXH3* state, const void* data, size_t dlen);
+ *  uint64_t tcsum_xxh3_64_get(const TCSum_XXH3* state);
+ *  TCSum_U128 tcsum_xxh3_128_get(const TCSum_XXH3* state);
+ *  uint64_t tcsum_xxh3_64(const void* data, size_t dlen, uint64_t seed);
+ *  TCSum_U128 tcsum_xxh3_128(const void* data, size_t dlen, uint64_t seed);
+ * PARAMETERS:
+ *  - state: streaming state
+ *  - seed: seed value (use `0` if unsure)
+ *  - data: data to hash
+ *  - dlen: length of `data`, in bytes
+ * RETURN VALUE:
+ *  - tcsum_xxh3_init: the `state` parameter
+ *  - tcsum_xxh3_64_get, tcsum_xxh3_64: the 64-bit hash
+ *  - tcsum_xxh3_128_get, tcsum_xxh3_128: the 128-bit hash
+ * DESCRIPTION:
+ *  Compute the XXH3 hash of data, in its 64-bit or 128-bit variant.
+ *
+ *  The variants share a streaming state; in other words, the same state can
+ *  be used to fetch both the 64-bit and the 128-bit hash of the same data.
+ *
+ *  Inputs above 240 bytes are processed in 64-byte stripes, using SSE2 or AVX2
+ *  on x86 where available.
+ *
+ *
+ * SYNOPSIS:
+ *  unsigned int tcsum_accel_get_supported(void);
+ *  unsigned int tcsum_accel_get(void);
+ *  unsigned int tcsum_accel_set(unsigned int accel);
+ * PARAMETERS:
+ *  - accel: bitmask of `TCSUM_ACCEL_*` values to enable (`TCSUM_ACCEL_ALL`
+ *           to enable everything available, `TCSUM_ACCEL_NONE` to force the
+ *           portable implementations)
+ * RETURN VALUE:
+ *  - tcsum_accel_get_supported: bitmask of accelerations supported by both the CPU and the build
+ *  - tcsum_accel_get: bitmask of accelerations currently in use
+ *  - tcsum_accel_set: the new bitmask of accelerations in use (which may be a subset of `accel`)
+ * DESCRIPTION:
+ *  Query or restrict the use of hardware acceleration, in the same manner as
+ *  `tchash_accel_*()`. The following are currently available:
+ *  - `TCSUM_ACCEL_X86_SSE2`: XXH3 stripe accumulation
+ *  - `TCSUM_ACCEL_X86_AVX2`: XXH3 stripe accumulation
+ *  - `TCSUM_ACCEL_X86_SSE42`: CRC32C instruction
+ *  - `TCSUM_ACCEL_X86_PCLMUL`: CRC32 & CRC32C folding (for larger inputs)
+ *  - `TCSUM_ACCEL_ARM_CRC32`: ARMv8 CRC32 & CRC32C instructions
+ *
+ *  All implementations produce identical results. Calling
+ *  `tcsum_accel_set()` while another thread is checksumming is undefined.
+ *
+ *  Acceleration can be disabled entirely at compile-time by defining
+ *  `TCSUM_NO_ACCEL` before including the implementation.
+ */
+
+#ifndef TC_CHECKSUM_H_
+#define TC_CHECKSUM_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define TCSUM_ACCEL_NONE        0x0000u
+#define TCSUM_ACCEL_X86_SSE2    0x0001u
+#define TCSUM_ACCEL_X86_AVX2    0x0002u
+#define TCSUM_ACCEL_X86_SSE42   0x0004u
+#define TCSUM_ACCEL_X86_PCLMUL  0x0008u
+#define TCSUM_ACCEL_ARM_CRC32   0x0100u
+#define TCSUM_ACCEL_ALL         (~0u)
+unsigned int tcsum_accel_get_supported(void);
+unsigned int tcsum_accel_get(void);
+unsigned int tcsum_accel_set(unsigned int accel);
+
+typedef struct TCSum_U128
+{
+    uint64_t lo, hi;
+} TCSum_U128;
+
+typedef struct TCSum_CRC32
+{
+    uint32_t crc;
+} TCSum_CRC32;
+typedef struct TCSum_CRC32
+    TCSum_CRC32C;
+
+typedef struct TCSum_XXH32
+{
+    uint32_t v[4];
+    uint64_t total;
+    union
+    {
+        uint32_t M[4];
+        unsigned char b[16];
+    } buf;
+    unsigned char blen;
+} TCSum_XXH32;
+
+typedef struct TCSum_XXH64
+{
+    uint64_t v[4];
+    uint64_t total;
+    union
+    {
+        uint64_t M[4];
+        unsigned char b[32];
+    } buf;
+    unsigned char blen;
+} TCSum_XXH64;
+
+#define TCSUM_XXH3_SECRET_SIZE  192
+#define TCSUM_XXH3_BUFFER_SIZE  256
+typedef struct TCSum_XXH3
+{
+    uint64_t acc[8];
+    uint64_t total;
+    uint64_t seed;
+    size_t nstripes;
+    size_t blen;
+    unsigned char secret[TCSUM_XXH3_SECRET_SIZE];
+    unsigned char buf[TCSUM_XXH3_BUFFER_SIZE];
+} TCSum_XXH3;
+
+TCSum_CRC32* tcsum_crc32_init(TCSum_CRC32* crc32);
+void tcsum_crc32_process(TCSum_CRC32* crc32, const void* data, size_t dlen);
+uint32_t tcsum_crc32_get(const TCSum_CRC32* crc32);
+uint32_t tcsum_crc32(const void* data, size_t dlen);
+uint32_t tcsum_crc32_combine(uint32_t crcA, uint32_t crcB, uint64_t lenB);
+
+TCSum_CRC32C* tcsum_crc32c_init(TCSum_CRC32C* crc32c);
+void tcsum_crc32c_process(TCSum_CRC32C* crc32c, const void* data, size_t dlen);
+uint32_t tcsum_crc32c_get(const TCSum_CRC32C* crc32c);
+uint32_t tcsum_crc32c(const void* data, size_t dlen);
+uint32_t tcsum_crc32c_combine(uint32_t crcA, uint32_t crcB, uint64_t lenB);
+
+TCSum_XXH32* tcsum_xxh32_init(TCSum_XXH32* state, uint32_t seed);
+void tcsum_xxh32_process(TCSum_XXH32* state, const void* data, size_t dlen);
+uint32_t tcsum_xxh32_get(const TCSum_XXH32* state);
+uint32_t tcsum_xxh32(const void* data, size_t dlen, uint32_t seed);
+
+TCSum_XXH64* tcsum_xxh64_init(TCSum_XXH64* state, uint64_t seed);
+void tcsum_xxh64_process(TCSum_XXH64* state, const void* data, size_t dlen);
+uint64_t tcsum_xxh64_get(const TCSum_XXH64* state);
+uint64_t tcsum_xxh64(const void* data, size_t dlen, uint64_t seed);
+
+TCSum_XXH3* tcsum_xxh3_init(TCSum_XXH3* state, uint64_t seed);
+void tcsum_xxh3_process(TCSum_XXH3* state, const void* data, size_t dlen);
+uint64_t tcsum_xxh3_64_get(const TCSum_XXH3* state);
+TCSum_U128 tcsum_xxh3_128_get(const TCSum_XXH3* state);
+uint64_t tcsum_xxh3_64(const void* data, size_t dlen, uint64_t seed);
+TCSum_U128 tcsum_xxh3_128(const void* data, size_t dlen, uint64_t seed);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TC_CHECKSUM_H_ */
+
+
+
+#ifdef TC_CHECKSUM_IMPLEMENTATION
+#undef TC_CHECKSUM_IMPLEMENTATION
+#include <string.h>
+
+#ifndef TC__STATIC_CAST
+#ifdef __cplusplus
+#define TC__STATIC_CAST(T,v) static_cast<T>(v)
+#else
+#define TC__STATIC_CAST(T,v) ((T)(v))
+#endif
+#endif /* TC__STATIC_CAST */
+
+/* no cast done to preserve undefined function warnings in C */
+#ifndef TC__VOID_CAST
+#ifdef __cplusplus
+#define TC__VOID_CAST(T,v)  TC__STATIC_CAST(T,v)
+#else
+#define TC__VOID_CAST(T,v)  (v)
+#endif
+#endif /* TC__VOID_CAST */
+
+/* hardware acceleration; see `tcsum_accel_*()` */
+#ifndef TCSUM_NO_ACCEL
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define TCSUM_I_ACCEL_X86_
+#define TCSUM_I_TARGET_X86_(T) __attribute__((target(T)))
+#include <cpuid.h>
+#include <immintrin.h>
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#define TCSUM_I_ACCEL_X86_
+#define TCSUM_I_TARGET_X86_(T)
+#include <intrin.h>
+#include <immintrin.h>
+#elif (defined(__GNUC__) || defined(__clang__)) && defined(__aarch64__)
+#define TCSUM_I_ACCEL_ARM_
+#ifdef __clang__
+#define TCSUM_I_TARGET_ARM_CRC_ __attribute__((target("crc")))
+#else
+#define TCSUM_I_TARGET_ARM_CRC_ __attribute__((target("+crc")))
+#endif
+#include <arm_acle.h>
+#if defined(__linux__) || defined(__FreeBSD__)
+#include <sys/auxv.h>
+#endif
+#endif
+#endif /* TCSUM_NO_ACCEL */
+
+#define TCSUM_I_ACCEL_UNINIT_   0x80000000u
+static unsigned int tcsum_i_accel_ = TCSUM_I_ACCEL_UNINIT_;
+
+#ifdef TCSUM_I_ACCEL_X86_
+/* regs: {eax,ebx,ecx,edx}; returns 0 if the leaf is not available */
+static int tcsum_i_cpuid_(uint32_t regs[4], uint32_t leaf, uint32_t subleaf)
+{
+#ifdef _MSC_VER
+    int iregs[4];
+    __cpuid(iregs, leaf & 0x80000000u);
+    if(TC__STATIC_CAST(uint32_t,iregs[0]) < leaf) return 0;
+    __cpuidex(iregs, leaf, subleaf);
+    regs[0] = iregs[0]; regs[1] = iregs[1]; regs[2] = iregs[2]; regs[3] = iregs[3];
+    return 1;
+#else
+    unsigned int a, b, c, d;
+    if(__get_cpuid_max(leaf & 0x80000000u, NULL) < leaf) return 0;
+    __cpuid_count(leaf, subleaf, a, b, c, d);
+    regs[0] = a; regs[1] = b; regs[2] = c; regs[3] = d;
+    return 1;
+#endif
+}
+/* only valid if CPUID.1:ECX[27] (OSXSAVE) is set */
+static uint64_t tcsum_i_xgetbv_(uint32_t idx)
+{
+#ifdef _MSC_VER
+    return _xgetbv(idx);
+#else
+    uint32_t lo, hi;
+    __asm__ __volatile__("xgetbv" : "=a"(lo), "=d"(hi) : "c"(idx));
+    return (TC__STATIC_CAST(uint64_t,hi) << 32) | lo;
+#endif
+}
+#endif /* TCSUM_I_ACCEL_X86_ */
+unsigned int tcsum_accel_get_supported(void)
+{
+    unsigned int accel = TCSUM_ACCEL_NONE;
+#if defined(TCSUM_I_ACCEL_X86_)
+    uint32_t r1[4], r7[4];
+    if(!tcsum_i_cpuid_(r1, 1, 0)) return accel;
+    if(!tcsum_i_cpuid_(r7, 7, 0)) r7[0] = r7[1] = r7[2] = r7[3] = 0;
+
+    /* SSE2: CPUID.1:EDX[26] */
+    if(r1[3] & (UINT32_C(1) << 26))
+        accel |= TCSUM_ACCEL_X86_SSE2;
+    /* SSE4.2: CPUID.1:ECX[20] */
+    if(r1[2] & (UINT32_C(1) << 20))
+        accel |= TCSUM_ACCEL_X86_SSE42;
+    /* PCLMULQDQ: CPUID.1:ECX[1]; our implementation also uses SSE2 */
+    if((r1[2] & (UINT32_C(1) << 1)) && (r1[3] & (UINT32_C(1) << 26)))
+        accel |= TCSUM_ACCEL_X86_PCLMUL;
+    /* AVX2 also requires the OS to save the YMM state (XCR0[2:1]) */
+    if((r1[2] & (UINT32_C(1) << 27)) && (r1[2] & (UINT32_C(1) << 28)))
+    {
+        uint64_t xcr0 = tcsum_i_xgetbv_(0);
+        /* AVX2: CPUID.7.0:EBX[5] */
+        if((xcr0 & 0x06) == 0x06 && (r7[1] & (UINT32_C(1) << 5)))
+            accel |= TCSUM_ACCEL_X86_AVX2;
+    }
+#elif defined(TCSUM_I_ACCEL_ARM_)
+#if defined(__APPLE__)
+    /* every Apple ARM64 CPU has these */
+    accel |= TCSUM_ACCEL_ARM_CRC32;
+#elif defined(__linux__) || defined(__FreeBSD__)
+    unsigned long hwcap;
+#if defined(__linux__)
+    hwcap = getauxval(AT_HWCAP);
+#else
+    if(elf_aux_info(AT_HWCAP, &hwcap, sizeof(hwcap))) hwcap = 0;
+#endif
+    if(hwcap & (1ul << 7)) accel |= TCSUM_ACCEL_ARM_CRC32; /* HWCAP_CRC32 */
+#else
+    /* no way to query; trust the compiler flags */
+#if defined(__ARM_FEATURE_CRC32)
+    accel |= TCSUM_ACCEL_ARM_CRC32;
+#endif
+#endif
+#endif
+    return accel;
+}
+unsigned int tcsum_accel_get(void)
+{
+    if(tcsum_i_accel_ & TCSUM_I_ACCEL_UNINIT_)
+        tcsum_i_accel_ = tcsum_accel_get_supported();
+    return tcsum_i_accel_;
+}
+unsigned int tcsum_accel_set(unsigned int accel)
+{
+    return tcsum_i_accel_ = accel & tcsum_accel_get_supported() & ~TCSUM_I_ACCEL_UNINIT_;
+}
+
+/* all of the algorithms here are little-endian */
+static uint32_t tcsum_i_read32_(const unsigned char* p)
+{
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    uint32_t v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+#else
+    return TC__STATIC_CAST(uint32_t,p[0])
+        | (TC__STATIC_CAST(uint32_t,p[1]) << 8)
+        | (TC__STATIC_CAST(uint32_t,p[2]) << 16)
+        | (TC__STATIC_CAST(uint32_t,p[3]) << 24);
+#endif
+}
+static uint64_t tcsum_i_read64_(const unsigned char* p)
+{
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    uint64_t v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+#else
+    return tcsum_i_read32_(p) | (TC__STATIC_CAST(uint64_t,tcsum_i_read32_(p + 4)) << 32);
+#endif
+}
+static void tcsum_i_write64_(unsigned char* p, uint64_t v)
+{
+    int i;
+    for(i = 0; i < 8; i++)
+        p[i] = TC__STATIC_CAST(unsigned char,v >> (i * 8));
+}
+static uint32_t tcsum_i_rotl32_(uint32_t x, int k)
+{
+    return (x << k) | (x >> (32-k));
+}
+static uint64_t tcsum_i_rotl64_(uint64_t x, int k)
+{
+    return (x << k) | (x >> (64-k));
+}
+static uint32_t tcsum_i_bswap32_(uint32_t x)
+{
+    return (x >> 24) | ((x >> 8) & UINT32_C(0x0000FF00)) | ((x << 8) & UINT32_C(0x00FF0000)) | (x << 24);
+}
+static uint64_t tcsum_i_bswap64_(uint64_t x)
+{
+    return tcsum_i_bswap32_(TC__STATIC_CAST(uint32_t,x >> 32)) | (TC__STATIC_CAST(uint64_t,tcsum_i_bswap32_(TC__STATIC_CAST(uint32_t,x))) << 32);
+}
+/* full 64x64->128-bit multiplication */
+static TCSum_U128 tcsum_i_mul128_(uint64_t a, uint64_t b)
+{
+    TCSum_U128 r;
+#if defined(__SIZEOF_INT128__)
+    unsigned __int128 p = TC__STATIC_CAST(unsigned __int128,a) * b;
+    r.lo = TC__STATIC_CAST(uint64_t,p);
+    r.hi = TC__STATIC_CAST(uint64_t,p >> 64);
+#elif defined(_MSC_VER) && defined(_M_X64)
+    r.lo = _umul128(a, b, &r.hi);
+#else
+    uint64_t lolo = (a & 0xFFFFFFFFu) * (b & 0xFFFFFFFFu);
+    uint64_t hilo = (a >> 32) * (b & 0xFFFFFFFFu);
+    uint64_t lohi = (a & 0xFFFFFFFFu) * (b >> 32);
+    uint64_t hihi = (a >> 32) * (b >> 32);
+    uint64_t cross = (lolo >> 32) + (hilo & 0xFFFFFFFFu) + lohi;
+    r.hi = (hilo >> 32) + (cross >> 32) + hihi;
+    r.lo = (cross << 32) | (lolo & 0xFFFFFFFFu);
+#endif
+    return r;
+}
+static uint64_t tcsum_i_mul128_fold64_(uint64_t a, uint64_t b)
+{
+    TCSum_U128 r = tcsum_i_mul128_(a, b);
+    return r.lo ^ r.hi;
+}
+
+/* ========== CRC32 & CRC32C ========== */
+
+/* slicing-by-8: table[k][i] is the CRC of byte `i` followed by `k` zero bytes */
+static const uint32_t tcsum_i_crc32_table[8][256] = {
+    {
+        UINT32_C(0x00000000), UINT32_C(0x77073096), UINT32_C(0xee0e612c), UINT32_C(0x990951ba), UINT32_C(0x076dc419), UINT32_C(0x706af48f), UINT32_C(0xe963a535), UINT32_C(0x9e6495a3),
+        UINT32_C(0x0edb8832), UINT32_C(0x79dcb8a4), UINT32_C(0xe0d5e91e), UINT32_C(0x97d2d988), UINT32_C(0x09b64c2b), UINT32_C(0x7eb17cbd), UINT32_C(0xe7b82d07), UINT32_C(0x90bf1d91),
+        UINT32_C(0x1db71064), UINT32_C(0x6ab020f2), UINT32_C(0xf3b97148), UINT32_C(0x84be41de), UINT32_C(0x1adad47d), UINT32_C(0x6ddde4eb), UINT32_C(0xf4d4b551), UINT32_C(0x83d385c7),
+        UINT32_C(0x136c9856), UINT32_C(0x646ba8c0), UINT32_C(0xfd62f97a), UINT32_C(0x8a65c9ec), UINT32_C(0x14015c4f), UINT32_C(0x63066cd9), UINT32_C(0xfa0f3d63), UINT32_C(0x8d080df5),
+        UINT32_C(0x3b6e20c8), UINT32_C(0x4c69105e), UINT32_C(0xd56041e4), UINT32_C(0xa2677172), UINT32_C(0x3c03e4d1), UINT32_C(0x4b04d447), UINT32_C(0xd20d85fd), UINT32_C(0xa50ab56b),
+        UINT32_C(0x35b5a8fa), UINT32_C(0x42b2986c), UINT32_C(0xdbbbc9d6), UINT32_C(0xacbcf940), UINT32_C(0x32d86ce3), UINT32_C(0x45df5c75), UINT32_C(0xdcd60dcf), UINT32_C(0xabd13d59),
+        UINT32_C(0x26d930ac), UINT32_C(0x51de003a), UINT32_C(0xc8d75180), UINT32_C(0xbfd06116), UINT32_C(0x21b4f4b5), UINT32_C(0x56b3c423), UINT32_C(0xcfba9599), UINT32_C(0xb8bda50f),
+        UINT32_C(0x2802b89e), UINT32_C(0x5f058808), UINT32_C(0xc60cd9b2), UINT32_C(0xb10be924), UINT32_C(0x2f6f7c87), UINT32_C(0x58684c11), UINT32_C(0xc1611dab), UINT32_C(0xb6662d3d),
+        UINT32_C(0x76dc4190), UINT32_C(0x01db7106), UINT32_C(0x98d220bc), UINT32_C(0xefd5102a), UINT32_C(0x71b18589), UINT32_C(0x06b6b51f), UINT32_C(0x9fbfe4a5), UINT32_C(0xe8b8d433),
+        UINT32_C(0x7807c9a2), UINT32_C(0x0f00f934), UINT32_C(0x9609a88e), UINT32_C(0xe10e9818), UINT32_C(0x7f6a0dbb), UINT32_C(0x086d3d2d), UINT32_C(0x91646c97), UINT32_C(0xe6635c01),
+        UINT32_C(0x6b6b51f4), UINT32_C(0x1c6c6162), UINT32_C(0x856530d8), UINT32_C(0xf262004e), UINT32_C(0x6c0695ed), UINT32_C(0x1b01a57b), UINT32_C(0x8208f4c1), UINT32_C(0xf50fc457),
+        UINT32_C(0x65b0d9c6), UINT32_C(0x12b7e950), UINT32_C(0x8bbeb8ea), UINT32_C(0xfcb9887c), UINT32_C(0x62dd1ddf), UINT32_C(0x15da2d49), UINT32_C(0x8cd37cf3), UINT32_C(0xfbd44c65),
+        UINT32_C(0x4db26158), UINT32_C(0x3ab551ce), UINT32_C(0xa3bc0074), UINT32_C(0xd4bb30e2), UINT32_C(0x4adfa541), UINT32_C(0x3dd895d7), UINT32_C(0xa4d1c46d), UINT32_C(0xd3d6f4fb),
+        UINT32_C(0x4369e96a), UINT32_C(0x346ed9fc), UINT32_C(0xad678846), UINT32_C(0xda60b8d0), UINT32_C(0x44042d73), UINT32_C(0x33031de5), UINT32_C(0xaa0a4c5f), UINT32_C(0xdd0d7cc9),
+        UINT32_C(0x5005713c), UINT32_C(0x270241aa), UINT32_C(0xbe0b1010), UINT32_C(0xc90c2086), UINT32_C(0x5768b525), UINT32_C(0x206f85b3), UINT32_C(0xb966d409), UINT32_C(0xce61e49f),
+        UINT32_C(0x5edef90e), UINT32_C(0x29d9c998), UINT32_C(0xb0d09822), UINT32_C(0xc7d7a8b4), UINT32_C(0x59b33d17), UINT32_C(0x2eb40d81), UINT32_C(0xb7bd5c3b), UINT32_C(0xc0ba6cad),
+        UINT32_C(0xedb88320), UINT32_C(0x9abfb3b6), UINT32_C(0x03b6e20c), UINT32_C(0x74b1d29a), UINT32_C(0xead54739), UINT32_C(0x9dd277af), UINT32_C(0x04db2615), UINT32_C(0x73dc1683),
+        UINT32_C(0xe3630b12), UINT32_C(0x94643b84), UINT32_C(0x0d6d6a3e), UINT32_C(0x7a6a5aa8), UINT32_C(0xe40ecf0b), UINT32_C(0x9309ff9d), UINT32_C(0x0a00ae27), UINT32_C(0x7d079eb1),
+        UINT32_C(0xf00f9344), UINT32_C(0x8708a3d2), UINT32_C(0x1e01f268), UINT32_C(0x6906c2fe), UINT32_C(0xf762575d), UINT32_C(0x806567cb), UINT32_C(0x196c3671), UINT32_C(0x6e6b06e7),
+        UINT32_C(0xfed41b76), UINT32_C(0x89d32be0), UINT32_C(0x10da7a5a), UINT32_C(0x67dd4acc), UINT32_C(0xf9b9df6f), UINT32_C(0x8ebeeff9), UINT32_C(0x17b7be43), UINT32_C(0x60b08ed5),
+        UINT32_C(0xd6d6a3e8), UINT32_C(0xa1d1937e), UINT32_C(0x38d8c2c4), UINT32_C(0x4fdff252), UINT32_C(0xd1bb67f1), UINT32_C(0xa6bc5767), UINT32_C(0x3fb506dd), UINT32_C(0x48b2364b),
+        UINT32_C(0xd80d2bda), UINT32_C(0xaf0a1b4c), UINT32_C(0x36034af6), UINT32_C(0x41047a60), UINT32_C(0xdf60efc3), UINT32_C(0xa867df55), UINT32_C(0x316e8eef), UINT32_C(0x4669be79),
+        UINT32_C(0xcb61b38c), UINT32_C(0xbc66831a), UINT32_C(0x256fd2a0), UINT32_C(0x5268e236), UINT32_C(0xcc0c7795), UINT32_C(0xbb0b4703), UINT32_C(0x220216b9), UINT32_C(0x5505262f),
+        UINT32_C(0xc5ba3bbe), UINT32_C(0xb2bd0b28), UINT32_C(0x2bb45a92), UINT32_C(0x5cb36a04), UINT32_C(0xc2d7ffa7), UINT32_C(0xb5d0cf31), UINT32_C(0x2cd99e8b), UINT32_C(0x5bdeae1d),
+        UINT32_C(0x9b64c2b0), UINT32_C(0xec63f226), UINT32_C(0x756aa39c), UINT32_C(0x026d930a), UINT32_C(0x9c0906a9), UINT32_C(0xeb0e363f), UINT32_C(0x72076785), UINT32_C(0x05005713),
+        UINT32_C(0x95bf4a82), UINT32_C(0xe2b87a14), UINT32_C(0x7bb12bae), UINT32_C(0x0cb61b38), UINT32_C(0x92d28e9b), UINT32_C(0xe5d5be0d), UINT32_C(0x7cdcefb7), UINT32_C(0x0bdbdf21),
+        UINT32_C(0x86d3d2d4), UINT32_C(0xf1d4e242), UINT32_C(0x68ddb3f8), UINT32_C(0x1fda836e), UINT32_C(0x81be16cd), UINT32_C(0xf6b9265b), UINT32_C(0x6fb077e1), UINT32_C(0x18b74777),
+        UINT32_C(0x88085ae6), UINT32_C(0xff0f6a70), UINT32_C(0x66063bca), UINT32_C(0x11010b5c), UINT32_C(0x8f659eff), UINT32_C(0xf862ae69), UINT32_C(0x616bffd3), UINT32_C(0x166ccf45),
+        UINT32_C(0xa00ae278), UINT32_C(0xd70dd2ee), UINT32_C(0x4e048354), UINT32_C(0x3903b3c2), UINT32_C(0xa7672661), UINT32_C(0xd06016f7), UINT32_C(0x4969474d), UINT32_C(0x3e6e77db),
+        UINT32_C(0xaed16a4a), UINT32_C(0xd9d65adc), UINT32_C(0x40df0b66), UINT32_C(0x37d83bf0), UINT32_C(0xa9bcae53), UINT32_C(0xdebb9ec5), UINT32_C(0x47b2cf7f), UINT32_C(0x30b5ffe9),
+        UINT32_C(0xbdbdf21c), UINT32_C(0xcabac28a), UINT32_C(0x53b39330), UINT32_C(0x24b4a3a6), UINT32_C(0xbad03605), UINT32_C(0xcdd70693), UINT32_C(0x54de5729), UINT32_C(0x23d967bf),
+        UINT32_C(0xb3667a2e), UINT32_C(0xc4614ab8), UINT32_C(0x5d681b02), UINT32_C(0x2a6f2b94), UINT32_C(0xb40bbe37), UINT32_C(0xc30c8ea1), UINT32_C(0x5a05df1b), UINT32_C(0x2d02ef8d),
+    },
+    {
+        UINT32_C(0x00000000), UINT32_C(0x191b3141), UINT32_C(0x32366282), UINT32_C(0x2b2d53c3), UINT32_C(0x646cc504), UINT32_C(0x7d77f445), UINT32_C(0x565aa786), UINT32_C(0x4f4196c7),
+        UINT32_C(0xc8d98a08), UINT32_C(0xd1c2bb49), UINT32_C(0xfaefe88a), UINT32_C(0xe3f4d9cb), UINT32_C(0xacb54f0c), UINT32_C(0xb5ae7e4d), UINT32_C(0x9e832d8e), UINT32_C(0x87981ccf),
+        UINT32_C(0x4ac21251), UINT32_C(0x53d92310), UINT32_C(0x78f470d3), UINT32_C(0x61ef4192), UINT32_C(0x2eaed755), UINT32_C(0x37b5e614), UINT32_C(0x1c98b5d7), UINT32_C(0x05838496),
+        UINT32_C(0x821b9859), UINT32_C(0x9b00a918), UINT32_C(0xb02dfadb), UINT32_C(0xa936cb9a), UINT32_C(0xe6775d5d), UINT32_C(0xff6c6c1c), UINT32_C(0xd4413fdf), UINT32_C(0xcd5a0e9e),
+        UINT32_C(0x958424a2), UINT32_C(0x8c9f15e3), UINT32_C(0xa7b24620), UINT32_C(0xbea97761), UINT32_C(0xf1e8e1a6), UINT32_C(0xe8f3d0e7), UINT32_C(0xc3de8324), UINT32_C(0xdac5b265),
+        UINT32_C(0x5d5daeaa), UINT32_C(0x44469feb), UINT32_C(0x6f6bcc28), UINT32_C(0x7670fd69), UINT32_C(0x39316bae), UINT32_C(0x202a5aef), UINT32_C(0x0b07092c), UINT32_C(0x121c386d),
+        UINT32_C(0xdf4636f3), UINT32_C(0xc65d07b2), UINT32_C(0xed705471), UINT32_C(0xf46b6530), UINT32_C(0xbb2af3f7), UINT32_C(0xa231c2b6), UINT32_C(0x891c9175), UINT32_C(0x9007a034),
+        UINT32_C(0x179fbcfb), UINT32_C(0x0e848dba), UINT32_C(0x25a9de79), UINT32_C(0x3cb2ef38), UINT32_C(0x73f379ff), UINT32_C(0x6ae848be), UINT32_C(0x41c51b7d), UINT32_C(0x58de2a3c),
+        UINT32_C(0xf0794f05), UINT32_C(0xe9627e44), UINT32_C(0xc24f2d87), UINT32_C(0xdb541cc6), UINT32_C(0x94158a01), UINT32_C(0x8d0ebb40), UINT32_C(0xa623e883), UINT32_C(0xbf38d9c2),
+        UINT32_C(0x38a0c50d), UINT32_C(0x21bbf44c), UINT32_C(0x0a96a78f), UINT32_C(0x138d96ce), UINT32_C(0x5ccc0009), UINT32_C(0x45d73148), UINT32_C(0x6efa628b), UINT32_C(0x77e153ca),
+        UINT32_C(0xbabb5d54), UINT32_C(0xa3a06c15), UINT32_C(0x888d3fd6), UINT32_C(0x91960e97), UINT32_C(0xded79850), UINT32_C(0xc7cca911), UINT32_C(0xece1fad2), UINT32_C(0xf5facb93),
+        UINT32_C(0x7262d75c), UINT32_C(0x6b79e61d), UINT32_C(0x4054b5de), UINT32_C(0x594f849f), UINT32_C(0x160e1258), UINT32_C(0x0f152319), UINT32_C(0x243870da), UINT32_C(0x3d23419b),
+        UINT32_C(0x65fd6ba7), UINT32_C(0x7ce65ae6), UINT32_C(0x57cb0925), UINT32_C(0x4ed03864), UINT32_C(0x0191aea3), UINT32_C(0x188a9fe2), UINT32_C(0x33a7cc21), UINT32_C(0x2abcfd60),
+        UINT32_C(0xad24e1af), UINT32_C(0xb43fd0ee), UINT32_C(0x9f12832d), UINT32_C(0x8609b26c), UINT32_C(0xc94824ab), UINT32_C(0xd05315ea), UINT32_C(0xfb7e4629), UINT32_C(0xe2657768),
+        UINT32_C(0x2f3f79f6), UINT32_C(0x362448b7), UINT32_C(0x1d091b74), UINT32_C(0x04122a35), UINT32_C(0x4b53bcf2), UINT32_C(0x52488db3), UINT32_C(0x7965de70), UINT32_C(0x607eef31),
+        UINT32_C(0xe7e6f3fe), UINT32_C(0xfefdc2bf), UINT32_C(0xd5d0917c), UINT32_C(0xcccba03d), UINT32_C(0x838a36fa), UINT32_C(0x9a9107bb), UINT32_C(0xb1bc5478), UINT32_C(0xa8a76539),
+        UINT32_C(0x3b83984b), UINT32_C(0x2298a90a), UINT32_C(0x09b5fac9), UINT32_C(0x10aecb88), UINT32_C(0x5fef5d4f), UINT32_C(0x46f46c0e), UINT32_C(0x6dd93fcd), UINT32_C(0x74c20e8c),
+        UINT32_C(0xf35a1243), UINT32_C(0xea412302), UINT32_C(0xc16c70c1), UINT32_C(0xd8774180), UINT32_C(0x9736d747), UINT32_C(0x8e2de606), UINT32_C(0xa500b5c5), UINT32_C(0xbc1b8484),
+        UINT32_C(0x71418a1a), UINT32_C(0x685abb5b), UINT32_C(0x4377e898), UINT32_C(0x5a6cd9d9), UINT32_C(0x152d4f1e), UINT32_C(0x0c367e5f), UINT32_C(0x271b2d9c), UINT32_C(0x3e001cdd),
+        UINT32_C(0xb9980012), UINT32_C(0xa0833153), UINT32_C(0x8bae6290), UINT32_C(0x92b553d1), UINT32_C(0xddf4c516), UINT32_C(0xc4eff457), UINT32_C(0xefc2a794), UINT32_C(0xf6d996d5),
+        UINT32_C(0xae07bce9), UINT32_C(0xb71c8da8), UINT32_C(0x9c31de6b), UINT32_C(0x852aef2a), UINT32_C(0xca6b79ed), UINT32_C(0xd37048ac), UINT32_C(0xf85d1b6f), UINT32_C(0xe1462a2e),
+        UINT32_C(0x66de36e1), UINT32_C(0x7fc507a0), UINT32_C(0x54e85463), UINT32_C(0x4df36522), UINT32_C(0x02b2f3e5), UINT32_C(0x1ba9c2a4), UINT32_C(0x30849167), UINT32_C(0x299fa026),
+        UINT32_C(0xe4c5aeb8), UINT32_C(0xfdde9ff9), UINT32_C(0xd6f3cc3a), UINT32_C(0xcfe8fd7b), UINT32_C(0x80a96bbc), UINT32_C(0x99b25afd), UINT32_C(0xb29f093e), UINT32_C(0xab84387f),
+        UINT32_C(0x2c1c24b0), UINT32_C(0x350715f1), UINT32_C(0x1e2a4632), UINT32_C(0x07317773), UINT32_C(0x4870e1b4), UINT32_C(0x516bd0f5), UINT32_C(0x7a468336), UINT32_C(0x635db277),
+        UINT32_C(0xcbfad74e), UINT32_C(0xd2e1e60f), UINT32_C(0xf9ccb5cc), UINT32_C(0xe0d7848d), UINT32_C(0xaf96124a), UINT32_C(0xb68d230b), UINT32_C(0x9da070c8), UINT32_C(0x84bb4189),
+        UINT32_C(0x03235d46), UINT32_C(0x1a386c07), UINT32_C(0x31153fc4), UINT32_C(0x280e0e85), UINT32_C(0x674f9842), UINT32_C(0x7e54a903), UINT32_C(0x5579fac0), UINT32_C(0x4c62cb81),
+        UINT32_C(0x8138c51f), UINT32_C(0x9823f45e), UINT32_C(0xb30ea79d), UINT32_C(0xaa1596dc), UINT32_C(0xe554001b), UINT32_C(0xfc4f315a), UINT32_C(0xd7626299), UINT32_C(0xce7953d8),
+        UINT32_C(0x49e14f17), UINT32_C(0x50fa7e56), UINT32_C(0x7bd72d95), UINT32_C(0x62cc1cd4), UINT32_C(0x2d8d8a13), UINT32_C(0x3496bb52), UINT32_C(0x1fbbe891), UINT32_C(0x06a0d9d0),
+        UINT32_C(0x5e7ef3ec), UINT32_C(0x4765c2ad), UINT32_C(0x6c48916e), UINT32_C(0x7553a02f), UINT32_C(0x3a1236e8), UINT32_C(0x230907a9), UINT32_C(0x0824546a), UINT32_C(0x113f652b),
+        UINT32_C(0x96a779e4), UINT32_C(0x8fbc48a5), UINT32_C(0xa4911b66), UINT32_C(0xbd8a2a27), UINT32_C(0xf2cbbce0), UINT32_C(0xebd08da1), UINT32_C(0xc0fdde62), UINT32_C(0xd9e6ef23),
+        UINT32_C(0x14bce1bd), UINT32_C(0x0da7d0fc), UINT32_C(0x268a833f), UINT32_C(0x3f91b27e), UINT32_C(0x70d024b9), UINT32_C(0x69cb15f8), UINT32_C(0x42e6463b), UINT32_C(0x5bfd777a),
+        UINT32_C(0xdc656bb5), UINT32_C(0xc57e5af4), UINT32_C(0xee530937), UINT32_C(0xf7483876), UINT32_C(0xb809aeb1), UINT32_C(0xa1129ff0), UINT32_C(0x8a3fcc33), UINT32_C(0x9324fd72),
+    },
+    {
+        UINT32_C(0x00000000), UINT32_C(0x01c26a37), UINT32_C(0x0384d46e), UINT32_C(0x0246be59), UINT32_C(0x0709a8dc), UINT32_C(0x06cbc2eb), UINT32_C(0x048d7cb2), UINT32_C(0x054f1685),
+        UINT32_C(0x0e1351b8), UINT32_C(0x0fd13b8f), UINT32_C(0x0d9785d6), UINT32_C(0x0c55efe1), UINT32_C(0x091af964), UINT32_C(0x08d89353), UINT32_C(0x0a9e2d0a), UINT32_C(0x0b5c473d),
+        UINT32_C(0x1c26a370), UINT32_C(0x1de4c947), UINT32_C(0x1fa2771e), UINT32_C(0x1e601d29), UINT32_C(0x1b2f0bac), UINT32_C(0x1aed619b), UINT32_C(0x18abdfc2), UINT32_C(0x1969b5f5),
+        UINT32_C(0x1235f2c8), UINT32_C(0x13f798ff), UINT32_C(0x11b126a6), UINT32_C(0x10734c91), UINT32_C(0x153c5a14), UINT32_C(0x14fe3023), UINT32_C(0x16b88e7a), UINT32_C(0x177ae44d),
+        UINT32_C(0x384d46e0), UINT32_C(0x398f2cd7), UINT32_C(0x3bc9928e), UINT32_C(0x3a0bf8b9), UINT32_C(0x3f44ee3c), UINT32_C(0x3e86840b), UINT32_C(0x3cc03a52), UINT32_C(0x3d025065),
+        UINT32_C(0x365e1758), UINT32_C(0x379c7d6f), UINT32_C(0x35dac336), UINT32_C(0x3418a901), UINT32_C(0x3157bf84), UINT32_C(0x3095d5b3), UINT32_C(0x32d36bea), UINT32_C(0x331101dd),
+        UINT32_C(0x246be590), UINT32_C(0x25a98fa7), UINT32_C(0x27ef31fe), UINT32_C(0x262d5bc9), UINT32_C(0x23624d4c), UINT32_C(0x22a0277b), UINT32_C(0x20e69922), UINT32_C(0x2124f315),
+        UINT32_C(0x2a78b428), UINT32_C(0x2bbade1f), UINT32_C(0x29fc6046), UINT32_C(0x283e0a71), UINT32_C(0x2d711cf4), UINT32_C(0x2cb376c3), UINT32_C(0x2ef5c89a), UINT32_C(0x2f37a2ad),
+        UINT32_C(0x709a8dc0), UINT32_C(0x7158e7f7), UINT32_C(0x731e59ae), UINT32_C(0x72dc3399), UINT32_C(0x7793251c), UINT32_C(0x76514f2b), UINT32_C(0x7417f172), UINT32_C(0x75d59b45),
+        UINT32_C(0x7e89dc78), UINT32_C(0x7f4bb64f), UINT32_C(0x7d0d0816), UINT32_C(0x7ccf6221), UINT32_C(0x798074a4), UINT32_C(0x78421e93), UINT32_C(0x7a04a0ca), UINT32_C(0x7bc6cafd),
+        UINT32_C(0x6cbc2eb0), UINT32_C(0x6d7e4487), UINT32_C(0x6f38fade), UINT32_C(0x6efa90e9), UINT32_C(0x6bb5866c), UINT32_C(0x6a77ec5b), UINT32_C(0x68315202), UINT32_C(0x69f33835),
+        UINT32_C(0x62af7f08), UINT32_C(0x636d153f), UINT32_C(0x612bab66), UINT32_C(0x60e9c151), UINT32_C(0x65a6d7d4), UINT32_C(0x6464bde3), UINT32_C(0x662203ba), UINT32_C(0x67e0698d),
+        UINT32_C(0x48d7cb20), UINT32_C(0x4915a117), UINT32_C(0x4b531f4e), UINT32_C(0x4a917579), UINT32_C(0x4fde63fc), UINT32_C(0x4e1c09cb), UINT32_C(0x4c5ab792), UINT32_C(0x4d98dda5),
+        UINT32_C(0x46c49a98), UINT32_C(0x4706f0af), UINT32_C(0x45404ef6), UINT32_C(0x448224c1), UINT32_C(0x41cd3244), UINT32_C(0x400f5873), UINT32_C(0x4249e62a), UINT32_C(0x438b8c1d),
+        UINT32_C(0x54f16850), UINT32_C(0x55330267), UINT32_C(0x5775bc3e), UINT32_C(0x56b7d609), UINT32_C(0x53f8c08c), UINT32_C(0x523aaabb), UINT32_C(0x507c14e2), UINT32_C(0x51be7ed5),
+        UINT32_C(0x5ae239e8), UINT32_C(0x5b2053df), UINT32_C(0x5966ed86), UINT32_C(0x58a487b1), UINT32_C(0x5deb9134), UINT32_C(0x5c29fb03), UINT32_C(0x5e6f455a), UINT32_C(0x5fad2f6d),
+        UINT32_C(0xe1351b80), UINT32_C(0xe0f771b7), UINT32_C(0xe2b1cfee), UINT32_C(0xe373a5d9), UINT32_C(0xe63cb35c), UINT32_C(0xe7fed96b), UINT32_C(0xe5b86732), UINT32_C(0xe47a0d05),
+        UINT32_C(0xef264a38), UINT32_C(0xeee4200f), UINT32_C(0xeca29e56), UINT32_C(0xed60f461), UINT32_C(0xe82fe2e4), UINT32_C(0xe9ed88d3), UINT32_C(0xebab368a), UINT32_C(0xea695cbd),
+        UINT32_C(0xfd13b8f0), UINT32_C(0xfcd1d2c7), UINT32_C(0xfe976c9e), UINT32_C(0xff5506a9), UINT32_C(0xfa1a102c), UINT32_C(0xfbd87a1b), UINT32_C(0xf99ec442), UINT32_C(0xf85cae75),
+        UINT32_C(0xf300e948), UINT32_C(0xf2c2837f), UINT32_C(0xf0843d26), UINT32_C(0xf1465711), UINT32_C(0xf4094194), UINT32_C(0xf5cb2ba3), UINT32_C(0xf78d95fa), UINT32_C(0xf64fffcd),
+        UINT32_C(0xd9785d60), UINT32_C(0xd8ba3757), UINT32_C(0xdafc890e), UINT32_C(0xdb3ee339), UINT32_C(0xde71f5bc), UINT32_C(0xdfb39f8b), UINT32_C(0xddf521d2), UINT32_C(0xdc374be5),
+        UINT32_C(0xd76b0cd8), UINT32_C(0xd6a966ef), UINT32_C(0xd4efd8b6), UINT32_C(0xd52db281), UINT32_C(0xd062a404), UINT32_C(0xd1a0ce33), UINT32_C(0xd3e6706a), UINT32_C(0xd2241a5d),
+        UINT32_C(0xc55efe10), UINT32_C(0xc49c9427), UINT32_C(0xc6da2a7e), UINT32_C(0xc7184049), UINT32_C(0xc25756cc), UINT32_C(0xc3953cfb), UINT32_C(0xc1d382a2), UINT32_C(0xc011e895),
+        UINT32_C(0xcb4dafa8), UINT32_C(0xca8fc59f), UINT32_C(0xc8c97bc6), UINT32_C(0xc90b11f1), UINT32_C(0xcc440774), UINT32_C(0xcd866d43), UINT32_C(0xcfc0d31a), UINT32_C(0xce02b92d),
+        UINT32_C(0x91af9640), UINT32_C(0x906dfc77), UINT32_C(0x922b422e), UINT32_C(0x93e92819), UINT32_C(0x96a63e9c), UINT32_C(0x976454ab), UINT32_C(0x9522eaf2), UINT32_C(0x94e080c5),
+        UINT32_C(0x9fbcc7f8), UINT32_C(0x9e7eadcf), UINT32_C(0x9c381396), UINT32_C(0x9dfa79a1), UINT32_C(0x98b56f24), UINT32_C(0x99770513), UINT32_C(0x9b31bb4a), UINT32_C(0x9af3d17d),
+        UINT32_C(0x8d893530), UINT32_C(0x8c4b5f07), UINT32_C(0x8e0de15e), UINT32_C(0x8fcf8b69), UINT32_C(0x8a809dec), UINT32_C(0x8b42f7db), UINT32_C(0x89044982), UINT32_C(0x88c623b5),
+        UINT32_C(0x839a6488), UINT32_C(0x82580ebf), UINT32_C(0x801eb0e6), UINT32_C(0x81dcdad1), UINT32_C(0x8493cc54), UINT32_C(0x8551a663), UINT32_C(0x8717183a), UINT32_C(0x86d5720d),
+        UINT32_C(0xa9e2d0a0), UINT32_C(0xa820ba97), UINT32_C(0xaa6604ce), UINT32_C(0xaba46ef9), UINT32_C(0xaeeb787c), UINT32_C(0xaf29124b), UINT32_C(0xad6fac12), UINT32_C(0xacadc625),
+        UINT32_C(0xa7f18118), UINT32_C(0xa633eb2f), UINT32_C(0xa4755576), UINT32_C(0xa5b73f41), UINT32_C(0xa0f829c4), UINT32_C(0xa13a43f3), UINT32_C(0xa37cfdaa), UINT32_C(0xa2be979d),
+        UINT32_C(0xb5c473d0), UINT32_C(0xb40619e7), UINT32_C(0xb640a7be), UINT32_C(0xb782cd89), UINT32_C(0xb2cddb0c), UINT32_C(0xb30fb13b), UINT32_C(0xb1490f62), UINT32_C(0xb08b6555),
+        UINT32_C(0xbbd72268), UINT32_C(0xba15485f), UINT32_C(0xb853f606), UINT32_C(0xb9919c31), UINT32_C(0xbcde8ab4), UINT32_C(0xbd1ce083), UINT32_C(0xbf5a5eda), UINT32_C(0xbe9834ed),
+    },
+    {
+        UINT32_C(0x00000000), UINT32_C(0xb8bc6765), UINT32_C(0xaa09c88b), UINT32_C(0x12b5afee), UINT32_C(0x8f629757), UINT32_C(0x37def032), UINT32_C(0x256b5fdc), UINT32_C(0x9dd738b9),
+        UINT32_C(0xc5b428ef), UINT32_C(0x7d084f8a), UINT32_C(0x6fbde064), UINT32_C(0xd7018701), UINT32_C(0x4ad6bfb8), UINT32_C(0xf26ad8dd), UINT32_C(0xe0df7733), UINT32_C(0x58631056),
+        UINT32_C(0x5019579f), UINT32_C(0xe8a530fa), UINT32_C(0xfa109f14), UINT32_C(0x42acf871), UINT32_C(0xdf7bc0c8), UINT32_C(0x67c7a7ad), UINT32_C(0x75720843), UINT32_C(0xcdce6f26),
+        UINT32_C(0x95ad7f70), UINT32_C(0x2d111815), UINT32_C(0x3fa4b7fb), UINT32_C(0x8718d09e), UINT32_C(0x1acfe827), UINT32_C(0xa2738f42), UINT32_C(0xb0c620ac), UINT32_C(0x087a47c9),
+        UINT32_C(0xa032af3e), UINT32_C(0x188ec85b), UINT32_C(0x0a3b67b5), UINT32_C(0xb28700d0), UINT32_C(0x2f503869), UINT32_C(0x97ec5f0c), UINT32_C(0x8559f0e2), UINT32_C(0x3de59787),
+        UINT32_C(0x658687d1), UINT32_C(0xdd3ae0b4), UINT32_C(0xcf8f4f5a), UINT32_C(0x7733283f), UINT32_C(0xeae41086), UINT32_C(0x525877e3), UINT32_C(0x40edd80d), UINT32_C(0xf851bf68),
+        UINT32_C(0xf02bf8a1), UINT32_C(0x48979fc4), UINT32_C(0x5a22302a), UINT32_C(0xe29e574f), UINT32_C(0x7f496ff6), UINT32_C(0xc7f50893), UINT32_C(0xd540a77d), UINT32_C(0x6dfcc018),
+        UINT32_C(0x359fd04e), UINT32_C(0x8d23b72b), UINT32_C(0x9f9618c5), UINT32_C(0x272a7fa0), UINT32_C(0xbafd4719), UINT32_C(0x0241207c), UINT32_C(0x10f48f92), UINT32_C(0xa848e8f7),
+        UINT32_C(0x9b14583d), UINT32_C(0x23a83f58), UINT32_C(0x311d90b6), UINT32_C(0x89a1f7d3), UINT32_C(0x1476cf6a), UINT32_C(0xaccaa80f), UINT32_C(0xbe7f07e1), UINT32_C(0x06c36084),
+        UINT32_C(0x5ea070d2), UINT32_C(0xe61c17b7), UINT32_C(0xf4a9b859), UINT32_C(0x4c15df3c), UINT32_C(0xd1c2e785), UINT32_C(0x697e80e0), UINT32_C(0x7bcb2f0e), UINT32_C(0xc377486b),
+        UINT32_C(0xcb0d0fa2), UINT32_C(0x73b168c7), UINT32_C(0x6104c729), UINT32_C(0xd9b8a04c), UINT32_C(0x446f98f5), UINT32_C(0xfcd3ff90), UINT32_C(0xee66507e), UINT32_C(0x56da371b),
+        UINT32_C(0x0eb9274d), UINT32_C(0xb6054028), UINT32_C(0xa4b0efc6), UINT32_C(0x1c0c88a3), UINT32_C(0x81dbb01a), UINT32_C(0x3967d77f), UINT32_C(0x2bd27891), UINT32_C(0x936e1ff4),
+        UINT32_C(0x3b26f703), UINT32_C(0x839a9066), UINT32_C(0x912f3f88), UINT32_C(0x299358ed), UINT32_C(0xb4446054), UINT32_C(0x0cf80731), UINT32_C(0x1e4da8df), UINT32_C(0xa6f1cfba),
+        UINT32_C(0xfe92dfec), UINT32_C(0x462eb889), UINT32_C(0x549b1767), UINT32_C(0xec277002), UINT32_C(0x71f048bb), UINT32_C(0xc94c2fde), UINT32_C(0xdbf98030), UINT32_C(0x6345e755),
+        UINT32_C(0x6b3fa09c), UINT32_C(0xd383c7f9), UINT32_C(0xc1366817), UINT32_C(0x798a0f72), UINT32_C(0xe45d37cb), UINT32_C(0x5ce150ae), UINT32_C(0x4e54ff40), UINT32_C(0xf6e89825),
+        UINT32_C(0xae8b8873), UINT32_C(0x1637ef16), UINT32_C(0x048240f8), UINT32_C(0xbc3e279d), UINT32_C(0x21e91f24), UINT32_C(0x99557841), UINT32_C(0x8be0d7af), UINT32_C(0x335cb0ca),
+        UINT32_C(0xed59b63b), UINT32_C(0x55e5d15e), UINT32_C(0x47507eb0), UINT32_C(0xffec19d5), UINT32_C(0x623b216c), UINT32_C(0xda874609), UINT32_C(0xc832e9e7), UINT32_C(0x708e8e82),
+        UINT32_C(0x28ed9ed4), UINT32_C(0x9051f9b1), UINT32_C(0x82e4565f), UINT32_C(0x3a58313a), UINT32_C(0xa78f0983), UINT32_C(0x1f336ee6), UINT32_C(0x0d86c108), UINT32_C(0xb53aa66d),
+        UINT32_C(0xbd40e1a4), UINT32_C(0x05fc86c1), UINT32_C(0x1749292f), UINT32_C(0xaff54e4a), UINT32_C(0x322276f3), UINT32_C(0x8a9e1196), UINT32_C(0x982bbe78), UINT32_C(0x2097d91d),
+        UINT32_C(0x78f4c94b), UINT32_C(0xc048ae2e), UINT32_C(0xd2fd01c0), UINT32_C(0x6a4166a5), UINT32_C(0xf7965e1c), UINT32_C(0x4f2a3979), UINT32_C(0x5d9f9697), UINT32_C(0xe523f1f2),
+        UINT32_C(0x4d6b1905), UINT32_C(0xf5d77e60), UINT32_C(0xe762d18e), UINT32_C(0x5fdeb6eb), UINT32_C(0xc2098e52), UINT32_C(0x7ab5e937), UINT32_C(0x680046d9), UINT32_C(0xd0bc21bc),
+        UINT32_C(0x88df31ea), UINT32_C(0x3063568f), UINT32_C(0x22d6f961), UINT32_C(0x9a6a9e04), UINT32_C(0x07bda6bd), UINT32_C(0xbf01c1d8), UINT32_C(0xadb46e36), UINT32_C(0x15080953),
+        UINT32_C(0x1d724e9a), UINT32_C(0xa5ce29ff), UINT32_C(0xb77b8611), UINT32_C(0x0fc7e174), UINT32_C(0x9210d9cd), UINT32_C(0x2aacbea8), UINT32_C(0x38191146), UINT32_C(0x80a57623),
+        UINT32_C(0xd8c66675), UINT32_C(0x607a0110), UINT32_C(0x72cfaefe), UINT32_C(0xca73c99b), UINT32_C(0x57a4f122), UINT32_C(0xef189647), UINT32_C(0xfdad39a9), UINT32_C(0x45115ecc),
+        UINT32_C(0x764dee06), UINT32_C(0xcef18963), UINT32_C(0xdc44268d), UINT32_C(0x64f841e8), UINT32_C(0xf92f7951), UINT32_C(0x41931e34), UINT32_C(0x5326b1da), UINT32_C(0xeb9ad6bf),
+        UINT32_C(0xb3f9c6e9), UINT32_C(0x0b45a18c), UINT32_C(0x19f00e62), UINT32_C(0xa14c6907), UINT32_C(0x3c9b51be), UINT32_C(0x842736db), UINT32_C(0x96929935), UINT32_C(0x2e2efe50),
+        UINT32_C(0x2654b999), UINT32_C(0x9ee8defc), UINT32_C(0x8c5d7112), UINT32_C(0x34e11677), UINT32_C(0xa9362ece), UINT32_C(0x118a49ab), UINT32_C(0x033fe645), UINT32_C(0xbb838120),
+        UINT32_C(0xe3e09176), UINT32_C(0x5b5cf613), UINT32_C(0x49e959fd), UINT32_C(0xf1553e98), UINT32_C(0x6c820621), UINT32_C(0xd43e6144), UINT32_C(0xc68bceaa), UINT32_C(0x7e37a9cf),
+        UINT32_C(0xd67f4138), UINT32_C(0x6ec3265d), UINT32_C(0x7c7689b3), UINT32_C(0xc4caeed6), UINT32_C(0x591dd66f), UINT32_C(0xe1a1b10a), UINT32_C(0xf3141ee4), UINT32_C(0x4ba87981),
+        UINT32_C(0x13cb69d7), UINT32_C(0xab770eb2), UINT32_C(0xb9c2a15c), UINT32_C(0x017ec639), UINT32_C(0x9ca9fe80), UINT32_C(0x241599e5), UINT32_C(0x36a0360b), UINT32_C(0x8e1c516e),
+        UINT32_C(0x866616a7), UINT32_C(0x3eda71c2), UINT32_C(0x2c6fde2c), UINT32_C(0x94d3b949), UINT32_C(0x090481f0), UINT32_C(0xb1b8e695), UINT32_C(0xa30d497b), UINT32_C(0x1bb12e1e),
+        UINT32_C(0x43d23e48), UINT32_C(0xfb6e592d), UINT32_C(0xe9dbf6c3), UINT32_C(0x516791a6), UINT32_C(0xccb0a91f), UINT32_C(0x740cce7a), UINT32_C(0x66b96194), UINT32_C(0xde0506f1),
+    },
+    {
+        UINT32_C(0x00000000), UINT32_C(0x3d6029b0), UINT32_C(0x7ac05360), UINT32_C(0x47a07ad0), UINT32_C(0xf580a6c0), UINT32_C(0xc8e08f70), UINT32_C(0x8f40f5a0), UINT32_C(0xb220dc10),
+        UINT32_C(0x30704bc1), UINT32_C(0x0d106271), UINT32_C(0x4ab018a1), UINT32_C(0x77d03111), UINT32_C(0xc5f0ed01), UINT32_C(0xf890c4b1), UINT32_C(0xbf30be61), UINT32_C(0x825097d1),
+        UINT32_C(0x60e09782), UINT32_C(0x5d80be32), UINT32_C(0x1a20c4e2), UINT32_C(0x2740ed52), UINT32_C(0x95603142), UINT32_C(0xa80018f2), UINT32_C(0xefa06222), UINT32_C(0xd2c04b92),
+        UINT32_C(0x5090dc43), UINT32_C(0x6df0f5f3), UINT32_C(0x2a508f23), UINT32_C(0x1730a693), UINT32_C(0xa5107a83), UINT32_C(0x98705333), UINT32_C(0xdfd029e3), UINT32_C(0xe2b00053),
+        UINT32_C(0xc1c12f04), UINT32_C(0xfca106b4), UINT32_C(0xbb017c64), UINT32_C(0x866155d4), UINT32_C(0x344189c4), UINT32_C(0x0921a074), UINT32_C(0x4e81daa4), UINT32_C(0x73e1f314),
+        UINT32_C(0xf1b164c5), UINT32_C(0xccd14d75), UINT32_C(0x8b7137a5), UINT32_C(0xb6111e15), UINT32_C(0x0431c205), UINT32_C(0x3951ebb5), UINT32_C(0x7ef19165), UINT32_C(0x4391b8d5),
+        UINT32_C(0xa121b886), UINT32_C(0x9c419136), UINT32_C(0xdbe1ebe6), UINT32_C(0xe681c256), UINT32_C(0x54a11e46), UINT32_C(0x69c137f6), UINT32_C(0x2e614d26), UINT32_C(0x13016496),
+        UINT32_C(0x9151f347), UINT32_C(0xac31daf7), UINT32_C(0xeb91a027), UINT32_C(0xd6f18997), UINT32_C(0x64d15587), UINT32_C(0x59b17c37), UINT32_C(0x1e1106e7), UINT32_C(0x23712f57),
+        UINT32_C(0x58f35849), UINT32_C(0x659371f9), UINT32_C(0x22330b29), UINT32_C(0x1f532299), UINT32_C(0xad73fe89), UINT32_C(0x9013d739), UINT32_C(0xd7b3ade9), UINT32_C(0xead38459),
+        UINT32_C(0x68831388), UINT32_C(0x55e33a38), UINT32_C(0x124340e8), UINT32_C(0x2f236958), UINT32_C(0x9d03b548), UINT32_C(0xa0639cf8), UINT32_C(0xe7c3e628), UINT32_C(0xdaa3cf98),
+        UINT32_C(0x3813cfcb), UINT32_C(0x0573e67b), UINT32_C(0x42d39cab), UINT32_C(0x7fb3b51b), UINT32_C(0xcd93690b), UINT32_C(0xf0f340bb), UINT32_C(0xb7533a6b), UINT32_C(0x8a3313db),
+        UINT32_C(0x0863840a), UINT32_C(0x3503adba), UINT32_C(0x72a3d76a), UINT32_C(0x4fc3feda), UINT32_C(0xfde322ca), UINT32_C(0xc0830b7a), UINT32_C(0x872371aa), UINT32_C(0xba43581a),
+        UINT32_C(0x9932774d), UINT32_C(0xa4525efd), UINT32_C(0xe3f2242d), UINT32_C(0xde920d9d), UINT32_C(0x6cb2d18d), UINT32_C(0x51d2f83d), UINT32_C(0x167282ed), UINT32_C(0x2b12ab5d),
+        UINT32_C(0xa9423c8c), UINT32_C(0x9422153c), UINT32_C(0xd3826fec), UINT32_C(0xeee2465c), UINT32_C(0x5cc29a4c), UINT32_C(0x61a2b3fc), UINT32_C(0x2602c92c), UINT32_C(0x1b62e09c),
+        UINT32_C(0xf9d2e0cf), UINT32_C(0xc4b2c97f), UINT32_C(0x8312b3af), UINT32_C(0xbe729a1f), UINT32_C(0x0c52460f), UINT32_C(0x31326fbf), UINT32_C(0x7692156f), UINT32_C(0x4bf23cdf),
+        UINT32_C(0xc9a2ab0e), UINT32_C(0xf4c282be), UINT32_C(0xb362f86e), UINT32_C(0x8e02d1de), UINT32_C(0x3c220dce), UINT32_C(0x0142247e), UINT32_C(0x46e25eae), UINT32_C(0x7b82771e),
+        UINT32_C(0xb1e6b092), UINT32_C(0x8c869922), UINT32_C(0xcb26e3f2), UINT32_C(0xf646ca42), UINT32_C(0x44661652), UINT32_C(0x79063fe2), UINT32_C(0x3ea64532), UINT32_C(0x03c66c82),
+        UINT32_C(0x8196fb53), UINT32_C(0xbcf6d2e3), UINT32_C(0xfb56a833), UINT32_C(0xc6368183), UINT32_C(0x74165d93), UINT32_C(0x49767423), UINT32_C(0x0ed60ef3), UINT32_C(0x33b62743),
+        UINT32_C(0xd1062710), UINT32_C(0xec660ea0), UINT32_C(0xabc67470), UINT32_C(0x96a65dc0), UINT32_C(0x248681d0), UINT32_C(0x19e6a860), UINT32_C(0x5e46d2b0), UINT32_C(0x6326fb00),
+        UINT32_C(0xe1766cd1), UINT32_C(0xdc164561), UINT32_C(0x9bb63fb1), UINT32_C(0xa6d61601), UINT32_C(0x14f6ca11), UINT32_C(0x2996e3a1), UINT32_C(0x6e369971), UINT32_C(0x5356b0c1),
+        UINT32_C(0x70279f96), UINT32_C(0x4d47b626), UINT32_C(0x0ae7ccf6), UINT32_C(0x3787e546), UINT32_C(0x85a73956), UINT32_C(0xb8c710e6), UINT32_C(0xff676a36), UINT32_C(0xc2074386),
+        UINT32_C(0x4057d457), UINT32_C(0x7d37fde7), UINT32_C(0x3a978737), UINT32_C(0x07f7ae87), UINT32_C(0xb5d77297), UINT32_C(0x88b75b27), UINT32_C(0xcf1721f7), UINT32_C(0xf2770847),
+        UINT32_C(0x10c70814), UINT32_C(0x2da721a4), UINT32_C(0x6a075b74), UINT32_C(0x576772c4), UINT32_C(0xe547aed4), UINT32_C(0xd8278764), UINT32_C(0x9f87fdb4), UINT32_C(0xa2e7d404),
+        UINT32_C(0x20b743d5), UINT32_C(0x1dd76a65), UINT32_C(0x5a7710b5), UINT32_C(0x67173905), UINT32_C(0xd537e515), UINT32_C(0xe857cca5), UINT32_C(0xaff7b675), UINT32_C(0x92979fc5),
+        UINT32_C(0xe915e8db), UINT32_C(0xd475c16b), UINT32_C(0x93d5bbbb), UINT32_C(0xaeb5920b), UINT32_C(0x1c954e1b), UINT32_C(0x21f567ab), UINT32_C(0x66551d7b), UINT32_C(0x5b3534cb),
+        UINT32_C(0xd965a31a), UINT32_C(0xe4058aaa), UINT32_C(0xa3a5f07a), UINT32_C(0x9ec5d9ca), UINT32_C(0x2ce505da), UINT32_C(0x11852c6a), UINT32_C(0x562556ba), UINT32_C(0x6b457f0a),
+        UINT32_C(0x89f57f59), UINT32_C(0xb49556e9), UINT32_C(0xf3352c39), UINT32_C(0xce550589), UINT32_C(0x7c75d999), UINT32_C(0x4115f029), UINT32_C(0x06b58af9), UINT32_C(0x3bd5a349),
+        UINT32_C(0xb9853498), UINT32_C(0x84e51d28), UINT32_C(0xc34567f8), UINT32_C(0xfe254e48), UINT32_C(0x4c059258), UINT32_C(0x7165bbe8), UINT32_C(0x36c5c138), UINT32_C(0x0ba5e888),
+        UINT32_C(0x28d4c7df), UINT32_C(0x15b4ee6f), UINT32_C(0x521494bf), UINT32_C(0x6f74bd0f), UINT32_C(0xdd54611f), UINT32_C(0xe03448af), UINT32_C(0xa794327f), UINT32_C(0x9af41bcf),
+        UINT32_C(0x18a48c1e), UINT32_C(0x25c4a5ae), UINT32_C(0x6264df7e), UINT32_C(0x5f04f6ce), UINT32_C(0xed242ade), UINT32_C(0xd044036e), UINT32_C(0x97e479be), UINT32_C(0xaa84500e),
+        UINT32_C(0x4834505d), UINT32_C(0x755479ed), UINT32_C(0x32f4033d), UINT32_C(0x0f942a8d), UINT32_C(0xbdb4f69d), UINT32_C(0x80d4df2d), UINT32_C(0xc774a5fd), UINT32_C(0xfa148c4d),
+        UINT32_C(0x78441b9c), UINT32_C(0x4524322c), UINT32_C(0x028448fc), UINT32_C(0x3fe4614c), UINT32_C(0x8dc4bd5c), UINT32_C(0xb0a494ec), UINT32_C(0xf704ee3c), UINT32_C(0xca64c78c),
+    },
+    {
+        UINT32_C(0x00000000), UINT32_C(0xcb5cd3a5), UINT32_C(0x4dc8a10b), UINT32_C(0x869472ae), UINT32_C(0x9b914216), UINT32_C(0x50cd91b3), UINT32_C(0xd659e31d), UINT32_C(0x1d0530b8),
+        UINT32_C(0xec53826d), UINT32_C(0x270f51c8), UINT32_C(0xa19b2366), UINT32_C(0x6ac7f0c3), UINT32_C(0x77c2c07b), UINT32_C(0xbc9e13de), UINT32_C(0x3a0a6170), UINT32_C(0xf156b2d5),
+        UINT32_C(0x03d6029b), UINT32_C(0xc88ad13e), UINT32_C(0x4e1ea390), UINT32_C(0x85427035), UINT32_C(0x9847408d), UINT32_C(0x531b9328), UINT32_C(0xd58fe186), UINT32_C(0x1ed33223),
+        UINT32_C(0xef8580f6), UINT32_C(0x24d95353), UINT32_C(0xa24d21fd), UINT32_C(0x6911f258), UINT32_C(0x7414c2e0), UINT32_C(0xbf481145), UINT32_C(0x39dc63eb), UINT32_C(0xf280b04e),
+        UINT32_C(0x07ac0536), UINT32_C(0xccf0d693), UINT32_C(0x4a64a43d), UINT32_C(0x81387798), UINT32_C(0x9c3d4720), UINT32_C(0x57619485), UINT32_C(0xd1f5e62b), UINT32_C(0x1aa9358e),
+        UINT32_C(0xebff875b), UINT32_C(0x20a354fe), UINT32_C(0xa6372650), UINT32_C(0x6d6bf5f5), UINT32_C(0x706ec54d), UINT32_C(0xbb3216e8), UINT32_C(0x3da66446), UINT32_C(0xf6fab7e3),
+        UINT32_C(0x047a07ad), UINT32_C(0xcf26d408), UINT32_C(0x49b2a6a6), UINT32_C(0x82ee7503), UINT32_C(0x9feb45bb), UINT32_C(0x54b7961e), UINT32_C(0xd223e4b0), UINT32_C(0x197f3715),
+        UINT32_C(0xe82985c0), UINT32_C(0x23755665), UINT32_C(0xa5e124cb), UINT32_C(0x6ebdf76e), UINT32_C(0x73b8c7d6), UINT32_C(0xb8e41473), UINT32_C(0x3e7066dd), UINT32_C(0xf52cb578),
+        UINT32_C(0x0f580a6c), UINT32_C(0xc404d9c9), UINT32_C(0x4290ab67), UINT32_C(0x89cc78c2), UINT32_C(0x94c9487a), UINT32_C(0x5f959bdf), UINT32_C(0xd901e971), UINT32_C(0x125d3ad4),
+        UINT32_C(0xe30b8801), UINT32_C(0x28575ba4), UINT32_C(0xaec3290a), UINT32_C(0x659ffaaf), UINT32_C(0x789aca17), UINT32_C(0xb3c619b2), UINT32_C(0x35526b1c), UINT32_C(0xfe0eb8b9),
+        UINT32_C(0x0c8e08f7), UINT32_C(0xc7d2db52), UINT32_C(0x4146a9fc), UINT32_C(0x8a1a7a59), UINT32_C(0x971f4ae1), UINT32_C(0x5c439944), UINT32_C(0xdad7ebea), UINT32_C(0x118b384f),
+        UINT32_C(0xe0dd8a9a), UINT32_C(0x2b81593f), UINT32_C(0xad152b91), UINT32_C(0x6649f834), UINT32_C(0x7b4cc88c), UINT32_C(0xb0101b29), UINT32_C(0x36846987), UINT32_C(0xfdd8ba22),
+        UINT32_C(0x08f40f5a), UINT32_C(0xc3a8dcff), UINT32_C(0x453cae51), UINT32_C(0x8e607df4), UINT32_C(0x93654d4c), UINT32_C(0x58399ee9), UINT32_C(0xdeadec47), UINT32_C(0x15f13fe2),
+        UINT32_C(0xe4a78d37), UINT32_C(0x2ffb5e92), UINT32_C(0xa96f2c3c), UINT32_C(0x6233ff99), UINT32_C(0x7f36cf21), UINT32_C(0xb46a1c84), UINT32_C(0x32fe6e2a), UINT32_C(0xf9a2bd8f),
+        UINT32_C(0x0b220dc1), UINT32_C(0xc07ede64), UINT32_C(0x46eaacca), UINT32_C(0x8db67f6f), UINT32_C(0x90b34fd7), UINT32_C(0x5bef9c72), UINT32_C(0xdd7beedc), UINT32_C(0x16273d79),
+        UINT32_C(0xe7718fac), UINT32_C(0x2c2d5c09), UINT32_C(0xaab92ea7), UINT32_C(0x61e5fd02), UINT32_C(0x7ce0cdba), UINT32_C(0xb7bc1e1f), UINT32_C(0x31286cb1), UINT32_C(0xfa74bf14),
+        UINT32_C(0x1eb014d8), UINT32_C(0xd5ecc77d), UINT32_C(0x5378b5d3), UINT32_C(0x98246676), UINT32_C(0x852156ce), UINT32_C(0x4e7d856b), UINT32_C(0xc8e9f7c5), UINT32_C(0x03b52460),
+        UINT32_C(0xf2e396b5), UINT32_C(0x39bf4510), UINT32_C(0xbf2b37be), UINT32_C(0x7477e41b), UINT32_C(0x6972d4a3), UINT32_C(0xa22e0706), UINT32_C(0x24ba75a8), UINT32_C(0xefe6a60d),
+        UINT32_C(0x1d661643), UINT32_C(0xd63ac5e6), UINT32_C(0x50aeb748), UINT32_C(0x9bf264ed), UINT32_C(0x86f75455), UINT32_C(0x4dab87f0), UINT32_C(0xcb3ff55e), UINT32_C(0x006326fb),
+        UINT32_C(0xf135942e), UINT32_C(0x3a69478b), UINT32_C(0xbcfd3525), UINT32_C(0x77a1e680), UINT32_C(0x6aa4d638), UINT32_C(0xa1f8059d), UINT32_C(0x276c7733), UINT32_C(0xec30a496),
+        UINT32_C(0x191c11ee), UINT32_C(0xd240c24b), UINT32_C(0x54d4b0e5), UINT32_C(0x9f886340), UINT32_C(0x828d53f8), UINT32_C(0x49d1805d), UINT32_C(0xcf45f2f3), UINT32_C(0x04192156),
+        UINT32_C(0xf54f9383), UINT32_C(0x3e134026), UINT32_C(0xb8873288), UINT32_C(0x73dbe12d), UINT32_C(0x6eded195), UINT32_C(0xa5820230), UINT32_C(0x2316709e), UINT32_C(0xe84aa33b),
+        UINT32_C(0x1aca1375), UINT32_C(0xd196c0d0), UINT32_C(0x5702b27e), UINT32_C(0x9c5e61db), UINT32_C(0x815b5163), UINT32_C(0x4a0782c6), UINT32_C(0xcc93f068), UINT32_C(0x07cf23cd),
+        UINT32_C(0xf6999118), UINT32_C(0x3dc542bd), UINT32_C(0xbb513013), UINT32_C(0x700de3b6), UINT32_C(0x6d08d30e), UINT32_C(0xa65400ab), UINT32_C(0x20c07205), UINT32_C(0xeb9ca1a0),
+        UINT32_C(0x11e81eb4), UINT32_C(0xdab4cd11), UINT32_C(0x5c20bfbf), UINT32_C(0x977c6c1a), UINT32_C(0x8a795ca2), UINT32_C(0x41258f07), UINT32_C(0xc7b1fda9), UINT32_C(0x0ced2e0c),
+        UINT32_C(0xfdbb9cd9), UINT32_C(0x36e74f7c), UINT32_C(0xb0733dd2), UINT32_C(0x7b2fee77), UINT32_C(0x662adecf), UINT32_C(0xad760d6a), UINT32_C(0x2be27fc4), UINT32_C(0xe0beac61),
+        UINT32_C(0x123e1c2f), UINT32_C(0xd962cf8a), UINT32_C(0x5ff6bd24), UINT32_C(0x94aa6e81), UINT32_C(0x89af5e39), UINT32_C(0x42f38d9c), UINT32_C(0xc467ff32), UINT32_C(0x0f3b2c97),
+        UINT32_C(0xfe6d9e42), UINT32_C(0x35314de7), UINT32_C(0xb3a53f49), UINT32_C(0x78f9ecec), UINT32_C(0x65fcdc54), UINT32_C(0xaea00ff1), UINT32_C(0x28347d5f), UINT32_C(0xe368aefa),
+        UINT32_C(0x16441b82), UINT32_C(0xdd18c827), UINT32_C(0x5b8cba89), UINT32_C(0x90d0692c), UINT32_C(0x8dd55994), UINT32_C(0x46898a31), UINT32_C(0xc01df89f), UINT32_C(0x0b412b3a),
+        UINT32_C(0xfa1799ef), UINT32_C(0x314b4a4a), UINT32_C(0xb7df38e4), UINT32_C(0x7c83eb41), UINT32_C(0x6186dbf9), UINT32_C(0xaada085c), UINT32_C(0x2c4e7af2), UINT32_C(0xe712a957),
+        UINT32_C(0x15921919), UINT32_C(0xdececabc), UINT32_C(0x585ab812), UINT32_C(0x93066bb7), UINT32_C(0x8e035b0f), UINT32_C(0x455f88aa), UINT32_C(0xc3cbfa04), UINT32_C(0x089729a1),
+        UINT32_C(0xf9c19b74), UINT32_C(0x329d48d1), UINT32_C(0xb4093a7f), UINT32_C(0x7f55e9da), UINT32_C(0x6250d962), UINT32_C(0xa90c0ac7), UINT32_C(0x2f987869), UINT32_C(0xe4c4abcc),
+    },
+    {
+        UINT32_C(0x00000000), UINT32_C(0xa6770bb4), UINT32_C(0x979f1129), UINT32_C(0x31e81a9d), UINT32_C(0xf44f2413), UINT32_C(0x52382fa7), UINT32_C(0x63d0353a), UINT32_C(0xc5a73e8e),
+        UINT32_C(0x33ef4e67), UINT32_C(0x959845d3), UINT32_C(0xa4705f4e), UINT32_C(0x020754fa), UINT32_C(0xc7a06a74), UINT32_C(0x61d761c0), UINT32_C(0x503f7b5d), UINT32_C(0xf64870e9),
+        UINT32_C(0x67de9cce), UINT32_C(0xc1a9977a), UINT32_C(0xf0418de7), UINT32_C(0x56368653), UINT32_C(0x9391b8dd), UINT32_C(0x35e6b369), UINT32_C(0x040ea9f4), UINT32_C(0xa279a240),
+        UINT32_C(0x5431d2a9), UINT32_C(0xf246d91d), UINT32_C(0xc3aec380), UINT32_C(0x65d9c834), UINT32_C(0xa07ef6ba), UINT32_C(0x0609fd0e), UINT32_C(0x37e1e793), UINT32_C(0x9196ec27),
+        UINT32_C(0xcfbd399c), UINT32_C(0x69ca3228), UINT32_C(0x582228b5), UINT32_C(0xfe552301), UINT32_C(0x3bf21d8f), UINT32_C(0x9d85163b), UINT32_C(0xac6d0ca6), UINT32_C(0x0a1a0712),
+        UINT32_C(0xfc5277fb), UINT32_C(0x5a257c4f), UINT32_C(0x6bcd66d2), UINT32_C(0xcdba6d66), UINT32_C(0x081d53e8), UINT32_C(0xae6a585c), UINT32_C(0x9f8242c1), UINT32_C(0x39f54975),
+        UINT32_C(0xa863a552), UINT32_C(0x0e14aee6), UINT32_C(0x3ffcb47b), UINT32_C(0x998bbfcf), UINT32_C(0x5c2c8141), UINT32_C(0xfa5b8af5), UINT32_C(0xcbb39068), UINT32_C(0x6dc49bdc),
+        UINT32_C(0x9b8ceb35), UINT32_C(0x3dfbe081), UINT32_C(0x0c13fa1c), UINT32_C(0xaa64f1a8), UINT32_C(0x6fc3cf26), UINT32_C(0xc9b4c492), UINT32_C(0xf85cde0f), UINT32_C(0x5e2bd5bb),
+        UINT32_C(0x440b7579), UINT32_C(0xe27c7ecd), UINT32_C(0xd3946450), UINT32_C(0x75e36fe4), UINT32_C(0xb044516a), UINT32_C(0x16335ade), UINT32_C(0x27db4043), UINT32_C(0x81ac4bf7),
+        UINT32_C(0x77e43b1e), UINT32_C(0xd19330aa), UINT32_C(0xe07b2a37), UINT32_C(0x460c2183), UINT32_C(0x83ab1f0d), UINT32_C(0x25dc14b9), UINT32_C(0x14340e24), UINT32_C(0xb2430590),
+        UINT32_C(0x23d5e9b7), UINT32_C(0x85a2e203), UINT32_C(0xb44af89e), UINT32_C(0x123df32a), UINT32_C(0xd79acda4), UINT32_C(0x71edc610), UINT32_C(0x4005dc8d), UINT32_C(0xe672d739),
+        UINT32_C(0x103aa7d0), UINT32_C(0xb64dac64), UINT32_C(0x87a5b6f9), UINT32_C(0x21d2bd4d), UINT32_C(0xe47583c3), UINT32_C(0x42028877), UINT32_C(0x73ea92ea), UINT32_C(0xd59d995e),
+        UINT32_C(0x8bb64ce5), UINT32_C(0x2dc14751), UINT32_C(0x1c295dcc), UINT32_C(0xba5e5678), UINT32_C(0x7ff968f6), UINT32_C(0xd98e6342), UINT32_C(0xe86679df), UINT32_C(0x4e11726b),
+        UINT32_C(0xb8590282), UINT32_C(0x1e2e0936), UINT32_C(0x2fc613ab), UINT32_C(0x89b1181f), UINT32_C(0x4c162691), UINT32_C(0xea612d25), UINT32_C(0xdb8937b8), UINT32_C(0x7dfe3c0c),
+        UINT32_C(0xec68d02b), UINT32_C(0x4a1fdb9f), UINT32_C(0x7bf7c102), UINT32_C(0xdd80cab6), UINT32_C(0x1827f438), UINT32_C(0xbe50ff8c), UINT32_C(0x8fb8e511), UINT32_C(0x29cfeea5),
+        UINT32_C(0xdf879e4c), UINT32_C(0x79f095f8), UINT32_C(0x48188f65), UINT32_C(0xee6f84d1), UINT32_C(0x2bc8ba5f), UINT32_C(0x8dbfb1eb), UINT32_C(0xbc57ab76), UINT32_C(0x1a20a0c2),
+        UINT32_C(0x8816eaf2), UINT32_C(0x2e61e146), UINT32_C(0x1f89fbdb), UINT32_C(0xb9fef06f), UINT32_C(0x7c59cee1), UINT32_C(0xda2ec555), UINT32_C(0xebc6dfc8), UINT32_C(0x4db1d47c),
+        UINT32_C(0xbbf9a495), UINT32_C(0x1d8eaf21), UINT32_C(0x2c66b5bc), UINT32_C(0x8a11be08), UINT32_C(0x4fb68086), UINT32_C(0xe9c18b32), UINT32_C(0xd82991af), UINT32_C(0x7e5e9a1b),
+        UINT32_C(0xefc8763c), UINT32_C(0x49bf7d88), UINT32_C(0x78576715), UINT32_C(0xde206ca1), UINT32_C(0x1b87522f), UINT32_C(0xbdf0599b), UINT32_C(0x8c184306), UINT32_C(0x2a6f48b2),
+        UINT32_C(0xdc27385b), UINT32_C(0x7a5033ef), UINT32_C(0x4bb82972), UINT32_C(0xedcf22c6), UINT32_C(0x28681c48), UINT32_C(0x8e1f17fc), UINT32_C(0xbff70d61), UINT32_C(0x198006d5),
+        UINT32_C(0x47abd36e), UINT32_C(0xe1dcd8da), UINT32_C(0xd034c247), UINT32_C(0x7643c9f3), UINT32_C(0xb3e4f77d), UINT32_C(0x1593fcc9), UINT32_C(0x247be654), UINT32_C(0x820cede0),
+        UINT32_C(0x74449d09), UINT32_C(0xd23396bd), UINT32_C(0xe3db8c20), UINT32_C(0x45ac8794), UINT32_C(0x800bb91a), UINT32_C(0x267cb2ae), UINT32_C(0x1794a833), UINT32_C(0xb1e3a387),
+        UINT32_C(0x20754fa0), UINT32_C(0x86024414), UINT32_C(0xb7ea5e89), UINT32_C(0x119d553d), UINT32_C(0xd43a6bb3), UINT32_C(0x724d6007), UINT32_C(0x43a57a9a), UINT32_C(0xe5d2712e),
+        UINT32_C(0x139a01c7), UINT32_C(0xb5ed0a73), UINT32_C(0x840510ee), UINT32_C(0x22721b5a), UINT32_C(0xe7d525d4), UINT32_C(0x41a22e60), UINT32_C(0x704a34fd), UINT32_C(0xd63d3f49),
+        UINT32_C(0xcc1d9f8b), UINT32_C(0x6a6a943f), UINT32_C(0x5b828ea2), UINT32_C(0xfdf58516), UINT32_C(0x3852bb98), UINT32_C(0x9e25b02c), UINT32_C(0xafcdaab1), UINT32_C(0x09baa105),
+        UINT32_C(0xfff2d1ec), UINT32_C(0x5985da58), UINT32_C(0x686dc0c5), UINT32_C(0xce1acb71), UINT32_C(0x0bbdf5ff), UINT32_C(0xadcafe4b), UINT32_C(0x9c22e4d6), UINT32_C(0x3a55ef62),
+        UINT32_C(0xabc30345), UINT32_C(0x0db408f1), UINT32_C(0x3c5c126c), UINT32_C(0x9a2b19d8), UINT32_C(0x5f8c2756), UINT32_C(0xf9fb2ce2), UINT32_C(0xc813367f), UINT32_C(0x6e643dcb),
+        UINT32_C(0x982c4d22), UINT32_C(0x3e5b4696), UINT32_C(0x0fb35c0b), UINT32_C(0xa9c457bf), UINT32_C(0x6c636931), UINT32_C(0xca146285), UINT32_C(0xfbfc7818), UINT32_C(0x5d8b73ac),
+        UINT32_C(0x03a0a617), UINT32_C(0xa5d7ada3), UINT32_C(0x943fb73e), UINT32_C(0x3248bc8a), UINT32_C(0xf7ef8204), UINT32_C(0x519889b0), UINT32_C(0x6070932d), UINT32_C(0xc6079899),
+        UINT32_C(0x304fe870), UINT32_C(0x9638e3c4), UINT32_C(0xa7d0f959), UINT32_C(0x01a7f2ed), UINT32_C(0xc400cc63), UINT32_C(0x6277c7d7), UINT32_C(0x539fdd4a), UINT32_C(0xf5e8d6fe),
+        UINT32_C(0x647e3ad9), UINT32_C(0xc209316d), UINT32_C(0xf3e12bf0), UINT32_C(0x55962044), UINT32_C(0x90311eca), UINT32_C(0x3646157e), UINT32_C(0x07ae0fe3), UINT32_C(0xa1d90457),
+        UINT32_C(0x579174be), UINT32_C(0xf1e67f0a), UINT32_C(0xc00e6597), UINT32_C(0x66796e23), UINT32_C(0xa3de50ad), UINT32_C(0x05a95b19), UINT32_C(0x34414184), UINT32_C(0x92364a30),
+    },
+    {
+        UINT32_C(0x00000000), UINT32_C(0xccaa009e), UINT32_C(0x4225077d), UINT32_C(0x8e8f07e3), UINT32_C(0x844a0efa), UINT32_C(0x48e00e64), UINT32_C(0xc66f0987), UINT32_C(0x0ac50919),
+        UINT32_C(0xd3e51bb5), UINT32_C(0x1f4f1b2b), UINT32_C(0x91c01cc8), UINT32_C(0x5d6a1c56), UINT32_C(0x57af154f), UINT32_C(0x9b0515d1), UINT32_C(0x158a1232), UINT32_C(0xd92012ac),
+        UINT32_C(0x7cbb312b), UINT32_C(0xb01131b5), UINT32_C(0x3e9e3656), UINT32_C(0xf23436c8), UINT32_C(0xf8f13fd1), UINT32_C(0x345b3f4f), UINT32_C(0xbad438ac), UINT32_C(0x767e3832),
+        UINT32_C(0xaf5e2a9e), UINT32_C(0x63f42a00), UINT32_C(0xed7b2de3), UINT32_C(0x21d12d7d), UINT32_C(0x2b142464), UINT32_C(0xe7be24fa), UINT32_C(0x69312319), UINT32_C(0xa59b2387),
+        UINT32_C(0xf9766256), UINT32_C(0x35dc62c8), UINT32_C(0xbb53652b), UINT32_C(0x77f965b5), UINT32_C(0x7d3c6cac), UINT32_C(0xb1966c32), UINT32_C(0x3f196bd1), UINT32_C(0xf3b36b4f),
+        UINT32_C(0x2a9379e3), UINT32_C(0xe639797d), UINT32_C(0x68b67e9e), UINT32_C(0xa41c7e00), UINT32_C(0xaed97719), UINT32_C(0x62737787), UINT32_C(0xecfc7064), UINT32_C(0x205670fa),
+        UINT32_C(0x85cd537d), UINT32_C(0x496753e3), UINT32_C(0xc7e85400), UINT32_C(0x0b42549e), UINT32_C(0x01875d87), UINT32_C(0xcd2d5d19), UINT32_C(0x43a25afa), UINT32_C(0x8f085a64),
+        UINT32_C(0x562848c8), UINT32_C(0x9a824856), UINT32_C(0x140d4fb5), UINT32_C(0xd8a74f2b), UINT32_C(0xd2624632), UINT32_C(0x1ec846ac), UINT32_C(0x9047414f), UINT32_C(0x5ced41d1),
+        UINT32_C(0x299dc2ed), UINT32_C(0xe537c273), UINT32_C(0x6bb8c590), UINT32_C(0xa712c50e), UINT32_C(0xadd7cc17), UINT32_C(0x617dcc89), UINT32_C(0xeff2cb6a), UINT32_C(0x2358cbf4),
+        UINT32_C(0xfa78d958), UINT32_C(0x36d2d9c6), UINT32_C(0xb85dde25), UINT32_C(0x74f7debb), UINT32_C(0x7e32d7a2), UINT32_C(0xb298d73c), UINT32_C(0x3c17d0df), UINT32_C(0xf0bdd041),
+        UINT32_C(0x5526f3c6), UINT32_C(0x998cf358), UINT32_C(0x1703f4bb), UINT32_C(0xdba9f425), UINT32_C(0xd16cfd3c), UINT32_C(0x1dc6fda2), UINT32_C(0x9349fa41), UINT32_C(0x5fe3fadf),
+        UINT32_C(0x86c3e873), UINT32_C(0x4a69e8ed), UINT32_C(0xc4e6ef0e), UINT32_C(0x084cef90), UINT32_C(0x0289e689), UINT32_C(0xce23e617), UINT32_C(0x40ace1f4), UINT32_C(0x8c06e16a),
+        UINT32_C(0xd0eba0bb), UINT32_C(0x1c41a025), UINT32_C(0x92cea7c6), UINT32_C(0x5e64a758), UINT32_C(0x54a1ae41), UINT32_C(0x980baedf), UINT32_C(0x1684a93c), UINT32_C(0xda2ea9a2),
+        UINT32_C(0x030ebb0e), UINT32_C(0xcfa4bb90), UINT32_C(0x412bbc73), UINT32_C(0x8d81bced), UINT32_C(0x8744b5f4), UINT32_C(0x4beeb56a), UINT32_C(0xc561b289), UINT32_C(0x09cbb217),
+        UINT32_C(0xac509190), UINT32_C(0x60fa910e), UINT32_C(0xee7596ed), UINT32_C(0x22df9673), UINT32_C(0x281a9f6a), UINT32_C(0xe4b09ff4), UINT32_C(0x6a3f9817), UINT32_C(0xa6959889),
+        UINT32_C(0x7fb58a25), UINT32_C(0xb31f8abb), UINT32_C(0x3d908d58), UINT32_C(0xf13a8dc6), UINT32_C(0xfbff84df), UINT32_C(0x37558441), UINT32_C(0xb9da83a2), UINT32_C(0x7570833c),
+        UINT32_C(0x533b85da), UINT32_C(0x9f918544), UINT32_C(0x111e82a7), UINT32_C(0xddb48239), UINT32_C(0xd7718b20), UINT32_C(0x1bdb8bbe), UINT32_C(0x95548c5d), UINT32_C(0x59fe8cc3),
+        UINT32_C(0x80de9e6f), UINT32_C(0x4c749ef1), UINT32_C(0xc2fb9912), UINT32_C(0x0e51998c), UINT32_C(0x04949095), UINT32_C(0xc83e900b), UINT32_C(0x46b197e8), UINT32_C(0x8a1b9776),
+        UINT32_C(0x2f80b4f1), UINT32_C(0xe32ab46f), UINT32_C(0x6da5b38c), UINT32_C(0xa10fb312), UINT32_C(0xabcaba0b), UINT32_C(0x6760ba95), UINT32_C(0xe9efbd76), UINT32_C(0x2545bde8),
+        UINT32_C(0xfc65af44), UINT32_C(0x30cfafda), UINT32_C(0xbe40a839), UINT32_C(0x72eaa8a7), UINT32_C(0x782fa1be), UINT32_C(0xb485a120), UINT32_C(0x3a0aa6c3), UINT32_C(0xf6a0a65d),
+        UINT32_C(0xaa4de78c), UINT32_C(0x66e7e712), UINT32_C(0xe868e0f1), UINT32_C(0x24c2e06f), UINT32_C(0x2e07e976), UINT32_C(0xe2ade9e8), UINT32_C(0x6c22ee0b), UINT32_C(0xa088ee95),
+        UINT32_C(0x79a8fc39), UINT32_C(0xb502fca7), UINT32_C(0x3b8dfb44), UINT32_C(0xf727fbda), UINT32_C(0xfde2f2c3), UINT32_C(0x3148f25d), UINT32_C(0xbfc7f5be), UINT32_C(0x736df520),
+        UINT32_C(0xd6f6d6a7), UINT32_C(0x1a5cd639), UINT32_C(0x94d3d1da), UINT32_C(0x5879d144), UINT32_C(0x52bcd85d), UINT32_C(0x9e16d8c3), UINT32_C(0x1099df20), UINT32_C(0xdc33dfbe),
+        UINT32_C(0x0513cd12), UINT32_C(0xc9b9cd8c), UINT32_C(0x4736ca6f), UINT32_C(0x8b9ccaf1), UINT32_C(0x8159c3e8), UINT32_C(0x4df3c376), UINT32_C(0xc37cc495), UINT32_C(0x0fd6c40b),
+        UINT32_C(0x7aa64737), UINT32_C(0xb60c47a9), UINT32_C(0x3883404a), UINT32_C(0xf42940d4), UINT32_C(0xfeec49cd), UINT32_C(0x32464953), UINT32_C(0xbcc94eb0), UINT32_C(0x70634e2e),
+        UINT32_C(0xa9435c82), UINT32_C(0x65e95c1c), UINT32_C(0xeb665bff), UINT32_C(0x27cc5b61), UINT32_C(0x2d095278), UINT32_C(0xe1a352e6), UINT32_C(0x6f2c5505), UINT32_C(0xa386559b),
+        UINT32_C(0x061d761c), UINT32_C(0xcab77682), UINT32_C(0x44387161), UINT32_C(0x889271ff), UINT32_C(0x825778e6), UINT32_C(0x4efd7878), UINT32_C(0xc0727f9b), UINT32_C(0x0cd87f05),
+        UINT32_C(0xd5f86da9), UINT32_C(0x19526d37), UINT32_C(0x97dd6ad4), UINT32_C(0x5b776a4a), UINT32_C(0x51b26353), UINT32_C(0x9d1863cd), UINT32_C(0x1397642e), UINT32_C(0xdf3d64b0),
+        UINT32_C(0x83d02561), UINT32_C(0x4f7a25ff), UINT32_C(0xc1f5221c), UINT32_C(0x0d5f2282), UINT32_C(0x079a2b9b), UINT32_C(0xcb302b05), UINT32_C(0x45bf2ce6), UINT32_C(0x89152c78),
+        UINT32_C(0x50353ed4), UINT32_C(0x9c9f3e4a), UINT32_C(0x121039a9), UINT32_C(0xdeba3937), UINT32_C(0xd47f302e), UINT32_C(0x18d530b0), UINT32_C(0x965a3753), UINT32_C(0x5af037cd),
+        UINT32_C(0xff6b144a), UINT32_C(0x33c114d4), UINT32_C(0xbd4e1337), UINT32_C(0x71e413a9), UINT32_C(0x7b211ab0), UINT32_C(0xb78b1a2e), UINT32_C(0x39041dcd), UINT32_C(0xf5ae1d53),
+        UINT32_C(0x2c8e0fff), UINT32_C(0xe0240f61), UINT32_C(0x6eab0882), UINT32_C(0xa201081c), UINT32_C(0xa8c40105), UINT32_C(0x646e019b), UINT32_C(0xeae10678), UINT32_C(0x264b06e6),
+    },
+};
+static const uint32_t tcsum_i_crc32c_table[8][256] = {
+    {
+        UINT32_C(0x00000000), UINT32_C(0xf26b8303), UINT32_C(0xe13b70f7), UINT32_C(0x1350f3f4), UINT32_C(0xc79a971f), UINT32_C(0x35f1141c), UINT32_C(0x26a1e7e8), UINT32_C(0xd4ca64eb),
+        UINT32_C(0x8ad958cf), UINT32_C(0x78b2dbcc), UINT32_C(0x6be22838), UINT32_C(0x9989ab3b), UINT32_C(0x4d43cfd0), UINT32_C(0xbf284cd3), UINT32_C(0xac78bf27), UINT32_C(0x5e133c24),
+        UINT32_C(0x105ec76f), UINT32_C(0xe235446c), UINT32_C(0xf165b798), UINT32_C(0x030e349b), UINT32_C(0xd7c45070), UINT32_C(0x25afd373), UINT32_C(0x36ff2087), UINT32_C(0xc494a384),
+        UINT32_C(0x9a879fa0), UINT32_C(0x68ec1ca3), UINT32_C(0x7bbcef57), UINT32_C(0x89d76c54), UINT32_C(0x5d1d08bf), UINT32_C(0xaf768bbc), UINT32_C(0xbc267848), UINT32_C(0x4e4dfb4b),
+        UINT32_C(0x20bd8ede), UINT32_C(0xd2d60ddd), UINT32_C(0xc186fe29), UINT32_C(0x33ed7d2a), UINT32_C(0xe72719c1), UINT32_C(0x154c9ac2), UINT32_C(0x061c6936), UINT32_C(0xf477ea35),
+        UINT32_C(0xaa64d611), UINT32_C(0x580f5512), UINT32_C(0x4b5fa6e6), UINT32_C(0xb93425e5), UINT32_C(0x6dfe410e), UINT32_C(0x9f95c20d), UINT32_C(0x8cc531f9), UINT32_C(0x7eaeb2fa),
+        UINT32_C(0x30e349b1), UINT32_C(0xc288cab2), UINT32_C(0xd1d83946), UINT32_C(0x23b3ba45), UINT32_C(0xf779deae), UINT32_C(0x05125dad), UINT32_C(0x1642ae59), UINT32_C(0xe4292d5a),
+        UINT32_C(0xba3a117e), UINT32_C(0x4851927d), UINT32_C(0x5b016189), UINT32_C(0xa96ae28a), UINT32_C(0x7da08661), UINT32_C(0x8fcb0562), UINT32_C(0x9c9bf696), UINT32_C(0x6ef07595),
+        UINT32_C(0x417b1dbc), UINT32_C(0xb3109ebf), UINT32_C(0xa0406d4b), UINT32_C(0x522bee48), UINT32_C(0x86e18aa3), UINT32_C(0x748a09a0), UINT32_C(0x67dafa54), UINT32_C(0x95b17957),
+        UINT32_C(0xcba24573), UINT32_C(0x39c9c670), UINT32_C(0x2a993584), UINT32_C(0xd8f2b687), UINT32_C(0x0c38d26c), UINT32_C(0xfe53516f), UINT32_C(0xed03a29b), UINT32_C(0x1f682198),
+        UINT32_C(0x5125dad3), UINT32_C(0xa34e59d0), UINT32_C(0xb01eaa24), UINT32_C(0x42752927), UINT32_C(0x96bf4dcc), UINT32_C(0x64d4cecf), UINT32_C(0x77843d3b), UINT32_C(0x85efbe38),
+        UINT32_C(0xdbfc821c), UINT32_C(0x2997011f), UINT32_C(0x3ac7f2eb), UINT32_C(0xc8ac71e8), UINT32_C(0x1c661503), UINT32_C(0xee0d9600), UINT32_C(0xfd5d65f4), UINT32_C(0x0f36e6f7),
+        UINT32_C(0x61c69362), UINT32_C(0x93ad1061), UINT32_C(0x80fde395), UINT32_C(0x72966096), UINT32_C(0xa65c047d), UINT32_C(0x5437877e), UINT32_C(0x4767748a), UINT32_C(0xb50cf789),
+        UINT32_C(0xeb1fcbad), UINT32_C(0x197448ae), UINT32_C(0x0a24bb5a), UINT32_C(0xf84f3859), UINT32_C(0x2c855cb2), UINT32_C(0xdeeedfb1), UINT32_C(0xcdbe2c45), UINT32_C(0x3fd5af46),
+        UINT32_C(0x7198540d), UINT32_C(0x83f3d70e), UINT32_C(0x90a324fa), UINT32_C(0x62c8a7f9), UINT32_C(0xb602c312), UINT32_C(0x44694011), UINT32_C(0x5739b3e5), UINT32_C(0xa55230e6),
+        UINT32_C(0xfb410cc2), UINT32_C(0x092a8fc1), UINT32_C(0x1a7a7c35), UINT32_C(0xe811ff36), UINT32_C(0x3cdb9bdd), UINT32_C(0xceb018de), UINT32_C(0xdde0eb2a), UINT32_C(0x2f8b6829),
+        UINT32_C(0x82f63b78), UINT32_C(0x709db87b), UINT32_C(0x63cd4b8f), UINT32_C(0x91a6c88c), UINT32_C(0x456cac67), UINT32_C(0xb7072f64), UINT32_C(0xa457dc90), UINT32_C(0x563c5f93),
+        UINT32_C(0x082f63b7), UINT32_C(0xfa44e0b4), UINT32_C(0xe9141340), UINT32_C(0x1b7f9043), UINT32_C(0xcfb5f4a8), UINT32_C(0x3dde77ab), UINT32_C(0x2e8e845f), UINT32_C(0xdce5075c),
+        UINT32_C(0x92a8fc17), UINT32_C(0x60c37f14), UINT32_C(0x73938ce0), UINT32_C(0x81f80fe3), UINT32_C(0x55326b08), UINT32_C(0xa759e80b), UINT32_C(0xb4091bff), UINT32_C(0x466298fc),
+        UINT32_C(0x1871a4d8), UINT32_C(0xea1a27db), UINT32_C(0xf94ad42f), UINT32_C(0x0b21572c), UINT32_C(0xdfeb33c7), UINT32_C(0x2d80b0c4), UINT32_C(0x3ed04330), UINT32_C(0xccbbc033),
+        UINT32_C(0xa24bb5a6), UINT32_C(0x502036a5), UINT32_C(0x4370c551), UINT32_C(0xb11b4652), UINT32_C(0x65d122b9), UINT32_C(0x97baa1ba), UINT32_C(0x84ea524e), UINT32_C(0x7681d14d),
+        UINT32_C(0x2892ed69), UINT32_C(0xdaf96e6a), UINT32_C(0xc9a99d9e), UINT32_C(0x3bc21e9d), UINT32_C(0xef087a76), UINT32_C(0x1d63f975), UINT32_C(0x0e330a81), UINT32_C(0xfc588982),
+        UINT32_C(0xb21572c9), UINT32_C(0x407ef1ca), UINT32_C(0x532e023e), UINT32_C(0xa145813d), UINT32_C(0x758fe5d6), UINT32_C(0x87e466d5), UINT32_C(0x94b49521), UINT32_C(0x66df1622),
+        UINT32_C(0x38cc2a06), UINT32_C(0xcaa7a905), UINT32_C(0xd9f75af1), UINT32_C(0x2b9cd9f2), UINT32_C(0xff56bd19), UINT32_C(0x0d3d3e1a), UINT32_C(0x1e6dcdee), UINT32_C(0xec064eed),
+        UINT32_C(0xc38d26c4), UINT32_C(0x31e6a5c7), UINT32_C(0x22b65633), UINT32_C(0xd0ddd530), UINT32_C(0x0417b1db), UINT32_C(0xf67c32d8), UINT32_C(0xe52cc12c), UINT32_C(0x1747422f),
+        UINT32_C(0x49547e0b), UINT32_C(0xbb3ffd08), UINT32_C(0xa86f0efc), UINT32_C(0x5a048dff), UINT32_C(0x8ecee914), UINT32_C(0x7ca56a17), UINT32_C(0x6ff599e3), UINT32_C(0x9d9e1ae0),
+        UINT32_C(0xd3d3e1ab), UINT32_C(0x21b862a8), UINT32_C(0x32e8915c), UINT32_C(0xc083125f), UINT32_C(0x144976b4), UINT32_C(0xe622f5b7), UINT32_C(0xf5720643), UINT32_C(0x07198540),
+        UINT32_C(0x590ab964), UINT32_C(0xab613a67), UINT32_C(0xb831c993), UINT32_C(0x4a5a4a90), UINT32_C(0x9e902e7b), UINT32_C(0x6cfbad78), UINT32_C(0x7fab5e8c), UINT32_C(0x8dc0dd8f),
+        UINT32_C(0xe330a81a), UINT32_C(0x115b2b19), UINT32_C(0x020bd8ed), UINT32_C(0xf0605bee), UINT32_C(0x24aa3f05), UINT32_C(0xd6c1bc06), UINT32_C(0xc5914ff2), UINT32_C(0x37faccf1),
+        UINT32_C(0x69e9f0d5), UINT32_C(0x9b8273d6), UINT32_C(0x88d28022), UINT32_C(0x7ab90321), UINT32_C(0xae7367ca), UINT32_C(0x5c18e4c9), UINT32_C(0x4f48173d), UINT32_C(0xbd23943e),
+        UINT32_C(0xf36e6f75), UINT32_C(0x0105ec76), UINT32_C(0x12551f82), UINT32_C(0xe03e9c81), UINT32_C(0x34f4f86a), UINT32_C(0xc69f7b69), UINT32_C(0xd5cf889d), UINT32_C(0x27a40b9e),
+        UINT32_C(0x79b737ba), UINT32_C(0x8bdcb4b9), UINT32_C(0x988c474d), UINT32_C(0x6ae7c44e), UINT32_C(0xbe2da0a5), UINT32_C(0x4c4623a6), UINT32_C(0x5f16d052), UINT32_C(0xad7d5351),
+    },
+    {
+        UINT32_C(0x00000000), UINT32_C(0x13a29877), UINT32_C(0x274530ee), UINT32_C(0x34e7a899), UINT32_C(0x4e8a61dc), UINT32_C(0x5d28f9ab), UINT32_C(0x69cf5132), UINT32_C(0x7a6dc945),
+        UINT32_C(0x9d14c3b8), UINT32_C(0x8eb65bcf), UINT32_C(0xba51f356), UINT32_C(0xa9f36b21), UINT32_C(0xd39ea264), UINT32_C(0xc03c3a13), UINT32_C(0xf4db928a), UINT32_C(0xe7790afd),
+        UINT32_C(0x3fc5f181), UINT32_C(0x2c6769f6), UINT32_C(0x1880c16f), UINT32_C(0x0b225918), UINT32_C(0x714f905d), UINT32_C(0x62ed082a), UINT32_C(0x560aa0b3), UINT32_C(0x45a838c4),
+        UINT32_C(0xa2d13239), UINT32_C(0xb173aa4e), UINT32_C(0x859402d7), UINT32_C(0x96369aa0), UINT32_C(0xec5b53e5), UINT32_C(0xfff9cb92), UINT32_C(0xcb1e630b), UINT32_C(0xd8bcfb7c),
+        UINT32_C(0x7f8be302), UINT32_C(0x6c297b75), UINT32_C(0x58ced3ec), UINT32_C(0x4b6c4b9b), UINT32_C(0x310182de), UINT32_C(0x22a31aa9), UINT32_C(0x1644b230), UINT32_C(0x05e62a47),
+        UINT32_C(0xe29f20ba), UINT32_C(0xf13db8cd), UINT32_C(0xc5da1054), UINT32_C(0xd6788823), UINT32_C(0xac154166), UINT32_C(0xbfb7d911), UINT32_C(0x8b507188), UINT32_C(0x98f2e9ff),
+        UINT32_C(0x404e1283), UINT32_C(0x53ec8af4), UINT32_C(0x670b226d), UINT32_C(0x74a9ba1a), UINT32_C(0x0ec4735f), UINT32_C(0x1d66eb28), UINT32_C(0x298143b1), UINT32_C(0x3a23dbc6),
+        UINT32_C(0xdd5ad13b), UINT32_C(0xcef8494c), UINT32_C(0xfa1fe1d5), UINT32_C(0xe9bd79a2), UINT32_C(0x93d0b0e7), UINT32_C(0x80722890), UINT32_C(0xb4958009), UINT32_C(0xa737187e),
+        UINT32_C(0xff17c604), UINT32_C(0xecb55e73), UINT32_C(0xd852f6ea), UINT32_C(0xcbf06e9d), UINT32_C(0xb19da7d8), UINT32_C(0xa23f3faf), UINT32_C(0x96d89736), UINT32_C(0x857a0f41),
+        UINT32_C(0x620305bc), UINT32_C(0x71a19dcb), UINT32_C(0x45463552), UINT32_C(0x56e4ad25), UINT32_C(0x2c896460), UINT32_C(0x3f2bfc17), UINT32_C(0x0bcc548e), UINT32_C(0x186eccf9),
+        UINT32_C(0xc0d23785), UINT32_C(0xd370aff2), UINT32_C(0xe797076b), UINT32_C(0xf4359f1c), UINT32_C(0x8e585659), UINT32_C(0x9dface2e), UINT32_C(0xa91d66b7), UINT32_C(0xbabffec0),
+        UINT32_C(0x5dc6f43d), UINT32_C(0x4e646c4a), UINT32_C(0x7a83c4d3), UINT32_C(0x69215ca4), UINT32_C(0x134c95e1), UINT32_C(0x00ee0d96), UINT32_C(0x3409a50f), UINT32_C(0x27ab3d78),
+        UINT32_C(0x809c2506), UINT32_C(0x933ebd71), UINT32_C(0xa7d915e8), UINT32_C(0xb47b8d9f), UINT32_C(0xce1644da), UINT32_C(0xddb4dcad), UINT32_C(0xe9537434), UINT32_C(0xfaf1ec43),
+        UINT32_C(0x1d88e6be), UINT32_C(0x0e2a7ec9), UINT32_C(0x3acdd650), UINT32_C(0x296f4e27), UINT32_C(0x53028762), UINT32_C(0x40a01f15), UINT32_C(0x7447b78c), UINT32_C(0x67e52ffb),
+        UINT32_C(0xbf59d487), UINT32_C(0xacfb4cf0), UINT32_C(0x981ce469), UINT32_C(0x8bbe7c1e), UINT32_C(0xf1d3b55b), UINT32_C(0xe2712d2c), UINT32_C(0xd69685b5), UINT32_C(0xc5341dc2),
+        UINT32_C(0x224d173f), UINT32_C(0x31ef8f48), UINT32_C(0x050827d1), UINT32_C(0x16aabfa6), UINT32_C(0x6cc776e3), UINT32_C(0x7f65ee94), UINT32_C(0x4b82460d), UINT32_C(0x5820de7a),
+        UINT32_C(0xfbc3faf9), UINT32_C(0xe861628e), UINT32_C(0xdc86ca17), UINT32_C(0xcf245260), UINT32_C(0xb5499b25), UINT32_C(0xa6eb0352), UINT32_C(0x920cabcb), UINT32_C(0x81ae33bc),
+        UINT32_C(0x66d73941), UINT32_C(0x7575a136), UINT32_C(0x419209af), UINT32_C(0x523091d8), UINT32_C(0x285d589d), UINT32_C(0x3bffc0ea), UINT32_C(0x0f186873), UINT32_C(0x1cbaf004),
+        UINT32_C(0xc4060b78), UINT32_C(0xd7a4930f), UINT32_C(0xe3433b96), UINT32_C(0xf0e1a3e1), UINT32_C(0x8a8c6aa4), UINT32_C(0x992ef2d3), UINT32_C(0xadc95a4a), UINT32_C(0xbe6bc23d),
+        UINT32_C(0x5912c8c0), UINT32_C(0x4ab050b7), UINT32_C(0x7e57f82e), UINT32_C(0x6df56059), UINT32_C(0x1798a91c), UINT32_C(0x043a316b), UINT32_C(0x30dd99f2), UINT32_C(0x237f0185),
+        UINT32_C(0x844819fb), UINT32_C(0x97ea818c), UINT32_C(0xa30d2915), UINT32_C(0xb0afb162), UINT32_C(0xcac27827), UINT32_C(0xd960e050), UINT32_C(0xed8748c9), UINT32_C(0xfe25d0be),
+        UINT32_C(0x195cda43), UINT32_C(0x0afe4234), UINT32_C(0x3e19eaad), UINT32_C(0x2dbb72da), UINT32_C(0x57d6bb9f), UINT32_C(0x447423e8), UINT32_C(0x70938b71), UINT32_C(0x63311306),
+        UINT32_C(0xbb8de87a), UINT32_C(0xa82f700d), UINT32_C(0x9cc8d894), UINT32_C(0x8f6a40e3), UINT32_C(0xf50789a6), UINT32_C(0xe6a511d1), UINT32_C(0xd242b948), UINT32_C(0xc1e0213f),
+        UINT32_C(0x26992bc2), UINT32_C(0x353bb3b5), UINT32_C(0x01dc1b2c), UINT32_C(0x127e835b), UINT32_C(0x68134a1e), UINT32_C(0x7bb1d269), UINT32_C(0x4f567af0), UINT32_C(0x5cf4e287),
+        UINT32_C(0x04d43cfd), UINT32_C(0x1776a48a), UINT32_C(0x23910c13), UINT32_C(0x30339464), UINT32_C(0x4a5e5d21), UINT32_C(0x59fcc556), UINT32_C(0x6d1b6dcf), UINT32_C(0x7eb9f5b8),
+        UINT32_C(0x99c0ff45), UINT32_C(0x8a626732), UINT32_C(0xbe85cfab), UINT32_C(0xad2757dc), UINT32_C(0xd74a9e99), UINT32_C(0xc4e806ee), UINT32_C(0xf00fae77), UINT32_C(0xe3ad3600),
+        UINT32_C(0x3b11cd7c), UINT32_C(0x28b3550b), UINT32_C(0x1c54fd92), UINT32_C(0x0ff665e5), UINT32_C(0x759baca0), UINT32_C(0x663934d7), UINT32_C(0x52de9c4e), UINT32_C(0x417c0439),
+        UINT32_C(0xa6050ec4), UINT32_C(0xb5a796b3), UINT32_C(0x81403e2a), UINT32_C(0x92e2a65d), UINT32_C(0xe88f6f18), UINT32_C(0xfb2df76f), UINT32_C(0xcfca5ff6), UINT32_C(0xdc68c781),
+        UINT32_C(0x7b5fdfff), UINT32_C(0x68fd4788), UINT32_C(0x5c1aef11), UINT32_C(0x4fb87766), UINT32_C(0x35d5be23), UINT32_C(0x26772654), UINT32_C(0x12908ecd), UINT32_C(0x013216ba),
+        UINT32_C(0xe64b1c47), UINT32_C(0xf5e98430), UINT32_C(0xc10e2ca9), UINT32_C(0xd2acb4de), UINT32_C(0xa8c17d9b), UINT32_C(0xbb63e5ec), UINT32_C(0x8f844d75), UINT32_C(0x9c26d502),
+        UINT32_C(0x449a2e7e), UINT32_C(0x5738b609), UINT32_C(0x63df1e90), UINT32_C(0x707d86e7), UINT32_C(0x0a104fa2), UINT32_C(0x19b2d7d5), UINT32_C(0x2d557f4c), UINT32_C(0x3ef7e73b),
+        UINT32_C(0xd98eedc6), UINT32_C(0xca2c75b1), UINT32_C(0xfecbdd28), UINT32_C(0xed69455f), UINT32_C(0x97048c1a), UINT32_C(0x84a6146d), UINT32_C(0xb041bcf4), UINT32_C(0xa3e32483),
+    },
+    {
+        UINT32_C(0x00000000), UINT32_C(0xa541927e), UINT32_C(0x4f6f520d), UINT32_C(0xea2ec073), UINT32_C(0x9edea41a), UINT32_C(0x3b9f3664), UINT32_C(0xd1b1f617), UINT32_C(0x74f06469),
+        UINT32_C(0x38513ec5), UINT32_C(0x9d10acbb), UINT32_C(0x773e6cc8), UINT32_C(0xd27ffeb6), UINT32_C(0xa68f9adf), UINT32_C(0x03ce08a1), UINT32_C(0xe9e0c8d2), UINT32_C(0x4ca15aac),
+        UINT32_C(0x70a27d8a), UINT32_C(0xd5e3eff4), UINT32_C(0x3fcd2f87), UINT32_C(0x9a8cbdf9), UINT32_C(0xee7cd990), UINT32_C(0x4b3d4bee), UINT32_C(0xa1138b9d), UINT32_C(0x045219e3),
+        UINT32_C(0x48f3434f), UINT32_C(0xedb2d131), UINT32_C(0x079c1142), UINT32_C(0xa2dd833c), UINT32_C(0xd62de755), UINT32_C(0x736c752b), UINT32_C(0x9942b558), UINT32_C(0x3c032726),
+        UINT32_C(0xe144fb14), UINT32_C(0x4405696a), UINT32_C(0xae2ba919), UINT32_C(0x0b6a3b67), UINT32_C(0x7f9a5f0e), UINT32_C(0xdadbcd70), UINT32_C(0x30f50d03), UINT32_C(0x95b49f7d),
+        UINT32_C(0xd915c5d1), UINT32_C(0x7c5457af), UINT32_C(0x967a97dc), UINT32_C(0x333b05a2), UINT32_C(0x47cb61cb), UINT32_C(0xe28af3b5), UINT32_C(0x08a433c6), UINT32_C(0xade5a1b8),
+        UINT32_C(0x91e6869e), UINT32_C(0x34a714e0), UINT32_C(0xde89d493), UINT32_C(0x7bc846ed), UINT32_C(0x0f382284), UINT32_C(0xaa79b0fa), UINT32_C(0x40577089), UINT32_C(0xe516e2f7),
+        UINT32_C(0xa9b7b85b), UINT32_C(0x0cf62a25), UINT32_C(0xe6d8ea56), UINT32_C(0x43997828), UINT32_C(0x37691c41), UINT32_C(0x92288e3f), UINT32_C(0x78064e4c), UINT32_C(0xdd47dc32),
+        UINT32_C(0xc76580d9), UINT32_C(0x622412a7), UINT32_C(0x880ad2d4), UINT32_C(0x2d4b40aa), UINT32_C(0x59bb24c3), UINT32_C(0xfcfab6bd), UINT32_C(0x16d476ce), UINT32_C(0xb395e4b0),
+        UINT32_C(0xff34be1c), UINT32_C(0x5a752c62), UINT32_C(0xb05bec11), UINT32_C(0x151a7e6f), UINT32_C(0x61ea1a06), UINT32_C(0xc4ab8878), UINT32_C(0x2e85480b), UINT32_C(0x8bc4da75),
+        UINT32_C(0xb7c7fd53), UINT32_C(0x12866f2d), UINT32_C(0xf8a8af5e), UINT32_C(0x5de93d20), UINT32_C(0x29195949), UINT32_C(0x8c58cb37), UINT32_C(0x66760b44), UINT32_C(0xc337993a),
+        UINT32_C(0x8f96c396), UINT32_C(0x2ad751e8), UINT32_C(0xc0f9919b), UINT32_C(0x65b803e5), UINT32_C(0x1148678c), UINT32_C(0xb409f5f2), UINT32_C(0x5e273581), UINT32_C(0xfb66a7ff),
+        UINT32_C(0x26217bcd), UINT32_C(0x8360e9b3), UINT32_C(0x694e29c0), UINT32_C(0xcc0fbbbe), UINT32_C(0xb8ffdfd7), UINT32_C(0x1dbe4da9), UINT32_C(0xf7908dda), UINT32_C(0x52d11fa4),
+        UINT32_C(0x1e704508), UINT32_C(0xbb31d776), UINT32_C(0x511f1705), UINT32_C(0xf45e857b), UINT32_C(0x80aee112), UINT32_C(0x25ef736c), UINT32_C(0xcfc1b31f), UINT32_C(0x6a802161),
+        UINT32_C(0x56830647), UINT32_C(0xf3c29439), UINT32_C(0x19ec544a), UINT32_C(0xbcadc634), UINT32_C(0xc85da25d), UINT32_C(0x6d1c3023), UINT32_C(0x8732f050), UINT32_C(0x2273622e),
+        UINT32_C(0x6ed23882), UINT32_C(0xcb93aafc), UINT32_C(0x21bd6a8f), UINT32_C(0x84fcf8f1), UINT32_C(0xf00c9c98), UINT32_C(0x554d0ee6), UINT32_C(0xbf63ce95), UINT32_C(0x1a225ceb),
+        UINT32_C(0x8b277743), UINT32_C(0x2e66e53d), UINT32_C(0xc448254e), UINT32_C(0x6109b730), UINT32_C(0x15f9d359), UINT32_C(0xb0b84127), UINT32_C(0x5a968154), UINT32_C(0xffd7132a),
+        UINT32_C(0xb3764986), UINT32_C(0x1637dbf8), UINT32_C(0xfc191b8b), UINT32_C(0x595889f5), UINT32_C(0x2da8ed9c), UINT32_C(0x88e97fe2), UINT32_C(0x62c7bf91), UINT32_C(0xc7862def),
+        UINT32_C(0xfb850ac9), UINT32_C(0x5ec498b7), UINT32_C(0xb4ea58c4), UINT32_C(0x11abcaba), UINT32_C(0x655baed3), UINT32_C(0xc01a3cad), UINT32_C(0x2a34fcde), UINT32_C(0x8f756ea0),
+        UINT32_C(0xc3d4340c), UINT32_C(0x6695a672), UINT32_C(0x8cbb6601), UINT32_C(0x29faf47f), UINT32_C(0x5d0a9016), UINT32_C(0xf84b0268), UINT32_C(0x1265c21b), UINT32_C(0xb7245065),
+        UINT32_C(0x6a638c57), UINT32_C(0xcf221e29), UINT32_C(0x250cde5a), UINT32_C(0x804d4c24), UINT32_C(0xf4bd284d), UINT32_C(0x51fcba33), UINT32_C(0xbbd27a40), UINT32_C(0x1e93e83e),
+        UINT32_C(0x5232b292), UINT32_C(0xf77320ec), UINT32_C(0x1d5de09f), UINT32_C(0xb81c72e1), UINT32_C(0xccec1688), UINT32_C(0x69ad84f6), UINT32_C(0x83834485), UINT32_C(0x26c2d6fb),
+        UINT32_C(0x1ac1f1dd), UINT32_C(0xbf8063a3), UINT32_C(0x55aea3d0), UINT32_C(0xf0ef31ae), UINT32_C(0x841f55c7), UINT32_C(0x215ec7b9), UINT32_C(0xcb7007ca), UINT32_C(0x6e3195b4),
+        UINT32_C(0x2290cf18), UINT32_C(0x87d15d66), UINT32_C(0x6dff9d15), UINT32_C(0xc8be0f6b), UINT32_C(0xbc4e6b02), UINT32_C(0x190ff97c), UINT32_C(0xf321390f), UINT32_C(0x5660ab71),
+        UINT32_C(0x4c42f79a), UINT32_C(0xe90365e4), UINT32_C(0x032da597), UINT32_C(0xa66c37e9), UINT32_C(0xd29c5380), UINT32_C(0x77ddc1fe), UINT32_C(0x9df3018d), UINT32_C(0x38b293f3),
+        UINT32_C(0x7413c95f), UINT32_C(0xd1525b21), UINT32_C(0x3b7c9b52), UINT32_C(0x9e3d092c), UINT32_C(0xeacd6d45), UINT32_C(0x4f8cff3b), UINT32_C(0xa5a23f48), UINT32_C(0x00e3ad36),
+        UINT32_C(0x3ce08a10), UINT32_C(0x99a1186e), UINT32_C(0x738fd81d), UINT32_C(0xd6ce4a63), UINT32_C(0xa23e2e0a), UINT32_C(0x077fbc74), UINT32_C(0xed517c07), UINT32_C(0x4810ee79),
+        UINT32_C(0x04b1b4d5), UINT32_C(0xa1f026ab), UINT32_C(0x4bdee6d8), UINT32_C(0xee9f74a6), UINT32_C(0x9a6f10cf), UINT32_C(0x3f2e82b1), UINT32_C(0xd50042c2), UINT32_C(0x7041d0bc),
+        UINT32_C(0xad060c8e), UINT32_C(0x08479ef0), UINT32_C(0xe2695e83), UINT32_C(0x4728ccfd), UINT32_C(0x33d8a894), UINT32_C(0x96993aea), UINT32_C(0x7cb7fa99), UINT32_C(0xd9f668e7),
+        UINT32_C(0x9557324b), UINT32_C(0x3016a035), UINT32_C(0xda386046), UINT32_C(0x7f79f238), UINT32_C(0x0b899651), UINT32_C(0xaec8042f), UINT32_C(0x44e6c45c), UINT32_C(0xe1a75622),
+        UINT32_C(0xdda47104), UINT32_C(0x78e5e37a), UINT32_C(0x92cb2309), UINT32_C(0x378ab177), UINT32_C(0x437ad51e), UINT32_C(0xe63b4760), UINT32_C(0x0c158713), UINT32_C(0xa954156d),
+        UINT32_C(0xe5f54fc1), UINT32_C(0x40b4ddbf), UINT32_C(0xaa9a1dcc), UINT32_C(0x0fdb8fb2), UINT32_C(0x7b2bebdb), UINT32_C(0xde6a79a5), UINT32_C(0x3444b9d6), UINT32_C(0x91052ba8),
+    },
+    {
+        UINT32_C(0x00000000), UINT32_C(0xdd45aab8), UINT32_C(0xbf672381), UINT32_C(0x62228939), UINT32_C(0x7b2231f3), UINT32_C(0xa6679b4b), UINT32_C(0xc4451272), UINT32_C(0x1900b8ca),
+        UINT32_C(0xf64463e6), UINT32_C(0x2b01c95e), UINT32_C(0x49234067), UINT32_C(0x9466eadf), UINT32_C(0x8d665215), UINT32_C(0x5023f8ad), UINT32_C(0x32017194), UINT32_C(0xef44db2c),
+        UINT32_C(0xe964b13d), UINT32_C(0x34211b85), UINT32_C(0x560392bc), UINT32_C(0x8b463804), UINT32_C(0x924680ce), UINT32_C(0x4f032a76), UINT32_C(0x2d21a34f), UINT32_C(0xf06409f7),
+        UINT32_C(0x1f20d2db), UINT32_C(0xc2657863), UINT32_C(0xa047f15a), UINT32_C(0x7d025be2), UINT32_C(0x6402e328), UINT32_C(0xb9474990), UINT32_C(0xdb65c0a9), UINT32_C(0x06206a11),
+        UINT32_C(0xd725148b), UINT32_C(0x0a60be33), UINT32_C(0x6842370a), UINT32_C(0xb5079db2), UINT32_C(0xac072578), UINT32_C(0x71428fc0), UINT32_C(0x136006f9), UINT32_C(0xce25ac41),
+        UINT32_C(0x2161776d), UINT32_C(0xfc24ddd5), UINT32_C(0x9e0654ec), UINT32_C(0x4343fe54), UINT32_C(0x5a43469e), UINT32_C(0x8706ec26), UINT32_C(0xe524651f), UINT32_C(0x3861cfa7),
+        UINT32_C(0x3e41a5b6), UINT32_C(0xe3040f0e), UINT32_C(0x81268637), UINT32_C(0x5c632c8f), UINT32_C(0x45639445), UINT32_C(0x98263efd), UINT32_C(0xfa04b7c4), UINT32_C(0x27411d7c),
+        UINT32_C(0xc805c650), UINT32_C(0x15406ce8), UINT32_C(0x7762e5d1), UINT32_C(0xaa274f69), UINT32_C(0xb327f7a3), UINT32_C(0x6e625d1b), UINT32_C(0x0c40d422), UINT32_C(0xd1057e9a),
+        UINT32_C(0xaba65fe7), UINT32_C(0x76e3f55f), UINT32_C(0x14c17c66), UINT32_C(0xc984d6de), UINT32_C(0xd0846e14), UINT32_C(0x0dc1c4ac), UINT32_C(0x6fe34d95), UINT32_C(0xb2a6e72d),
+        UINT32_C(0x5de23c01), UINT32_C(0x80a796b9), UINT32_C(0xe2851f80), UINT32_C(0x3fc0b538), UINT32_C(0x26c00df2), UINT32_C(0xfb85a74a), UINT32_C(0x99a72e73), UINT32_C(0x44e284cb),
+        UINT32_C(0x42c2eeda), UINT32_C(0x9f874462), UINT32_C(0xfda5cd5b), UINT32_C(0x20e067e3), UINT32_C(0x39e0df29), UINT32_C(0xe4a57591), UINT32_C(0x8687fca8), UINT32_C(0x5bc25610),
+        UINT32_C(0xb4868d3c), UINT32_C(0x69c32784), UINT32_C(0x0be1aebd), UINT32_C(0xd6a40405), UINT32_C(0xcfa4bccf), UINT32_C(0x12e11677), UINT32_C(0x70c39f4e), UINT32_C(0xad8635f6),
+        UINT32_C(0x7c834b6c), UINT32_C(0xa1c6e1d4), UINT32_C(0xc3e468ed), UINT32_C(0x1ea1c255), UINT32_C(0x07a17a9f), UINT32_C(0xdae4d027), UINT32_C(0xb8c6591e), UINT32_C(0x6583f3a6),
+        UINT32_C(0x8ac7288a), UINT32_C(0x57828232), UINT32_C(0x35a00b0b), UINT32_C(0xe8e5a1b3), UINT32_C(0xf1e51979), UINT32_C(0x2ca0b3c1), UINT32_C(0x4e823af8), UINT32_C(0x93c79040),
+        UINT32_C(0x95e7fa51), UINT32_C(0x48a250e9), UINT32_C(0x2a80d9d0), UINT32_C(0xf7c57368), UINT32_C(0xeec5cba2), UINT32_C(0x3380611a), UINT32_C(0x51a2e823), UINT32_C(0x8ce7429b),
+        UINT32_C(0x63a399b7), UINT32_C(0xbee6330f), UINT32_C(0xdcc4ba36), UINT32_C(0x0181108e), UINT32_C(0x1881a844), UINT32_C(0xc5c402fc), UINT32_C(0xa7e68bc5), UINT32_C(0x7aa3217d),
+        UINT32_C(0x52a0c93f), UINT32_C(0x8fe56387), UINT32_C(0xedc7eabe), UINT32_C(0x30824006), UINT32_C(0x2982f8cc), UINT32_C(0xf4c75274), UINT32_C(0x96e5db4d), UINT32_C(0x4ba071f5),
+        UINT32_C(0xa4e4aad9), UINT32_C(0x79a10061), UINT32_C(0x1b838958), UINT32_C(0xc6c623e0), UINT32_C(0xdfc69b2a), UINT32_C(0x02833192), UINT32_C(0x60a1b8ab), UINT32_C(0xbde41213),
+        UINT32_C(0xbbc47802), UINT32_C(0x6681d2ba), UINT32_C(0x04a35b83), UINT32_C(0xd9e6f13b), UINT32_C(0xc0e649f1), UINT32_C(0x1da3e349), UINT32_C(0x7f816a70), UINT32_C(0xa2c4c0c8),
+        UINT32_C(0x4d801be4), UINT32_C(0x90c5b15c), UINT32_C(0xf2e73865), UINT32_C(0x2fa292dd), UINT32_C(0x36a22a17), UINT32_C(0xebe780af), UINT32_C(0x89c50996), UINT32_C(0x5480a32e),
+        UINT32_C(0x8585ddb4), UINT32_C(0x58c0770c), UINT32_C(0x3ae2fe35), UINT32_C(0xe7a7548d), UINT32_C(0xfea7ec47), UINT32_C(0x23e246ff), UINT32_C(0x41c0cfc6), UINT32_C(0x9c85657e),
+        UINT32_C(0x73c1be52), UINT32_C(0xae8414ea), UINT32_C(0xcca69dd3), UINT32_C(0x11e3376b), UINT32_C(0x08e38fa1), UINT32_C(0xd5a62519), UINT32_C(0xb784ac20), UINT32_C(0x6ac10698),
+        UINT32_C(0x6ce16c89), UINT32_C(0xb1a4c631), UINT32_C(0xd3864f08), UINT32_C(0x0ec3e5b0), UINT32_C(0x17c35d7a), UINT32_C(0xca86f7c2), UINT32_C(0xa8a47efb), UINT32_C(0x75e1d443),
+        UINT32_C(0x9aa50f6f), UINT32_C(0x47e0a5d7), UINT32_C(0x25c22cee), UINT32_C(0xf8878656), UINT32_C(0xe1873e9c), UINT32_C(0x3cc29424), UINT32_C(0x5ee01d1d), UINT32_C(0x83a5b7a5),
+        UINT32_C(0xf90696d8), UINT32_C(0x24433c60), UINT32_C(0x4661b559), UINT32_C(0x9b241fe1), UINT32_C(0x8224a72b), UINT32_C(0x5f610d93), UINT32_C(0x3d4384aa), UINT32_C(0xe0062e12),
+        UINT32_C(0x0f42f53e), UINT32_C(0xd2075f86), UINT32_C(0xb025d6bf), UINT32_C(0x6d607c07), UINT32_C(0x7460c4cd), UINT32_C(0xa9256e75), UINT32_C(0xcb07e74c), UINT32_C(0x16424df4),
+        UINT32_C(0x106227e5), UINT32_C(0xcd278d5d), UINT32_C(0xaf050464), UINT32_C(0x7240aedc), UINT32_C(0x6b401616), UINT32_C(0xb605bcae), UINT32_C(0xd4273597), UINT32_C(0x09629f2f),
+        UINT32_C(0xe6264403), UINT32_C(0x3b63eebb), UINT32_C(0x59416782), UINT32_C(0x8404cd3a), UINT32_C(0x9d0475f0), UINT32_C(0x4041df48), UINT32_C(0x22635671), UINT32_C(0xff26fcc9),
+        UINT32_C(0x2e238253), UINT32_C(0xf36628eb), UINT32_C(0x9144a1d2), UINT32_C(0x4c010b6a), UINT32_C(0x5501b3a0), UINT32_C(0x88441918), UINT32_C(0xea669021), UINT32_C(0x37233a99),
+        UINT32_C(0xd867e1b5), UINT32_C(0x05224b0d), UINT32_C(0x6700c234), UINT32_C(0xba45688c), UINT32_C(0xa345d046), UINT32_C(0x7e007afe), UINT32_C(0x1c22f3c7), UINT32_C(0xc167597f),
+        UINT32_C(0xc747336e), UINT32_C(0x1a0299d6), UINT32_C(0x782010ef), UINT32_C(0xa565ba57), UINT32_C(0xbc65029d), UINT32_C(0x6120a825), UINT32_C(0x0302211c), UINT32_C(0xde478ba4),
+        UINT32_C(0x31035088), UINT32_C(0xec46fa30), UINT32_C(0x8e647309), UINT32_C(0x5321d9b1), UINT32_C(0x4a21617b), UINT32_C(0x9764cbc3), UINT32_C(0xf54642fa), UINT32_C(0x2803e842),
+    },
+    {
+        UINT32_C(0x00000000), UINT32_C(0x38116fac), UINT32_C(0x7022df58), UINT32_C(0x4833b0f4), UINT32_C(0xe045beb0), UINT32_C(0xd854d11c), UINT32_C(0x906761e8), UINT32_C(0xa8760e44),
+        UINT32_C(0xc5670b91), UINT32_C(0xfd76643d), UINT32_C(0xb545d4c9), UINT32_C(0x8d54bb65), UINT32_C(0x2522b521), UINT32_C(0x1d33da8d), UINT32_C(0x55006a79), UINT32_C(0x6d1105d5),
+        UINT32_C(0x8f2261d3), UINT32_C(0xb7330e7f), UINT32_C(0xff00be8b), UINT32_C(0xc711d127), UINT32_C(0x6f67df63), UINT32_C(0x5776b0cf), UINT32_C(0x1f45003b), UINT32_C(0x27546f97),
+        UINT32_C(0x4a456a42), UINT32_C(0x725405ee), UINT32_C(0x3a67b51a), UINT32_C(0x0276dab6), UINT32_C(0xaa00d4f2), UINT32_C(0x9211bb5e), UINT32_C(0xda220baa), UINT32_C(0xe2336406),
+        UINT32_C(0x1ba8b557), UINT32_C(0x23b9dafb), UINT32_C(0x6b8a6a0f), UINT32_C(0x539b05a3), UINT32_C(0xfbed0be7), UINT32_C(0xc3fc644b), UINT32_C(0x8bcfd4bf), UINT32_C(0xb3debb13),
+        UINT32_C(0xdecfbec6), UINT32_C(0xe6ded16a), UINT32_C(0xaeed619e), UINT32_C(0x96fc0e32), UINT32_C(0x3e8a0076), UINT32_C(0x069b6fda), UINT32_C(0x4ea8df2e), UINT32_C(0x76b9b082),
+        UINT32_C(0x948ad484), UINT32_C(0xac9bbb28), UINT32_C(0xe4a80bdc), UINT32_C(0xdcb96470), UINT32_C(0x74cf6a34), UINT32_C(0x4cde0598), UINT32_C(0x04edb56c), UINT32_C(0x3cfcdac0),
+        UINT32_C(0x51eddf15), UINT32_C(0x69fcb0b9), UINT32_C(0x21cf004d), UINT32_C(0x19de6fe1), UINT32_C(0xb1a861a5), UINT32_C(0x89b90e09), UINT32_C(0xc18abefd), UINT32_C(0xf99bd151),
+        UINT32_C(0x37516aae), UINT32_C(0x0f400502), UINT32_C(0x4773b5f6), UINT32_C(0x7f62da5a), UINT32_C(0xd714d41e), UINT32_C(0xef05bbb2), UINT32_C(0xa7360b46), UINT32_C(0x9f2764ea),
+        UINT32_C(0xf236613f), UINT32_C(0xca270e93), UINT32_C(0x8214be67), UINT32_C(0xba05d1cb), UINT32_C(0x1273df8f), UINT32_C(0x2a62b023), UINT32_C(0x625100d7), UINT32_C(0x5a406f7b),
+        UINT32_C(0xb8730b7d), UINT32_C(0x806264d1), UINT32_C(0xc851d425), UINT32_C(0xf040bb89), UINT32_C(0x5836b5cd), UINT32_C(0x6027da61), UINT32_C(0x28146a95), UINT32_C(0x10050539),
+        UINT32_C(0x7d1400ec), UINT32_C(0x45056f40), UINT32_C(0x0d36dfb4), UINT32_C(0x3527b018), UINT32_C(0x9d51be5c), UINT32_C(0xa540d1f0), UINT32_C(0xed736104), UINT32_C(0xd5620ea8),
+        UINT32_C(0x2cf9dff9), UINT32_C(0x14e8b055), UINT32_C(0x5cdb00a1), UINT32_C(0x64ca6f0d), UINT32_C(0xccbc6149), UINT32_C(0xf4ad0ee5), UINT32_C(0xbc9ebe11), UINT32_C(0x848fd1bd),
+        UINT32_C(0xe99ed468), UINT32_C(0xd18fbbc4), UINT32_C(0x99bc0b30), UINT32_C(0xa1ad649c), UINT32_C(0x09db6ad8), UINT32_C(0x31ca0574), UINT32_C(0x79f9b580), UINT32_C(0x41e8da2c),
+        UINT32_C(0xa3dbbe2a), UINT32_C(0x9bcad186), UINT32_C(0xd3f96172), UINT32_C(0xebe80ede), UINT32_C(0x439e009a), UINT32_C(0x7b8f6f36), UINT32_C(0x33bcdfc2), UINT32_C(0x0badb06e),
+        UINT32_C(0x66bcb5bb), UINT32_C(0x5eadda17), UINT32_C(0x169e6ae3), UINT32_C(0x2e8f054f), UINT32_C(0x86f90b0b), UINT32_C(0xbee864a7), UINT32_C(0xf6dbd453), UINT32_C(0xcecabbff),
+        UINT32_C(0x6ea2d55c), UINT32_C(0x56b3baf0), UINT32_C(0x1e800a04), UINT32_C(0x269165a8), UINT32_C(0x8ee76bec), UINT32_C(0xb6f60440), UINT32_C(0xfec5b4b4), UINT32_C(0xc6d4db18),
+        UINT32_C(0xabc5decd), UINT32_C(0x93d4b161), UINT32_C(0xdbe70195), UINT32_C(0xe3f66e39), UINT32_C(0x4b80607d), UINT32_C(0x73910fd1), UINT32_C(0x3ba2bf25), UINT32_C(0x03b3d089),
+        UINT32_C(0xe180b48f), UINT32_C(0xd991db23), UINT32_C(0x91a26bd7), UINT32_C(0xa9b3047b), UINT32_C(0x01c50a3f), UINT32_C(0x39d46593), UINT32_C(0x71e7d567), UINT32_C(0x49f6bacb),
+        UINT32_C(0x24e7bf1e), UINT32_C(0x1cf6d0b2), UINT32_C(0x54c56046), UINT32_C(0x6cd40fea), UINT32_C(0xc4a201ae), UINT32_C(0xfcb36e02), UINT32_C(0xb480def6), UINT32_C(0x8c91b15a),
+        UINT32_C(0x750a600b), UINT32_C(0x4d1b0fa7), UINT32_C(0x0528bf53), UINT32_C(0x3d39d0ff), UINT32_C(0x954fdebb), UINT32_C(0xad5eb117), UINT32_C(0xe56d01e3), UINT32_C(0xdd7c6e4f),
+        UINT32_C(0xb06d6b9a), UINT32_C(0x887c0436), UINT32_C(0xc04fb4c2), UINT32_C(0xf85edb6e), UINT32_C(0x5028d52a), UINT32_C(0x6839ba86), UINT32_C(0x200a0a72), UINT32_C(0x181b65de),
+        UINT32_C(0xfa2801d8), UINT32_C(0xc2396e74), UINT32_C(0x8a0ade80), UINT32_C(0xb21bb12c), UINT32_C(0x1a6dbf68), UINT32_C(0x227cd0c4), UINT32_C(0x6a4f6030), UINT32_C(0x525e0f9c),
+        UINT32_C(0x3f4f0a49), UINT32_C(0x075e65e5), UINT32_C(0x4f6dd511), UINT32_C(0x777cbabd), UINT32_C(0xdf0ab4f9), UINT32_C(0xe71bdb55), UINT32_C(0xaf286ba1), UINT32_C(0x9739040d),
+        UINT32_C(0x59f3bff2), UINT32_C(0x61e2d05e), UINT32_C(0x29d160aa), UINT32_C(0x11c00f06), UINT32_C(0xb9b60142), UINT32_C(0x81a76eee), UINT32_C(0xc994de1a), UINT32_C(0xf185b1b6),
+        UINT32_C(0x9c94b463), UINT32_C(0xa485dbcf), UINT32_C(0xecb66b3b), UINT32_C(0xd4a70497), UINT32_C(0x7cd10ad3), UINT32_C(0x44c0657f), UINT32_C(0x0cf3d58b), UINT32_C(0x34e2ba27),
+        UINT32_C(0xd6d1de21), UINT32_C(0xeec0b18d), UINT32_C(0xa6f30179), UINT32_C(0x9ee26ed5), UINT32_C(0x36946091), UINT32_C(0x0e850f3d), UINT32_C(0x46b6bfc9), UINT32_C(0x7ea7d065),
+        UINT32_C(0x13b6d5b0), UINT32_C(0x2ba7ba1c), UINT32_C(0x63940ae8), UINT32_C(0x5b856544), UINT32_C(0xf3f36b00), UINT32_C(0xcbe204ac), UINT32_C(0x83d1b458), UINT32_C(0xbbc0dbf4),
+        UINT32_C(0x425b0aa5), UINT32_C(0x7a4a6509), UINT32_C(0x3279d5fd), UINT32_C(0x0a68ba51), UINT32_C(0xa21eb415), UINT32_C(0x9a0fdbb9), UINT32_C(0xd23c6b4d), UINT32_C(0xea2d04e1),
+        UINT32_C(0x873c0134), UINT32_C(0xbf2d6e98), UINT32_C(0xf71ede6c), UINT32_C(0xcf0fb1c0), UINT32_C(0x6779bf84), UINT32_C(0x5f68d028), UINT32_C(0x175b60dc), UINT32_C(0x2f4a0f70),
+        UINT32_C(0xcd796b76), UINT32_C(0xf56804da), UINT32_C(0xbd5bb42e), UINT32_C(0x854adb82), UINT32_C(0x2d3cd5c6), UINT32_C(0x152dba6a), UINT32_C(0x5d1e0a9e), UINT32_C(0x650f6532),
+        UINT32_C(0x081e60e7), UINT32_C(0x300f0f4b), UINT32_C(0x783cbfbf), UINT32_C(0x402dd013), UINT32_C(0xe85bde57), UINT32_C(0xd04ab1fb), UINT32_C(0x9879010f), UINT32_C(0xa0686ea3),
+    },
+    {
+        UINT32_C(0x00000000), UINT32_C(0xef306b19), UINT32_C(0xdb8ca0c3), UINT32_C(0x34bccbda), UINT32_C(0xb2f53777), UINT32_C(0x5dc55c6e), UINT32_C(0x697997b4), UINT32_C(0x8649fcad),
+        UINT32_C(0x6006181f), UINT32_C(0x8f367306), UINT32_C(0xbb8ab8dc), UINT32_C(0x54bad3c5), UINT32_C(0xd2f32f68), UINT32_C(0x3dc34471), UINT32_C(0x097f8fab), UINT32_C(0xe64fe4b2),
+        UINT32_C(0xc00c303e), UINT32_C(0x2f3c5b27), UINT32_C(0x1b8090fd), UINT32_C(0xf4b0fbe4), UINT32_C(0x72f90749), UINT32_C(0x9dc96c50), UINT32_C(0xa975a78a), UINT32_C(0x4645cc93),
+        UINT32_C(0xa00a2821), UINT32_C(0x4f3a4338), UINT32_C(0x7b8688e2), UINT32_C(0x94b6e3fb), UINT32_C(0x12ff1f56), UINT32_C(0xfdcf744f), UINT32_C(0xc973bf95), UINT32_C(0x2643d48c),
+        UINT32_C(0x85f4168d), UINT32_C(0x6ac47d94), UINT32_C(0x5e78b64e), UINT32_C(0xb148dd57), UINT32_C(0x370121fa), UINT32_C(0xd8314ae3), UINT32_C(0xec8d8139), UINT32_C(0x03bdea20),
+        UINT32_C(0xe5f20e92), UINT32_C(0x0ac2658b), UINT32_C(0x3e7eae51), UINT32_C(0xd14ec548), UINT32_C(0x570739e5), UINT32_C(0xb83752fc), UINT32_C(0x8c8b9926), UINT32_C(0x63bbf23f),
+        UINT32_C(0x45f826b3), UINT32_C(0xaac84daa), UINT32_C(0x9e748670), UINT32_C(0x7144ed69), UINT32_C(0xf70d11c4), UINT32_C(0x183d7add), UINT32_C(0x2c81b107), UINT32_C(0xc3b1da1e),
+        UINT32_C(0x25fe3eac), UINT32_C(0xcace55b5), UINT32_C(0xfe729e6f), UINT32_C(0x1142f576), UINT32_C(0x970b09db), UINT32_C(0x783b62c2), UINT32_C(0x4c87a918), UINT32_C(0xa3b7c201),
+        UINT32_C(0x0e045beb), UINT32_C(0xe13430f2), UINT32_C(0xd588fb28), UINT32_C(0x3ab89031), UINT32_C(0xbcf16c9c), UINT32_C(0x53c10785), UINT32_C(0x677dcc5f), UINT32_C(0x884da746),
+        UINT32_C(0x6e0243f4), UINT32_C(0x813228ed), UINT32_C(0xb58ee337), UINT32_C(0x5abe882e), UINT32_C(0xdcf77483), UINT32_C(0x33c71f9a), UINT32_C(0x077bd440), UINT32_C(0xe84bbf59),
+        UINT32_C(0xce086bd5), UINT32_C(0x213800cc), UINT32_C(0x1584cb16), UINT32_C(0xfab4a00f), UINT32_C(0x7cfd5ca2), UINT32_C(0x93cd37bb), UINT32_C(0xa771fc61), UINT32_C(0x48419778),
+        UINT32_C(0xae0e73ca), UINT32_C(0x413e18d3), UINT32_C(0x7582d309), UINT32_C(0x9ab2b810), UINT32_C(0x1cfb44bd), UINT32_C(0xf3cb2fa4), UINT32_C(0xc777e47e), UINT32_C(0x28478f67),
+        UINT32_C(0x8bf04d66), UINT32_C(0x64c0267f), UINT32_C(0x507ceda5), UINT32_C(0xbf4c86bc), UINT32_C(0x39057a11), UINT32_C(0xd6351108), UINT32_C(0xe289dad2), UINT32_C(0x0db9b1cb),
+        UINT32_C(0xebf65579), UINT32_C(0x04c63e60), UINT32_C(0x307af5ba), UINT32_C(0xdf4a9ea3), UINT32_C(0x5903620e), UINT32_C(0xb6330917), UINT32_C(0x828fc2cd), UINT32_C(0x6dbfa9d4),
+        UINT32_C(0x4bfc7d58), UINT32_C(0xa4cc1641), UINT32_C(0x9070dd9b), UINT32_C(0x7f40b682), UINT32_C(0xf9094a2f), UINT32_C(0x16392136), UINT32_C(0x2285eaec), UINT32_C(0xcdb581f5),
+        UINT32_C(0x2bfa6547), UINT32_C(0xc4ca0e5e), UINT32_C(0xf076c584), UINT32_C(0x1f46ae9d), UINT32_C(0x990f5230), UINT32_C(0x763f3929), UINT32_C(0x4283f2f3), UINT32_C(0xadb399ea),
+        UINT32_C(0x1c08b7d6), UINT32_C(0xf338dccf), UINT32_C(0xc7841715), UINT32_C(0x28b47c0c), UINT32_C(0xaefd80a1), UINT32_C(0x41cdebb8), UINT32_C(0x75712062), UINT32_C(0x9a414b7b),
+        UINT32_C(0x7c0eafc9), UINT32_C(0x933ec4d0), UINT32_C(0xa7820f0a), UINT32_C(0x48b26413), UINT32_C(0xcefb98be), UINT32_C(0x21cbf3a7), UINT32_C(0x1577387d), UINT32_C(0xfa475364),
+        UINT32_C(0xdc0487e8), UINT32_C(0x3334ecf1), UINT32_C(0x0788272b), UINT32_C(0xe8b84c32), UINT32_C(0x6ef1b09f), UINT32_C(0x81c1db86), UINT32_C(0xb57d105c), UINT32_C(0x5a4d7b45),
+        UINT32_C(0xbc029ff7), UINT32_C(0x5332f4ee), UINT32_C(0x678e3f34), UINT32_C(0x88be542d), UINT32_C(0x0ef7a880), UINT32_C(0xe1c7c399), UINT32_C(0xd57b0843), UINT32_C(0x3a4b635a),
+        UINT32_C(0x99fca15b), UINT32_C(0x76ccca42), UINT32_C(0x42700198), UINT32_C(0xad406a81), UINT32_C(0x2b09962c), UINT32_C(0xc439fd35), UINT32_C(0xf08536ef), UINT32_C(0x1fb55df6),
+        UINT32_C(0xf9fab944), UINT32_C(0x16cad25d), UINT32_C(0x22761987), UINT32_C(0xcd46729e), UINT32_C(0x4b0f8e33), UINT32_C(0xa43fe52a), UINT32_C(0x90832ef0), UINT32_C(0x7fb345e9),
+        UINT32_C(0x59f09165), UINT32_C(0xb6c0fa7c), UINT32_C(0x827c31a6), UINT32_C(0x6d4c5abf), UINT32_C(0xeb05a612), UINT32_C(0x0435cd0b), UINT32_C(0x308906d1), UINT32_C(0xdfb96dc8),
+        UINT32_C(0x39f6897a), UINT32_C(0xd6c6e263), UINT32_C(0xe27a29b9), UINT32_C(0x0d4a42a0), UINT32_C(0x8b03be0d), UINT32_C(0x6433d514), UINT32_C(0x508f1ece), UINT32_C(0xbfbf75d7),
+        UINT32_C(0x120cec3d), UINT32_C(0xfd3c8724), UINT32_C(0xc9804cfe), UINT32_C(0x26b027e7), UINT32_C(0xa0f9db4a), UINT32_C(0x4fc9b053), UINT32_C(0x7b757b89), UINT32_C(0x94451090),
+        UINT32_C(0x720af422), UINT32_C(0x9d3a9f3b), UINT32_C(0xa98654e1), UINT32_C(0x46b63ff8), UINT32_C(0xc0ffc355), UINT32_C(0x2fcfa84c), UINT32_C(0x1b736396), UINT32_C(0xf443088f),
+        UINT32_C(0xd200dc03), UINT32_C(0x3d30b71a), UINT32_C(0x098c7cc0), UINT32_C(0xe6bc17d9), UINT32_C(0x60f5eb74), UINT32_C(0x8fc5806d), UINT32_C(0xbb794bb7), UINT32_C(0x544920ae),
+        UINT32_C(0xb206c41c), UINT32_C(0x5d36af05), UINT32_C(0x698a64df), UINT32_C(0x86ba0fc6), UINT32_C(0x00f3f36b), UINT32_C(0xefc39872), UINT32_C(0xdb7f53a8), UINT32_C(0x344f38b1),
+        UINT32_C(0x97f8fab0), UINT32_C(0x78c891a9), UINT32_C(0x4c745a73), UINT32_C(0xa344316a), UINT32_C(0x250dcdc7), UINT32_C(0xca3da6de), UINT32_C(0xfe816d04), UINT32_C(0x11b1061d),
+        UINT32_C(0xf7fee2af), UINT32_C(0x18ce89b6), UINT32_C(0x2c72426c), UINT32_C(0xc3422975), UINT32_C(0x450bd5d8), UINT32_C(0xaa3bbec1), UINT32_C(0x9e87751b), UINT32_C(0x71b71e02),
+        UINT32_C(0x57f4ca8e), UINT32_C(0xb8c4a197), UINT32_C(0x8c786a4d), UINT32_C(0x63480154), UINT32_C(0xe501fdf9), UINT32_C(0x0a3196e0), UINT32_C(0x3e8d5d3a), UINT32_C(0xd1bd3623),
+        UINT32_C(0x37f2d291), UINT32_C(0xd8c2b988), UINT32_C(0xec7e7252), UINT32_C(0x034e194b), UINT32_C(0x8507e5e6), UINT32_C(0x6a378eff), UINT32_C(0x5e8b4525), UINT32_C(0xb1bb2e3c),
+    },
+    {
+        UINT32_C(0x00000000), UINT32_C(0x68032cc8), UINT32_C(0xd0065990), UINT32_C(0xb8057558), UINT32_C(0xa5e0c5d1), UINT32_C(0xcde3e919), UINT32_C(0x75e69c41), UINT32_C(0x1de5b089),
+        UINT32_C(0x4e2dfd53), UINT32_C(0x262ed19b), UINT32_C(0x9e2ba4c3), UINT32_C(0xf628880b), UINT32_C(0xebcd3882), UINT32_C(0x83ce144a), UINT32_C(0x3bcb6112), UINT32_C(0x53c84dda),
+        UINT32_C(0x9c5bfaa6), UINT32_C(0xf458d66e), UINT32_C(0x4c5da336), UINT32_C(0x245e8ffe), UINT32_C(0x39bb3f77), UINT32_C(0x51b813bf), UINT32_C(0xe9bd66e7), UINT32_C(0x81be4a2f),
+        UINT32_C(0xd27607f5), UINT32_C(0xba752b3d), UINT32_C(0x02705e65), UINT32_C(0x6a7372ad), UINT32_C(0x7796c224), UINT32_C(0x1f95eeec), UINT32_C(0xa7909bb4), UINT32_C(0xcf93b77c),
+        UINT32_C(0x3d5b83bd), UINT32_C(0x5558af75), UINT32_C(0xed5dda2d), UINT32_C(0x855ef6e5), UINT32_C(0x98bb466c), UINT32_C(0xf0b86aa4), UINT32_C(0x48bd1ffc), UINT32_C(0x20be3334),
+        UINT32_C(0x73767eee), UINT32_C(0x1b755226), UINT32_C(0xa370277e), UINT32_C(0xcb730bb6), UINT32_C(0xd696bb3f), UINT32_C(0xbe9597f7), UINT32_C(0x0690e2af), UINT32_C(0x6e93ce67),
+        UINT32_C(0xa100791b), UINT32_C(0xc90355d3), UINT32_C(0x7106208b), UINT32_C(0x19050c43), UINT32_C(0x04e0bcca), UINT32_C(0x6ce39002), UINT32_C(0xd4e6e55a), UINT32_C(0xbce5c992),
+        UINT32_C(0xef2d8448), UINT32_C(0x872ea880), UINT32_C(0x3f2bddd8), UINT32_C(0x5728f110), UINT32_C(0x4acd4199), UINT32_C(0x22ce6d51), UINT32_C(0x9acb1809), UINT32_C(0xf2c834c1),
+        UINT32_C(0x7ab7077a), UINT32_C(0x12b42bb2), UINT32_C(0xaab15eea), UINT32_C(0xc2b27222), UINT32_C(0xdf57c2ab), UINT32_C(0xb754ee63), UINT32_C(0x0f519b3b), UINT32_C(0x6752b7f3),
+        UINT32_C(0x349afa29), UINT32_C(0x5c99d6e1), UINT32_C(0xe49ca3b9), UINT32_C(0x8c9f8f71), UINT32_C(0x917a3ff8), UINT32_C(0xf9791330), UINT32_C(0x417c6668), UINT32_C(0x297f4aa0),
+        UINT32_C(0xe6ecfddc), UINT32_C(0x8eefd114), UINT32_C(0x36eaa44c), UINT32_C(0x5ee98884), UINT32_C(0x430c380d), UINT32_C(0x2b0f14c5), UINT32_C(0x930a619d), UINT32_C(0xfb094d55),
+        UINT32_C(0xa8c1008f), UINT32_C(0xc0c22c47), UINT32_C(0x78c7591f), UINT32_C(0x10c475d7), UINT32_C(0x0d21c55e), UINT32_C(0x6522e996), UINT32_C(0xdd279cce), UINT32_C(0xb524b006),
+        UINT32_C(0x47ec84c7), UINT32_C(0x2fefa80f), UINT32_C(0x97eadd57), UINT32_C(0xffe9f19f), UINT32_C(0xe20c4116), UINT32_C(0x8a0f6dde), UINT32_C(0x320a1886), UINT32_C(0x5a09344e),
+        UINT32_C(0x09c17994), UINT32_C(0x61c2555c), UINT32_C(0xd9c72004), UINT32_C(0xb1c40ccc), UINT32_C(0xac21bc45), UINT32_C(0xc422908d), UINT32_C(0x7c27e5d5), UINT32_C(0x1424c91d),
+        UINT32_C(0xdbb77e61), UINT32_C(0xb3b452a9), UINT32_C(0x0bb127f1), UINT32_C(0x63b20b39), UINT32_C(0x7e57bbb0), UINT32_C(0x16549778), UINT32_C(0xae51e220), UINT32_C(0xc652cee8),
+        UINT32_C(0x959a8332), UINT32_C(0xfd99affa), UINT32_C(0x459cdaa2), UINT32_C(0x2d9ff66a), UINT32_C(0x307a46e3), UINT32_C(0x58796a2b), UINT32_C(0xe07c1f73), UINT32_C(0x887f33bb),
+        UINT32_C(0xf56e0ef4), UINT32_C(0x9d6d223c), UINT32_C(0x25685764), UINT32_C(0x4d6b7bac), UINT32_C(0x508ecb25), UINT32_C(0x388de7ed), UINT32_C(0x808892b5), UINT32_C(0xe88bbe7d),
+        UINT32_C(0xbb43f3a7), UINT32_C(0xd340df6f), UINT32_C(0x6b45aa37), UINT32_C(0x034686ff), UINT32_C(0x1ea33676), UINT32_C(0x76a01abe), UINT32_C(0xcea56fe6), UINT32_C(0xa6a6432e),
+        UINT32_C(0x6935f452), UINT32_C(0x0136d89a), UINT32_C(0xb933adc2), UINT32_C(0xd130810a), UINT32_C(0xccd53183), UINT32_C(0xa4d61d4b), UINT32_C(0x1cd36813), UINT32_C(0x74d044db),
+        UINT32_C(0x27180901), UINT32_C(0x4f1b25c9), UINT32_C(0xf71e5091), UINT32_C(0x9f1d7c59), UINT32_C(0x82f8ccd0), UINT32_C(0xeafbe018), UINT32_C(0x52fe9540), UINT32_C(0x3afdb988),
+        UINT32_C(0xc8358d49), UINT32_C(0xa036a181), UINT32_C(0x1833d4d9), UINT32_C(0x7030f811), UINT32_C(0x6dd54898), UINT32_C(0x05d66450), UINT32_C(0xbdd31108), UINT32_C(0xd5d03dc0),
+        UINT32_C(0x8618701a), UINT32_C(0xee1b5cd2), UINT32_C(0x561e298a), UINT32_C(0x3e1d0542), UINT32_C(0x23f8b5cb), UINT32_C(0x4bfb9903), UINT32_C(0xf3feec5b), UINT32_C(0x9bfdc093),
+        UINT32_C(0x546e77ef), UINT32_C(0x3c6d5b27), UINT32_C(0x84682e7f), UINT32_C(0xec6b02b7), UINT32_C(0xf18eb23e), UINT32_C(0x998d9ef6), UINT32_C(0x2188ebae), UINT32_C(0x498bc766),
+        UINT32_C(0x1a438abc), UINT32_C(0x7240a674), UINT32_C(0xca45d32c), UINT32_C(0xa246ffe4), UINT32_C(0xbfa34f6d), UINT32_C(0xd7a063a5), UINT32_C(0x6fa516fd), UINT32_C(0x07a63a35),
+        UINT32_C(0x8fd9098e), UINT32_C(0xe7da2546), UINT32_C(0x5fdf501e), UINT32_C(0x37dc7cd6), UINT32_C(0x2a39cc5f), UINT32_C(0x423ae097), UINT32_C(0xfa3f95cf), UINT32_C(0x923cb907),
+        UINT32_C(0xc1f4f4dd), UINT32_C(0xa9f7d815), UINT32_C(0x11f2ad4d), UINT32_C(0x79f18185), UINT32_C(0x6414310c), UINT32_C(0x0c171dc4), UINT32_C(0xb412689c), UINT32_C(0xdc114454),
+        UINT32_C(0x1382f328), UINT32_C(0x7b81dfe0), UINT32_C(0xc384aab8), UINT32_C(0xab878670), UINT32_C(0xb66236f9), UINT32_C(0xde611a31), UINT32_C(0x66646f69), UINT32_C(0x0e6743a1),
+        UINT32_C(0x5daf0e7b), UINT32_C(0x35ac22b3), UINT32_C(0x8da957eb), UINT32_C(0xe5aa7b23), UINT32_C(0xf84fcbaa), UINT32_C(0x904ce762), UINT32_C(0x2849923a), UINT32_C(0x404abef2),
+        UINT32_C(0xb2828a33), UINT32_C(0xda81a6fb), UINT32_C(0x6284d3a3), UINT32_C(0x0a87ff6b), UINT32_C(0x17624fe2), UINT32_C(0x7f61632a), UINT32_C(0xc7641672), UINT32_C(0xaf673aba),
+        UINT32_C(0xfcaf7760), UINT32_C(0x94ac5ba8), UINT32_C(0x2ca92ef0), UINT32_C(0x44aa0238), UINT32_C(0x594fb2b1), UINT32_C(0x314c9e79), UINT32_C(0x8949eb21), UINT32_C(0xe14ac7e9),
+        UINT32_C(0x2ed97095), UINT32_C(0x46da5c5d), UINT32_C(0xfedf2905), UINT32_C(0x96dc05cd), UINT32_C(0x8b39b544), UINT32_C(0xe33a998c), UINT32_C(0x5b3fecd4), UINT32_C(0x333cc01c),
+        UINT32_C(0x60f48dc6), UINT32_C(0x08f7a10e), UINT32_C(0xb0f2d456), UINT32_C(0xd8f1f89e), UINT32_C(0xc5144817), UINT32_C(0xad1764df), UINT32_C(0x15121187), UINT32_C(0x7d113d4f),
+    },
+    {
+        UINT32_C(0x00000000), UINT32_C(0x493c7d27), UINT32_C(0x9278fa4e), UINT32_C(0xdb448769), UINT32_C(0x211d826d), UINT32_C(0x6821ff4a), UINT32_C(0xb3657823), UINT32_C(0xfa590504),
+        UINT32_C(0x423b04da), UINT32_C(0x0b0779fd), UINT32_C(0xd043fe94), UINT32_C(0x997f83b3), UINT32_C(0x632686b7), UINT32_C(0x2a1afb90), UINT32_C(0xf15e7cf9), UINT32_C(0xb86201de),
+        UINT32_C(0x847609b4), UINT32_C(0xcd4a7493), UINT32_C(0x160ef3fa), UINT32_C(0x5f328edd), UINT32_C(0xa56b8bd9), UINT32_C(0xec57f6fe), UINT32_C(0x37137197), UINT32_C(0x7e2f0cb0),
+        UINT32_C(0xc64d0d6e), UINT32_C(0x8f717049), UINT32_C(0x5435f720), UINT32_C(0x1d098a07), UINT32_C(0xe7508f03), UINT32_C(0xae6cf224), UINT32_C(0x7528754d), UINT32_C(0x3c14086a),
+        UINT32_C(0x0d006599), UINT32_C(0x443c18be), UINT32_C(0x9f789fd7), UINT32_C(0xd644e2f0), UINT32_C(0x2c1de7f4), UINT32_C(0x65219ad3), UINT32_C(0xbe651dba), UINT32_C(0xf759609d),
+        UINT32_C(0x4f3b6143), UINT32_C(0x06071c64), UINT32_C(0xdd439b0d), UINT32_C(0x947fe62a), UINT32_C(0x6e26e32e), UINT32_C(0x271a9e09), UINT32_C(0xfc5e1960), UINT32_C(0xb5626447),
+        UINT32_C(0x89766c2d), UINT32_C(0xc04a110a), UINT32_C(0x1b0e9663), UINT32_C(0x5232eb44), UINT32_C(0xa86bee40), UINT32_C(0xe1579367), UINT32_C(0x3a13140e), UINT32_C(0x732f6929),
+        UINT32_C(0xcb4d68f7), UINT32_C(0x827115d0), UINT32_C(0x593592b9), UINT32_C(0x1009ef9e), UINT32_C(0xea50ea9a), UINT32_C(0xa36c97bd), UINT32_C(0x782810d4), UINT32_C(0x31146df3),
+        UINT32_C(0x1a00cb32), UINT32_C(0x533cb615), UINT32_C(0x8878317c), UINT32_C(0xc1444c5b), UINT32_C(0x3b1d495f), UINT32_C(0x72213478), UINT32_C(0xa965b311), UINT32_C(0xe059ce36),
+        UINT32_C(0x583bcfe8), UINT32_C(0x1107b2cf), UINT32_C(0xca4335a6), UINT32_C(0x837f4881), UINT32_C(0x79264d85), UINT32_C(0x301a30a2), UINT32_C(0xeb5eb7cb), UINT32_C(0xa262caec),
+        UINT32_C(0x9e76c286), UINT32_C(0xd74abfa1), UINT32_C(0x0c0e38c8), UINT32_C(0x453245ef), UINT32_C(0xbf6b40eb), UINT32_C(0xf6573dcc), UINT32_C(0x2d13baa5), UINT32_C(0x642fc782),
+        UINT32_C(0xdc4dc65c), UINT32_C(0x9571bb7b), UINT32_C(0x4e353c12), UINT32_C(0x07094135), UINT32_C(0xfd504431), UINT32_C(0xb46c3916), UINT32_C(0x6f28be7f), UINT32_C(0x2614c358),
+        UINT32_C(0x1700aeab), UINT32_C(0x5e3cd38c), UINT32_C(0x857854e5), UINT32_C(0xcc4429c2), UINT32_C(0x361d2cc6), UINT32_C(0x7f2151e1), UINT32_C(0xa465d688), UINT32_C(0xed59abaf),
+        UINT32_C(0x553baa71), UINT32_C(0x1c07d756), UINT32_C(0xc743503f), UINT32_C(0x8e7f2d18), UINT32_C(0x7426281c), UINT32_C(0x3d1a553b), UINT32_C(0xe65ed252), UINT32_C(0xaf62af75),
+        UINT32_C(0x9376a71f), UINT32_C(0xda4ada38), UINT32_C(0x010e5d51), UINT32_C(0x48322076), UINT32_C(0xb26b2572), UINT32_C(0xfb575855), UINT32_C(0x2013df3c), UINT32_C(0x692fa21b),
+        UINT32_C(0xd14da3c5), UINT32_C(0x9871dee2), UINT32_C(0x4335598b), UINT32_C(0x0a0924ac), UINT32_C(0xf05021a8), UINT32_C(0xb96c5c8f), UINT32_C(0x6228dbe6), UINT32_C(0x2b14a6c1),
+        UINT32_C(0x34019664), UINT32_C(0x7d3deb43), UINT32_C(0xa6796c2a), UINT32_C(0xef45110d), UINT32_C(0x151c1409), UINT32_C(0x5c20692e), UINT32_C(0x8764ee47), UINT32_C(0xce589360),
+        UINT32_C(0x763a92be), UINT32_C(0x3f06ef99), UINT32_C(0xe44268f0), UINT32_C(0xad7e15d7), UINT32_C(0x572710d3), UINT32_C(0x1e1b6df4), UINT32_C(0xc55fea9d), UINT32_C(0x8c6397ba),
+        UINT32_C(0xb0779fd0), UINT32_C(0xf94be2f7), UINT32_C(0x220f659e), UINT32_C(0x6b3318b9), UINT32_C(0x916a1dbd), UINT32_C(0xd856609a), UINT32_C(0x0312e7f3), UINT32_C(0x4a2e9ad4),
+        UINT32_C(0xf24c9b0a), UINT32_C(0xbb70e62d), UINT32_C(0x60346144), UINT32_C(0x29081c63), UINT32_C(0xd3511967), UINT32_C(0x9a6d6440), UINT32_C(0x4129e329), UINT32_C(0x08159e0e),
+        UINT32_C(0x3901f3fd), UINT32_C(0x703d8eda), UINT32_C(0xab7909b3), UINT32_C(0xe2457494), UINT32_C(0x181c7190), UINT32_C(0x51200cb7), UINT32_C(0x8a648bde), UINT32_C(0xc358f6f9),
+        UINT32_C(0x7b3af727), UINT32_C(0x32068a00), UINT32_C(0xe9420d69), UINT32_C(0xa07e704e), UINT32_C(0x5a27754a), UINT32_C(0x131b086d), UINT32_C(0xc85f8f04), UINT32_C(0x8163f223),
+        UINT32_C(0xbd77fa49), UINT32_C(0xf44b876e), UINT32_C(0x2f0f0007), UINT32_C(0x66337d20), UINT32_C(0x9c6a7824), UINT32_C(0xd5560503), UINT32_C(0x0e12826a), UINT32_C(0x472eff4d),
+        UINT32_C(0xff4cfe93), UINT32_C(0xb67083b4), UINT32_C(0x6d3404dd), UINT32_C(0x240879fa), UINT32_C(0xde517cfe), UINT32_C(0x976d01d9), UINT32_C(0x4c2986b0), UINT32_C(0x0515fb97),
+        UINT32_C(0x2e015d56), UINT32_C(0x673d2071), UINT32_C(0xbc79a718), UINT32_C(0xf545da3f), UINT32_C(0x0f1cdf3b), UINT32_C(0x4620a21c), UINT32_C(0x9d642575), UINT32_C(0xd4585852),
+        UINT32_C(0x6c3a598c), UINT32_C(0x250624ab), UINT32_C(0xfe42a3c2), UINT32_C(0xb77edee5), UINT32_C(0x4d27dbe1), UINT32_C(0x041ba6c6), UINT32_C(0xdf5f21af), UINT32_C(0x96635c88),
+        UINT32_C(0xaa7754e2), UINT32_C(0xe34b29c5), UINT32_C(0x380faeac), UINT32_C(0x7133d38b), UINT32_C(0x8b6ad68f), UINT32_C(0xc256aba8), UINT32_C(0x19122cc1), UINT32_C(0x502e51e6),
+        UINT32_C(0xe84c5038), UINT32_C(0xa1702d1f), UINT32_C(0x7a34aa76), UINT32_C(0x3308d751), UINT32_C(0xc951d255), UINT32_C(0x806daf72), UINT32_C(0x5b29281b), UINT32_C(0x1215553c),
+        UINT32_C(0x230138cf), UINT32_C(0x6a3d45e8), UINT32_C(0xb179c281), UINT32_C(0xf845bfa6), UINT32_C(0x021cbaa2), UINT32_C(0x4b20c785), UINT32_C(0x906440ec), UINT32_C(0xd9583dcb),
+        UINT32_C(0x613a3c15), UINT32_C(0x28064132), UINT32_C(0xf342c65b), UINT32_C(0xba7ebb7c), UINT32_C(0x4027be78), UINT32_C(0x091bc35f), UINT32_C(0xd25f4436), UINT32_C(0x9b633911),
+        UINT32_C(0xa777317b), UINT32_C(0xee4b4c5c), UINT32_C(0x350fcb35), UINT32_C(0x7c33b612), UINT32_C(0x866ab316), UINT32_C(0xcf56ce31), UINT32_C(0x14124958), UINT32_C(0x5d2e347f),
+        UINT32_C(0xe54c35a1), UINT32_C(0xac704886), UINT32_C(0x7734cfef), UINT32_C(0x3e08b2c8), UINT32_C(0xc451b7cc), UINT32_C(0x8d6dcaeb), UINT32_C(0x56294d82), UINT32_C(0x1f1530a5),
+    },
+};
+
+static uint32_t tcsum_i_crc_sb8_(const uint32_t table[8][256], uint32_t crc, const unsigned char* udata, size_t dlen)
+{
+    while(dlen >= 8)
+    {
+        uint32_t lo = crc ^ tcsum_i_read32_(udata);
+        uint32_t hi = tcsum_i_read32_(udata + 4);
+        crc = table[7][lo & 0xFF] ^ table[6][(lo >> 8) & 0xFF] ^ table[5][(lo >> 16) & 0xFF] ^ table[4][lo >> 24]
+            ^ table[3][hi & 0xFF] ^ table[2][(hi >> 8) & 0xFF] ^ table[1][(hi >> 16) & 0xFF] ^ table[0][hi >> 24];
+        udata += 8;
+        dlen -= 8;
+    }
+    while(dlen--)
+        crc = (crc >> 8) ^ table[0][(crc ^ *udata++) & 0xFF];
+    return crc;
+}
+
+/*
+ * Multiply two polynomials modulo the (reflected) CRC polynomial; `a` and `b`
+ * are in the reflected representation (bit 31 is x^0). This is used to
+ * combine CRCs; see zlib's `crc32_combine()` for the derivation.
+ */
+static uint32_t tcsum_i_crc_multmodp_(uint32_t a, uint32_t b, uint32_t poly)
+{
+    uint32_t m = UINT32_C(1) << 31;
+    uint32_t p = 0;
+    for(;;)
+    {
+        if(a & m)
+        {
+            p ^= b;
+            if(!(a & (m - 1)))
+                break;
+        }
+        m >>= 1;
+        b = (b & 1) ? (b >> 1) ^ poly : b >> 1;
+    }
+    return p;
+}
+static uint32_t tcsum_i_crc_combine_(uint32_t crcA, uint32_t crcB, uint64_t lenB, uint32_t poly)
+{
+    /* crc(A || B) = crc(A) * x^(8*lenB) + crc(B) (mod P); the initial value & final XOR cancel out */
+    uint32_t sq = UINT32_C(1) << (31 - 8);  /* x^8, squared for each bit of `lenB` */
+    uint32_t xp = UINT32_C(1) << 31;        /* x^0 */
+    while(lenB)
+    {
+        if(lenB & 1)
+            xp = tcsum_i_crc_multmodp_(sq, xp, poly);
+        sq = tcsum_i_crc_multmodp_(sq, sq, poly);
+        lenB >>= 1;
+    }
+    return tcsum_i_crc_multmodp_(xp, crcA, poly) ^ crcB;
+}
+
+#if defined(TCSUM_I_ACCEL_X86_)
+/*
+ * Carry-less multiplication folding, as per Intel's "Fast CRC Computation for
+ * Generic Polynomials Using PCLMULQDQ Instruction" (Gopal et al., 2009). The
+ * constants are x^k mod P for various k, bit-reflected; `k1`/`k2` fold by 512
+ * bits, `k3`/`k4` by 128 bits, `k5` reduces 64->32 bits, and `poly`/`mu` are
+ * for the final Barrett reduction.
+ */
+typedef struct TCSum_I_CRCFold_
+{
+    uint64_t k1, k2, k3, k4, k5, poly, mu;
+} TCSum_I_CRCFold_;
+static const TCSum_I_CRCFold_ tcsum_i_crc32_fold_ = {
+    UINT64_C(0x154442bd4), UINT64_C(0x1c6e41596), UINT64_C(0x1751997d0), UINT64_C(0x0ccaa009e),
+    UINT64_C(0x163cd6124), UINT64_C(0x1db710641), UINT64_C(0x1f7011641),
+};
+static const TCSum_I_CRCFold_ tcsum_i_crc32c_fold_ = {
+    UINT64_C(0x0740eef02), UINT64_C(0x09e4addf8), UINT64_C(0x0f20c0dfe), UINT64_C(0x14cd00bd6),
+    UINT64_C(0x0dd45aab8), UINT64_C(0x105ec76f1), UINT64_C(0x0dea713f1),
+};
+/* folding is only worth it past a certain length (and requires at least 64 bytes) */
+#define TCSUM_I_CRC_FOLD_MIN_   256
+
+/* requires `dlen >= 64` and `dlen % 16 == 0` */
+TCSUM_I_TARGET_X86_("sse2,pclmul")
+static uint32_t tcsum_i_crc_fold_pclmul_(const TCSum_I_CRCFold_* K, uint32_t crc, const unsigned char* udata, size_t dlen)
+{
+    const __m128i mask32 = _mm_set_epi32(0, 0, 0, -1);
+    __m128i k, t;
+    __m128i x0 = _mm_loadu_si128(TC__STATIC_CAST(const __m128i*,TC__VOID_CAST(const void*,udata)));
+    __m128i x1 = _mm_loadu_si128(TC__STATIC_CAST(const __m128i*,TC__VOID_CAST(const void*,udata + 16)));
+    __m128i x2 = _mm_loadu_si128(TC__STATIC_CAST(const __m128i*,TC__VOID_CAST(const void*,udata + 32)));
+    __m128i x3 = _mm_loadu_si128(TC__STATIC_CAST(const __m128i*,TC__VOID_CAST(const void*,udata + 48)));
+    x0 = _mm_xor_si128(x0, _mm_cvtsi32_si128(TC__STATIC_CAST(int,crc)));
+    udata += 64;
+    dlen -= 64;
+
+#define TCSUM_I_CRC_FOLD_(X,D)                                                 \
+    t = _mm_clmulepi64_si128(X, k, 0x00);                                      \
+    X = _mm_clmulepi64_si128(X, k, 0x11);                                      \
+    X = _mm_xor_si128(_mm_xor_si128(X, t), D);
+#define TCSUM_I_CRC_LOAD_(OFFSET) _mm_loadu_si128(TC__STATIC_CAST(const __m128i*,TC__VOID_CAST(const void*,udata + (OFFSET))))
+
+    /* fold 4x128 bits at a time */
+    k = _mm_set_epi64x(TC__STATIC_CAST(long long,K->k2), TC__STATIC_CAST(long long,K->k1));
+    while(dlen >= 64)
+    {
+        TCSUM_I_CRC_FOLD_(x0, TCSUM_I_CRC_LOAD_(0));
+        TCSUM_I_CRC_FOLD_(x1, TCSUM_I_CRC_LOAD_(16));
+        TCSUM_I_CRC_FOLD_(x2, TCSUM_I_CRC_LOAD_(32));
+        TCSUM_I_CRC_FOLD_(x3, TCSUM_I_CRC_LOAD_(48));
+        udata += 64;
+        dlen -= 64;
+    }
+    /* merge into a single 128-bit value, and fold any remaining 16-byte blocks */
+    k = _mm_set_epi64x(TC__STATIC_CAST(long long,K->k4), TC__STATIC_CAST(long long,K->k3));
+    TCSUM_I_CRC_FOLD_(x0, x1);
+    TCSUM_I_CRC_FOLD_(x0, x2);
+    TCSUM_I_CRC_FOLD_(x0, x3);
+    while(dlen >= 16)
+    {
+        TCSUM_I_CRC_FOLD_(x0, TCSUM_I_CRC_LOAD_(0));
+        udata += 16;
+        dlen -= 16;
+    }
+#undef TCSUM_I_CRC_LOAD_
+#undef TCSUM_I_CRC_FOLD_
+
+    /* 128 -> 64 bits */
+    t = _mm_clmulepi64_si128(x0, k, 0x10);
+    x0 = _mm_xor_si128(_mm_srli_si128(x0, 8), t);
+    /* 64 -> 32 bits */
+    t = _mm_srli_si128(x0, 4);
+    x0 = _mm_clmulepi64_si128(_mm_and_si128(x0, mask32), _mm_set_epi64x(0, TC__STATIC_CAST(long long,K->k5)), 0x00);
+    x0 = _mm_xor_si128(x0, t);
+    /* Barrett reduction to the final 32 bits */
+    k = _mm_set_epi64x(TC__STATIC_CAST(long long,K->mu), TC__STATIC_CAST(long long,K->poly));
+    t = _mm_clmulepi64_si128(_mm_and_si128(x0, mask32), k, 0x10);
+    t = _mm_clmulepi64_si128(_mm_and_si128(t, mask32), k, 0x00);
+    x0 = _mm_xor_si128(x0, t);
+    return TC__STATIC_CAST(uint32_t,_mm_cvtsi128_si32(_mm_srli_si128(x0, 4)));
+}
+
+TCSUM_I_TARGET_X86_("sse4.2")
+static uint32_t tcsum_i_crc32c_sse42_(uint32_t crc, const unsigned char* udata, size_t dlen)
+{
+#if defined(__x86_64__) || defined(_M_X64)
+    uint64_t crc64 = crc;
+    while(dlen >= 8)
+    {
+        crc64 = _mm_crc32_u64(crc64, tcsum_i_read64_(udata));
+        udata += 8;
+        dlen -= 8;
+    }
+    crc = TC__STATIC_CAST(uint32_t,crc64);
+#endif
+    while(dlen >= 4)
+    {
+        crc = _mm_crc32_u32(crc, tcsum_i_read32_(udata));
+        udata += 4;
+        dlen -= 4;
+    }
+    while(dlen--)
+        crc = _mm_crc32_u8(crc, *udata++);
+    return crc;
+}
+#endif /* TCSUM_I_ACCEL_X86_ */
+
+#if defined(TCSUM_I_ACCEL_ARM_)
+#define TCSUM_I_CRC_ARM_BODY_(C)                                               \
+    while(dlen >= 8)                                                           \
+    {                                                                          \
+        crc = __crc32##C##d(crc, tcsum_i_read64_(udata));                      \
+        udata += 8;                                                            \
+        dlen -= 8;                                                             \
+    }                                                                          \
+    while(dlen--)                                                              \
+        crc = __crc32##C##b(crc, *udata++);                                    \
+    return crc;
+
+TCSUM_I_TARGET_ARM_CRC_
+static uint32_t tcsum_i_crc32_arm_(uint32_t crc, const unsigned char* udata, size_t dlen) { TCSUM_I_CRC_ARM_BODY_() }
+TCSUM_I_TARGET_ARM_CRC_
+static uint32_t tcsum_i_crc32c_arm_(uint32_t crc, const unsigned char* udata, size_t dlen) { TCSUM_I_CRC_ARM_BODY_(c) }
+#endif /* TCSUM_I_ACCEL_ARM_ */
+
+/* the raw (non-inverted) CRC register update */
+static uint32_t tcsum_i_crc32_update_(uint32_t crc, const unsigned char* udata, size_t dlen)
+{
+#if defined(TCSUM_I_ACCEL_X86_)
+    if(dlen >= TCSUM_I_CRC_FOLD_MIN_ && (tcsum_accel_get() & TCSUM_ACCEL_X86_PCLMUL))
+    {
+        size_t flen = dlen & ~TC__STATIC_CAST(size_t,15);
+        crc = tcsum_i_crc_fold_pclmul_(&tcsum_i_crc32_fold_, crc, udata, flen);
+        udata += flen;
+        dlen -= flen;
+    }
+#elif defined(TCSUM_I_ACCEL_ARM_)
+    if(tcsum_accel_get() & TCSUM_ACCEL_ARM_CRC32)
+        return tcsum_i_crc32_arm_(crc, udata, dlen);
+#endif
+    return tcsum_i_crc_sb8_(tcsum_i_crc32_table, crc, udata, dlen);
+}
+static uint32_t tcsum_i_crc32c_update_(uint32_t crc, const unsigned char* udata, size_t dlen)
+{
+#if defined(TCSUM_I_ACCEL_X86_)
+    unsigned int accel = tcsum_accel_get();
+    if(dlen >= TCSUM_I_CRC_FOLD_MIN_ && (accel & TCSUM_ACCEL_X86_PCLMUL))
+    {
+        size_t flen = dlen & ~TC__STATIC_CAST(size_t,15);
+        crc = tcsum_i_crc_fold_pclmul_(&tcsum_i_crc32c_fold_, crc, udata, flen);
+        udata += flen;
+        dlen -= flen;
+    }
+    if(accel & TCSUM_ACCEL_X86_SSE42)
+        return tcsum_i_crc32c_sse42_(crc, udata, dlen);
+#elif defined(TCSUM_I_ACCEL_ARM_)
+    if(tcsum_accel_get() & TCSUM_ACCEL_ARM_CRC32)
+        return tcsum_i_crc32c_arm_(crc, udata, dlen);
+#endif
+    return tcsum_i_crc_sb8_(tcsum_i_crc32c_table, crc, udata, dlen);
+}
+
+#define TCSUM_I_CRC_POLY_CRC32_     UINT32_C(0xEDB88320)
+#define TCSUM_I_CRC_POLY_CRC32C_    UINT32_C(0x82F63B78)
+#define TCSUM_I_CRC_DEFINE_(LSUM,USUM)                                         \
+    TCSum_##USUM* tcsum_##LSUM##_init(TCSum_##USUM* LSUM)                      \
+    {                                                                          \
+        LSUM->crc = ~UINT32_C(0);                                              \
+        return LSUM;                                                           \
+    }                                                                          \
+    void tcsum_##LSUM##_process(TCSum_##USUM* LSUM, const void* data, size_t dlen)\
+    {                                                                          \
+        LSUM->crc = tcsum_i_##LSUM##_update_(LSUM->crc, TC__VOID_CAST(const unsigned char*,data), dlen);\
+    }                                                                          \
+    uint32_t tcsum_##LSUM##_get(const TCSum_##USUM* LSUM)                      \
+    {                                                                          \
+        return ~LSUM->crc;                                                     \
+    }                                                                          \
+    uint32_t tcsum_##LSUM(const void* data, size_t dlen)                       \
+    {                                                                          \
+        return ~tcsum_i_##LSUM##_update_(~UINT32_C(0), TC__VOID_CAST(const unsigned char*,data), dlen);\
+    }                                                                          \
+    uint32_t tcsum_##LSUM##_combine(uint32_t crcA, uint32_t crcB, uint64_t lenB)\
+    {                                                                          \
+        return tcsum_i_crc_combine_(crcA, crcB, lenB, TCSUM_I_CRC_POLY_##USUM##_);\
+    }
+
+TCSUM_I_CRC_DEFINE_(crc32,CRC32)
+TCSUM_I_CRC_DEFINE_(crc32c,CRC32C)
+
+/* ========== xxHash32 & xxHash64 ========== */
+
+#define TCSUM_I_XXH_PRIME32_1_  UINT32_C(0x9E3779B1)
+#define TCSUM_I_XXH_PRIME32_2_  UINT32_C(0x85EBCA77)
+#define TCSUM_I_XXH_PRIME32_3_  UINT32_C(0xC2B2AE3D)
+#define TCSUM_I_XXH_PRIME32_4_  UINT32_C(0x27D4EB2F)
+#define TCSUM_I_XXH_PRIME32_5_  UINT32_C(0x165667B1)
+#define TCSUM_I_XXH_PRIME64_1_  UINT64_C(0x9E3779B185EBCA87)
+#define TCSUM_I_XXH_PRIME64_2_  UINT64_C(0xC2B2AE3D27D4EB4F)
+#define TCSUM_I_XXH_PRIME64_3_  UINT64_C(0x165667B19E3779F9)
+#define TCSUM_I_XXH_PRIME64_4_  UINT64_C(0x85EBCA77C2B2AE63)
+#define TCSUM_I_XXH_PRIME64_5_  UINT64_C(0x27D4EB2F165667C5)
+
+static uint32_t tcsum_i_xxh32_round_(uint32_t acc, uint32_t input)
+{
+    acc += input * TCSUM_I_XXH_PRIME32_2_;
+    acc = tcsum_i_rotl32_(acc, 13);
+    return acc * TCSUM_I_XXH_PRIME32_1_;
+}
+static uint64_t tcsum_i_xxh64_round_(uint64_t acc, uint64_t input)
+{
+    acc += input * TCSUM_I_XXH_PRIME64_2_;
+    acc = tcsum_i_rotl64_(acc, 31);
+    return acc * TCSUM_I_XXH_PRIME64_1_;
+}
+static uint64_t tcsum_i_xxh64_merge_(uint64_t acc, uint64_t val)
+{
+    acc ^= tcsum_i_xxh64_round_(0, val);
+    return acc * TCSUM_I_XXH_PRIME64_1_ + TCSUM_I_XXH_PRIME64_4_;
+}
+static uint64_t tcsum_i_xxh64_avalanche_(uint64_t h)
+{
+    h ^= h >> 33;
+    h *= TCSUM_I_XXH_PRIME64_2_;
+    h ^= h >> 29;
+    h *= TCSUM_I_XXH_PRIME64_3_;
+    h ^= h >> 32;
+    return h;
+}
+
+/* the streaming process is the same for both; stripes are processed directly from `data` wherever possible */
+#define TCSUM_I_XXH_PROCESS_BODY_(SIZE)                                        \
+    const unsigned char* udata = TC__VOID_CAST(const unsigned char*,data);     \
+    state->total += dlen;                                                      \
+    if(state->blen)                                                            \
+    {                                                                          \
+        size_t clen = sizeof(state->buf.b) - state->blen;                      \
+        if(clen > dlen) clen = dlen;                                           \
+        memcpy(state->buf.b + state->blen, udata, clen);                       \
+        state->blen += clen;                                                   \
+        udata += clen;                                                         \
+        dlen -= clen;                                                          \
+        if(state->blen < sizeof(state->buf.b))                                 \
+            return;                                                            \
+        for(i = 0; i < 4; i++)                                                 \
+            state->v[i] = tcsum_i_xxh##SIZE##_round_(state->v[i], tcsum_i_read##SIZE##_(state->buf.b + i * (SIZE / 8)));\
+        state->blen = 0;                                                       \
+    }                                                                          \
+    for(; dlen >= sizeof(state->buf.b); udata += sizeof(state->buf.b), dlen -= sizeof(state->buf.b))\
+        for(i = 0; i < 4; i++)                                                 \
+            state->v[i] = tcsum_i_xxh##SIZE##_round_(state->v[i], tcsum_i_read##SIZE##_(udata + i * (SIZE / 8)));\
+    memcpy(state->buf.b, udata, dlen);                                         \
+    state->blen = TC__STATIC_CAST(unsigned char,dlen);
+
+TCSum_XXH32* tcsum_xxh32_init(TCSum_XXH32* state, uint32_t seed)
+{
+    state->v[0] = seed + TCSUM_I_XXH_PRIME32_1_ + TCSUM_I_XXH_PRIME32_2_;
+    state->v[1] = seed + TCSUM_I_XXH_PRIME32_2_;
+    state->v[2] = seed;
+    state->v[3] = seed - TCSUM_I_XXH_PRIME32_1_;
+    state->total = 0;
+    state->blen = 0;
+    return state;
+}
+void tcsum_xxh32_process(TCSum_XXH32* state, const void* data, size_t dlen)
+{
+    int i;
+    TCSUM_I_XXH_PROCESS_BODY_(32)
+}
+uint32_t tcsum_xxh32_get(const TCSum_XXH32* state)
+{
+    const unsigned char* p = state->buf.b;
+    size_t len = state->blen;
+    uint32_t h;
+
+    if(state->total >= sizeof(state->buf.b))
+        h = tcsum_i_rotl32_(state->v[0], 1) + tcsum_i_rotl32_(state->v[1], 7) + tcsum_i_rotl32_(state->v[2], 12) + tcsum_i_rotl32_(state->v[3], 18);
+    else
+        h = state->v[2] /* seed */ + TCSUM_I_XXH_PRIME32_5_;
+    h += TC__STATIC_CAST(uint32_t,state->total);
+
+    for(; len >= 4; p += 4, len -= 4)
+        h = tcsum_i_rotl32_(h + tcsum_i_read32_(p) * TCSUM_I_XXH_PRIME32_3_, 17) * TCSUM_I_XXH_PRIME32_4_;
+    for(; len; p++, len--)
+        h = tcsum_i_rotl32_(h + *p * TCSUM_I_XXH_PRIME32_5_, 11) * TCSUM_I_XXH_PRIME32_1_;
+
+    h ^= h >> 15;
+    h *= TCSUM_I_XXH_PRIME32_2_;
+    h ^= h >> 13;
+    h *= TCSUM_I_XXH_PRIME32_3_;
+    h ^= h >> 16;
+    return h;
+}
+uint32_t tcsum_xxh32(const void* data, size_t dlen, uint32_t seed)
+{
+    TCSum_XXH32 state;
+    tcsum_xxh32_process(tcsum_xxh32_init(&state, seed), data, dlen);
+    return tcsum_xxh32_get(&state);
+}
+
+TCSum_XXH64* tcsum_xxh64_init(TCSum_XXH64* state, uint64_t seed)
+{
+    state->v[0] = seed + TCSUM_I_XXH_PRIME64_1_ + TCSUM_I_XXH_PRIME64_2_;
+    state->v[1] = seed + TCSUM_I_XXH_PRIME64_2_;
+    state->v[2] = seed;
+    state->v[3] = seed - TCSUM_I_XXH_PRIME64_1_;
+    state->total = 0;
+    state->blen = 0;
+    return state;
+}
+void tcsum_xxh64_process(TCSum_XXH64* state, const void* data, size_t dlen)
+{
+    int i;
+    TCSUM_I_XXH_PROCESS_BODY_(64)
+}
+uint64_t tcsum_xxh64_get(const TCSum_XXH64* state)
+{
+    const unsigned char* p = state->buf.b;
+    size_t len = state->blen;
+    uint64_t h;
+
+    if(state->total >= sizeof(state->buf.b))
+    {
+        int i;
+        h = tcsum_i_rotl64_(state->v[0], 1) + tcsum_i_rotl64_(state->v[1], 7) + tcsum_i_rotl64_(state->v[2], 12) + tcsum_i_rotl64_(state->v[3], 18);
+        for(i = 0; i < 4; i++)
+            h = tcsum_i_xxh64_merge_(h, state->v[i]);
+    }
+    else
+        h = state->v[2] /* seed */ + TCSUM_I_XXH_PRIME64_5_;
+    h += state->total;
+
+    for(; len >= 8; p += 8, len -= 8)
+        h = tcsum_i_rotl64_(h ^ tcsum_i_xxh64_round_(0, tcsum_i_read64_(p)), 27) * TCSUM_I_XXH_PRIME64_1_ + TCSUM_I_XXH_PRIME64_4_;
+    if(len >= 4)
+    {
+        h = tcsum_i_rotl64_(h ^ (tcsum_i_read32_(p) * TCSUM_I_XXH_PRIME64_1_), 23) * TCSUM_I_XXH_PRIME64_2_ + TCSUM_I_XXH_PRIME64_3_;
+        p += 4;
+        len -= 4;
+    }
+    for(; len; p++, len--)
+        h = tcsum_i_rotl64_(h ^ (*p * TCSUM_I_XXH_PRIME64_5_), 11) * TCSUM_I_XXH_PRIME64_1_;
+
+    return tcsum_i_xxh64_avalanche_(h);
+}
+uint64_t tcsum_xxh64(const void* data, size_t dlen, uint64_t seed)
+{
+    TCSum_XXH64 state;
+    tcsum_xxh64_process(tcsum_xxh64_init(&state, seed), data, dlen);
+    return tcsum_xxh64_get(&state);
+}
+
+/* ========== XXH3 ========== */
+
+#define TCSUM_I_XXH3_PRIME_MX1_     UINT64_C(0x165667919E3779F9)
+#define TCSUM_I_XXH3_PRIME_MX2_     UINT64_C(0x9FB21C651E98DF25)
+#define TCSUM_I_XXH3_STRIPE_LEN_    64
+#define TCSUM_I_XXH3_SECRET_RATE_   8   /* secret bytes consumed per stripe */
+#define TCSUM_I_XXH3_MIDSIZE_MAX_   240
+#define TCSUM_I_XXH3_BLOCK_STRIPES_ ((TCSUM_XXH3_SECRET_SIZE - TCSUM_I_XXH3_STRIPE_LEN_) / TCSUM_I_XXH3_SECRET_RATE_)
+
+static const unsigned char tcsum_i_xxh3_ksecret_[TCSUM_XXH3_SECRET_SIZE] = {
+    0xb8, 0xfe, 0x6c, 0x39, 0x23, 0xa4, 0x4b, 0xbe, 0x7c, 0x01, 0x81, 0x2c, 0xf7, 0x21, 0xad, 0x1c,
+    0xde, 0xd4, 0x6d, 0xe9, 0x83, 0x90, 0x97, 0xdb, 0x72, 0x40, 0xa4, 0xa4, 0xb7, 0xb3, 0x67, 0x1f,
+    0xcb, 0x79, 0xe6, 0x4e, 0xcc, 0xc0, 0xe5, 0x78, 0x82, 0x5a, 0xd0, 0x7d, 0xcc, 0xff, 0x72, 0x21,
+    0xb8, 0x08, 0x46, 0x74, 0xf7, 0x43, 0x24, 0x8e, 0xe0, 0x35, 0x90, 0xe6, 0x81, 0x3a, 0x26, 0x4c,
+    0x3c, 0x28, 0x52, 0xbb, 0x91, 0xc3, 0x00, 0xcb, 0x88, 0xd0, 0x65, 0x8b, 0x1b, 0x53, 0x2e, 0xa3,
+    0x71, 0x64, 0x48, 0x97, 0xa2, 0x0d, 0xf9, 0x4e, 0x38, 0x19, 0xef, 0x46, 0xa9, 0xde, 0xac, 0xd8,
+    0xa8, 0xfa, 0x76, 0x3f, 0xe3, 0x9c, 0x34, 0x3f, 0xf9, 0xdc, 0xbb, 0xc7, 0xc7, 0x0b, 0x4f, 0x1d,
+    0x8a, 0x51, 0xe0, 0x4b, 0xcd, 0xb4, 0x59, 0x31, 0xc8, 0x9f, 0x7e, 0xc9, 0xd9, 0x78, 0x73, 0x64,
+    0xea, 0xc5, 0xac, 0x83, 0x34, 0xd3, 0xeb, 0xc3, 0xc5, 0x81, 0xa0, 0xff, 0xfa, 0x13, 0x63, 0xeb,
+    0x17, 0x0d, 0xdd, 0x51, 0xb7, 0xf0, 0xda, 0x49, 0xd3, 0x16, 0x55, 0x26, 0x29, 0xd4, 0x68, 0x9e,
+    0x2b, 0x16, 0xbe, 0x58, 0x7d, 0x47, 0xa1, 0xfc, 0x8f, 0xf8, 0xb8, 0xd1, 0x7a, 0xd0, 0x31, 0xce,
+    0x45, 0xcb, 0x3a, 0x8f, 0x95, 0x16, 0x04, 0x28, 0xaf, 0xd7, 0xfb, 0xca, 0xbb, 0x4b, 0x40, 0x7e,
+};
+
+static uint64_t tcsum_i_xxh3_avalanche_(uint64_t h)
+{
+    h ^= h >> 37;
+    h *= TCSUM_I_XXH3_PRIME_MX1_;
+    h ^= h >> 32;
+    return h;
+}
+static uint64_t tcsum_i_xxh3_rrmxmx_(uint64_t h, uint64_t len)
+{
+    h ^= tcsum_i_rotl64_(h, 49) ^ tcsum_i_rotl64_(h, 24);
+    h *= TCSUM_I_XXH3_PRIME_MX2_;
+    h ^= (h >> 35) + len;
+    h *= TCSUM_I_XXH3_PRIME_MX2_;
+    return h ^ (h >> 28);
+}
+static uint64_t tcsum_i_xxh3_mix16_(const unsigned char* udata, const unsigned char* secret, uint64_t seed)
+{
+    uint64_t lo = tcsum_i_read64_(udata);
+    uint64_t hi = tcsum_i_read64_(udata + 8);
+    return tcsum_i_mul128_fold64_(lo ^ (tcsum_i_read64_(secret) + seed), hi ^ (tcsum_i_read64_(secret + 8) - seed));
+}
+static TCSum_U128 tcsum_i_xxh3_mix32_(TCSum_U128 acc, const unsigned char* udata1, const unsigned char* udata2, const unsigned char* secret, uint64_t seed)
+{
+    acc.lo += tcsum_i_xxh3_mix16_(udata1, secret, seed);
+    acc.lo ^= tcsum_i_read64_(udata2) + tcsum_i_read64_(udata2 + 8);
+    acc.hi += tcsum_i_xxh3_mix16_(udata2, secret + 16, seed);
+    acc.hi ^= tcsum_i_read64_(udata1) + tcsum_i_read64_(udata1 + 8);
+    return acc;
+}
+
+/* short inputs (<= 240 bytes) always use the default secret, and mix in the seed directly */
+static uint64_t tcsum_i_xxh3_64_short_(const unsigned char* udata, size_t len, const unsigned char* secret, uint64_t seed)
+{
+    uint64_t acc;
+    size_t i;
+    if(len > 128)
+    {
+        acc = len * TCSUM_I_XXH_PRIME64_1_;
+        for(i = 0; i < 8; i++)
+            acc += tcsum_i_xxh3_mix16_(udata + 16 * i, secret + 16 * i, seed);
+        acc = tcsum_i_xxh3_avalanche_(acc);
+        for(i = 8; i < len / 16; i++)
+            acc += tcsum_i_xxh3_mix16_(udata + 16 * i, secret + 16 * (i - 8) + 3, seed);
+        acc += tcsum_i_xxh3_mix16_(udata + len - 16, secret + 136 - 17, seed);
+        return tcsum_i_xxh3_avalanche_(acc);
+    }
+    else if(len > 16)
+    {
+        acc = len * TCSUM_I_XXH_PRIME64_1_;
+        if(len > 32)
+        {
+            if(len > 64)
+            {
+                if(len > 96)
+                {
+                    acc += tcsum_i_xxh3_mix16_(udata + 48, secret + 96, seed);
+                    acc += tcsum_i_xxh3_mix16_(udata + len - 64, secret + 112, seed);
+                }
+                acc += tcsum_i_xxh3_mix16_(udata + 32, secret + 64, seed);
+                acc += tcsum_i_xxh3_mix16_(udata + len - 48, secret + 80, seed);
+            }
+            acc += tcsum_i_xxh3_mix16_(udata + 16, secret + 32, seed);
+            acc += tcsum_i_xxh3_mix16_(udata + len - 32, secret + 48, seed);
+        }
+        acc += tcsum_i_xxh3_mix16_(udata, secret, seed);
+        acc += tcsum_i_xxh3_mix16_(udata + len - 16, secret + 16, seed);
+        return tcsum_i_xxh3_avalanche_(acc);
+    }
+    else if(len > 8)
+    {
+        uint64_t flip1 = (tcsum_i_read64_(secret + 24) ^ tcsum_i_read64_(secret + 32)) + seed;
+        uint64_t flip2 = (tcsum_i_read64_(secret + 40) ^ tcsum_i_read64_(secret + 48)) - seed;
+        uint64_t lo = tcsum_i_read64_(udata) ^ flip1;
+        uint64_t hi = tcsum_i_read64_(udata + len - 8) ^ flip2;
+        acc = len + tcsum_i_bswap64_(lo) + hi + tcsum_i_mul128_fold64_(lo, hi);
+        return tcsum_i_xxh3_avalanche_(acc);
+    }
+    else if(len >= 4)
+    {
+        uint64_t flip, input;
+        seed ^= TC__STATIC_CAST(uint64_t,tcsum_i_bswap32_(TC__STATIC_CAST(uint32_t,seed))) << 32;
+        flip = (tcsum_i_read64_(secret + 8) ^ tcsum_i_read64_(secret + 16)) - seed;
+        input = tcsum_i_read32_(udata + len - 4) + (TC__STATIC_CAST(uint64_t,tcsum_i_read32_(udata)) << 32);
+        return tcsum_i_xxh3_rrmxmx_(input ^ flip, len);
+    }
+    else if(len)
+    {
+        uint32_t combined = (TC__STATIC_CAST(uint32_t,udata[0]) << 16) | (TC__STATIC_CAST(uint32_t,udata[len >> 1]) << 24)
+                          | udata[len - 1] | (TC__STATIC_CAST(uint32_t,len) << 8);
+        uint64_t flip = (tcsum_i_read32_(secret) ^ tcsum_i_read32_(secret + 4)) + seed;
+        return tcsum_i_xxh64_avalanche_(combined ^ flip);
+    }
+    return tcsum_i_xxh64_avalanche_(seed ^ tcsum_i_read64_(secret + 56) ^ tcsum_i_read64_(secret + 64));
+}
+static TCSum_U128 tcsum_i_xxh3_128_short_(const unsigned char* udata, size_t len, const unsigned char* secret, uint64_t seed)
+{
+    TCSum_U128 acc, h;
+    size_t i;
+    if(len > 16)
+    {
+        acc.lo = len * TCSUM_I_XXH_PRIME64_1_;
+        acc.hi = 0;
+        if(len > 128)
+        {
+            for(i = 32; i < 160; i += 32)
+                acc = tcsum_i_xxh3_mix32_(acc, udata + i - 32, udata + i - 16, secret + i - 32, seed);
+            acc.lo = tcsum_i_xxh3_avalanche_(acc.lo);
+            acc.hi = tcsum_i_xxh3_avalanche_(acc.hi);
+            for(i = 160; i <= len; i += 32)
+                acc = tcsum_i_xxh3_mix32_(acc, udata + i - 32, udata + i - 16, secret + 3 + i - 160, seed);
+            acc = tcsum_i_xxh3_mix32_(acc, udata + len - 16, udata + len - 32, secret + 136 - 17 - 16, 0 - seed);
+        }
+        else
+        {
+            if(len > 32)
+            {
+                if(len > 64)
+                {
+                    if(len > 96)
+                        acc = tcsum_i_xxh3_mix32_(acc, udata + 48, udata + len - 64, secret + 96, seed);
+                    acc = tcsum_i_xxh3_mix32_(acc, udata + 32, udata + len - 48, secret + 64, seed);
+                }
+                acc = tcsum_i_xxh3_mix32_(acc, udata + 16, udata + len - 32, secret + 32, seed);
+            }
+            acc = tcsum_i_xxh3_mix32_(acc, udata, udata + len - 16, secret, seed);
+        }
+        h.lo = acc.lo + acc.hi;
+        h.hi = acc.lo * TCSUM_I_XXH_PRIME64_1_ + acc.hi * TCSUM_I_XXH_PRIME64_4_ + (len - seed) * TCSUM_I_XXH_PRIME64_2_;
+        h.lo = tcsum_i_xxh3_avalanche_(h.lo);
+        h.hi = 0 - tcsum_i_xxh3_avalanche_(h.hi);
+    }
+    else if(len > 8)
+    {
+        uint64_t flipl = (tcsum_i_read64_(secret + 32) ^ tcsum_i_read64_(secret + 40)) - seed;
+        uint64_t fliph = (tcsum_i_read64_(secret + 48) ^ tcsum_i_read64_(secret + 56)) + seed;
+        uint64_t inlo = tcsum_i_read64_(udata);
+        uint64_t inhi = tcsum_i_read64_(udata + len - 8);
+        TCSum_U128 m = tcsum_i_mul128_(inlo ^ inhi ^ flipl, TCSUM_I_XXH_PRIME64_1_);
+        m.lo += TC__STATIC_CAST(uint64_t,len - 1) << 54;
+        inhi ^= fliph;
+        m.hi += inhi + (inhi & 0xFFFFFFFFu) * (TCSUM_I_XXH_PRIME32_2_ - 1);
+        m.lo ^= tcsum_i_bswap64_(m.hi);
+        h = tcsum_i_mul128_(m.lo, TCSUM_I_XXH_PRIME64_2_);
+        h.hi += m.hi * TCSUM_I_XXH_PRIME64_2_;
+        h.lo = tcsum_i_xxh3_avalanche_(h.lo);
+        h.hi = tcsum_i_xxh3_avalanche_(h.hi);
+    }
+    else if(len >= 4)
+    {
+        uint64_t flip, input;
+        seed ^= TC__STATIC_CAST(uint64_t,tcsum_i_bswap32_(TC__STATIC_CAST(uint32_t,seed))) << 32;
+        flip = (tcsum_i_read64_(secret + 16) ^ tcsum_i_read64_(secret + 24)) + seed;
+        input = tcsum_i_read32_(udata) + (TC__STATIC_CAST(uint64_t,tcsum_i_read32_(udata + len - 4)) << 32);
+        h = tcsum_i_mul128_(input ^ flip, TCSUM_I_XXH_PRIME64_1_ + (TC__STATIC_CAST(uint64_t,len) << 2));
+        h.hi += h.lo << 1;
+        h.lo ^= h.hi >> 3;
+        h.lo ^= h.lo >> 35;
+        h.lo *= TCSUM_I_XXH3_PRIME_MX2_;
+        h.lo ^= h.lo >> 28;
+        h.hi = tcsum_i_xxh3_avalanche_(h.hi);
+    }
+    else if(len)
+    {
+        uint32_t combinedl = (TC__STATIC_CAST(uint32_t,udata[0]) << 16) | (TC__STATIC_CAST(uint32_t,udata[len >> 1]) << 24)
+                           | udata[len - 1] | (TC__STATIC_CAST(uint32_t,len) << 8);
+        uint32_t combinedh = tcsum_i_rotl32_(tcsum_i_bswap32_(combinedl), 13);
+        uint64_t flipl = (tcsum_i_read32_(secret) ^ tcsum_i_read32_(secret + 4)) + seed;
+        uint64_t fliph = (tcsum_i_read32_(secret + 8) ^ tcsum_i_read32_(secret + 12)) - seed;
+        h.lo = tcsum_i_xxh64_avalanche_(combinedl ^ flipl);
+        h.hi = tcsum_i_xxh64_avalanche_(combinedh ^ fliph);
+    }
+    else
+    {
+        h.lo = tcsum_i_xxh64_avalanche_(seed ^ tcsum_i_read64_(secret + 64) ^ tcsum_i_read64_(secret + 72));
+        h.hi = tcsum_i_xxh64_avalanche_(seed ^ tcsum_i_read64_(secret + 80) ^ tcsum_i_read64_(secret + 88));
+    }
+    return h;
+}
+
+/*
+ * Long inputs: 8 accumulators, fed 64-byte stripes; each stripe uses the
+ * secret at an 8-byte offset from the previous one, and after every block of
+ * `TCSUM_I_XXH3_BLOCK_STRIPES_` stripes, the accumulators are scrambled.
+ */
+typedef void tcsum_i_xxh3_accumulate_fn_(uint64_t acc[8], const unsigned char* udata, const unsigned char* secret, size_t nstripes);
+typedef void tcsum_i_xxh3_scramble_fn_(uint64_t acc[8], const unsigned char* secret);
+
+static void tcsum_i_xxh3_accumulate_portable_(uint64_t acc[8], const unsigned char* udata, const unsigned char* secret, size_t nstripes)
+{
+    size_t s;
+    int i;
+    for(s = 0; s < nstripes; s++, udata += TCSUM_I_XXH3_STRIPE_LEN_, secret += TCSUM_I_XXH3_SECRET_RATE_)
+        for(i = 0; i < 8; i++)
+        {
+            uint64_t v = tcsum_i_read64_(udata + 8 * i);
+            uint64_t k = v ^ tcsum_i_read64_(secret + 8 * i);
+            acc[i ^ 1] += v;
+            acc[i] += (k & 0xFFFFFFFFu) * (k >> 32);
+        }
+}
+static void tcsum_i_xxh3_scramble_portable_(uint64_t acc[8], const unsigned char* secret)
+{
+    int i;
+    for(i = 0; i < 8; i++)
+    {
+        uint64_t a = acc[i];
+        a ^= a >> 47;
+        a ^= tcsum_i_read64_(secret + 8 * i);
+        acc[i] = a * TCSUM_I_XXH_PRIME32_1_;
+    }
+}
+
+#if defined(TCSUM_I_ACCEL_X86_)
+TCSUM_I_TARGET_X86_("sse2")
+static void tcsum_i_xxh3_accumulate_sse2_(uint64_t acc[8], const unsigned char* udata, const unsigned char* secret, size_t nstripes)
+{
+    __m128i* vacc = TC__STATIC_CAST(__m128i*,TC__VOID_CAST(void*,acc));
+    __m128i a0 = _mm_loadu_si128(vacc + 0), a1 = _mm_loadu_si128(vacc + 1), a2 = _mm_loadu_si128(vacc + 2), a3 = _mm_loadu_si128(vacc + 3);
+    size_t s;
+#define TCSUM_I_XXH3_ACC_SSE2_(A,I)                                            \
+    {                                                                          \
+        __m128i v = _mm_loadu_si128(TC__STATIC_CAST(const __m128i*,TC__VOID_CAST(const void*,udata)) + (I));\
+        __m128i k = _mm_xor_si128(v, _mm_loadu_si128(TC__STATIC_CAST(const __m128i*,TC__VOID_CAST(const void*,secret)) + (I)));\
+        __m128i p = _mm_mul_epu32(k, _mm_shuffle_epi32(k, _MM_SHUFFLE(0, 3, 0, 1)));\
+        A = _mm_add_epi64(A, _mm_add_epi64(p, _mm_shuffle_epi32(v, _MM_SHUFFLE(1, 0, 3, 2))));\
+    }
+    for(s = 0; s < nstripes; s++, udata += TCSUM_I_XXH3_STRIPE_LEN_, secret += TCSUM_I_XXH3_SECRET_RATE_)
+    {
+        TCSUM_I_XXH3_ACC_SSE2_(a0, 0)
+        TCSUM_I_XXH3_ACC_SSE2_(a1, 1)
+        TCSUM_I_XXH3_ACC_SSE2_(a2, 2)
+        TCSUM_I_XXH3_ACC_SSE2_(a3, 3)
+    }
+#undef TCSUM_I_XXH3_ACC_SSE2_
+    _mm_storeu_si128(vacc + 0, a0); _mm_storeu_si128(vacc + 1, a1); _mm_storeu_si128(vacc + 2, a2); _mm_storeu_si128(vacc + 3, a3);
+}
+TCSUM_I_TARGET_X86_("sse2")
+static void tcsum_i_xxh3_scramble_sse2_(uint64_t acc[8], const unsigned char* secret)
+{
+    __m128i* vacc = TC__STATIC_CAST(__m128i*,TC__VOID_CAST(void*,acc));
+    const __m128i prime = _mm_set1_epi32(TC__STATIC_CAST(int,TCSUM_I_XXH_PRIME32_1_));
+    int i;
+    for(i = 0; i < 4; i++)
+    {
+        __m128i a = _mm_loadu_si128(vacc + i);
+        a = _mm_xor_si128(a, _mm_srli_epi64(a, 47));
+        a = _mm_xor_si128(a, _mm_loadu_si128(TC__STATIC_CAST(const __m128i*,TC__VOID_CAST(const void*,secret)) + i));
+        /* 64x32-bit multiplication, from two 32x32->64-bit ones */
+        a = _mm_add_epi64(_mm_mul_epu32(a, prime), _mm_slli_epi64(_mm_mul_epu32(_mm_srli_epi64(a, 32), prime), 32));
+        _mm_storeu_si128(vacc + i, a);
+    }
+}
+TCSUM_I_TARGET_X86_("avx2")
+static void tcsum_i_xxh3_accumulate_avx2_(uint64_t acc[8], const unsigned char* udata, const unsigned char* secret, size_t nstripes)
+{
+    __m256i* vacc = TC__STATIC_CAST(__m256i*,TC__VOID_CAST(void*,acc));
+    __m256i a0 = _mm256_loadu_si256(vacc + 0), a1 = _mm256_loadu_si256(vacc + 1);
+    size_t s;
+#define TCSUM_I_XXH3_ACC_AVX2_(A,I)                                            \
+    {                                                                          \
+        __m256i v = _mm256_loadu_si256(TC__STATIC_CAST(const __m256i*,TC__VOID_CAST(const void*,udata)) + (I));\
+        __m256i k = _mm256_xor_si256(v, _mm256_loadu_si256(TC__STATIC_CAST(const __m256i*,TC__VOID_CAST(const void*,secret)) + (I)));\
+        __m256i p = _mm256_mul_epu32(k, _mm256_shuffle_epi32(k, _MM_SHUFFLE(0, 3, 0, 1)));\
+        A = _mm256_add_epi64(A, _mm256_add_epi64(p, _mm256_shuffle_epi32(v, _MM_SHUFFLE(1, 0, 3, 2))));\
+    }
+    for(s = 0; s < nstripes; s++, udata += TCSUM_I_XXH3_STRIPE_LEN_, secret += TCSUM_I_XXH3_SECRET_RATE_)
+    {
+        TCSUM_I_XXH3_ACC_AVX2_(a0, 0)
+        TCSUM_I_XXH3_ACC_AVX2_(a1, 1)
+    }
+#undef TCSUM_I_XXH3_ACC_AVX2_
+    _mm256_storeu_si256(vacc + 0, a0); _mm256_storeu_si256(vacc + 1, a1);
+}
+TCSUM_I_TARGET_X86_("avx2")
+static void tcsum_i_xxh3_scramble_avx2_(uint64_t acc[8], const unsigned char* secret)
+{
+    __m256i* vacc = TC__STATIC_CAST(__m256i*,TC__VOID_CAST(void*,acc));
+    const __m256i prime = _mm256_set1_epi32(TC__STATIC_CAST(int,TCSUM_I_XXH_PRIME32_1_));
+    int i;
+    for(i = 0; i < 2; i++)
+    {
+        __m256i a = _mm256_loadu_si256(vacc + i);
+        a = _mm256_xor_si256(a, _mm256_srli_epi64(a, 47));
+        a = _mm256_xor_si256(a, _mm256_loadu_si256(TC__STATIC_CAST(const __m256i*,TC__VOID_CAST(const void*,secret)) + i));
+        a = _mm256_add_epi64(_mm256_mul_epu32(a, prime), _mm256_slli_epi64(_mm256_mul_epu32(_mm256_srli_epi64(a, 32), prime), 32));
+        _mm256_storeu_si256(vacc + i, a);
+    }
+}
+#endif /* TCSUM_I_ACCEL_X86_ */
+
+typedef struct TCSum_I_XXH3Kernel_
+{
+    tcsum_i_xxh3_accumulate_fn_* accumulate;
+    tcsum_i_xxh3_scramble_fn_* scramble;
+} TCSum_I_XXH3Kernel_;
+static TCSum_I_XXH3Kernel_ tcsum_i_xxh3_kernel_(void)
+{
+    TCSum_I_XXH3Kernel_ kernel;
+#if defined(TCSUM_I_ACCEL_X86_)
+    unsigned int accel = tcsum_accel_get();
+    if(accel & TCSUM_ACCEL_X86_AVX2)
+    {
+        kernel.accumulate = tcsum_i_xxh3_accumulate_avx2_;
+        kernel.scramble = tcsum_i_xxh3_scramble_avx2_;
+        return kernel;
+    }
+    if(accel & TCSUM_ACCEL_X86_SSE2)
+    {
+        kernel.accumulate = tcsum_i_xxh3_accumulate_sse2_;
+        kernel.scramble = tcsum_i_xxh3_scramble_sse2_;
+        return kernel;
+    }
+#endif
+    kernel.accumulate = tcsum_i_xxh3_accumulate_portable_;
+    kernel.scramble = tcsum_i_xxh3_scramble_portable_;
+    return kernel;
+}
+
+/* feed `nstripes` whole stripes, given that `*nsofar` stripes of the current block were already done */
+static const unsigned char* tcsum_i_xxh3_consume_(const TCSum_I_XXH3Kernel_* kernel, uint64_t acc[8], size_t* nsofar, const unsigned char* udata, size_t nstripes, const unsigned char* secret)
+{
+    const unsigned char* isecret = secret + *nsofar * TCSUM_I_XXH3_SECRET_RATE_;
+    if(nstripes >= TCSUM_I_XXH3_BLOCK_STRIPES_ - *nsofar)
+    {
+        size_t n = TCSUM_I_XXH3_BLOCK_STRIPES_ - *nsofar;
+        do
+        {
+            kernel->accumulate(acc, udata, isecret, n);
+            kernel->scramble(acc, secret + TCSUM_XXH3_SECRET_SIZE - TCSUM_I_XXH3_STRIPE_LEN_);
+            udata += n * TCSUM_I_XXH3_STRIPE_LEN_;
+            nstripes -= n;
+            n = TCSUM_I_XXH3_BLOCK_STRIPES_;
+            isecret = secret;
+        }
+        while(nstripes >= TCSUM_I_XXH3_BLOCK_STRIPES_);
+        *nsofar = 0;
+    }
+    if(nstripes)
+    {
+        kernel->accumulate(acc, udata, isecret, nstripes);
+        udata += nstripes * TCSUM_I_XXH3_STRIPE_LEN_;
+        *nsofar += nstripes;
+    }
+    return udata;
+}
+static uint64_t tcsum_i_xxh3_merge_(const uint64_t acc[8], const unsigned char* secret, uint64_t start)
+{
+    uint64_t h = start;
+    int i;
+    for(i = 0; i < 4; i++)
+        h += tcsum_i_mul128_fold64_(acc[2 * i] ^ tcsum_i_read64_(secret + 16 * i), acc[2 * i + 1] ^ tcsum_i_read64_(secret + 16 * i + 8));
+    return tcsum_i_xxh3_avalanche_(h);
+}
+
+TCSum_XXH3* tcsum_xxh3_init(TCSum_XXH3* state, uint64_t seed)
+{
+    int i;
+    state->acc[0] = TCSUM_I_XXH_PRIME32_3_;
+    state->acc[1] = TCSUM_I_XXH_PRIME64_1_;
+    state->acc[2] = TCSUM_I_XXH_PRIME64_2_;
+    state->acc[3] = TCSUM_I_XXH_PRIME64_3_;
+    state->acc[4] = TCSUM_I_XXH_PRIME64_4_;
+    state->acc[5] = TCSUM_I_XXH_PRIME32_2_;
+    state->acc[6] = TCSUM_I_XXH_PRIME64_5_;
+    state->acc[7] = TCSUM_I_XXH_PRIME32_1_;
+    state->total = 0;
+    state->seed = seed;
+    state->nstripes = 0;
+    state->blen = 0;
+    /* long inputs use a secret derived from the seed */
+    for(i = 0; i < TCSUM_XXH3_SECRET_SIZE; i += 16)
+    {
+        tcsum_i_write64_(state->secret + i, tcsum_i_read64_(tcsum_i_xxh3_ksecret_ + i) + seed);
+        tcsum_i_write64_(state->secret + i + 8, tcsum_i_read64_(tcsum_i_xxh3_ksecret_ + i + 8) - seed);
+    }
+    return state;
+}
+void tcsum_xxh3_process(TCSum_XXH3* state, const void* data, size_t dlen)
+{
+    const unsigned char* udata = TC__VOID_CAST(const unsigned char*,data);
+    const unsigned char* uend = udata + dlen;
+    TCSum_I_XXH3Kernel_ kernel;
+
+    state->total += dlen;
+    if(dlen <= TCSUM_XXH3_BUFFER_SIZE - state->blen)
+    {
+        memcpy(state->buf + state->blen, udata, dlen);
+        state->blen += dlen;
+        return;
+    }
+
+    kernel = tcsum_i_xxh3_kernel_();
+    if(state->blen)
+    {
+        size_t clen = TCSUM_XXH3_BUFFER_SIZE - state->blen;
+        memcpy(state->buf + state->blen, udata, clen);
+        udata += clen;
+        tcsum_i_xxh3_consume_(&kernel, state->acc, &state->nstripes, state->buf, TCSUM_XXH3_BUFFER_SIZE / TCSUM_I_XXH3_STRIPE_LEN_, state->secret);
+        state->blen = 0;
+    }
+    /*
+     * The last stripe is never consumed here (it is processed differently on
+     * `get()`), so always leave at least 1 byte in the buffer; but retain a
+     * copy of the last consumed stripe, in case the remainder is shorter.
+     */
+    if(TC__STATIC_CAST(size_t,uend - udata) > TCSUM_XXH3_BUFFER_SIZE)
+    {
+        size_t nstripes = TC__STATIC_CAST(size_t,uend - 1 - udata) / TCSUM_I_XXH3_STRIPE_LEN_;
+        udata = tcsum_i_xxh3_consume_(&kernel, state->acc, &state->nstripes, udata, nstripes, state->secret);
+        memcpy(state->buf + TCSUM_XXH3_BUFFER_SIZE - TCSUM_I_XXH3_STRIPE_LEN_, udata - TCSUM_I_XXH3_STRIPE_LEN_, TCSUM_I_XXH3_STRIPE_LEN_);
+    }
+    memcpy(state->buf, udata, uend - udata);
+    state->blen = uend - udata;
+}
+/* process the remaining buffer & last stripe into a copy of the accumulators */
+static void tcsum_i_xxh3_digest_long_(const TCSum_XXH3* state, uint64_t acc[8])
+{
+    TCSum_I_XXH3Kernel_ kernel = tcsum_i_xxh3_kernel_();
+    unsigned char laststripe[TCSUM_I_XXH3_STRIPE_LEN_];
+    const unsigned char* plast;
+
+    memcpy(acc, state->acc, sizeof(state->acc));
+    if(state->blen >= TCSUM_I_XXH3_STRIPE_LEN_)
+    {
+        size_t nsofar = state->nstripes;
+        tcsum_i_xxh3_consume_(&kernel, acc, &nsofar, state->buf, (state->blen - 1) / TCSUM_I_XXH3_STRIPE_LEN_, state->secret);
+        plast = state->buf + state->blen - TCSUM_I_XXH3_STRIPE_LEN_;
+    }
+    else
+    {
+        size_t catchup = TCSUM_I_XXH3_STRIPE_LEN_ - state->blen;
+        memcpy(laststripe, state->buf + TCSUM_XXH3_BUFFER_SIZE - catchup, catchup);
+        memcpy(laststripe + catchup, state->buf, state->blen);
+        plast = laststripe;
+    }
+    kernel.accumulate(acc, plast, state->secret + TCSUM_XXH3_SECRET_SIZE - TCSUM_I_XXH3_STRIPE_LEN_ - 7, 1);
+}
+uint64_t tcsum_xxh3_64_get(const TCSum_XXH3* state)
+{
+    uint64_t acc[8];
+    if(state->total <= TCSUM_I_XXH3_MIDSIZE_MAX_)
+        return tcsum_i_xxh3_64_short_(state->buf, TC__STATIC_CAST(size_t,state->total), tcsum_i_xxh3_ksecret_, state->seed);
+    tcsum_i_xxh3_digest_long_(state, acc);
+    return tcsum_i_xxh3_merge_(acc, state->secret + 11, state->total * TCSUM_I_XXH_PRIME64_1_);
+}
+TCSum_U128 tcsum_xxh3_128_get(const TCSum_XXH3* state)
+{
+    uint64_t acc[8];
+    TCSum_U128 h;
+    if(state->total <= TCSUM_I_XXH3_MIDSIZE_MAX_)
+        return tcsum_i_xxh3_128_short_(state->buf, TC__STATIC_CAST(size_t,state->total), tcsum_i_xxh3_ksecret_, state->seed);
+    tcsum_i_xxh3_digest_long_(state, acc);
+    h.lo = tcsum_i_xxh3_merge_(acc, state->secret + 11, state->total * TCSUM_I_XXH_PRIME64_1_);
+    h.hi = tcsum_i_xxh3_merge_(acc, state->secret + TCSUM_XXH3_SECRET_SIZE - TCSUM_I_XXH3_STRIPE_LEN_ - 11, ~(state->total * TCSUM_I_XXH_PRIME64_2_));
+    return h;
+}
+uint64_t tcsum_xxh3_64(const void* data, size_t dlen, uint64_t seed)
+{
+    TCSum_XXH3 state;
+    /* short inputs don't need the streaming state (nor the derived secret) */
+    if(dlen <= TCSUM_I_XXH3_MIDSIZE_MAX_)
+        return tcsum_i_xxh3_64_short_(TC__VOID_CAST(const unsigned char*,data), dlen, tcsum_i_xxh3_ksecret_, seed);
+    tcsum_xxh3_process(tcsum_xxh3_init(&state, seed), data, dlen);
+    return tcsum_xxh3_64_get(&state);
+}
+TCSum_U128 tcsum_xxh3_128(const void* data, size_t dlen, uint64_t seed)
+{
+    TCSum_XXH3 state;
+    if(dlen <= TCSUM_I_XXH3_MIDSIZE_MAX_)
+        return tcsum_i_xxh3_128_short_(TC__VOID_CAST(const unsigned char*,data), dlen, tcsum_i_xxh3_ksecret_, seed);
+    tcsum_xxh3_process(tcsum_xxh3_init(&state, seed), data, dlen);
+    return tcsum_xxh3_128_get(&state);
+}
+
+#endif /* TC_CHECKSUM_IMPLEMENTATION */
@@ -2,12 +2,13 @@
  * tc_editline.h: Terminal line editing support.
  *
  * DEPENDS: tc_history tc_terminal | tc_string
- * VERSION: 0.0.2 (2016-09-08)
+ * VERSION: 0.1.0 (2026-10-15)
  * LICENSE: CC0 & Boost (dual-licensed)
  * AUTHOR: Tim Cas
  * URL: https://github.com/darkuranium/tclib
  *
  * VERSION HISTORY:
+ * 0.1.0    redraws are now buffered, and only rewrite the part of the line that changed
  * 0.0.2    made the library compile with a C++ compiler
  * 0.0.1    initial public release
  *
@@ -48,22 +49,34 @@ TC_String* tcedit_readline(const char* prompt, int promptlen, int (*echo)(TC_Str
 #include "tc_terminal.h"
 
 static TC_History tcedit__hist;
+/* what is currently displayed after the prompt, for redrawing only the difference */
+static TC_String tcedit__shown;
 int tcedit_attach_stdio(int histlen)
 {
     if(!tcterm_init_stdio())
         return 0;
     if(!tchist_init(&tcedit__hist, histlen))
         return 0;
+    tcstr_init(&tcedit__shown, NULL);
     tcterm_set_mode_raw();
+    /* (if unsupported, we simply redraw unbuffered) */
+    tcterm_set_buffered(1);
 
     return 1;
 }
 int tcedit_detach(void)
 {
     tchist_deinit(&tcedit__hist);
+    tcstr_deinit(&tcedit__shown);
     int ret = tcterm_deinit();
     return ret;
 }
+/* byte `i` of a line split into `head` and `tail` */
+static char tcedit__at(const char* head, size_t headlen, const char* tail, size_t i)
+{
+    return i < headlen ? head[i] : tail[i - headlen];
+}
+
 TC_String* tcedit_readline(const char* prompt, int promptlen, int (*echo)(TC_String* str, size_t hpos))
 {
     tchist_cmd_vmove_full(&tcedit__hist, +1);
@@ -74,7 +87,10 @@ TC_String* tcedit_readline(const char* prompt, int promptlen, int (*echo)(TC_Str
 
     int cx, cy, tx, ty;
     tcterm_get_cursor_pos(&cx, &cy);
-    size_t hpos;
+    const char* head;
+    const char* tail;
+    size_t hpos, headlen, taillen, len, from, diff;
+    tcstr_reinits(&tcedit__shown, NULL, 0);
 
     int done = 0;
     int c;
@@ -82,6 +98,8 @@ TC_String* tcedit_readline(const char* prompt, int promptlen, int (*echo)(TC_Str
     while(!done)
     {
         c = tcterm_getc();
+        /* the line is unchanged before the cursor, except for vertical moves (see below) */
+        from = tchist_get_hpos(&tcedit__hist);
 
         switch(c)
         {
@@ -91,15 +109,15 @@ TC_String* tcedit_readline(const char* prompt, int promptlen, int (*echo)(TC_Str
             done = 1;
             break;
 
-        case TCTERM_KEY_UP: tchist_cmd_vmove(&tcedit__hist, -1); break;
-        case TCTERM_KEY_DOWN: tchist_cmd_vmove(&tcedit__hist, +1); break;
+        case TCTERM_KEY_UP: tchist_cmd_vmove(&tcedit__hist, -1); from = 0; break;
+        case TCTERM_KEY_DOWN: tchist_cmd_vmove(&tcedit__hist, +1); from = 0; break;
         case TCTERM_KEY_LEFT: tchist_cmd_hmove(&tcedit__hist, -1); break;
         case TCTERM_KEY_RIGHT: tchist_cmd_hmove(&tcedit__hist, +1); break;
 
         case TCTERM_KEY_INSERT: break; /* $$$ TODO INSERT $$$ */
         case TCTERM_KEY_DELETE: tchist_str_delete(&tcedit__hist, +1); break;
-        case TCTERM_KEY_PAGE_UP: tchist_cmd_vmove_full(&tcedit__hist, -1); break;
-        case TCTERM_KEY_PAGE_DOWN: tchist_cmd_vmove_full(&tcedit__hist, +1); break;
+        case TCTERM_KEY_PAGE_UP: tchist_cmd_vmove_full(&tcedit__hist, -1); from = 0; break;
+        case TCTERM_KEY_PAGE_DOWN: tchist_cmd_vmove_full(&tcedit__hist, +1); from = 0; break;
         case TCTERM_KEY_HOME: tchist_cmd_hmove_full(&tcedit__hist, -1); break;
         case TCTERM_KEY_END: tchist_cmd_hmove_full(&tcedit__hist, +1); break;
 
@@ -113,26 +131,55 @@ TC_String* tcedit_readline(const char* prompt, int promptlen, int (*echo)(TC_Str
             }
             break;
         }
-        tcterm_set_cursor_pos(cx, cy);
-        tcterm_clear_to_eol(TCTERM_STDOUT);
-
         hpos = tchist_get_hpos(&tcedit__hist);
+        if(from > hpos) from = hpos;
 
-        str = tchist_get_string(&tcedit__hist);
         if(echo)
         {
+            /* (the callback needs a contiguous string, so this closes the gap) */
+            str = tchist_get_string(&tcedit__hist);
+            tcterm_set_cursor_pos(cx, cy);
+            tcterm_clear_to_eol(TCTERM_STDOUT);
             if(!echo(str, hpos))
                 return NULL;
+            tx = cx + tcstr_utf8_find_char(str, hpos);
         }
         else
-            tcterm_print(str->ptr, str->len);
+        {
+            /* read the line around the gap, as closing it would move everything after the cursor on each key */
+            tchist_get_parts(&tcedit__hist, &head, &headlen, &tail, &taillen);
+            len = headlen + taillen;
+            /* only redraw from the first changed character onwards */
+            if(from > tcedit__shown.len) from = tcedit__shown.len;
+            for(diff = from; diff < len && diff < tcedit__shown.len; diff++)
+                if(tcedit__at(head, headlen, tail, diff) != tcedit__shown.ptr[diff])
+                    break;
+            while(diff && diff < len && (tcedit__at(head, headlen, tail, diff) & 0xC0) == 0x80)
+                diff--;
+            if(diff != len || diff != tcedit__shown.len)
+            {
+                /* (`tcedit__shown` matches the line up to `diff`) */
+                tcterm_set_cursor_pos(cx + tcstr_utf8_find_char(&tcedit__shown, diff), cy);
+                tcterm_clear_to_eol(TCTERM_STDOUT);
+                tcstr_splices(&tcedit__shown, diff, tcedit__shown.len - diff, NULL, 0);
+                if(diff < headlen)
+                {
+                    tcterm_print(head + diff, headlen - diff);
+                    tcstr_splices(&tcedit__shown, diff, 0, head + diff, headlen - diff);
+                }
+                diff = diff < headlen ? 0 : diff - headlen;
+                tcterm_print(tail + diff, taillen - diff);
+                tcstr_splices(&tcedit__shown, tcedit__shown.len, 0, tail + diff, taillen - diff);
+            }
+            tx = cx + tcstr_utf8_find_char(&tcedit__shown, hpos);
+        }
 
-        tx = cx; ty = cy;
-        if(hpos)
-            tx += tcstr_utf8_find_char(str, hpos);
+        ty = cy;
         tcterm_set_cursor_pos(tx, ty);
+        tcterm_flush();
     }
     tcterm_print("\n", 1);
+    tcterm_flush();
 
     return tchist_exec(&tcedit__hist);
 }
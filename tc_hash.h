@@ -1,13 +1,19 @@
 /*
  * tc_hash.h: Cryptographic hash function library.
  *
- * DEPENDS:
- * VERSION: 0.0.4 (2017-08-22)
+ * DEPENDS: tc_thread (optional)
+ * VERSION: 0.0.9 (2026-10-14)
  * LICENSE: CC0 & Boost (dual-licensed)
  * AUTHOR: Tim Cas
  * URL: https://github.com/darkuranium/tclib
  *
  * VERSION HISTORY:
+ * 0.0.9    added HMAC [FIPS 198-1] (with reusable keyed states) & HKDF [RFC 5869], for all fixed-size hashes
+ * 0.0.8    much faster (unrolled) Keccak permutation for SHA3/SHAKE, vectorized Keccak lanes & ARMv8.2 SHA3 support
+ *          added 4-way `tchash_sha3_256_x4()` & `tchash_shake128_x4()`
+ * 0.0.7    added BLAKE2b, BLAKE2s & BLAKE3 (with optional multi-threading via tc_thread)
+ * 0.0.6    added multi-buffer `tchash_{md5,sha2_256,sha3_256}_many()` (SSE2/AVX2/AVX-512/NEON lanes)
+ * 0.0.5    added hardware-accelerated SHA1 & SHA2-256 (x86 SHA extensions, ARMv8 Crypto), with runtime detection
  * 0.0.4    added RIPEMD-{128,160,256,320}
  * 0.0.3    changed `tchash_xstring_from_bytes()` to accept an `uppercase` parameter
  *          fixed a theoretical bug with uninitialized data in some cases (by sheer dumb luck, the bug did not affect any existing implementations)
@@ -17,14 +23,11 @@
  * 0.0.1    initial public release (MD5, FIPS 180-4: SHA1 & SHA2-{224,256,384,512,512/224,512/256})
  *
  * TODOs:
- * - BLAKE, BLAKE2 (as an alternative to SHA3 with [hopefully: testing required!] better performenace)
  * - optimizations
- * - HMAC [FIPS 198-1]
- * - CRC-* (not cryptographic, but useful; most likely as a separate `tc_checksum`, though)
  *
  *
  *
- * A library of byte-oriented cryptographic hash functions (some non-cryptographic ones are planned).
+ * A library of byte-oriented cryptographic hash functions (for non-cryptographic ones, see `tc_checksum`).
  *
  * A single file should contain the following `#define` before including the header:
  *
@@ -118,6 +121,10 @@
  * - SHAKE [FIPS 202]:
  *      - SHAKE128
  *      - SHAKE256
+ * - BLAKE2 [RFC 7693]:
+ *      - BLAKE2b (64-bit; 1-64 byte digest, optionally keyed)
+ *      - BLAKE2s (32-bit; 1-32 byte digest, optionally keyed)
+ * - BLAKE3 (optionally keyed; can be multi-threaded)
  * To help decide: avoid MD5 & SHA1 if at all possible (both have been broken;
  * they are included because some file formats and protocols still depend on
  * them, and because they still have *some* use as non-crypto-secure checksums).
@@ -127,7 +134,9 @@
  * SHA2-512/256 is a good choice for performance (good performance on 64-bit,
  * somewhat resistant against length extension attacks); for state-of-the-art
  * security (at the cost of speed), use an algorithm in the SHA3 family (this
- * includes the SHAKE{128,256} algorithms).
+ * includes the SHAKE{128,256} algorithms). BLAKE2b/BLAKE2s and BLAKE3 are secure
+ * alternatives that are faster than SHA3 (and than SHA2 without hardware
+ * acceleration); BLAKE3 can also make use of multiple threads on large inputs.
  * Finally, note that picking a secure function is required, but ***not***
  * sufficient for ensuring security in most cases.
  *
@@ -221,6 +230,143 @@
  *
  *
  * SYNOPSIS:
+ *  void tchash_md5_many(void* const* digests, const void* const* datas, const size_t* lens, size_t count);
+ * PARAMETERS:
+ *  - digests: `count` buffers for the resulting digests, each at least TCHASH_MD5_DIGEST_SIZE large
+ *  - datas: `count` messages to hash
+ *  - lens: `count` message lengths in bytes
+ *  - count: number of messages
+ * DESCRIPTION:
+ *  Compute the hashes of many independent messages.
+ *
+ *  The result is exactly the same as calling `tchash_md5(digests[i], datas[i], lens[i])`
+ *  for each `i`, but several messages are hashed at once, each in its own SIMD
+ *  lane (4, 8 or 16 lanes, depending on the CPU; see `tchash_accel_set()`).
+ *  Lanes are refilled as soon as their message is done, so lengths need not be
+ *  equal, though similar lengths work best. If the CPU has no suitable
+ *  extensions, this simply hashes each message in turn.
+ *
+ *  This is currently available for MD5, SHA2-256 and SHA3-256.
+ *
+ *
+ * SYNOPSIS:
+ *  void tchash_sha3_256_x4(void* const digests[4], const void* const datas[4], size_t dlen);
+ *  void tchash_shake128_x4(void* const digests[4], size_t digestlen, const void* const datas[4], size_t dlen);
+ * PARAMETERS:
+ *  - digests: 4 buffers for the resulting digests (each TCHASH_SHA3_256_DIGEST_SIZE or `digestlen` large)
+ *  - digestlen: desired digest length (SHAKE128 only)
+ *  - datas: 4 messages to hash, all of the same length
+ *  - dlen: length of each message in bytes
+ * DESCRIPTION:
+ *  Compute 4 independent hashes of equal-length messages, in a single pass.
+ *
+ *  The states are interleaved into 4x64-bit (AVX2) or 2x64-bit (SSE2, NEON)
+ *  lanes, so this works well for e.g. expanding many seeds with SHAKE128. The
+ *  results are exactly the same as 4 separate calls to `tchash_sha3_256()` or
+ *  `tchash_shake128()`.
+ *
+ *
+ * SYNOPSIS:
+ *  TCHash_BLAKE2B* tchash_blake2b_init_key(TCHash_BLAKE2B* blake2b, size_t digestlen, const void* key, size_t keylen);
+ *  TCHash_BLAKE2S* tchash_blake2s_init_key(TCHash_BLAKE2S* blake2s, size_t digestlen, const void* key, size_t keylen);
+ *  TCHash_BLAKE3* tchash_blake3_init_key(TCHash_BLAKE3* blake3, const void* key);
+ * PARAMETERS:
+ *  - blake2b,blake2s,blake3: algorithm state
+ *  - digestlen: length of the digest, from 1 to TCHASH_BLAKE2{B,S}_DIGEST_SIZE
+ *  - key: key to use (exactly TCHASH_BLAKE3_KEY_SIZE bytes for BLAKE3)
+ *  - keylen: length of key, from 0 (unkeyed) to TCHASH_BLAKE2{B,S}_KEY_SIZE
+ * RETURN VALUE:
+ *  The argument passed in as the state.
+ * DESCRIPTION:
+ *  Initialize a BLAKE2 or BLAKE3 state in keyed mode (i.e. as a MAC).
+ *
+ *  For BLAKE2, a different digest length gives an entirely different hash
+ *  (it is not a truncation); the plain `init()` uses the maximum length and
+ *  no key.
+ *
+ *
+ * SYNOPSIS:
+ *  void* tchash_blake3_mt(void* digest, size_t digestlen, const void* data, size_t dlen, unsigned int nthreads);
+ * PARAMETERS:
+ *  - digest: buffer for the resulting digest, at least `digestlen` large
+ *  - digestlen: desired digest length
+ *  - data: raw data to process
+ *  - dlen: data length in bytes
+ *  - nthreads: maximum number of threads to use, or `0` for one per CPU
+ * RETURN VALUE:
+ *  The resulting digest (this is the same pointer that was passed in as `digest`).
+ * DESCRIPTION:
+ *  Compute a BLAKE3 hash of the data in memory, using multiple threads.
+ *
+ *  BLAKE3 hashes 1 KiB chunks independently, and then merges them as a binary
+ *  tree; this function gives each thread a subtree of its own. The result is
+ *  identical to `tchash_blake3()`.
+ *
+ *  Threads are only used if `tc_thread.h` has been included before the
+ *  implementation of this library (and only for inputs large enough to
+ *  benefit); otherwise, this is the same as `tchash_blake3()`.
+ *
+ *
+ * SYNOPSIS:
+ *  TCHash_HMAC_MD5* tchash_hmac_md5_init(TCHash_HMAC_MD5* hmac, const void* key, size_t klen);
+ *  void tchash_hmac_md5_process(TCHash_HMAC_MD5* hmac, const void* data, size_t dlen);
+ *  void* tchash_hmac_md5_get(TCHash_HMAC_MD5* hmac, void* digest);
+ *  void* tchash_hmac_md5(void* digest, const void* key, size_t klen, const void* data, size_t dlen);
+ *  void* tchash_hmac_md5_keyed(void* digest, const TCHash_HMAC_MD5* keyed, const void* data, size_t dlen);
+ * PARAMETERS:
+ *  - hmac: HMAC state
+ *  - keyed: HMAC state that was only initialized (not processed), used as a template
+ *  - key: secret key (any length; keys longer than a block are hashed first)
+ *  - klen: key length in bytes
+ *  - digest: buffer for the resulting MAC, at least TCHASH_MD5_DIGEST_SIZE large
+ *  - data: raw data to process
+ *  - dlen: data length in bytes
+ * RETURN VALUE:
+ *  As with the corresponding non-HMAC functions.
+ * DESCRIPTION:
+ *  Compute a HMAC [FIPS 198-1] of the data, with any of the fixed-size hashes.
+ *
+ *  These work exactly like the non-HMAC functions (including the fact that
+ *  `get()` does not modify the state). The key only gets absorbed by `init()`,
+ *  and the state is a plain struct; so, to authenticate many messages with the
+ *  same key, initialize it once and then either copy it, or pass it to
+ *  `tchash_hmac_md5_keyed()` (which does exactly that):
+ *
+ *      TCHash_HMAC_SHA2_256 keyed;
+ *      tchash_hmac_sha2_256_init(&keyed, key, klen);
+ *      for(i = 0; i < nmessages; i++)
+ *          tchash_hmac_sha2_256_keyed(macs[i], &keyed, messages[i], lens[i]);
+ *
+ *  This is available for all of the algorithms except SHAKE (which has no
+ *  fixed digest size) and BLAKE3 (which has a keyed mode of its own; BLAKE2
+ *  does too, but HMAC-BLAKE2 is also provided for interoperability).
+ *
+ *  To verify a MAC, compare it via `tchash_secure_eq()`.
+ *
+ *
+ * SYNOPSIS:
+ *  void* tchash_hkdf_md5_extract(void* prk, const void* salt, size_t slen, const void* ikm, size_t ilen);
+ *  void* tchash_hkdf_md5_expand(void* okm, size_t olen, const void* prk, size_t prklen, const void* info, size_t infolen);
+ *  void* tchash_hkdf_md5(void* okm, size_t olen, const void* salt, size_t slen, const void* ikm, size_t ilen, const void* info, size_t infolen);
+ * PARAMETERS:
+ *  - prk: pseudorandom key, TCHASH_MD5_DIGEST_SIZE large
+ *  - prklen: length of `prk` in bytes (normally TCHASH_MD5_DIGEST_SIZE)
+ *  - salt: optional salt (`slen` of `0` is the same as a salt of all zeroes)
+ *  - ikm: input keying material
+ *  - okm: buffer for the output keying material, at least `olen` large
+ *  - olen: amount of keying material to generate, at most `255 * TCHASH_MD5_DIGEST_SIZE`
+ *  - info: optional application-specific information
+ *  - slen,ilen,infolen: lengths of the above, in bytes
+ * RETURN VALUE:
+ *  The output buffer (`prk` or `okm`), or `NULL` if `olen` is too large.
+ * DESCRIPTION:
+ *  Derive keys via HKDF [RFC 5869].
+ *
+ *  `tchash_hkdf_md5()` does both steps at once. The PRK is only keyed once
+ *  in `expand()`, regardless of how many blocks of output are requested.
+ *
+ *
+ * SYNOPSIS:
  *  int tchash_secure_eq(const void* a, const void* b, size_t len);
  * PARAMETERS:
  *  - a,b: data to compare
@@ -324,6 +470,41 @@
  *  For example, this will convert the string `"TWQ="` into bytes `{0x4d,0x61}`.
  * SEE ALSO:
  *  - `tchash_base64_from_bytes()`
+ *
+ *
+ * SYNOPSIS:
+ *  unsigned int tchash_accel_get_supported(void);
+ *  unsigned int tchash_accel_get(void);
+ *  unsigned int tchash_accel_set(unsigned int accel);
+ * PARAMETERS:
+ *  - accel: bitmask of `TCHASH_ACCEL_*` values to enable (`TCHASH_ACCEL_ALL`
+ *           to enable everything available, `TCHASH_ACCEL_NONE` to force the
+ *           portable implementations)
+ * RETURN VALUE:
+ *  - tchash_accel_get_supported: bitmask of accelerations supported by both the CPU and the build
+ *  - tchash_accel_get: bitmask of accelerations currently in use
+ *  - tchash_accel_set: the new bitmask of accelerations in use (which may be a subset of `accel`)
+ * DESCRIPTION:
+ *  Query or restrict the use of hardware-accelerated block functions.
+ *
+ *  Some algorithms have alternative implementations using CPU extensions; the
+ *  CPU is queried once (on first use) and the fastest available path is then
+ *  picked automatically. The following are currently available:
+ *  - `TCHASH_ACCEL_X86_SHA`: x86 SHA extensions (SHA1, SHA2-224, SHA2-256)
+ *  - `TCHASH_ACCEL_X86_SSE2`: 4x32-bit/2x64-bit lanes for the `_many()` functions
+ *  - `TCHASH_ACCEL_X86_AVX2`: 8x32-bit/4x64-bit lanes for the `_many()` functions
+ *  - `TCHASH_ACCEL_X86_AVX512`: 16x32-bit/8x64-bit lanes for the `_many()` functions
+ *  - `TCHASH_ACCEL_ARM_SHA1`: ARMv8 Cryptography Extension (SHA1)
+ *  - `TCHASH_ACCEL_ARM_SHA2`: ARMv8 Cryptography Extension (SHA2-224, SHA2-256)
+ *  - `TCHASH_ACCEL_ARM_NEON`: 4x32-bit/2x64-bit lanes for the `_many()` functions
+ *  - `TCHASH_ACCEL_ARM_SHA3`: ARMv8.2 SHA3 extension (for the Keccak lanes of the above)
+ *
+ *  All implementations produce identical results; the main use of
+ *  `tchash_accel_set()` is testing each of them, or working around a broken
+ *  platform. Calling it while another thread is hashing is undefined.
+ *
+ *  Acceleration can be disabled entirely at compile-time by defining
+ *  `TCHASH_NO_ACCEL` before including the implementation.
  */
 
 #ifndef TC_HASH_H_
@@ -342,6 +523,20 @@ size_t tchash_bytes_from_xstring(void* data, const char* str, int slen);
 size_t tchash_base64_from_bytes(char* str, const void* data, size_t dlen, int c62, int c63, int cpad);
 size_t tchash_bytes_from_base64(void* data, const char* str, int slen, int c62, int c63, int cpad);
 
+#define TCHASH_ACCEL_NONE       0x0000u
+#define TCHASH_ACCEL_X86_SHA    0x0001u
+#define TCHASH_ACCEL_X86_SSE2   0x0002u
+#define TCHASH_ACCEL_X86_AVX2   0x0004u
+#define TCHASH_ACCEL_X86_AVX512 0x0008u
+#define TCHASH_ACCEL_ARM_SHA1   0x0100u
+#define TCHASH_ACCEL_ARM_SHA2   0x0200u
+#define TCHASH_ACCEL_ARM_NEON   0x0400u
+#define TCHASH_ACCEL_ARM_SHA3   0x0800u
+#define TCHASH_ACCEL_ALL        (~0u)
+unsigned int tchash_accel_get_supported(void);
+unsigned int tchash_accel_get(void);
+unsigned int tchash_accel_set(unsigned int accel);
+
 
 #define TCHASH_MD5_BLOCK_SIZE       64
 #define TCHASH_MD5_DIGEST_SIZE      16
@@ -356,6 +551,7 @@ TCHash_MD5* tchash_md5_init(TCHash_MD5* md5);
 void tchash_md5_process(TCHash_MD5* md5, const void* data, size_t dlen);
 void* tchash_md5_get(TCHash_MD5* md5, void* digest);
 void* tchash_md5(void* digest, const void* data, size_t dlen);
+void tchash_md5_many(void* const* digests, const void* const* datas, const size_t* lens, size_t count);
 
 
 #define TCHASH_TIGER_BLOCK_SIZE     (512/8)
@@ -498,6 +694,7 @@ TCHash_SHA2_256* tchash_sha2_256_init(TCHash_SHA2_256* sha2_256);
 void tchash_sha2_256_process(TCHash_SHA2_256* sha2_256, const void* data, size_t dlen);
 void* tchash_sha2_256_get(TCHash_SHA2_256* sha2_256, void* digest);
 void* tchash_sha2_256(void* digest, const void* data, size_t dlen);
+void tchash_sha2_256_many(void* const* digests, const void* const* datas, const size_t* lens, size_t count);
 
 #define TCHASH_SHA2_512_BLOCK_SIZE  128
 #define TCHASH_SHA2_512_DIGEST_SIZE 64
@@ -587,6 +784,8 @@ TCHash_SHA3_256* tchash_sha3_256_init(TCHash_SHA3_256* sha3_256);
 void tchash_sha3_256_process(TCHash_SHA3_256* sha3_256, const void* data, size_t dlen);
 void* tchash_sha3_256_get(TCHash_SHA3_256* sha3_256, void* digest);
 void* tchash_sha3_256(void* digest, const void* data, size_t dlen);
+void tchash_sha3_256_many(void* const* digests, const void* const* datas, const size_t* lens, size_t count);
+void tchash_sha3_256_x4(void* const digests[4], const void* const datas[4], size_t dlen);
 
 #define TCHASH_SHA3_384_BLOCK_SIZE  ((1600-2*384)/8)
 #define TCHASH_SHA3_384_DIGEST_SIZE (384/8)
@@ -629,6 +828,7 @@ TCHash_SHAKE128* tchash_shake128_init(TCHash_SHAKE128* shake128);
 void tchash_shake128_process(TCHash_SHAKE128* shake128, const void* data, size_t dlen);
 void* tchash_shake128_get(TCHash_SHAKE128* shake128, void* digest, size_t digestlen);
 void* tchash_shake128(void* digest, size_t digestlen, const void* data, size_t dlen);
+void tchash_shake128_x4(void* const digests[4], size_t digestlen, const void* const datas[4], size_t dlen);
 
 #define TCHASH_SHAKE256_BLOCK_SIZE  ((1600-2*256)/8)
 typedef struct TCHash_SHAKE256
@@ -643,6 +843,307 @@ void tchash_shake256_process(TCHash_SHAKE256* shake256, const void* data, size_t
 void* tchash_shake256_get(TCHash_SHAKE256* shake256, void* digest, size_t digestlen);
 void* tchash_shake256(void* digest, size_t digestlen, const void* data, size_t dlen);
 
+
+#define TCHASH_BLAKE2B_BLOCK_SIZE   128
+#define TCHASH_BLAKE2B_DIGEST_SIZE  64
+#define TCHASH_BLAKE2B_KEY_SIZE     64
+typedef struct TCHash_BLAKE2B
+{
+    uint64_t total[2];
+    uint64_t h[8];
+    union { uint64_t M[TCHASH_BLAKE2B_BLOCK_SIZE / sizeof(uint64_t)]; unsigned char b[TCHASH_BLAKE2B_BLOCK_SIZE]; } buf;
+    unsigned char blen;
+    unsigned char dsize;
+} TCHash_BLAKE2B;
+TCHash_BLAKE2B* tchash_blake2b_init(TCHash_BLAKE2B* blake2b);
+TCHash_BLAKE2B* tchash_blake2b_init_key(TCHash_BLAKE2B* blake2b, size_t digestlen, const void* key, size_t keylen);
+void tchash_blake2b_process(TCHash_BLAKE2B* blake2b, const void* data, size_t dlen);
+void* tchash_blake2b_get(TCHash_BLAKE2B* blake2b, void* digest);
+void* tchash_blake2b(void* digest, const void* data, size_t dlen);
+
+#define TCHASH_BLAKE2S_BLOCK_SIZE   64
+#define TCHASH_BLAKE2S_DIGEST_SIZE  32
+#define TCHASH_BLAKE2S_KEY_SIZE     32
+typedef struct TCHash_BLAKE2S
+{
+    uint32_t total[2];
+    uint32_t h[8];
+    union { uint32_t M[TCHASH_BLAKE2S_BLOCK_SIZE / sizeof(uint32_t)]; unsigned char b[TCHASH_BLAKE2S_BLOCK_SIZE]; } buf;
+    unsigned char blen;
+    unsigned char dsize;
+} TCHash_BLAKE2S;
+TCHash_BLAKE2S* tchash_blake2s_init(TCHash_BLAKE2S* blake2s);
+TCHash_BLAKE2S* tchash_blake2s_init_key(TCHash_BLAKE2S* blake2s, size_t digestlen, const void* key, size_t keylen);
+void tchash_blake2s_process(TCHash_BLAKE2S* blake2s, const void* data, size_t dlen);
+void* tchash_blake2s_get(TCHash_BLAKE2S* blake2s, void* digest);
+void* tchash_blake2s(void* digest, const void* data, size_t dlen);
+
+#define TCHASH_BLAKE3_BLOCK_SIZE    64
+#define TCHASH_BLAKE3_CHUNK_SIZE    1024
+#define TCHASH_BLAKE3_DIGEST_SIZE   32  /* default; BLAKE3 is an XOF, so any length can be requested */
+#define TCHASH_BLAKE3_KEY_SIZE      32
+typedef struct TCHash_BLAKE3
+{
+    uint32_t key[8];
+    uint32_t h[8];
+    uint64_t chunk;
+    union { uint32_t M[TCHASH_BLAKE3_BLOCK_SIZE / sizeof(uint32_t)]; unsigned char b[TCHASH_BLAKE3_BLOCK_SIZE]; } buf;
+    unsigned char blen;
+    unsigned char nblocks;
+    unsigned char flags;
+    unsigned char nstack;
+    uint32_t stack[54][8];
+} TCHash_BLAKE3;
+TCHash_BLAKE3* tchash_blake3_init(TCHash_BLAKE3* blake3);
+TCHash_BLAKE3* tchash_blake3_init_key(TCHash_BLAKE3* blake3, const void* key);
+void tchash_blake3_process(TCHash_BLAKE3* blake3, const void* data, size_t dlen);
+void* tchash_blake3_get(TCHash_BLAKE3* blake3, void* digest, size_t digestlen);
+void* tchash_blake3(void* digest, size_t digestlen, const void* data, size_t dlen);
+void* tchash_blake3_mt(void* digest, size_t digestlen, const void* data, size_t dlen, unsigned int nthreads);
+
+#define TCHASH_HMAC_IPAD    0x36
+#define TCHASH_HMAC_OPAD    0x5C
+typedef struct TCHash_HMAC_MD5 { TCHash_MD5 inner, outer; } TCHash_HMAC_MD5;
+typedef struct TCHash_HMAC_Tiger192 { TCHash_Tiger192 inner, outer; } TCHash_HMAC_Tiger192;
+typedef struct TCHash_HMAC_Tiger160 { TCHash_Tiger160 inner, outer; } TCHash_HMAC_Tiger160;
+typedef struct TCHash_HMAC_Tiger128 { TCHash_Tiger128 inner, outer; } TCHash_HMAC_Tiger128;
+typedef struct TCHash_HMAC_Tiger2_192 { TCHash_Tiger2_192 inner, outer; } TCHash_HMAC_Tiger2_192;
+typedef struct TCHash_HMAC_Tiger2_160 { TCHash_Tiger2_160 inner, outer; } TCHash_HMAC_Tiger2_160;
+typedef struct TCHash_HMAC_Tiger2_128 { TCHash_Tiger2_128 inner, outer; } TCHash_HMAC_Tiger2_128;
+typedef struct TCHash_HMAC_RIPEMD128 { TCHash_RIPEMD128 inner, outer; } TCHash_HMAC_RIPEMD128;
+typedef struct TCHash_HMAC_RIPEMD160 { TCHash_RIPEMD160 inner, outer; } TCHash_HMAC_RIPEMD160;
+typedef struct TCHash_HMAC_RIPEMD256 { TCHash_RIPEMD256 inner, outer; } TCHash_HMAC_RIPEMD256;
+typedef struct TCHash_HMAC_RIPEMD320 { TCHash_RIPEMD320 inner, outer; } TCHash_HMAC_RIPEMD320;
+typedef struct TCHash_HMAC_SHA1 { TCHash_SHA1 inner, outer; } TCHash_HMAC_SHA1;
+typedef struct TCHash_HMAC_SHA2_224 { TCHash_SHA2_224 inner, outer; } TCHash_HMAC_SHA2_224;
+typedef struct TCHash_HMAC_SHA2_256 { TCHash_SHA2_256 inner, outer; } TCHash_HMAC_SHA2_256;
+typedef struct TCHash_HMAC_SHA2_384 { TCHash_SHA2_384 inner, outer; } TCHash_HMAC_SHA2_384;
+typedef struct TCHash_HMAC_SHA2_512 { TCHash_SHA2_512 inner, outer; } TCHash_HMAC_SHA2_512;
+typedef struct TCHash_HMAC_SHA2_512_224 { TCHash_SHA2_512_224 inner, outer; } TCHash_HMAC_SHA2_512_224;
+typedef struct TCHash_HMAC_SHA2_512_256 { TCHash_SHA2_512_256 inner, outer; } TCHash_HMAC_SHA2_512_256;
+typedef struct TCHash_HMAC_SHA3_224 { TCHash_SHA3_224 inner, outer; } TCHash_HMAC_SHA3_224;
+typedef struct TCHash_HMAC_SHA3_256 { TCHash_SHA3_256 inner, outer; } TCHash_HMAC_SHA3_256;
+typedef struct TCHash_HMAC_SHA3_384 { TCHash_SHA3_384 inner, outer; } TCHash_HMAC_SHA3_384;
+typedef struct TCHash_HMAC_SHA3_512 { TCHash_SHA3_512 inner, outer; } TCHash_HMAC_SHA3_512;
+typedef struct TCHash_HMAC_BLAKE2B { TCHash_BLAKE2B inner, outer; } TCHash_HMAC_BLAKE2B;
+typedef struct TCHash_HMAC_BLAKE2S { TCHash_BLAKE2S inner, outer; } TCHash_HMAC_BLAKE2S;
+
+TCHash_HMAC_MD5* tchash_hmac_md5_init(TCHash_HMAC_MD5* hmac, const void* key, size_t klen);
+void tchash_hmac_md5_process(TCHash_HMAC_MD5* hmac, const void* data, size_t dlen);
+void* tchash_hmac_md5_get(TCHash_HMAC_MD5* hmac, void* digest);
+void* tchash_hmac_md5(void* digest, const void* key, size_t klen, const void* data, size_t dlen);
+void* tchash_hmac_md5_keyed(void* digest, const TCHash_HMAC_MD5* keyed, const void* data, size_t dlen);
+void* tchash_hkdf_md5_extract(void* prk, const void* salt, size_t slen, const void* ikm, size_t ilen);
+void* tchash_hkdf_md5_expand(void* okm, size_t olen, const void* prk, size_t prklen, const void* info, size_t infolen);
+void* tchash_hkdf_md5(void* okm, size_t olen, const void* salt, size_t slen, const void* ikm, size_t ilen, const void* info, size_t infolen);
+
+TCHash_HMAC_Tiger192* tchash_hmac_tiger192_init(TCHash_HMAC_Tiger192* hmac, const void* key, size_t klen);
+void tchash_hmac_tiger192_process(TCHash_HMAC_Tiger192* hmac, const void* data, size_t dlen);
+void* tchash_hmac_tiger192_get(TCHash_HMAC_Tiger192* hmac, void* digest);
+void* tchash_hmac_tiger192(void* digest, const void* key, size_t klen, const void* data, size_t dlen);
+void* tchash_hmac_tiger192_keyed(void* digest, const TCHash_HMAC_Tiger192* keyed, const void* data, size_t dlen);
+void* tchash_hkdf_tiger192_extract(void* prk, const void* salt, size_t slen, const void* ikm, size_t ilen);
+void* tchash_hkdf_tiger192_expand(void* okm, size_t olen, const void* prk, size_t prklen, const void* info, size_t infolen);
+void* tchash_hkdf_tiger192(void* okm, size_t olen, const void* salt, size_t slen, const void* ikm, size_t ilen, const void* info, size_t infolen);
+
+TCHash_HMAC_Tiger160* tchash_hmac_tiger160_init(TCHash_HMAC_Tiger160* hmac, const void* key, size_t klen);
+void tchash_hmac_tiger160_process(TCHash_HMAC_Tiger160* hmac, const void* data, size_t dlen);
+void* tchash_hmac_tiger160_get(TCHash_HMAC_Tiger160* hmac, void* digest);
+void* tchash_hmac_tiger160(void* digest, const void* key, size_t klen, const void* data, size_t dlen);
+void* tchash_hmac_tiger160_keyed(void* digest, const TCHash_HMAC_Tiger160* keyed, const void* data, size_t dlen);
+void* tchash_hkdf_tiger160_extract(void* prk, const void* salt, size_t slen, const void* ikm, size_t ilen);
+void* tchash_hkdf_tiger160_expand(void* okm, size_t olen, const void* prk, size_t prklen, const void* info, size_t infolen);
+void* tchash_hkdf_tiger160(void* okm, size_t olen, const void* salt, size_t slen, const void* ikm, size_t ilen, const void* info, size_t infolen);
+
+TCHash_HMAC_Tiger128* tchash_hmac_tiger128_init(TCHash_HMAC_Tiger128* hmac, const void* key, size_t klen);
+void tchash_hmac_tiger128_process(TCHash_HMAC_Tiger128* hmac, const void* data, size_t dlen);
+void* tchash_hmac_tiger128_get(TCHash_HMAC_Tiger128* hmac, void* digest);
+void* tchash_hmac_tiger128(void* digest, const void* key, size_t klen, const void* data, size_t dlen);
+void* tchash_hmac_tiger128_keyed(void* digest, const TCHash_HMAC_Tiger128* keyed, const void* data, size_t dlen);
+void* tchash_hkdf_tiger128_extract(void* prk, const void* salt, size_t slen, const void* ikm, size_t ilen);
+void* tchash_hkdf_tiger128_expand(void* okm, size_t olen, const void* prk, size_t prklen, const void* info, size_t infolen);
+void* tchash_hkdf_tiger128(void* okm, size_t olen, const void* salt, size_t slen, const void* ikm, size_t ilen, const void* info, size_t infolen);
+
+TCHash_HMAC_Tiger2_192* tchash_hmac_tiger2_192_init(TCHash_HMAC_Tiger2_192* hmac, const void* key, size_t klen);
+void tchash_hmac_tiger2_192_process(TCHash_HMAC_Tiger2_192* hmac, const void* data, size_t dlen);
+void* tchash_hmac_tiger2_192_get(TCHash_HMAC_Tiger2_192* hmac, void* digest);
+void* tchash_hmac_tiger2_192(void* digest, const void* key, size_t klen, const void* data, size_t dlen);
+void* tchash_hmac_tiger2_192_keyed(void* digest, const TCHash_HMAC_Tiger2_192* keyed, const void* data, size_t dlen);
+void* tchash_hkdf_tiger2_192_extract(void* prk, const void* salt, size_t slen, const void* ikm, size_t ilen);
+void* tchash_hkdf_tiger2_192_expand(void* okm, size_t olen, const void* prk, size_t prklen, const void* info, size_t infolen);
+void* tchash_hkdf_tiger2_192(void* okm, size_t olen, const void* salt, size_t slen, const void* ikm, size_t ilen, const void* info, size_t infolen);
+
+TCHash_HMAC_Tiger2_160* tchash_hmac_tiger2_160_init(TCHash_HMAC_Tiger2_160* hmac, const void* key, size_t klen);
+void tchash_hmac_tiger2_160_process(TCHash_HMAC_Tiger2_160* hmac, const void* data, size_t dlen);
+void* tchash_hmac_tiger2_160_get(TCHash_HMAC_Tiger2_160* hmac, void* digest);
+void* tchash_hmac_tiger2_160(void* digest, const void* key, size_t klen, const void* data, size_t dlen);
+void* tchash_hmac_tiger2_160_keyed(void* digest, const TCHash_HMAC_Tiger2_160* keyed, const void* data, size_t dlen);
+void* tchash_hkdf_tiger2_160_extract(void* prk, const void* salt, size_t slen, const void* ikm, size_t ilen);
+void* tchash_hkdf_tiger2_160_expand(void* okm, size_t olen, const void* prk, size_t prklen, const void* info, size_t infolen);
+void* tchash_hkdf_tiger2_160(void* okm, size_t olen, const void* salt, size_t slen, const void* ikm, size_t ilen, const void* info, size_t infolen);
+
+TCHash_HMAC_Tiger2_128* tchash_hmac_tiger2_128_init(TCHash_HMAC_Tiger2_128* hmac, const void* key, size_t klen);
+void tchash_hmac_tiger2_128_process(TCHash_HMAC_Tiger2_128* hmac, const void* data, size_t dlen);
+void* tchash_hmac_tiger2_128_get(TCHash_HMAC_Tiger2_128* hmac, void* digest);
+void* tchash_hmac_tiger2_128(void* digest, const void* key, size_t klen, const void* data, size_t dlen);
+void* tchash_hmac_tiger2_128_keyed(void* digest, const TCHash_HMAC_Tiger2_128* keyed, const void* data, size_t dlen);
+void* tchash_hkdf_tiger2_128_extract(void* prk, const void* salt, size_t slen, const void* ikm, size_t ilen);
+void* tchash_hkdf_tiger2_128_expand(void* okm, size_t olen, const void* prk, size_t prklen, const void* info, size_t infolen);
+void* tchash_hkdf_tiger2_128(void* okm, size_t olen, const void* salt, size_t slen, const void* ikm, size_t ilen, const void* info, size_t infolen);
+
+TCHash_HMAC_RIPEMD128* tchash_hmac_ripemd128_init(TCHash_HMAC_RIPEMD128* hmac, const void* key, size_t klen);
+void tchash_hmac_ripemd128_process(TCHash_HMAC_RIPEMD128* hmac, const void* data, size_t dlen);
+void* tchash_hmac_ripemd128_get(TCHash_HMAC_RIPEMD128* hmac, void* digest);
+void* tchash_hmac_ripemd128(void* digest, const void* key, size_t klen, const void* data, size_t dlen);
+void* tchash_hmac_ripemd128_keyed(void* digest, const TCHash_HMAC_RIPEMD128* keyed, const void* data, size_t dlen);
+void* tchash_hkdf_ripemd128_extract(void* prk, const void* salt, size_t slen, const void* ikm, size_t ilen);
+void* tchash_hkdf_ripemd128_expand(void* okm, size_t olen, const void* prk, size_t prklen, const void* info, size_t infolen);
+void* tchash_hkdf_ripemd128(void* okm, size_t olen, const void* salt, size_t slen, const void* ikm, size_t ilen, const void* info, size_t infolen);
+
+TCHash_HMAC_RIPEMD160* tchash_hmac_ripemd160_init(TCHash_HMAC_RIPEMD160* hmac, const void* key, size_t klen);
+void tchash_hmac_ripemd160_process(TCHash_HMAC_RIPEMD160* hmac, const void* data, size_t dlen);
+void* tchash_hmac_ripemd160_get(TCHash_HMAC_RIPEMD160* hmac, void* digest);
+void* tchash_hmac_ripemd160(void* digest, const void* key, size_t klen, const void* data, size_t dlen);
+void* tchash_hmac_ripemd160_keyed(void* digest, const TCHash_HMAC_RIPEMD160* keyed, const void* data, size_t dlen);
+void* tchash_hkdf_ripemd160_extract(void* prk, const void* salt, size_t slen, const void* ikm, size_t ilen);
+void* tchash_hkdf_ripemd160_expand(void* okm, size_t olen, const void* prk, size_t prklen, const void* info, size_t infolen);
+void* tchash_hkdf_ripemd160(void* okm, size_t olen, const void* salt, size_t slen, const void* ikm, size_t ilen, const void* info, size_t infolen);
+
+TCHash_HMAC_RIPEMD256* tchash_hmac_ripemd256_init(TCHash_HMAC_RIPEMD256* hmac, const void* key, size_t klen);
+void tchash_hmac_ripemd256_process(TCHash_HMAC_RIPEMD256* hmac, const void* data, size_t dlen);
+void* tchash_hmac_ripemd256_get(TCHash_HMAC_RIPEMD256* hmac, void* digest);
+void* tchash_hmac_ripemd256(void* digest, const void* key, size_t klen, const void* data, size_t dlen);
+void* tchash_hmac_ripemd256_keyed(void* digest, const TCHash_HMAC_RIPEMD256* keyed, const void* data, size_t dlen);
+void* tchash_hkdf_ripemd256_extract(void* prk, const void* salt, size_t slen, const void* ikm, size_t ilen);
+void* tchash_hkdf_ripemd256_expand(void* okm, size_t olen, const void* prk, size_t prklen, const void* info, size_t infolen);
+void* tchash_hkdf_ripemd256(void* okm, size_t olen, const void* salt, size_t slen, const void* ikm, size_t ilen, const void* info, size_t infolen);
+
+TCHash_HMAC_RIPEMD320* tchash_hmac_ripemd320_init(TCHash_HMAC_RIPEMD320* hmac, const void* key, size_t klen);
+void tchash_hmac_ripemd320_process(TCHash_HMAC_RIPEMD320* hmac, const void* data, size_t dlen);
+void* tchash_hmac_ripemd320_get(TCHash_HMAC_RIPEMD320* hmac, void* digest);
+void* tchash_hmac_ripemd320(void* digest, const void* key, size_t klen, const void* data, size_t dlen);
+void* tchash_hmac_ripemd320_keyed(void* digest, const TCHash_HMAC_RIPEMD320* keyed, const void* data, size_t dlen);
+void* tchash_hkdf_ripemd320_extract(void* prk, const void* salt, size_t slen, const void* ikm, size_t ilen);
+void* tchash_hkdf_ripemd320_expand(void* okm, size_t olen, const void* prk, size_t prklen, const void* info, size_t infolen);
+void* tchash_hkdf_ripemd320(void* okm, size_t olen, const void* salt, size_t slen, const void* ikm, size_t ilen, const void* info, size_t infolen);
+
+TCHash_HMAC_SHA1* tchash_hmac_sha1_init(TCHash_HMAC_SHA1* hmac, const void* key, size_t klen);
+void tchash_hmac_sha1_process(TCHash_HMAC_SHA1* hmac, const void* data, size_t dlen);
+void* tchash_hmac_sha1_get(TCHash_HMAC_SHA1* hmac, void* digest);
+void* tchash_hmac_sha1(void* digest, const void* key, size_t klen, const void* data, size_t dlen);
+void* tchash_hmac_sha1_keyed(void* digest, const TCHash_HMAC_SHA1* keyed, const void* data, size_t dlen);
+void* tchash_hkdf_sha1_extract(void* prk, const void* salt, size_t slen, const void* ikm, size_t ilen);
+void* tchash_hkdf_sha1_expand(void* okm, size_t olen, const void* prk, size_t prklen, const void* info, size_t infolen);
+void* tchash_hkdf_sha1(void* okm, size_t olen, const void* salt, size_t slen, const void* ikm, size_t ilen, const void* info, size_t infolen);
+
+TCHash_HMAC_SHA2_224* tchash_hmac_sha2_224_init(TCHash_HMAC_SHA2_224* hmac, const void* key, size_t klen);
+void tchash_hmac_sha2_224_process(TCHash_HMAC_SHA2_224* hmac, const void* data, size_t dlen);
+void* tchash_hmac_sha2_224_get(TCHash_HMAC_SHA2_224* hmac, void* digest);
+void* tchash_hmac_sha2_224(void* digest, const void* key, size_t klen, const void* data, size_t dlen);
+void* tchash_hmac_sha2_224_keyed(void* digest, const TCHash_HMAC_SHA2_224* keyed, const void* data, size_t dlen);
+void* tchash_hkdf_sha2_224_extract(void* prk, const void* salt, size_t slen, const void* ikm, size_t ilen);
+void* tchash_hkdf_sha2_224_expand(void* okm, size_t olen, const void* prk, size_t prklen, const void* info, size_t infolen);
+void* tchash_hkdf_sha2_224(void* okm, size_t olen, const void* salt, size_t slen, const void* ikm, size_t ilen, const void* info, size_t infolen);
+
+TCHash_HMAC_SHA2_256* tchash_hmac_sha2_256_init(TCHash_HMAC_SHA2_256* hmac, const void* key, size_t klen);
+void tchash_hmac_sha2_256_process(TCHash_HMAC_SHA2_256* hmac, const void* data, size_t dlen);
+void* tchash_hmac_sha2_256_get(TCHash_HMAC_SHA2_256* hmac, void* digest);
+void* tchash_hmac_sha2_256(void* digest, const void* key, size_t klen, const void* data, size_t dlen);
+void* tchash_hmac_sha2_256_keyed(void* digest, const TCHash_HMAC_SHA2_256* keyed, const void* data, size_t dlen);
+void* tchash_hkdf_sha2_256_extract(void* prk, const void* salt, size_t slen, const void* ikm, size_t ilen);
+void* tchash_hkdf_sha2_256_expand(void* okm, size_t olen, const void* prk, size_t prklen, const void* info, size_t infolen);
+void* tchash_hkdf_sha2_256(void* okm, size_t olen, const void* salt, size_t slen, const void* ikm, size_t ilen, const void* info, size_t infolen);
+
+TCHash_HMAC_SHA2_384* tchash_hmac_sha2_384_init(TCHash_HMAC_SHA2_384* hmac, const void* key, size_t klen);
+void tchash_hmac_sha2_384_process(TCHash_HMAC_SHA2_384* hmac, const void* data, size_t dlen);
+void* tchash_hmac_sha2_384_get(TCHash_HMAC_SHA2_384* hmac, void* digest);
+void* tchash_hmac_sha2_384(void* digest, const void* key, size_t klen, const void* data, size_t dlen);
+void* tchash_hmac_sha2_384_keyed(void* digest, const TCHash_HMAC_SHA2_384* keyed, const void* data, size_t dlen);
+void* tchash_hkdf_sha2_384_extract(void* prk, const void* salt, size_t slen, const void* ikm, size_t ilen);
+void* tchash_hkdf_sha2_384_expand(void* okm, size_t olen, const void* prk, size_t prklen, const void* info, size_t infolen);
+void* tchash_hkdf_sha2_384(void* okm, size_t olen, const void* salt, size_t slen, const void* ikm, size_t ilen, const void* info, size_t infolen);
+
+TCHash_HMAC_SHA2_512* tchash_hmac_sha2_512_init(TCHash_HMAC_SHA2_512* hmac, const void* key, size_t klen);
+void tchash_hmac_sha2_512_process(TCHash_HMAC_SHA2_512* hmac, const void* data, size_t dlen);
+void* tchash_hmac_sha2_512_get(TCHash_HMAC_SHA2_512* hmac, void* digest);
+void* tchash_hmac_sha2_512(void* digest, const void* key, size_t klen, const void* data, size_t dlen);
+void* tchash_hmac_sha2_512_keyed(void* digest, const TCHash_HMAC_SHA2_512* keyed, const void* data, size_t dlen);
+void* tchash_hkdf_sha2_512_extract(void* prk, const void* salt, size_t slen, const void* ikm, size_t ilen);
+void* tchash_hkdf_sha2_512_expand(void* okm, size_t olen, const void* prk, size_t prklen, const void* info, size_t infolen);
+void* tchash_hkdf_sha2_512(void* okm, size_t olen, const void* salt, size_t slen, const void* ikm, size_t ilen, const void* info, size_t infolen);
+
+TCHash_HMAC_SHA2_512_224* tchash_hmac_sha2_512_224_init(TCHash_HMAC_SHA2_512_224* hmac, const void* key, size_t klen);
+void tchash_hmac_sha2_512_224_process(TCHash_HMAC_SHA2_512_224* hmac, const void* data, size_t dlen);
+void* tchash_hmac_sha2_512_224_get(TCHash_HMAC_SHA2_512_224* hmac, void* digest);
+void* tchash_hmac_sha2_512_224(void* digest, const void* key, size_t klen, const void* data, size_t dlen);
+void* tchash_hmac_sha2_512_224_keyed(void* digest, const TCHash_HMAC_SHA2_512_224* keyed, const void* data, size_t dlen);
+void* tchash_hkdf_sha2_512_224_extract(void* prk, const void* salt, size_t slen, const void* ikm, size_t ilen);
+void* tchash_hkdf_sha2_512_224_expand(void* okm, size_t olen, const void* prk, size_t prklen, const void* info, size_t infolen);
+void* tchash_hkdf_sha2_512_224(void* okm, size_t olen, const void* salt, size_t slen, const void* ikm, size_t ilen, const void* info, size_t infolen);
+
+TCHash_HMAC_SHA2_512_256* tchash_hmac_sha2_512_256_init(TCHash_HMAC_SHA2_512_256* hmac, const void* key, size_t klen);
+void tchash_hmac_sha2_512_256_process(TCHash_HMAC_SHA2_512_256* hmac, const void* data, size_t dlen);
+void* tchash_hmac_sha2_512_256_get(TCHash_HMAC_SHA2_512_256* hmac, void* digest);
+void* tchash_hmac_sha2_512_256(void* digest, const void* key, size_t klen, const void* data, size_t dlen);
+void* tchash_hmac_sha2_512_256_keyed(void* digest, const TCHash_HMAC_SHA2_512_256* keyed, const void* data, size_t dlen);
+void* tchash_hkdf_sha2_512_256_extract(void* prk, const void* salt, size_t slen, const void* ikm, size_t ilen);
+void* tchash_hkdf_sha2_512_256_expand(void* okm, size_t olen, const void* prk, size_t prklen, const void* info, size_t infolen);
+void* tchash_hkdf_sha2_512_256(void* okm, size_t olen, const void* salt, size_t slen, const void* ikm, size_t ilen, const void* info, size_t infolen);
+
+TCHash_HMAC_SHA3_224* tchash_hmac_sha3_224_init(TCHash_HMAC_SHA3_224* hmac, const void* key, size_t klen);
+void tchash_hmac_sha3_224_process(TCHash_HMAC_SHA3_224* hmac, const void* data, size_t dlen);
+void* tchash_hmac_sha3_224_get(TCHash_HMAC_SHA3_224* hmac, void* digest);
+void* tchash_hmac_sha3_224(void* digest, const void* key, size_t klen, const void* data, size_t dlen);
+void* tchash_hmac_sha3_224_keyed(void* digest, const TCHash_HMAC_SHA3_224* keyed, const void* data, size_t dlen);
+void* tchash_hkdf_sha3_224_extract(void* prk, const void* salt, size_t slen, const void* ikm, size_t ilen);
+void* tchash_hkdf_sha3_224_expand(void* okm, size_t olen, const void* prk, size_t prklen, const void* info, size_t infolen);
+void* tchash_hkdf_sha3_224(void* okm, size_t olen, const void* salt, size_t slen, const void* ikm, size_t ilen, const void* info, size_t infolen);
+
+TCHash_HMAC_SHA3_256* tchash_hmac_sha3_256_init(TCHash_HMAC_SHA3_256* hmac, const void* key, size_t klen);
+void tchash_hmac_sha3_256_process(TCHash_HMAC_SHA3_256* hmac, const void* data, size_t dlen);
+void* tchash_hmac_sha3_256_get(TCHash_HMAC_SHA3_256* hmac, void* digest);
+void* tchash_hmac_sha3_256(void* digest, const void* key, size_t klen, const void* data, size_t dlen);
+void* tchash_hmac_sha3_256_keyed(void* digest, const TCHash_HMAC_SHA3_256* keyed, const void* data, size_t dlen);
+void* tchash_hkdf_sha3_256_extract(void* prk, const void* salt, size_t slen, const void* ikm, size_t ilen);
+void* tchash_hkdf_sha3_256_expand(void* okm, size_t olen, const void* prk, size_t prklen, const void* info, size_t infolen);
+void* tchash_hkdf_sha3_256(void* okm, size_t olen, const void* salt, size_t slen, const void* ikm, size_t ilen, const void* info, size_t infolen);
+
+TCHash_HMAC_SHA3_384* tchash_hmac_sha3_384_init(TCHash_HMAC_SHA3_384* hmac, const void* key, size_t klen);
+void tchash_hmac_sha3_384_process(TCHash_HMAC_SHA3_384* hmac, const void* data, size_t dlen);
+void* tchash_hmac_sha3_384_get(TCHash_HMAC_SHA3_384* hmac, void* digest);
+void* tchash_hmac_sha3_384(void* digest, const void* key, size_t klen, const void* data, size_t dlen);
+void* tchash_hmac_sha3_384_keyed(void* digest, const TCHash_HMAC_SHA3_384* keyed, const void* data, size_t dlen);
+void* tchash_hkdf_sha3_384_extract(void* prk, const void* salt, size_t slen, const void* ikm, size_t ilen);
+void* tchash_hkdf_sha3_384_expand(void* okm, size_t olen, const void* prk, size_t prklen, const void* info, size_t infolen);
+void* tchash_hkdf_sha3_384(void* okm, size_t olen, const void* salt, size_t slen, const void* ikm, size_t ilen, const void* info, size_t infolen);
+
+TCHash_HMAC_SHA3_512* tchash_hmac_sha3_512_init(TCHash_HMAC_SHA3_512* hmac, const void* key, size_t klen);
+void tchash_hmac_sha3_512_process(TCHash_HMAC_SHA3_512* hmac, const void* data, size_t dlen);
+void* tchash_hmac_sha3_512_get(TCHash_HMAC_SHA3_512* hmac, void* digest);
+void* tchash_hmac_sha3_512(void* digest, const void* key, size_t klen, const void* data, size_t dlen);
+void* tchash_hmac_sha3_512_keyed(void* digest, const TCHash_HMAC_SHA3_512* keyed, const void* data, size_t dlen);
+void* tchash_hkdf_sha3_512_extract(void* prk, const void* salt, size_t slen, const void* ikm, size_t ilen);
+void* tchash_hkdf_sha3_512_expand(void* okm, size_t olen, const void* prk, size_t prklen, const void* info, size_t infolen);
+void* tchash_hkdf_sha3_512(void* okm, size_t olen, const void* salt, size_t slen, const void* ikm, size_t ilen, const void* info, size_t infolen);
+
+TCHash_HMAC_BLAKE2B* tchash_hmac_blake2b_init(TCHash_HMAC_BLAKE2B* hmac, const void* key, size_t klen);
+void tchash_hmac_blake2b_process(TCHash_HMAC_BLAKE2B* hmac, const void* data, size_t dlen);
+void* tchash_hmac_blake2b_get(TCHash_HMAC_BLAKE2B* hmac, void* digest);
+void* tchash_hmac_blake2b(void* digest, const void* key, size_t klen, const void* data, size_t dlen);
+void* tchash_hmac_blake2b_keyed(void* digest, const TCHash_HMAC_BLAKE2B* keyed, const void* data, size_t dlen);
+void* tchash_hkdf_blake2b_extract(void* prk, const void* salt, size_t slen, const void* ikm, size_t ilen);
+void* tchash_hkdf_blake2b_expand(void* okm, size_t olen, const void* prk, size_t prklen, const void* info, size_t infolen);
+void* tchash_hkdf_blake2b(void* okm, size_t olen, const void* salt, size_t slen, const void* ikm, size_t ilen, const void* info, size_t infolen);
+
+TCHash_HMAC_BLAKE2S* tchash_hmac_blake2s_init(TCHash_HMAC_BLAKE2S* hmac, const void* key, size_t klen);
+void tchash_hmac_blake2s_process(TCHash_HMAC_BLAKE2S* hmac, const void* data, size_t dlen);
+void* tchash_hmac_blake2s_get(TCHash_HMAC_BLAKE2S* hmac, void* digest);
+void* tchash_hmac_blake2s(void* digest, const void* key, size_t klen, const void* data, size_t dlen);
+void* tchash_hmac_blake2s_keyed(void* digest, const TCHash_HMAC_BLAKE2S* keyed, const void* data, size_t dlen);
+void* tchash_hkdf_blake2s_extract(void* prk, const void* salt, size_t slen, const void* ikm, size_t ilen);
+void* tchash_hkdf_blake2s_expand(void* okm, size_t olen, const void* prk, size_t prklen, const void* info, size_t infolen);
+void* tchash_hkdf_blake2s(void* okm, size_t olen, const void* salt, size_t slen, const void* ikm, size_t ilen, const void* info, size_t infolen);
+
 #ifdef __cplusplus
 }
 #endif
@@ -773,6 +1274,152 @@ static uint64_t tchash_i_rotr64(uint64_t x, int k)
     return (x >> k) | (x << (64-k));
 }
 
+/* hardware acceleration; see `tchash_accel_*()` */
+#ifndef TCHASH_NO_ACCEL
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define TCHASH_I_ACCEL_X86_
+#define TCHASH_I_TARGET_X86_(T) __attribute__((target(T)))
+#include <cpuid.h>
+#include <immintrin.h>
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#define TCHASH_I_ACCEL_X86_
+#define TCHASH_I_TARGET_X86_(T)
+#include <intrin.h>
+#include <immintrin.h>
+#elif (defined(__GNUC__) || defined(__clang__)) && defined(__aarch64__)
+#define TCHASH_I_ACCEL_ARM_
+#ifdef __clang__
+#define TCHASH_I_TARGET_ARM_CRYPTO_ __attribute__((target("crypto")))
+#define TCHASH_I_TARGET_ARM_SHA3_   __attribute__((target("sha3")))
+#else
+#define TCHASH_I_TARGET_ARM_CRYPTO_ __attribute__((target("+crypto")))
+#define TCHASH_I_TARGET_ARM_SHA3_   __attribute__((target("+sha3")))
+#endif
+#define TCHASH_I_ACCEL_ARM_SHA3_
+#include <arm_neon.h>
+#if defined(__linux__) || defined(__FreeBSD__)
+#include <sys/auxv.h>
+#elif defined(__APPLE__)
+#include <sys/sysctl.h>
+#endif
+#elif defined(_MSC_VER) && defined(_M_ARM64)
+#define TCHASH_I_ACCEL_ARM_
+#define TCHASH_I_TARGET_ARM_CRYPTO_
+#include <arm_neon.h>
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#endif
+#endif /* TCHASH_NO_ACCEL */
+
+#define TCHASH_I_ACCEL_UNINIT_  0x80000000u
+static unsigned int tchash_i_accel_ = TCHASH_I_ACCEL_UNINIT_;
+
+#ifdef TCHASH_I_ACCEL_X86_
+/* regs: {eax,ebx,ecx,edx}; returns 0 if the leaf is not available */
+static int tchash_i_cpuid_(uint32_t regs[4], uint32_t leaf, uint32_t subleaf)
+{
+#ifdef _MSC_VER
+    int iregs[4];
+    __cpuid(iregs, leaf & 0x80000000u);
+    if(TC__STATIC_CAST(uint32_t,iregs[0]) < leaf) return 0;
+    __cpuidex(iregs, leaf, subleaf);
+    regs[0] = iregs[0]; regs[1] = iregs[1]; regs[2] = iregs[2]; regs[3] = iregs[3];
+    return 1;
+#else
+    unsigned int a, b, c, d;
+    if(__get_cpuid_max(leaf & 0x80000000u, NULL) < leaf) return 0;
+    __cpuid_count(leaf, subleaf, a, b, c, d);
+    regs[0] = a; regs[1] = b; regs[2] = c; regs[3] = d;
+    return 1;
+#endif
+}
+/* only valid if CPUID.1:ECX[27] (OSXSAVE) is set */
+static uint64_t tchash_i_xgetbv_(uint32_t idx)
+{
+#ifdef _MSC_VER
+    return _xgetbv(idx);
+#else
+    uint32_t lo, hi;
+    __asm__ __volatile__("xgetbv" : "=a"(lo), "=d"(hi) : "c"(idx));
+    return (TC__STATIC_CAST(uint64_t,hi) << 32) | lo;
+#endif
+}
+#endif /* TCHASH_I_ACCEL_X86_ */
+unsigned int tchash_accel_get_supported(void)
+{
+    unsigned int accel = TCHASH_ACCEL_NONE;
+#if defined(TCHASH_I_ACCEL_X86_)
+    uint32_t r1[4], r7[4];
+    if(!tchash_i_cpuid_(r1, 1, 0)) return accel;
+    if(!tchash_i_cpuid_(r7, 7, 0)) r7[0] = r7[1] = r7[2] = r7[3] = 0;
+
+    /* SHA: CPUID.7.0:EBX[29]; our implementation also uses SSSE3 (CPUID.1:ECX[9]) and SSE4.1 (CPUID.1:ECX[19]) */
+    if((r7[1] & (UINT32_C(1) << 29)) && (r1[2] & (UINT32_C(1) << 9)) && (r1[2] & (UINT32_C(1) << 19)))
+        accel |= TCHASH_ACCEL_X86_SHA;
+    /* SSE2: CPUID.1:EDX[26] */
+    if(r1[3] & (UINT32_C(1) << 26))
+        accel |= TCHASH_ACCEL_X86_SSE2;
+    /* AVX2 & AVX-512 also require the OS to save the YMM (XCR0[2:1]) and ZMM (XCR0[7:5]) state */
+    if((r1[2] & (UINT32_C(1) << 27)) && (r1[2] & (UINT32_C(1) << 28)))
+    {
+        uint64_t xcr0 = tchash_i_xgetbv_(0);
+        /* AVX2: CPUID.7.0:EBX[5] */
+        if((xcr0 & 0x06) == 0x06 && (r7[1] & (UINT32_C(1) << 5)))
+            accel |= TCHASH_ACCEL_X86_AVX2;
+        /* AVX-512F: CPUID.7.0:EBX[16] */
+        if((xcr0 & 0xE6) == 0xE6 && (r7[1] & (UINT32_C(1) << 16)))
+            accel |= TCHASH_ACCEL_X86_AVX512;
+    }
+#elif defined(TCHASH_I_ACCEL_ARM_)
+    /* Advanced SIMD is mandatory on AArch64 */
+    accel |= TCHASH_ACCEL_ARM_NEON;
+#if defined(_WIN32)
+    if(IsProcessorFeaturePresent(PF_ARM_V8_CRYPTO_INSTRUCTIONS_AVAILABLE))
+        accel |= TCHASH_ACCEL_ARM_SHA1 | TCHASH_ACCEL_ARM_SHA2;
+#elif defined(__APPLE__)
+    /* every Apple ARM64 CPU has these; SHA3 needs a newer one */
+    accel |= TCHASH_ACCEL_ARM_SHA1 | TCHASH_ACCEL_ARM_SHA2;
+    {
+        int val = 0;
+        size_t len = sizeof(val);
+        if(!sysctlbyname("hw.optional.armv8_2_sha3", &val, &len, NULL, 0) && val)
+            accel |= TCHASH_ACCEL_ARM_SHA3;
+    }
+#elif defined(__linux__) || defined(__FreeBSD__)
+    unsigned long hwcap;
+#if defined(__linux__)
+    hwcap = getauxval(AT_HWCAP);
+#else
+    if(elf_aux_info(AT_HWCAP, &hwcap, sizeof(hwcap))) hwcap = 0;
+#endif
+    if(hwcap & (1ul << 5)) accel |= TCHASH_ACCEL_ARM_SHA1;  /* HWCAP_SHA1 */
+    if(hwcap & (1ul << 6)) accel |= TCHASH_ACCEL_ARM_SHA2;  /* HWCAP_SHA2 */
+    if(hwcap & (1ul << 17)) accel |= TCHASH_ACCEL_ARM_SHA3; /* HWCAP_SHA3 */
+#else
+    /* no way to query; trust the compiler flags */
+#if defined(__ARM_FEATURE_CRYPTO) || defined(__ARM_FEATURE_SHA2)
+    accel |= TCHASH_ACCEL_ARM_SHA1 | TCHASH_ACCEL_ARM_SHA2;
+#endif
+#if defined(__ARM_FEATURE_SHA3)
+    accel |= TCHASH_ACCEL_ARM_SHA3;
+#endif
+#endif
+#endif
+    return accel;
+}
+unsigned int tchash_accel_get(void)
+{
+    if(tchash_i_accel_ & TCHASH_I_ACCEL_UNINIT_)
+        tchash_i_accel_ = tchash_accel_get_supported();
+    return tchash_i_accel_;
+}
+unsigned int tchash_accel_set(unsigned int accel)
+{
+    return tchash_i_accel_ = accel & tchash_accel_get_supported() & ~TCHASH_I_ACCEL_UNINIT_;
+}
+
 #define TCHASH_I_PROCESS_BODY_(LHASH,UHASH,ENDIAN,SIZE,ADDTOTAL)               \
     const unsigned char* udata = TC__VOID_CAST(const unsigned char*,data);     \
     ADDTOTAL                                                                   \
@@ -1044,6 +1691,24 @@ TCHash_MD5* tchash_md5_init(TCHash_MD5* md5)
 
     return md5;
 }
+static const uint32_t tchash_i_md5_K[64] = {
+    UINT32_C(0xd76aa478), UINT32_C(0xe8c7b756), UINT32_C(0x242070db), UINT32_C(0xc1bdceee),
+    UINT32_C(0xf57c0faf), UINT32_C(0x4787c62a), UINT32_C(0xa8304613), UINT32_C(0xfd469501),
+    UINT32_C(0x698098d8), UINT32_C(0x8b44f7af), UINT32_C(0xffff5bb1), UINT32_C(0x895cd7be),
+    UINT32_C(0x6b901122), UINT32_C(0xfd987193), UINT32_C(0xa679438e), UINT32_C(0x49b40821),
+    UINT32_C(0xf61e2562), UINT32_C(0xc040b340), UINT32_C(0x265e5a51), UINT32_C(0xe9b6c7aa),
+    UINT32_C(0xd62f105d), UINT32_C(0x02441453), UINT32_C(0xd8a1e681), UINT32_C(0xe7d3fbc8),
+    UINT32_C(0x21e1cde6), UINT32_C(0xc33707d6), UINT32_C(0xf4d50d87), UINT32_C(0x455a14ed),
+    UINT32_C(0xa9e3e905), UINT32_C(0xfcefa3f8), UINT32_C(0x676f02d9), UINT32_C(0x8d2a4c8a),
+    UINT32_C(0xfffa3942), UINT32_C(0x8771f681), UINT32_C(0x6d9d6122), UINT32_C(0xfde5380c),
+    UINT32_C(0xa4beea44), UINT32_C(0x4bdecfa9), UINT32_C(0xf6bb4b60), UINT32_C(0xbebfbc70),
+    UINT32_C(0x289b7ec6), UINT32_C(0xeaa127fa), UINT32_C(0xd4ef3085), UINT32_C(0x04881d05),
+    UINT32_C(0xd9d4d039), UINT32_C(0xe6db99e5), UINT32_C(0x1fa27cf8), UINT32_C(0xc4ac5665),
+    UINT32_C(0xf4292244), UINT32_C(0x432aff97), UINT32_C(0xab9423a7), UINT32_C(0xfc93a039),
+    UINT32_C(0x655b59c3), UINT32_C(0x8f0ccc92), UINT32_C(0xffeff47d), UINT32_C(0x85845dd1),
+    UINT32_C(0x6fa87e4f), UINT32_C(0xfe2ce6e0), UINT32_C(0xa3014314), UINT32_C(0x4e0811a1),
+    UINT32_C(0xf7537e82), UINT32_C(0xbd3af235), UINT32_C(0x2ad7d2bb), UINT32_C(0xeb86d391),
+};
 static void tchash_i_md5_process_block(uint32_t h[4], const uint32_t M[16])
 {
     static const uint32_t s[] = {
@@ -1052,24 +1717,6 @@ static void tchash_i_md5_process_block(uint32_t h[4], const uint32_t M[16])
         4, 11, 16, 23,  4, 11, 16, 23,  4, 11, 16, 23,  4, 11, 16, 23,
         6, 10, 15, 21,  6, 10, 15, 21,  6, 10, 15, 21,  6, 10, 15, 21,
     };
-    static const uint32_t K[] = {
-        UINT32_C(0xd76aa478), UINT32_C(0xe8c7b756), UINT32_C(0x242070db), UINT32_C(0xc1bdceee),
-        UINT32_C(0xf57c0faf), UINT32_C(0x4787c62a), UINT32_C(0xa8304613), UINT32_C(0xfd469501),
-        UINT32_C(0x698098d8), UINT32_C(0x8b44f7af), UINT32_C(0xffff5bb1), UINT32_C(0x895cd7be),
-        UINT32_C(0x6b901122), UINT32_C(0xfd987193), UINT32_C(0xa679438e), UINT32_C(0x49b40821),
-        UINT32_C(0xf61e2562), UINT32_C(0xc040b340), UINT32_C(0x265e5a51), UINT32_C(0xe9b6c7aa),
-        UINT32_C(0xd62f105d), UINT32_C(0x02441453), UINT32_C(0xd8a1e681), UINT32_C(0xe7d3fbc8),
-        UINT32_C(0x21e1cde6), UINT32_C(0xc33707d6), UINT32_C(0xf4d50d87), UINT32_C(0x455a14ed),
-        UINT32_C(0xa9e3e905), UINT32_C(0xfcefa3f8), UINT32_C(0x676f02d9), UINT32_C(0x8d2a4c8a),
-        UINT32_C(0xfffa3942), UINT32_C(0x8771f681), UINT32_C(0x6d9d6122), UINT32_C(0xfde5380c),
-        UINT32_C(0xa4beea44), UINT32_C(0x4bdecfa9), UINT32_C(0xf6bb4b60), UINT32_C(0xbebfbc70),
-        UINT32_C(0x289b7ec6), UINT32_C(0xeaa127fa), UINT32_C(0xd4ef3085), UINT32_C(0x04881d05),
-        UINT32_C(0xd9d4d039), UINT32_C(0xe6db99e5), UINT32_C(0x1fa27cf8), UINT32_C(0xc4ac5665),
-        UINT32_C(0xf4292244), UINT32_C(0x432aff97), UINT32_C(0xab9423a7), UINT32_C(0xfc93a039),
-        UINT32_C(0x655b59c3), UINT32_C(0x8f0ccc92), UINT32_C(0xffeff47d), UINT32_C(0x85845dd1),
-        UINT32_C(0x6fa87e4f), UINT32_C(0xfe2ce6e0), UINT32_C(0xa3014314), UINT32_C(0x4e0811a1),
-        UINT32_C(0xf7537e82), UINT32_C(0xbd3af235), UINT32_C(0x2ad7d2bb), UINT32_C(0xeb86d391),
-    };
 
     uint32_t A = h[0];
     uint32_t B = h[1];
@@ -1101,7 +1748,7 @@ static void tchash_i_md5_process_block(uint32_t h[4], const uint32_t M[16])
             F = C ^ (B | ~D);
             g = (7*i) & 15;
         }
-        F += A + K[i] + M[g];
+        F += A + tchash_i_md5_K[i] + M[g];
         A = D;
         D = C;
         C = B;
@@ -1609,7 +2256,7 @@ TCHash_SHA1* tchash_sha1_init(TCHash_SHA1* sha1)
 
     return sha1;
 }
-static void tchash_i_sha1_process_block(uint32_t h[5], const uint32_t M[16])
+static void tchash_i_sha1_process_block_portable(uint32_t h[5], const uint32_t M[16])
 {
     uint32_t w[80];
     memcpy(w, M, 16 * sizeof(*M));
@@ -1661,6 +2308,118 @@ static void tchash_i_sha1_process_block(uint32_t h[5], const uint32_t M[16])
     h[3] += d;
     h[4] += e;
 }
+#ifdef TCHASH_I_ACCEL_X86_
+/* sha1msg1/xor/sha1msg2 yields the next 4 schedule words from the previous 16 */
+#define TCHASH_I_SHA1_X86_SCHEDULE_(W0,W1,W2,W3)   W0 = _mm_sha1msg2_epu32(_mm_xor_si128(_mm_sha1msg1_epu32(W0, W1), W2), W3)
+#define TCHASH_I_SHA1_X86_ROUNDS4_(F,W)                                        \
+    do {                                                                       \
+        E = _mm_sha1nexte_epu32(E, W);                                         \
+        ABCD_prev = ABCD;                                                      \
+        ABCD = _mm_sha1rnds4_epu32(ABCD, E, F);                                \
+        E = ABCD_prev;                                                         \
+    } while(0)
+TCHASH_I_TARGET_X86_("sha,sse4.1")
+static void tchash_i_sha1_process_block_x86sha(uint32_t h[5], const uint32_t M[16])
+{
+    /* the instructions expect the first word in the highest lane */
+    __m128i ABCD = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i*)&h[0]), 0x1B);
+    __m128i E0 = _mm_set_epi32(TC__STATIC_CAST(int,h[4]), 0, 0, 0);
+    __m128i ABCD_save = ABCD;
+
+    __m128i W0 = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i*)&M[ 0]), 0x1B);
+    __m128i W1 = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i*)&M[ 4]), 0x1B);
+    __m128i W2 = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i*)&M[ 8]), 0x1B);
+    __m128i W3 = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i*)&M[12]), 0x1B);
+    __m128i E, ABCD_prev;
+
+    /* rounds 0-3 take E directly (the others derive it from the previous ABCD) */
+    E = _mm_add_epi32(E0, W0);
+    ABCD_prev = ABCD;
+    ABCD = _mm_sha1rnds4_epu32(ABCD, E, 0);
+    E = ABCD_prev;
+
+    TCHASH_I_SHA1_X86_ROUNDS4_(0, W1);
+    TCHASH_I_SHA1_X86_ROUNDS4_(0, W2);
+    TCHASH_I_SHA1_X86_ROUNDS4_(0, W3);
+    TCHASH_I_SHA1_X86_SCHEDULE_(W0, W1, W2, W3); TCHASH_I_SHA1_X86_ROUNDS4_(0, W0);
+    TCHASH_I_SHA1_X86_SCHEDULE_(W1, W2, W3, W0); TCHASH_I_SHA1_X86_ROUNDS4_(1, W1);
+    TCHASH_I_SHA1_X86_SCHEDULE_(W2, W3, W0, W1); TCHASH_I_SHA1_X86_ROUNDS4_(1, W2);
+    TCHASH_I_SHA1_X86_SCHEDULE_(W3, W0, W1, W2); TCHASH_I_SHA1_X86_ROUNDS4_(1, W3);
+    TCHASH_I_SHA1_X86_SCHEDULE_(W0, W1, W2, W3); TCHASH_I_SHA1_X86_ROUNDS4_(1, W0);
+    TCHASH_I_SHA1_X86_SCHEDULE_(W1, W2, W3, W0); TCHASH_I_SHA1_X86_ROUNDS4_(1, W1);
+    TCHASH_I_SHA1_X86_SCHEDULE_(W2, W3, W0, W1); TCHASH_I_SHA1_X86_ROUNDS4_(2, W2);
+    TCHASH_I_SHA1_X86_SCHEDULE_(W3, W0, W1, W2); TCHASH_I_SHA1_X86_ROUNDS4_(2, W3);
+    TCHASH_I_SHA1_X86_SCHEDULE_(W0, W1, W2, W3); TCHASH_I_SHA1_X86_ROUNDS4_(2, W0);
+    TCHASH_I_SHA1_X86_SCHEDULE_(W1, W2, W3, W0); TCHASH_I_SHA1_X86_ROUNDS4_(2, W1);
+    TCHASH_I_SHA1_X86_SCHEDULE_(W2, W3, W0, W1); TCHASH_I_SHA1_X86_ROUNDS4_(2, W2);
+    TCHASH_I_SHA1_X86_SCHEDULE_(W3, W0, W1, W2); TCHASH_I_SHA1_X86_ROUNDS4_(3, W3);
+    TCHASH_I_SHA1_X86_SCHEDULE_(W0, W1, W2, W3); TCHASH_I_SHA1_X86_ROUNDS4_(3, W0);
+    TCHASH_I_SHA1_X86_SCHEDULE_(W1, W2, W3, W0); TCHASH_I_SHA1_X86_ROUNDS4_(3, W1);
+    TCHASH_I_SHA1_X86_SCHEDULE_(W2, W3, W0, W1); TCHASH_I_SHA1_X86_ROUNDS4_(3, W2);
+    TCHASH_I_SHA1_X86_SCHEDULE_(W3, W0, W1, W2); TCHASH_I_SHA1_X86_ROUNDS4_(3, W3);
+
+    E = _mm_sha1nexte_epu32(E, E0);
+    ABCD = _mm_add_epi32(ABCD, ABCD_save);
+
+    _mm_storeu_si128((__m128i*)&h[0], _mm_shuffle_epi32(ABCD, 0x1B));
+    h[4] = TC__STATIC_CAST(uint32_t,_mm_extract_epi32(E, 3));
+}
+#undef TCHASH_I_SHA1_X86_ROUNDS4_
+#undef TCHASH_I_SHA1_X86_SCHEDULE_
+#endif /* TCHASH_I_ACCEL_X86_ */
+#ifdef TCHASH_I_ACCEL_ARM_
+TCHASH_I_TARGET_ARM_CRYPTO_
+static void tchash_i_sha1_process_block_armsha(uint32_t h[5], const uint32_t M[16])
+{
+    uint32x4_t ABCD = vld1q_u32(&h[0]);
+    uint32_t E = h[4];
+    uint32x4_t ABCD_save = ABCD;
+    uint32_t E_save = E;
+
+    uint32x4_t W[4];
+    W[0] = vld1q_u32(&M[ 0]);
+    W[1] = vld1q_u32(&M[ 4]);
+    W[2] = vld1q_u32(&M[ 8]);
+    W[3] = vld1q_u32(&M[12]);
+
+    int i;
+    for(i = 0; i < 20; i++)
+    {
+        if(i >= 4)
+            W[i&3] = vsha1su1q_u32(vsha1su0q_u32(W[i&3], W[(i+1)&3], W[(i+2)&3]), W[(i+3)&3]);
+        uint32_t Enext = vsha1h_u32(vgetq_lane_u32(ABCD, 0));
+        if(i < 5)
+            ABCD = vsha1cq_u32(ABCD, E, vaddq_u32(W[i&3], vdupq_n_u32(UINT32_C(0x5A827999))));
+        else if(i < 10)
+            ABCD = vsha1pq_u32(ABCD, E, vaddq_u32(W[i&3], vdupq_n_u32(UINT32_C(0x6ED9EBA1))));
+        else if(i < 15)
+            ABCD = vsha1mq_u32(ABCD, E, vaddq_u32(W[i&3], vdupq_n_u32(UINT32_C(0x8F1BBCDC))));
+        else
+            ABCD = vsha1pq_u32(ABCD, E, vaddq_u32(W[i&3], vdupq_n_u32(UINT32_C(0xCA62C1D6))));
+        E = Enext;
+    }
+
+    vst1q_u32(&h[0], vaddq_u32(ABCD, ABCD_save));
+    h[4] = E + E_save;
+}
+#endif /* TCHASH_I_ACCEL_ARM_ */
+static void tchash_i_sha1_process_block(uint32_t h[5], const uint32_t M[16])
+{
+#if defined(TCHASH_I_ACCEL_X86_)
+    if(tchash_accel_get() & TCHASH_ACCEL_X86_SHA)
+    {
+        tchash_i_sha1_process_block_x86sha(h, M);
+        return;
+    }
+#elif defined(TCHASH_I_ACCEL_ARM_)
+    if(tchash_accel_get() & TCHASH_ACCEL_ARM_SHA1)
+    {
+        tchash_i_sha1_process_block_armsha(h, M);
+        return;
+    }
+#endif
+    tchash_i_sha1_process_block_portable(h, M);
+}
 void tchash_sha1_process(TCHash_SHA1* sha1, const void* data, size_t dlen)
 {
     TCHASH_I_PROCESS_BODY_(sha1,SHA1,be,32,{sha1->total += dlen;});
@@ -1684,18 +2443,18 @@ TCHash_SHA2_256* tchash_sha2_256_init(TCHash_SHA2_256* sha2)
 
     return sha2;
 }
-static void tchash_i_sha2_256_process_block(uint32_t H[8], const uint32_t M[16])
+static const uint32_t tchash_i_sha2_256_K[64] = {
+    UINT32_C(0x428a2f98), UINT32_C(0x71374491), UINT32_C(0xb5c0fbcf), UINT32_C(0xe9b5dba5), UINT32_C(0x3956c25b), UINT32_C(0x59f111f1), UINT32_C(0x923f82a4), UINT32_C(0xab1c5ed5),
+    UINT32_C(0xd807aa98), UINT32_C(0x12835b01), UINT32_C(0x243185be), UINT32_C(0x550c7dc3), UINT32_C(0x72be5d74), UINT32_C(0x80deb1fe), UINT32_C(0x9bdc06a7), UINT32_C(0xc19bf174),
+    UINT32_C(0xe49b69c1), UINT32_C(0xefbe4786), UINT32_C(0x0fc19dc6), UINT32_C(0x240ca1cc), UINT32_C(0x2de92c6f), UINT32_C(0x4a7484aa), UINT32_C(0x5cb0a9dc), UINT32_C(0x76f988da),
+    UINT32_C(0x983e5152), UINT32_C(0xa831c66d), UINT32_C(0xb00327c8), UINT32_C(0xbf597fc7), UINT32_C(0xc6e00bf3), UINT32_C(0xd5a79147), UINT32_C(0x06ca6351), UINT32_C(0x14292967),
+    UINT32_C(0x27b70a85), UINT32_C(0x2e1b2138), UINT32_C(0x4d2c6dfc), UINT32_C(0x53380d13), UINT32_C(0x650a7354), UINT32_C(0x766a0abb), UINT32_C(0x81c2c92e), UINT32_C(0x92722c85),
+    UINT32_C(0xa2bfe8a1), UINT32_C(0xa81a664b), UINT32_C(0xc24b8b70), UINT32_C(0xc76c51a3), UINT32_C(0xd192e819), UINT32_C(0xd6990624), UINT32_C(0xf40e3585), UINT32_C(0x106aa070),
+    UINT32_C(0x19a4c116), UINT32_C(0x1e376c08), UINT32_C(0x2748774c), UINT32_C(0x34b0bcb5), UINT32_C(0x391c0cb3), UINT32_C(0x4ed8aa4a), UINT32_C(0x5b9cca4f), UINT32_C(0x682e6ff3),
+    UINT32_C(0x748f82ee), UINT32_C(0x78a5636f), UINT32_C(0x84c87814), UINT32_C(0x8cc70208), UINT32_C(0x90befffa), UINT32_C(0xa4506ceb), UINT32_C(0xbef9a3f7), UINT32_C(0xc67178f2)
+};
+static void tchash_i_sha2_256_process_block_portable(uint32_t H[8], const uint32_t M[16])
 {
-    static const uint32_t k[] = {
-        UINT32_C(0x428a2f98), UINT32_C(0x71374491), UINT32_C(0xb5c0fbcf), UINT32_C(0xe9b5dba5), UINT32_C(0x3956c25b), UINT32_C(0x59f111f1), UINT32_C(0x923f82a4), UINT32_C(0xab1c5ed5),
-        UINT32_C(0xd807aa98), UINT32_C(0x12835b01), UINT32_C(0x243185be), UINT32_C(0x550c7dc3), UINT32_C(0x72be5d74), UINT32_C(0x80deb1fe), UINT32_C(0x9bdc06a7), UINT32_C(0xc19bf174),
-        UINT32_C(0xe49b69c1), UINT32_C(0xefbe4786), UINT32_C(0x0fc19dc6), UINT32_C(0x240ca1cc), UINT32_C(0x2de92c6f), UINT32_C(0x4a7484aa), UINT32_C(0x5cb0a9dc), UINT32_C(0x76f988da),
-        UINT32_C(0x983e5152), UINT32_C(0xa831c66d), UINT32_C(0xb00327c8), UINT32_C(0xbf597fc7), UINT32_C(0xc6e00bf3), UINT32_C(0xd5a79147), UINT32_C(0x06ca6351), UINT32_C(0x14292967),
-        UINT32_C(0x27b70a85), UINT32_C(0x2e1b2138), UINT32_C(0x4d2c6dfc), UINT32_C(0x53380d13), UINT32_C(0x650a7354), UINT32_C(0x766a0abb), UINT32_C(0x81c2c92e), UINT32_C(0x92722c85),
-        UINT32_C(0xa2bfe8a1), UINT32_C(0xa81a664b), UINT32_C(0xc24b8b70), UINT32_C(0xc76c51a3), UINT32_C(0xd192e819), UINT32_C(0xd6990624), UINT32_C(0xf40e3585), UINT32_C(0x106aa070),
-        UINT32_C(0x19a4c116), UINT32_C(0x1e376c08), UINT32_C(0x2748774c), UINT32_C(0x34b0bcb5), UINT32_C(0x391c0cb3), UINT32_C(0x4ed8aa4a), UINT32_C(0x5b9cca4f), UINT32_C(0x682e6ff3),
-        UINT32_C(0x748f82ee), UINT32_C(0x78a5636f), UINT32_C(0x84c87814), UINT32_C(0x8cc70208), UINT32_C(0x90befffa), UINT32_C(0xa4506ceb), UINT32_C(0xbef9a3f7), UINT32_C(0xc67178f2)
-    };
 
     uint32_t w[64];
     memcpy(w, M, 16 * sizeof(*M));
@@ -1714,7 +2473,7 @@ static void tchash_i_sha2_256_process_block(uint32_t H[8], const uint32_t M[16])
     {
         uint32_t S1 = tchash_i_rotr32(e, 6) ^ tchash_i_rotr32(e, 11) ^ tchash_i_rotr32(e, 25);
         uint32_t ch = (e & f) ^ (~e & g);
-        uint32_t temp1 = h + S1 + ch + k[i] + w[i];
+        uint32_t temp1 = h + S1 + ch + tchash_i_sha2_256_K[i] + w[i];
         uint32_t S0 = tchash_i_rotr32(a, 2) ^ tchash_i_rotr32(a, 13) ^ tchash_i_rotr32(a, 22);
         uint32_t maj = (a & b) ^ (a & c) ^ (b & c);
         uint32_t temp2 = S0 + maj;
@@ -1738,6 +2497,101 @@ static void tchash_i_sha2_256_process_block(uint32_t H[8], const uint32_t M[16])
     H[6] += g;
     H[7] += h;
 }
+#ifdef TCHASH_I_ACCEL_X86_
+/* sha256msg1/alignr/sha256msg2 yields the next 4 schedule words from the previous 16 */
+#define TCHASH_I_SHA2_256_X86_SCHEDULE_(W0,W1,W2,W3)   W0 = _mm_sha256msg2_epu32(_mm_add_epi32(_mm_sha256msg1_epu32(W0, W1), _mm_alignr_epi8(W3, W2, 4)), W3)
+#define TCHASH_I_SHA2_256_X86_ROUNDS4_(I,W)                                                \
+    do {                                                                                   \
+        MSG = _mm_add_epi32(W, _mm_loadu_si128((const __m128i*)&tchash_i_sha2_256_K[I]));  \
+        STATE1 = _mm_sha256rnds2_epu32(STATE1, STATE0, MSG);                               \
+        STATE0 = _mm_sha256rnds2_epu32(STATE0, STATE1, _mm_shuffle_epi32(MSG, 0x0E));      \
+    } while(0)
+TCHASH_I_TARGET_X86_("sha,sse4.1")
+static void tchash_i_sha2_256_process_block_x86sha(uint32_t H[8], const uint32_t M[16])
+{
+    /* the instructions operate on the state as {ABEF, CDGH} */
+    __m128i TMP = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i*)&H[0]), 0xB1);
+    __m128i STATE1 = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i*)&H[4]), 0x1B);
+    __m128i STATE0 = _mm_alignr_epi8(TMP, STATE1, 8);
+    STATE1 = _mm_blend_epi16(STATE1, TMP, 0xF0);
+    __m128i STATE0_save = STATE0, STATE1_save = STATE1;
+
+    __m128i W0 = _mm_loadu_si128((const __m128i*)&M[ 0]);
+    __m128i W1 = _mm_loadu_si128((const __m128i*)&M[ 4]);
+    __m128i W2 = _mm_loadu_si128((const __m128i*)&M[ 8]);
+    __m128i W3 = _mm_loadu_si128((const __m128i*)&M[12]);
+    __m128i MSG;
+
+    TCHASH_I_SHA2_256_X86_ROUNDS4_( 0, W0);
+    TCHASH_I_SHA2_256_X86_ROUNDS4_( 4, W1);
+    TCHASH_I_SHA2_256_X86_ROUNDS4_( 8, W2);
+    TCHASH_I_SHA2_256_X86_ROUNDS4_(12, W3);
+    int i;
+    for(i = 16; i < 64; i += 16)
+    {
+        TCHASH_I_SHA2_256_X86_SCHEDULE_(W0, W1, W2, W3); TCHASH_I_SHA2_256_X86_ROUNDS4_(i +  0, W0);
+        TCHASH_I_SHA2_256_X86_SCHEDULE_(W1, W2, W3, W0); TCHASH_I_SHA2_256_X86_ROUNDS4_(i +  4, W1);
+        TCHASH_I_SHA2_256_X86_SCHEDULE_(W2, W3, W0, W1); TCHASH_I_SHA2_256_X86_ROUNDS4_(i +  8, W2);
+        TCHASH_I_SHA2_256_X86_SCHEDULE_(W3, W0, W1, W2); TCHASH_I_SHA2_256_X86_ROUNDS4_(i + 12, W3);
+    }
+
+    STATE0 = _mm_add_epi32(STATE0, STATE0_save);
+    STATE1 = _mm_add_epi32(STATE1, STATE1_save);
+
+    TMP = _mm_shuffle_epi32(STATE0, 0x1B);
+    STATE1 = _mm_shuffle_epi32(STATE1, 0xB1);
+    _mm_storeu_si128((__m128i*)&H[0], _mm_blend_epi16(TMP, STATE1, 0xF0));
+    _mm_storeu_si128((__m128i*)&H[4], _mm_alignr_epi8(STATE1, TMP, 8));
+}
+#undef TCHASH_I_SHA2_256_X86_ROUNDS4_
+#undef TCHASH_I_SHA2_256_X86_SCHEDULE_
+#endif /* TCHASH_I_ACCEL_X86_ */
+#ifdef TCHASH_I_ACCEL_ARM_
+TCHASH_I_TARGET_ARM_CRYPTO_
+static void tchash_i_sha2_256_process_block_armsha(uint32_t H[8], const uint32_t M[16])
+{
+    uint32x4_t S0 = vld1q_u32(&H[0]);
+    uint32x4_t S1 = vld1q_u32(&H[4]);
+    uint32x4_t S0_save = S0, S1_save = S1;
+
+    uint32x4_t W[4];
+    W[0] = vld1q_u32(&M[ 0]);
+    W[1] = vld1q_u32(&M[ 4]);
+    W[2] = vld1q_u32(&M[ 8]);
+    W[3] = vld1q_u32(&M[12]);
+
+    int i;
+    for(i = 0; i < 16; i++)
+    {
+        if(i >= 4)
+            W[i&3] = vsha256su1q_u32(vsha256su0q_u32(W[i&3], W[(i+1)&3]), W[(i+2)&3], W[(i+3)&3]);
+        uint32x4_t WK = vaddq_u32(W[i&3], vld1q_u32(&tchash_i_sha2_256_K[4*i]));
+        uint32x4_t S0_prev = S0;
+        S0 = vsha256hq_u32(S0, S1, WK);
+        S1 = vsha256h2q_u32(S1, S0_prev, WK);
+    }
+
+    vst1q_u32(&H[0], vaddq_u32(S0, S0_save));
+    vst1q_u32(&H[4], vaddq_u32(S1, S1_save));
+}
+#endif /* TCHASH_I_ACCEL_ARM_ */
+static void tchash_i_sha2_256_process_block(uint32_t H[8], const uint32_t M[16])
+{
+#if defined(TCHASH_I_ACCEL_X86_)
+    if(tchash_accel_get() & TCHASH_ACCEL_X86_SHA)
+    {
+        tchash_i_sha2_256_process_block_x86sha(H, M);
+        return;
+    }
+#elif defined(TCHASH_I_ACCEL_ARM_)
+    if(tchash_accel_get() & TCHASH_ACCEL_ARM_SHA2)
+    {
+        tchash_i_sha2_256_process_block_armsha(H, M);
+        return;
+    }
+#endif
+    tchash_i_sha2_256_process_block_portable(H, M);
+}
 void tchash_sha2_256_process(TCHash_SHA2_256* sha2_256, const void* data, size_t dlen)
 {
     TCHASH_I_PROCESS_BODY_(sha2_256,SHA2_256,be,32,{sha2_256->total += dlen;});
@@ -1960,77 +2814,127 @@ static uint64_t tchash_i_keccak_p1600_rc(int ir, int l)
         RC |= (uint64_t)tchash_i_keccak_p1600_rc_bit(j + 7 * ir) << ((1 << j) - 1);
     return RC;
 }*/
-#define A_(A,x,y)  (A)[(y)*5+(x)]
+static const uint64_t tchash_i_keccak_p1600_RC[12 + 2 * TCHASH_I_KECCAK1600_L] = {
+    UINT64_C(0x0000000000000001),UINT64_C(0x0000000000008082),UINT64_C(0x800000000000808A),UINT64_C(0x8000000080008000),
+    UINT64_C(0x000000000000808B),UINT64_C(0x0000000080000001),UINT64_C(0x8000000080008081),UINT64_C(0x8000000000008009),
+    UINT64_C(0x000000000000008A),UINT64_C(0x0000000000000088),UINT64_C(0x0000000080008009),UINT64_C(0x000000008000000A),
+    UINT64_C(0x000000008000808B),UINT64_C(0x800000000000008B),UINT64_C(0x8000000000008089),UINT64_C(0x8000000000008003),
+    UINT64_C(0x8000000000008002),UINT64_C(0x8000000000000080),UINT64_C(0x000000000000800A),UINT64_C(0x800000008000000A),
+    UINT64_C(0x8000000080008081),UINT64_C(0x8000000000008080),UINT64_C(0x0000000080000001),UINT64_C(0x8000000080008008),
+};
 // http://nvlpubs.nist.gov/nistpubs/FIPS/NIST.FIPS.202.pdf
+/*
+ * Fully unrolled, with 2 rounds per iteration (alternating between the `A` and
+ * `E` lanes, so that no copies are required), and with "lane complementing":
+ * lanes 1, 2, 8, 12, 17 & 20 are stored inverted, which lets chi get away with
+ * 1 NOT per row (instead of 1 per lane). See "Keccak implementation overview"
+ * (http://keccak.team/files/Keccak-implementation-3.2.pdf).
+ */
+#define TCHASH_I_KECCAK_ROUND_(A,E,RC)                                         \
+    do {                                                                       \
+        uint64_t C0 = A##00 ^ A##05 ^ A##10 ^ A##15 ^ A##20;                   \
+        uint64_t C1 = A##01 ^ A##06 ^ A##11 ^ A##16 ^ A##21;                   \
+        uint64_t C2 = A##02 ^ A##07 ^ A##12 ^ A##17 ^ A##22;                   \
+        uint64_t C3 = A##03 ^ A##08 ^ A##13 ^ A##18 ^ A##23;                   \
+        uint64_t C4 = A##04 ^ A##09 ^ A##14 ^ A##19 ^ A##24;                   \
+        uint64_t D0 = C4 ^ tchash_i_rotl64(C1, 1);                             \
+        uint64_t D1 = C0 ^ tchash_i_rotl64(C2, 1);                             \
+        uint64_t D2 = C1 ^ tchash_i_rotl64(C3, 1);                             \
+        uint64_t D3 = C2 ^ tchash_i_rotl64(C4, 1);                             \
+        uint64_t D4 = C3 ^ tchash_i_rotl64(C0, 1);                             \
+        uint64_t B0, B1, B2, B3, B4;                                           \
+        B0 = A##00 ^ D0;                                                       \
+        B1 = tchash_i_rotl64(A##06 ^ D1, 44);                                  \
+        B2 = tchash_i_rotl64(A##12 ^ D2, 43);                                  \
+        B3 = tchash_i_rotl64(A##18 ^ D3, 21);                                  \
+        B4 = tchash_i_rotl64(A##24 ^ D4, 14);                                  \
+        E##00 = B0 ^ (B1 | B2) ^ (RC);                                         \
+        E##01 = B1 ^ (~B2 | B3);                                               \
+        E##02 = B2 ^ (B3 & B4);                                                \
+        E##03 = B3 ^ (B4 | B0);                                                \
+        E##04 = B4 ^ (B0 & B1);                                                \
+        B0 = tchash_i_rotl64(A##03 ^ D3, 28);                                  \
+        B1 = tchash_i_rotl64(A##09 ^ D4, 20);                                  \
+        B2 = tchash_i_rotl64(A##10 ^ D0, 3);                                   \
+        B3 = tchash_i_rotl64(A##16 ^ D1, 45);                                  \
+        B4 = tchash_i_rotl64(A##22 ^ D2, 61);                                  \
+        E##05 = B0 ^ (B1 | B2);                                                \
+        E##06 = B1 ^ (B2 & B3);                                                \
+        E##07 = B2 ^ (B3 | ~B4);                                               \
+        E##08 = B3 ^ (B4 | B0);                                                \
+        E##09 = B4 ^ (B0 & B1);                                                \
+        B0 = tchash_i_rotl64(A##01 ^ D1, 1);                                   \
+        B1 = tchash_i_rotl64(A##07 ^ D2, 6);                                   \
+        B2 = tchash_i_rotl64(A##13 ^ D3, 25);                                  \
+        B3 = tchash_i_rotl64(A##19 ^ D4, 8);                                   \
+        B4 = tchash_i_rotl64(A##20 ^ D0, 18);                                  \
+        E##10 = B0 ^ (B1 | B2);                                                \
+        E##11 = B1 ^ (B2 & B3);                                                \
+        E##12 = B2 ^ (~B3 & B4);                                               \
+        E##13 = B3 ^ ~(B4 | B0);                                               \
+        E##14 = B4 ^ (B0 & B1);                                                \
+        B0 = tchash_i_rotl64(A##04 ^ D4, 27);                                  \
+        B1 = tchash_i_rotl64(A##05 ^ D0, 36);                                  \
+        B2 = tchash_i_rotl64(A##11 ^ D1, 10);                                  \
+        B3 = tchash_i_rotl64(A##17 ^ D2, 15);                                  \
+        B4 = tchash_i_rotl64(A##23 ^ D3, 56);                                  \
+        E##15 = B0 ^ (B1 & B2);                                                \
+        E##16 = B1 ^ (B2 | B3);                                                \
+        E##17 = B2 ^ (~B3 | B4);                                               \
+        E##18 = B3 ^ ~(B4 & B0);                                               \
+        E##19 = B4 ^ (B0 | B1);                                                \
+        B0 = tchash_i_rotl64(A##02 ^ D2, 62);                                  \
+        B1 = tchash_i_rotl64(A##08 ^ D3, 55);                                  \
+        B2 = tchash_i_rotl64(A##14 ^ D4, 39);                                  \
+        B3 = tchash_i_rotl64(A##15 ^ D0, 41);                                  \
+        B4 = tchash_i_rotl64(A##21 ^ D1, 2);                                   \
+        E##20 = B0 ^ (~B1 & B2);                                               \
+        E##21 = B1 ^ ~(B2 | B3);                                               \
+        E##22 = B2 ^ (B3 & B4);                                                \
+        E##23 = B3 ^ (B4 | B0);                                                \
+        E##24 = B4 ^ (B0 & B1);                                                \
+    } while(0)
+#define TCHASH_I_KECCAK_COPY_(A,E)                                             \
+    do {                                                                     \
+        A##00 = E##00; A##01 = E##01; A##02 = E##02; A##03 = E##03; A##04 = E##04;\
+        A##05 = E##05; A##06 = E##06; A##07 = E##07; A##08 = E##08; A##09 = E##09;\
+        A##10 = E##10; A##11 = E##11; A##12 = E##12; A##13 = E##13; A##14 = E##14;\
+        A##15 = E##15; A##16 = E##16; A##17 = E##17; A##18 = E##18; A##19 = E##19;\
+        A##20 = E##20; A##21 = E##21; A##22 = E##22; A##23 = E##23; A##24 = E##24;\
+    } while(0)
 static void tchash_i_keccak_p1600(uint64_t A[25], int nrounds)
 {
-    static const uint64_t RC[12 + 2 * TCHASH_I_KECCAK1600_L] = {
-        UINT64_C(0x0000000000000001),UINT64_C(0x0000000000008082),UINT64_C(0x800000000000808A),UINT64_C(0x8000000080008000),
-        UINT64_C(0x000000000000808B),UINT64_C(0x0000000080000001),UINT64_C(0x8000000080008081),UINT64_C(0x8000000000008009),
-        UINT64_C(0x000000000000008A),UINT64_C(0x0000000000000088),UINT64_C(0x0000000080008009),UINT64_C(0x000000008000000A),
-        UINT64_C(0x000000008000808B),UINT64_C(0x800000000000008B),UINT64_C(0x8000000000008089),UINT64_C(0x8000000000008003),
-        UINT64_C(0x8000000000008002),UINT64_C(0x8000000000000080),UINT64_C(0x000000000000800A),UINT64_C(0x800000008000000A),
-        UINT64_C(0x8000000080008081),UINT64_C(0x8000000000008080),UINT64_C(0x0000000080000001),UINT64_C(0x8000000080008008),
-    };
     if(nrounds < 0) nrounds = 12 + 2 * TCHASH_I_KECCAK1600_L;
 
-    uint64_t C[5];
-    uint64_t tmpA[25];
-    uint64_t* newA[2];
-    int curA = 0;
-
-    newA[!curA] = A;
-    newA[curA] = tmpA;
+    uint64_t A00 = A[ 0], A01 = ~A[ 1], A02 = ~A[ 2], A03 = A[ 3], A04 = A[ 4];
+    uint64_t A05 = A[ 5], A06 = A[ 6], A07 = A[ 7], A08 = ~A[ 8], A09 = A[ 9];
+    uint64_t A10 = A[10], A11 = A[11], A12 = ~A[12], A13 = A[13], A14 = A[14];
+    uint64_t A15 = A[15], A16 = A[16], A17 = ~A[17], A18 = A[18], A19 = A[19];
+    uint64_t A20 = ~A[20], A21 = A[21], A22 = A[22], A23 = A[23], A24 = A[24];
+    uint64_t E00, E01, E02, E03, E04, E05, E06, E07, E08, E09, E10, E11, E12;
+    uint64_t E13, E14, E15, E16, E17, E18, E19, E20, E21, E22, E23, E24;
 
-    int ir;
-    for(ir = 12 + 2 * TCHASH_I_KECCAK1600_L - nrounds; ir < 12 + 2 * TCHASH_I_KECCAK1600_L; ir++)
+    int ir = 12 + 2 * TCHASH_I_KECCAK1600_L - nrounds;
+    if(nrounds & 1)
     {
-        int x, y, t;
-
-        /* 1: theta(A)  */
-        for(x = 0; x < 5; x++)
-            C[x] = A_(newA[!curA],x,0) ^ A_(newA[!curA],x,1) ^ A_(newA[!curA],x,2) ^ A_(newA[!curA],x,3) ^ A_(newA[!curA],x,4);
-        for(x = 0; x < 5; x++)
-        {
-            uint64_t Dx = C[(x+5-1)%5] ^ tchash_i_rotl64(C[(x+1)%5], 1);
-            for(y = 0; y < 5; y++)
-                A_(newA[curA],x,y) = A_(newA[!curA],x,y) ^ Dx;
-        }
-        curA = !curA;
-
-        /* 2: rho(A)    */
-        newA[curA][0] = newA[!curA][0];
-        x = 1; y = 0;
-        for(t = 0; t < 24; t++)
-        {
-            A_(newA[curA],x,y) = tchash_i_rotl64(A_(newA[!curA],x,y), (t+1)*(t+2)/2);
-            int nx = y;
-            y = (2*x+3*y) % 5;
-            x = nx;
-        }
-        curA = !curA;
-
-        /* 3: pi(A)     */
-        for(x = 0; x < 5; x++)
-            for(y = 0; y < 5; y++)
-                //A_(newA[curA],(2*y+3*x)%5,x) = A_(newA[!curA],x,y);//WP
-                A_(newA[curA],x,y) = A_(newA[!curA],(x+3*y)%5,x);
-        curA = !curA;
-
-        /* 4: chi(A)    */
-        for(x = 0; x < 5; x++)
-            for(y = 0; y < 5; y++)
-                A_(newA[curA],x,y) = A_(newA[!curA],x,y) ^ (~A_(newA[!curA],(x+1)%5,y) & A_(newA[!curA],(x+2)%5,y));
-        curA = !curA;
-
-        /* 6: iota(a,ri)*/
-        newA[!curA][0] ^= RC[ir];
-        /* do *not* flip curA here */
+        TCHASH_I_KECCAK_ROUND_(A,E,tchash_i_keccak_p1600_RC[ir]);
+        TCHASH_I_KECCAK_COPY_(A,E);
+        ir++;
+    }
+    for(; ir < 12 + 2 * TCHASH_I_KECCAK1600_L; ir += 2)
+    {
+        TCHASH_I_KECCAK_ROUND_(A,E,tchash_i_keccak_p1600_RC[ir]);
+        TCHASH_I_KECCAK_ROUND_(E,A,tchash_i_keccak_p1600_RC[ir + 1]);
     }
-    if(newA[!curA] != A)
-        memcpy(A, newA[!curA], sizeof(tmpA));
+
+    A[ 0] = A00; A[ 1] = ~A01; A[ 2] = ~A02; A[ 3] = A03; A[ 4] = A04;
+    A[ 5] = A05; A[ 6] = A06; A[ 7] = A07; A[ 8] = ~A08; A[ 9] = A09;
+    A[10] = A10; A[11] = A11; A[12] = ~A12; A[13] = A13; A[14] = A14;
+    A[15] = A15; A[16] = A16; A[17] = ~A17; A[18] = A18; A[19] = A19;
+    A[20] = ~A20; A[21] = A21; A[22] = A22; A[23] = A23; A[24] = A24;
 }
-#undef A_
+#undef TCHASH_I_KECCAK_COPY_
+#undef TCHASH_I_KECCAK_ROUND_
 static void tchash_i_keccak1600_process_block(uint64_t h[25], const uint64_t* M, size_t bsize, int nrounds)
 {
     size_t i;
@@ -2212,4 +3116,1491 @@ void* tchash_shake256_get(TCHash_SHAKE256* shake256, void* digest, size_t digest
 }
 void* tchash_shake256(void* digest, size_t digestlen, const void* data, size_t dlen) { TCHASH_I_SIMPLELEN_BODY_(shake256,SHAKE256) }
 
+
+
+static const uint64_t tchash_i_blake2b_IV[8] = {
+    UINT64_C(0x6a09e667f3bcc908), UINT64_C(0xbb67ae8584caa73b), UINT64_C(0x3c6ef372fe94f82b), UINT64_C(0xa54ff53a5f1d36f1),
+    UINT64_C(0x510e527fade682d1), UINT64_C(0x9b05688c2b3e6c1f), UINT64_C(0x1f83d9abfb41bd6b), UINT64_C(0x5be0cd19137e2179),
+};
+static const uint32_t tchash_i_blake2s_IV[8] = {
+    UINT32_C(0x6a09e667), UINT32_C(0xbb67ae85), UINT32_C(0x3c6ef372), UINT32_C(0xa54ff53a),
+    UINT32_C(0x510e527f), UINT32_C(0x9b05688c), UINT32_C(0x1f83d9ab), UINT32_C(0x5be0cd19),
+};
+static const unsigned char tchash_i_blake2_sigma[10][16] = {
+    {  0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15 },
+    { 14, 10,  4,  8,  9, 15, 13,  6,  1, 12,  0,  2, 11,  7,  5,  3 },
+    { 11,  8, 12,  0,  5,  2, 15, 13, 10, 14,  3,  6,  7,  1,  9,  4 },
+    {  7,  9,  3,  1, 13, 12, 11, 14,  2,  6,  5, 10,  4,  0, 15,  8 },
+    {  9,  0,  5,  7,  2,  4, 10, 15, 14,  1, 11, 12,  6,  8,  3, 13 },
+    {  2, 12,  6, 10,  0, 11,  8,  3,  4, 13,  7,  5, 15, 14,  1,  9 },
+    { 12,  5,  1, 15, 14, 13,  4, 10,  0,  7,  6,  3,  9,  2,  8, 11 },
+    { 13, 11,  7, 14, 12,  1,  3,  9,  5,  0, 15,  4,  8,  6,  2, 10 },
+    {  6, 15, 14,  9, 11,  3,  0,  8, 12,  2, 13,  7,  1,  4, 10,  5 },
+    { 10,  2,  8,  4,  7,  6,  1,  5, 15, 11,  9, 14,  3, 12, 13,  0 },
+};
+#define TCHASH_I_BLAKE2_G_(ROTR,R1,R2,R3,R4,v,a,b,c,d,x,y)                     \
+    do {                                                                       \
+        v[a] = v[a] + v[b] + (x); v[d] = ROTR(v[d] ^ v[a], R1);                \
+        v[c] = v[c] + v[d];       v[b] = ROTR(v[b] ^ v[c], R2);                \
+        v[a] = v[a] + v[b] + (y); v[d] = ROTR(v[d] ^ v[a], R3);                \
+        v[c] = v[c] + v[d];       v[b] = ROTR(v[b] ^ v[c], R4);                \
+    } while(0)
+/* both variants share the structure, and only differ in word size, rotations & number of rounds */
+#define TCHASH_I_BLAKE2_COMPRESS_BODY_(ROTR,R1,R2,R3,R4,NROUNDS,IV)            \
+    v[ 0] = h[0]; v[ 1] = h[1]; v[ 2] = h[2]; v[ 3] = h[3];                    \
+    v[ 4] = h[4]; v[ 5] = h[5]; v[ 6] = h[6]; v[ 7] = h[7];                    \
+    v[ 8] = IV[0]; v[ 9] = IV[1]; v[10] = IV[2]; v[11] = IV[3];                \
+    v[12] = IV[4] ^ t[0]; v[13] = IV[5] ^ t[1];                                \
+    v[14] = last ? ~IV[6] : IV[6]; v[15] = IV[7];                              \
+    int r;                                                                     \
+    for(r = 0; r < (NROUNDS); r++)                                             \
+    {                                                                          \
+        const unsigned char* s = tchash_i_blake2_sigma[r % 10];                \
+        TCHASH_I_BLAKE2_G_(ROTR,R1,R2,R3,R4,v, 0, 4, 8,12,M[s[ 0]],M[s[ 1]]);  \
+        TCHASH_I_BLAKE2_G_(ROTR,R1,R2,R3,R4,v, 1, 5, 9,13,M[s[ 2]],M[s[ 3]]);  \
+        TCHASH_I_BLAKE2_G_(ROTR,R1,R2,R3,R4,v, 2, 6,10,14,M[s[ 4]],M[s[ 5]]);  \
+        TCHASH_I_BLAKE2_G_(ROTR,R1,R2,R3,R4,v, 3, 7,11,15,M[s[ 6]],M[s[ 7]]);  \
+        TCHASH_I_BLAKE2_G_(ROTR,R1,R2,R3,R4,v, 0, 5,10,15,M[s[ 8]],M[s[ 9]]);  \
+        TCHASH_I_BLAKE2_G_(ROTR,R1,R2,R3,R4,v, 1, 6,11,12,M[s[10]],M[s[11]]);  \
+        TCHASH_I_BLAKE2_G_(ROTR,R1,R2,R3,R4,v, 2, 7, 8,13,M[s[12]],M[s[13]]);  \
+        TCHASH_I_BLAKE2_G_(ROTR,R1,R2,R3,R4,v, 3, 4, 9,14,M[s[14]],M[s[15]]);  \
+    }                                                                          \
+    for(r = 0; r < 8; r++)                                                     \
+        h[r] ^= v[r] ^ v[r + 8];
+static void tchash_i_blake2b_compress(uint64_t h[8], const uint64_t M[16], const uint64_t t[2], int last)
+{
+    uint64_t v[16];
+    TCHASH_I_BLAKE2_COMPRESS_BODY_(tchash_i_rotr64,32,24,16,63,12,tchash_i_blake2b_IV)
+}
+static void tchash_i_blake2s_compress(uint32_t h[8], const uint32_t M[16], const uint32_t t[2], int last)
+{
+    uint32_t v[16];
+    TCHASH_I_BLAKE2_COMPRESS_BODY_(tchash_i_rotr32,16,12,8,7,10,tchash_i_blake2s_IV)
+}
+#undef TCHASH_I_BLAKE2_COMPRESS_BODY_
+#undef TCHASH_I_BLAKE2_G_
+
+/*
+ * Unlike our other hashes, BLAKE2 needs to know which block is the last one, so
+ * a full buffer is only compressed once more data arrives (or in `get()`).
+ */
+#define TCHASH_I_BLAKE2_INIT_BODY_(LHASH,UHASH,SIZE)                           \
+    size_t i;                                                                  \
+    if(!LHASH) return NULL;                                                    \
+    if(!digestlen || digestlen > TCHASH_##UHASH##_DIGEST_SIZE) return NULL;    \
+    if(keylen > TCHASH_##UHASH##_KEY_SIZE) return NULL;                        \
+                                                                               \
+    LHASH->total[0] = LHASH->total[1] = 0;                                     \
+    for(i = 0; i < 8; i++)                                                     \
+        LHASH->h[i] = tchash_i_##LHASH##_IV[i];                                \
+    /* parameter block: fanout=1, depth=1 (sequential mode) */                 \
+    LHASH->h[0] ^= UINT##SIZE##_C(0x01010000) | (TC__STATIC_CAST(uint##SIZE##_t,keylen) << 8) | digestlen;\
+    LHASH->dsize = TC__STATIC_CAST(unsigned char,digestlen);                   \
+                                                                               \
+    /* the key is padded into a block of its own */                            \
+    memset(LHASH->buf.b, 0, sizeof(LHASH->buf.b));                             \
+    if(keylen) memcpy(LHASH->buf.b, key, keylen);                              \
+    LHASH->blen = keylen ? sizeof(LHASH->buf.b) : 0;                           \
+    return LHASH;
+#define TCHASH_I_BLAKE2_PROCESS_BODY_(LHASH,UHASH,SIZE)                        \
+    const unsigned char* udata = TC__VOID_CAST(const unsigned char*,data);     \
+    while(dlen)                                                                \
+    {                                                                          \
+        if(LHASH->blen == sizeof(LHASH->buf.b))                                \
+        {                                                                      \
+            LHASH->total[0] += sizeof(LHASH->buf.b);                           \
+            if(LHASH->total[0] < sizeof(LHASH->buf.b)) LHASH->total[1]++;       \
+            tchash_i_from_le##SIZE##arr(LHASH->buf.M, sizeof(LHASH->buf.M) / sizeof(*LHASH->buf.M));\
+            tchash_i_##LHASH##_compress(LHASH->h, LHASH->buf.M, LHASH->total, 0);\
+            LHASH->blen = 0;                                                   \
+        }                                                                      \
+        size_t clen = sizeof(LHASH->buf.b) - LHASH->blen;                      \
+        if(clen > dlen) clen = dlen;                                           \
+        memcpy(LHASH->buf.b + LHASH->blen, udata, clen);                       \
+        LHASH->blen += clen;                                                   \
+        udata += clen;                                                         \
+        dlen -= clen;                                                          \
+    }
+#define TCHASH_I_BLAKE2_GET_BODY_(LHASH,UHASH,SIZE)                            \
+    TCHash_##UHASH tmp = *LHASH;                                               \
+    tmp.total[0] += tmp.blen;                                                  \
+    if(tmp.total[0] < tmp.blen) tmp.total[1]++;                                \
+    memset(tmp.buf.b + tmp.blen, 0, sizeof(tmp.buf.b) - tmp.blen);             \
+    tchash_i_from_le##SIZE##arr(tmp.buf.M, sizeof(tmp.buf.M) / sizeof(*tmp.buf.M));\
+    tchash_i_##LHASH##_compress(tmp.h, tmp.buf.M, tmp.total, 1);               \
+                                                                               \
+    tchash_i_to_le##SIZE##arr(tmp.h, sizeof(tmp.h) / sizeof(*tmp.h));          \
+    memcpy(digest, tmp.h, tmp.dsize);                                          \
+    return digest;
+
+TCHash_BLAKE2B* tchash_blake2b_init_key(TCHash_BLAKE2B* blake2b, size_t digestlen, const void* key, size_t keylen)
+{
+    TCHASH_I_BLAKE2_INIT_BODY_(blake2b,BLAKE2B,64)
+}
+TCHash_BLAKE2B* tchash_blake2b_init(TCHash_BLAKE2B* blake2b) { return tchash_blake2b_init_key(blake2b, TCHASH_BLAKE2B_DIGEST_SIZE, NULL, 0); }
+void tchash_blake2b_process(TCHash_BLAKE2B* blake2b, const void* data, size_t dlen)
+{
+    TCHASH_I_BLAKE2_PROCESS_BODY_(blake2b,BLAKE2B,64)
+}
+void* tchash_blake2b_get(TCHash_BLAKE2B* blake2b, void* digest)
+{
+    TCHASH_I_BLAKE2_GET_BODY_(blake2b,BLAKE2B,64)
+}
+void* tchash_blake2b(void* digest, const void* data, size_t dlen) { TCHASH_I_SIMPLE_BODY_(blake2b,BLAKE2B) }
+
+TCHash_BLAKE2S* tchash_blake2s_init_key(TCHash_BLAKE2S* blake2s, size_t digestlen, const void* key, size_t keylen)
+{
+    TCHASH_I_BLAKE2_INIT_BODY_(blake2s,BLAKE2S,32)
+}
+TCHash_BLAKE2S* tchash_blake2s_init(TCHash_BLAKE2S* blake2s) { return tchash_blake2s_init_key(blake2s, TCHASH_BLAKE2S_DIGEST_SIZE, NULL, 0); }
+void tchash_blake2s_process(TCHash_BLAKE2S* blake2s, const void* data, size_t dlen)
+{
+    TCHASH_I_BLAKE2_PROCESS_BODY_(blake2s,BLAKE2S,32)
+}
+void* tchash_blake2s_get(TCHash_BLAKE2S* blake2s, void* digest)
+{
+    TCHASH_I_BLAKE2_GET_BODY_(blake2s,BLAKE2S,32)
+}
+void* tchash_blake2s(void* digest, const void* data, size_t dlen) { TCHASH_I_SIMPLE_BODY_(blake2s,BLAKE2S) }
+
+
+
+#define TCHASH_I_BLAKE3_CHUNK_START     0x01
+#define TCHASH_I_BLAKE3_CHUNK_END       0x02
+#define TCHASH_I_BLAKE3_PARENT          0x04
+#define TCHASH_I_BLAKE3_ROOT            0x08
+#define TCHASH_I_BLAKE3_KEYED_HASH      0x10
+/* same as the BLAKE2s IV, and thus the SHA2-256 initial state */
+#define tchash_i_blake3_IV  tchash_i_blake2s_IV
+static const unsigned char tchash_i_blake3_perm[16] = { 2, 6, 3, 10, 7, 0, 4, 13, 1, 11, 12, 5, 9, 14, 15, 8 };
+
+#define TCHASH_I_BLAKE3_G_(v,a,b,c,d,x,y)                                      \
+    do {                                                                       \
+        v[a] = v[a] + v[b] + (x); v[d] = tchash_i_rotr32(v[d] ^ v[a], 16);     \
+        v[c] = v[c] + v[d];       v[b] = tchash_i_rotr32(v[b] ^ v[c], 12);     \
+        v[a] = v[a] + v[b] + (y); v[d] = tchash_i_rotr32(v[d] ^ v[a],  8);     \
+        v[c] = v[c] + v[d];       v[b] = tchash_i_rotr32(v[b] ^ v[c],  7);     \
+    } while(0)
+/* the full 16-word output; the chaining value is `out[0..7]` */
+static void tchash_i_blake3_compress(uint32_t out[16], const uint32_t cv[8], const uint32_t M[16], uint64_t counter, uint32_t blen, uint32_t flags)
+{
+    uint32_t v[16], m[16], tmp[16];
+    int r, i;
+    for(i = 0; i < 8; i++)
+    {
+        v[i] = cv[i];
+        v[i + 8] = tchash_i_blake3_IV[i];
+    }
+    v[12] = TC__STATIC_CAST(uint32_t,counter);
+    v[13] = TC__STATIC_CAST(uint32_t,counter >> 32);
+    v[14] = blen;
+    v[15] = flags;
+    memcpy(m, M, sizeof(m));
+
+    for(r = 0; r < 7; r++)
+    {
+        TCHASH_I_BLAKE3_G_(v, 0, 4, 8,12,m[ 0],m[ 1]);
+        TCHASH_I_BLAKE3_G_(v, 1, 5, 9,13,m[ 2],m[ 3]);
+        TCHASH_I_BLAKE3_G_(v, 2, 6,10,14,m[ 4],m[ 5]);
+        TCHASH_I_BLAKE3_G_(v, 3, 7,11,15,m[ 6],m[ 7]);
+        TCHASH_I_BLAKE3_G_(v, 0, 5,10,15,m[ 8],m[ 9]);
+        TCHASH_I_BLAKE3_G_(v, 1, 6,11,12,m[10],m[11]);
+        TCHASH_I_BLAKE3_G_(v, 2, 7, 8,13,m[12],m[13]);
+        TCHASH_I_BLAKE3_G_(v, 3, 4, 9,14,m[14],m[15]);
+        for(i = 0; i < 16; i++)
+            tmp[i] = m[tchash_i_blake3_perm[i]];
+        memcpy(m, tmp, sizeof(m));
+    }
+    for(i = 0; i < 8; i++)
+    {
+        out[i] = v[i] ^ v[i + 8];
+        out[i + 8] = v[i + 8] ^ cv[i];
+    }
+}
+#undef TCHASH_I_BLAKE3_G_
+static void tchash_i_blake3_parent_cv(uint32_t cv[8], const uint32_t left[8], const uint32_t right[8], const uint32_t key[8], uint32_t flags)
+{
+    uint32_t M[16], out[16];
+    memcpy(M, left, 8 * sizeof(*M));
+    memcpy(M + 8, right, 8 * sizeof(*M));
+    tchash_i_blake3_compress(out, key, M, 0, TCHASH_BLAKE3_BLOCK_SIZE, flags | TCHASH_I_BLAKE3_PARENT);
+    memcpy(cv, out, 8 * sizeof(*cv));
+}
+/* generate the root output (any length) from the last compression's inputs */
+static void tchash_i_blake3_root_output(unsigned char* digest, size_t digestlen, const uint32_t cv[8], const uint32_t M[16], uint32_t blen, uint32_t flags)
+{
+    uint64_t counter;
+    for(counter = 0; digestlen; counter++)
+    {
+        uint32_t out[16];
+        size_t clen = TCHASH_I_MIN(digestlen, sizeof(out));
+        tchash_i_blake3_compress(out, cv, M, counter, blen, flags | TCHASH_I_BLAKE3_ROOT);
+        tchash_i_to_le32arr(out, sizeof(out) / sizeof(*out));
+        memcpy(digest, out, clen);
+        digest += clen;
+        digestlen -= clen;
+    }
+}
+
+static TCHash_BLAKE3* tchash_i_blake3_init_flags(TCHash_BLAKE3* blake3, const uint32_t key[8], unsigned char flags)
+{
+    if(!blake3) return NULL;
+
+    memcpy(blake3->key, key, sizeof(blake3->key));
+    memcpy(blake3->h, key, sizeof(blake3->h));
+    blake3->chunk = 0;
+    blake3->blen = 0;
+    blake3->nblocks = 0;
+    blake3->flags = flags;
+    blake3->nstack = 0;
+
+    return blake3;
+}
+TCHash_BLAKE3* tchash_blake3_init(TCHash_BLAKE3* blake3)
+{
+    return tchash_i_blake3_init_flags(blake3, tchash_i_blake3_IV, 0);
+}
+TCHash_BLAKE3* tchash_blake3_init_key(TCHash_BLAKE3* blake3, const void* key)
+{
+    uint32_t ukey[8];
+    memcpy(ukey, key, sizeof(ukey));
+    tchash_i_from_le32arr(ukey, sizeof(ukey) / sizeof(*ukey));
+    return tchash_i_blake3_init_flags(blake3, ukey, TCHASH_I_BLAKE3_KEYED_HASH);
+}
+static uint32_t tchash_i_blake3_chunk_flags(const TCHash_BLAKE3* blake3)
+{
+    return blake3->flags | (blake3->nblocks ? 0 : TCHASH_I_BLAKE3_CHUNK_START);
+}
+void tchash_blake3_process(TCHash_BLAKE3* blake3, const void* data, size_t dlen)
+{
+    const unsigned char* udata = TC__VOID_CAST(const unsigned char*,data);
+    while(dlen)
+    {
+        /* as with BLAKE2, full buffers are only compressed once we know they're not the last */
+        if(blake3->blen == sizeof(blake3->buf.b))
+        {
+            uint32_t out[16];
+            tchash_i_from_le32arr(blake3->buf.M, sizeof(blake3->buf.M) / sizeof(*blake3->buf.M));
+            if(blake3->nblocks == TCHASH_BLAKE3_CHUNK_SIZE / TCHASH_BLAKE3_BLOCK_SIZE - 1)
+            {
+                /* end of chunk: merge it into the tree (as many levels as the chunk count's trailing zeros) */
+                uint64_t total;
+                uint32_t cv[8];
+                tchash_i_blake3_compress(out, blake3->h, blake3->buf.M, blake3->chunk, TCHASH_BLAKE3_BLOCK_SIZE, tchash_i_blake3_chunk_flags(blake3) | TCHASH_I_BLAKE3_CHUNK_END);
+                memcpy(cv, out, sizeof(cv));
+                for(total = ++blake3->chunk; !(total & 1); total >>= 1)
+                    tchash_i_blake3_parent_cv(cv, blake3->stack[--blake3->nstack], cv, blake3->key, blake3->flags);
+                memcpy(blake3->stack[blake3->nstack++], cv, sizeof(cv));
+
+                memcpy(blake3->h, blake3->key, sizeof(blake3->h));
+                blake3->nblocks = 0;
+            }
+            else
+            {
+                tchash_i_blake3_compress(out, blake3->h, blake3->buf.M, blake3->chunk, TCHASH_BLAKE3_BLOCK_SIZE, tchash_i_blake3_chunk_flags(blake3));
+                memcpy(blake3->h, out, sizeof(blake3->h));
+                blake3->nblocks++;
+            }
+            blake3->blen = 0;
+        }
+        size_t clen = sizeof(blake3->buf.b) - blake3->blen;
+        if(clen > dlen) clen = dlen;
+        memcpy(blake3->buf.b + blake3->blen, udata, clen);
+        blake3->blen += clen;
+        udata += clen;
+        dlen -= clen;
+    }
+}
+/* the (possibly partial) last block of the current chunk, zero-padded */
+static void tchash_i_blake3_load_last(uint32_t M[16], const TCHash_BLAKE3* blake3)
+{
+    TCHash_BLAKE3 tmp;
+    memcpy(tmp.buf.b, blake3->buf.b, blake3->blen);
+    memset(tmp.buf.b + blake3->blen, 0, sizeof(tmp.buf.b) - blake3->blen);
+    memcpy(M, tmp.buf.M, sizeof(tmp.buf.M));
+    tchash_i_from_le32arr(M, sizeof(tmp.buf.M) / sizeof(*tmp.buf.M));
+}
+void* tchash_blake3_get(TCHash_BLAKE3* blake3, void* digest, size_t digestlen)
+{
+    uint32_t cv[8], M[16];
+    uint32_t blen = blake3->blen;
+    uint32_t flags = tchash_i_blake3_chunk_flags(blake3) | TCHASH_I_BLAKE3_CHUNK_END;
+    memcpy(cv, blake3->h, sizeof(cv));
+    tchash_i_blake3_load_last(M, blake3);
+
+    /* walk up the tree, from the current chunk to the root (parents always use a counter of 0) */
+    uint64_t counter = blake3->chunk;
+    int i;
+    for(i = blake3->nstack - 1; i >= 0; i--)
+    {
+        uint32_t out[16];
+        tchash_i_blake3_compress(out, cv, M, counter, blen, flags);
+        counter = 0;
+        memcpy(M, blake3->stack[i], 8 * sizeof(*M));
+        memcpy(M + 8, out, 8 * sizeof(*M));
+        memcpy(cv, blake3->key, sizeof(cv));
+        blen = TCHASH_BLAKE3_BLOCK_SIZE;
+        flags = blake3->flags | TCHASH_I_BLAKE3_PARENT;
+    }
+    tchash_i_blake3_root_output(TC__VOID_CAST(unsigned char*,digest), digestlen, cv, M, blen, flags);
+    return digest;
+}
+void* tchash_blake3(void* digest, size_t digestlen, const void* data, size_t dlen) { TCHASH_I_SIMPLELEN_BODY_(blake3,BLAKE3) }
+
+/* multi-threaded: each thread gets a subtree; anything below is computed recursively */
+#define TCHASH_I_BLAKE3_MT_MIN_SIZE     (64 * TCHASH_BLAKE3_CHUNK_SIZE)
+typedef struct TCHash_I_BLAKE3_Subtree
+{
+    const unsigned char* data;
+    size_t dlen;
+    uint64_t chunk;
+    unsigned int nthreads;
+    uint32_t cv[8];
+} TCHash_I_BLAKE3_Subtree;
+/* the left subtree always has the largest power-of-2 number of chunks that leaves at least 1 byte for the right */
+static size_t tchash_i_blake3_left_len(size_t dlen)
+{
+    size_t nchunks = (dlen - 1) / TCHASH_BLAKE3_CHUNK_SIZE;
+    size_t p = 1;
+    while(p <= nchunks / 2) p <<= 1;
+    return p * TCHASH_BLAKE3_CHUNK_SIZE;
+}
+static void tchash_i_blake3_subtree_split(const TCHash_I_BLAKE3_Subtree* tree, TCHash_I_BLAKE3_Subtree* left, TCHash_I_BLAKE3_Subtree* right)
+{
+    size_t llen = tchash_i_blake3_left_len(tree->dlen);
+    left->data = tree->data;
+    left->dlen = llen;
+    left->chunk = tree->chunk;
+    left->nthreads = tree->nthreads / 2;
+    right->data = tree->data + llen;
+    right->dlen = tree->dlen - llen;
+    right->chunk = tree->chunk + llen / TCHASH_BLAKE3_CHUNK_SIZE;
+    right->nthreads = tree->nthreads - left->nthreads;
+}
+static void* tchash_i_blake3_subtree_cv(void* udata)
+{
+    TCHash_I_BLAKE3_Subtree* tree = TC__VOID_CAST(TCHash_I_BLAKE3_Subtree*,udata);
+    if(tree->dlen <= TCHASH_BLAKE3_CHUNK_SIZE)
+    {
+        /* a single chunk; reuse the streaming code, which won't have finished it yet */
+        TCHash_BLAKE3 blake3;
+        uint32_t M[16], out[16];
+        tchash_blake3_init(&blake3);
+        blake3.chunk = tree->chunk;
+        tchash_blake3_process(&blake3, tree->data, tree->dlen);
+        tchash_i_blake3_load_last(M, &blake3);
+        tchash_i_blake3_compress(out, blake3.h, M, tree->chunk, blake3.blen, tchash_i_blake3_chunk_flags(&blake3) | TCHASH_I_BLAKE3_CHUNK_END);
+        memcpy(tree->cv, out, sizeof(tree->cv));
+        return NULL;
+    }
+
+    TCHash_I_BLAKE3_Subtree left, right;
+    tchash_i_blake3_subtree_split(tree, &left, &right);
+#ifdef TC_THREAD_H_
+    if(left.nthreads && right.dlen >= TCHASH_I_BLAKE3_MT_MIN_SIZE)
+    {
+        tcthread_t thread = tcthread_create(0, tchash_i_blake3_subtree_cv, &left);
+        tchash_i_blake3_subtree_cv(&right);
+        /* if we couldn't get a thread, hash it ourselves */
+        if(tcthread_is_valid(thread))
+            tcthread_join(thread, NULL);
+        else
+            tchash_i_blake3_subtree_cv(&left);
+    }
+    else
+#endif
+    {
+        tchash_i_blake3_subtree_cv(&left);
+        tchash_i_blake3_subtree_cv(&right);
+    }
+    tchash_i_blake3_parent_cv(tree->cv, left.cv, right.cv, tchash_i_blake3_IV, 0);
+    return NULL;
+}
+void* tchash_blake3_mt(void* digest, size_t digestlen, const void* data, size_t dlen, unsigned int nthreads)
+{
+#ifdef TC_THREAD_H_
+    if(!nthreads) nthreads = tcthread_get_cpu_count();
+#endif
+    if(nthreads <= 1 || dlen < 2 * TCHASH_I_BLAKE3_MT_MIN_SIZE)
+        return tchash_blake3(digest, digestlen, data, dlen);
+
+    /* the root is the parent of the 2 top subtrees, but with the ROOT flag (so it's not a simple cv) */
+    TCHash_I_BLAKE3_Subtree tree, left, right;
+    tree.data = TC__VOID_CAST(const unsigned char*,data);
+    tree.dlen = dlen;
+    tree.chunk = 0;
+    tree.nthreads = nthreads;
+    tchash_i_blake3_subtree_split(&tree, &left, &right);
+#ifdef TC_THREAD_H_
+    tcthread_t thread = tcthread_create(0, tchash_i_blake3_subtree_cv, &left);
+    tchash_i_blake3_subtree_cv(&right);
+    if(tcthread_is_valid(thread))
+        tcthread_join(thread, NULL);
+    else
+        tchash_i_blake3_subtree_cv(&left);
+#else
+    tchash_i_blake3_subtree_cv(&left);
+    tchash_i_blake3_subtree_cv(&right);
+#endif
+
+    uint32_t M[16];
+    memcpy(M, left.cv, sizeof(left.cv));
+    memcpy(M + 8, right.cv, sizeof(right.cv));
+    tchash_i_blake3_root_output(TC__VOID_CAST(unsigned char*,digest), digestlen, tchash_i_blake3_IV, M, TCHASH_BLAKE3_BLOCK_SIZE, TCHASH_I_BLAKE3_PARENT);
+    return digest;
+}
+
+
+/* HMAC & HKDF: the padded key is absorbed once (in `*_init()`), so each further message only costs a state copy */
+#define TCHASH_I_HMAC_INIT_BODY_(LHASH,UHASH,BSIZE,DSIZE)                      \
+    unsigned char pad[BSIZE];                                                  \
+    size_t i;                                                                  \
+    if(klen > BSIZE)                                                           \
+    {                                                                          \
+        tchash_##LHASH(pad, key, klen);                                        \
+        klen = DSIZE;                                                          \
+    }                                                                          \
+    else if(klen)                                                              \
+        memcpy(pad, key, klen);                                                \
+    memset(pad + klen, 0, BSIZE - klen);                                       \
+                                                                               \
+    for(i = 0; i < BSIZE; i++) pad[i] ^= TCHASH_HMAC_IPAD;                     \
+    tchash_##LHASH##_init(&hmac->inner);                                       \
+    tchash_##LHASH##_process(&hmac->inner, pad, BSIZE);                        \
+    for(i = 0; i < BSIZE; i++) pad[i] ^= TCHASH_HMAC_IPAD ^ TCHASH_HMAC_OPAD;  \
+    tchash_##LHASH##_init(&hmac->outer);                                       \
+    tchash_##LHASH##_process(&hmac->outer, pad, BSIZE);                        \
+    return hmac;
+#define TCHASH_I_HMAC_GET_BODY_(LHASH,UHASH,DSIZE)                             \
+    unsigned char ihash[DSIZE];                                                \
+    TCHash_##UHASH outer = hmac->outer;                                        \
+    tchash_##LHASH##_get(&hmac->inner, ihash);                                 \
+    tchash_##LHASH##_process(&outer, ihash, DSIZE);                            \
+    return tchash_##LHASH##_get(&outer, digest);
+#define TCHASH_I_HMAC_SIMPLE_BODY_(LHASH,UHASH)                                \
+    TCHash_HMAC_##UHASH hmac;                                                  \
+    tchash_hmac_##LHASH##_init(&hmac, key, klen);                              \
+    tchash_hmac_##LHASH##_process(&hmac, data, dlen);                          \
+    return tchash_hmac_##LHASH##_get(&hmac, digest);
+#define TCHASH_I_HMAC_KEYED_BODY_(LHASH,UHASH,DSIZE)                           \
+    unsigned char ihash[DSIZE];                                                \
+    TCHash_##UHASH state = keyed->inner;                                       \
+    tchash_##LHASH##_process(&state, data, dlen);                              \
+    tchash_##LHASH##_get(&state, ihash);                                       \
+    state = keyed->outer;                                                      \
+    tchash_##LHASH##_process(&state, ihash, DSIZE);                            \
+    return tchash_##LHASH##_get(&state, digest);
+/* T(i) = HMAC(PRK, T(i-1) | info | i); the keyed context is reused for every block */
+#define TCHASH_I_HKDF_EXPAND_BODY_(LHASH,UHASH,DSIZE)                          \
+    TCHash_HMAC_##UHASH keyed;                                                 \
+    TCHash_##UHASH state;                                                      \
+    unsigned char T[DSIZE];                                                    \
+    unsigned char* out = TC__VOID_CAST(unsigned char*,okm);                    \
+    size_t tlen = 0, n;                                                        \
+    unsigned char ctr;                                                         \
+    if(olen > 255 * DSIZE) return NULL;                                        \
+    tchash_hmac_##LHASH##_init(&keyed, prk, prklen);                           \
+    for(ctr = 1; olen; ctr++)                                                  \
+    {                                                                          \
+        state = keyed.inner;                                                   \
+        tchash_##LHASH##_process(&state, T, tlen);                             \
+        tchash_##LHASH##_process(&state, info, infolen);                       \
+        tchash_##LHASH##_process(&state, &ctr, 1);                             \
+        tchash_##LHASH##_get(&state, T);                                       \
+        state = keyed.outer;                                                   \
+        tchash_##LHASH##_process(&state, T, DSIZE);                            \
+        tchash_##LHASH##_get(&state, T);                                       \
+        tlen = DSIZE;                                                          \
+                                                                               \
+        n = TCHASH_I_MIN(olen, DSIZE);                                         \
+        memcpy(out, T, n);                                                     \
+        out += n;                                                              \
+        olen -= n;                                                             \
+    }                                                                          \
+    return okm;
+#define TCHASH_I_HKDF_BODY_(LHASH,DSIZE)                                       \
+    unsigned char prk[DSIZE];                                                  \
+    tchash_hkdf_##LHASH##_extract(prk, salt, slen, ikm, ilen);                 \
+    return tchash_hkdf_##LHASH##_expand(okm, olen, prk, DSIZE, info, infolen);
+
+TCHash_HMAC_MD5* tchash_hmac_md5_init(TCHash_HMAC_MD5* hmac, const void* key, size_t klen) { TCHASH_I_HMAC_INIT_BODY_(md5,MD5,TCHASH_MD5_BLOCK_SIZE,TCHASH_MD5_DIGEST_SIZE) }
+void tchash_hmac_md5_process(TCHash_HMAC_MD5* hmac, const void* data, size_t dlen) { tchash_md5_process(&hmac->inner, data, dlen); }
+void* tchash_hmac_md5_get(TCHash_HMAC_MD5* hmac, void* digest) { TCHASH_I_HMAC_GET_BODY_(md5,MD5,TCHASH_MD5_DIGEST_SIZE) }
+void* tchash_hmac_md5(void* digest, const void* key, size_t klen, const void* data, size_t dlen) { TCHASH_I_HMAC_SIMPLE_BODY_(md5,MD5) }
+void* tchash_hmac_md5_keyed(void* digest, const TCHash_HMAC_MD5* keyed, const void* data, size_t dlen) { TCHASH_I_HMAC_KEYED_BODY_(md5,MD5,TCHASH_MD5_DIGEST_SIZE) }
+void* tchash_hkdf_md5_extract(void* prk, const void* salt, size_t slen, const void* ikm, size_t ilen) { return tchash_hmac_md5(prk, salt, slen, ikm, ilen); }
+void* tchash_hkdf_md5_expand(void* okm, size_t olen, const void* prk, size_t prklen, const void* info, size_t infolen) { TCHASH_I_HKDF_EXPAND_BODY_(md5,MD5,TCHASH_MD5_DIGEST_SIZE) }
+void* tchash_hkdf_md5(void* okm, size_t olen, const void* salt, size_t slen, const void* ikm, size_t ilen, const void* info, size_t infolen) { TCHASH_I_HKDF_BODY_(md5,TCHASH_MD5_DIGEST_SIZE) }
+
+TCHash_HMAC_Tiger192* tchash_hmac_tiger192_init(TCHash_HMAC_Tiger192* hmac, const void* key, size_t klen) { TCHASH_I_HMAC_INIT_BODY_(tiger192,Tiger192,TCHASH_TIGER_BLOCK_SIZE,TCHASH_TIGER192_DIGEST_SIZE) }
+void tchash_hmac_tiger192_process(TCHash_HMAC_Tiger192* hmac, const void* data, size_t dlen) { tchash_tiger192_process(&hmac->inner, data, dlen); }
+void* tchash_hmac_tiger192_get(TCHash_HMAC_Tiger192* hmac, void* digest) { TCHASH_I_HMAC_GET_BODY_(tiger192,Tiger192,TCHASH_TIGER192_DIGEST_SIZE) }
+void* tchash_hmac_tiger192(void* digest, const void* key, size_t klen, const void* data, size_t dlen) { TCHASH_I_HMAC_SIMPLE_BODY_(tiger192,Tiger192) }
+void* tchash_hmac_tiger192_keyed(void* digest, const TCHash_HMAC_Tiger192* keyed, const void* data, size_t dlen) { TCHASH_I_HMAC_KEYED_BODY_(tiger192,Tiger192,TCHASH_TIGER192_DIGEST_SIZE) }
+void* tchash_hkdf_tiger192_extract(void* prk, const void* salt, size_t slen, const void* ikm, size_t ilen) { return tchash_hmac_tiger192(prk, salt, slen, ikm, ilen); }
+void* tchash_hkdf_tiger192_expand(void* okm, size_t olen, const void* prk, size_t prklen, const void* info, size_t infolen) { TCHASH_I_HKDF_EXPAND_BODY_(tiger192,Tiger192,TCHASH_TIGER192_DIGEST_SIZE) }
+void* tchash_hkdf_tiger192(void* okm, size_t olen, const void* salt, size_t slen, const void* ikm, size_t ilen, const void* info, size_t infolen) { TCHASH_I_HKDF_BODY_(tiger192,TCHASH_TIGER192_DIGEST_SIZE) }
+
+TCHash_HMAC_Tiger160* tchash_hmac_tiger160_init(TCHash_HMAC_Tiger160* hmac, const void* key, size_t klen) { TCHASH_I_HMAC_INIT_BODY_(tiger160,Tiger160,TCHASH_TIGER_BLOCK_SIZE,TCHASH_TIGER160_DIGEST_SIZE) }
+void tchash_hmac_tiger160_process(TCHash_HMAC_Tiger160* hmac, const void* data, size_t dlen) { tchash_tiger160_process(&hmac->inner, data, dlen); }
+void* tchash_hmac_tiger160_get(TCHash_HMAC_Tiger160* hmac, void* digest) { TCHASH_I_HMAC_GET_BODY_(tiger160,Tiger160,TCHASH_TIGER160_DIGEST_SIZE) }
+void* tchash_hmac_tiger160(void* digest, const void* key, size_t klen, const void* data, size_t dlen) { TCHASH_I_HMAC_SIMPLE_BODY_(tiger160,Tiger160) }
+void* tchash_hmac_tiger160_keyed(void* digest, const TCHash_HMAC_Tiger160* keyed, const void* data, size_t dlen) { TCHASH_I_HMAC_KEYED_BODY_(tiger160,Tiger160,TCHASH_TIGER160_DIGEST_SIZE) }
+void* tchash_hkdf_tiger160_extract(void* prk, const void* salt, size_t slen, const void* ikm, size_t ilen) { return tchash_hmac_tiger160(prk, salt, slen, ikm, ilen); }
+void* tchash_hkdf_tiger160_expand(void* okm, size_t olen, const void* prk, size_t prklen, const void* info, size_t infolen) { TCHASH_I_HKDF_EXPAND_BODY_(tiger160,Tiger160,TCHASH_TIGER160_DIGEST_SIZE) }
+void* tchash_hkdf_tiger160(void* okm, size_t olen, const void* salt, size_t slen, const void* ikm, size_t ilen, const void* info, size_t infolen) { TCHASH_I_HKDF_BODY_(tiger160,TCHASH_TIGER160_DIGEST_SIZE) }
+
+TCHash_HMAC_Tiger128* tchash_hmac_tiger128_init(TCHash_HMAC_Tiger128* hmac, const void* key, size_t klen) { TCHASH_I_HMAC_INIT_BODY_(tiger128,Tiger128,TCHASH_TIGER_BLOCK_SIZE,TCHASH_TIGER128_DIGEST_SIZE) }
+void tchash_hmac_tiger128_process(TCHash_HMAC_Tiger128* hmac, const void* data, size_t dlen) { tchash_tiger128_process(&hmac->inner, data, dlen); }
+void* tchash_hmac_tiger128_get(TCHash_HMAC_Tiger128* hmac, void* digest) { TCHASH_I_HMAC_GET_BODY_(tiger128,Tiger128,TCHASH_TIGER128_DIGEST_SIZE) }
+void* tchash_hmac_tiger128(void* digest, const void* key, size_t klen, const void* data, size_t dlen) { TCHASH_I_HMAC_SIMPLE_BODY_(tiger128,Tiger128) }
+void* tchash_hmac_tiger128_keyed(void* digest, const TCHash_HMAC_Tiger128* keyed, const void* data, size_t dlen) { TCHASH_I_HMAC_KEYED_BODY_(tiger128,Tiger128,TCHASH_TIGER128_DIGEST_SIZE) }
+void* tchash_hkdf_tiger128_extract(void* prk, const void* salt, size_t slen, const void* ikm, size_t ilen) { return tchash_hmac_tiger128(prk, salt, slen, ikm, ilen); }
+void* tchash_hkdf_tiger128_expand(void* okm, size_t olen, const void* prk, size_t prklen, const void* info, size_t infolen) { TCHASH_I_HKDF_EXPAND_BODY_(tiger128,Tiger128,TCHASH_TIGER128_DIGEST_SIZE) }
+void* tchash_hkdf_tiger128(void* okm, size_t olen, const void* salt, size_t slen, const void* ikm, size_t ilen, const void* info, size_t infolen) { TCHASH_I_HKDF_BODY_(tiger128,TCHASH_TIGER128_DIGEST_SIZE) }
+
+TCHash_HMAC_Tiger2_192* tchash_hmac_tiger2_192_init(TCHash_HMAC_Tiger2_192* hmac, const void* key, size_t klen) { TCHASH_I_HMAC_INIT_BODY_(tiger2_192,Tiger2_192,TCHASH_TIGER_BLOCK_SIZE,TCHASH_TIGER2_192_DIGEST_SIZE) }
+void tchash_hmac_tiger2_192_process(TCHash_HMAC_Tiger2_192* hmac, const void* data, size_t dlen) { tchash_tiger2_192_process(&hmac->inner, data, dlen); }
+void* tchash_hmac_tiger2_192_get(TCHash_HMAC_Tiger2_192* hmac, void* digest) { TCHASH_I_HMAC_GET_BODY_(tiger2_192,Tiger2_192,TCHASH_TIGER2_192_DIGEST_SIZE) }
+void* tchash_hmac_tiger2_192(void* digest, const void* key, size_t klen, const void* data, size_t dlen) { TCHASH_I_HMAC_SIMPLE_BODY_(tiger2_192,Tiger2_192) }
+void* tchash_hmac_tiger2_192_keyed(void* digest, const TCHash_HMAC_Tiger2_192* keyed, const void* data, size_t dlen) { TCHASH_I_HMAC_KEYED_BODY_(tiger2_192,Tiger2_192,TCHASH_TIGER2_192_DIGEST_SIZE) }
+void* tchash_hkdf_tiger2_192_extract(void* prk, const void* salt, size_t slen, const void* ikm, size_t ilen) { return tchash_hmac_tiger2_192(prk, salt, slen, ikm, ilen); }
+void* tchash_hkdf_tiger2_192_expand(void* okm, size_t olen, const void* prk, size_t prklen, const void* info, size_t infolen) { TCHASH_I_HKDF_EXPAND_BODY_(tiger2_192,Tiger2_192,TCHASH_TIGER2_192_DIGEST_SIZE) }
+void* tchash_hkdf_tiger2_192(void* okm, size_t olen, const void* salt, size_t slen, const void* ikm, size_t ilen, const void* info, size_t infolen) { TCHASH_I_HKDF_BODY_(tiger2_192,TCHASH_TIGER2_192_DIGEST_SIZE) }
+
+TCHash_HMAC_Tiger2_160* tchash_hmac_tiger2_160_init(TCHash_HMAC_Tiger2_160* hmac, const void* key, size_t klen) { TCHASH_I_HMAC_INIT_BODY_(tiger2_160,Tiger2_160,TCHASH_TIGER_BLOCK_SIZE,TCHASH_TIGER2_160_DIGEST_SIZE) }
+void tchash_hmac_tiger2_160_process(TCHash_HMAC_Tiger2_160* hmac, const void* data, size_t dlen) { tchash_tiger2_160_process(&hmac->inner, data, dlen); }
+void* tchash_hmac_tiger2_160_get(TCHash_HMAC_Tiger2_160* hmac, void* digest) { TCHASH_I_HMAC_GET_BODY_(tiger2_160,Tiger2_160,TCHASH_TIGER2_160_DIGEST_SIZE) }
+void* tchash_hmac_tiger2_160(void* digest, const void* key, size_t klen, const void* data, size_t dlen) { TCHASH_I_HMAC_SIMPLE_BODY_(tiger2_160,Tiger2_160) }
+void* tchash_hmac_tiger2_160_keyed(void* digest, const TCHash_HMAC_Tiger2_160* keyed, const void* data, size_t dlen) { TCHASH_I_HMAC_KEYED_BODY_(tiger2_160,Tiger2_160,TCHASH_TIGER2_160_DIGEST_SIZE) }
+void* tchash_hkdf_tiger2_160_extract(void* prk, const void* salt, size_t slen, const void* ikm, size_t ilen) { return tchash_hmac_tiger2_160(prk, salt, slen, ikm, ilen); }
+void* tchash_hkdf_tiger2_160_expand(void* okm, size_t olen, const void* prk, size_t prklen, const void* info, size_t infolen) { TCHASH_I_HKDF_EXPAND_BODY_(tiger2_160,Tiger2_160,TCHASH_TIGER2_160_DIGEST_SIZE) }
+void* tchash_hkdf_tiger2_160(void* okm, size_t olen, const void* salt, size_t slen, const void* ikm, size_t ilen, const void* info, size_t infolen) { TCHASH_I_HKDF_BODY_(tiger2_160,TCHASH_TIGER2_160_DIGEST_SIZE) }
+
+TCHash_HMAC_Tiger2_128* tchash_hmac_tiger2_128_init(TCHash_HMAC_Tiger2_128* hmac, const void* key, size_t klen) { TCHASH_I_HMAC_INIT_BODY_(tiger2_128,Tiger2_128,TCHASH_TIGER_BLOCK_SIZE,TCHASH_TIGER2_128_DIGEST_SIZE) }
+void tchash_hmac_tiger2_128_process(TCHash_HMAC_Tiger2_128* hmac, const void* data, size_t dlen) { tchash_tiger2_128_process(&hmac->inner, data, dlen); }
+void* tchash_hmac_tiger2_128_get(TCHash_HMAC_Tiger2_128* hmac, void* digest) { TCHASH_I_HMAC_GET_BODY_(tiger2_128,Tiger2_128,TCHASH_TIGER2_128_DIGEST_SIZE) }
+void* tchash_hmac_tiger2_128(void* digest, const void* key, size_t klen, const void* data, size_t dlen) { TCHASH_I_HMAC_SIMPLE_BODY_(tiger2_128,Tiger2_128) }
+void* tchash_hmac_tiger2_128_keyed(void* digest, const TCHash_HMAC_Tiger2_128* keyed, const void* data, size_t dlen) { TCHASH_I_HMAC_KEYED_BODY_(tiger2_128,Tiger2_128,TCHASH_TIGER2_128_DIGEST_SIZE) }
+void* tchash_hkdf_tiger2_128_extract(void* prk, const void* salt, size_t slen, const void* ikm, size_t ilen) { return tchash_hmac_tiger2_128(prk, salt, slen, ikm, ilen); }
+void* tchash_hkdf_tiger2_128_expand(void* okm, size_t olen, const void* prk, size_t prklen, const void* info, size_t infolen) { TCHASH_I_HKDF_EXPAND_BODY_(tiger2_128,Tiger2_128,TCHASH_TIGER2_128_DIGEST_SIZE) }
+void* tchash_hkdf_tiger2_128(void* okm, size_t olen, const void* salt, size_t slen, const void* ikm, size_t ilen, const void* info, size_t infolen) { TCHASH_I_HKDF_BODY_(tiger2_128,TCHASH_TIGER2_128_DIGEST_SIZE) }
+
+TCHash_HMAC_RIPEMD128* tchash_hmac_ripemd128_init(TCHash_HMAC_RIPEMD128* hmac, const void* key, size_t klen) { TCHASH_I_HMAC_INIT_BODY_(ripemd128,RIPEMD128,TCHASH_RIPEMD128_BLOCK_SIZE,TCHASH_RIPEMD128_DIGEST_SIZE) }
+void tchash_hmac_ripemd128_process(TCHash_HMAC_RIPEMD128* hmac, const void* data, size_t dlen) { tchash_ripemd128_process(&hmac->inner, data, dlen); }
+void* tchash_hmac_ripemd128_get(TCHash_HMAC_RIPEMD128* hmac, void* digest) { TCHASH_I_HMAC_GET_BODY_(ripemd128,RIPEMD128,TCHASH_RIPEMD128_DIGEST_SIZE) }
+void* tchash_hmac_ripemd128(void* digest, const void* key, size_t klen, const void* data, size_t dlen) { TCHASH_I_HMAC_SIMPLE_BODY_(ripemd128,RIPEMD128) }
+void* tchash_hmac_ripemd128_keyed(void* digest, const TCHash_HMAC_RIPEMD128* keyed, const void* data, size_t dlen) { TCHASH_I_HMAC_KEYED_BODY_(ripemd128,RIPEMD128,TCHASH_RIPEMD128_DIGEST_SIZE) }
+void* tchash_hkdf_ripemd128_extract(void* prk, const void* salt, size_t slen, const void* ikm, size_t ilen) { return tchash_hmac_ripemd128(prk, salt, slen, ikm, ilen); }
+void* tchash_hkdf_ripemd128_expand(void* okm, size_t olen, const void* prk, size_t prklen, const void* info, size_t infolen) { TCHASH_I_HKDF_EXPAND_BODY_(ripemd128,RIPEMD128,TCHASH_RIPEMD128_DIGEST_SIZE) }
+void* tchash_hkdf_ripemd128(void* okm, size_t olen, const void* salt, size_t slen, const void* ikm, size_t ilen, const void* info, size_t infolen) { TCHASH_I_HKDF_BODY_(ripemd128,TCHASH_RIPEMD128_DIGEST_SIZE) }
+
+TCHash_HMAC_RIPEMD160* tchash_hmac_ripemd160_init(TCHash_HMAC_RIPEMD160* hmac, const void* key, size_t klen) { TCHASH_I_HMAC_INIT_BODY_(ripemd160,RIPEMD160,TCHASH_RIPEMD160_BLOCK_SIZE,TCHASH_RIPEMD160_DIGEST_SIZE) }
+void tchash_hmac_ripemd160_process(TCHash_HMAC_RIPEMD160* hmac, const void* data, size_t dlen) { tchash_ripemd160_process(&hmac->inner, data, dlen); }
+void* tchash_hmac_ripemd160_get(TCHash_HMAC_RIPEMD160* hmac, void* digest) { TCHASH_I_HMAC_GET_BODY_(ripemd160,RIPEMD160,TCHASH_RIPEMD160_DIGEST_SIZE) }
+void* tchash_hmac_ripemd160(void* digest, const void* key, size_t klen, const void* data, size_t dlen) { TCHASH_I_HMAC_SIMPLE_BODY_(ripemd160,RIPEMD160) }
+void* tchash_hmac_ripemd160_keyed(void* digest, const TCHash_HMAC_RIPEMD160* keyed, const void* data, size_t dlen) { TCHASH_I_HMAC_KEYED_BODY_(ripemd160,RIPEMD160,TCHASH_RIPEMD160_DIGEST_SIZE) }
+void* tchash_hkdf_ripemd160_extract(void* prk, const void* salt, size_t slen, const void* ikm, size_t ilen) { return tchash_hmac_ripemd160(prk, salt, slen, ikm, ilen); }
+void* tchash_hkdf_ripemd160_expand(void* okm, size_t olen, const void* prk, size_t prklen, const void* info, size_t infolen) { TCHASH_I_HKDF_EXPAND_BODY_(ripemd160,RIPEMD160,TCHASH_RIPEMD160_DIGEST_SIZE) }
+void* tchash_hkdf_ripemd160(void* okm, size_t olen, const void* salt, size_t slen, const void* ikm, size_t ilen, const void* info, size_t infolen) { TCHASH_I_HKDF_BODY_(ripemd160,TCHASH_RIPEMD160_DIGEST_SIZE) }
+
+TCHash_HMAC_RIPEMD256* tchash_hmac_ripemd256_init(TCHash_HMAC_RIPEMD256* hmac, const void* key, size_t klen) { TCHASH_I_HMAC_INIT_BODY_(ripemd256,RIPEMD256,TCHASH_RIPEMD256_BLOCK_SIZE,TCHASH_RIPEMD256_DIGEST_SIZE) }
+void tchash_hmac_ripemd256_process(TCHash_HMAC_RIPEMD256* hmac, const void* data, size_t dlen) { tchash_ripemd256_process(&hmac->inner, data, dlen); }
+void* tchash_hmac_ripemd256_get(TCHash_HMAC_RIPEMD256* hmac, void* digest) { TCHASH_I_HMAC_GET_BODY_(ripemd256,RIPEMD256,TCHASH_RIPEMD256_DIGEST_SIZE) }
+void* tchash_hmac_ripemd256(void* digest, const void* key, size_t klen, const void* data, size_t dlen) { TCHASH_I_HMAC_SIMPLE_BODY_(ripemd256,RIPEMD256) }
+void* tchash_hmac_ripemd256_keyed(void* digest, const TCHash_HMAC_RIPEMD256* keyed, const void* data, size_t dlen) { TCHASH_I_HMAC_KEYED_BODY_(ripemd256,RIPEMD256,TCHASH_RIPEMD256_DIGEST_SIZE) }
+void* tchash_hkdf_ripemd256_extract(void* prk, const void* salt, size_t slen, const void* ikm, size_t ilen) { return tchash_hmac_ripemd256(prk, salt, slen, ikm, ilen); }
+void* tchash_hkdf_ripemd256_expand(void* okm, size_t olen, const void* prk, size_t prklen, const void* info, size_t infolen) { TCHASH_I_HKDF_EXPAND_BODY_(ripemd256,RIPEMD256,TCHASH_RIPEMD256_DIGEST_SIZE) }
+void* tchash_hkdf_ripemd256(void* okm, size_t olen, const void* salt, size_t slen, const void* ikm, size_t ilen, const void* info, size_t infolen) { TCHASH_I_HKDF_BODY_(ripemd256,TCHASH_RIPEMD256_DIGEST_SIZE) }
+
+TCHash_HMAC_RIPEMD320* tchash_hmac_ripemd320_init(TCHash_HMAC_RIPEMD320* hmac, const void* key, size_t klen) { TCHASH_I_HMAC_INIT_BODY_(ripemd320,RIPEMD320,TCHASH_RIPEMD320_BLOCK_SIZE,TCHASH_RIPEMD320_DIGEST_SIZE) }
+void tchash_hmac_ripemd320_process(TCHash_HMAC_RIPEMD320* hmac, const void* data, size_t dlen) { tchash_ripemd320_process(&hmac->inner, data, dlen); }
+void* tchash_hmac_ripemd320_get(TCHash_HMAC_RIPEMD320* hmac, void* digest) { TCHASH_I_HMAC_GET_BODY_(ripemd320,RIPEMD320,TCHASH_RIPEMD320_DIGEST_SIZE) }
+void* tchash_hmac_ripemd320(void* digest, const void* key, size_t klen, const void* data, size_t dlen) { TCHASH_I_HMAC_SIMPLE_BODY_(ripemd320,RIPEMD320) }
+void* tchash_hmac_ripemd320_keyed(void* digest, const TCHash_HMAC_RIPEMD320* keyed, const void* data, size_t dlen) { TCHASH_I_HMAC_KEYED_BODY_(ripemd320,RIPEMD320,TCHASH_RIPEMD320_DIGEST_SIZE) }
+void* tchash_hkdf_ripemd320_extract(void* prk, const void* salt, size_t slen, const void* ikm, size_t ilen) { return tchash_hmac_ripemd320(prk, salt, slen, ikm, ilen); }
+void* tchash_hkdf_ripemd320_expand(void* okm, size_t olen, const void* prk, size_t prklen, const void* info, size_t infolen) { TCHASH_I_HKDF_EXPAND_BODY_(ripemd320,RIPEMD320,TCHASH_RIPEMD320_DIGEST_SIZE) }
+void* tchash_hkdf_ripemd320(void* okm, size_t olen, const void* salt, size_t slen, const void* ikm, size_t ilen, const void* info, size_t infolen) { TCHASH_I_HKDF_BODY_(ripemd320,TCHASH_RIPEMD320_DIGEST_SIZE) }
+
+TCHash_HMAC_SHA1* tchash_hmac_sha1_init(TCHash_HMAC_SHA1* hmac, const void* key, size_t klen) { TCHASH_I_HMAC_INIT_BODY_(sha1,SHA1,TCHASH_SHA1_BLOCK_SIZE,TCHASH_SHA1_DIGEST_SIZE) }
+void tchash_hmac_sha1_process(TCHash_HMAC_SHA1* hmac, const void* data, size_t dlen) { tchash_sha1_process(&hmac->inner, data, dlen); }
+void* tchash_hmac_sha1_get(TCHash_HMAC_SHA1* hmac, void* digest) { TCHASH_I_HMAC_GET_BODY_(sha1,SHA1,TCHASH_SHA1_DIGEST_SIZE) }
+void* tchash_hmac_sha1(void* digest, const void* key, size_t klen, const void* data, size_t dlen) { TCHASH_I_HMAC_SIMPLE_BODY_(sha1,SHA1) }
+void* tchash_hmac_sha1_keyed(void* digest, const TCHash_HMAC_SHA1* keyed, const void* data, size_t dlen) { TCHASH_I_HMAC_KEYED_BODY_(sha1,SHA1,TCHASH_SHA1_DIGEST_SIZE) }
+void* tchash_hkdf_sha1_extract(void* prk, const void* salt, size_t slen, const void* ikm, size_t ilen) { return tchash_hmac_sha1(prk, salt, slen, ikm, ilen); }
+void* tchash_hkdf_sha1_expand(void* okm, size_t olen, const void* prk, size_t prklen, const void* info, size_t infolen) { TCHASH_I_HKDF_EXPAND_BODY_(sha1,SHA1,TCHASH_SHA1_DIGEST_SIZE) }
+void* tchash_hkdf_sha1(void* okm, size_t olen, const void* salt, size_t slen, const void* ikm, size_t ilen, const void* info, size_t infolen) { TCHASH_I_HKDF_BODY_(sha1,TCHASH_SHA1_DIGEST_SIZE) }
+
+TCHash_HMAC_SHA2_224* tchash_hmac_sha2_224_init(TCHash_HMAC_SHA2_224* hmac, const void* key, size_t klen) { TCHASH_I_HMAC_INIT_BODY_(sha2_224,SHA2_224,TCHASH_SHA2_224_BLOCK_SIZE,TCHASH_SHA2_224_DIGEST_SIZE) }
+void tchash_hmac_sha2_224_process(TCHash_HMAC_SHA2_224* hmac, const void* data, size_t dlen) { tchash_sha2_224_process(&hmac->inner, data, dlen); }
+void* tchash_hmac_sha2_224_get(TCHash_HMAC_SHA2_224* hmac, void* digest) { TCHASH_I_HMAC_GET_BODY_(sha2_224,SHA2_224,TCHASH_SHA2_224_DIGEST_SIZE) }
+void* tchash_hmac_sha2_224(void* digest, const void* key, size_t klen, const void* data, size_t dlen) { TCHASH_I_HMAC_SIMPLE_BODY_(sha2_224,SHA2_224) }
+void* tchash_hmac_sha2_224_keyed(void* digest, const TCHash_HMAC_SHA2_224* keyed, const void* data, size_t dlen) { TCHASH_I_HMAC_KEYED_BODY_(sha2_224,SHA2_224,TCHASH_SHA2_224_DIGEST_SIZE) }
+void* tchash_hkdf_sha2_224_extract(void* prk, const void* salt, size_t slen, const void* ikm, size_t ilen) { return tchash_hmac_sha2_224(prk, salt, slen, ikm, ilen); }
+void* tchash_hkdf_sha2_224_expand(void* okm, size_t olen, const void* prk, size_t prklen, const void* info, size_t infolen) { TCHASH_I_HKDF_EXPAND_BODY_(sha2_224,SHA2_224,TCHASH_SHA2_224_DIGEST_SIZE) }
+void* tchash_hkdf_sha2_224(void* okm, size_t olen, const void* salt, size_t slen, const void* ikm, size_t ilen, const void* info, size_t infolen) { TCHASH_I_HKDF_BODY_(sha2_224,TCHASH_SHA2_224_DIGEST_SIZE) }
+
+TCHash_HMAC_SHA2_256* tchash_hmac_sha2_256_init(TCHash_HMAC_SHA2_256* hmac, const void* key, size_t klen) { TCHASH_I_HMAC_INIT_BODY_(sha2_256,SHA2_256,TCHASH_SHA2_256_BLOCK_SIZE,TCHASH_SHA2_256_DIGEST_SIZE) }
+void tchash_hmac_sha2_256_process(TCHash_HMAC_SHA2_256* hmac, const void* data, size_t dlen) { tchash_sha2_256_process(&hmac->inner, data, dlen); }
+void* tchash_hmac_sha2_256_get(TCHash_HMAC_SHA2_256* hmac, void* digest) { TCHASH_I_HMAC_GET_BODY_(sha2_256,SHA2_256,TCHASH_SHA2_256_DIGEST_SIZE) }
+void* tchash_hmac_sha2_256(void* digest, const void* key, size_t klen, const void* data, size_t dlen) { TCHASH_I_HMAC_SIMPLE_BODY_(sha2_256,SHA2_256) }
+void* tchash_hmac_sha2_256_keyed(void* digest, const TCHash_HMAC_SHA2_256* keyed, const void* data, size_t dlen) { TCHASH_I_HMAC_KEYED_BODY_(sha2_256,SHA2_256,TCHASH_SHA2_256_DIGEST_SIZE) }
+void* tchash_hkdf_sha2_256_extract(void* prk, const void* salt, size_t slen, const void* ikm, size_t ilen) { return tchash_hmac_sha2_256(prk, salt, slen, ikm, ilen); }
+void* tchash_hkdf_sha2_256_expand(void* okm, size_t olen, const void* prk, size_t prklen, const void* info, size_t infolen) { TCHASH_I_HKDF_EXPAND_BODY_(sha2_256,SHA2_256,TCHASH_SHA2_256_DIGEST_SIZE) }
+void* tchash_hkdf_sha2_256(void* okm, size_t olen, const void* salt, size_t slen, const void* ikm, size_t ilen, const void* info, size_t infolen) { TCHASH_I_HKDF_BODY_(sha2_256,TCHASH_SHA2_256_DIGEST_SIZE) }
+
+TCHash_HMAC_SHA2_384* tchash_hmac_sha2_384_init(TCHash_HMAC_SHA2_384* hmac, const void* key, size_t klen) { TCHASH_I_HMAC_INIT_BODY_(sha2_384,SHA2_384,TCHASH_SHA2_384_BLOCK_SIZE,TCHASH_SHA2_384_DIGEST_SIZE) }
+void tchash_hmac_sha2_384_process(TCHash_HMAC_SHA2_384* hmac, const void* data, size_t dlen) { tchash_sha2_384_process(&hmac->inner, data, dlen); }
+void* tchash_hmac_sha2_384_get(TCHash_HMAC_SHA2_384* hmac, void* digest) { TCHASH_I_HMAC_GET_BODY_(sha2_384,SHA2_384,TCHASH_SHA2_384_DIGEST_SIZE) }
+void* tchash_hmac_sha2_384(void* digest, const void* key, size_t klen, const void* data, size_t dlen) { TCHASH_I_HMAC_SIMPLE_BODY_(sha2_384,SHA2_384) }
+void* tchash_hmac_sha2_384_keyed(void* digest, const TCHash_HMAC_SHA2_384* keyed, const void* data, size_t dlen) { TCHASH_I_HMAC_KEYED_BODY_(sha2_384,SHA2_384,TCHASH_SHA2_384_DIGEST_SIZE) }
+void* tchash_hkdf_sha2_384_extract(void* prk, const void* salt, size_t slen, const void* ikm, size_t ilen) { return tchash_hmac_sha2_384(prk, salt, slen, ikm, ilen); }
+void* tchash_hkdf_sha2_384_expand(void* okm, size_t olen, const void* prk, size_t prklen, const void* info, size_t infolen) { TCHASH_I_HKDF_EXPAND_BODY_(sha2_384,SHA2_384,TCHASH_SHA2_384_DIGEST_SIZE) }
+void* tchash_hkdf_sha2_384(void* okm, size_t olen, const void* salt, size_t slen, const void* ikm, size_t ilen, const void* info, size_t infolen) { TCHASH_I_HKDF_BODY_(sha2_384,TCHASH_SHA2_384_DIGEST_SIZE) }
+
+TCHash_HMAC_SHA2_512* tchash_hmac_sha2_512_init(TCHash_HMAC_SHA2_512* hmac, const void* key, size_t klen) { TCHASH_I_HMAC_INIT_BODY_(sha2_512,SHA2_512,TCHASH_SHA2_512_BLOCK_SIZE,TCHASH_SHA2_512_DIGEST_SIZE) }
+void tchash_hmac_sha2_512_process(TCHash_HMAC_SHA2_512* hmac, const void* data, size_t dlen) { tchash_sha2_512_process(&hmac->inner, data, dlen); }
+void* tchash_hmac_sha2_512_get(TCHash_HMAC_SHA2_512* hmac, void* digest) { TCHASH_I_HMAC_GET_BODY_(sha2_512,SHA2_512,TCHASH_SHA2_512_DIGEST_SIZE) }
+void* tchash_hmac_sha2_512(void* digest, const void* key, size_t klen, const void* data, size_t dlen) { TCHASH_I_HMAC_SIMPLE_BODY_(sha2_512,SHA2_512) }
+void* tchash_hmac_sha2_512_keyed(void* digest, const TCHash_HMAC_SHA2_512* keyed, const void* data, size_t dlen) { TCHASH_I_HMAC_KEYED_BODY_(sha2_512,SHA2_512,TCHASH_SHA2_512_DIGEST_SIZE) }
+void* tchash_hkdf_sha2_512_extract(void* prk, const void* salt, size_t slen, const void* ikm, size_t ilen) { return tchash_hmac_sha2_512(prk, salt, slen, ikm, ilen); }
+void* tchash_hkdf_sha2_512_expand(void* okm, size_t olen, const void* prk, size_t prklen, const void* info, size_t infolen) { TCHASH_I_HKDF_EXPAND_BODY_(sha2_512,SHA2_512,TCHASH_SHA2_512_DIGEST_SIZE) }
+void* tchash_hkdf_sha2_512(void* okm, size_t olen, const void* salt, size_t slen, const void* ikm, size_t ilen, const void* info, size_t infolen) { TCHASH_I_HKDF_BODY_(sha2_512,TCHASH_SHA2_512_DIGEST_SIZE) }
+
+TCHash_HMAC_SHA2_512_224* tchash_hmac_sha2_512_224_init(TCHash_HMAC_SHA2_512_224* hmac, const void* key, size_t klen) { TCHASH_I_HMAC_INIT_BODY_(sha2_512_224,SHA2_512_224,TCHASH_SHA2_512_224_BLOCK_SIZE,TCHASH_SHA2_512_224_DIGEST_SIZE) }
+void tchash_hmac_sha2_512_224_process(TCHash_HMAC_SHA2_512_224* hmac, const void* data, size_t dlen) { tchash_sha2_512_224_process(&hmac->inner, data, dlen); }
+void* tchash_hmac_sha2_512_224_get(TCHash_HMAC_SHA2_512_224* hmac, void* digest) { TCHASH_I_HMAC_GET_BODY_(sha2_512_224,SHA2_512_224,TCHASH_SHA2_512_224_DIGEST_SIZE) }
+void* tchash_hmac_sha2_512_224(void* digest, const void* key, size_t klen, const void* data, size_t dlen) { TCHASH_I_HMAC_SIMPLE_BODY_(sha2_512_224,SHA2_512_224) }
+void* tchash_hmac_sha2_512_224_keyed(void* digest, const TCHash_HMAC_SHA2_512_224* keyed, const void* data, size_t dlen) { TCHASH_I_HMAC_KEYED_BODY_(sha2_512_224,SHA2_512_224,TCHASH_SHA2_512_224_DIGEST_SIZE) }
+void* tchash_hkdf_sha2_512_224_extract(void* prk, const void* salt, size_t slen, const void* ikm, size_t ilen) { return tchash_hmac_sha2_512_224(prk, salt, slen, ikm, ilen); }
+void* tchash_hkdf_sha2_512_224_expand(void* okm, size_t olen, const void* prk, size_t prklen, const void* info, size_t infolen) { TCHASH_I_HKDF_EXPAND_BODY_(sha2_512_224,SHA2_512_224,TCHASH_SHA2_512_224_DIGEST_SIZE) }
+void* tchash_hkdf_sha2_512_224(void* okm, size_t olen, const void* salt, size_t slen, const void* ikm, size_t ilen, const void* info, size_t infolen) { TCHASH_I_HKDF_BODY_(sha2_512_224,TCHASH_SHA2_512_224_DIGEST_SIZE) }
+
+TCHash_HMAC_SHA2_512_256* tchash_hmac_sha2_512_256_init(TCHash_HMAC_SHA2_512_256* hmac, const void* key, size_t klen) { TCHASH_I_HMAC_INIT_BODY_(sha2_512_256,SHA2_512_256,TCHASH_SHA2_512_256_BLOCK_SIZE,TCHASH_SHA2_512_256_DIGEST_SIZE) }
+void tchash_hmac_sha2_512_256_process(TCHash_HMAC_SHA2_512_256* hmac, const void* data, size_t dlen) { tchash_sha2_512_256_process(&hmac->inner, data, dlen); }
+void* tchash_hmac_sha2_512_256_get(TCHash_HMAC_SHA2_512_256* hmac, void* digest) { TCHASH_I_HMAC_GET_BODY_(sha2_512_256,SHA2_512_256,TCHASH_SHA2_512_256_DIGEST_SIZE) }
+void* tchash_hmac_sha2_512_256(void* digest, const void* key, size_t klen, const void* data, size_t dlen) { TCHASH_I_HMAC_SIMPLE_BODY_(sha2_512_256,SHA2_512_256) }
+void* tchash_hmac_sha2_512_256_keyed(void* digest, const TCHash_HMAC_SHA2_512_256* keyed, const void* data, size_t dlen) { TCHASH_I_HMAC_KEYED_BODY_(sha2_512_256,SHA2_512_256,TCHASH_SHA2_512_256_DIGEST_SIZE) }
+void* tchash_hkdf_sha2_512_256_extract(void* prk, const void* salt, size_t slen, const void* ikm, size_t ilen) { return tchash_hmac_sha2_512_256(prk, salt, slen, ikm, ilen); }
+void* tchash_hkdf_sha2_512_256_expand(void* okm, size_t olen, const void* prk, size_t prklen, const void* info, size_t infolen) { TCHASH_I_HKDF_EXPAND_BODY_(sha2_512_256,SHA2_512_256,TCHASH_SHA2_512_256_DIGEST_SIZE) }
+void* tchash_hkdf_sha2_512_256(void* okm, size_t olen, const void* salt, size_t slen, const void* ikm, size_t ilen, const void* info, size_t infolen) { TCHASH_I_HKDF_BODY_(sha2_512_256,TCHASH_SHA2_512_256_DIGEST_SIZE) }
+
+TCHash_HMAC_SHA3_224* tchash_hmac_sha3_224_init(TCHash_HMAC_SHA3_224* hmac, const void* key, size_t klen) { TCHASH_I_HMAC_INIT_BODY_(sha3_224,SHA3_224,TCHASH_SHA3_224_BLOCK_SIZE,TCHASH_SHA3_224_DIGEST_SIZE) }
+void tchash_hmac_sha3_224_process(TCHash_HMAC_SHA3_224* hmac, const void* data, size_t dlen) { tchash_sha3_224_process(&hmac->inner, data, dlen); }
+void* tchash_hmac_sha3_224_get(TCHash_HMAC_SHA3_224* hmac, void* digest) { TCHASH_I_HMAC_GET_BODY_(sha3_224,SHA3_224,TCHASH_SHA3_224_DIGEST_SIZE) }
+void* tchash_hmac_sha3_224(void* digest, const void* key, size_t klen, const void* data, size_t dlen) { TCHASH_I_HMAC_SIMPLE_BODY_(sha3_224,SHA3_224) }
+void* tchash_hmac_sha3_224_keyed(void* digest, const TCHash_HMAC_SHA3_224* keyed, const void* data, size_t dlen) { TCHASH_I_HMAC_KEYED_BODY_(sha3_224,SHA3_224,TCHASH_SHA3_224_DIGEST_SIZE) }
+void* tchash_hkdf_sha3_224_extract(void* prk, const void* salt, size_t slen, const void* ikm, size_t ilen) { return tchash_hmac_sha3_224(prk, salt, slen, ikm, ilen); }
+void* tchash_hkdf_sha3_224_expand(void* okm, size_t olen, const void* prk, size_t prklen, const void* info, size_t infolen) { TCHASH_I_HKDF_EXPAND_BODY_(sha3_224,SHA3_224,TCHASH_SHA3_224_DIGEST_SIZE) }
+void* tchash_hkdf_sha3_224(void* okm, size_t olen, const void* salt, size_t slen, const void* ikm, size_t ilen, const void* info, size_t infolen) { TCHASH_I_HKDF_BODY_(sha3_224,TCHASH_SHA3_224_DIGEST_SIZE) }
+
+TCHash_HMAC_SHA3_256* tchash_hmac_sha3_256_init(TCHash_HMAC_SHA3_256* hmac, const void* key, size_t klen) { TCHASH_I_HMAC_INIT_BODY_(sha3_256,SHA3_256,TCHASH_SHA3_256_BLOCK_SIZE,TCHASH_SHA3_256_DIGEST_SIZE) }
+void tchash_hmac_sha3_256_process(TCHash_HMAC_SHA3_256* hmac, const void* data, size_t dlen) { tchash_sha3_256_process(&hmac->inner, data, dlen); }
+void* tchash_hmac_sha3_256_get(TCHash_HMAC_SHA3_256* hmac, void* digest) { TCHASH_I_HMAC_GET_BODY_(sha3_256,SHA3_256,TCHASH_SHA3_256_DIGEST_SIZE) }
+void* tchash_hmac_sha3_256(void* digest, const void* key, size_t klen, const void* data, size_t dlen) { TCHASH_I_HMAC_SIMPLE_BODY_(sha3_256,SHA3_256) }
+void* tchash_hmac_sha3_256_keyed(void* digest, const TCHash_HMAC_SHA3_256* keyed, const void* data, size_t dlen) { TCHASH_I_HMAC_KEYED_BODY_(sha3_256,SHA3_256,TCHASH_SHA3_256_DIGEST_SIZE) }
+void* tchash_hkdf_sha3_256_extract(void* prk, const void* salt, size_t slen, const void* ikm, size_t ilen) { return tchash_hmac_sha3_256(prk, salt, slen, ikm, ilen); }
+void* tchash_hkdf_sha3_256_expand(void* okm, size_t olen, const void* prk, size_t prklen, const void* info, size_t infolen) { TCHASH_I_HKDF_EXPAND_BODY_(sha3_256,SHA3_256,TCHASH_SHA3_256_DIGEST_SIZE) }
+void* tchash_hkdf_sha3_256(void* okm, size_t olen, const void* salt, size_t slen, const void* ikm, size_t ilen, const void* info, size_t infolen) { TCHASH_I_HKDF_BODY_(sha3_256,TCHASH_SHA3_256_DIGEST_SIZE) }
+
+TCHash_HMAC_SHA3_384* tchash_hmac_sha3_384_init(TCHash_HMAC_SHA3_384* hmac, const void* key, size_t klen) { TCHASH_I_HMAC_INIT_BODY_(sha3_384,SHA3_384,TCHASH_SHA3_384_BLOCK_SIZE,TCHASH_SHA3_384_DIGEST_SIZE) }
+void tchash_hmac_sha3_384_process(TCHash_HMAC_SHA3_384* hmac, const void* data, size_t dlen) { tchash_sha3_384_process(&hmac->inner, data, dlen); }
+void* tchash_hmac_sha3_384_get(TCHash_HMAC_SHA3_384* hmac, void* digest) { TCHASH_I_HMAC_GET_BODY_(sha3_384,SHA3_384,TCHASH_SHA3_384_DIGEST_SIZE) }
+void* tchash_hmac_sha3_384(void* digest, const void* key, size_t klen, const void* data, size_t dlen) { TCHASH_I_HMAC_SIMPLE_BODY_(sha3_384,SHA3_384) }
+void* tchash_hmac_sha3_384_keyed(void* digest, const TCHash_HMAC_SHA3_384* keyed, const void* data, size_t dlen) { TCHASH_I_HMAC_KEYED_BODY_(sha3_384,SHA3_384,TCHASH_SHA3_384_DIGEST_SIZE) }
+void* tchash_hkdf_sha3_384_extract(void* prk, const void* salt, size_t slen, const void* ikm, size_t ilen) { return tchash_hmac_sha3_384(prk, salt, slen, ikm, ilen); }
+void* tchash_hkdf_sha3_384_expand(void* okm, size_t olen, const void* prk, size_t prklen, const void* info, size_t infolen) { TCHASH_I_HKDF_EXPAND_BODY_(sha3_384,SHA3_384,TCHASH_SHA3_384_DIGEST_SIZE) }
+void* tchash_hkdf_sha3_384(void* okm, size_t olen, const void* salt, size_t slen, const void* ikm, size_t ilen, const void* info, size_t infolen) { TCHASH_I_HKDF_BODY_(sha3_384,TCHASH_SHA3_384_DIGEST_SIZE) }
+
+TCHash_HMAC_SHA3_512* tchash_hmac_sha3_512_init(TCHash_HMAC_SHA3_512* hmac, const void* key, size_t klen) { TCHASH_I_HMAC_INIT_BODY_(sha3_512,SHA3_512,TCHASH_SHA3_512_BLOCK_SIZE,TCHASH_SHA3_512_DIGEST_SIZE) }
+void tchash_hmac_sha3_512_process(TCHash_HMAC_SHA3_512* hmac, const void* data, size_t dlen) { tchash_sha3_512_process(&hmac->inner, data, dlen); }
+void* tchash_hmac_sha3_512_get(TCHash_HMAC_SHA3_512* hmac, void* digest) { TCHASH_I_HMAC_GET_BODY_(sha3_512,SHA3_512,TCHASH_SHA3_512_DIGEST_SIZE) }
+void* tchash_hmac_sha3_512(void* digest, const void* key, size_t klen, const void* data, size_t dlen) { TCHASH_I_HMAC_SIMPLE_BODY_(sha3_512,SHA3_512) }
+void* tchash_hmac_sha3_512_keyed(void* digest, const TCHash_HMAC_SHA3_512* keyed, const void* data, size_t dlen) { TCHASH_I_HMAC_KEYED_BODY_(sha3_512,SHA3_512,TCHASH_SHA3_512_DIGEST_SIZE) }
+void* tchash_hkdf_sha3_512_extract(void* prk, const void* salt, size_t slen, const void* ikm, size_t ilen) { return tchash_hmac_sha3_512(prk, salt, slen, ikm, ilen); }
+void* tchash_hkdf_sha3_512_expand(void* okm, size_t olen, const void* prk, size_t prklen, const void* info, size_t infolen) { TCHASH_I_HKDF_EXPAND_BODY_(sha3_512,SHA3_512,TCHASH_SHA3_512_DIGEST_SIZE) }
+void* tchash_hkdf_sha3_512(void* okm, size_t olen, const void* salt, size_t slen, const void* ikm, size_t ilen, const void* info, size_t infolen) { TCHASH_I_HKDF_BODY_(sha3_512,TCHASH_SHA3_512_DIGEST_SIZE) }
+
+TCHash_HMAC_BLAKE2B* tchash_hmac_blake2b_init(TCHash_HMAC_BLAKE2B* hmac, const void* key, size_t klen) { TCHASH_I_HMAC_INIT_BODY_(blake2b,BLAKE2B,TCHASH_BLAKE2B_BLOCK_SIZE,TCHASH_BLAKE2B_DIGEST_SIZE) }
+void tchash_hmac_blake2b_process(TCHash_HMAC_BLAKE2B* hmac, const void* data, size_t dlen) { tchash_blake2b_process(&hmac->inner, data, dlen); }
+void* tchash_hmac_blake2b_get(TCHash_HMAC_BLAKE2B* hmac, void* digest) { TCHASH_I_HMAC_GET_BODY_(blake2b,BLAKE2B,TCHASH_BLAKE2B_DIGEST_SIZE) }
+void* tchash_hmac_blake2b(void* digest, const void* key, size_t klen, const void* data, size_t dlen) { TCHASH_I_HMAC_SIMPLE_BODY_(blake2b,BLAKE2B) }
+void* tchash_hmac_blake2b_keyed(void* digest, const TCHash_HMAC_BLAKE2B* keyed, const void* data, size_t dlen) { TCHASH_I_HMAC_KEYED_BODY_(blake2b,BLAKE2B,TCHASH_BLAKE2B_DIGEST_SIZE) }
+void* tchash_hkdf_blake2b_extract(void* prk, const void* salt, size_t slen, const void* ikm, size_t ilen) { return tchash_hmac_blake2b(prk, salt, slen, ikm, ilen); }
+void* tchash_hkdf_blake2b_expand(void* okm, size_t olen, const void* prk, size_t prklen, const void* info, size_t infolen) { TCHASH_I_HKDF_EXPAND_BODY_(blake2b,BLAKE2B,TCHASH_BLAKE2B_DIGEST_SIZE) }
+void* tchash_hkdf_blake2b(void* okm, size_t olen, const void* salt, size_t slen, const void* ikm, size_t ilen, const void* info, size_t infolen) { TCHASH_I_HKDF_BODY_(blake2b,TCHASH_BLAKE2B_DIGEST_SIZE) }
+
+TCHash_HMAC_BLAKE2S* tchash_hmac_blake2s_init(TCHash_HMAC_BLAKE2S* hmac, const void* key, size_t klen) { TCHASH_I_HMAC_INIT_BODY_(blake2s,BLAKE2S,TCHASH_BLAKE2S_BLOCK_SIZE,TCHASH_BLAKE2S_DIGEST_SIZE) }
+void tchash_hmac_blake2s_process(TCHash_HMAC_BLAKE2S* hmac, const void* data, size_t dlen) { tchash_blake2s_process(&hmac->inner, data, dlen); }
+void* tchash_hmac_blake2s_get(TCHash_HMAC_BLAKE2S* hmac, void* digest) { TCHASH_I_HMAC_GET_BODY_(blake2s,BLAKE2S,TCHASH_BLAKE2S_DIGEST_SIZE) }
+void* tchash_hmac_blake2s(void* digest, const void* key, size_t klen, const void* data, size_t dlen) { TCHASH_I_HMAC_SIMPLE_BODY_(blake2s,BLAKE2S) }
+void* tchash_hmac_blake2s_keyed(void* digest, const TCHash_HMAC_BLAKE2S* keyed, const void* data, size_t dlen) { TCHASH_I_HMAC_KEYED_BODY_(blake2s,BLAKE2S,TCHASH_BLAKE2S_DIGEST_SIZE) }
+void* tchash_hkdf_blake2s_extract(void* prk, const void* salt, size_t slen, const void* ikm, size_t ilen) { return tchash_hmac_blake2s(prk, salt, slen, ikm, ilen); }
+void* tchash_hkdf_blake2s_expand(void* okm, size_t olen, const void* prk, size_t prklen, const void* info, size_t infolen) { TCHASH_I_HKDF_EXPAND_BODY_(blake2s,BLAKE2S,TCHASH_BLAKE2S_DIGEST_SIZE) }
+void* tchash_hkdf_blake2s(void* okm, size_t olen, const void* salt, size_t slen, const void* ikm, size_t ilen, const void* info, size_t infolen) { TCHASH_I_HKDF_BODY_(blake2s,TCHASH_BLAKE2S_DIGEST_SIZE) }
+
+
+
+/* multi-buffer hashing: one independent message per SIMD lane */
+#define TCHASH_I_MB_MAXLANES_   16
+#define TCHASH_I_MB_MAXBLOCK_   TCHASH_SHAKE128_BLOCK_SIZE
+#define TCHASH_I_MB_INACTIVE_   (~TC__STATIC_CAST(size_t,0))
+
+/*
+ * Process a single block for every lane. Both the state `S` and the message
+ * `W` are stored word-major, i.e. word `i` of lane `j` is at `[i*NLANES+j]`;
+ * `nw` is the number of words in `W` (only used by Keccak).
+ */
+typedef void tchash_i_mb_kernel_(void* S, const void* W, size_t nw);
+
+typedef struct TCHash_I_MBAlg_
+{
+    const void* InitH;          /* initial state, or NULL for all-zero */
+    unsigned char nh;           /* number of state words */
+    unsigned char wsize;        /* size of a word (4 or 8) */
+    unsigned char bsize;        /* block size */
+    unsigned char dsize;        /* digest size */
+    unsigned char be;           /* words are big-endian */
+    unsigned char keccak;       /* Keccak padding (instead of Merkle-Damgard) */
+    unsigned char pad;          /* first padding byte */
+    void (*scalar)(void* h, const void* M);
+} TCHash_I_MBAlg_;
+
+typedef struct TCHash_I_MBLane_
+{
+    const unsigned char* data;  /* remaining full blocks of the message */
+    size_t nfull;
+    size_t idx;                 /* message index, or TCHASH_I_MB_INACTIVE_ */
+    unsigned char itail, ntail; /* blocks in `tail` (done, total) */
+    unsigned char tail[2 * TCHASH_I_MB_MAXBLOCK_];  /* padded final block(s) */
+} TCHash_I_MBLane_;
+
+static void tchash_i_mb_lane_init_(const TCHash_I_MBAlg_* alg, TCHash_I_MBLane_* lane, size_t idx, const void* data, size_t dlen)
+{
+    size_t rem = dlen % alg->bsize;
+
+    lane->data = TC__VOID_CAST(const unsigned char*,data);
+    lane->nfull = dlen / alg->bsize;
+    lane->idx = idx;
+    lane->itail = 0;
+
+    if(rem) memcpy(lane->tail, lane->data + lane->nfull * alg->bsize, rem);
+    memset(lane->tail + rem, 0, 2 * alg->bsize - rem);
+    lane->tail[rem] = alg->pad;
+    if(alg->keccak)
+    {
+        lane->ntail = 1;
+        lane->tail[alg->bsize - 1] |= 0x80;
+    }
+    else
+    {
+        uint64_t nbits = TC__STATIC_CAST(uint64_t,dlen) << 3;
+        lane->ntail = rem + 1 + sizeof(nbits) > alg->bsize ? 2 : 1;
+
+        unsigned char* end = lane->tail + lane->ntail * alg->bsize;
+        int i;
+        for(i = 0; i < 8; i++)
+            end[alg->be ? -1 - i : -8 + i] = TC__STATIC_CAST(unsigned char,nbits >> (8 * i));
+    }
+}
+static const unsigned char* tchash_i_mb_lane_next_(const TCHash_I_MBAlg_* alg, TCHash_I_MBLane_* lane)
+{
+    if(lane->nfull)
+    {
+        const unsigned char* block = lane->data;
+        lane->data += alg->bsize;
+        lane->nfull--;
+        return block;
+    }
+    if(lane->itail < lane->ntail)
+        return &lane->tail[lane->itail++ * alg->bsize];
+    return NULL;
+}
+/* convert a block into host-order words, storing word `i` into `W[i*stride]` */
+static void tchash_i_mb_words_(const TCHash_I_MBAlg_* alg, void* W, size_t stride, const unsigned char* block)
+{
+    size_t i, nw = alg->bsize / alg->wsize;
+    if(alg->wsize == 4)
+    {
+        uint32_t* W32 = TC__VOID_CAST(uint32_t*,W);
+        for(i = 0; i < nw; i++, block += 4)
+            W32[i * stride] = alg->be ? TCHASH_I_U32_FROM_BYTES_BE(block[0], block[1], block[2], block[3])
+                                      : TCHASH_I_U32_FROM_BYTES_LE(block[0], block[1], block[2], block[3]);
+    }
+    else
+    {
+        uint64_t* W64 = TC__VOID_CAST(uint64_t*,W);
+        for(i = 0; i < nw; i++, block += 8)
+            W64[i * stride] = TCHASH_I_U64_FROM_BYTES_LE(block[0], block[1], block[2], block[3], block[4], block[5], block[6], block[7]);
+    }
+}
+/* move the state of lane `j` from `h` into the interleaved `S` (`set`), or back out of it (`get`) */
+static void tchash_i_mb_column_set_(const TCHash_I_MBAlg_* alg, void* S, size_t nlanes, size_t j, const void* h)
+{
+    size_t i;
+    if(alg->wsize == 4)
+    {
+        uint32_t* S32 = TC__VOID_CAST(uint32_t*,S);
+        const uint32_t* h32 = TC__VOID_CAST(const uint32_t*,h);
+        for(i = 0; i < alg->nh; i++) S32[i * nlanes + j] = h32[i];
+    }
+    else
+    {
+        uint64_t* S64 = TC__VOID_CAST(uint64_t*,S);
+        const uint64_t* h64 = TC__VOID_CAST(const uint64_t*,h);
+        for(i = 0; i < alg->nh; i++) S64[i * nlanes + j] = h64[i];
+    }
+}
+static void tchash_i_mb_column_get_(const TCHash_I_MBAlg_* alg, const void* S, size_t nlanes, size_t j, void* h)
+{
+    size_t i;
+    if(alg->wsize == 4)
+    {
+        const uint32_t* S32 = TC__VOID_CAST(const uint32_t*,S);
+        uint32_t* h32 = TC__VOID_CAST(uint32_t*,h);
+        for(i = 0; i < alg->nh; i++) h32[i] = S32[i * nlanes + j];
+    }
+    else
+    {
+        const uint64_t* S64 = TC__VOID_CAST(const uint64_t*,S);
+        uint64_t* h64 = TC__VOID_CAST(uint64_t*,h);
+        for(i = 0; i < alg->nh; i++) h64[i] = S64[i * nlanes + j];
+    }
+}
+static void tchash_i_mb_digest_(const TCHash_I_MBAlg_* alg, void* digest, const void* h)
+{
+    unsigned char* udigest = TC__VOID_CAST(unsigned char*,digest);
+    size_t i;
+    if(alg->wsize == 4)
+    {
+        const uint32_t* h32 = TC__VOID_CAST(const uint32_t*,h);
+        for(i = 0; i < alg->dsize; i++)
+            udigest[i] = TC__STATIC_CAST(unsigned char,h32[i / 4] >> (8 * (alg->be ? 3 - i % 4 : i % 4)));
+    }
+    else
+    {
+        const uint64_t* h64 = TC__VOID_CAST(const uint64_t*,h);
+        for(i = 0; i < alg->dsize; i++)
+            udigest[i] = TC__STATIC_CAST(unsigned char,h64[i / 8] >> (8 * (i % 8)));
+    }
+}
+static void tchash_i_mb_run_(const TCHash_I_MBAlg_* alg, tchash_i_mb_kernel_* kernel, size_t nlanes, void* const* digests, const void* const* datas, const size_t* lens, size_t count)
+{
+    TCHash_I_MBLane_ lanes[TCHASH_I_MB_MAXLANES_];
+    uint64_t S[25 * TCHASH_I_MB_MAXLANES_];
+    uint64_t W[TCHASH_I_MB_MAXBLOCK_ / sizeof(uint64_t) * TCHASH_I_MB_MAXLANES_];
+    uint64_t h[25], zeroh[25];
+    void* Wvoid = W;
+    unsigned char* Wbytes = TC__VOID_CAST(unsigned char*,Wvoid);
+    size_t next = 0, nactive = 0, j;
+
+    TC__ASSERT(nlanes <= TCHASH_I_MB_MAXLANES_);
+    memset(zeroh, 0, sizeof(zeroh));
+    for(j = 0; j < nlanes; j++)
+        lanes[j].idx = TCHASH_I_MB_INACTIVE_;
+
+    for(;;)
+    {
+        /* refill any lanes that became free */
+        for(j = 0; j < nlanes && next < count; j++)
+        {
+            if(lanes[j].idx != TCHASH_I_MB_INACTIVE_) continue;
+            tchash_i_mb_lane_init_(alg, &lanes[j], next, datas[next], lens[next]);
+            tchash_i_mb_column_set_(alg, S, nlanes, j, alg->InitH ? alg->InitH : zeroh);
+            next++;
+            nactive++;
+        }
+        if(nactive < nlanes)
+            break;
+
+        /* every lane has at least 1 block left (finished lanes are retired right away) */
+        for(j = 0; j < nlanes; j++)
+            tchash_i_mb_words_(alg, Wbytes + j * alg->wsize, nlanes, tchash_i_mb_lane_next_(alg, &lanes[j]));
+        kernel(S, W, alg->bsize / alg->wsize);
+
+        for(j = 0; j < nlanes; j++)
+        {
+            TCHash_I_MBLane_* lane = &lanes[j];
+            if(lane->nfull || lane->itail < lane->ntail) continue;
+            tchash_i_mb_column_get_(alg, S, nlanes, j, h);
+            tchash_i_mb_digest_(alg, digests[lane->idx], h);
+            lane->idx = TCHASH_I_MB_INACTIVE_;
+            nactive--;
+        }
+    }
+
+    /* not enough messages left to fill every lane; finish the stragglers one by one */
+    for(j = 0; j < nlanes; j++)
+    {
+        TCHash_I_MBLane_* lane = &lanes[j];
+        const unsigned char* block;
+        if(lane->idx == TCHASH_I_MB_INACTIVE_) continue;
+        tchash_i_mb_column_get_(alg, S, nlanes, j, h);
+        while((block = tchash_i_mb_lane_next_(alg, lane)))
+        {
+            tchash_i_mb_words_(alg, W, 1, block);
+            alg->scalar(h, W);
+        }
+        tchash_i_mb_digest_(alg, digests[lane->idx], h);
+    }
+}
+
+/*
+ * The kernels are written once, in terms of the `TCHASH_I_V_*` operations, and
+ * then expanded for each instruction set (with the operations redefined).
+ */
+#define TCHASH_I_MB_MD5_F_(B,C,D)   TCHASH_I_V_XOR_(D, TCHASH_I_V_AND_(B, TCHASH_I_V_XOR_(C, D)))
+#define TCHASH_I_MB_MD5_G_(B,C,D)   TCHASH_I_V_XOR_(C, TCHASH_I_V_AND_(D, TCHASH_I_V_XOR_(B, C)))
+#define TCHASH_I_MB_MD5_H_(B,C,D)   TCHASH_I_V_XOR_(TCHASH_I_V_XOR_(B, C), D)
+#define TCHASH_I_MB_MD5_I_(B,C,D)   TCHASH_I_V_XOR_(C, TCHASH_I_V_OR_(B, TCHASH_I_V_XOR_(D, TCHASH_I_V_SET32_(UINT32_C(0xFFFFFFFF)))))
+#define TCHASH_I_MB_MD5_STEP_(F,A,B,C,D,G,S,I)                                 \
+    A = TCHASH_I_V_ADD32_(B, TCHASH_I_V_ROTL32_(TCHASH_I_V_ADD32_(TCHASH_I_V_ADD32_(A, F(B,C,D)), TCHASH_I_V_ADD32_(TCHASH_I_V_SET32_(tchash_i_md5_K[I]), TCHASH_I_V_LOAD_(&uW[(G)*nl]))), S))
+#define TCHASH_I_MB_MD5_BODY_(NL)                                              \
+    const size_t nl = (NL);                                                    \
+    const uint32_t* uW = TC__VOID_CAST(const uint32_t*,W);                     \
+    uint32_t* uS = TC__VOID_CAST(uint32_t*,S);                                 \
+    TCHASH_I_V_ a = TCHASH_I_V_LOAD_(&uS[0*(NL)]), a0 = a;                     \
+    TCHASH_I_V_ b = TCHASH_I_V_LOAD_(&uS[1*(NL)]), b0 = b;                     \
+    TCHASH_I_V_ c = TCHASH_I_V_LOAD_(&uS[2*(NL)]), c0 = c;                     \
+    TCHASH_I_V_ d = TCHASH_I_V_LOAD_(&uS[3*(NL)]), d0 = d;                     \
+    int i;                                                                     \
+    (void)nw;                                                                  \
+    for(i = 0; i < 16; i += 4)                                                 \
+    {                                                                          \
+        TCHASH_I_MB_MD5_STEP_(TCHASH_I_MB_MD5_F_,a,b,c,d,i+0, 7,i+0);          \
+        TCHASH_I_MB_MD5_STEP_(TCHASH_I_MB_MD5_F_,d,a,b,c,i+1,12,i+1);          \
+        TCHASH_I_MB_MD5_STEP_(TCHASH_I_MB_MD5_F_,c,d,a,b,i+2,17,i+2);          \
+        TCHASH_I_MB_MD5_STEP_(TCHASH_I_MB_MD5_F_,b,c,d,a,i+3,22,i+3);          \
+    }                                                                          \
+    for(i = 16; i < 32; i += 4)                                                \
+    {                                                                          \
+        TCHASH_I_MB_MD5_STEP_(TCHASH_I_MB_MD5_G_,a,b,c,d,(5*i+ 1)&15, 5,i+0);  \
+        TCHASH_I_MB_MD5_STEP_(TCHASH_I_MB_MD5_G_,d,a,b,c,(5*i+ 6)&15, 9,i+1);  \
+        TCHASH_I_MB_MD5_STEP_(TCHASH_I_MB_MD5_G_,c,d,a,b,(5*i+11)&15,14,i+2);  \
+        TCHASH_I_MB_MD5_STEP_(TCHASH_I_MB_MD5_G_,b,c,d,a,(5*i+16)&15,20,i+3);  \
+    }                                                                          \
+    for(i = 32; i < 48; i += 4)                                                \
+    {                                                                          \
+        TCHASH_I_MB_MD5_STEP_(TCHASH_I_MB_MD5_H_,a,b,c,d,(3*i+ 5)&15, 4,i+0);  \
+        TCHASH_I_MB_MD5_STEP_(TCHASH_I_MB_MD5_H_,d,a,b,c,(3*i+ 8)&15,11,i+1);  \
+        TCHASH_I_MB_MD5_STEP_(TCHASH_I_MB_MD5_H_,c,d,a,b,(3*i+11)&15,16,i+2);  \
+        TCHASH_I_MB_MD5_STEP_(TCHASH_I_MB_MD5_H_,b,c,d,a,(3*i+14)&15,23,i+3);  \
+    }                                                                          \
+    for(i = 48; i < 64; i += 4)                                                \
+    {                                                                          \
+        TCHASH_I_MB_MD5_STEP_(TCHASH_I_MB_MD5_I_,a,b,c,d,(7*i+ 0)&15, 6,i+0);  \
+        TCHASH_I_MB_MD5_STEP_(TCHASH_I_MB_MD5_I_,d,a,b,c,(7*i+ 7)&15,10,i+1);  \
+        TCHASH_I_MB_MD5_STEP_(TCHASH_I_MB_MD5_I_,c,d,a,b,(7*i+14)&15,15,i+2);  \
+        TCHASH_I_MB_MD5_STEP_(TCHASH_I_MB_MD5_I_,b,c,d,a,(7*i+21)&15,21,i+3);  \
+    }                                                                          \
+    TCHASH_I_V_STORE_(&uS[0*(NL)], TCHASH_I_V_ADD32_(a, a0));                  \
+    TCHASH_I_V_STORE_(&uS[1*(NL)], TCHASH_I_V_ADD32_(b, b0));                  \
+    TCHASH_I_V_STORE_(&uS[2*(NL)], TCHASH_I_V_ADD32_(c, c0));                  \
+    TCHASH_I_V_STORE_(&uS[3*(NL)], TCHASH_I_V_ADD32_(d, d0));
+
+#define TCHASH_I_MB_SHA2_256_BODY_(NL)                                         \
+    const uint32_t* uW = TC__VOID_CAST(const uint32_t*,W);                     \
+    uint32_t* uS = TC__VOID_CAST(uint32_t*,S);                                 \
+    TCHASH_I_V_ H0[8], w[16];                                                  \
+    int i;                                                                     \
+    (void)nw;                                                                  \
+    for(i = 0; i < 8; i++)                                                     \
+        H0[i] = TCHASH_I_V_LOAD_(&uS[i*(NL)]);                                 \
+    TCHASH_I_V_ a = H0[0], b = H0[1], c = H0[2], d = H0[3], e = H0[4], f = H0[5], g = H0[6], h = H0[7];\
+    for(i = 0; i < 64; i++)                                                    \
+    {                                                                          \
+        TCHASH_I_V_ wi;                                                        \
+        if(i < 16)                                                             \
+            wi = TCHASH_I_V_LOAD_(&uW[i*(NL)]);                                \
+        else                                                                   \
+        {                                                                      \
+            TCHASH_I_V_ w15 = w[(i-15)&15], w2 = w[(i-2)&15];                  \
+            TCHASH_I_V_ s0 = TCHASH_I_V_XOR_(TCHASH_I_V_XOR_(TCHASH_I_V_ROTR32_(w15, 7), TCHASH_I_V_ROTR32_(w15,18)), TCHASH_I_V_SHR32_(w15, 3));\
+            TCHASH_I_V_ s1 = TCHASH_I_V_XOR_(TCHASH_I_V_XOR_(TCHASH_I_V_ROTR32_(w2,17), TCHASH_I_V_ROTR32_(w2,19)), TCHASH_I_V_SHR32_(w2,10));\
+            wi = TCHASH_I_V_ADD32_(TCHASH_I_V_ADD32_(w[i&15], s0), TCHASH_I_V_ADD32_(w[(i-7)&15], s1));\
+        }                                                                      \
+        w[i&15] = wi;                                                          \
+        TCHASH_I_V_ S1 = TCHASH_I_V_XOR_(TCHASH_I_V_XOR_(TCHASH_I_V_ROTR32_(e, 6), TCHASH_I_V_ROTR32_(e,11)), TCHASH_I_V_ROTR32_(e,25));\
+        TCHASH_I_V_ ch = TCHASH_I_V_XOR_(g, TCHASH_I_V_AND_(e, TCHASH_I_V_XOR_(f, g)));\
+        TCHASH_I_V_ temp1 = TCHASH_I_V_ADD32_(TCHASH_I_V_ADD32_(h, S1), TCHASH_I_V_ADD32_(ch, TCHASH_I_V_ADD32_(TCHASH_I_V_SET32_(tchash_i_sha2_256_K[i]), wi)));\
+        TCHASH_I_V_ S0 = TCHASH_I_V_XOR_(TCHASH_I_V_XOR_(TCHASH_I_V_ROTR32_(a, 2), TCHASH_I_V_ROTR32_(a,13)), TCHASH_I_V_ROTR32_(a,22));\
+        TCHASH_I_V_ maj = TCHASH_I_V_OR_(TCHASH_I_V_AND_(a, b), TCHASH_I_V_AND_(c, TCHASH_I_V_OR_(a, b)));\
+        TCHASH_I_V_ temp2 = TCHASH_I_V_ADD32_(S0, maj);                        \
+                                                                               \
+        h = g;                                                                 \
+        g = f;                                                                 \
+        f = e;                                                                 \
+        e = TCHASH_I_V_ADD32_(d, temp1);                                       \
+        d = c;                                                                 \
+        c = b;                                                                 \
+        b = a;                                                                 \
+        a = TCHASH_I_V_ADD32_(temp1, temp2);                                   \
+    }                                                                          \
+    TCHASH_I_V_STORE_(&uS[0*(NL)], TCHASH_I_V_ADD32_(a, H0[0]));               \
+    TCHASH_I_V_STORE_(&uS[1*(NL)], TCHASH_I_V_ADD32_(b, H0[1]));               \
+    TCHASH_I_V_STORE_(&uS[2*(NL)], TCHASH_I_V_ADD32_(c, H0[2]));               \
+    TCHASH_I_V_STORE_(&uS[3*(NL)], TCHASH_I_V_ADD32_(d, H0[3]));               \
+    TCHASH_I_V_STORE_(&uS[4*(NL)], TCHASH_I_V_ADD32_(e, H0[4]));               \
+    TCHASH_I_V_STORE_(&uS[5*(NL)], TCHASH_I_V_ADD32_(f, H0[5]));               \
+    TCHASH_I_V_STORE_(&uS[6*(NL)], TCHASH_I_V_ADD32_(g, H0[6]));               \
+    TCHASH_I_V_STORE_(&uS[7*(NL)], TCHASH_I_V_ADD32_(h, H0[7]));
+
+/* Keccak-p[1600,24] with absorption of `nw` words; unrolled like `tchash_i_keccak_p1600()` (but without lane complementing) */
+#define TCHASH_I_MB_KECCAK_ROUND_(A,E,RC)                                      \
+    do {                                                                       \
+        TCHASH_I_V_ C0 = TCHASH_I_V_XOR3_(TCHASH_I_V_XOR3_(A##00, A##05, A##10), A##15, A##20);\
+        TCHASH_I_V_ C1 = TCHASH_I_V_XOR3_(TCHASH_I_V_XOR3_(A##01, A##06, A##11), A##16, A##21);\
+        TCHASH_I_V_ C2 = TCHASH_I_V_XOR3_(TCHASH_I_V_XOR3_(A##02, A##07, A##12), A##17, A##22);\
+        TCHASH_I_V_ C3 = TCHASH_I_V_XOR3_(TCHASH_I_V_XOR3_(A##03, A##08, A##13), A##18, A##23);\
+        TCHASH_I_V_ C4 = TCHASH_I_V_XOR3_(TCHASH_I_V_XOR3_(A##04, A##09, A##14), A##19, A##24);\
+        TCHASH_I_V_ D0 = TCHASH_I_V_XORROTL1_(C4, C1);                         \
+        TCHASH_I_V_ D1 = TCHASH_I_V_XORROTL1_(C0, C2);                         \
+        TCHASH_I_V_ D2 = TCHASH_I_V_XORROTL1_(C1, C3);                         \
+        TCHASH_I_V_ D3 = TCHASH_I_V_XORROTL1_(C2, C4);                         \
+        TCHASH_I_V_ D4 = TCHASH_I_V_XORROTL1_(C3, C0);                         \
+        TCHASH_I_V_ B0, B1, B2, B3, B4;                                        \
+        B0 = TCHASH_I_V_XOR_(A##00, D0);                                       \
+        B1 = TCHASH_I_V_XORROTL64_(A##06, D1, 44);                             \
+        B2 = TCHASH_I_V_XORROTL64_(A##12, D2, 43);                             \
+        B3 = TCHASH_I_V_XORROTL64_(A##18, D3, 21);                             \
+        B4 = TCHASH_I_V_XORROTL64_(A##24, D4, 14);                             \
+        E##00 = TCHASH_I_V_XOR_(TCHASH_I_V_CHI_(B0, B1, B2), TCHASH_I_V_SET64_(RC));\
+        E##01 = TCHASH_I_V_CHI_(B1, B2, B3);                                   \
+        E##02 = TCHASH_I_V_CHI_(B2, B3, B4);                                   \
+        E##03 = TCHASH_I_V_CHI_(B3, B4, B0);                                   \
+        E##04 = TCHASH_I_V_CHI_(B4, B0, B1);                                   \
+        B0 = TCHASH_I_V_XORROTL64_(A##03, D3, 28);                             \
+        B1 = TCHASH_I_V_XORROTL64_(A##09, D4, 20);                             \
+        B2 = TCHASH_I_V_XORROTL64_(A##10, D0, 3);                              \
+        B3 = TCHASH_I_V_XORROTL64_(A##16, D1, 45);                             \
+        B4 = TCHASH_I_V_XORROTL64_(A##22, D2, 61);                             \
+        E##05 = TCHASH_I_V_CHI_(B0, B1, B2);                                   \
+        E##06 = TCHASH_I_V_CHI_(B1, B2, B3);                                   \
+        E##07 = TCHASH_I_V_CHI_(B2, B3, B4);                                   \
+        E##08 = TCHASH_I_V_CHI_(B3, B4, B0);                                   \
+        E##09 = TCHASH_I_V_CHI_(B4, B0, B1);                                   \
+        B0 = TCHASH_I_V_XORROTL64_(A##01, D1, 1);                              \
+        B1 = TCHASH_I_V_XORROTL64_(A##07, D2, 6);                              \
+        B2 = TCHASH_I_V_XORROTL64_(A##13, D3, 25);                             \
+        B3 = TCHASH_I_V_XORROTL64_(A##19, D4, 8);                              \
+        B4 = TCHASH_I_V_XORROTL64_(A##20, D0, 18);                             \
+        E##10 = TCHASH_I_V_CHI_(B0, B1, B2);                                   \
+        E##11 = TCHASH_I_V_CHI_(B1, B2, B3);                                   \
+        E##12 = TCHASH_I_V_CHI_(B2, B3, B4);                                   \
+        E##13 = TCHASH_I_V_CHI_(B3, B4, B0);                                   \
+        E##14 = TCHASH_I_V_CHI_(B4, B0, B1);                                   \
+        B0 = TCHASH_I_V_XORROTL64_(A##04, D4, 27);                             \
+        B1 = TCHASH_I_V_XORROTL64_(A##05, D0, 36);                             \
+        B2 = TCHASH_I_V_XORROTL64_(A##11, D1, 10);                             \
+        B3 = TCHASH_I_V_XORROTL64_(A##17, D2, 15);                             \
+        B4 = TCHASH_I_V_XORROTL64_(A##23, D3, 56);                             \
+        E##15 = TCHASH_I_V_CHI_(B0, B1, B2);                                   \
+        E##16 = TCHASH_I_V_CHI_(B1, B2, B3);                                   \
+        E##17 = TCHASH_I_V_CHI_(B2, B3, B4);                                   \
+        E##18 = TCHASH_I_V_CHI_(B3, B4, B0);                                   \
+        E##19 = TCHASH_I_V_CHI_(B4, B0, B1);                                   \
+        B0 = TCHASH_I_V_XORROTL64_(A##02, D2, 62);                             \
+        B1 = TCHASH_I_V_XORROTL64_(A##08, D3, 55);                             \
+        B2 = TCHASH_I_V_XORROTL64_(A##14, D4, 39);                             \
+        B3 = TCHASH_I_V_XORROTL64_(A##15, D0, 41);                             \
+        B4 = TCHASH_I_V_XORROTL64_(A##21, D1, 2);                              \
+        E##20 = TCHASH_I_V_CHI_(B0, B1, B2);                                   \
+        E##21 = TCHASH_I_V_CHI_(B1, B2, B3);                                   \
+        E##22 = TCHASH_I_V_CHI_(B2, B3, B4);                                   \
+        E##23 = TCHASH_I_V_CHI_(B3, B4, B0);                                   \
+        E##24 = TCHASH_I_V_CHI_(B4, B0, B1);                                   \
+    } while(0)
+#define TCHASH_I_MB_KECCAK_BODY_(NL)                                           \
+    const uint64_t* uW = TC__VOID_CAST(const uint64_t*,W);                     \
+    uint64_t* uS = TC__VOID_CAST(uint64_t*,S);                                 \
+    TCHASH_I_V_ T[25];                                                         \
+    size_t i;                                                                  \
+    int ir;                                                                    \
+    for(i = 0; i < 25; i++)                                                    \
+        T[i] = TCHASH_I_V_LOAD_(&uS[i*(NL)]);                                  \
+    for(i = 0; i < nw; i++)                                                    \
+        T[i] = TCHASH_I_V_XOR_(T[i], TCHASH_I_V_LOAD_(&uW[i*(NL)]));           \
+    TCHASH_I_V_ A00 = T[ 0], A01 = T[ 1], A02 = T[ 2], A03 = T[ 3], A04 = T[ 4];\
+    TCHASH_I_V_ A05 = T[ 5], A06 = T[ 6], A07 = T[ 7], A08 = T[ 8], A09 = T[ 9];\
+    TCHASH_I_V_ A10 = T[10], A11 = T[11], A12 = T[12], A13 = T[13], A14 = T[14];\
+    TCHASH_I_V_ A15 = T[15], A16 = T[16], A17 = T[17], A18 = T[18], A19 = T[19];\
+    TCHASH_I_V_ A20 = T[20], A21 = T[21], A22 = T[22], A23 = T[23], A24 = T[24];\
+    TCHASH_I_V_ E00, E01, E02, E03, E04, E05, E06, E07, E08, E09, E10, E11, E12;\
+    TCHASH_I_V_ E13, E14, E15, E16, E17, E18, E19, E20, E21, E22, E23, E24;    \
+    for(ir = 0; ir < 12 + 2 * TCHASH_I_KECCAK1600_L; ir += 2)                  \
+    {                                                                          \
+        TCHASH_I_MB_KECCAK_ROUND_(A,E,tchash_i_keccak_p1600_RC[ir]);           \
+        TCHASH_I_MB_KECCAK_ROUND_(E,A,tchash_i_keccak_p1600_RC[ir + 1]);       \
+    }                                                                          \
+    T[ 0] = A00; T[ 1] = A01; T[ 2] = A02; T[ 3] = A03; T[ 4] = A04;           \
+    T[ 5] = A05; T[ 6] = A06; T[ 7] = A07; T[ 8] = A08; T[ 9] = A09;           \
+    T[10] = A10; T[11] = A11; T[12] = A12; T[13] = A13; T[14] = A14;           \
+    T[15] = A15; T[16] = A16; T[17] = A17; T[18] = A18; T[19] = A19;           \
+    T[20] = A20; T[21] = A21; T[22] = A22; T[23] = A23; T[24] = A24;           \
+    for(i = 0; i < 25; i++)                                                    \
+        TCHASH_I_V_STORE_(&uS[i*(NL)], T[i]);
+
+#define TCHASH_I_MB_KERNELS_DEF_(ISA,N32,N64)                                  \
+    TCHASH_I_MB_TARGET_ static void tchash_i_md5_mb_##ISA(void* S, const void* W, size_t nw) { TCHASH_I_MB_MD5_BODY_(N32) }\
+    TCHASH_I_MB_TARGET_ static void tchash_i_sha2_256_mb_##ISA(void* S, const void* W, size_t nw) { TCHASH_I_MB_SHA2_256_BODY_(N32) }\
+    TCHASH_I_MB_TARGET_ static void tchash_i_keccak_mb_##ISA(void* S, const void* W, size_t nw) { TCHASH_I_MB_KECCAK_BODY_(N64) }
+
+#if defined(TCHASH_I_ACCEL_X86_)
+/* SSE2: 4x32-bit, 2x64-bit */
+#define TCHASH_I_MB_TARGET_         TCHASH_I_TARGET_X86_("sse2")
+#define TCHASH_I_V_                 __m128i
+#define TCHASH_I_V_LOAD_(p)         _mm_loadu_si128((const __m128i*)(p))
+#define TCHASH_I_V_STORE_(p,x)      _mm_storeu_si128((__m128i*)(p), x)
+#define TCHASH_I_V_SET32_(c)        _mm_set1_epi32(TC__STATIC_CAST(int,c))
+#define TCHASH_I_V_SET64_(c)        _mm_set1_epi64x(TC__STATIC_CAST(long long,c))
+#define TCHASH_I_V_ADD32_(a,b)      _mm_add_epi32(a, b)
+#define TCHASH_I_V_XOR_(a,b)        _mm_xor_si128(a, b)
+#define TCHASH_I_V_AND_(a,b)        _mm_and_si128(a, b)
+#define TCHASH_I_V_OR_(a,b)         _mm_or_si128(a, b)
+#define TCHASH_I_V_ANDNOT_(a,b)     _mm_andnot_si128(a, b)
+#define TCHASH_I_V_SHR32_(x,n)      _mm_srli_epi32(x, n)
+#define TCHASH_I_V_ROTL32_(x,n)     _mm_or_si128(_mm_slli_epi32(x, n), _mm_srli_epi32(x, 32-(n)))
+#define TCHASH_I_V_ROTR32_(x,n)     _mm_or_si128(_mm_srli_epi32(x, n), _mm_slli_epi32(x, 32-(n)))
+#define TCHASH_I_V_ROTL64_(x,n)     _mm_or_si128(_mm_slli_epi64(x, n), _mm_srli_epi64(x, 64-(n)))
+#define TCHASH_I_V_XOR3_(a,b,c)     TCHASH_I_V_XOR_(TCHASH_I_V_XOR_(a, b), c)
+#define TCHASH_I_V_XORROTL1_(a,b)   TCHASH_I_V_XOR_(a, TCHASH_I_V_ROTL64_(b, 1))
+#define TCHASH_I_V_XORROTL64_(a,b,n) TCHASH_I_V_ROTL64_(TCHASH_I_V_XOR_(a, b), n)
+#define TCHASH_I_V_CHI_(a,b,c)      TCHASH_I_V_XOR_(a, TCHASH_I_V_ANDNOT_(b, c))
+TCHASH_I_MB_KERNELS_DEF_(sse2,4,2)
+#undef TCHASH_I_MB_TARGET_
+#undef TCHASH_I_V_
+#undef TCHASH_I_V_LOAD_
+#undef TCHASH_I_V_STORE_
+#undef TCHASH_I_V_SET32_
+#undef TCHASH_I_V_SET64_
+#undef TCHASH_I_V_ADD32_
+#undef TCHASH_I_V_XOR_
+#undef TCHASH_I_V_AND_
+#undef TCHASH_I_V_OR_
+#undef TCHASH_I_V_ANDNOT_
+#undef TCHASH_I_V_SHR32_
+#undef TCHASH_I_V_ROTL32_
+#undef TCHASH_I_V_ROTR32_
+#undef TCHASH_I_V_ROTL64_
+#undef TCHASH_I_V_XOR3_
+#undef TCHASH_I_V_XORROTL1_
+#undef TCHASH_I_V_XORROTL64_
+#undef TCHASH_I_V_CHI_
+
+/* AVX2: 8x32-bit, 4x64-bit */
+#define TCHASH_I_MB_TARGET_         TCHASH_I_TARGET_X86_("avx2")
+#define TCHASH_I_V_                 __m256i
+#define TCHASH_I_V_LOAD_(p)         _mm256_loadu_si256((const __m256i*)(p))
+#define TCHASH_I_V_STORE_(p,x)      _mm256_storeu_si256((__m256i*)(p), x)
+#define TCHASH_I_V_SET32_(c)        _mm256_set1_epi32(TC__STATIC_CAST(int,c))
+#define TCHASH_I_V_SET64_(c)        _mm256_set1_epi64x(TC__STATIC_CAST(long long,c))
+#define TCHASH_I_V_ADD32_(a,b)      _mm256_add_epi32(a, b)
+#define TCHASH_I_V_XOR_(a,b)        _mm256_xor_si256(a, b)
+#define TCHASH_I_V_AND_(a,b)        _mm256_and_si256(a, b)
+#define TCHASH_I_V_OR_(a,b)         _mm256_or_si256(a, b)
+#define TCHASH_I_V_ANDNOT_(a,b)     _mm256_andnot_si256(a, b)
+#define TCHASH_I_V_SHR32_(x,n)      _mm256_srli_epi32(x, n)
+#define TCHASH_I_V_ROTL32_(x,n)     _mm256_or_si256(_mm256_slli_epi32(x, n), _mm256_srli_epi32(x, 32-(n)))
+#define TCHASH_I_V_ROTR32_(x,n)     _mm256_or_si256(_mm256_srli_epi32(x, n), _mm256_slli_epi32(x, 32-(n)))
+#define TCHASH_I_V_ROTL64_(x,n)     _mm256_or_si256(_mm256_slli_epi64(x, n), _mm256_srli_epi64(x, 64-(n)))
+#define TCHASH_I_V_XOR3_(a,b,c)     TCHASH_I_V_XOR_(TCHASH_I_V_XOR_(a, b), c)
+#define TCHASH_I_V_XORROTL1_(a,b)   TCHASH_I_V_XOR_(a, TCHASH_I_V_ROTL64_(b, 1))
+#define TCHASH_I_V_XORROTL64_(a,b,n) TCHASH_I_V_ROTL64_(TCHASH_I_V_XOR_(a, b), n)
+#define TCHASH_I_V_CHI_(a,b,c)      TCHASH_I_V_XOR_(a, TCHASH_I_V_ANDNOT_(b, c))
+TCHASH_I_MB_KERNELS_DEF_(avx2,8,4)
+#undef TCHASH_I_MB_TARGET_
+#undef TCHASH_I_V_
+#undef TCHASH_I_V_LOAD_
+#undef TCHASH_I_V_STORE_
+#undef TCHASH_I_V_SET32_
+#undef TCHASH_I_V_SET64_
+#undef TCHASH_I_V_ADD32_
+#undef TCHASH_I_V_XOR_
+#undef TCHASH_I_V_AND_
+#undef TCHASH_I_V_OR_
+#undef TCHASH_I_V_ANDNOT_
+#undef TCHASH_I_V_SHR32_
+#undef TCHASH_I_V_ROTL32_
+#undef TCHASH_I_V_ROTR32_
+#undef TCHASH_I_V_ROTL64_
+#undef TCHASH_I_V_XOR3_
+#undef TCHASH_I_V_XORROTL1_
+#undef TCHASH_I_V_XORROTL64_
+#undef TCHASH_I_V_CHI_
+
+/* AVX-512F: 16x32-bit, 8x64-bit (with native rotates) */
+#define TCHASH_I_MB_TARGET_         TCHASH_I_TARGET_X86_("avx512f")
+#define TCHASH_I_V_                 __m512i
+#define TCHASH_I_V_LOAD_(p)         _mm512_loadu_si512((const void*)(p))
+#define TCHASH_I_V_STORE_(p,x)      _mm512_storeu_si512((void*)(p), x)
+#define TCHASH_I_V_SET32_(c)        _mm512_set1_epi32(TC__STATIC_CAST(int,c))
+#define TCHASH_I_V_SET64_(c)        _mm512_set1_epi64(TC__STATIC_CAST(long long,c))
+#define TCHASH_I_V_ADD32_(a,b)      _mm512_add_epi32(a, b)
+#define TCHASH_I_V_XOR_(a,b)        _mm512_xor_si512(a, b)
+#define TCHASH_I_V_AND_(a,b)        _mm512_and_si512(a, b)
+#define TCHASH_I_V_OR_(a,b)         _mm512_or_si512(a, b)
+#define TCHASH_I_V_ANDNOT_(a,b)     _mm512_andnot_si512(a, b)
+#define TCHASH_I_V_SHR32_(x,n)      _mm512_srli_epi32(x, n)
+#define TCHASH_I_V_ROTL32_(x,n)     _mm512_rol_epi32(x, n)
+#define TCHASH_I_V_ROTR32_(x,n)     _mm512_ror_epi32(x, n)
+#define TCHASH_I_V_ROTL64_(x,n)     _mm512_rol_epi64(x, n)
+#define TCHASH_I_V_XOR3_(a,b,c)     _mm512_ternarylogic_epi64(a, b, c, 0x96)
+#define TCHASH_I_V_XORROTL1_(a,b)   _mm512_xor_si512(a, _mm512_rol_epi64(b, 1))
+#define TCHASH_I_V_XORROTL64_(a,b,n) _mm512_rol_epi64(_mm512_xor_si512(a, b), n)
+#define TCHASH_I_V_CHI_(a,b,c)      _mm512_ternarylogic_epi64(a, b, c, 0xD2)
+TCHASH_I_MB_KERNELS_DEF_(avx512,16,8)
+#undef TCHASH_I_MB_TARGET_
+#undef TCHASH_I_V_
+#undef TCHASH_I_V_LOAD_
+#undef TCHASH_I_V_STORE_
+#undef TCHASH_I_V_SET32_
+#undef TCHASH_I_V_SET64_
+#undef TCHASH_I_V_ADD32_
+#undef TCHASH_I_V_XOR_
+#undef TCHASH_I_V_AND_
+#undef TCHASH_I_V_OR_
+#undef TCHASH_I_V_ANDNOT_
+#undef TCHASH_I_V_SHR32_
+#undef TCHASH_I_V_ROTL32_
+#undef TCHASH_I_V_ROTR32_
+#undef TCHASH_I_V_ROTL64_
+#undef TCHASH_I_V_XOR3_
+#undef TCHASH_I_V_XORROTL1_
+#undef TCHASH_I_V_XORROTL64_
+#undef TCHASH_I_V_CHI_
+#define TCHASH_I_MB_KERNELS_(LHASH) tchash_i_##LHASH##_mb_sse2, tchash_i_##LHASH##_mb_avx2, tchash_i_##LHASH##_mb_avx512
+#elif defined(TCHASH_I_ACCEL_ARM_)
+/* NEON: 4x32-bit, 2x64-bit (64-bit lanes only need bitwise ops & shifts, so they share the type) */
+#define TCHASH_I_MB_TARGET_
+#define TCHASH_I_V_                 uint32x4_t
+#define TCHASH_I_V_LOAD_(p)         vld1q_u32((const uint32_t*)(p))
+#define TCHASH_I_V_STORE_(p,x)      vst1q_u32((uint32_t*)(p), x)
+#define TCHASH_I_V_SET32_(c)        vdupq_n_u32(c)
+#define TCHASH_I_V_SET64_(c)        vreinterpretq_u32_u64(vdupq_n_u64(c))
+#define TCHASH_I_V_ADD32_(a,b)      vaddq_u32(a, b)
+#define TCHASH_I_V_XOR_(a,b)        veorq_u32(a, b)
+#define TCHASH_I_V_AND_(a,b)        vandq_u32(a, b)
+#define TCHASH_I_V_OR_(a,b)         vorrq_u32(a, b)
+#define TCHASH_I_V_ANDNOT_(a,b)     vbicq_u32(b, a)
+#define TCHASH_I_V_SHR32_(x,n)      vshrq_n_u32(x, n)
+#define TCHASH_I_V_ROTL32_(x,n)     vsriq_n_u32(vshlq_n_u32(x, n), x, 32-(n))
+#define TCHASH_I_V_ROTR32_(x,n)     vsriq_n_u32(vshlq_n_u32(x, 32-(n)), x, n)
+#define TCHASH_I_V_ROTL64_(x,n)     vreinterpretq_u32_u64(vsriq_n_u64(vshlq_n_u64(vreinterpretq_u64_u32(x), n), vreinterpretq_u64_u32(x), 64-(n)))
+#define TCHASH_I_V_XOR3_(a,b,c)     TCHASH_I_V_XOR_(TCHASH_I_V_XOR_(a, b), c)
+#define TCHASH_I_V_XORROTL1_(a,b)   TCHASH_I_V_XOR_(a, TCHASH_I_V_ROTL64_(b, 1))
+#define TCHASH_I_V_XORROTL64_(a,b,n) TCHASH_I_V_ROTL64_(TCHASH_I_V_XOR_(a, b), n)
+#define TCHASH_I_V_CHI_(a,b,c)      TCHASH_I_V_XOR_(a, TCHASH_I_V_ANDNOT_(b, c))
+TCHASH_I_MB_KERNELS_DEF_(neon,4,2)
+#undef TCHASH_I_MB_TARGET_
+#undef TCHASH_I_V_
+#undef TCHASH_I_V_LOAD_
+#undef TCHASH_I_V_STORE_
+#undef TCHASH_I_V_SET32_
+#undef TCHASH_I_V_SET64_
+#undef TCHASH_I_V_ADD32_
+#undef TCHASH_I_V_XOR_
+#undef TCHASH_I_V_AND_
+#undef TCHASH_I_V_OR_
+#undef TCHASH_I_V_ANDNOT_
+#undef TCHASH_I_V_SHR32_
+#undef TCHASH_I_V_ROTL32_
+#undef TCHASH_I_V_ROTR32_
+#undef TCHASH_I_V_ROTL64_
+#undef TCHASH_I_V_XOR3_
+#undef TCHASH_I_V_XORROTL1_
+#undef TCHASH_I_V_XORROTL64_
+#undef TCHASH_I_V_CHI_
+#ifdef TCHASH_I_ACCEL_ARM_SHA3_
+/* NEON + SHA3 extension (Keccak only): EOR3, RAX1, XAR & BCAX map directly onto theta, rho & chi */
+#define TCHASH_I_MB_TARGET_         TCHASH_I_TARGET_ARM_SHA3_
+#define TCHASH_I_V_                 uint64x2_t
+#define TCHASH_I_V_LOAD_(p)         vld1q_u64((const uint64_t*)(p))
+#define TCHASH_I_V_STORE_(p,x)      vst1q_u64((uint64_t*)(p), x)
+#define TCHASH_I_V_SET64_(c)        vdupq_n_u64(c)
+#define TCHASH_I_V_XOR_(a,b)        veorq_u64(a, b)
+#define TCHASH_I_V_XOR3_(a,b,c)     veor3q_u64(a, b, c)
+#define TCHASH_I_V_XORROTL1_(a,b)   vrax1q_u64(a, b)
+#define TCHASH_I_V_XORROTL64_(a,b,n) vxarq_u64(a, b, 64-(n))
+#define TCHASH_I_V_CHI_(a,b,c)      vbcaxq_u64(a, c, b)
+TCHASH_I_MB_TARGET_ static void tchash_i_keccak_mb_neon_sha3(void* S, const void* W, size_t nw) { TCHASH_I_MB_KECCAK_BODY_(2) }
+#undef TCHASH_I_MB_TARGET_
+#undef TCHASH_I_V_
+#undef TCHASH_I_V_LOAD_
+#undef TCHASH_I_V_STORE_
+#undef TCHASH_I_V_SET64_
+#undef TCHASH_I_V_XOR_
+#undef TCHASH_I_V_XOR3_
+#undef TCHASH_I_V_XORROTL1_
+#undef TCHASH_I_V_XORROTL64_
+#undef TCHASH_I_V_CHI_
+#endif /* TCHASH_I_ACCEL_ARM_SHA3_ */
+#define TCHASH_I_MB_KERNELS_(LHASH) tchash_i_##LHASH##_mb_neon, NULL, NULL
+#else
+#define TCHASH_I_MB_KERNELS_(LHASH) NULL, NULL, NULL
+#endif
+
+/* returns the number of lanes, or 0 if there is no SIMD kernel available */
+static size_t tchash_i_mb_select_(tchash_i_mb_kernel_** kernel, size_t wsize, tchash_i_mb_kernel_* k128, tchash_i_mb_kernel_* k256, tchash_i_mb_kernel_* k512)
+{
+    unsigned int accel = tchash_accel_get();
+    size_t nl128 = 16 / wsize;
+#if defined(TCHASH_I_ACCEL_X86_)
+    if(accel & TCHASH_ACCEL_X86_AVX512) { *kernel = k512; return 4 * nl128; }
+    if(accel & TCHASH_ACCEL_X86_AVX2) { *kernel = k256; return 2 * nl128; }
+    if(accel & TCHASH_ACCEL_X86_SSE2) { *kernel = k128; return nl128; }
+#elif defined(TCHASH_I_ACCEL_ARM_)
+    (void)k256; (void)k512;
+    if(accel & TCHASH_ACCEL_ARM_NEON) { *kernel = k128; return nl128; }
+#else
+    (void)accel; (void)nl128; (void)k128; (void)k256; (void)k512;
+#endif
+    *kernel = NULL;
+    return 0;
+}
+
+/* as above, but Keccak also has a NEON variant using the SHA3 extension */
+static size_t tchash_i_keccak_mb_select_(tchash_i_mb_kernel_** kernel)
+{
+    size_t nlanes = tchash_i_mb_select_(kernel, 8, TCHASH_I_MB_KERNELS_(keccak));
+#ifdef TCHASH_I_ACCEL_ARM_SHA3_
+    if(nlanes && (tchash_accel_get() & TCHASH_ACCEL_ARM_SHA3))
+        *kernel = tchash_i_keccak_mb_neon_sha3;
+#endif
+    return nlanes;
+}
+
+static void tchash_i_md5_mb_scalar_(void* h, const void* M) { tchash_i_md5_process_block(TC__VOID_CAST(uint32_t*,h), TC__VOID_CAST(const uint32_t*,M)); }
+void tchash_md5_many(void* const* digests, const void* const* datas, const size_t* lens, size_t count)
+{
+    static const uint32_t InitH[] = { UINT32_C(0x67452301), UINT32_C(0xefcdab89), UINT32_C(0x98badcfe), UINT32_C(0x10325476) };
+    static const TCHash_I_MBAlg_ alg = { InitH, 4, 4, TCHASH_MD5_BLOCK_SIZE, TCHASH_MD5_DIGEST_SIZE, 0, 0, 0x80, tchash_i_md5_mb_scalar_ };
+    tchash_i_mb_kernel_* kernel;
+    size_t nlanes = tchash_i_mb_select_(&kernel, 4, TCHASH_I_MB_KERNELS_(md5));
+    if(!nlanes)
+    {
+        size_t i;
+        for(i = 0; i < count; i++)
+            tchash_md5(digests[i], datas[i], lens[i]);
+        return;
+    }
+    tchash_i_mb_run_(&alg, kernel, nlanes, digests, datas, lens, count);
+}
+
+static void tchash_i_sha2_256_mb_scalar_(void* h, const void* M) { tchash_i_sha2_256_process_block(TC__VOID_CAST(uint32_t*,h), TC__VOID_CAST(const uint32_t*,M)); }
+void tchash_sha2_256_many(void* const* digests, const void* const* datas, const size_t* lens, size_t count)
+{
+    static const uint32_t InitH[] = { UINT32_C(0x6a09e667), UINT32_C(0xbb67ae85), UINT32_C(0x3c6ef372), UINT32_C(0xa54ff53a), UINT32_C(0x510e527f), UINT32_C(0x9b05688c), UINT32_C(0x1f83d9ab), UINT32_C(0x5be0cd19) };
+    static const TCHash_I_MBAlg_ alg = { InitH, 8, 4, TCHASH_SHA2_256_BLOCK_SIZE, TCHASH_SHA2_256_DIGEST_SIZE, 1, 0, 0x80, tchash_i_sha2_256_mb_scalar_ };
+    tchash_i_mb_kernel_* kernel;
+    size_t nlanes = tchash_i_mb_select_(&kernel, 4, TCHASH_I_MB_KERNELS_(sha2_256));
+    /* dedicated SHA2 instructions beat anything short of 16 lanes */
+    if(nlanes < 16 && (tchash_accel_get() & (TCHASH_ACCEL_X86_SHA | TCHASH_ACCEL_ARM_SHA2)))
+        nlanes = 0;
+    if(!nlanes)
+    {
+        size_t i;
+        for(i = 0; i < count; i++)
+            tchash_sha2_256(digests[i], datas[i], lens[i]);
+        return;
+    }
+    tchash_i_mb_run_(&alg, kernel, nlanes, digests, datas, lens, count);
+}
+
+static void tchash_i_sha3_256_mb_scalar_(void* h, const void* M) { tchash_i_keccak1600_process_block(TC__VOID_CAST(uint64_t*,h), TC__VOID_CAST(const uint64_t*,M), TCHASH_SHA3_256_BLOCK_SIZE, -1); }
+void tchash_sha3_256_many(void* const* digests, const void* const* datas, const size_t* lens, size_t count)
+{
+    static const TCHash_I_MBAlg_ alg = { NULL, 25, 8, TCHASH_SHA3_256_BLOCK_SIZE, TCHASH_SHA3_256_DIGEST_SIZE, 0, 1, 0x06, tchash_i_sha3_256_mb_scalar_ };
+    tchash_i_mb_kernel_* kernel;
+    size_t nlanes = tchash_i_keccak_mb_select_(&kernel);
+    if(!nlanes)
+    {
+        size_t i;
+        for(i = 0; i < count; i++)
+            tchash_sha3_256(digests[i], datas[i], lens[i]);
+        return;
+    }
+    tchash_i_mb_run_(&alg, kernel, nlanes, digests, datas, lens, count);
+}
+
+/* a single lane, via the portable permutation (but with the kernel interface) */
+static void tchash_i_keccak_mb_scalar_(void* S, const void* W, size_t nw)
+{
+    tchash_i_keccak1600_process_block(TC__VOID_CAST(uint64_t*,S), TC__VOID_CAST(const uint64_t*,W), nw * sizeof(uint64_t), -1);
+}
+/*
+ * The 4 states are split into groups of `nl` lanes (4 for AVX2, 2 for SSE2 &
+ * NEON, or 1 if there is no SIMD); each group is laid out as in `_many()`.
+ * Since all messages have the same length, every lane is always active.
+ */
+static void tchash_i_keccak_x4_(void* const digests[4], size_t digestlen, const void* const datas[4], size_t dlen, size_t bsize, unsigned char pad)
+{
+    const TCHash_I_MBAlg_ alg = { NULL, 25, 8, TC__STATIC_CAST(unsigned char,bsize), 0, 0, 1, pad, NULL };
+    uint64_t S[25 * 4];
+    uint64_t W[TCHASH_I_MB_MAXBLOCK_ / sizeof(uint64_t) * 4];
+    uint64_t h[25];
+    unsigned char tail[TCHASH_I_MB_MAXBLOCK_];
+    void* Wvoid = W;
+    unsigned char* Wbytes = TC__VOID_CAST(unsigned char*,Wvoid);
+    size_t nw = bsize / sizeof(uint64_t), nl = 1, off, done, i, g, j;
+
+    tchash_i_mb_kernel_* kernel = tchash_i_keccak_mb_scalar_;
+#if defined(TCHASH_I_ACCEL_X86_)
+    if(tchash_accel_get() & TCHASH_ACCEL_X86_AVX2) { kernel = tchash_i_keccak_mb_avx2; nl = 4; }
+    else if(tchash_accel_get() & TCHASH_ACCEL_X86_SSE2) { kernel = tchash_i_keccak_mb_sse2; nl = 2; }
+#elif defined(TCHASH_I_ACCEL_ARM_)
+    if(tchash_accel_get() & TCHASH_ACCEL_ARM_NEON) { kernel = tchash_i_keccak_mb_neon; nl = 2; }
+#ifdef TCHASH_I_ACCEL_ARM_SHA3_
+    if(tchash_accel_get() & TCHASH_ACCEL_ARM_SHA3) { kernel = tchash_i_keccak_mb_neon_sha3; nl = 2; }
+#endif
+#endif
+
+    /* absorb every full block, and then the padded final one (which may be empty) */
+    memset(S, 0, sizeof(S));
+    for(off = 0; off <= dlen; off += bsize)
+    {
+        for(j = 0; j < 4; j++)
+        {
+            const unsigned char* block = TC__VOID_CAST(const unsigned char*,datas[j]) + off;
+            if(dlen - off < bsize)
+            {
+                size_t rem = dlen - off;
+                if(rem) memcpy(tail, block, rem);
+                memset(tail + rem, 0, bsize - rem);
+                tail[rem] = pad;
+                tail[bsize - 1] |= 0x80;
+                block = tail;
+            }
+            tchash_i_mb_words_(&alg, Wbytes + ((j / nl) * nw * nl + j % nl) * sizeof(uint64_t), nl, block);
+        }
+        for(g = 0; g < 4; g += nl)
+            kernel(S + g * 25, W + g * nw, nw);
+    }
+
+    /* squeeze (for SHAKE, possibly more than a block) */
+    for(done = 0;;)
+    {
+        size_t clen = TCHASH_I_MIN(digestlen - done, bsize);
+        for(j = 0; j < 4; j++)
+        {
+            unsigned char* udigest = TC__VOID_CAST(unsigned char*,digests[j]);
+            tchash_i_mb_column_get_(&alg, S + (j / nl) * 25 * nl, nl, j % nl, h);
+            for(i = 0; i < clen; i++)
+                udigest[done + i] = TC__STATIC_CAST(unsigned char,h[i / 8] >> (8 * (i % 8)));
+        }
+        done += clen;
+        if(done >= digestlen)
+            break;
+        for(g = 0; g < 4; g += nl)
+            kernel(S + g * 25, W, 0);
+    }
+}
+void tchash_sha3_256_x4(void* const digests[4], const void* const datas[4], size_t dlen)
+{
+    tchash_i_keccak_x4_(digests, TCHASH_SHA3_256_DIGEST_SIZE, datas, dlen, TCHASH_SHA3_256_BLOCK_SIZE, 0x06);
+}
+void tchash_shake128_x4(void* const digests[4], size_t digestlen, const void* const datas[4], size_t dlen)
+{
+    tchash_i_keccak_x4_(digests, digestlen, datas, dlen, TCHASH_SHAKE128_BLOCK_SIZE, 0x1F);
+}
+
 #endif /* TC_HASH_IMPLEMENTATION */
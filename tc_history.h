@@ -2,12 +2,17 @@
  * tc_history.h: Simple terminal history handling.
  *
  * DEPENDS: tc_string
- * VERSION: 0.0.3 (2016-09-11)
+ * VERSION: 0.1.0 (2026-10-15)
  * LICENSE: CC0 & Boost (dual-licensed)
  * AUTHOR: Tim Cas
  * URL: https://github.com/darkuranium/tclib
  *
  * VERSION HISTORY:
+ * 0.1.0    the line being edited is now a gap buffer, making edits at the cursor O(1)
+ *          added `tchist_get_parts()`, for reading the line without closing the gap
+ *          entries no longer keep a separate copy of the edit until they are edited
+ *          fixed `tchist_exec()` returning the original instead of the edited line
+ *          fixed `tchist_str_clear()` not resetting the cursor
  * 0.0.3    added TC_MALLOC and friends
  * 0.0.2    made the library compile with a C++ compiler
  * 0.0.1    initial public release
@@ -15,6 +20,19 @@
  * TODOs:
  * - read history from file or stream
  * - multiline support
+ *
+ *
+ *
+ * The string being edited contains a gap at the cursor; inserting or deleting
+ * characters only resizes the gap, and moving the cursor moves the characters
+ * it passes over to the other side. The gap is closed when the string is
+ * retrieved via `tchist_get_string()` or `tchist_exec()`, so callers always
+ * see a contiguous, `0`-terminated string. Closing it costs a move of the text
+ * after the cursor, so callers that look at the line after every key should
+ * use `tchist_get_parts()` instead, which leaves the gap in place.
+ *
+ * Note that `tchist_str_input()` in overwrite mode (`insert == 0`) replaces as
+ * many *bytes* as it inserts, not characters.
  */
 
 #ifndef TC_HISTORY_H_
@@ -34,12 +52,15 @@ typedef struct TC_History
     struct TC__HistoryEntry* entries;
 
     size_t vpos, hpos;
+    size_t gap; /* size of the gap at `hpos` in the current entry */
 } TC_History;
 
 TC_History* tchist_init(TC_History* hist, int maxlen);
 void tchist_deinit(TC_History* hist);
 
 TC_String* tchist_get_string(TC_History* hist);
+/* the text before and after the cursor (neither is `0`-terminated); valid until the next `tchist_` call */
+void tchist_get_parts(TC_History* hist, const char** head, size_t* headlen, const char** tail, size_t* taillen);
 
 size_t tchist_get_hpos(TC_History* hist);
 void tchist_cmd_vmove_full(TC_History* hist, int down);
@@ -61,6 +82,7 @@ TC_String* tchist_exec(TC_History* hist);
 #ifdef TC_HISTORY_IMPLEMENTATION
 #undef TC_HISTORY_IMPLEMENTATION
 #include <stdlib.h>
+#include <string.h>
 
 #ifndef TC__STATIC_CAST
 #ifdef __cplusplus
@@ -86,6 +108,17 @@ TC_String* tchist_exec(TC_History* hist);
 #define TC_FREE(ptr)            free(ptr)
 #endif /* TC_FREE */
 
+#ifndef TC_MEMCPY
+#define TC_MEMCPY(dst,src,len)  memcpy(dst, src, len)
+#endif /* TC_MEMCPY */
+#ifndef TC_MEMMOVE
+#define TC_MEMMOVE(dst,src,len) memmove(dst, src, len)
+#endif /* TC_MEMMOVE */
+
+/* minimum gap size to open, so that typing doesn't reopen it on every key */
+#define TCHIST__GAP_MIN 32
+
+/* `edit.ptr == NULL` means that the entry is unedited (so, the same as `orig`) */
 typedef struct TC__HistoryEntry
 {
     TC_String orig, edit;
@@ -112,15 +145,46 @@ static size_t tchist__get_next_idx(TC_History* hist, size_t idx)
     return (idx + 1) % hist->mem;
 }
 
-TC_History* tchist_init(TC_History* hist, int maxlen)
+/* get the edit string of the current entry, copying it from `orig` if needed; this includes the gap */
+static TC_String* tchist__get_edit(TC_History* hist)
 {
-#ifdef __cplusplus
-    /* goddamnit for making me do this because you absolutely need -Wextra! (you know who you are) */
-    static const TC__HistoryEntry eentry = TC__HistoryEntry();
-#else
-    static const TC__HistoryEntry eentry;
-#endif
+    TC__HistoryEntry* entry = &hist->entries[hist->vpos];
+    if(!entry->edit.ptr && entry->orig.ptr)
+        tcstr_reinit(&entry->edit, &entry->orig);
+    return &entry->edit;
+}
+static void tchist__gap_close(TC_History* hist)
+{
+    if(!hist->gap) return;
+    tcstr_splices(&hist->entries[hist->vpos].edit, hist->hpos, hist->gap, NULL, 0);
+    hist->gap = 0;
+}
+/* make sure the gap has room for at least `len` bytes */
+static int tchist__gap_open(TC_History* hist, size_t len)
+{
+    TC_String* str = tchist__get_edit(hist);
+    size_t ngap;
+
+    if(hist->gap >= len) return 1;
+    /* grow the gap with the string, to keep reopening it amortized O(1) */
+    ngap = str->len / 2;
+    if(ngap < TCHIST__GAP_MIN) ngap = TCHIST__GAP_MIN;
+    if(ngap < len) ngap = len;
+    /* (inserts `ngap - gap` uninitialized bytes) */
+    if(!tcstr_splices(str, hist->hpos, 0, NULL, ngap - hist->gap))
+        return 0;
+    hist->gap = ngap;
+    return 1;
+}
+/* byte length of the character right after the gap */
+static size_t tchist__next_len(TC_History* hist, TC_String* str)
+{
+    size_t off = hist->hpos + hist->gap;
+    return tcstr_utf8_next_off(str, off) - off;
+}
 
+TC_History* tchist_init(TC_History* hist, int maxlen)
+{
     if(!hist) return NULL;
 
     hist->maxlen = maxlen;
@@ -129,12 +193,16 @@ TC_History* tchist_init(TC_History* hist, int maxlen)
     hist->tail = 1;
     hist->vpos = tchist__get_tail_idx(hist);
     hist->hpos = 0;
+    hist->gap = 0;
 
     hist->entries = TC__VOID_CAST(TC__HistoryEntry*,TC_MALLOC(hist->mem * sizeof(*hist->entries)));
 
     size_t i;
     for(i = 0; i < hist->mem; i++)
-        hist->entries[i] = eentry;
+    {
+        tcstr_init(&hist->entries[i].orig, NULL);
+        tcstr_init(&hist->entries[i].edit, NULL);
+    }
 
     return hist;
 }
@@ -153,7 +221,18 @@ void tchist_deinit(TC_History* hist)
 
 TC_String* tchist_get_string(TC_History* hist)
 {
-    return &hist->entries[hist->vpos].edit;
+    tchist__gap_close(hist);
+    return tchist__get_edit(hist);
+}
+void tchist_get_parts(TC_History* hist, const char** head, size_t* headlen, const char** tail, size_t* taillen)
+{
+    TC_String* str = tchist__get_edit(hist);
+    size_t off = hist->hpos + hist->gap;
+    /* (`str->ptr` is NULL for a fresh, unedited entry) */
+    *head = str->ptr ? str->ptr : "";
+    *headlen = hist->hpos;
+    *tail = str->ptr ? str->ptr + off : "";
+    *taillen = str->len - off;
 }
 
 size_t tchist_get_hpos(TC_History* hist)
@@ -162,6 +241,7 @@ size_t tchist_get_hpos(TC_History* hist)
 }
 void tchist_cmd_vmove_full(TC_History* hist, int down)
 {
+    tchist__gap_close(hist);
     if(down > 0)
         hist->vpos = tchist__get_tail_idx(hist);
     else if(down < 0)
@@ -170,13 +250,16 @@ void tchist_cmd_vmove_full(TC_History* hist, int down)
 }
 void tchist_cmd_hmove_full(TC_History* hist, int right)
 {
+    /* a full move would have to shift everything past the gap anyway */
+    tchist__gap_close(hist);
     if(right > 0)
-        hist->hpos = hist->entries[hist->vpos].edit.len;
+        hist->hpos = tchist__get_edit(hist)->len;
     else if(right < 0)
         hist->hpos = 0;
 }
 void tchist_cmd_vmove(TC_History* hist, int down)
 {
+    tchist__gap_close(hist);
     while(down > 0)
     {
         hist->vpos = tchist__get_next_idx(hist, hist->vpos);
@@ -191,82 +274,114 @@ void tchist_cmd_vmove(TC_History* hist, int down)
 }
 void tchist_cmd_hmove(TC_History* hist, int right)
 {
+    TC_String* str = tchist__get_edit(hist);
+    size_t npos, n;
+    /* move characters across the gap */
     while(right > 0)
     {
-        hist->hpos = tcstr_utf8_next_off(&hist->entries[hist->vpos].edit, hist->hpos);
+        n = tchist__next_len(hist, str);
+        if(hist->gap)
+        {
+            TC_MEMMOVE(str->ptr + hist->hpos, str->ptr + hist->hpos + hist->gap, n);
+            tcstr_invalidate(str, hist->hpos);
+        }
+        hist->hpos += n;
         right--;
     }
     while(right < 0)
     {
-        hist->hpos = tcstr_utf8_prev_off(&hist->entries[hist->vpos].edit, hist->hpos);
+        npos = tcstr_utf8_prev_off(str, hist->hpos);
+        n = hist->hpos - npos;
+        if(hist->gap)
+        {
+            TC_MEMMOVE(str->ptr + npos + hist->gap, str->ptr + npos, n);
+            tcstr_invalidate(str, npos + hist->gap);
+        }
+        hist->hpos = npos;
         right++;
     }
 }
 void tchist_str_input(TC_History* hist, const char* str, int len, int insert)
 {
+    TC_String* edit;
+    size_t del;
+
     if(len < 0) len = strlen(str);
-    tcstr_splices(&hist->entries[hist->vpos].edit, hist->hpos, insert ? 0 : len, str, len);
+    if(!tchist__gap_open(hist, len))
+        return;
+    edit = tchist__get_edit(hist);
+    if(!insert)
+    {
+        /* overwrite: the bytes after the gap join it */
+        del = edit->len - hist->hpos - hist->gap;
+        if(del > TC__STATIC_CAST(size_t,len)) del = len;
+        hist->gap += del;
+    }
+    TC_MEMCPY(edit->ptr + hist->hpos, str, len);
+    tcstr_invalidate(edit, hist->hpos);
     hist->hpos += len;
+    hist->gap -= len;
 }
 void tchist_str_delete(TC_History* hist, int len)
 {
-    TC_String* str = tchist_get_string(hist);
+    TC_String* str = tchist__get_edit(hist);
     size_t npos;
+    /* both directions merely widen the gap */
     while(len > 0) /* delete */
     {
-        npos = tcstr_utf8_next_off(str, hist->hpos);
-        tcstr_splices(str, hist->hpos, npos - hist->hpos, NULL, 0);
+        hist->gap += tchist__next_len(hist, str);
         len--;
     }
     while(len < 0) /* backspace */
     {
         npos = tcstr_utf8_prev_off(str, hist->hpos);
-        tcstr_splices(str, npos, hist->hpos - npos, NULL, 0);
+        hist->gap += hist->hpos - npos;
         hist->hpos = npos;
         len++;
     }
 }
 void tchist_str_clear(TC_History* hist)
 {
-    tcstr_reinit(&hist->entries[hist->vpos].edit, NULL);
+    hist->gap = 0;
+    hist->hpos = 0;
+    /* (an empty string, as the null string would mean "unedited") */
+    tcstr_reinits(&hist->entries[hist->vpos].edit, "", 0);
 }
 TC_String* tchist_exec(TC_History* hist)
 {
     static char emptystr[] = "";
-    static TC_String empty = { 0, emptystr };
+    static TC_String empty; /* (not initialized here, to avoid a -Wextra warning for the private fields) */
     TC__HistoryEntry* tentry = &hist->entries[tchist__get_tail_idx(hist)];
     TC__HistoryEntry* entry = &hist->entries[hist->vpos];
 
     TC_String* str = tchist_get_string(hist);
     if(!str->len)
     {
-        tcstr_reinit(&entry->edit, &entry->orig);
+        /* restore the original */
+        tcstr_reinit(&entry->edit, NULL);
         tchist_cmd_hmove_full(hist, -1);
+        empty.len = 0;
+        empty.ptr = emptystr;
         return &empty;
     }
 
-    if(entry == tentry)
-        tcstr_reinit(&entry->orig, &entry->edit);
-    else
-    {
-        tcstr_reinit(&tentry->orig, &entry->edit);
-        tcstr_reinit(&tentry->edit, &entry->edit);
-
-        tcstr_reinit(&entry->edit, &entry->orig);
-    }
+    /* the edit becomes the new entry, and the edited one reverts to its original */
+    tcstr_deinit(&tentry->orig);
+    tcstr_move(&tentry->orig, &entry->edit);
+    tcstr_reinit(&tentry->edit, NULL);
 
     hist->tail = (hist->tail + 1) % hist->mem;
 
-    tentry = &hist->entries[tchist__get_tail_idx(hist)];
-    tcstr_reinits(&tentry->orig, NULL, 0);
-    tcstr_reinits(&tentry->edit, NULL, 0);
+    entry = &hist->entries[tchist__get_tail_idx(hist)];
+    tcstr_reinits(&entry->orig, NULL, 0);
+    tcstr_reinits(&entry->edit, NULL, 0);
 
     if(hist->tail == hist->head)
         hist->head = (hist->head + 1) % hist->mem;
 
     tchist_cmd_hmove_full(hist, -1);
 
-    return tchist_get_string(hist);
+    return &tentry->orig;
 }
 
 #endif /* TC_HISTORY_IMPLEMENTATION */
@@ -2,19 +2,25 @@
  * tc_random.h: Random number generation.
  *
  * DEPENDS:
- * VERSION: 0.0.3 (2018-03-28)
+ * VERSION: 0.0.5 (2026-10-15)
  * LICENSE: CC0 & Boost (dual-licensed)
  * AUTHOR: Tim Cas
  * URL: https://github.com/darkuranium/tclib
  *
  * VERSION HISTORY:
+ * 0.0.5    added `tcrand_jump()`, `tcrand_long_jump()` & `tcrand_advance()`,
+ *          and the counter-based Philox4x32-10 & Threefry4x64-20 generators
+ * 0.0.4    added bulk `tcrand_fill_*()` functions, statically-typed inline
+ *          generators (SplitMix64, xoroshiro128+, PCG32 & multi-lane
+ *          variants) and `tcrand_init_pcg_xsh_rr()`;
+ *          fixed `tcrand_next_bytes()` not advancing the output pointer
  * 0.0.3    fixed a bug where mean & sd were swapped for normal2_{d,f}
  * 0.0.2    fixed a bug in generating u32 and u64 integers
  *          (`max` was not being included in the possible results)
  * 0.0.1    initial public release
  *
  * TODOs:
- * - PCG
+ * - Ziggurat for `tcrand_fill_normal_*()`
  * - OS random (CryptGenRandom or BCryptGenRandom / arc4random / ...)
  */
 
@@ -41,6 +47,12 @@ typedef struct TC_RandGen
     size_t value_blen;
     size_t value_alen;
     void* value_ptr;
+    /* optional (may be NULL): generate `n` consecutive raw values at once */
+    void (*fill)(void* data, void* values, size_t n);
+    /* optional (may be NULL): skip 2^64 (`longjump == 0`) or 2^96 (`longjump != 0`) values */
+    void (*jump)(void* data, int longjump);
+    /* optional (may be NULL): skip `delta` values */
+    void (*advance)(void* data, uint64_t delta);
 } TC_RandGen;
 
 typedef struct TC_CFloat
@@ -64,6 +76,9 @@ typedef struct TC_CDouble
 #define TCRAND_MT19937_SEEDLEN          sizeof(uint32_t)
 #define TCRAND_MT19937_64_SEEDLEN       sizeof(uint64_t)
 #define TCRAND_SPLITMIX64_SEEDLEN       sizeof(uint64_t)
+#define TCRAND_PCG_XSH_RR_SEEDLEN       (2 * sizeof(uint64_t))
+#define TCRAND_PHILOX4X32_SEEDLEN       (2 * sizeof(uint32_t))
+#define TCRAND_THREEFRY4X64_SEEDLEN     (4 * sizeof(uint64_t))
 
 #define TCRAND_MINSTD0_MAX          UINT32_C(0x7FFFFFFE)
 #define TCRAND_MINSTD_MAX           UINT32_C(0x7FFFFFFE)
@@ -72,6 +87,9 @@ typedef struct TC_CDouble
 #define TCRAND_MT19937_MAX          UINT32_MAX
 #define TCRAND_MT19937_64_MAX       UINT64_MAX
 #define TCRAND_SPLITMIX64_MAX       UINT64_MAX
+#define TCRAND_PCG_XSH_RR_MAX       UINT32_MAX
+#define TCRAND_PHILOX4X32_MAX       UINT32_MAX
+#define TCRAND_THREEFRY4X64_MAX     UINT64_MAX
 
 extern const uint32_t tcrand_minstd0_default_seed[];
 extern const uint32_t tcrand_minstd_default_seed[];
@@ -90,6 +108,8 @@ TC_RandGen* tcrand_init_pcg_xsh_rr(TC_RandGen* rgen);
 TC_RandGen* tcrand_init_mt19937(TC_RandGen* rgen);
 TC_RandGen* tcrand_init_mt19937_64(TC_RandGen* rgen);
 TC_RandGen* tcrand_init_splitmix64(TC_RandGen* rgen);
+TC_RandGen* tcrand_init_philox4x32(TC_RandGen* rgen);
+TC_RandGen* tcrand_init_threefry4x64(TC_RandGen* rgen);
 TC_RandGen* tcrand_clone(TC_RandGen* ngen, const TC_RandGen* rgen);
 void tcrand_deinit(TC_RandGen* rgen);
 
@@ -99,6 +119,23 @@ void tcrand_seed_raw(TC_RandGen* rgen, const uint32_t* seed);
 void tcrand_seed_u32seq(TC_RandGen* rgen, const uint32_t* seed, size_t slen);
 void tcrand_seed_u32(TC_RandGen* rgen, uint32_t seed);
 
+/*
+ * Skipping ahead, for splitting one generator into non-overlapping streams
+ * (e.g. one per thread): seed once, then `tcrand_clone()` and jump each clone
+ * by a different multiple.
+ *
+ * - `tcrand_jump()`: skip 2^64 values; supported by xoroshiro128+ & MT19937
+ * - `tcrand_long_jump()`: skip 2^96 values; supported by xoroshiro128+ & MT19937
+ * - `tcrand_advance()`: skip `delta` values in O(log delta) (or O(1)) time;
+ *   supported by LCG (incl. minstd), PCG, SplitMix64, Philox & Threefry
+ *
+ * These return 0 (and leave the generator unchanged) if unsupported.
+ * MT19937 jumps are polynomial-based, and cost roughly 20000 steps.
+ */
+int tcrand_jump(TC_RandGen* rgen);
+int tcrand_long_jump(TC_RandGen* rgen);
+int tcrand_advance(TC_RandGen* rgen, uint64_t delta);
+
 void tcrand_next_raw(TC_RandGen* rgen, void* values);
 void tcrand_next_bytes(TC_RandGen* rgen, void* bytes, size_t nbytes);
 
@@ -126,6 +163,263 @@ TC_CDouble tcrand_next_normal2_d(TC_RandGen* rgen, double mean, double sd);
 #define tcrand_next_normal_f(rgen, mean, sd)    TC_REAL(tcrand_next_normal2_f(rgen, mean, sd))
 #define tcrand_next_normal_d(rgen, mean, sd)    TC_REAL(tcrand_next_normal2_d(rgen, mean, sd))
 
+/*
+ * Bulk generation: each of these fills `n` values with a single call into the
+ * generator (via `fill`, if available), instead of one indirect call per value.
+ *
+ * The results follow the same distributions as the corresponding
+ * `tcrand_next_*()` functions, but are *not* the same sequence of values.
+ */
+void tcrand_fill_raw(TC_RandGen* rgen, void* values, size_t n);
+void tcrand_fill_bytes(TC_RandGen* rgen, void* bytes, size_t nbytes);
+
+void tcrand_fill_u32(TC_RandGen* rgen, uint32_t* values, size_t n, uint32_t min, uint32_t max);
+void tcrand_fill_u64(TC_RandGen* rgen, uint64_t* values, size_t n, uint64_t min, uint64_t max);
+
+// (min,max)
+void tcrand_fill_uniform_f_oo(TC_RandGen* rgen, float* values, size_t n, float min, float max);
+void tcrand_fill_uniform_d_oo(TC_RandGen* rgen, double* values, size_t n, double min, double max);
+// [min,max)
+void tcrand_fill_uniform_f_co(TC_RandGen* rgen, float* values, size_t n, float min, float max);
+void tcrand_fill_uniform_d_co(TC_RandGen* rgen, double* values, size_t n, double min, double max);
+// (min,max]
+void tcrand_fill_uniform_f_oc(TC_RandGen* rgen, float* values, size_t n, float min, float max);
+void tcrand_fill_uniform_d_oc(TC_RandGen* rgen, double* values, size_t n, double min, double max);
+// [min,max]
+void tcrand_fill_uniform_f_cc(TC_RandGen* rgen, float* values, size_t n, float min, float max);
+void tcrand_fill_uniform_d_cc(TC_RandGen* rgen, double* values, size_t n, double min, double max);
+
+// Box-Muller, computed over whole blocks of uniforms at a time
+void tcrand_fill_normal_f(TC_RandGen* rgen, float* values, size_t n, float mean, float sd);
+void tcrand_fill_normal_d(TC_RandGen* rgen, double* values, size_t n, double mean, double sd);
+
+/*
+ * Statically-typed generators: plain copyable structs with inline `next`
+ * functions, for when the algorithm is known at compile-time. These bypass
+ * `TC_RandGen` entirely (no allocation, no indirect calls).
+ *
+ * The `_x4`/`_x8` variants run several independent streams side-by-side, in a
+ * structure-of-arrays layout that compilers can keep in SIMD registers; they
+ * return one value per lane per call.
+ */
+#ifndef TCRAND_INLINE
+#ifdef _MSC_VER
+#define TCRAND_INLINE static __inline
+#else
+#define TCRAND_INLINE static inline
+#endif
+#endif /* TCRAND_INLINE */
+
+typedef struct TC_RandSplitMix64
+{
+    uint64_t state;
+} TC_RandSplitMix64;
+typedef struct TC_RandXoroshiro128Plus
+{
+    uint64_t state[2];
+} TC_RandXoroshiro128Plus;
+typedef struct TC_RandPCG32
+{
+    uint64_t state;
+    uint64_t inc;
+} TC_RandPCG32;
+
+typedef struct TC_RandXoroshiro128PlusX4
+{
+    uint64_t s0[4];
+    uint64_t s1[4];
+} TC_RandXoroshiro128PlusX4;
+typedef struct TC_RandPCG32X8
+{
+    uint64_t state[8];
+    uint64_t inc[8];
+} TC_RandPCG32X8;
+
+// http://xoroshiro.di.unimi.it/splitmix64.c
+TCRAND_INLINE void tcrand_splitmix64_seed(TC_RandSplitMix64* g, uint64_t seed)
+{
+    g->state = seed;
+}
+TCRAND_INLINE uint64_t tcrand_splitmix64_next(TC_RandSplitMix64* g)
+{
+    uint64_t z = (g->state += UINT64_C(0x9E3779B97F4A7C15));
+    z = (z ^ (z >> 30)) * UINT64_C(0xBF58476D1CE4E5B9);
+    z = (z ^ (z >> 27)) * UINT64_C(0x94D049BB133111EB);
+    return z ^ (z >> 31);
+}
+TCRAND_INLINE void tcrand_splitmix64_advance(TC_RandSplitMix64* g, uint64_t delta)
+{
+    g->state += delta * UINT64_C(0x9E3779B97F4A7C15);
+}
+
+// http://xoroshiro.di.unimi.it/xoroshiro128plus.c
+// (the state is expanded from `seed` via SplitMix64, as recommended by the authors)
+TCRAND_INLINE void tcrand_xoroshiro128plus_seed(TC_RandXoroshiro128Plus* g, uint64_t seed)
+{
+    TC_RandSplitMix64 sm;
+    tcrand_splitmix64_seed(&sm, seed);
+    g->state[0] = tcrand_splitmix64_next(&sm);
+    g->state[1] = tcrand_splitmix64_next(&sm);
+}
+TCRAND_INLINE uint64_t tcrand_xoroshiro128plus_next(TC_RandXoroshiro128Plus* g)
+{
+    const uint64_t s0 = g->state[0];
+    uint64_t s1 = g->state[1];
+    uint64_t ret = s0 + s1;
+
+    s1 ^= s0;
+    g->state[0] = ((s0 << 55) | (s0 >> 9)) ^ s1 ^ (s1 << 14); /* a, b */
+    g->state[1] = (s1 << 36) | (s1 >> 28); /* c */
+    return ret;
+}
+
+// http://www.pcg-random.org/ (pcg32_srandom_r & pcg32_random_r)
+TCRAND_INLINE uint32_t tcrand_pcg32_next(TC_RandPCG32* g)
+{
+    uint64_t oldstate = g->state;
+    g->state = oldstate * UINT64_C(6364136223846793005) + g->inc;
+    uint32_t xorshifted = (uint32_t)(((oldstate >> 18) ^ oldstate) >> 27);
+    uint32_t rot = (uint32_t)(oldstate >> 59);
+    return (xorshifted >> rot) | (xorshifted << ((-rot) & 31));
+}
+TCRAND_INLINE void tcrand_pcg32_seed(TC_RandPCG32* g, uint64_t initstate, uint64_t initseq)
+{
+    g->state = 0;
+    g->inc = (initseq << 1) | 1;
+    tcrand_pcg32_next(g);
+    g->state += initstate;
+    tcrand_pcg32_next(g);
+}
+
+// lane `i` is seeded from the `i`-th group of SplitMix64 outputs
+TCRAND_INLINE void tcrand_xoroshiro128plus_x4_seed(TC_RandXoroshiro128PlusX4* g, uint64_t seed)
+{
+    TC_RandSplitMix64 sm;
+    tcrand_splitmix64_seed(&sm, seed);
+    for(int i = 0; i < 4; i++)
+    {
+        g->s0[i] = tcrand_splitmix64_next(&sm);
+        g->s1[i] = tcrand_splitmix64_next(&sm);
+    }
+}
+TCRAND_INLINE void tcrand_xoroshiro128plus_x4_next(TC_RandXoroshiro128PlusX4* g, uint64_t values[4])
+{
+    for(int i = 0; i < 4; i++)
+    {
+        const uint64_t s0 = g->s0[i];
+        uint64_t s1 = g->s1[i];
+        values[i] = s0 + s1;
+
+        s1 ^= s0;
+        g->s0[i] = ((s0 << 55) | (s0 >> 9)) ^ s1 ^ (s1 << 14);
+        g->s1[i] = (s1 << 36) | (s1 >> 28);
+    }
+}
+
+// lane `i` uses stream `initseq * 8 + i`; all lanes are therefore distinct sequences
+TCRAND_INLINE void tcrand_pcg32_x8_seed(TC_RandPCG32X8* g, uint64_t initstate, uint64_t initseq)
+{
+    for(int i = 0; i < 8; i++)
+    {
+        TC_RandPCG32 lane;
+        tcrand_pcg32_seed(&lane, initstate, initseq * 8 + i);
+        g->state[i] = lane.state;
+        g->inc[i] = lane.inc;
+    }
+}
+TCRAND_INLINE void tcrand_pcg32_x8_next(TC_RandPCG32X8* g, uint32_t values[8])
+{
+    for(int i = 0; i < 8; i++)
+    {
+        uint64_t oldstate = g->state[i];
+        g->state[i] = oldstate * UINT64_C(6364136223846793005) + g->inc[i];
+        uint32_t xorshifted = (uint32_t)(((oldstate >> 18) ^ oldstate) >> 27);
+        uint32_t rot = (uint32_t)(oldstate >> 59);
+        values[i] = (xorshifted >> rot) | (xorshifted << ((-rot) & 31));
+    }
+}
+
+/* bulk versions of the above; `n` need not be a multiple of the lane count (excess values are discarded) */
+void tcrand_xoroshiro128plus_fill_u64(TC_RandXoroshiro128Plus* g, uint64_t* values, size_t n);
+void tcrand_pcg32_fill_u32(TC_RandPCG32* g, uint32_t* values, size_t n);
+void tcrand_xoroshiro128plus_x4_fill_u64(TC_RandXoroshiro128PlusX4* g, uint64_t* values, size_t n);
+void tcrand_pcg32_x8_fill_u32(TC_RandPCG32X8* g, uint32_t* values, size_t n);
+
+/* skip 2^64 (`jump`) or 2^96 (`long_jump`) values */
+void tcrand_xoroshiro128plus_jump(TC_RandXoroshiro128Plus* g);
+void tcrand_xoroshiro128plus_long_jump(TC_RandXoroshiro128Plus* g);
+/* skip `delta` values, in O(log delta) time */
+void tcrand_pcg32_advance(TC_RandPCG32* g, uint64_t delta);
+
+/*
+ * Counter-based generators (Salmon et al., "Parallel Random Numbers: As Easy
+ * as 1, 2, 3"): the output is a pure function of `(key, counter)`, so any
+ * block of a stream can be computed directly, without any state or
+ * coordination between threads. Use the key to select the stream, and the
+ * counter as the position within it.
+ *
+ * When used through `TC_RandGen` (`tcrand_init_philox4x32()` &
+ * `tcrand_init_threefry4x64()`), the seed is the key, and value `i` of the
+ * stream is word `i % 4` of the block with counter `{ i / 4, 0, 0, 0 }`
+ * (split into 32-bit words, low word first, for Philox).
+ */
+// Philox4x32-10
+TCRAND_INLINE void tcrand_philox4x32_10(uint32_t out[4], const uint32_t ctr[4], const uint32_t key[2])
+{
+    uint32_t x0 = ctr[0], x1 = ctr[1], x2 = ctr[2], x3 = ctr[3];
+    uint32_t k0 = key[0], k1 = key[1];
+    for(int r = 0; r < 10; r++)
+    {
+        uint64_t p0 = (uint64_t)UINT32_C(0xD2511F53) * x0;
+        uint64_t p1 = (uint64_t)UINT32_C(0xCD9E8D57) * x2;
+        x0 = (uint32_t)(p1 >> 32) ^ x1 ^ k0;
+        x1 = (uint32_t)p1;
+        x2 = (uint32_t)(p0 >> 32) ^ x3 ^ k1;
+        x3 = (uint32_t)p0;
+        k0 += UINT32_C(0x9E3779B9);
+        k1 += UINT32_C(0xBB67AE85);
+    }
+    out[0] = x0; out[1] = x1; out[2] = x2; out[3] = x3;
+}
+// Threefry4x64-20
+TCRAND_INLINE void tcrand_threefry4x64_20(uint64_t out[4], const uint64_t ctr[4], const uint64_t key[4])
+{
+    static const unsigned char R[8][2] = {
+        {14,16}, {52,57}, {23,40}, {5,37}, {25,33}, {46,12}, {58,22}, {32,32},
+    };
+    uint64_t ks[5];
+    ks[4] = UINT64_C(0x1BD11BDAA9FC1A22);
+    for(int i = 0; i < 4; i++)
+    {
+        ks[i] = key[i];
+        ks[4] ^= key[i];
+    }
+    uint64_t x0 = ctr[0] + ks[0], x1 = ctr[1] + ks[1], x2 = ctr[2] + ks[2], x3 = ctr[3] + ks[3];
+    for(int r = 0; r < 20; r++)
+    {
+        unsigned ra = R[r & 7][0], rb = R[r & 7][1];
+        if(!(r & 1))
+        {
+            x0 += x1; x1 = (x1 << ra) | (x1 >> (64 - ra)); x1 ^= x0;
+            x2 += x3; x3 = (x3 << rb) | (x3 >> (64 - rb)); x3 ^= x2;
+        }
+        else
+        {
+            x0 += x3; x3 = (x3 << ra) | (x3 >> (64 - ra)); x3 ^= x0;
+            x2 += x1; x1 = (x1 << rb) | (x1 >> (64 - rb)); x1 ^= x2;
+        }
+        if((r & 3) == 3)
+        {
+            unsigned s = (r + 1) / 4;
+            x0 += ks[(s + 0) % 5];
+            x1 += ks[(s + 1) % 5];
+            x2 += ks[(s + 2) % 5];
+            x3 += ks[(s + 3) % 5] + s;
+        }
+    }
+    out[0] = x0; out[1] = x1; out[2] = x2; out[3] = x3;
+}
+
 #ifdef __cplusplus
 }
 #endif
@@ -214,6 +508,23 @@ static uint64_t tcrand_i_rotl64(uint64_t x, uint64_t k)
     return (x << k) | (x >> (64 - k));
 }
 
+// (x*y) % m, without overflow (for the LCG skip-ahead)
+static uint32_t tcrand_i_mulmod32(uint32_t x, uint32_t y, uint32_t m)
+{
+    return TC__STATIC_CAST(uint32_t,TC__STATIC_CAST(uint64_t,x) * y % m);
+}
+static uint64_t tcrand_i_mulmod64(uint64_t x, uint64_t y, uint64_t m)
+{
+    uint64_t r = 0;
+    x %= m;
+    for(; y; y >>= 1)
+    {
+        if(y & 1) r = (r >= m - x) ? r - (m - x) : r + x;
+        x = (x >= m - x) ? x - (m - x) : x + x;
+    }
+    return r;
+}
+
 struct TC_I_RandGen_LCGData
 {
     uint32_t seed_buf[1];
@@ -241,6 +552,40 @@ static void tcrand_i_lcg_next(void* data, void* value)
     *TC__STATIC_CAST(uint32_t*,value) = x;
     lcgdata->x = x;
 }
+static void tcrand_i_lcg_fill(void* data, void* values, size_t n)
+{
+    struct TC_I_RandGen_LCGData* lcgdata = TC__VOID_CAST(struct TC_I_RandGen_LCGData*,data);
+    uint32_t* uvalues = TC__STATIC_CAST(uint32_t*,values);
+
+    uint32_t x = lcgdata->x;
+    uint32_t a = lcgdata->a, c = lcgdata->c % lcgdata->m, m = lcgdata->m;
+    uint32_t q = lcgdata->q, r = lcgdata->r;
+
+    for(size_t i = 0; i < n; i++)
+        uvalues[i] = x = tcrand_i_schrage32(x, a, m, q, r) + c;
+
+    lcgdata->x = x;
+}
+// Brown, "Random Number Generation with Arbitrary Strides" (1994)
+static void tcrand_i_lcg_advance(void* data, uint64_t delta)
+{
+    struct TC_I_RandGen_LCGData* lcgdata = TC__VOID_CAST(struct TC_I_RandGen_LCGData*,data);
+
+    uint32_t m = lcgdata->m;
+    uint32_t cmul = lcgdata->a % m, cadd = lcgdata->c % m;
+    uint32_t amul = 1, aadd = 0;
+    for(; delta; delta >>= 1)
+    {
+        if(delta & 1)
+        {
+            amul = tcrand_i_mulmod32(amul, cmul, m);
+            aadd = (tcrand_i_mulmod32(aadd, cmul, m) + TC__STATIC_CAST(uint64_t,cadd)) % m;
+        }
+        cadd = tcrand_i_mulmod32(cmul + 1U == m ? 0 : cmul + 1U, cadd, m);
+        cmul = tcrand_i_mulmod32(cmul, cmul, m);
+    }
+    lcgdata->x = (tcrand_i_mulmod32(amul, lcgdata->x, m) + TC__STATIC_CAST(uint64_t,aadd)) % m;
+}
 static TC_RandGen* tcrand_i_lcg_clone(void* data, TC_RandGen* ngen)
 {
     struct TC_I_RandGen_LCGData* lcgdata = TC__VOID_CAST(struct TC_I_RandGen_LCGData*,data);
@@ -278,6 +623,41 @@ static void tcrand_i_lcg_64_next(void* data, void* value)
     *TC__STATIC_CAST(uint64_t*,value) = x;
     lcgdata->x = x;
 }
+static void tcrand_i_lcg_64_fill(void* data, void* values, size_t n)
+{
+    struct TC_I_RandGen_LCG64Data* lcgdata = TC__VOID_CAST(struct TC_I_RandGen_LCG64Data*,data);
+    uint64_t* uvalues = TC__STATIC_CAST(uint64_t*,values);
+
+    uint64_t x = lcgdata->x;
+    uint64_t a = lcgdata->a, c = lcgdata->c % lcgdata->m, m = lcgdata->m;
+    uint64_t q = lcgdata->q, r = lcgdata->r;
+
+    for(size_t i = 0; i < n; i++)
+        uvalues[i] = x = tcrand_i_schrage64(x, a, m, q, r) + c;
+
+    lcgdata->x = x;
+}
+static void tcrand_i_lcg_64_advance(void* data, uint64_t delta)
+{
+    struct TC_I_RandGen_LCG64Data* lcgdata = TC__VOID_CAST(struct TC_I_RandGen_LCG64Data*,data);
+
+    uint64_t m = lcgdata->m;
+    uint64_t cmul = lcgdata->a % m, cadd = lcgdata->c % m;
+    uint64_t amul = 1, aadd = 0;
+    for(; delta; delta >>= 1)
+    {
+        if(delta & 1)
+        {
+            amul = tcrand_i_mulmod64(amul, cmul, m);
+            aadd = tcrand_i_mulmod64(aadd, cmul, m);
+            aadd = (aadd >= m - cadd) ? aadd - (m - cadd) : aadd + cadd;
+        }
+        cadd = tcrand_i_mulmod64(cmul + 1U == m ? 0 : cmul + 1U, cadd, m);
+        cmul = tcrand_i_mulmod64(cmul, cmul, m);
+    }
+    uint64_t x = tcrand_i_mulmod64(amul, lcgdata->x, m);
+    lcgdata->x = (x >= m - aadd) ? x - (m - aadd) : x + aadd;
+}
 static TC_RandGen* tcrand_i_lcg_64_clone(void* data, TC_RandGen* ngen)
 {
     struct TC_I_RandGen_LCG64Data* lcgdata = TC__VOID_CAST(struct TC_I_RandGen_LCG64Data*,data);
@@ -325,6 +705,12 @@ static void tcrand_i_well_next(void* data, void* value)
     wdata->index = index;
     *TC__STATIC_CAST(uint32_t*,value) = state[index];
 }
+static void tcrand_i_well_fill(void* data, void* values, size_t n)
+{
+    uint32_t* uvalues = TC__STATIC_CAST(uint32_t*,values);
+    for(size_t i = 0; i < n; i++)
+        tcrand_i_well_next(data, &uvalues[i]);
+}
 static TC_RandGen* tcrand_i_well_clone(void* data, TC_RandGen* ngen)
 {
     struct TC_I_RandGen_WELLData* wdata = TC__VOID_CAST(struct TC_I_RandGen_WELLData*,data);
@@ -361,6 +747,31 @@ static void tcrand_i_xoroshiro128plus_next(void* data, void* value)
     xdata->state[0] = tcrand_i_rotl64(s0, 55) ^ s1 ^ (s1 << 14); /* a, b */
     xdata->state[1] = tcrand_i_rotl64(s1, 36); /* c */
 }
+static void tcrand_i_xoroshiro128plus_fill(void* data, void* values, size_t n)
+{
+    struct TC_I_RandGen_XorOshiRo128PlusData* xdata = TC__VOID_CAST(struct TC_I_RandGen_XorOshiRo128PlusData*,data);
+
+    TC_RandXoroshiro128Plus g;
+    g.state[0] = xdata->state[0];
+    g.state[1] = xdata->state[1];
+    tcrand_xoroshiro128plus_fill_u64(&g, TC__STATIC_CAST(uint64_t*,values), n);
+    xdata->state[0] = g.state[0];
+    xdata->state[1] = g.state[1];
+}
+static void tcrand_i_xoroshiro128plus_jump(void* data, int longjump)
+{
+    struct TC_I_RandGen_XorOshiRo128PlusData* xdata = TC__VOID_CAST(struct TC_I_RandGen_XorOshiRo128PlusData*,data);
+
+    TC_RandXoroshiro128Plus g;
+    g.state[0] = xdata->state[0];
+    g.state[1] = xdata->state[1];
+    if(longjump)
+        tcrand_xoroshiro128plus_long_jump(&g);
+    else
+        tcrand_xoroshiro128plus_jump(&g);
+    xdata->state[0] = g.state[0];
+    xdata->state[1] = g.state[1];
+}
 static TC_RandGen* tcrand_i_xoroshiro128plus_clone(void* data, TC_RandGen* ngen)
 {
     struct TC_I_RandGen_XorOshiRo128PlusData* xdata = TC__VOID_CAST(struct TC_I_RandGen_XorOshiRo128PlusData*,data);
@@ -419,6 +830,223 @@ static void tcrand_i_mt19937_next(void* data, void* value)
 
     *TC__STATIC_CAST(uint32_t*,value) = y;
 }
+static void tcrand_i_mt19937_fill(void* data, void* values, size_t n)
+{
+    uint32_t* uvalues = TC__STATIC_CAST(uint32_t*,values);
+    for(size_t i = 0; i < n; i++)
+        tcrand_i_mt19937_next(data, &uvalues[i]);
+}
+/*
+ * Jump polynomials: x^(2^64) and x^(2^96), modulo the characteristic
+ * polynomial of MT19937 (bit `i` of the table is the coefficient of x^i).
+ *
+ * See: Haramoto et al., "Efficient Jump Ahead for F2-Linear Random Number Generators" (2008)
+ */
+static const uint32_t tcrand_i_mt19937_jump_poly[624] = {
+    UINT32_C(0x4C900F63),UINT32_C(0xE248A4CD),UINT32_C(0x75555AAD),UINT32_C(0x02C5E162),UINT32_C(0x775322F2),UINT32_C(0xCC7BDD4B),UINT32_C(0xB071299B),UINT32_C(0xFF847763),
+    UINT32_C(0x54B43FBF),UINT32_C(0x2DCB3BFB),UINT32_C(0x5FCB8C34),UINT32_C(0xE20B4CEF),UINT32_C(0xE2F9E066),UINT32_C(0x53ADDB77),UINT32_C(0x3FD01081),UINT32_C(0x8B338D5E),
+    UINT32_C(0xFE42E658),UINT32_C(0xD91E533A),UINT32_C(0x6795D7AB),UINT32_C(0x67F86694),UINT32_C(0x7BA281B4),UINT32_C(0xB29B5434),UINT32_C(0x669BAFB9),UINT32_C(0x994909C5),
+    UINT32_C(0x6230AB31),UINT32_C(0x9358444C),UINT32_C(0x14341071),UINT32_C(0xC3A7858F),UINT32_C(0x675B2DD2),UINT32_C(0x2D1E088C),UINT32_C(0x8649EB5E),UINT32_C(0x41BCBEDD),
+    UINT32_C(0x90116AEE),UINT32_C(0x47DE650F),UINT32_C(0x8B5A7D3E),UINT32_C(0x08E74650),UINT32_C(0x1D6D8688),UINT32_C(0xF0495CFB),UINT32_C(0x3FFA7EC4),UINT32_C(0xA1FEC000),
+    UINT32_C(0x303BD030),UINT32_C(0x83D63538),UINT32_C(0x583E3FA3),UINT32_C(0x077FDAEF),UINT32_C(0x0BB4F1EF),UINT32_C(0x21F80583),UINT32_C(0xC44DF85C),UINT32_C(0x873A5D43),
+    UINT32_C(0x4C18F526),UINT32_C(0xE981BE93),UINT32_C(0x7BF02815),UINT32_C(0xD95D2FA7),UINT32_C(0xB1DDBA06),UINT32_C(0x4F52CB02),UINT32_C(0xAE86E7BF),UINT32_C(0x23156BFB),
+    UINT32_C(0x15DB9670),UINT32_C(0xED5B6B38),UINT32_C(0xE5FFDD1D),UINT32_C(0x6608C09D),UINT32_C(0xB0F29645),UINT32_C(0x87D4B039),UINT32_C(0x7775AE02),UINT32_C(0xB370A1A9),
+    UINT32_C(0x47986568),UINT32_C(0xC6A6464C),UINT32_C(0xF304978D),UINT32_C(0xE2B2D815),UINT32_C(0x15CB3159),UINT32_C(0xD89AAA5B),UINT32_C(0x17439B18),UINT32_C(0x37969348),
+    UINT32_C(0xE7CD403E),UINT32_C(0xE27DBA9B),UINT32_C(0xADE001A8),UINT32_C(0x49502803),UINT32_C(0x7D161005),UINT32_C(0x6300BD73),UINT32_C(0x76A4C88B),UINT32_C(0x7EE8B962),
+    UINT32_C(0x2647A4C1),UINT32_C(0x77FEF87E),UINT32_C(0x7BE21372),UINT32_C(0x0F9C923E),UINT32_C(0xA6E0B548),UINT32_C(0x9B618FE8),UINT32_C(0xDAE91CF5),UINT32_C(0xA284F483),
+    UINT32_C(0x070F14B0),UINT32_C(0xB67B9F26),UINT32_C(0x33809A23),UINT32_C(0x93BECE6C),UINT32_C(0x30F58808),UINT32_C(0x65E268F8),UINT32_C(0x25BD5588),UINT32_C(0x94628DE0),
+    UINT32_C(0xCE5B2D08),UINT32_C(0x4EAC9219),UINT32_C(0xD5482EB5),UINT32_C(0xBDC27B2F),UINT32_C(0x37CD85AC),UINT32_C(0xA696A9F4),UINT32_C(0x0BA18097),UINT32_C(0x9CFBC28D),
+    UINT32_C(0xE2D8D1D2),UINT32_C(0x2DE7C4D5),UINT32_C(0x926EF804),UINT32_C(0xF1D29BDD),UINT32_C(0xE8019C4B),UINT32_C(0xC54262B9),UINT32_C(0xBC8F76F7),UINT32_C(0x10033BF8),
+    UINT32_C(0xB5966524),UINT32_C(0x6C62CBBA),UINT32_C(0xC6598499),UINT32_C(0xF1C9975F),UINT32_C(0xDC52D11D),UINT32_C(0x02295D93),UINT32_C(0x923B6811),UINT32_C(0xA06EA369),
+    UINT32_C(0x331D5BAD),UINT32_C(0x50DACD95),UINT32_C(0x186E30DF),UINT32_C(0x0F2787C9),UINT32_C(0xEA1E6941),UINT32_C(0x25CA723A),UINT32_C(0x04764CC9),UINT32_C(0x1B38C599),
+    UINT32_C(0x0EFAF769),UINT32_C(0x0E882A64),UINT32_C(0x67AB43FF),UINT32_C(0x2C07DE2C),UINT32_C(0x4047A8D7),UINT32_C(0x6A4E6204),UINT32_C(0x4B0F81DE),UINT32_C(0x9E50E39B),
+    UINT32_C(0xBD96C036),UINT32_C(0xCE36794F),UINT32_C(0xE84DAFD5),UINT32_C(0x3A8D8D7B),UINT32_C(0xC5CBA176),UINT32_C(0x30BC102C),UINT32_C(0xCE93DBF9),UINT32_C(0x6DCC2704),
+    UINT32_C(0x697C8140),UINT32_C(0xA4039ADA),UINT32_C(0x957299E8),UINT32_C(0x3EDFBA6E),UINT32_C(0x721622BE),UINT32_C(0x4526E870),UINT32_C(0x2A0CACFE),UINT32_C(0x5BC71910),
+    UINT32_C(0xB52142DB),UINT32_C(0xB1B32C82),UINT32_C(0x381814D2),UINT32_C(0x816F9D8C),UINT32_C(0xFD6B3731),UINT32_C(0x9F59CC3E),UINT32_C(0xEBFD2DFA),UINT32_C(0x6BE77CDB),
+    UINT32_C(0xD2870108),UINT32_C(0xA21B0FB7),UINT32_C(0x0507C199),UINT32_C(0x88155C26),UINT32_C(0x7D0CF5E3),UINT32_C(0xE0990DC6),UINT32_C(0x415482A7),UINT32_C(0x9842027B),
+    UINT32_C(0xF6F21A2E),UINT32_C(0x8EC8063B),UINT32_C(0xA512E19B),UINT32_C(0x0CA3C754),UINT32_C(0x0F37F158),UINT32_C(0xE60B8A5B),UINT32_C(0xC43F6CE4),UINT32_C(0x3D1DBE43),
+    UINT32_C(0xF3B1F4BC),UINT32_C(0x853AC8B5),UINT32_C(0xF5849B5C),UINT32_C(0xBC6B9349),UINT32_C(0xB9269DDD),UINT32_C(0xEEE13D2A),UINT32_C(0xD4A643D0),UINT32_C(0xEC1B7B91),
+    UINT32_C(0x71A29981),UINT32_C(0xAB378FC9),UINT32_C(0x888B055D),UINT32_C(0x256BD757),UINT32_C(0x6FDFE309),UINT32_C(0x84E868C9),UINT32_C(0x5F9A5801),UINT32_C(0xAE118D8B),
+    UINT32_C(0xC0E498C3),UINT32_C(0x39C33C41),UINT32_C(0x1645526F),UINT32_C(0x9C8A68DF),UINT32_C(0xFAD14F7D),UINT32_C(0x93F5AC29),UINT32_C(0x6546E3CB),UINT32_C(0xA62E2FD3),
+    UINT32_C(0xD731BB47),UINT32_C(0x89E78998),UINT32_C(0x90D44D69),UINT32_C(0xA43BFFAF),UINT32_C(0x72226472),UINT32_C(0x0D95BEB0),UINT32_C(0x2FBCA613),UINT32_C(0x455441E7),
+    UINT32_C(0x02C39885),UINT32_C(0xD56AAED5),UINT32_C(0xA9FFAD44),UINT32_C(0x4A8BDECE),UINT32_C(0xA2E37CEF),UINT32_C(0xA8E0152E),UINT32_C(0x37532471),UINT32_C(0xA55ABE6A),
+    UINT32_C(0xDA2580FD),UINT32_C(0xAD89BF65),UINT32_C(0xCC2A3DEC),UINT32_C(0x7EC360B1),UINT32_C(0xC1F52676),UINT32_C(0x3C4AE863),UINT32_C(0x088F2B9E),UINT32_C(0xE7C47EA0),
+    UINT32_C(0x80101C06),UINT32_C(0x69B35DE1),UINT32_C(0x0FB8E1FA),UINT32_C(0xDB62D3F7),UINT32_C(0x475CBA2A),UINT32_C(0xB1507762),UINT32_C(0x9B30AD26),UINT32_C(0xE9094581),
+    UINT32_C(0xFEA6AC93),UINT32_C(0x6DEF9364),UINT32_C(0xE86CBC87),UINT32_C(0x9462F53F),UINT32_C(0x41907F1E),UINT32_C(0x40E02BBA),UINT32_C(0x0BDB91A2),UINT32_C(0x93CC884A),
+    UINT32_C(0x399D4499),UINT32_C(0x9E66CBA2),UINT32_C(0x1B91F776),UINT32_C(0xFAF29945),UINT32_C(0x04C72D6F),UINT32_C(0x7A599A2F),UINT32_C(0x1C249235),UINT32_C(0x4F0432CE),
+    UINT32_C(0x293AFEB2),UINT32_C(0x5D41D6D8),UINT32_C(0x7F1E8C00),UINT32_C(0x7677224F),UINT32_C(0x231C2121),UINT32_C(0x6B228FA3),UINT32_C(0xC4A6232D),UINT32_C(0xAA196A04),
+    UINT32_C(0xE297285E),UINT32_C(0x5396936F),UINT32_C(0xDB8D384F),UINT32_C(0x78DDEFAF),UINT32_C(0x49A235D1),UINT32_C(0x5742FC47),UINT32_C(0xF43212CB),UINT32_C(0x415F3088),
+    UINT32_C(0xB73BD17B),UINT32_C(0x15BC30D1),UINT32_C(0x5FC9B71A),UINT32_C(0xC5DCB8BB),UINT32_C(0x05AE1D2C),UINT32_C(0x1460F680),UINT32_C(0xD696D1E0),UINT32_C(0xDA2C4681),
+    UINT32_C(0x6CF86B69),UINT32_C(0x512D7565),UINT32_C(0x775E98B7),UINT32_C(0x166D0F83),UINT32_C(0x0E55F238),UINT32_C(0x2D3EDF2B),UINT32_C(0xF26AF179),UINT32_C(0xE839F1F4),
+    UINT32_C(0x1A858D2F),UINT32_C(0x6C129576),UINT32_C(0x41DD69AE),UINT32_C(0xF290C59B),UINT32_C(0x9BBC0BA4),UINT32_C(0x504B9C71),UINT32_C(0x87492C1F),UINT32_C(0x5FEE67D4),
+    UINT32_C(0x90078F7E),UINT32_C(0x4F3D6AE8),UINT32_C(0x461F3A63),UINT32_C(0x5A3CE52B),UINT32_C(0xF0E76ABD),UINT32_C(0x65F1A23B),UINT32_C(0x28CCA53F),UINT32_C(0xBB141418),
+    UINT32_C(0x0ADD6CB2),UINT32_C(0x5E2BBE79),UINT32_C(0x4DCC0078),UINT32_C(0xB68FC91E),UINT32_C(0xCA0013F1),UINT32_C(0xAC64CA4F),UINT32_C(0x691FDDD7),UINT32_C(0xE7D10431),
+    UINT32_C(0xD92C0753),UINT32_C(0xE86A25F7),UINT32_C(0x5A461809),UINT32_C(0xEF3320D3),UINT32_C(0x65B41BDF),UINT32_C(0x4E76E28B),UINT32_C(0x59D977DC),UINT32_C(0x4A01D87C),
+    UINT32_C(0xFA9FD02D),UINT32_C(0xF29E02D5),UINT32_C(0x1DB02D91),UINT32_C(0xB44FBC42),UINT32_C(0x86411DDF),UINT32_C(0x9A6B3F1C),UINT32_C(0xA6CF8C46),UINT32_C(0x35012893),
+    UINT32_C(0x8B855699),UINT32_C(0xD3EE76FD),UINT32_C(0x3CBBFBD4),UINT32_C(0x16A5985C),UINT32_C(0x6A0AE8D5),UINT32_C(0x18847417),UINT32_C(0xBFC1110B),UINT32_C(0xF56822CF),
+    UINT32_C(0x6D70D28D),UINT32_C(0x10F92574),UINT32_C(0xF18DCD35),UINT32_C(0xA089B795),UINT32_C(0x75DC1450),UINT32_C(0x8516795A),UINT32_C(0x4848E61D),UINT32_C(0x8A635702),
+    UINT32_C(0x6F483F4F),UINT32_C(0x4ECA3EF1),UINT32_C(0xA4C13207),UINT32_C(0x38B2ACA4),UINT32_C(0x5E44190F),UINT32_C(0x9CC2D2E9),UINT32_C(0x7786A96E),UINT32_C(0xE30EBC81),
+    UINT32_C(0x44959F76),UINT32_C(0xB5B659AF),UINT32_C(0x725F717F),UINT32_C(0x700F6C1F),UINT32_C(0x1B4504BF),UINT32_C(0x75A3B6D1),UINT32_C(0x62DEE734),UINT32_C(0x295AC88A),
+    UINT32_C(0x20855E36),UINT32_C(0x98963DCB),UINT32_C(0xC9B21CA4),UINT32_C(0xAF120EEB),UINT32_C(0x8C429AF4),UINT32_C(0x6A8D016F),UINT32_C(0xD2F60B19),UINT32_C(0x641DF9D8),
+    UINT32_C(0xF1364E2B),UINT32_C(0xE4305D1F),UINT32_C(0xFEED5C19),UINT32_C(0xFEE5B1D0),UINT32_C(0x4EF7A165),UINT32_C(0x3F54B57C),UINT32_C(0x46CF7905),UINT32_C(0xF36669A7),
+    UINT32_C(0x68798550),UINT32_C(0x0F6B7150),UINT32_C(0xD237FCAE),UINT32_C(0x23615CBB),UINT32_C(0x9A91C20F),UINT32_C(0x3D63CCBE),UINT32_C(0xD68B5562),UINT32_C(0x84FC17DF),
+    UINT32_C(0x1913E423),UINT32_C(0x231357A9),UINT32_C(0x6FDC5382),UINT32_C(0xEAAED948),UINT32_C(0x4B0881FC),UINT32_C(0x5617E641),UINT32_C(0xEE52947D),UINT32_C(0x16D86236),
+    UINT32_C(0x8CBC11FC),UINT32_C(0x7FDB870B),UINT32_C(0x50B6F9D4),UINT32_C(0x47491AC6),UINT32_C(0xBB79CA1A),UINT32_C(0x15272D87),UINT32_C(0xD0CA7EC3),UINT32_C(0xBF094CA5),
+    UINT32_C(0x93F2CA6C),UINT32_C(0xB99FEB61),UINT32_C(0xB3B6122A),UINT32_C(0xE6451411),UINT32_C(0xE708FED4),UINT32_C(0x8AE9DDB8),UINT32_C(0xFAE77A3E),UINT32_C(0xB87BC4FC),
+    UINT32_C(0x38839D5C),UINT32_C(0x756264E5),UINT32_C(0xBDC43032),UINT32_C(0xA758307F),UINT32_C(0x070ADFA6),UINT32_C(0xE6EAC433),UINT32_C(0xC5A37F43),UINT32_C(0xCDA88B18),
+    UINT32_C(0xE4D4CD3A),UINT32_C(0x89253009),UINT32_C(0xAFF05FF6),UINT32_C(0xFD0FBA0B),UINT32_C(0x4935461B),UINT32_C(0x756D1C49),UINT32_C(0x1367C444),UINT32_C(0xABCA2ABD),
+    UINT32_C(0x21474F38),UINT32_C(0x37949CEC),UINT32_C(0xF6323D3D),UINT32_C(0xB7CDA569),UINT32_C(0xDE01958E),UINT32_C(0x8DD8B80D),UINT32_C(0x00C355B9),UINT32_C(0xAB317115),
+    UINT32_C(0xF9E5D127),UINT32_C(0x150F3C15),UINT32_C(0xA73A49A8),UINT32_C(0x9A0DBB6F),UINT32_C(0x95080193),UINT32_C(0x4B304002),UINT32_C(0x87749F7A),UINT32_C(0xA6A3653A),
+    UINT32_C(0xC1DBF50A),UINT32_C(0x14539309),UINT32_C(0xADF8D6C2),UINT32_C(0xFD743599),UINT32_C(0x0D51BF45),UINT32_C(0x94E2BA74),UINT32_C(0x98624E76),UINT32_C(0xE15C57A3),
+    UINT32_C(0x6125AEC8),UINT32_C(0xDDFA32B9),UINT32_C(0x75B67B0F),UINT32_C(0x469ACE66),UINT32_C(0x01ABDAB4),UINT32_C(0x50B3B5B6),UINT32_C(0x00B0E85B),UINT32_C(0xBB1B7AE1),
+    UINT32_C(0xD6B52B08),UINT32_C(0x604F2A45),UINT32_C(0x061081AB),UINT32_C(0xF40CBDE5),UINT32_C(0x54EBA670),UINT32_C(0xF29C6626),UINT32_C(0x3BE4B068),UINT32_C(0x74F2BC55),
+    UINT32_C(0x1E31FC36),UINT32_C(0x077E35A6),UINT32_C(0xC92288E1),UINT32_C(0x70C92E17),UINT32_C(0x0F071907),UINT32_C(0xAED3A539),UINT32_C(0x35354B44),UINT32_C(0x116A44FC),
+    UINT32_C(0xFB89895E),UINT32_C(0xD8C426AB),UINT32_C(0xEFCA9C61),UINT32_C(0x6A085EA2),UINT32_C(0x4A905B2C),UINT32_C(0x93583AF1),UINT32_C(0xD8E56221),UINT32_C(0x977C1318),
+    UINT32_C(0xF118ADD4),UINT32_C(0x5349A011),UINT32_C(0x8B6C9B1E),UINT32_C(0x6CFCCEDD),UINT32_C(0xABC7E67F),UINT32_C(0xB15FDB98),UINT32_C(0x5EF3DC9E),UINT32_C(0xA554A816),
+    UINT32_C(0x11232427),UINT32_C(0x5FB8DFF6),UINT32_C(0x45662685),UINT32_C(0x9B49E507),UINT32_C(0xCD009967),UINT32_C(0x0B955A98),UINT32_C(0x778E01C4),UINT32_C(0x6C9E13A6),
+    UINT32_C(0x3167B338),UINT32_C(0x7974A19E),UINT32_C(0x66BCEEEB),UINT32_C(0xA8BFCD35),UINT32_C(0x4F89C9D3),UINT32_C(0xE8DEE989),UINT32_C(0xF8802348),UINT32_C(0xA61B2E07),
+    UINT32_C(0x969A48F2),UINT32_C(0x32D550C2),UINT32_C(0xDC755365),UINT32_C(0x8EF0AB44),UINT32_C(0x50E48F6E),UINT32_C(0x4FC059CA),UINT32_C(0xCF4FBF2E),UINT32_C(0xEBE837C5),
+    UINT32_C(0x66A955CC),UINT32_C(0x8B33C56B),UINT32_C(0xD78E0A73),UINT32_C(0x90C2604F),UINT32_C(0x71DB1D82),UINT32_C(0xDE124FFF),UINT32_C(0x78F30BA4),UINT32_C(0xA62C6E0E),
+    UINT32_C(0xAD72DD6A),UINT32_C(0x15C9B8CE),UINT32_C(0x4670F152),UINT32_C(0xAF42AD0F),UINT32_C(0xE6F8A792),UINT32_C(0x7C3ECA52),UINT32_C(0x671D8003),UINT32_C(0x27F2396C),
+    UINT32_C(0xF369C598),UINT32_C(0xB5511A05),UINT32_C(0xE792AA51),UINT32_C(0x3E40C35D),UINT32_C(0x4FDEBF0B),UINT32_C(0x05A8BA07),UINT32_C(0x15D7D9C3),UINT32_C(0x5C75F817),
+    UINT32_C(0x6CB1C6E1),UINT32_C(0xF769E5D1),UINT32_C(0xD20D8531),UINT32_C(0xA26B4D0D),UINT32_C(0xA91CDB5F),UINT32_C(0x90532C00),UINT32_C(0x400128BD),UINT32_C(0x70EA2CD4),
+    UINT32_C(0x9C9B4320),UINT32_C(0xF6F962E9),UINT32_C(0x8D80ED7E),UINT32_C(0x296D79F9),UINT32_C(0xAB8E062E),UINT32_C(0x2863459F),UINT32_C(0xDE116573),UINT32_C(0x340FF74A),
+    UINT32_C(0x9EB8522E),UINT32_C(0x86912EDD),UINT32_C(0xBFDDD205),UINT32_C(0x2E2EFB3C),UINT32_C(0x3CE0ACE4),UINT32_C(0xD8579CBF),UINT32_C(0x5CB1AFB1),UINT32_C(0x9886F603),
+    UINT32_C(0x23EC32E8),UINT32_C(0x35548503),UINT32_C(0x8B738A7C),UINT32_C(0x87DD0CE1),UINT32_C(0x669D9DF9),UINT32_C(0x70330C59),UINT32_C(0x9263E2B7),UINT32_C(0xEB7C539F),
+    UINT32_C(0x149893E2),UINT32_C(0x35BC025E),UINT32_C(0x547A177A),UINT32_C(0x72D3AE49),UINT32_C(0x85C4FEA0),UINT32_C(0x7CCF0650),UINT32_C(0x710EDC8D),UINT32_C(0xF8E109F2),
+    UINT32_C(0xC105573C),UINT32_C(0x77A63A3D),UINT32_C(0x80C6B444),UINT32_C(0x78F7D5C0),UINT32_C(0xF741C57B),UINT32_C(0x431A5704),UINT32_C(0x5A3FFA09),UINT32_C(0x2EFA4D31),
+    UINT32_C(0xD945C460),UINT32_C(0xD4AD0E3E),UINT32_C(0x794D31AD),UINT32_C(0x3085A588),UINT32_C(0xBCFB9832),UINT32_C(0x903CE960),UINT32_C(0x1E66D62D),UINT32_C(0x3FDA53BC),
+    UINT32_C(0x5BDCF1D6),UINT32_C(0x383C9EB7),UINT32_C(0x411A11F9),UINT32_C(0x9581CEBC),UINT32_C(0x8A46DD4C),UINT32_C(0x4F2E925C),UINT32_C(0x57FB207E),UINT32_C(0x126215F8),
+    UINT32_C(0xF5EF34FA),UINT32_C(0xD8D98C17),UINT32_C(0x657A3B9C),UINT32_C(0x8BDDB9FA),UINT32_C(0x27DA1A8F),UINT32_C(0xA63FA026),UINT32_C(0x7B2682D6),UINT32_C(0x6273B291),
+    UINT32_C(0x48B3213B),UINT32_C(0xF7DED422),UINT32_C(0x26BA215D),UINT32_C(0x30EC90EA),UINT32_C(0x257A9CF5),UINT32_C(0x0CBDD6C3),UINT32_C(0x29EA26C1),UINT32_C(0x4A542EBC),
+    UINT32_C(0x2F70BAD6),UINT32_C(0xB1D505FC),UINT32_C(0x77F48B79),UINT32_C(0x7E3C2BDA),UINT32_C(0x5B1D3682),UINT32_C(0x669F1520),UINT32_C(0x0AB77D26),UINT32_C(0x71FD8207),
+    UINT32_C(0x9D9EFBFB),UINT32_C(0x1AAA1BD6),UINT32_C(0x883F5D32),UINT32_C(0x5E9CF61B),UINT32_C(0x03F0B0CB),UINT32_C(0x0E423384),UINT32_C(0x10A7A774),UINT32_C(0x00000000),
+};
+static const uint32_t tcrand_i_mt19937_long_jump_poly[624] = {
+    UINT32_C(0x8A3F8B13),UINT32_C(0x58052C92),UINT32_C(0x2A5AA76D),UINT32_C(0x2610AC01),UINT32_C(0xC7191E8F),UINT32_C(0x2E90B816),UINT32_C(0xCF79BB47),UINT32_C(0x23E41408),
+    UINT32_C(0xE7069FF8),UINT32_C(0xD0D28723),UINT32_C(0x593F0E48),UINT32_C(0x834DCB26),UINT32_C(0xF9BA8808),UINT32_C(0x62B3983A),UINT32_C(0x69DE7081),UINT32_C(0xBEDEEE9B),
+    UINT32_C(0xAE7FD362),UINT32_C(0xD1E87347),UINT32_C(0xB67CFD94),UINT32_C(0x491D1F54),UINT32_C(0x4936D9D3),UINT32_C(0x7E5E229A),UINT32_C(0x265DF9F8),UINT32_C(0x10891045),
+    UINT32_C(0x1F3AC61A),UINT32_C(0xBAA912E4),UINT32_C(0x4206C54C),UINT32_C(0x4300C936),UINT32_C(0x902A613C),UINT32_C(0x662B4778),UINT32_C(0x2100C9F5),UINT32_C(0xA5A9BECC),
+    UINT32_C(0x0BFC3BB1),UINT32_C(0xAC3CD3A9),UINT32_C(0x27CFFDC8),UINT32_C(0x3627915C),UINT32_C(0x0E85EEAD),UINT32_C(0x55707D8E),UINT32_C(0xB3C4BC94),UINT32_C(0xA7076D66),
+    UINT32_C(0xE280F426),UINT32_C(0xE85D01C1),UINT32_C(0x5599C569),UINT32_C(0x180769F1),UINT32_C(0x99A6CC49),UINT32_C(0x6F82E31F),UINT32_C(0xF114A983),UINT32_C(0x6FA6C8D3),
+    UINT32_C(0xBEF18C1E),UINT32_C(0x4DCD4C40),UINT32_C(0xBF8E73A5),UINT32_C(0x5A236B19),UINT32_C(0x7D4AFC0B),UINT32_C(0x0BDDB2D8),UINT32_C(0xE9037874),UINT32_C(0xFBCC73C8),
+    UINT32_C(0x1CCD63D3),UINT32_C(0xCC99A7E3),UINT32_C(0x4FE5C98C),UINT32_C(0x0A1FC286),UINT32_C(0x6028F325),UINT32_C(0x070EA1F4),UINT32_C(0x540A5A5F),UINT32_C(0x1487DEFA),
+    UINT32_C(0x5AD97395),UINT32_C(0xD151ABA2),UINT32_C(0x3D0171DC),UINT32_C(0x98C8830B),UINT32_C(0x8C68D842),UINT32_C(0xEF466B61),UINT32_C(0xCC8A2C8C),UINT32_C(0xEC8E4CD2),
+    UINT32_C(0xBB59E5DD),UINT32_C(0x98FC79E9),UINT32_C(0xF3CC4E59),UINT32_C(0x48898C48),UINT32_C(0xA8271C99),UINT32_C(0x7C5BCC0C),UINT32_C(0xB398C8BB),UINT32_C(0xACE7EAB4),
+    UINT32_C(0xF78CF763),UINT32_C(0xF641EF46),UINT32_C(0x35595655),UINT32_C(0x91E97C4F),UINT32_C(0xE6276595),UINT32_C(0xCD2DBFC4),UINT32_C(0xD57A4AC4),UINT32_C(0x824B4CB0),
+    UINT32_C(0x8F75FEB6),UINT32_C(0x6C172C72),UINT32_C(0x2B957554),UINT32_C(0x1E45CC39),UINT32_C(0xB0C19A83),UINT32_C(0xE34060A1),UINT32_C(0xEB1A700B),UINT32_C(0x1E44ACF4),
+    UINT32_C(0x6C6BF7BC),UINT32_C(0x38901E58),UINT32_C(0xE6012B14),UINT32_C(0xB07E9A9A),UINT32_C(0x69740845),UINT32_C(0x670E7687),UINT32_C(0x518A60F6),UINT32_C(0x080F8EFA),
+    UINT32_C(0x8F2E9478),UINT32_C(0x8A2D1B72),UINT32_C(0x1F5E71C7),UINT32_C(0x25BE8B3B),UINT32_C(0xAD5BFCD1),UINT32_C(0xFE1971D3),UINT32_C(0x3D0821C8),UINT32_C(0xAF319983),
+    UINT32_C(0x6799C358),UINT32_C(0x79FB657F),UINT32_C(0x3E5A08EC),UINT32_C(0x4FFC6D6A),UINT32_C(0xC733D160),UINT32_C(0x765126AC),UINT32_C(0x5079A00A),UINT32_C(0x26EE02A6),
+    UINT32_C(0xD0A826A2),UINT32_C(0x66F5DBB2),UINT32_C(0xA7B02057),UINT32_C(0x8C5C3BBE),UINT32_C(0x2BBA35AE),UINT32_C(0xFA2B8245),UINT32_C(0x5FE615E5),UINT32_C(0xCE35D997),
+    UINT32_C(0xE3BB16CB),UINT32_C(0x0257D499),UINT32_C(0x550DDE2D),UINT32_C(0xA6BAE0C3),UINT32_C(0x48567A5B),UINT32_C(0x3528C175),UINT32_C(0x821A2CBF),UINT32_C(0x9F1046DA),
+    UINT32_C(0x6F36AC45),UINT32_C(0xE25EDF3A),UINT32_C(0x04A0AB3D),UINT32_C(0xFB73FF22),UINT32_C(0x313A0663),UINT32_C(0xE487DFA8),UINT32_C(0x35AAB9D7),UINT32_C(0xA6877F7D),
+    UINT32_C(0xEF715096),UINT32_C(0xB0E8BF23),UINT32_C(0x7BD98AA8),UINT32_C(0x4D05CBD4),UINT32_C(0xFDA200F8),UINT32_C(0x083E629D),UINT32_C(0x1082801B),UINT32_C(0xDDF17B10),
+    UINT32_C(0xE37E5421),UINT32_C(0x4E8B6E48),UINT32_C(0x1628E584),UINT32_C(0x33659F4C),UINT32_C(0xDBA06886),UINT32_C(0x499C4C30),UINT32_C(0x1CFFDEBE),UINT32_C(0xEB3963A5),
+    UINT32_C(0x703EB31B),UINT32_C(0x2848CD05),UINT32_C(0x97539791),UINT32_C(0x96FD0330),UINT32_C(0xA1FB8DA6),UINT32_C(0x3D4E2213),UINT32_C(0xDF8B88CD),UINT32_C(0x21F71279),
+    UINT32_C(0xD906AE7D),UINT32_C(0x3D22D39B),UINT32_C(0x609FFBF7),UINT32_C(0x5887BA16),UINT32_C(0x8DB25A29),UINT32_C(0xA0D815CC),UINT32_C(0x0AA6062A),UINT32_C(0x04D4AE6A),
+    UINT32_C(0x47017623),UINT32_C(0xE5FF08D0),UINT32_C(0x9BC5AEED),UINT32_C(0x0AD61BFD),UINT32_C(0x9BA92A1E),UINT32_C(0xF38F4131),UINT32_C(0xD4EE74C4),UINT32_C(0xDECCE4F4),
+    UINT32_C(0x3FDE7413),UINT32_C(0xBEB6C00C),UINT32_C(0xD09B5C5E),UINT32_C(0xCA8401A6),UINT32_C(0x52C7E41A),UINT32_C(0x3E440E84),UINT32_C(0x7B319A84),UINT32_C(0x393811FC),
+    UINT32_C(0xE0878A07),UINT32_C(0x202DAC7B),UINT32_C(0x29B82AD5),UINT32_C(0xD4F8B450),UINT32_C(0xA71398FF),UINT32_C(0x013314E7),UINT32_C(0x6E24A0DF),UINT32_C(0x6B3B484D),
+    UINT32_C(0xE8189C17),UINT32_C(0xE0669946),UINT32_C(0xE6343F4D),UINT32_C(0x558F2FF7),UINT32_C(0x4A86B570),UINT32_C(0xC1ED5C17),UINT32_C(0x669169DD),UINT32_C(0xA1BC4D3B),
+    UINT32_C(0xDDFE8009),UINT32_C(0xFB7E80BD),UINT32_C(0x86A377D6),UINT32_C(0x6C048F45),UINT32_C(0x6F0FF9E0),UINT32_C(0xB846A3C5),UINT32_C(0x7E1FFE4E),UINT32_C(0xEAEED0CE),
+    UINT32_C(0xFDB56AC0),UINT32_C(0xFD49086D),UINT32_C(0x1DDEA080),UINT32_C(0x717FBB02),UINT32_C(0x0515C086),UINT32_C(0xD8E6C19A),UINT32_C(0x376252E2),UINT32_C(0xC703D30B),
+    UINT32_C(0x65AEB321),UINT32_C(0x1A3550A3),UINT32_C(0x2D96DB8F),UINT32_C(0x2C5DE97D),UINT32_C(0x4C84FF58),UINT32_C(0xE98DAE05),UINT32_C(0xEB85B0CC),UINT32_C(0xAE917EAE),
+    UINT32_C(0xC8B418E1),UINT32_C(0x1C9DB782),UINT32_C(0x87850767),UINT32_C(0x2FCDE11D),UINT32_C(0xF355B3DA),UINT32_C(0x0E28C323),UINT32_C(0xF46B4181),UINT32_C(0x8152E90D),
+    UINT32_C(0xA2934B76),UINT32_C(0x74B7CE67),UINT32_C(0x34F750A2),UINT32_C(0x92461FB3),UINT32_C(0x29CBD3D0),UINT32_C(0xEE7E656C),UINT32_C(0xBED27914),UINT32_C(0xA68EC404),
+    UINT32_C(0x9BD8FCEE),UINT32_C(0x3FF52A97),UINT32_C(0x24221EC5),UINT32_C(0x0AB6BAB1),UINT32_C(0xC89719C4),UINT32_C(0xC7393A55),UINT32_C(0x4935BF2F),UINT32_C(0xD85EC8C8),
+    UINT32_C(0x5E9501A8),UINT32_C(0xDC476EED),UINT32_C(0x2DA723DB),UINT32_C(0x3E39173F),UINT32_C(0x64A6A73C),UINT32_C(0x3A85CF6E),UINT32_C(0x7D562E5B),UINT32_C(0x83FED7B3),
+    UINT32_C(0xF6B242BF),UINT32_C(0x7304AD13),UINT32_C(0x2BC460B0),UINT32_C(0x412EBE05),UINT32_C(0xF93C28D8),UINT32_C(0xE4B0F696),UINT32_C(0x8860AFC3),UINT32_C(0x808B622A),
+    UINT32_C(0x4F8EF4F4),UINT32_C(0x0611AD18),UINT32_C(0x27B74DDA),UINT32_C(0x969B6FBB),UINT32_C(0x17D0BE5E),UINT32_C(0x2A0FC3F3),UINT32_C(0x1212F514),UINT32_C(0xE597BBDD),
+    UINT32_C(0xD6D2A64E),UINT32_C(0x9B1A514E),UINT32_C(0x3570B686),UINT32_C(0x014C7A1C),UINT32_C(0x093E2867),UINT32_C(0x40FB091A),UINT32_C(0xFF310627),UINT32_C(0xBA3D5F18),
+    UINT32_C(0x8857AC7E),UINT32_C(0x6B4C6F40),UINT32_C(0x3E336143),UINT32_C(0x385BA511),UINT32_C(0xB0CD91DE),UINT32_C(0xDF0B6D21),UINT32_C(0x1C55D83B),UINT32_C(0x772BC0FA),
+    UINT32_C(0x29407447),UINT32_C(0xCBC86926),UINT32_C(0xDAB55215),UINT32_C(0xC1E1065F),UINT32_C(0x76C2B1D0),UINT32_C(0xACD13154),UINT32_C(0xD1D667A0),UINT32_C(0x502A1D38),
+    UINT32_C(0xCDE86A94),UINT32_C(0x1C8C8D97),UINT32_C(0x37C01D6A),UINT32_C(0x95D26820),UINT32_C(0x8DF7BBA8),UINT32_C(0xAA7705B1),UINT32_C(0xD805B2C9),UINT32_C(0xA4894895),
+    UINT32_C(0xD1F6E593),UINT32_C(0x858BF063),UINT32_C(0xAE95F2D8),UINT32_C(0x0758010B),UINT32_C(0x0B7BF285),UINT32_C(0xDA7B38B9),UINT32_C(0xBFD6B7C7),UINT32_C(0xF94B41C2),
+    UINT32_C(0x27673237),UINT32_C(0xA7331F38),UINT32_C(0xE87DF989),UINT32_C(0x6D61962D),UINT32_C(0xF1749ED8),UINT32_C(0x09AB2E17),UINT32_C(0x36E65F1B),UINT32_C(0xC8EEBD16),
+    UINT32_C(0x4B56F995),UINT32_C(0x1DFF84AD),UINT32_C(0xEE386C48),UINT32_C(0x99BEB9DA),UINT32_C(0x9FCDF6A6),UINT32_C(0xE3987E60),UINT32_C(0xB948FA68),UINT32_C(0xD8BA7845),
+    UINT32_C(0x4A7A4C41),UINT32_C(0xDC240932),UINT32_C(0x97F155F6),UINT32_C(0x4926641D),UINT32_C(0x838981A3),UINT32_C(0xDFF1ECAC),UINT32_C(0xB3F47B0F),UINT32_C(0x1A1FD1A0),
+    UINT32_C(0x05E5DDEB),UINT32_C(0x0DD81562),UINT32_C(0xE4D88EDA),UINT32_C(0x8530E66B),UINT32_C(0x6E4F3594),UINT32_C(0x39F4C707),UINT32_C(0x16D53345),UINT32_C(0x4BD8C81D),
+    UINT32_C(0x12841EC1),UINT32_C(0xBAC6F741),UINT32_C(0xCB5A0F27),UINT32_C(0xD7ECF7F3),UINT32_C(0x572934F4),UINT32_C(0x8BFF7055),UINT32_C(0x154FAD9F),UINT32_C(0xFE61B60E),
+    UINT32_C(0x5670EDE3),UINT32_C(0xB43E6928),UINT32_C(0x3A16AE55),UINT32_C(0x1BF5767D),UINT32_C(0x0835CFB8),UINT32_C(0x0BCB4F37),UINT32_C(0x134AE96C),UINT32_C(0x4298212C),
+    UINT32_C(0x81AE6866),UINT32_C(0x7F025363),UINT32_C(0xA2F4A6E8),UINT32_C(0x59D4F4D8),UINT32_C(0x337D7657),UINT32_C(0xDB71E09B),UINT32_C(0xAEB74372),UINT32_C(0x3C4AD5FD),
+    UINT32_C(0x70BAF9F2),UINT32_C(0x81913B75),UINT32_C(0xAEC3E8F7),UINT32_C(0xBA304639),UINT32_C(0x6AE3794F),UINT32_C(0x36ADA85C),UINT32_C(0x35C64E6D),UINT32_C(0xBF484ACF),
+    UINT32_C(0x2D2FD650),UINT32_C(0x7B755015),UINT32_C(0x290A94E1),UINT32_C(0xA20A0E93),UINT32_C(0x8A5BE100),UINT32_C(0x26A925F5),UINT32_C(0xFEBAD49F),UINT32_C(0x46D6C061),
+    UINT32_C(0x90EC3679),UINT32_C(0x09C05C71),UINT32_C(0x915FF282),UINT32_C(0xD018898D),UINT32_C(0x8DE4FB71),UINT32_C(0x02DD7B80),UINT32_C(0x2581B181),UINT32_C(0x7E125375),
+    UINT32_C(0x4118DB22),UINT32_C(0xC2D60576),UINT32_C(0x26D87599),UINT32_C(0xD122666D),UINT32_C(0xC96790A4),UINT32_C(0x830E55DC),UINT32_C(0xDCD2BB73),UINT32_C(0x22435DA0),
+    UINT32_C(0x3DEC058F),UINT32_C(0xAD0C9951),UINT32_C(0x12F1207B),UINT32_C(0x8EF7ABDE),UINT32_C(0x2ED85B78),UINT32_C(0x2FD90896),UINT32_C(0x0D087637),UINT32_C(0x617AF234),
+    UINT32_C(0x6A1BF854),UINT32_C(0xD8024FEA),UINT32_C(0x0A27EEBE),UINT32_C(0x2592B39E),UINT32_C(0x04DF5577),UINT32_C(0x3AEB664E),UINT32_C(0xAF22D851),UINT32_C(0x959ABDDA),
+    UINT32_C(0x1F2DEAE6),UINT32_C(0x34779051),UINT32_C(0xB1455C45),UINT32_C(0x032038FD),UINT32_C(0xB04A46D5),UINT32_C(0x6749ADA0),UINT32_C(0xCBD43642),UINT32_C(0x87FC9FA2),
+    UINT32_C(0x424A0BD1),UINT32_C(0x51920378),UINT32_C(0x27B5AD45),UINT32_C(0x1E4AECC4),UINT32_C(0xAF1561E9),UINT32_C(0x3FC2942F),UINT32_C(0xD9E653B7),UINT32_C(0xDCC74048),
+    UINT32_C(0x66566EC6),UINT32_C(0xC5546981),UINT32_C(0xCCC181B5),UINT32_C(0x8A22CBFB),UINT32_C(0x449F203B),UINT32_C(0xDF21BD1D),UINT32_C(0xA789B2FE),UINT32_C(0x81C5DC75),
+    UINT32_C(0x64637939),UINT32_C(0x151E1234),UINT32_C(0x3568FE30),UINT32_C(0x32316120),UINT32_C(0xE641DC9C),UINT32_C(0x7D4BF8BD),UINT32_C(0xAD362572),UINT32_C(0xB5C92653),
+    UINT32_C(0x86F132A9),UINT32_C(0xC7A70ABD),UINT32_C(0x34115108),UINT32_C(0x7C2D4199),UINT32_C(0x0EA16FFC),UINT32_C(0x4D1903CF),UINT32_C(0xB40E1EA8),UINT32_C(0x47A61CBC),
+    UINT32_C(0xD209E549),UINT32_C(0x2714D86E),UINT32_C(0xAEE90A25),UINT32_C(0x86A1CA81),UINT32_C(0x70648D15),UINT32_C(0x9F0F81A7),UINT32_C(0xF2A1C18F),UINT32_C(0xF6AE123A),
+    UINT32_C(0x83239B1B),UINT32_C(0x21ECA285),UINT32_C(0x3D243BC5),UINT32_C(0x317DFD2E),UINT32_C(0x324EDCBB),UINT32_C(0x1FB69D73),UINT32_C(0x84DD9406),UINT32_C(0xC58D80C2),
+    UINT32_C(0xB848DF2A),UINT32_C(0x4A1C0BEA),UINT32_C(0xD73700E1),UINT32_C(0xD721E50D),UINT32_C(0xE3F6499A),UINT32_C(0x486773E5),UINT32_C(0xA85176C7),UINT32_C(0xE3ED739F),
+    UINT32_C(0xC857B3FE),UINT32_C(0xAC355E57),UINT32_C(0x38FDC74E),UINT32_C(0x3A8A8B1D),UINT32_C(0x36F711CE),UINT32_C(0x59F32871),UINT32_C(0x48C8E870),UINT32_C(0x6DB94447),
+    UINT32_C(0xCA8A205D),UINT32_C(0xF9558EDC),UINT32_C(0x67F21885),UINT32_C(0x3CBA167B),UINT32_C(0x4F2B5565),UINT32_C(0x0D1D3F04),UINT32_C(0x7A310224),UINT32_C(0x949ADA4F),
+    UINT32_C(0xA7DC0168),UINT32_C(0xE8D88152),UINT32_C(0x68B2CA9D),UINT32_C(0xAB84CFEA),UINT32_C(0x9843E4C5),UINT32_C(0x00221C15),UINT32_C(0x43BD1351),UINT32_C(0xBA0094B0),
+    UINT32_C(0x3B70E876),UINT32_C(0xDB27E1C0),UINT32_C(0x076928EA),UINT32_C(0x2BD927E0),UINT32_C(0xE4E0E249),UINT32_C(0x8E14F055),UINT32_C(0x4663A153),UINT32_C(0x0D9ABA34),
+    UINT32_C(0xE005943C),UINT32_C(0x96CCFDD0),UINT32_C(0xDE950CC9),UINT32_C(0xBFC99CEC),UINT32_C(0x369922E3),UINT32_C(0xDBCBBE70),UINT32_C(0x7B65E839),UINT32_C(0xDD3D8682),
+    UINT32_C(0xA70A30D3),UINT32_C(0x697CD8D6),UINT32_C(0xA4FF491C),UINT32_C(0x45631678),UINT32_C(0x67BD3739),UINT32_C(0xFD4BD683),UINT32_C(0x3EDB80D5),UINT32_C(0x2BEF6DE8),
+    UINT32_C(0xC0F9C795),UINT32_C(0x40543B97),UINT32_C(0xA7566C7C),UINT32_C(0x997921BF),UINT32_C(0x8DBE8C22),UINT32_C(0x62619FE4),UINT32_C(0xDBD447BE),UINT32_C(0x53A3140C),
+    UINT32_C(0xA4F28F01),UINT32_C(0x4AF561DD),UINT32_C(0xD886D227),UINT32_C(0x05DEA358),UINT32_C(0x30180DC4),UINT32_C(0x64EA3BB9),UINT32_C(0xB491AD68),UINT32_C(0x3F39C0EE),
+    UINT32_C(0xEA254010),UINT32_C(0x82250DCE),UINT32_C(0xA4305542),UINT32_C(0xACEAC1DD),UINT32_C(0x7AF6839E),UINT32_C(0x28AEBFCC),UINT32_C(0x681BAAE0),UINT32_C(0x629D0DB5),
+    UINT32_C(0xDAD41087),UINT32_C(0x74EA8207),UINT32_C(0x21182393),UINT32_C(0x8668D288),UINT32_C(0x47630AEE),UINT32_C(0x60C2D61A),UINT32_C(0xAF18D537),UINT32_C(0x23BF9D60),
+    UINT32_C(0xD0EB3FC5),UINT32_C(0xC502036A),UINT32_C(0x12B82353),UINT32_C(0x54BE1CA5),UINT32_C(0x9C989CDC),UINT32_C(0x71C99D4E),UINT32_C(0xBB79A52F),UINT32_C(0x2AC6648A),
+    UINT32_C(0xE06B5276),UINT32_C(0xBBFB1704),UINT32_C(0x0B03A227),UINT32_C(0x796AD401),UINT32_C(0xF6ECBD19),UINT32_C(0xF150E884),UINT32_C(0xDBD73CBE),UINT32_C(0x682C954B),
+    UINT32_C(0xE1964587),UINT32_C(0xEEA67674),UINT32_C(0xDBB43A78),UINT32_C(0xA13DB164),UINT32_C(0x3C9E106D),UINT32_C(0xF27469E2),UINT32_C(0x2EFC94BE),UINT32_C(0x88ED115F),
+    UINT32_C(0x73919FAF),UINT32_C(0x63607766),UINT32_C(0xB3096525),UINT32_C(0xE1B6A047),UINT32_C(0x02691A3D),UINT32_C(0x676C7647),UINT32_C(0x0C100C2E),UINT32_C(0xDE57A5C0),
+    UINT32_C(0x86718DE4),UINT32_C(0x6CEBA898),UINT32_C(0x74DDF417),UINT32_C(0xC3CB36F8),UINT32_C(0xEE149E34),UINT32_C(0xAB3BE378),UINT32_C(0xBF1F82D3),UINT32_C(0x7E0EA502),
+    UINT32_C(0x3786E4F9),UINT32_C(0xC80580A4),UINT32_C(0x310CC769),UINT32_C(0x070BB0F4),UINT32_C(0xAF982238),UINT32_C(0x846AECCB),UINT32_C(0x8555B258),UINT32_C(0x8C1498C8),
+    UINT32_C(0xAF24600B),UINT32_C(0xAD980796),UINT32_C(0xF42059C5),UINT32_C(0xC2133F0C),UINT32_C(0x4FDA7546),UINT32_C(0x60DABF50),UINT32_C(0xB7D6CB24),UINT32_C(0x00000000),
+};
+static void tcrand_i_mt19937_jump_by(struct TC_I_RandGen_MTData* mtdata, const uint32_t* poly)
+{
+    enum { N = sizeof(mtdata->mt) / sizeof(*mtdata->mt), M = 397 };
+    /*
+     * The state is viewed as the window (x[t-1], x[t], ..., x[t+N-2]) of the
+     * untempered sequence, where x[t] is the next output (only the top bit of
+     * x[t-1] matters for the recurrence). The jump is then the sum of the
+     * windows at each step `i` for which the coefficient of x^i is set.
+     */
+    uint32_t ext[2 * N];
+    uint32_t acc[N];
+    unsigned short index = mtdata->index;
+    assert(index > 0);
+
+    memcpy(ext, mtdata->mt, sizeof(mtdata->mt));
+    for(unsigned short i = N; i < index + N - 1; i++)
+    {
+        uint32_t y = (ext[i-N] & ~UINT32_C(0x7FFFFFFF)) + (ext[i-N+1] & UINT32_C(0x7FFFFFFF));
+        ext[i] = ext[i-N+M] ^ (y >> 1) ^ ((y & 1) ? UINT32_C(0x9908B0DF) : 0);
+    }
+    uint32_t* win = ext + index - 1;
+
+    memset(acc, 0, sizeof(acc));
+    unsigned short s = 0;
+    for(unsigned int i = 0; i < 19937; i++)
+    {
+        if((poly[i / 32] >> (i % 32)) & 1)
+        {
+            unsigned short k;
+            for(k = 0; k < N - s; k++) acc[k] ^= win[s + k];
+            for(; k < N; k++) acc[k] ^= win[s + k - N];
+        }
+        uint32_t y = (win[s] & ~UINT32_C(0x7FFFFFFF)) + (win[(s+1) % N] & UINT32_C(0x7FFFFFFF));
+        win[s] = win[(s+M) % N] ^ (y >> 1) ^ ((y & 1) ? UINT32_C(0x9908B0DF) : 0);
+        s = (s + 1) % N;
+    }
+
+    memcpy(mtdata->mt, acc, sizeof(mtdata->mt));
+    mtdata->index = 1;
+}
+static void tcrand_i_mt19937_jump(void* data, int longjump)
+{
+    struct TC_I_RandGen_MTData* mtdata = TC__VOID_CAST(struct TC_I_RandGen_MTData*,data);
+    tcrand_i_mt19937_jump_by(mtdata, longjump ? tcrand_i_mt19937_long_jump_poly : tcrand_i_mt19937_jump_poly);
+}
 static TC_RandGen* tcrand_i_mt19937_clone(void* data, TC_RandGen* ngen)
 {
     struct TC_I_RandGen_MTData* mtdata = TC__VOID_CAST(struct TC_I_RandGen_MTData*,data);
@@ -477,6 +1105,12 @@ static void tcrand_i_mt19937_64_next(void* data, void* value)
 
     *TC__STATIC_CAST(uint64_t*,value) = y;
 }
+static void tcrand_i_mt19937_64_fill(void* data, void* values, size_t n)
+{
+    uint64_t* uvalues = TC__STATIC_CAST(uint64_t*,values);
+    for(size_t i = 0; i < n; i++)
+        tcrand_i_mt19937_64_next(data, &uvalues[i]);
+}
 static TC_RandGen* tcrand_i_mt19937_64_clone(void* data, TC_RandGen* ngen)
 {
     struct TC_I_RandGen_MT64Data* mtdata = TC__VOID_CAST(struct TC_I_RandGen_MT64Data*,data);
@@ -508,6 +1142,22 @@ static void tcrand_i_splitmix64_next(void* data, void* value)
     z = (z ^ (z >> 27)) * UINT64_C(0x94D049BB133111EB);
     *TC__STATIC_CAST(uint64_t*,value) = z ^ (z >> 31);
 }
+static void tcrand_i_splitmix64_fill(void* data, void* values, size_t n)
+{
+    struct TC_I_RandGen_SplitMix64Data* smdata = TC__VOID_CAST(struct TC_I_RandGen_SplitMix64Data*,data);
+    uint64_t* uvalues = TC__STATIC_CAST(uint64_t*,values);
+
+    TC_RandSplitMix64 g;
+    g.state = smdata->state;
+    for(size_t i = 0; i < n; i++)
+        uvalues[i] = tcrand_splitmix64_next(&g);
+    smdata->state = g.state;
+}
+static void tcrand_i_splitmix64_advance(void* data, uint64_t delta)
+{
+    struct TC_I_RandGen_SplitMix64Data* smdata = TC__VOID_CAST(struct TC_I_RandGen_SplitMix64Data*,data);
+    smdata->state += delta * UINT64_C(0x9E3779B97F4A7C15);
+}
 static TC_RandGen* tcrand_i_splitmix64_clone(void* data, TC_RandGen* ngen)
 {
     struct TC_I_RandGen_SplitMix64Data* smdata = TC__VOID_CAST(struct TC_I_RandGen_SplitMix64Data*,data);
@@ -519,6 +1169,165 @@ static TC_RandGen* tcrand_i_splitmix64_clone(void* data, TC_RandGen* ngen)
     return ngen;
 }
 
+struct TC_I_RandGen_PCGData
+{
+    TC_RandPCG32 pcg;
+    uint64_t seed_buf[2];
+    uint32_t value_buf[1];
+};
+// seed layout: { initstate, initseq }
+static void tcrand_i_pcg_xsh_rr_seed(void* data, const void* seed)
+{
+    struct TC_I_RandGen_PCGData* pdata = TC__VOID_CAST(struct TC_I_RandGen_PCGData*,data);
+    uint64_t useed[2];
+    memcpy(useed, seed, sizeof(useed));
+    tcrand_pcg32_seed(&pdata->pcg, useed[0], useed[1]);
+}
+static void tcrand_i_pcg_xsh_rr_next(void* data, void* value)
+{
+    struct TC_I_RandGen_PCGData* pdata = TC__VOID_CAST(struct TC_I_RandGen_PCGData*,data);
+    *TC__STATIC_CAST(uint32_t*,value) = tcrand_pcg32_next(&pdata->pcg);
+}
+static void tcrand_i_pcg_xsh_rr_fill(void* data, void* values, size_t n)
+{
+    struct TC_I_RandGen_PCGData* pdata = TC__VOID_CAST(struct TC_I_RandGen_PCGData*,data);
+    tcrand_pcg32_fill_u32(&pdata->pcg, TC__STATIC_CAST(uint32_t*,values), n);
+}
+static void tcrand_i_pcg_xsh_rr_advance(void* data, uint64_t delta)
+{
+    struct TC_I_RandGen_PCGData* pdata = TC__VOID_CAST(struct TC_I_RandGen_PCGData*,data);
+    tcrand_pcg32_advance(&pdata->pcg, delta);
+}
+static TC_RandGen* tcrand_i_pcg_xsh_rr_clone(void* data, TC_RandGen* ngen)
+{
+    struct TC_I_RandGen_PCGData* pdata = TC__VOID_CAST(struct TC_I_RandGen_PCGData*,data);
+    struct TC_I_RandGen_PCGData* npdata = TC_MALLOC_T_(struct TC_I_RandGen_PCGData);
+    *npdata = *pdata;
+    ngen->data = npdata;
+    ngen->seed_ptr = npdata->seed_buf;
+    ngen->value_ptr = npdata->value_buf;
+    return ngen;
+}
+
+struct TC_I_RandGen_PhiloxData
+{
+    uint32_t key[2];
+    uint64_t pos;
+    uint32_t block[4];
+    uint32_t seed_buf[2];
+    uint32_t value_buf[1];
+};
+static void tcrand_i_philox4x32_block(struct TC_I_RandGen_PhiloxData* pdata, uint32_t* block, uint64_t bpos)
+{
+    uint32_t ctr[4];
+    ctr[0] = TC__STATIC_CAST(uint32_t,bpos);
+    ctr[1] = TC__STATIC_CAST(uint32_t,bpos >> 32);
+    ctr[2] = ctr[3] = 0;
+    tcrand_philox4x32_10(block, ctr, pdata->key);
+}
+static void tcrand_i_philox4x32_seed(void* data, const void* seed)
+{
+    struct TC_I_RandGen_PhiloxData* pdata = TC__VOID_CAST(struct TC_I_RandGen_PhiloxData*,data);
+    memcpy(pdata->key, seed, sizeof(pdata->key));
+    pdata->pos = 0;
+}
+static void tcrand_i_philox4x32_next(void* data, void* value)
+{
+    struct TC_I_RandGen_PhiloxData* pdata = TC__VOID_CAST(struct TC_I_RandGen_PhiloxData*,data);
+    if(!(pdata->pos & 3))
+        tcrand_i_philox4x32_block(pdata, pdata->block, pdata->pos >> 2);
+    *TC__STATIC_CAST(uint32_t*,value) = pdata->block[pdata->pos++ & 3];
+}
+static void tcrand_i_philox4x32_fill(void* data, void* values, size_t n)
+{
+    struct TC_I_RandGen_PhiloxData* pdata = TC__VOID_CAST(struct TC_I_RandGen_PhiloxData*,data);
+    uint32_t* uvalues = TC__STATIC_CAST(uint32_t*,values);
+
+    size_t i = 0;
+    for(; i < n && (pdata->pos & 3); i++)
+        tcrand_i_philox4x32_next(data, &uvalues[i]);
+    for(; i + 4 <= n; i += 4, pdata->pos += 4)
+        tcrand_i_philox4x32_block(pdata, &uvalues[i], pdata->pos >> 2);
+    for(; i < n; i++)
+        tcrand_i_philox4x32_next(data, &uvalues[i]);
+}
+static void tcrand_i_philox4x32_advance(void* data, uint64_t delta)
+{
+    struct TC_I_RandGen_PhiloxData* pdata = TC__VOID_CAST(struct TC_I_RandGen_PhiloxData*,data);
+    pdata->pos += delta;
+    if(pdata->pos & 3)
+        tcrand_i_philox4x32_block(pdata, pdata->block, pdata->pos >> 2);
+}
+static TC_RandGen* tcrand_i_philox4x32_clone(void* data, TC_RandGen* ngen)
+{
+    struct TC_I_RandGen_PhiloxData* pdata = TC__VOID_CAST(struct TC_I_RandGen_PhiloxData*,data);
+    struct TC_I_RandGen_PhiloxData* npdata = TC_MALLOC_T_(struct TC_I_RandGen_PhiloxData);
+    *npdata = *pdata;
+    ngen->data = npdata;
+    ngen->seed_ptr = npdata->seed_buf;
+    ngen->value_ptr = npdata->value_buf;
+    return ngen;
+}
+
+struct TC_I_RandGen_ThreefryData
+{
+    uint64_t key[4];
+    uint64_t pos;
+    uint64_t block[4];
+    uint64_t seed_buf[4];
+    uint64_t value_buf[1];
+};
+static void tcrand_i_threefry4x64_block(struct TC_I_RandGen_ThreefryData* tdata, uint64_t* block, uint64_t bpos)
+{
+    uint64_t ctr[4];
+    ctr[0] = bpos;
+    ctr[1] = ctr[2] = ctr[3] = 0;
+    tcrand_threefry4x64_20(block, ctr, tdata->key);
+}
+static void tcrand_i_threefry4x64_seed(void* data, const void* seed)
+{
+    struct TC_I_RandGen_ThreefryData* tdata = TC__VOID_CAST(struct TC_I_RandGen_ThreefryData*,data);
+    memcpy(tdata->key, seed, sizeof(tdata->key));
+    tdata->pos = 0;
+}
+static void tcrand_i_threefry4x64_next(void* data, void* value)
+{
+    struct TC_I_RandGen_ThreefryData* tdata = TC__VOID_CAST(struct TC_I_RandGen_ThreefryData*,data);
+    if(!(tdata->pos & 3))
+        tcrand_i_threefry4x64_block(tdata, tdata->block, tdata->pos >> 2);
+    *TC__STATIC_CAST(uint64_t*,value) = tdata->block[tdata->pos++ & 3];
+}
+static void tcrand_i_threefry4x64_fill(void* data, void* values, size_t n)
+{
+    struct TC_I_RandGen_ThreefryData* tdata = TC__VOID_CAST(struct TC_I_RandGen_ThreefryData*,data);
+    uint64_t* uvalues = TC__STATIC_CAST(uint64_t*,values);
+
+    size_t i = 0;
+    for(; i < n && (tdata->pos & 3); i++)
+        tcrand_i_threefry4x64_next(data, &uvalues[i]);
+    for(; i + 4 <= n; i += 4, tdata->pos += 4)
+        tcrand_i_threefry4x64_block(tdata, &uvalues[i], tdata->pos >> 2);
+    for(; i < n; i++)
+        tcrand_i_threefry4x64_next(data, &uvalues[i]);
+}
+static void tcrand_i_threefry4x64_advance(void* data, uint64_t delta)
+{
+    struct TC_I_RandGen_ThreefryData* tdata = TC__VOID_CAST(struct TC_I_RandGen_ThreefryData*,data);
+    tdata->pos += delta;
+    if(tdata->pos & 3)
+        tcrand_i_threefry4x64_block(tdata, tdata->block, tdata->pos >> 2);
+}
+static TC_RandGen* tcrand_i_threefry4x64_clone(void* data, TC_RandGen* ngen)
+{
+    struct TC_I_RandGen_ThreefryData* tdata = TC__VOID_CAST(struct TC_I_RandGen_ThreefryData*,data);
+    struct TC_I_RandGen_ThreefryData* ntdata = TC_MALLOC_T_(struct TC_I_RandGen_ThreefryData);
+    *ntdata = *tdata;
+    ngen->data = ntdata;
+    ngen->seed_ptr = ntdata->seed_buf;
+    ngen->value_ptr = ntdata->value_buf;
+    return ngen;
+}
+
 TC_RandGen* tcrand_init_lcg32(TC_RandGen* rgen, uint32_t a, uint32_t c, uint32_t m)
 {
     if(!rgen) return NULL;
@@ -532,6 +1341,9 @@ TC_RandGen* tcrand_init_lcg32(TC_RandGen* rgen, uint32_t a, uint32_t c, uint32_t
     rgen->seed = tcrand_i_lcg_seed;
     rgen->next = tcrand_i_lcg_next;
     rgen->clone = tcrand_i_lcg_clone;
+    rgen->fill = tcrand_i_lcg_fill;
+    rgen->jump = NULL;
+    rgen->advance = tcrand_i_lcg_advance;
     rgen->dealloc = tcrand_i_free_dealloc;
     rgen->data = lcgdata;
     rgen->seed_len = sizeof(lcgdata->seed_buf);
@@ -556,6 +1368,9 @@ TC_RandGen* tcrand_init_lcg64(TC_RandGen* rgen, uint64_t a, uint64_t c, uint64_t
     rgen->seed = tcrand_i_lcg_64_seed;
     rgen->next = tcrand_i_lcg_64_next;
     rgen->clone = tcrand_i_lcg_64_clone;
+    rgen->fill = tcrand_i_lcg_64_fill;
+    rgen->jump = NULL;
+    rgen->advance = tcrand_i_lcg_64_advance;
     rgen->dealloc = tcrand_i_free_dealloc;
     rgen->data = lcgdata;
     rgen->seed_len = sizeof(lcgdata->seed_buf);
@@ -574,6 +1389,9 @@ TC_RandGen* tcrand_init_well(TC_RandGen* rgen, size_t statelen)
     rgen->seed = tcrand_i_well_seed;
     rgen->next = tcrand_i_well_next;
     rgen->clone = tcrand_i_well_clone;
+    rgen->fill = tcrand_i_well_fill;
+    rgen->jump = NULL;
+    rgen->advance = NULL;
     rgen->dealloc = tcrand_i_free_dealloc;
     rgen->data = wdata;
     rgen->seed_len = statelen * sizeof(*wdata->state);
@@ -604,6 +1422,9 @@ TC_RandGen* tcrand_init_xoroshiro128plus(TC_RandGen* rgen)
     rgen->seed = tcrand_i_xoroshiro128plus_seed;
     rgen->next = tcrand_i_xoroshiro128plus_next;
     rgen->clone = tcrand_i_xoroshiro128plus_clone;
+    rgen->fill = tcrand_i_xoroshiro128plus_fill;
+    rgen->jump = tcrand_i_xoroshiro128plus_jump;
+    rgen->advance = NULL;
     rgen->dealloc = tcrand_i_free_dealloc;
     rgen->data = xdata;
     rgen->seed_len = sizeof(xdata->seed_buf);
@@ -620,6 +1441,9 @@ TC_RandGen* tcrand_init_mt19937(TC_RandGen* rgen)
     rgen->seed = tcrand_i_mt19937_seed;
     rgen->next = tcrand_i_mt19937_next;
     rgen->clone = tcrand_i_mt19937_clone;
+    rgen->fill = tcrand_i_mt19937_fill;
+    rgen->jump = tcrand_i_mt19937_jump;
+    rgen->advance = NULL;
     rgen->dealloc = tcrand_i_free_dealloc;
     rgen->data = mtdata;
     rgen->seed_len = sizeof(mtdata->seed_buf);
@@ -636,6 +1460,9 @@ TC_RandGen* tcrand_init_mt19937_64(TC_RandGen* rgen)
     rgen->seed = tcrand_i_mt19937_64_seed;
     rgen->next = tcrand_i_mt19937_64_next;
     rgen->clone = tcrand_i_mt19937_64_clone;
+    rgen->fill = tcrand_i_mt19937_64_fill;
+    rgen->jump = NULL;
+    rgen->advance = NULL;
     rgen->dealloc = tcrand_i_free_dealloc;
     rgen->data = mtdata;
     rgen->seed_len = sizeof(mtdata->seed_buf);
@@ -652,6 +1479,9 @@ TC_RandGen* tcrand_init_splitmix64(TC_RandGen* rgen)
     rgen->seed = tcrand_i_splitmix64_seed;
     rgen->next = tcrand_i_splitmix64_next;
     rgen->clone = tcrand_i_splitmix64_clone;
+    rgen->fill = tcrand_i_splitmix64_fill;
+    rgen->jump = NULL;
+    rgen->advance = tcrand_i_splitmix64_advance;
     rgen->dealloc = tcrand_i_free_dealloc;
     rgen->data = smdata;
     rgen->seed_len = sizeof(smdata->state);
@@ -661,6 +1491,67 @@ TC_RandGen* tcrand_init_splitmix64(TC_RandGen* rgen)
     rgen->value_ptr = smdata->value_buf;
     return rgen;
 }
+// http://www.pcg-random.org/
+TC_RandGen* tcrand_init_pcg_xsh_rr(TC_RandGen* rgen)
+{
+    if(!rgen) return NULL;
+    struct TC_I_RandGen_PCGData* pdata = TC_MALLOC_T_(struct TC_I_RandGen_PCGData);
+    rgen->seed = tcrand_i_pcg_xsh_rr_seed;
+    rgen->next = tcrand_i_pcg_xsh_rr_next;
+    rgen->clone = tcrand_i_pcg_xsh_rr_clone;
+    rgen->fill = tcrand_i_pcg_xsh_rr_fill;
+    rgen->jump = NULL;
+    rgen->advance = tcrand_i_pcg_xsh_rr_advance;
+    rgen->dealloc = tcrand_i_free_dealloc;
+    rgen->data = pdata;
+    rgen->seed_len = sizeof(pdata->seed_buf);
+    rgen->seed_ptr = pdata->seed_buf;
+    rgen->value_blen = sizeof(pdata->value_buf);
+    rgen->value_alen = sizeof(uint32_t);
+    rgen->value_ptr = pdata->value_buf;
+    return rgen;
+}
+// http://www.thesalmons.org/john/random123/
+TC_RandGen* tcrand_init_philox4x32(TC_RandGen* rgen)
+{
+    if(!rgen) return NULL;
+    struct TC_I_RandGen_PhiloxData* pdata = TC_MALLOC_T_(struct TC_I_RandGen_PhiloxData);
+    memset(pdata, 0, sizeof(*pdata));
+    rgen->seed = tcrand_i_philox4x32_seed;
+    rgen->next = tcrand_i_philox4x32_next;
+    rgen->clone = tcrand_i_philox4x32_clone;
+    rgen->fill = tcrand_i_philox4x32_fill;
+    rgen->jump = NULL;
+    rgen->advance = tcrand_i_philox4x32_advance;
+    rgen->dealloc = tcrand_i_free_dealloc;
+    rgen->data = pdata;
+    rgen->seed_len = sizeof(pdata->seed_buf);
+    rgen->seed_ptr = pdata->seed_buf;
+    rgen->value_blen = sizeof(pdata->value_buf);
+    rgen->value_alen = sizeof(uint32_t);
+    rgen->value_ptr = pdata->value_buf;
+    return rgen;
+}
+TC_RandGen* tcrand_init_threefry4x64(TC_RandGen* rgen)
+{
+    if(!rgen) return NULL;
+    struct TC_I_RandGen_ThreefryData* tdata = TC_MALLOC_T_(struct TC_I_RandGen_ThreefryData);
+    memset(tdata, 0, sizeof(*tdata));
+    rgen->seed = tcrand_i_threefry4x64_seed;
+    rgen->next = tcrand_i_threefry4x64_next;
+    rgen->clone = tcrand_i_threefry4x64_clone;
+    rgen->fill = tcrand_i_threefry4x64_fill;
+    rgen->jump = NULL;
+    rgen->advance = tcrand_i_threefry4x64_advance;
+    rgen->dealloc = tcrand_i_free_dealloc;
+    rgen->data = tdata;
+    rgen->seed_len = sizeof(tdata->seed_buf);
+    rgen->seed_ptr = tdata->seed_buf;
+    rgen->value_blen = sizeof(tdata->value_buf);
+    rgen->value_alen = sizeof(uint64_t);
+    rgen->value_ptr = tdata->value_buf;
+    return rgen;
+}
 TC_RandGen* tcrand_clone(TC_RandGen* ngen, const TC_RandGen* rgen)
 {
     if(!ngen || !rgen) return NULL;
@@ -674,6 +1565,25 @@ void tcrand_deinit(TC_RandGen* rgen)
     if(rgen->dealloc) rgen->dealloc(rgen->data);
 }
 
+int tcrand_jump(TC_RandGen* rgen)
+{
+    if(!rgen->jump) return 0;
+    rgen->jump(rgen->data, 0);
+    return 1;
+}
+int tcrand_long_jump(TC_RandGen* rgen)
+{
+    if(!rgen->jump) return 0;
+    rgen->jump(rgen->data, 1);
+    return 1;
+}
+int tcrand_advance(TC_RandGen* rgen, uint64_t delta)
+{
+    if(!rgen->advance) return 0;
+    rgen->advance(rgen->data, delta);
+    return 1;
+}
+
 // https://stackoverflow.com/questions/33282662/is-the-algorithm-behind-stdseed-seq-defined
 static uint32_t tcrand_i_gen_seedseq_T(uint32_t x)
 {
@@ -743,6 +1653,7 @@ void tcrand_next_bytes(TC_RandGen* rgen, void* bytes, size_t nbytes)
         tcrand_next_raw(rgen, rgen->value_ptr);
         size_t ubytesn = TCRAND_I_MIN(nbytes,rgen->value_alen);
         memcpy(ubytes, rgen->value_ptr, ubytesn);
+        ubytes += ubytesn;
         nbytes -= ubytesn;
     }
 }
@@ -878,4 +1789,287 @@ TC_CDouble tcrand_next_normal2_d(TC_RandGen* rgen, double mean, double sd)
     return ret;
 }
 
+void tcrand_xoroshiro128plus_fill_u64(TC_RandXoroshiro128Plus* g, uint64_t* values, size_t n)
+{
+    TC_RandXoroshiro128Plus lg = *g;
+    for(size_t i = 0; i < n; i++)
+        values[i] = tcrand_xoroshiro128plus_next(&lg);
+    *g = lg;
+}
+void tcrand_pcg32_fill_u32(TC_RandPCG32* g, uint32_t* values, size_t n)
+{
+    TC_RandPCG32 lg = *g;
+    for(size_t i = 0; i < n; i++)
+        values[i] = tcrand_pcg32_next(&lg);
+    *g = lg;
+}
+void tcrand_xoroshiro128plus_x4_fill_u64(TC_RandXoroshiro128PlusX4* g, uint64_t* values, size_t n)
+{
+    TC_RandXoroshiro128PlusX4 lg = *g;
+    size_t i;
+    for(i = 0; i + 4 <= n; i += 4)
+        tcrand_xoroshiro128plus_x4_next(&lg, &values[i]);
+    if(i < n)
+    {
+        uint64_t tail[4];
+        tcrand_xoroshiro128plus_x4_next(&lg, tail);
+        memcpy(&values[i], tail, (n - i) * sizeof(*values));
+    }
+    *g = lg;
+}
+void tcrand_pcg32_x8_fill_u32(TC_RandPCG32X8* g, uint32_t* values, size_t n)
+{
+    TC_RandPCG32X8 lg = *g;
+    size_t i;
+    for(i = 0; i + 8 <= n; i += 8)
+        tcrand_pcg32_x8_next(&lg, &values[i]);
+    if(i < n)
+    {
+        uint32_t tail[8];
+        tcrand_pcg32_x8_next(&lg, tail);
+        memcpy(&values[i], tail, (n - i) * sizeof(*values));
+    }
+    *g = lg;
+}
+
+// http://xoroshiro.di.unimi.it/xoroshiro128plus.c
+static void tcrand_i_xoroshiro128plus_jump_poly(TC_RandXoroshiro128Plus* g, const uint64_t poly[2])
+{
+    uint64_t s0 = 0, s1 = 0;
+    for(int i = 0; i < 2; i++)
+        for(int b = 0; b < 64; b++)
+        {
+            if((poly[i] >> b) & 1)
+            {
+                s0 ^= g->state[0];
+                s1 ^= g->state[1];
+            }
+            tcrand_xoroshiro128plus_next(g);
+        }
+    g->state[0] = s0;
+    g->state[1] = s1;
+}
+void tcrand_xoroshiro128plus_jump(TC_RandXoroshiro128Plus* g)
+{
+    static const uint64_t JUMP[] = { UINT64_C(0xBEAC0467EBA5FACB), UINT64_C(0xD86B048B86AA9922) };
+    tcrand_i_xoroshiro128plus_jump_poly(g, JUMP);
+}
+void tcrand_xoroshiro128plus_long_jump(TC_RandXoroshiro128Plus* g)
+{
+    static const uint64_t LONG_JUMP[] = { UINT64_C(0x18F7C399CCEBDA8D), UINT64_C(0xF2DEAC28BEF3BB07) };
+    tcrand_i_xoroshiro128plus_jump_poly(g, LONG_JUMP);
+}
+// Brown, "Random Number Generation with Arbitrary Strides" (1994); modulus 2^64
+void tcrand_pcg32_advance(TC_RandPCG32* g, uint64_t delta)
+{
+    uint64_t cmul = UINT64_C(6364136223846793005), cadd = g->inc;
+    uint64_t amul = 1, aadd = 0;
+    for(; delta; delta >>= 1)
+    {
+        if(delta & 1)
+        {
+            amul *= cmul;
+            aadd = aadd * cmul + cadd;
+        }
+        cadd = (cmul + 1) * cadd;
+        cmul *= cmul;
+    }
+    g->state = amul * g->state + aadd;
+}
+
+/* number of values (of any type) that the bulk functions convert per batch */
+#define TCRAND_I_FILL_CHUNK 256
+
+void tcrand_fill_raw(TC_RandGen* rgen, void* values, size_t n)
+{
+    if(rgen->fill)
+    {
+        rgen->fill(rgen->data, values, n);
+        return;
+    }
+    unsigned char* uvalues = TC__VOID_CAST(unsigned char*,values);
+    for(size_t i = 0; i < n; i++)
+        rgen->next(rgen->data, uvalues + i * rgen->value_blen);
+}
+void tcrand_fill_bytes(TC_RandGen* rgen, void* bytes, size_t nbytes)
+{
+    unsigned char* ubytes = TC__VOID_CAST(unsigned char*,bytes);
+    uint64_t chunk[TCRAND_I_FILL_CHUNK];
+    size_t blen = rgen->value_blen;
+    size_t alen = rgen->value_alen;
+    size_t cvalues = sizeof(chunk) / blen;
+
+    assert(blen <= sizeof(chunk));
+    while(nbytes)
+    {
+        size_t nvalues = TCRAND_I_MIN(cvalues, (nbytes + alen - 1) / alen);
+        tcrand_fill_raw(rgen, chunk, nvalues);
+        const unsigned char* src = TC__STATIC_CAST(const unsigned char*,(const void*)chunk);
+        if(alen == blen)
+        {
+            size_t ubytesn = TCRAND_I_MIN(nbytes, nvalues * blen);
+            memcpy(ubytes, src, ubytesn);
+            ubytes += ubytesn;
+            nbytes -= ubytesn;
+        }
+        else
+        {
+            for(size_t i = 0; i < nvalues && nbytes; i++)
+            {
+                size_t ubytesn = TCRAND_I_MIN(nbytes, alen);
+                memcpy(ubytes, src + i * blen, ubytesn);
+                ubytes += ubytesn;
+                nbytes -= ubytesn;
+            }
+        }
+    }
+}
+
+// Lemire's nearly divisionless method (https://arxiv.org/abs/1805.10941)
+void tcrand_fill_u32(TC_RandGen* rgen, uint32_t* values, size_t n, uint32_t min, uint32_t max)
+{
+    tcrand_fill_bytes(rgen, values, n * sizeof(*values));
+    max -= min;
+    if(max == UINT32_MAX)
+    {
+        for(size_t i = 0; i < n; i++)
+            values[i] += min;
+        return;
+    }
+    uint32_t range = max + 1U;
+    uint32_t threshold = (0U - range) % range;
+    for(size_t i = 0; i < n; i++)
+    {
+        uint64_t m = TC__STATIC_CAST(uint64_t,values[i]) * range;
+        while(TC__STATIC_CAST(uint32_t,m) < threshold)
+        {
+            uint32_t num;
+            tcrand_next_bytes(rgen, &num, sizeof(num));
+            m = TC__STATIC_CAST(uint64_t,num) * range;
+        }
+        values[i] = min + TC__STATIC_CAST(uint32_t,m >> 32);
+    }
+}
+void tcrand_fill_u64(TC_RandGen* rgen, uint64_t* values, size_t n, uint64_t min, uint64_t max)
+{
+    tcrand_fill_bytes(rgen, values, n * sizeof(*values));
+    max -= min;
+    if(max == UINT64_MAX)
+    {
+        for(size_t i = 0; i < n; i++)
+            values[i] += min;
+        return;
+    }
+    uint64_t mask = tcrand_i_next_pow2_u64(max + 1U) - 1U;
+    for(size_t i = 0; i < n; i++)
+    {
+        uint64_t num = values[i] & mask;
+        while(num > max)
+        {
+            tcrand_next_bytes(rgen, &num, sizeof(num));
+            num &= mask;
+        }
+        values[i] = min + num;
+    }
+}
+
+/*
+ * The float conversions take the top 24 (float) or 53 (double) bits of each
+ * random word; the open interval uses the midpoints of that grid instead of
+ * rejecting 0, which keeps the loops branch-free.
+ */
+#define TCRAND_I_FILL_UNIFORM_F_(NAME, EXPR)                                   \
+void tcrand_fill_uniform_f_##NAME(TC_RandGen* rgen, float* values, size_t n, float min, float max)\
+{                                                                              \
+    uint32_t bits[TCRAND_I_FILL_CHUNK];                                        \
+    while(n)                                                                   \
+    {                                                                          \
+        size_t cn = TCRAND_I_MIN(n, TCRAND_I_FILL_CHUNK);                      \
+        tcrand_fill_bytes(rgen, bits, cn * sizeof(*bits));                     \
+        for(size_t i = 0; i < cn; i++)                                         \
+        {                                                                      \
+            uint32_t b = bits[i];                                              \
+            values[i] = tcrand_i_lerp_f(EXPR, min, max);                       \
+        }                                                                      \
+        values += cn;                                                          \
+        n -= cn;                                                               \
+    }                                                                          \
+}
+#define TCRAND_I_FILL_UNIFORM_D_(NAME, EXPR)                                   \
+void tcrand_fill_uniform_d_##NAME(TC_RandGen* rgen, double* values, size_t n, double min, double max)\
+{                                                                              \
+    uint64_t bits[TCRAND_I_FILL_CHUNK];                                        \
+    while(n)                                                                   \
+    {                                                                          \
+        size_t cn = TCRAND_I_MIN(n, TCRAND_I_FILL_CHUNK);                      \
+        tcrand_fill_bytes(rgen, bits, cn * sizeof(*bits));                     \
+        for(size_t i = 0; i < cn; i++)                                         \
+        {                                                                      \
+            uint64_t b = bits[i];                                              \
+            values[i] = tcrand_i_lerp_d(EXPR, min, max);                       \
+        }                                                                      \
+        values += cn;                                                          \
+        n -= cn;                                                               \
+    }                                                                          \
+}
+TCRAND_I_FILL_UNIFORM_F_(oo, (((b >> 9) << 1) | 1U) * TCRAND_I_INVM24)
+TCRAND_I_FILL_UNIFORM_D_(oo, (((b >> 12) << 1) | 1U) * TCRAND_I_INVM53)
+TCRAND_I_FILL_UNIFORM_F_(co, (b >> 8) * TCRAND_I_INVM24)
+TCRAND_I_FILL_UNIFORM_D_(co, (b >> 11) * TCRAND_I_INVM53)
+TCRAND_I_FILL_UNIFORM_F_(oc, 1.0f - (b >> 8) * TCRAND_I_INVM24)
+TCRAND_I_FILL_UNIFORM_D_(oc, 1.0 - (b >> 11) * TCRAND_I_INVM53)
+TCRAND_I_FILL_UNIFORM_F_(cc, (b >> 8) * TCRAND_I_INVM24M1)
+TCRAND_I_FILL_UNIFORM_D_(cc, (b >> 11) * TCRAND_I_INVM53M1)
+#undef TCRAND_I_FILL_UNIFORM_F_
+#undef TCRAND_I_FILL_UNIFORM_D_
+
+void tcrand_fill_normal_f(TC_RandGen* rgen, float* values, size_t n, float mean, float sd)
+{
+    static const float TwoPI = 6.28318530717958647692528676655900576839433879875021164195f;
+    float u1[TCRAND_I_FILL_CHUNK / 2];
+    float u2[TCRAND_I_FILL_CHUNK / 2];
+
+    while(n)
+    {
+        size_t cn = TCRAND_I_MIN(n, TCRAND_I_FILL_CHUNK);
+        size_t np = (cn + 1) / 2;
+        tcrand_fill_uniform_f_oc(rgen, u1, np, 0.0f, 1.0f);
+        tcrand_fill_uniform_f_co(rgen, u2, np, 0.0f, TwoPI);
+        for(size_t i = 0; i < cn / 2; i++)
+        {
+            float r = sd * sqrtf(-2.0f * logf(u1[i]));
+            values[2 * i + 0] = r * cosf(u2[i]) + mean;
+            values[2 * i + 1] = r * sinf(u2[i]) + mean;
+        }
+        if(cn & 1) /* odd tail: the second value of the last pair is discarded */
+            values[cn - 1] = sd * sqrtf(-2.0f * logf(u1[np - 1])) * cosf(u2[np - 1]) + mean;
+        values += cn;
+        n -= cn;
+    }
+}
+void tcrand_fill_normal_d(TC_RandGen* rgen, double* values, size_t n, double mean, double sd)
+{
+    static const double TwoPI = 6.28318530717958647692528676655900576839433879875021164195;
+    double u1[TCRAND_I_FILL_CHUNK / 2];
+    double u2[TCRAND_I_FILL_CHUNK / 2];
+
+    while(n)
+    {
+        size_t cn = TCRAND_I_MIN(n, TCRAND_I_FILL_CHUNK);
+        size_t np = (cn + 1) / 2;
+        tcrand_fill_uniform_d_oc(rgen, u1, np, 0.0, 1.0);
+        tcrand_fill_uniform_d_co(rgen, u2, np, 0.0, TwoPI);
+        for(size_t i = 0; i < cn / 2; i++)
+        {
+            double r = sd * sqrt(-2.0 * log(u1[i]));
+            values[2 * i + 0] = r * cos(u2[i]) + mean;
+            values[2 * i + 1] = r * sin(u2[i]) + mean;
+        }
+        if(cn & 1) /* odd tail: the second value of the last pair is discarded */
+            values[cn - 1] = sd * sqrt(-2.0 * log(u1[np - 1])) * cos(u2[np - 1]) + mean;
+        values += cn;
+        n -= cn;
+    }
+}
+
 #endif /* TC_RANDOM_IMPLEMENTATION */
@@ -2,12 +2,17 @@
  * tc_string.h: TC_String implementation & handling.
  *
  * DEPENDS:
- * VERSION: 0.0.3 (2016-09-11)
+ * VERSION: 0.1.0 (2026-10-15)
  * LICENSE: CC0 & Boost (dual-licensed)
  * AUTHOR: Tim Cas
  * URL: https://github.com/darkuranium/tclib
  *
  * VERSION HISTORY:
+ * 0.1.0    short strings are now stored inline (see `TCSTR_SSO_SIZE`)
+ *          splicing now grows the buffer geometrically instead of reallocating every time
+ *          UTF-8 offset lookups now start from the last looked-up position
+ *          fixed `tcstr_utf8_find_offset()` returning an offset inside a multi-byte character
+ *          added tcstr_reserve(), tcstr_move() and tcstr_invalidate()
  * 0.0.3    added TC_MALLOC, TC_MEMCPY and friends
  *          added tcstr_utf8_find_offset()
  * 0.0.2    made the library compile with a C++ compiler
@@ -25,6 +30,15 @@
  *
  * It is primarily (but not exclusively) meant for internal use by other TCLib libraries;
  * as such, some of the features might seem out of place, while others might be missing.
+ *
+ * Strings of up to `TCSTR_SSO_SIZE-1` bytes are stored inside the `TC_String`
+ * structure itself, with `ptr` pointing into it. This means that a `TC_String`
+ * must *not* be copied by value (use `tcstr_init` or `tcstr_move` instead).
+ * The default can be overriden by defining `TCSTR_SSO_SIZE` before *every*
+ * inclusion of the header, as it affects the size of the structure.
+ *
+ * Strings must be initialized via one of the `tcstr_init` functions (or
+ * zero-initialized) before use, as the structure contains private data.
  */
 
 /* ========== API ==========
@@ -106,6 +120,46 @@
  *  // str.ptr is now "hello, abc world"
  *  ```
  *
+ *  If `ptr == NULL` and `len > 0`, then `len` uninitialized bytes are inserted.
+ *
+ *
+ * SYNOPSIS:
+ *  TC_String* tcstr_reserve(TC_String* str, size_t len);
+ * PARAMETERS:
+ *  - str: string to reserve memory in
+ *  - len: number of bytes to reserve (not counting the `0`-terminator)
+ * RETURN VALUE:
+ *  `str` if successful, else `NULL` (in which case `str` is unchanged).
+ * DESCRIPTION:
+ *  Make sure that `str` can grow to `len` bytes without reallocating.
+ *
+ *  The contents of `str` are not changed, except that a null string becomes empty.
+ *
+ *
+ * SYNOPSIS:
+ *  TC_String* tcstr_move(TC_String* str, TC_String* src);
+ * PARAMETERS:
+ *  - str: uninitialized (or deinitialized) destination
+ *  - src: string being moved from
+ * RETURN VALUE:
+ *  `str`.
+ * DESCRIPTION:
+ *  Move the contents of `src` into `str`, without copying the data if it is on the heap.
+ *
+ *  `src` is left as the null string.
+ *
+ *
+ * SYNOPSIS:
+ *  void tcstr_invalidate(TC_String* str, size_t off);
+ * PARAMETERS:
+ *  - str: string that was modified
+ *  - off: byte offset of the first modified byte
+ * DESCRIPTION:
+ *  Notify the library that `str->ptr` was modified directly, starting at `off`.
+ *
+ *  This is only necessary for the UTF-8 functions below, which cache the last
+ *  position they looked up; all other `tcstr_` functions keep the cache valid.
+ *
  *
  * SYNOPSIS:
  *  size_t tcstr_utf8_find_offset(const TC_String* str, size_t chr);
@@ -120,6 +174,11 @@
  * DESCRIPTION:
  *  Find the byte offset to the start of a specific Unicode code point, or vice-versa.
  *
+ *  The result is cached in `str` (despite the `const`), and the next lookup
+ *  scans from there. This makes lookups near the previous one (such as when
+ *  moving a cursor) cheap, even in long strings. As the cache is written to,
+ *  `str` must not point to an object that is itself defined as `const`.
+ *
  *
  * SYNOPSIS:
  *  size_t tcstr_utf8_prev_off(const TC_String* str, size_t off);
@@ -138,6 +197,10 @@
 
 #include <stddef.h>
 
+#ifndef TCSTR_SSO_SIZE
+#define TCSTR_SSO_SIZE  32
+#endif /* TCSTR_SSO_SIZE */
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -146,6 +209,11 @@ typedef struct TC_String
 {
     size_t len;
     char* ptr;
+
+    /* private data follows */
+    size_t _mem;            /* heap capacity (including the terminator) */
+    size_t _uoff, _uchr;    /* UTF-8 cache: `_uchr` characters lead up to byte `_uoff` */
+    char _sso[TCSTR_SSO_SIZE];
 } TC_String;
 
 TC_String* tcstr_init(TC_String* str, const TC_String* src);
@@ -157,6 +225,11 @@ TC_String* tcstr_reinits(TC_String* str, const char* ptr, int len);
 TC_String* tcstr_splice(TC_String* str, size_t pos, size_t del, const TC_String* src);
 TC_String* tcstr_splices(TC_String* str, size_t pos, size_t del, const char* ptr, int len);
 
+TC_String* tcstr_reserve(TC_String* str, size_t len);
+TC_String* tcstr_move(TC_String* str, TC_String* src);
+void tcstr_invalidate(TC_String* str, size_t off);
+
+/* (these two update the lookup cache in `str` despite the `const`, so `str` must not be a `const` object itself) */
 /* unicode index -> string offset */
 size_t tcstr_utf8_find_offset(const TC_String* str, size_t chr);
 /* string offset -> unicode index */
@@ -192,6 +265,14 @@ size_t tcstr_utf8_next_off(const TC_String* str, size_t off);
 #endif
 #endif /* TC__VOID_CAST */
 
+#ifndef TC__CONST_CAST
+#ifdef __cplusplus
+#define TC__CONST_CAST(T,v) const_cast<T>(v)
+#else
+#define TC__CONST_CAST(T,v) ((T)(v))
+#endif
+#endif /* TC__CONST_CAST */
+
 #ifndef TC_MALLOC
 #define TC_MALLOC(size)         malloc(size)
 #endif /* TC_MALLOC */
@@ -209,27 +290,82 @@ size_t tcstr_utf8_next_off(const TC_String* str, size_t off);
 #define TC_MEMMOVE(dst,src,len) memmove(dst, src, len)
 #endif /* TC_MEMMOVE */
 
-TC_String* tcstr_init(TC_String* str, const TC_String* src)
+static int tcstr__utf8_is_sync(char c)
 {
-    if(!str) return NULL;
-    if(!src)
+    unsigned char uc = c;
+    return !(uc & 0x80) || (uc & 0xC0) == 0xC0;
+}
+
+static size_t tcstr__capacity(const TC_String* str)
+{
+    if(!str->ptr) return 0;
+    if(str->ptr == str->_sso) return TCSTR_SSO_SIZE;
+    /* (in case a heap string was set up by hand) */
+    return str->_mem > str->len ? str->_mem : str->len + 1;
+}
+/* allocate an uninitialized (but terminated) string of length `len` */
+static TC_String* tcstr__alloc(TC_String* str, size_t len)
+{
+    str->len = len;
+    str->_mem = 0;
+    str->_uoff = str->_uchr = 0;
+    if(len < TCSTR_SSO_SIZE)
+        str->ptr = str->_sso;
+    else
     {
-        str->len = 0;
-        str->ptr = NULL;
+        str->ptr = TC__VOID_CAST(char*,TC_MALLOC(len + 1));
+        if(!str->ptr)
+        {
+            str->len = 0;
+            return NULL;
+        }
+        str->_mem = len + 1;
+    }
+    str->ptr[len] = 0;
+    return str;
+}
+/* `mem` includes the terminator */
+static TC_String* tcstr__grow(TC_String* str, size_t mem)
+{
+    size_t cap = tcstr__capacity(str);
+    char* nptr;
+
+    if(mem <= cap) return str;
+    if(!str->ptr)
+    {
+        if(!tcstr__alloc(str, 0)) return NULL;
+        if(mem <= TCSTR_SSO_SIZE) return str;
     }
-    else if(src->ptr)
+    if(mem < cap + cap / 2)
+        mem = cap + cap / 2;
+
+    if(str->ptr == str->_sso)
     {
-        str->len = src->len;
-        str->ptr = TC__VOID_CAST(char*,TC_MALLOC(src->len + 1));
-        TC_MEMCPY(str->ptr, src->ptr, src->len);
-        str->ptr[src->len] = 0;
+        nptr = TC__VOID_CAST(char*,TC_MALLOC(mem));
+        if(!nptr) return NULL;
+        TC_MEMCPY(nptr, str->_sso, str->len + 1);
     }
     else
     {
-        str->len = 0;
-        str->ptr = TC__VOID_CAST(char*,TC_MALLOC(str->len + 1));
-        str->ptr[str->len] = 0;
+        nptr = TC__VOID_CAST(char*,TC_REALLOC(str->ptr, mem));
+        if(!nptr) return NULL;
     }
+    str->ptr = nptr;
+    str->_mem = mem;
+    return str;
+}
+
+TC_String* tcstr_init(TC_String* str, const TC_String* src)
+{
+    if(!str) return NULL;
+    if(!src)
+        return tcstr_inits(str, NULL, -1);
+    if(!src->ptr)
+        return tcstr__alloc(str, 0);
+
+    if(!tcstr__alloc(str, src->len))
+        return NULL;
+    TC_MEMCPY(str->ptr, src->ptr, src->len);
     return str;
 }
 TC_String* tcstr_inits(TC_String* str, const char* ptr, int len)
@@ -239,28 +375,25 @@ TC_String* tcstr_inits(TC_String* str, const char* ptr, int len)
     {
         if(len < 0) len = strlen(ptr);
 
-        str->len = len;
-        str->ptr = TC__VOID_CAST(char*,TC_MALLOC(len + 1));
+        if(!tcstr__alloc(str, len))
+            return NULL;
         TC_MEMCPY(str->ptr, ptr, len);
-        str->ptr[len] = 0;
     }
     else if(len >= 0)
-    {
-        str->len = len;
-        str->ptr = TC__VOID_CAST(char*,TC_MALLOC(len + 1));
-        str->ptr[len] = 0;
-    }
+        return tcstr__alloc(str, len);
     else
     {
         str->len = 0;
         str->ptr = NULL;
+        str->_mem = 0;
+        str->_uoff = str->_uchr = 0;
     }
     return str;
 }
 void tcstr_deinit(TC_String* str)
 {
     if(!str) return;
-    if(str->ptr)
+    if(str->ptr && str->ptr != str->_sso)
         TC_FREE(str->ptr);
 }
 
@@ -277,29 +410,46 @@ TC_String* tcstr_reinits(TC_String* str, const char* ptr, int len)
 
 TC_String* tcstr_splice(TC_String* str, size_t pos, size_t del, const TC_String* src)
 {
+    size_t i;
+
     if(pos > str->len)
         pos = str->len;
     if(pos + del > str->len)
         del = str->len - pos;
 
     size_t nlen = str->len + src->len - del;
+    if(!tcstr__grow(str, nlen + 1))
+        return NULL;
+
+    /* the UTF-8 cache stays valid if the splice is entirely before (adjusted) or after it */
+    if(pos < str->_uoff)
+    {
+        if(pos + del <= str->_uoff && (src->ptr || !src->len))
+        {
+            for(i = pos; i < pos + del; i++)
+                if(tcstr__utf8_is_sync(str->ptr[i]))
+                    str->_uchr--;
+            for(i = 0; i < src->len; i++)
+                if(tcstr__utf8_is_sync(src->ptr[i]))
+                    str->_uchr++;
+            str->_uoff = str->_uoff - del + src->len;
+        }
+        else
+            str->_uoff = str->_uchr = 0;
+    }
 
     // 0123456789       10  str->len
     //      ^           5   pos
     //        ^         2   del
     // abc              3   src->len
-    // 01234abc56789    13  mlen
     // 01234abc789      11  nlen
 
-    // 0123456789-%
+    // 0123456789%---
     //      ^ ^^    P DL
-    TC_MEMMOVE(str->ptr + pos + src->len, str->ptr + pos + del, nlen - pos - src->len);
-    if(nlen > str->len)
-        str->ptr = TC__VOID_CAST(char*,TC_REALLOC(str->ptr, nlen + 1));
+    TC_MEMMOVE(str->ptr + pos + src->len, str->ptr + pos + del, str->len - pos - del);
     // 01234---789%
-    TC_MEMMOVE(str->ptr + pos, src->ptr, src->len);
-    if(nlen < str->len)
-        str->ptr = TC__VOID_CAST(char*,TC_REALLOC(str->ptr, nlen + 1));
+    if(src->ptr)
+        TC_MEMMOVE(str->ptr + pos, src->ptr, src->len);
     // 01234abc789%
     str->ptr[nlen] = 0;
     str->len = nlen;
@@ -315,32 +465,79 @@ TC_String* tcstr_splices(TC_String* str, size_t pos, size_t del, const char* ptr
     return tcstr_splice(str, pos, del, &src);
 }
 
-static int tcstr__utf8_is_sync(char c)
+TC_String* tcstr_reserve(TC_String* str, size_t len)
 {
-    unsigned char uc = c;
-    return !(uc & 0x80) || (uc & 0xC0) == 0xC0;
+    return tcstr__grow(str, len + 1);
 }
+TC_String* tcstr_move(TC_String* str, TC_String* src)
+{
+    *str = *src;
+    if(src->ptr == src->_sso)
+        str->ptr = str->_sso;
+    tcstr_inits(src, NULL, -1);
+    return str;
+}
+void tcstr_invalidate(TC_String* str, size_t off)
+{
+    if(str->_uoff > off)
+        str->_uoff = str->_uchr = 0;
+}
+
 /* unicode index -> string offset */
 size_t tcstr_utf8_find_offset(const TC_String* str, size_t uidx)
 {
-    size_t i;
-    for(i = 0; i < str->len; i++)
+    /* the cache is not part of the string's value, hence the cast */
+    TC_String* cache = TC__CONST_CAST(TC_String*,str);
+    size_t off = 0, chr = 0;
+
+    if(str->_uoff <= str->len && uidx >= str->_uchr / 2)
     {
-        if(!uidx)
-            break;
-        if(tcstr__utf8_is_sync(str->ptr[i]))
-            uidx--;
+        off = str->_uoff;
+        chr = str->_uchr;
+    }
+    if(chr > uidx) /* scan backward from the cache */
+    {
+        while(chr > uidx)
+            if(tcstr__utf8_is_sync(str->ptr[--off]))
+                chr--;
+    }
+    else
+    {
+        for(; off < str->len; off++)
+            if(tcstr__utf8_is_sync(str->ptr[off]))
+            {
+                if(chr == uidx)
+                    break;
+                chr++;
+            }
     }
-    return i;
+
+    cache->_uoff = off;
+    cache->_uchr = chr;
+    return off;
 }
 /* string offset -> unicode index */
 size_t tcstr_utf8_find_char(const TC_String* str, size_t off)
 {
-    size_t uidx = 0;
-    size_t i;
-    for(i = 0; i < off; i++)
+    TC_String* cache = TC__CONST_CAST(TC_String*,str);
+    size_t i = 0, uidx = 0;
+
+    if(off > str->len)
+        off = str->len;
+    if(str->_uoff <= str->len && off >= str->_uoff / 2)
+    {
+        i = str->_uoff;
+        uidx = str->_uchr;
+    }
+    for(; i > off; i--)
+        if(tcstr__utf8_is_sync(str->ptr[i - 1]))
+            uidx--;
+    for(; i < off; i++)
         if(tcstr__utf8_is_sync(str->ptr[i]))
             uidx++;
+
+    cache->_uoff = off;
+    cache->_uchr = uidx;
     return uidx;
 }
 size_t tcstr_utf8_prev_off(const TC_String* str, size_t off)
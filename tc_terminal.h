@@ -2,12 +2,16 @@
  * tc_terminal.h: Operating system terminal abstraction layer.
  *
  * DEPENDS:
- * VERSION: 0.0.3 (2016-09-11)
+ * VERSION: 0.1.0 (2026-10-15)
  * LICENSE: CC0 & Boost (dual-licensed)
  * AUTHOR: Tim Cas
  * URL: https://github.com/darkuranium/tclib
  *
  * VERSION HISTORY:
+ * 0.1.0    added buffered output (tcterm_set_buffered(), tcterm_flush())
+ *          fixed POSIX colors ignoring the red/green/blue bits
+ *          fixed the cursor position query failing on Linux PTYs (clearing `CREAD`)
+ *          fixed `tcterm_deinit()` failing on terminals without colors
  * 0.0.3    added TC_MALLOC and friends
  * 0.0.2    made the library compile with a C++ compiler
  * 0.0.1    initial public release
@@ -17,6 +21,19 @@
  * - add proper UTF-8 support
  * - (opt?) add support for bold/bright in POSIX
  * - add proper checks for terminal colors
+ *
+ *
+ *
+ * In buffered mode (see `tcterm_set_buffered()`), output to `TCTERM_STDOUT` is
+ * accumulated until `tcterm_flush()`, and then written with a single call;
+ * this makes redraws much faster over slow links (such as SSH) and on Windows.
+ * Attribute and cursor changes that are immediately overriden, or that would
+ * not change anything, are dropped. The buffer is also flushed before reading
+ * input, so that prompts are always visible.
+ *
+ * Buffered mode uses escape sequences on all platforms (on Windows, this
+ * requires Windows 10 or newer), and assumes that all output goes through
+ * this library while it is enabled.
  */
 
 #ifndef TC_TERMINAL_H_
@@ -119,6 +136,11 @@ int tcterm_fprintf(int stream, const char* format, ...);
 int tcterm_vprintf(const char* format, va_list args);
 int tcterm_printf(const char* format, ...);
 
+/* returns 0 if buffering is not supported (older Windows consoles) */
+int tcterm_set_buffered(int buffered);
+/* write all buffered output at once */
+int tcterm_flush(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -127,6 +149,8 @@ int tcterm_printf(const char* format, ...);
 
 #ifdef TC_TERMINAL_IMPLEMENTATION
 #undef TC_TERMINAL_IMPLEMENTATION
+#include <stdlib.h>
+#include <string.h>
 
 #ifdef _WIN32
 #define WIN32_LEAN_AND_MEAN
@@ -157,10 +181,27 @@ int tcterm_printf(const char* format, ...);
 #ifndef TC_MALLOC
 #define TC_MALLOC(size)         malloc(size)
 #endif /* TC_MALLOC */
+#ifndef TC_REALLOC
+#define TC_REALLOC(ptr,size)    realloc(ptr, size)
+#endif /* TC_REALLOC */
 #ifndef TC_FREE
 #define TC_FREE(ptr)            free(ptr)
 #endif /* TC_FREE */
 
+#ifdef _WIN32
+#ifndef ENABLE_VIRTUAL_TERMINAL_PROCESSING
+#define ENABLE_VIRTUAL_TERMINAL_PROCESSING 0x0004
+#endif
+#endif
+
+/* kinds of buffered output, for dropping redundant changes */
+enum
+{
+    TCTERM__OUT_TEXT,
+    TCTERM__OUT_ATTR,
+    TCTERM__OUT_CURSOR
+};
+
 static struct
 {
     int initcount;
@@ -168,12 +209,23 @@ static struct
     HANDLE wh[3];
     WORD defattr;
     DWORD defmode, mode;
+    DWORD defomode;
+    int hasvt;
     CONSOLE_CURSOR_INFO cinfo;
 #else /* POSIX */
     int fh[3];
     struct termios deftc, tc;
     int hascol, isutf;
 #endif
+
+    /* buffered output */
+    int buffered;
+    char* obuf;
+    size_t olen, omem;
+    size_t lastoff; /* offset & kind of the last change, which may be dropped */
+    int lastkind;
+    int attr;       /* terminal state as of the end of the buffer; -1 if unknown */
+    int curx, cury;
 } tcterm__ctx;
 
 #ifdef _WIN32
@@ -193,6 +245,7 @@ static int tcterm__init_handles(HANDLE win, HANDLE wout, HANDLE werr)
     if(!ok) return 0;
     ok = GetConsoleCursorInfo(wout, &tcterm__ctx.cinfo);
     if(!ok) return 0;
+    GetConsoleMode(wout, &tcterm__ctx.defomode);
     return 1;
 }
 /*int tcterm_init_files(FILE* fin, FILE* fout, FILE* ferr)
@@ -237,18 +290,34 @@ int tcterm_init_stdio(void)
     return tcterm__init_fds(STDIN_FILENO, STDOUT_FILENO, STDERR_FILENO);
 #endif
 }
+static void tcterm__buf_free(void)
+{
+    TC_FREE(tcterm__ctx.obuf);
+    tcterm__ctx.obuf = NULL;
+    tcterm__ctx.olen = tcterm__ctx.omem = 0;
+    tcterm__ctx.buffered = 0;
+}
 int tcterm_deinit(void)
 {
     if(--tcterm__ctx.initcount) return 1;
 #ifdef _WIN32
     BOOL ok = 1;
+    ok &= tcterm_flush();
+    tcterm__buf_free();
+    if(tcterm__ctx.hasvt)
+    {
+        ok &= SetConsoleMode(tcterm__ctx.wh[TCTERM_STDOUT], tcterm__ctx.defomode);
+        tcterm__ctx.hasvt = 0;
+    }
     ok &= SetConsoleCursorInfo(tcterm__ctx.wh[TCTERM_STDOUT], &tcterm__ctx.cinfo);
     ok &= SetConsoleMode(tcterm__ctx.wh[TCTERM_STDIN], tcterm__ctx.defmode);
     ok &= SetConsoleTextAttribute(tcterm__ctx.wh[TCTERM_STDOUT], tcterm__ctx.defattr);
     return ok;
 #else /* POSIX */
     int ok = 1;
-    ok &= tcterm_set_attr_default();
+    ok &= !!tcterm_set_attr_default(); /* (2 if colors are unsupported) */
+    ok &= tcterm_flush();
+    tcterm__buf_free();
     ok &= !tcsetattr(tcterm__ctx.fh[TCTERM_STDIN], TCSAFLUSH, &tcterm__ctx.deftc);
     return ok;
 #endif
@@ -304,8 +373,94 @@ int tcterm_is_tty_file(FILE* file)
 #endif
 }
 
+/* unbuffered write */
+static int tcterm__write(int stream, const char* str, int len)
+{
+#ifdef _WIN32
+    wchar_t* wstr = TC__VOID_CAST(wchar_t*,TC_MALLOC((len + 1) * sizeof(wchar_t)));
+
+    int wlen = MultiByteToWideChar(CP_UTF8, 0, str, len, wstr, len + 1);
+
+    if(!wlen)
+    {
+        TC_FREE(wstr);
+        return -1;
+    }
+
+    DWORD written;
+    BOOL ok = WriteConsoleW(tcterm__ctx.wh[stream], wstr, wlen, &written, NULL);
+    TC_FREE(wstr);
+    if(!ok) return -1;
+
+    return written;
+#else /* POSIX */
+    /* $$$ TODO: UTF-8 $$$ */
+    int total = 0;
+    ssize_t ret;
+    while(total < len)
+    {
+        ret = write(tcterm__ctx.fh[stream], str + total, len - total);
+        if(ret < 0) return total ? total : -1;
+        total += ret;
+    }
+    return total;
+#endif
+}
+
+static int tcterm__buf_append(const char* str, size_t len, int kind)
+{
+    /* a change immediately followed by another of the same kind never had any effect */
+    if(kind != TCTERM__OUT_TEXT && tcterm__ctx.lastkind == kind)
+        tcterm__ctx.olen = tcterm__ctx.lastoff;
+
+    if(tcterm__ctx.olen + len > tcterm__ctx.omem)
+    {
+        size_t nmem = tcterm__ctx.omem ? tcterm__ctx.omem * 2 : 256;
+        while(nmem < tcterm__ctx.olen + len)
+            nmem *= 2;
+        char* nbuf = TC__VOID_CAST(char*,TC_REALLOC(tcterm__ctx.obuf, nmem));
+        if(!nbuf) return 0;
+        tcterm__ctx.obuf = nbuf;
+        tcterm__ctx.omem = nmem;
+    }
+    memcpy(tcterm__ctx.obuf + tcterm__ctx.olen, str, len);
+    tcterm__ctx.lastoff = tcterm__ctx.olen;
+    tcterm__ctx.lastkind = kind;
+    tcterm__ctx.olen += len;
+    return 1;
+}
+/* escape sequence for `attr`; `buf` must have room for at least 16 characters */
+static int tcterm__esc_attr(char* buf, int attr)
+{
+    int len = 0;
+    buf[len++] = '\033';
+    buf[len++] = '[';
+    buf[len++] = '0';
+    if(!(attr & TCTERM_FG_DEFAULT))
+        len += sprintf(buf + len, ";%d", ((attr & TCTERM_FG_INTENSE) ? 90 : 30) + (attr & 0x07));
+    if(!(attr & TCTERM_BG_DEFAULT))
+        len += sprintf(buf + len, ";%d", ((attr & TCTERM_BG_INTENSE) ? 100 : 40) + ((attr >> 4) & 0x07));
+    buf[len++] = 'm';
+    return len;
+}
+static int tcterm__buf_attr(int attr)
+{
+    char buf[16];
+    if(attr == tcterm__ctx.attr)
+        return 1;
+    tcterm__ctx.attr = attr;
+    return tcterm__buf_append(buf, tcterm__esc_attr(buf, attr), TCTERM__OUT_ATTR);
+}
+
 int tcterm_set_attr(int attr)
 {
+    if(tcterm__ctx.buffered)
+    {
+#ifndef _WIN32
+        if(!tcterm__ctx.hascol) return 2;
+#endif
+        return tcterm__buf_attr(attr);
+    }
 #ifdef _WIN32
     WORD wattr = 0;
     if(attr & TCTERM_FG_DEFAULT)
@@ -332,18 +487,14 @@ int tcterm_set_attr(int attr)
     return ok;
 #else /* POSIX */
     if(!tcterm__ctx.hascol) return 2;
-    int ok = 1;
-    ok &= tcterm_print("\033[0", -1) > 0;
-    if(!(attr & TCTERM_FG_DEFAULT))
-        ok &= tcterm_printf(";%d", (attr & TCTERM_FG_INTENSE) ? 90 : 30) > 0;
-    if(!(attr & TCTERM_BG_DEFAULT))
-        ok &= tcterm_printf(";%d", (attr & TCTERM_BG_INTENSE) ? 100 : 40) > 0;
-    ok &= tcterm_print("m", -1);
-    return ok;
+    char buf[16];
+    return tcterm_print(buf, tcterm__esc_attr(buf, attr)) > 0;
 #endif
 }
 int tcterm_set_attr_default(void)
 {
+    if(tcterm__ctx.buffered)
+        return tcterm_set_attr(TCTERM_FG_DEFAULT | TCTERM_BG_DEFAULT);
 #ifdef _WIN32
     BOOL ok = 1;
     ok &= SetConsoleTextAttribute(tcterm__ctx.wh[TCTERM_STDOUT], tcterm__ctx.defattr);
@@ -357,6 +508,8 @@ int tcterm_set_attr_default(void)
 
 int tcterm_get_cursor_pos(int* x, int* y)
 {
+    if(!tcterm_flush())
+        return 0;
 #ifdef _WIN32
     CONSOLE_SCREEN_BUFFER_INFO info;
     BOOL ret = GetConsoleScreenBufferInfo(tcterm__ctx.wh[TCTERM_STDOUT], &info);
@@ -364,11 +517,12 @@ int tcterm_get_cursor_pos(int* x, int* y)
     {
         *x = info.dwCursorPosition.X;
         *y = info.dwCursorPosition.Y;
+        tcterm__ctx.curx = *x;
+        tcterm__ctx.cury = *y;
     }
     return ret;
 #else /* POSIX */
     struct termios tmp = tcterm__ctx.tc;
-    tmp.c_cflag &= ~CREAD; /* TODO: make robust (does this do what it was supposed to ...?) */
     tmp.c_lflag &= ~(ECHO | ICANON); /* $$$ TODO: set $$$ */
 
     *x = *y = -1;
@@ -377,7 +531,8 @@ int tcterm_get_cursor_pos(int* x, int* y)
     if(tcsetattr(tcterm__ctx.fh[TCTERM_STDIN], TCSADRAIN, &tmp))
         return 0;
 
-    int ok = tcterm_print("\033[6n", 4) > 0;
+    /* (bypasses the buffer, which was flushed above) */
+    int ok = tcterm__write(TCTERM_STDOUT, "\033[6n", 4) > 0;
     if(ok)
     {
         char chr[2];
@@ -392,12 +547,27 @@ int tcterm_get_cursor_pos(int* x, int* y)
         }
     }
 
+    if(ok)
+    {
+        tcterm__ctx.curx = *x;
+        tcterm__ctx.cury = *y;
+    }
+
     /* TODO: TCSANOW? */
     return !tcsetattr(tcterm__ctx.fh[TCTERM_STDIN], TCSADRAIN, &tcterm__ctx.tc) && ok;
 #endif
 }
 int tcterm_set_cursor_pos(int x, int y)
 {
+    if(tcterm__ctx.buffered)
+    {
+        char buf[32];
+        if(tcterm__ctx.curx >= 0 && x == tcterm__ctx.curx && y == tcterm__ctx.cury)
+            return 1;
+        tcterm__ctx.curx = x;
+        tcterm__ctx.cury = y;
+        return tcterm__buf_append(buf, sprintf(buf, "\033[%d;%dH", y + 1, x + 1), TCTERM__OUT_CURSOR);
+    }
 #ifdef _WIN32
     COORD cpos;
     cpos.X = x;
@@ -421,6 +591,8 @@ int tcterm_set_cursor_pos(int x, int y)
 }*/
 int tcterm_set_cursor_vis(int visible)
 {
+    if(tcterm__ctx.buffered)
+        return tcterm__buf_append(visible ? "\033[?25h" : "\033[?25l", 6, TCTERM__OUT_TEXT);
 #ifdef _WIN32
     CONSOLE_CURSOR_INFO cinfo;
     /*cinfo.dwSize = size;*/
@@ -434,6 +606,13 @@ int tcterm_set_cursor_vis(int visible)
 int tcterm_clear_to_eol(int stream)
 {
     if(stream > TCTERM_STDERR) return -1;
+    if(tcterm__ctx.buffered)
+    {
+        if(stream == TCTERM_STDOUT)
+            return tcterm__buf_append("\033[K", 3, TCTERM__OUT_TEXT);
+        if(!tcterm_flush())
+            return 0;
+    }
 #ifdef _WIN32
     CONSOLE_SCREEN_BUFFER_INFO info;
     BOOL ret = GetConsoleScreenBufferInfo(tcterm__ctx.wh[TCTERM_STDOUT], &info);
@@ -478,6 +657,7 @@ static int tcterm__get_int(int* ret, FILE* file)
 
 int tcterm_getc(void)
 {
+    tcterm_flush();
 #ifdef _WIN32
     static int wlen = 0;
     static WCHAR wbuf[2];
@@ -620,27 +800,19 @@ int tcterm_fprint(int stream, const char* str, int len)
     if(len < 0) len = strlen(str);
     if(!len) return 0;
 
-#ifdef _WIN32
-    wchar_t* wstr = TC__VOID_CAST(wchar_t*,TC_MALLOC((len + 1) * sizeof(wchar_t)));
-
-    int wlen = MultiByteToWideChar(CP_UTF8, 0, str, len, wstr, len + 1);
-
-    if(!wlen)
+    if(tcterm__ctx.buffered)
     {
-        TC_FREE(wstr);
-        return -1;
+        if(stream == TCTERM_STDOUT)
+        {
+            /* we don't know the width of the text, or whether it wraps */
+            tcterm__ctx.curx = tcterm__ctx.cury = -1;
+            return tcterm__buf_append(str, len, TCTERM__OUT_TEXT) ? len : -1;
+        }
+        /* keep the order of output between streams */
+        if(!tcterm_flush())
+            return -1;
     }
-
-    DWORD written;
-    BOOL ok = WriteConsoleW(tcterm__ctx.wh[stream], wstr, wlen, &written, NULL);
-    TC_FREE(wstr);
-    if(!ok) return -1;
-
-    return written;
-#else /* POSIX */
-    /* $$$ TODO: UTF-8 $$$ */
-    return write(tcterm__ctx.fh[stream], str, len);
-#endif
+    return tcterm__write(stream, str, len);
 }
 int tcterm_fprintln(int stream, const char* str, int len)
 {
@@ -707,4 +879,40 @@ int tcterm_printf(const char* format, ...)
     return ret;
 }
 
+int tcterm_set_buffered(int buffered)
+{
+    if(!buffered)
+    {
+        int ok = tcterm_flush();
+        tcterm__ctx.buffered = 0;
+        return ok;
+    }
+    if(tcterm__ctx.buffered)
+        return 1;
+#ifdef _WIN32
+    if(!tcterm__ctx.hasvt)
+    {
+        if(!SetConsoleMode(tcterm__ctx.wh[TCTERM_STDOUT], tcterm__ctx.defomode | ENABLE_VIRTUAL_TERMINAL_PROCESSING))
+            return 0;
+        tcterm__ctx.hasvt = 1;
+    }
+#endif
+    tcterm__ctx.buffered = 1;
+    tcterm__ctx.olen = 0;
+    tcterm__ctx.lastkind = TCTERM__OUT_TEXT;
+    tcterm__ctx.attr = -1;
+    tcterm__ctx.curx = tcterm__ctx.cury = -1;
+    return 1;
+}
+int tcterm_flush(void)
+{
+    int ok = 1;
+    if(tcterm__ctx.olen)
+        ok = tcterm__write(TCTERM_STDOUT, tcterm__ctx.obuf, tcterm__ctx.olen) >= 0;
+    tcterm__ctx.olen = 0;
+    /* whatever was written can't be taken back anymore */
+    tcterm__ctx.lastkind = TCTERM__OUT_TEXT;
+    return ok;
+}
+
 #endif /* TC_TERMINAL_IMPLEMENTATION */
@@ -1,21 +1,30 @@
 /*
  * tc_texture_codec.h: Hardware texture compression (de)compressor.
  *
- * DEPENDS:
- * VERSION: 0.0.1 (2018-01-14)
+ * DEPENDS: tc_thread (optional)
+ * VERSION: 0.1.3 (2026-10-14)
  * LICENSE: CC0 & Boost (dual-licensed)
  * AUTHOR: Tim Cas
  * URL: https://github.com/darkuranium/tclib
  *
  * VERSION HISTORY:
+ * 0.1.3    mipmap chain generation (box, Kaiser & Lanczos; sRGB- and alpha-coverage-aware); see `tctex_generate_mipmaps()`
+ * 0.1.2    table-driven array variants of the sRGB & half-float utilities (the latter with F16C/NEON), `tctex_util_half_from_float()`
+ *          sRGB encoding now rounds to nearest (and round-trips exactly); fixed negative & subnormal halves
+ * 0.1.1    generic `tctex_decompress()`, and multi-threaded `tctex_decompress_parallel*()` via tc_thread (optional)
+ * 0.1.0    BC1, BC3, BC4, BC5 & BC7 compressors, with 3 quality levels; see `tctex_compress_*()`
+ * 0.0.2    SIMD (SSE4.1/AVX2/NEON) row decoders for BC1 to BC5 and BC7; see `tctex_accel_*()`
+ *          fixed BC1 3-color interpolation, BC2 alpha order, signed BC4 mode selection & invalid BC7 blocks
+ *          fixed BC5 green channel source, and out-of-bounds reads in BC1, BC6H & BC7
  * 0.0.1    initial public release (BC1 to BC7)
  *
  * TODOs:
  * - Handle non-multiple-of-block outputs
- * - Tests!
- * - Optimization
+ * - Tests against the reference images
+ * - SIMD BC6H
  * - Compression:
- *      - Everything!
+ *      - BC2 & BC6H
+ *      - Perceptual (weighted) error metrics
  * - Decompression:
  *      - ASTC
  *      - ETC2/EAC/PVRTC/...
@@ -48,7 +57,8 @@
  * Note that some of there merely combine existing formats. Therefore, the "base"
  * formats (those that don't simply combine others) are: BC1, BC4, BC6H, BC7, and Alpha4.
  *
- * Currently, there are no available COMpressors. They are, however, planned.
+ * The following compressors are available, taking the decompressors' output
+ * formats as their input (see COMPRESSION below): BC1, BC3, BC4, BC5, and BC7.
  */
 
 /* ========== API ==========
@@ -95,6 +105,112 @@
  *                `is_signed` still influences whether the *input* data is signed,
  *                the output is always a *signed* half-float.
  *
+ * The format can also be selected at runtime, with the same parameters as above
+ * (`use_select` is always `true`):
+ *
+ *      tctex_decompress(TCTEX_CODEC_BC7, dst, dstride_x, dpitch_y, src, w, h);
+ *
+ *
+ *
+ * ========== MULTI-THREADING ==========
+ *
+ * If `tc_thread.h` has been included before this header, the following are
+ * also available:
+ *
+ *      tctex_decompress_parallel(format, dst, dstride_x, dpitch_y, src, w, h, pool);
+ *      tctex_decompress_parallel_images(format, images, nimages, pool);
+ *
+ * These split each image into bands of block rows (of roughly 64 KiB of
+ * compressed data each, or `TCTEX_PARALLEL_BAND_BYTES` if defined before the
+ * implementation), and decode them concurrently on `pool`; the output is
+ * byte-identical to `tctex_decompress()`. If `pool` is not valid, they simply
+ * run serially.
+ *
+ * `tctex_decompress_parallel_images()` takes an array of `TCTex_DecompressImage`
+ * (the same parameters as the full-image decoders), so that all the mip levels
+ * and array slices of a texture can be decoded at once: large images are split
+ * into bands, while small ones run alongside them. With `tc_texture_load.h`,
+ * these are the results of `tctex_get_mipmaps()` for each of the textures
+ * (`src = tex.memory + mip.offset`, with `mip.size.x` & `mip.size.y`). Note that
+ * the destination must still be at least a whole block in size, even for the
+ * 2x2 and 1x1 mip levels.
+ *
+ *
+ *
+ * ========== COMPRESSION ==========
+ *
+ * The compressors mirror the decompressors, with the source being the image
+ * to encode (in the decompressors' output formats), and the destination being
+ * the consecutive blocks:
+ *
+ *      tctex_compress_bc7(dst, src, sstride_x, spitch_y, w, h, quality);
+ *      tctex_compress_bc7_block(block, src, sstride_x, spitch_y, quality);
+ *
+ * `quality` trades speed for quality:
+ * - `TCTEX_QUALITY_FAST`: BC1/BC3 use a range fit (endpoints at the extremes of
+ *                         the principal axis), BC4/BC5 the min/max, and BC7 only
+ *                         mode 6.
+ * - `TCTEX_QUALITY_NORMAL`: BC1/BC3 add a cluster fit, BC4/BC5 search the endpoints
+ *                           around the min/max, and BC7 adds the most likely
+ *                           2-subset partitions (modes 1 & 3, or 5 & 7 with alpha).
+ * - `TCTEX_QUALITY_SLOW`: BC1/BC3 iterate the cluster fit (and BC1 also tries its
+ *                         3-color mode), BC4/BC5 search a wider window, and BC7
+ *                         tries every mode & rotation (but with only the best few
+ *                         partitions).
+ * Higher quality levels are a superset of the lower ones, so they never give a
+ * larger error. The error metric is plain (unweighted) squared error.
+ *
+ * For BC1, `use_alpha` selects between an RGB8 source (which never uses the
+ * transparent black of 3-color mode, so it's safe to decode with alpha), and
+ * an RGBA8 one where pixels with alpha below 128 become transparent black. BC3 always takes RGBA8, and only uses 4-color mode
+ * for its color block. BC4 & BC5 take R8 & RG8 (SignedR8 & SignedRG8 if
+ * `is_signed`), and BC7 RGBA8.
+ *
+ * The palette search uses SIMD if enabled by `tctex_accel_set()` (the output
+ * is identical either way), but each call runs on a single thread. The blocks
+ * are independent, so a large image can be split into bands of block rows
+ * (offsetting `src` by `4 * spitch_y` and `dst` by one row of blocks per row)
+ * and encoded in parallel; see `demos/tctexenc.c` for an example.
+ *
+ *
+ *
+ * ========== MIPMAP GENERATION ==========
+ *
+ * A full mipmap chain can be generated from a decoded (8 bits per channel)
+ * level 0, for example before compressing it:
+ *
+ *      uint32_t nlevels = tctex_mipmap_count(w, h);
+ *      uint8_t* chain = malloc(tctex_mipmap_chain_size(w, h, 4, nlevels));
+ *      tctex_generate_mipmaps(chain, pixels, w * 4, w, h, 4, nlevels, TCTEX_MIP_FILTER_KAISER, TCTEX_MIP_SRGB, 0.0f);
+ *
+ * The output contains all `nlevels` levels (starting with a copy of level 0)
+ * back-to-back, with tightly-packed rows of `nchan` (1 to 4) channels. Each
+ * level is half the size of the previous one (rounded down, but at least 1), so
+ * this is the layout that `tctex_get_mipmaps()` describes for a texture with a
+ * single array element (any power-of-two texture, or a KTX2 one). The levels
+ * can thus go straight to the compressors, with `sstride_x = nchan` and
+ * `spitch_y = size.x * nchan`. `nlevels` of 0 generates the full chain.
+ *
+ * Each level is filtered from the previous one, in a single pass over its rows.
+ * The filters are:
+ * - `TCTEX_MIP_FILTER_BOX`: averages 2x2 pixels (or 3, for odd sizes)
+ * - `TCTEX_MIP_FILTER_KAISER`: a Kaiser-windowed sinc (width 3, alpha 4); sharper
+ * - `TCTEX_MIP_FILTER_LANCZOS3`: a Lanczos-windowed sinc (width 3); sharpest
+ *
+ * The flags are:
+ * - `TCTEX_MIP_SRGB`: the color channels (all but the 4th) are sRGB-encoded,
+ *   so they are filtered in linear space. Alpha is always linear.
+ * - `TCTEX_MIP_ALPHA_COVERAGE`: for RGBA, the alpha of each level is scaled to
+ *   keep the fraction of pixels that pass an alpha test (`alpha >= alpha_ref`,
+ *   with `alpha_ref` in [0,1]) the same as in level 0, so that alpha-tested
+ *   geometry (foliage, fences) doesn't fade out in the distance.
+ *
+ * Both return `false` only if they cannot allocate the (small) filter tables.
+ * With `tc_thread.h`, there is also a version that spreads the rows of each
+ * level over `pool`, with the same results:
+ *
+ *      tctex_generate_mipmaps_parallel(dst, src, spitch_y, w, h, nchan, nlevels, filter, flags, alpha_ref, pool);
+ *
  *
  *
  * ========== UTILITY ==========
@@ -104,6 +220,7 @@
  * for easier testing.
  *
  *      float tctex_util_float_from_half(uint16_t half);
+ *      uint16_t tctex_util_half_from_float(float f);
  *      float tctex_util_linear_from_srgb(uint8_t srgb);
  *      uint8_t tctex_util_srgb_from_linear(float linear);
  *
@@ -112,12 +229,56 @@
  * the alpha channel should be left in linear space in Linear<->SRGB conversions
  * (simply multiply or divide it by 255.0f instead of passing it through the function).
  *
- * The sRGB conversions use the formulae outlined in ARB_framebuffer_sRGB.
+ * For bulk data, there are also array variants, which convert `n` components:
+ *
+ *      void tctex_util_float_from_half_n(float* dst, const uint16_t* src, size_t n);
+ *      void tctex_util_half_from_float_n(uint16_t* dst, const float* src, size_t n);
+ *      void tctex_util_linear_from_srgb_n(float* dst, const uint8_t* src, size_t n);
+ *      void tctex_util_srgb_from_linear_n(uint8_t* dst, const float* src, size_t n);
+ *
+ * The sRGB conversions use the formulae outlined in ARB_framebuffer_sRGB, via
+ * a table: decoding is a lookup, and encoding searches the (linear) midpoints
+ * between the 256 codes, so it rounds to the nearest code and
+ * `tctex_util_srgb_from_linear(tctex_util_linear_from_srgb(x)) == x` for all
+ * `x`. The half-float conversions are IEEE 754 binary16 (with subnormals, inf
+ * & NaN; rounding to nearest-even), and use F16C or NEON if available (see
+ * below), with the same results.
+ *
+ *
+ *
+ * ========== ACCELERATION ==========
+ *
+ *      unsigned int tctex_accel_get_supported(void);
+ *      unsigned int tctex_accel_get(void);
+ *      unsigned int tctex_accel_set(unsigned int accel);
+ *
+ * The full image decoders for BC1 to BC5 and BC7 have SIMD implementations,
+ * which decode a whole row of blocks at a time; the CPU is queried on first use,
+ * and the fastest available one is picked automatically:
+ * - `TCTEX_ACCEL_X86_SSE41`: SSE4.1 (1 block per iteration)
+ * - `TCTEX_ACCEL_X86_AVX2`: AVX2 (2 blocks per iteration)
+ * - `TCTEX_ACCEL_ARM_NEON`: ARMv8 NEON (1 block per iteration)
+ *
+ * The half-float array utilities use `TCTEX_ACCEL_X86_F16C` (8 components per
+ * iteration) or `TCTEX_ACCEL_ARM_NEON` (4 components per iteration).
+ *
+ * `tctex_accel_get_supported()` returns what both the CPU and the build support,
+ * and `tctex_accel_set()` restricts the set in use (pass `TCTEX_ACCEL_NONE` to
+ * force the scalar code), returning the new set. All of the implementations
+ * produce results identical to the `_block` functions, which remain the
+ * reference; they are fastest when the output is tightly packed (`dstride_x`
+ * equal to the size of a decoded pixel, and alpha requested for BC1), as the
+ * rows are then written directly instead of going through a temporary buffer.
+ * Calling `tctex_accel_set()` while another thread is decoding is undefined.
+ *
+ * Acceleration can be disabled entirely at compile-time by defining
+ * `TCTEX_NO_ACCEL` before including the implementation.
  */
 
 #ifndef TC_TEXTURE_CODEC_H_
 #define TC_TEXTURE_CODEC_H_
 
+#include <stddef.h>
 #include <stdint.h>
 #include <stdbool.h>
 
@@ -145,7 +306,7 @@ void tctex_decompress_bc4_block(void* dst, size_t dstride_x, size_t dpitch_y, co
 void tctex_decompress_bc6h_block(void* dst, size_t dstride_x, size_t dpitch_y, const void* block, bool is_signed);
 void tctex_decompress_bc7_block(void* dst, size_t dstride_x, size_t dpitch_y, const void* block);
 
-void tctex_decompress_bc1(void* dst, size_t dstride_x, size_t dpitch_y, const void* src, size_t w, size_t h, bool is_signed, bool use_alpha);
+void tctex_decompress_bc1(void* dst, size_t dstride_x, size_t dpitch_y, const void* src, size_t w, size_t h, bool use_select, bool use_alpha);
 void tctex_decompress_bc2(void* dst, size_t dstride_x, size_t dpitch_y, const void* src, size_t w, size_t h);
 void tctex_decompress_bc3(void* dst, size_t dstride_x, size_t dpitch_y, const void* src, size_t w, size_t h);
 void tctex_decompress_bc4(void* dst, size_t dstride_x, size_t dpitch_y, const void* src, size_t w, size_t h, bool is_signed);
@@ -153,11 +314,85 @@ void tctex_decompress_bc5(void* dst, size_t dstride_x, size_t dpitch_y, const vo
 void tctex_decompress_bc6h(void* dst, size_t dstride_x, size_t dpitch_y, const void* src, size_t w, size_t h, bool is_signed);
 void tctex_decompress_bc7(void* dst, size_t dstride_x, size_t dpitch_y, const void* src, size_t w, size_t h);
 
+typedef enum TCTex_CodecFormat
+{
+    TCTEX_CODEC_BC1,            // RGB8 (with `use_select`)
+    TCTEX_CODEC_BC1_ALPHA,      // RGBA8 (with `use_select`)
+    TCTEX_CODEC_BC2,
+    TCTEX_CODEC_BC3,
+    TCTEX_CODEC_BC4,
+    TCTEX_CODEC_BC4_SIGNED,
+    TCTEX_CODEC_BC5,
+    TCTEX_CODEC_BC5_SIGNED,
+    TCTEX_CODEC_BC6H,
+    TCTEX_CODEC_BC6H_SIGNED,
+    TCTEX_CODEC_BC7,
+} TCTex_CodecFormat;
+void tctex_decompress(TCTex_CodecFormat format, void* dst, size_t dstride_x, size_t dpitch_y, const void* src, size_t w, size_t h);
+
+#ifdef TC_THREAD_H_
+typedef struct TCTex_DecompressImage
+{
+    void* dst;
+    size_t dstride_x, dpitch_y;
+    const void* src;
+    size_t w, h;
+} TCTex_DecompressImage;
+void tctex_decompress_parallel(TCTex_CodecFormat format, void* dst, size_t dstride_x, size_t dpitch_y, const void* src, size_t w, size_t h, tcthread_pool_t pool);
+void tctex_decompress_parallel_images(TCTex_CodecFormat format, const TCTex_DecompressImage* images, size_t nimages, tcthread_pool_t pool);
+#endif
+
+#define TCTEX_ACCEL_NONE        0x0000u
+#define TCTEX_ACCEL_X86_SSE41   0x0001u
+#define TCTEX_ACCEL_X86_AVX2    0x0002u
+#define TCTEX_ACCEL_X86_F16C    0x0004u
+#define TCTEX_ACCEL_ARM_NEON    0x0100u
+#define TCTEX_ACCEL_ALL         (~0u)
+unsigned int tctex_accel_get_supported(void);
+unsigned int tctex_accel_get(void);
+unsigned int tctex_accel_set(unsigned int accel);
+
+#define TCTEX_QUALITY_FAST      0
+#define TCTEX_QUALITY_NORMAL    1
+#define TCTEX_QUALITY_SLOW      2
+void tctex_compress_bc1_block(void* block, const void* src, size_t sstride_x, size_t spitch_y, int quality, bool use_alpha);
+void tctex_compress_bc3_block(void* block, const void* src, size_t sstride_x, size_t spitch_y, int quality);
+void tctex_compress_bc4_block(void* block, const void* src, size_t sstride_x, size_t spitch_y, int quality, bool is_signed);
+void tctex_compress_bc5_block(void* block, const void* src, size_t sstride_x, size_t spitch_y, int quality, bool is_signed);
+void tctex_compress_bc7_block(void* block, const void* src, size_t sstride_x, size_t spitch_y, int quality);
+
+void tctex_compress_bc1(void* dst, const void* src, size_t sstride_x, size_t spitch_y, size_t w, size_t h, int quality, bool use_alpha);
+void tctex_compress_bc3(void* dst, const void* src, size_t sstride_x, size_t spitch_y, size_t w, size_t h, int quality);
+void tctex_compress_bc4(void* dst, const void* src, size_t sstride_x, size_t spitch_y, size_t w, size_t h, int quality, bool is_signed);
+void tctex_compress_bc5(void* dst, const void* src, size_t sstride_x, size_t spitch_y, size_t w, size_t h, int quality, bool is_signed);
+void tctex_compress_bc7(void* dst, const void* src, size_t sstride_x, size_t spitch_y, size_t w, size_t h, int quality);
+
 // n.b.: may be moved to a different library in the future!
 float tctex_util_float_from_half(uint16_t half);
+uint16_t tctex_util_half_from_float(float f);
 float tctex_util_linear_from_srgb(uint8_t srgb);
 uint8_t tctex_util_srgb_from_linear(float linear);
 
+void tctex_util_float_from_half_n(float* dst, const uint16_t* src, size_t n);
+void tctex_util_half_from_float_n(uint16_t* dst, const float* src, size_t n);
+void tctex_util_linear_from_srgb_n(float* dst, const uint8_t* src, size_t n);
+void tctex_util_srgb_from_linear_n(uint8_t* dst, const float* src, size_t n);
+
+typedef enum TCTex_MipFilter
+{
+    TCTEX_MIP_FILTER_BOX,
+    TCTEX_MIP_FILTER_KAISER,
+    TCTEX_MIP_FILTER_LANCZOS3,
+} TCTex_MipFilter;
+#define TCTEX_MIP_SRGB              0x0001u
+#define TCTEX_MIP_ALPHA_COVERAGE    0x0002u
+uint32_t tctex_mipmap_count(size_t w, size_t h);
+size_t tctex_mipmap_chain_size(size_t w, size_t h, size_t nchan, uint32_t nlevels);
+bool tctex_generate_mipmaps(void* dst, const void* src, size_t spitch_y, size_t w, size_t h, size_t nchan, uint32_t nlevels, TCTex_MipFilter filter, unsigned int flags, float alpha_ref);
+#ifdef TC_THREAD_H_
+bool tctex_generate_mipmaps_parallel(void* dst, const void* src, size_t spitch_y, size_t w, size_t h, size_t nchan, uint32_t nlevels, TCTex_MipFilter filter, unsigned int flags, float alpha_ref, tcthread_pool_t pool);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -168,6 +403,32 @@ uint8_t tctex_util_srgb_from_linear(float linear);
 
 #include <limits.h>
 #include <math.h>
+#include <string.h>
+
+#ifndef TC_MALLOC
+#include <stdlib.h>
+#define TC_MALLOC(size)         malloc(size)
+#endif /* TC_MALLOC */
+#ifndef TC_FREE
+#define TC_FREE(ptr)            free(ptr)
+#endif /* TC_FREE */
+
+#ifndef TC__STATIC_CAST
+#ifdef __cplusplus
+#define TC__STATIC_CAST(T,v) static_cast<T>(v)
+#else
+#define TC__STATIC_CAST(T,v) ((T)(v))
+#endif
+#endif /* TC__STATIC_CAST */
+
+/* no cast done to preserve undefined function warnings in C */
+#ifndef TC__VOID_CAST
+#ifdef __cplusplus
+#define TC__VOID_CAST(T,v)  TC__STATIC_CAST(T,v)
+#else
+#define TC__VOID_CAST(T,v)  (v)
+#endif
+#endif /* TC__VOID_CAST */
 
 #ifndef TCTEX__FROM_LE16
 static uint16_t tctex_i_from_le16(uint16_t x)
@@ -211,6 +472,97 @@ static uint64_t tctex_i_from_le64(uint64_t x)
 #define TCTEX__FROM_LE64(x) tctex_i_from_le64(x)
 #endif*/
 
+/* hardware acceleration; see `tctex_accel_*()` */
+#ifndef TCTEX_NO_ACCEL
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define TCTEX_I_ACCEL_X86
+#define TCTEX_I_TARGET_X86(T) __attribute__((target(T)))
+#include <cpuid.h>
+#include <immintrin.h>
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#define TCTEX_I_ACCEL_X86
+#define TCTEX_I_TARGET_X86(T)
+#include <intrin.h>
+#include <immintrin.h>
+#elif ((defined(__GNUC__) || defined(__clang__)) && defined(__aarch64__)) || (defined(_MSC_VER) && defined(_M_ARM64))
+#define TCTEX_I_ACCEL_ARM
+#include <arm_neon.h>
+#endif
+#endif /* TCTEX_NO_ACCEL */
+
+#define TCTEX_I_ACCEL_UNINIT    0x80000000u
+static unsigned int tctex_i_accel = TCTEX_I_ACCEL_UNINIT;
+
+#ifdef TCTEX_I_ACCEL_X86
+/* regs: {eax,ebx,ecx,edx}; returns 0 if the leaf is not available */
+static int tctex_i_cpuid(uint32_t regs[4], uint32_t leaf, uint32_t subleaf)
+{
+#ifdef _MSC_VER
+    int iregs[4];
+    __cpuid(iregs, leaf & 0x80000000u);
+    if(TC__STATIC_CAST(uint32_t,iregs[0]) < leaf) return 0;
+    __cpuidex(iregs, leaf, subleaf);
+    regs[0] = iregs[0]; regs[1] = iregs[1]; regs[2] = iregs[2]; regs[3] = iregs[3];
+    return 1;
+#else
+    unsigned int a, b, c, d;
+    if(__get_cpuid_max(leaf & 0x80000000u, NULL) < leaf) return 0;
+    __cpuid_count(leaf, subleaf, a, b, c, d);
+    regs[0] = a; regs[1] = b; regs[2] = c; regs[3] = d;
+    return 1;
+#endif
+}
+/* only valid if CPUID.1:ECX[27] (OSXSAVE) is set */
+static uint64_t tctex_i_xgetbv(uint32_t idx)
+{
+#ifdef _MSC_VER
+    return _xgetbv(idx);
+#else
+    uint32_t lo, hi;
+    __asm__ __volatile__("xgetbv" : "=a"(lo), "=d"(hi) : "c"(idx));
+    return (TC__STATIC_CAST(uint64_t,hi) << 32) | lo;
+#endif
+}
+#endif /* TCTEX_I_ACCEL_X86 */
+unsigned int tctex_accel_get_supported(void)
+{
+    unsigned int accel = TCTEX_ACCEL_NONE;
+#if defined(TCTEX_I_ACCEL_X86)
+    uint32_t r1[4], r7[4];
+    if(!tctex_i_cpuid(r1, 1, 0)) return accel;
+    if(!tctex_i_cpuid(r7, 7, 0)) r7[0] = r7[1] = r7[2] = r7[3] = 0;
+
+    /* SSE4.1: CPUID.1:ECX[19] */
+    if(r1[2] & (UINT32_C(1) << 19))
+        accel |= TCTEX_ACCEL_X86_SSE41;
+    /* AVX2 also requires the OS to save the YMM state (XCR0[2:1]) */
+    if((r1[2] & (UINT32_C(1) << 27)) && (r1[2] & (UINT32_C(1) << 28)))
+    {
+        uint64_t xcr0 = tctex_i_xgetbv(0);
+        /* AVX2: CPUID.7.0:EBX[5] */
+        if((xcr0 & 0x06) == 0x06 && (r7[1] & (UINT32_C(1) << 5)))
+            accel |= TCTEX_ACCEL_X86_AVX2;
+        /* F16C: CPUID.1:ECX[29] (VEX-encoded, so it needs the same OS support) */
+        if((xcr0 & 0x06) == 0x06 && (r1[2] & (UINT32_C(1) << 29)))
+            accel |= TCTEX_ACCEL_X86_F16C;
+    }
+#elif defined(TCTEX_I_ACCEL_ARM)
+    /* NEON (AdvSIMD) is mandatory in ARMv8-A */
+    accel |= TCTEX_ACCEL_ARM_NEON;
+#endif
+    return accel;
+}
+unsigned int tctex_accel_get(void)
+{
+    if(tctex_i_accel & TCTEX_I_ACCEL_UNINIT)
+        tctex_i_accel = tctex_accel_get_supported();
+    return tctex_i_accel;
+}
+unsigned int tctex_accel_set(unsigned int accel)
+{
+    return tctex_i_accel = accel & tctex_accel_get_supported() & ~TCTEX_I_ACCEL_UNINIT;
+}
+
 typedef union TCTex_ColorB5G6R5A8
 {
     struct { uint16_t rgb; uint8_t a; } raw;
@@ -239,7 +591,7 @@ static TCTex_ColorB5G6R5A8 tctex_i_b5g6r5a8_interpolate3(TCTex_ColorB5G6R5A8 ca,
 }
 static TCTex_ColorB5G6R5A8 tctex_i_b5g6r5a8_interpolate2(TCTex_ColorB5G6R5A8 ca, TCTex_ColorB5G6R5A8 cb, uint8_t factor)
 {
-    uint8_t factora = 1 - factor;
+    uint8_t factora = 2 - factor;
     uint8_t factorb = factor;
     ca.c.r = (factora * ca.c.r + factorb * cb.c.r) / 2;
     ca.c.g = (factora * ca.c.g + factorb * cb.c.g) / 2;
@@ -306,36 +658,16 @@ static TCTex_ColorB16G16R16 tctex_i_b16g16r16_interpolate64(TCTex_ColorB16G16R16
         ca.array[i] = (factora * ca.array[i] + factorb * cb.array[i] + 32) >> 6;
     return ca;
 }
-
-void tctex_decompress_alpha4_block(void* dst, size_t dstride_x, size_t dpitch_y, const void* block)
-{
-    uint8_t* ddata = TC__VOID_CAST(uint8_t*,dst);
-    const uint8_t* bdata = TC__VOID_CAST(const uint8_t*,block);
-
-    size_t i, x;
-    for(i = 0; i < 8; i++)
-    {
-        uint8_t aselect[2];
-        // alpha4 uses MSB first!
-        aselect[1] = (bdata[8-1-i] >> 0) & 0xF; // ---- %%%%
-        aselect[0] = (bdata[8-1-i] >> 4) & 0xF; // %%%% ----
-        for(x = 0; x < 2; x++)
-            ddata[(i >> 1) * dpitch_y + (2 * (i & 1) + x) * dstride_x] = tctex_i_expandchannel8(aselect[x], 4);
-    }
-}
-void tctex_decompress_bc1_block(void* dst, size_t dstride_x, size_t dpitch_y, const void* block, bool use_select, bool use_alpha)
+/* the 4 colors of a BC1 block; in 3-color mode, the 4th one is transparent black */
+static void tctex_i_bc1_get_palette(TCTex_ColorB8G8R8A8 colors8[4], uint16_t c0, uint16_t c1, bool three_color)
 {
-    uint8_t* ddata = TC__VOID_CAST(uint8_t*,dst);
-    const uint8_t* bdata = TC__VOID_CAST(const uint8_t*,block);
-
     TCTex_ColorB5G6R5A8 colors[4];
-    colors[0].raw.rgb = TCTEX__FROM_LE16(*TC__STATIC_CAST(const uint16_t*,&bdata[0*sizeof(uint16_t)]));
+    colors[0].raw.rgb = c0;
     colors[0].raw.a = 0xFF;
-    colors[1].raw.rgb = TCTEX__FROM_LE16(*TC__STATIC_CAST(const uint16_t*,&bdata[1*sizeof(uint16_t)]));
+    colors[1].raw.rgb = c1;
     colors[1].raw.a = 0xFF;
 
-    //TODO: should use_select be inverted?
-    if(!use_select || colors[0].raw.rgb > colors[1].raw.rgb)
+    if(!three_color)
     {
         colors[2] = tctex_i_b5g6r5a8_interpolate3(colors[0], colors[1], 1);
         colors[3] = tctex_i_b5g6r5a8_interpolate3(colors[0], colors[1], 2);
@@ -347,40 +679,21 @@ void tctex_decompress_bc1_block(void* dst, size_t dstride_x, size_t dpitch_y, co
         colors[3].raw.a = 0x00U; // if use_alpha == false, this is technically 0xFF; but since we don't write to alpha in that case, it doesn't matter!
     }
 
-    TCTex_ColorB8G8R8A8 colors8[sizeof(colors) / sizeof(*colors)];
     size_t i;
     for(i = 0; i < sizeof(colors) / sizeof(*colors); i++)
         colors8[i] = tctex_i_b8g8r8a8_from_b5g6r5a8(colors[i]);
-
-    size_t x, y;
-    for(y = 0; y < 4; y++)
-    {
-        for(x = 0; x < 4; x++)
-        {
-            TCTex_ColorB8G8R8A8 curc = colors8[(bdata[4+y] >> (2*x)) & 0x3];
-
-            uint8_t* dptr = &ddata[y * dpitch_y + x * dstride_x];
-            dptr[0] = curc.c.r;
-            dptr[1] = curc.c.g;
-            dptr[2] = curc.c.b;
-            if(use_alpha) dptr[3] = curc.c.a;
-        }
-    }
 }
-void tctex_decompress_bc4_block(void* dst, size_t dstride, size_t dpitch, const void* block, bool is_signed)
+/* the 8 values of a BC4 block */
+static void tctex_i_bc4_get_palette(uint8_t alpha[8], uint8_t a0, uint8_t a1, bool is_signed)
 {
-    uint8_t* ddata = TC__VOID_CAST(uint8_t*,dst);
-    const uint8_t* bdata = TC__VOID_CAST(const uint8_t*,block);
-
-    uint8_t alpha[8];
-    alpha[0] = bdata[0];
-    alpha[1] = bdata[1];
+    alpha[0] = a0;
+    alpha[1] = a1;
 
     size_t i;
     if(is_signed)
     {
         // n.b.: BC4 is undefined if alpha[0] == -127 && alpha[1] == 128; maybe we should output all-0 in that case?
-        if(alpha[0] > alpha[1])
+        if(TC__STATIC_CAST(int8_t,alpha[0]) > TC__STATIC_CAST(int8_t,alpha[1]))
         {
             for(i = 2; i < 8; i++)
                 alpha[i] = tctex_i_interpolate_sodd(alpha[0], alpha[1], i - 1, 7);
@@ -408,8 +721,62 @@ void tctex_decompress_bc4_block(void* dst, size_t dstride, size_t dpitch, const
             alpha[7] = 0xFFU;
         }
     }
+}
+
+void tctex_decompress_alpha4_block(void* dst, size_t dstride_x, size_t dpitch_y, const void* block)
+{
+    uint8_t* ddata = TC__VOID_CAST(uint8_t*,dst);
+    const uint8_t* bdata = TC__VOID_CAST(const uint8_t*,block);
+
+    size_t i, x;
+    for(i = 0; i < 8; i++)
+    {
+        uint8_t aselect[2];
+        // the first pixel is in the low nibble
+        aselect[0] = (bdata[i] >> 0) & 0xF; // ---- %%%%
+        aselect[1] = (bdata[i] >> 4) & 0xF; // %%%% ----
+        for(x = 0; x < 2; x++)
+            ddata[(i >> 1) * dpitch_y + (2 * (i & 1) + x) * dstride_x] = tctex_i_expandchannel8(aselect[x], 4);
+    }
+}
+void tctex_decompress_bc1_block(void* dst, size_t dstride_x, size_t dpitch_y, const void* block, bool use_select, bool use_alpha)
+{
+    uint8_t* ddata = TC__VOID_CAST(uint8_t*,dst);
+    const uint8_t* bdata = TC__VOID_CAST(const uint8_t*,block);
+
+    uint16_t rawcolors[2];
+    memcpy(rawcolors, bdata, sizeof(rawcolors)); // the block need not be aligned
+    rawcolors[0] = TCTEX__FROM_LE16(rawcolors[0]);
+    rawcolors[1] = TCTEX__FROM_LE16(rawcolors[1]);
+
+    //TODO: should use_select be inverted?
+    TCTex_ColorB8G8R8A8 colors8[4];
+    tctex_i_bc1_get_palette(colors8, rawcolors[0], rawcolors[1], use_select && rawcolors[0] <= rawcolors[1]);
 
     size_t x, y;
+    for(y = 0; y < 4; y++)
+    {
+        for(x = 0; x < 4; x++)
+        {
+            TCTex_ColorB8G8R8A8 curc = colors8[(bdata[4+y] >> (2*x)) & 0x3];
+
+            uint8_t* dptr = &ddata[y * dpitch_y + x * dstride_x];
+            dptr[0] = curc.c.r;
+            dptr[1] = curc.c.g;
+            dptr[2] = curc.c.b;
+            if(use_alpha) dptr[3] = curc.c.a;
+        }
+    }
+}
+void tctex_decompress_bc4_block(void* dst, size_t dstride, size_t dpitch, const void* block, bool is_signed)
+{
+    uint8_t* ddata = TC__VOID_CAST(uint8_t*,dst);
+    const uint8_t* bdata = TC__VOID_CAST(const uint8_t*,block);
+
+    uint8_t alpha[8];
+    tctex_i_bc4_get_palette(alpha, bdata[0], bdata[1], is_signed);
+
+    size_t i, x, y;
     for(i = 0; i < 2; i++)
     {
         uint8_t aselect[2][4];
@@ -427,15 +794,16 @@ void tctex_decompress_bc4_block(void* dst, size_t dstride, size_t dpitch, const
     }
 }
 
-// Yup, it's a mess. I'll fix it someday. Probably.
-// note: NUM <= sizeof(*(ARR) * CHAR_BIT)
-// possible cases (LSB first):
-//      %%%%----
-//      --%%%%--
-//      ------%% | %%------
-#define TCTEX_I_GETBITS(ARR,START,NUM)  (((START)/(sizeof(*(ARR))*CHAR_BIT)) == (((START)+(NUM))/(sizeof(*(ARR))*CHAR_BIT)) /* is it contained in a single element? */\
-                                            ? ((ARR)[(START)/(sizeof(*(ARR))*CHAR_BIT)] & ((1U<<((NUM)+((START)&(sizeof(*(ARR))*CHAR_BIT-1))))-1)) >> ((START)&(sizeof(*(ARR))*CHAR_BIT-1))\
-                                            : ((ARR)[(START)/(sizeof(*(ARR))*CHAR_BIT)] >> ((START)&(sizeof(*(ARR))*CHAR_BIT-1))) /* low part */ | (((ARR)[((START)/(sizeof(*(ARR))*CHAR_BIT))+1] & ((1U<<((NUM)-(sizeof(*(ARR))*CHAR_BIT-((START)&(sizeof(*(ARR))*CHAR_BIT-1)))))-1)) << (sizeof(*(ARR))*CHAR_BIT-((START)&(sizeof(*(ARR))*CHAR_BIT-1)))) /* high part */)
+// reads `NUM` (1 to 24) bits starting at bit `START` (LSB first), only touching the bytes that contain them
+static uint32_t tctex_i_getbits(const uint8_t* arr, uint32_t start, uint32_t num)
+{
+    uint32_t value = 0;
+    uint32_t i;
+    for(i = start / CHAR_BIT; i <= (start + num - 1) / CHAR_BIT; i++)
+        value |= TC__STATIC_CAST(uint32_t,arr[i]) << ((i - start / CHAR_BIT) * CHAR_BIT);
+    return (value >> (start % CHAR_BIT)) & ((UINT32_C(1) << num) - 1U);
+}
+#define TCTEX_I_GETBITS(ARR,START,NUM)  tctex_i_getbits(ARR, START, NUM)
 
 
 static const uint16_t tctex_i_bc6h7_partitions2[] = {
@@ -595,7 +963,7 @@ void tctex_decompress_bc6h_block(void* dst, size_t dstride, size_t dpitch, const
     };
 
     uint8_t* ddata = TC__VOID_CAST(uint8_t*,dst);
-    const uint32_t* bdata = TC__VOID_CAST(const uint32_t*,block);
+    const uint8_t* bdata = TC__VOID_CAST(const uint8_t*,block);
 
     uint8_t x, y;
 
@@ -608,7 +976,7 @@ void tctex_decompress_bc6h_block(void* dst, size_t dstride, size_t dpitch, const
         {
             for(x = 0; x < 4; x++)
             {
-                uint16_t* dptr = TC__STATIC_CAST(uint16_t*,&ddata[y * dpitch + x * dstride]);
+                uint16_t* dptr = TC__VOID_CAST(uint16_t*,TC__STATIC_CAST(void*,&ddata[y * dpitch + x * dstride]));
                 dptr[0] = dptr[1] = dptr[2] = 0;
             }
         }
@@ -982,7 +1350,7 @@ void tctex_decompress_bc6h_block(void* dst, size_t dstride, size_t dpitch, const
             TCTex_ColorB16G16R16 endB = colors[2 * subset_index + 1];
             TCTex_ColorB16G16R16 ccol = tctex_i_bc6h_unquantize_final(tctex_i_b16g16r16_interpolate64(endA, endB, factors[index]), is_signed);
 
-            uint16_t* dptr = TC__STATIC_CAST(uint16_t*,&ddata[y * dpitch + x * dstride]);
+            uint16_t* dptr = TC__VOID_CAST(uint16_t*,TC__STATIC_CAST(void*,&ddata[y * dpitch + x * dstride]));
             dptr[0] = ccol.c.r;
             dptr[1] = ccol.c.g;
             dptr[2] = ccol.c.b;
@@ -1031,38 +1399,38 @@ static void tctex_i_bc7_get_color_data(TCTex_ColorB8G8R8A8* colors, uint8_t ncol
         }
     }
 }
+typedef struct TCTex_BC7_ModeInfo
+{
+    uint8_t NS;     // Number of subsets in each partition
+    uint8_t PB;     // Partition bits
+    uint8_t RB;     // Rotation bits
+    uint8_t ISB;    // Index selection bits
+    uint8_t CB;     // Color bits
+    uint8_t AB;     // Alpha bits
+    uint8_t EPB;    // Endpoint P-bits
+    uint8_t SPB;    // Shared P-bits
+    uint8_t IB;     // Index bits per element
+    uint8_t IB2;    // Secondary index bits per element
+} TCTex_BC7_ModeInfo;
+static const TCTex_BC7_ModeInfo tctex_i_bc7_modeinfos[] = { /* [KHR] Table.M */
+    {3,4,0,0,4,0,1,0,3,0},
+    {2,6,0,0,6,0,0,1,3,0},
+    {3,6,0,0,5,0,0,0,2,0},
+    {2,6,0,0,7,0,1,0,2,0},
+    {1,0,2,1,5,6,0,0,2,3},
+    {1,0,2,0,7,8,0,0,2,2},
+    {1,0,0,0,7,7,1,0,4,0},
+    {2,6,0,0,5,5,1,0,2,0},
+};
 void tctex_decompress_bc7_block(void* dst, size_t dstride, size_t dpitch, const void* block)
 {
-    static const struct TCTex_BC7_ModeInfo
-    {
-        uint8_t NS;     // Number of subsets in each partition
-        uint8_t PB;     // Partition bits
-        uint8_t RB;     // Rotation bits
-        uint8_t ISB;    // Index selection bits
-        uint8_t CB;     // Color bits
-        uint8_t AB;     // Alpha bits
-        uint8_t EPB;    // Endpoint P-bits
-        uint8_t SPB;    // Shared P-bits
-        uint8_t IB;     // Index bits per element
-        uint8_t IB2;    // Secondary index bits per element
-    } ModeInfos[] = { /* [KHR] Table.M */
-        {3,4,0,0,4,0,1,0,3,0},
-        {2,6,0,0,6,0,0,1,3,0},
-        {3,6,0,0,5,0,0,0,2,0},
-        {2,6,0,0,7,0,1,0,2,0},
-        {1,0,2,1,5,6,0,0,2,3},
-        {1,0,2,0,7,8,0,0,2,2},
-        {1,0,0,0,7,7,1,0,4,0},
-        {2,6,0,0,5,5,1,0,2,0},
-    };
-
     uint8_t* ddata = TC__VOID_CAST(uint8_t*,dst);
     const uint8_t* bdata = TC__VOID_CAST(const uint8_t*,block);
 
     uint8_t x, y;
 
     uint8_t mode;
-    for(mode = 0; !(bdata[0] & (1 << mode)); mode++) {}
+    for(mode = 0; mode < 8 && !(bdata[0] & (1 << mode)); mode++) {}
     if(mode == 8) // invalid; [MSDN] asks for 0-filling erroneous decodes, which sounds sensible enough
     {
         for(y = 0; y < 4; y++)
@@ -1071,7 +1439,7 @@ void tctex_decompress_bc7_block(void* dst, size_t dstride, size_t dpitch, const
         return;
     }
 
-    struct TCTex_BC7_ModeInfo minfo = ModeInfos[mode];
+    TCTex_BC7_ModeInfo minfo = tctex_i_bc7_modeinfos[mode];
     uint8_t MPB = minfo.EPB ? minfo.EPB : minfo.SPB;
 
     uint32_t i;
@@ -1148,69 +1516,867 @@ void tctex_decompress_bc7_block(void* dst, size_t dstride, size_t dpitch, const
 }
 
 
-void tctex_decompress_bc1(void* dst, size_t dstride_x, size_t dpitch_y, const void* src, size_t w, size_t h, bool use_select, bool use_alpha)
+/*
+ * SIMD row decoders
+ *
+ * The kernels are written once in terms of the `TCTEX_I_V_*` macros, and then
+ * instantiated for each instruction set. Each 128-bit lane of a vector decodes
+ * a different block and all operations are lane-local, so SSE4.1 & NEON decode
+ * 1 block per iteration and AVX2 decodes 2 (with a leftover block going through
+ * the scalar function).
+ *
+ * A kernel decodes `nblocks` consecutive blocks into 4 rows of `dst` (`dpitch`
+ * apart), with tightly-packed pixels: RGBA8 for BC1 (always with alpha), BC2,
+ * BC3 & BC7, R8 for BC4, and RG8 for BC5. `flag` is `use_select` for BC1, and
+ * `is_signed` for BC4 & BC5.
+ */
+typedef void tctex_i_row_kernel(uint8_t* dst, size_t dpitch, const uint8_t* src, size_t nblocks, bool flag);
+typedef uint32_t tctex_i_fit_rgba_func(uint8_t idx[16], const uint8_t* px, size_t npx, const uint8_t* pal, size_t npal, const uint8_t mask[4]);
+typedef uint32_t tctex_i_fit_r8_func(uint8_t idx[16], const uint8_t v[16], const uint8_t* pal, size_t npal);
+enum
 {
-    uint8_t* ddata = TC__VOID_CAST(uint8_t*,dst);
-    const uint8_t* bdata = TC__VOID_CAST(const uint8_t*,src);
+    TCTEX_I_KERNEL_BC1,
+    TCTEX_I_KERNEL_BC2,
+    TCTEX_I_KERNEL_BC3,
+    TCTEX_I_KERNEL_BC4,
+    TCTEX_I_KERNEL_BC5,
+    TCTEX_I_KERNEL_BC7,
+};
 
-    size_t y;
-    for(y = 0; y < h; y += 4)
-    {
-        size_t x;
-        for(x = 0; x < w; x += 4)
-        {
-            tctex_decompress_bc1_block(&ddata[y * dpitch_y + x * dstride_x], dstride_x, dpitch_y, bdata, use_select, use_alpha);
-            bdata += 8;
-        }
-    }
+#if defined(TCTEX_I_ACCEL_X86) || defined(TCTEX_I_ACCEL_ARM)
+#define TCTEX_I_X4(a,b,c,d)     a,b,c,d,a,b,c,d,a,b,c,d,a,b,c,d
+#define TCTEX_I_PX4(a,b,c,d)    a,b,c,d,4+a,4+b,4+c,4+d,8+a,8+b,8+c,8+d,12+a,12+b,12+c,12+d
+#define TCTEX_I_X2(a,b,c,d)     a,b,c,d,a,b,c,d
+
+// for output row `y`, byte `4*x+c` is the pixel index `4*y+x`
+static const uint8_t tctex_i_v_spread[4][16] = {
+    { 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3},
+    { 4, 4, 4, 4, 5, 5, 5, 5, 6, 6, 6, 6, 7, 7, 7, 7},
+    { 8, 8, 8, 8, 9, 9, 9, 9,10,10,10,10,11,11,11,11},
+    {12,12,12,12,13,13,13,13,14,14,14,14,15,15,15,15},
+};
+static const uint8_t tctex_i_v_chan[16] = { TCTEX_I_X4(0,1,2,3) };
+// OR'd into a shuffle, these zero the alpha (or color) bytes of each pixel
+static const uint8_t tctex_i_v_noalpha[16] = { TCTEX_I_X4(0,0,0,0x80) };
+static const uint8_t tctex_i_v_nocolor[16] = { TCTEX_I_X4(0x80,0x80,0x80,0) };
+static const uint8_t tctex_i_v_rgbmask[16] = { TCTEX_I_X4(0xFF,0xFF,0xFF,0) };
+static const uint8_t tctex_i_v_hi8[16] = { 8,9,10,11,12,13,14,15, 0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80 };
+
+static const uint8_t tctex_i_v_bc1_c01[16] = { 0,1,0,1,0,1,0,1, 2,3,2,3,2,3,2,3 };
+static const uint8_t tctex_i_v_bc1_c0[16] = { TCTEX_I_X4(0,1,0,1) };
+static const uint8_t tctex_i_v_bc1_c1[16] = { TCTEX_I_X4(2,3,2,3) };
+static const uint8_t tctex_i_v_bc1_p0[16] = { 0,1,2,3,4,5,6,7, 0,1,2,3,4,5,6,7 };
+static const uint8_t tctex_i_v_bc1_p1[16] = { 8,9,10,11,12,13,14,15, 8,9,10,11,12,13,14,15 };
+static const uint16_t tctex_i_v_bc1_maskrg[8] = { TCTEX_I_X2(0xF800,0x07E0,0,0) };
+static const uint16_t tctex_i_v_bc1_mulrg[8] = { TCTEX_I_X2(1<<5,1<<11,0,0) };
+static const uint16_t tctex_i_v_bc1_maskb[8] = { TCTEX_I_X2(0,0,0x1F,0) };
+static const uint16_t tctex_i_v_bc1_alpha[8] = { TCTEX_I_X2(0,0,0,0xFF) };
+static const uint16_t tctex_i_v_bc1_wa[8] = { 2,2,2,2, 1,1,1,1 };
+static const uint16_t tctex_i_v_bc1_wb[8] = { 1,1,1,1, 2,2,2,2 };
+static const uint16_t tctex_i_v_bc1_lohalf[8] = { 0xFFFF,0xFFFF,0xFFFF,0xFFFF, 0,0,0,0 };
+// `(c*mul) >> shr` (as a mulhi) expands 5- & 6-bit channels: `(c<<3)|(c>>2)` & `(c<<2)|(c>>4)`
+static const uint16_t tctex_i_v_bc1_x8mul[8] = { TCTEX_I_X2(33,65,33,256) };
+static const uint16_t tctex_i_v_bc1_x8shr[8] = { TCTEX_I_X2(1<<14,1<<12,1<<14,256) };
+static const uint8_t tctex_i_v_bc1_idx[16] = { 4,4,4,4, 5,5,5,5, 6,6,6,6, 7,7,7,7 };
+static const uint8_t tctex_i_v_bc1_idxmask[4][16] = {
+    { TCTEX_I_X4(3,0,0,0) },
+    { TCTEX_I_X4(0,3,0,0) },
+    { TCTEX_I_X4(0,0,3,0) },
+    { TCTEX_I_X4(0,0,0,3) },
+};
+
+// [is_signed]: zero-extended endpoints, or endpoints in the high byte (for an arithmetic shift)
+static const uint8_t tctex_i_v_bc4_a0[2][16] = { { TCTEX_I_X4(0,0x80,0,0x80) }, { TCTEX_I_X4(0x80,0,0x80,0) } };
+static const uint8_t tctex_i_v_bc4_a1[2][16] = { { TCTEX_I_X4(1,0x80,1,0x80) }, { TCTEX_I_X4(0x80,1,0x80,1) } };
+static const uint16_t tctex_i_v_bc4_f7a[8] = { 7,0,6,5,4,3,2,1 };
+static const uint16_t tctex_i_v_bc4_f7b[8] = { 0,7,1,2,3,4,5,6 };
+static const uint16_t tctex_i_v_bc4_f5a[8] = { 5,0,4,3,2,1,0,0 };
+static const uint16_t tctex_i_v_bc4_f5b[8] = { 0,5,1,2,3,4,0,0 };
+static const uint16_t tctex_i_v_bc4_ends[2][8] = { { 0,0,0,0,0,0,0x00,0xFF }, { 0,0,0,0,0,0,0x80,0x7F } };
+// the 16-bit word containing the 3 index bits of each pixel, and the multiplier that moves them to bits 7..9
+static const uint8_t tctex_i_v_bc4_iw[2][16] = {
+    { 2,3, 2,3, 2,3, 3,4, 3,4, 3,4, 4,5, 4,5 },
+    { 5,6, 5,6, 5,6, 6,7, 6,7, 6,7, 7,8, 7,8 },
+};
+static const uint16_t tctex_i_v_bc4_imul[8] = { 1<<7,1<<4,1<<1,1<<6,1<<3,1<<0,1<<5,1<<2 };
+
+static const uint8_t tctex_i_v_a4_dup[16] = { 0,0,1,1,2,2,3,3,4,4,5,5,6,6,7,7 };
+
+// [rotation]: swaps alpha with R, G or B
+static const uint8_t tctex_i_bc7_rotations[4][16] = {
+    { TCTEX_I_PX4(0,1,2,3) },
+    { TCTEX_I_PX4(3,1,2,0) },
+    { TCTEX_I_PX4(0,3,2,1) },
+    { TCTEX_I_PX4(0,1,3,2) },
+};
+
+static uint64_t tctex_i_bc7_bits(const uint64_t bits[2], uint32_t start)
+{
+    if(start >= 64) return bits[1] >> (start - 64);
+    if(!start) return bits[0];
+    return (bits[0] >> start) | (bits[1] << (64 - start));
 }
-void tctex_decompress_bc2(void* dst, size_t dstride_x, size_t dpitch_y, const void* src, size_t w, size_t h)
+#define TCTEX_I_BC7_BITS(BITS,START,NUM)    TC__STATIC_CAST(uint8_t,tctex_i_bc7_bits(BITS, START) & ((1U << (NUM)) - 1U))
+/*
+ * Does the scalar part of a BC7 decode (the same as `tctex_decompress_bc7_block`),
+ * leaving per-pixel lookups for the vector code:
+ * - tabs[0],tabs[1]: first & second endpoint of each subset (RGBA8)
+ * - tabs[2]: `4 * subset` for each pixel
+ * - tabs[3],tabs[4]: color & alpha interpolation weight for each pixel
+ * - tabs[5]: rotation shuffle
+ * Invalid blocks get all-zero tables, which decode to all-zero pixels.
+ */
+static void tctex_i_bc7_prepare(uint8_t tabs[6][16], const uint8_t* bdata)
 {
-    uint8_t* ddata = TC__VOID_CAST(uint8_t*,dst);
-    const uint8_t* bdata = TC__VOID_CAST(const uint8_t*,src);
+    memset(tabs, 0, 6 * 16 * sizeof(uint8_t));
 
-    size_t y;
-    for(y = 0; y < h; y += 4)
+    uint8_t mode;
+    for(mode = 0; mode < 8 && !(bdata[0] & (1 << mode)); mode++) {}
+    if(mode == 8)
+        return;
+
+    uint64_t bits[2];
+    uint32_t i, c;
+    for(i = 0; i < 2; i++)
     {
-        size_t x;
-        for(x = 0; x < w; x += 4)
+        uint32_t w[2];
+        memcpy(w, &bdata[8*i], sizeof(w));
+        bits[i] = TCTEX__FROM_LE32(w[0]) | (TC__STATIC_CAST(uint64_t,TCTEX__FROM_LE32(w[1])) << 32);
+    }
+
+    TCTex_BC7_ModeInfo minfo = tctex_i_bc7_modeinfos[mode];
+    uint8_t MPB = minfo.EPB ? minfo.EPB : minfo.SPB;
+    uint8_t ncolors = 2 * minfo.NS;
+
+    uint32_t offset = mode + 1;
+    uint8_t partition_set_id = TCTEX_I_BC7_BITS(bits, offset, minfo.PB); offset += minfo.PB;
+    uint8_t rotation = TCTEX_I_BC7_BITS(bits, offset, minfo.RB); offset += minfo.RB;
+    uint8_t index_selection = TCTEX_I_BC7_BITS(bits, offset, minfo.ISB); offset += minfo.ISB;
+
+    TCTex_ColorB8G8R8A8 colors[3*2];
+    for(i = 0; i < ncolors; i++)
+    {
+        colors[i].c.r = TCTEX_I_BC7_BITS(bits, offset + (0 * ncolors + i) * minfo.CB, minfo.CB) << MPB;
+        colors[i].c.g = TCTEX_I_BC7_BITS(bits, offset + (1 * ncolors + i) * minfo.CB, minfo.CB) << MPB;
+        colors[i].c.b = TCTEX_I_BC7_BITS(bits, offset + (2 * ncolors + i) * minfo.CB, minfo.CB) << MPB;
+        colors[i].c.a = minfo.AB ? (TCTEX_I_BC7_BITS(bits, offset + 3 * ncolors * minfo.CB + i * minfo.AB, minfo.AB) << MPB) : 0xFF;
+        if(MPB)
         {
-            tctex_decompress_alpha4_block(&ddata[y * dpitch_y + x * dstride_x + 3], dstride_x, dpitch_y, bdata);
-            tctex_decompress_bc1_block(&ddata[y * dpitch_y + x * dstride_x + 0], dstride_x, dpitch_y, bdata + 8, false, false);
-            bdata += 16;
+            uint8_t pdata = TCTEX_I_BC7_BITS(bits, offset + (3 * minfo.CB + minfo.AB) * ncolors + (minfo.SPB ? i / 2 : i) * MPB, MPB);
+            colors[i].c.r |= pdata;
+            colors[i].c.g |= pdata;
+            colors[i].c.b |= pdata;
+            colors[i].c.a |= pdata;
         }
+        colors[i] = tctex_i_b8g8r8a8_expandbits(colors[i], minfo.CB + MPB, minfo.CB + MPB, minfo.CB + MPB, minfo.AB ? minfo.AB + MPB : 8);
     }
-}
-void tctex_decompress_bc3(void* dst, size_t dstride_x, size_t dpitch_y, const void* src, size_t w, size_t h)
-{
-    uint8_t* ddata = TC__VOID_CAST(uint8_t*,dst);
-    const uint8_t* bdata = TC__VOID_CAST(const uint8_t*,src);
-
-    size_t y;
-    for(y = 0; y < h; y += 4)
+    for(i = 0; i < minfo.NS; i++)
     {
-        size_t x;
-        for(x = 0; x < w; x += 4)
+        for(c = 0; c < 2; c++)
         {
-            tctex_decompress_bc4_block(&ddata[y * dpitch_y + x * dstride_x + 3], dstride_x, dpitch_y, bdata, false);
-            tctex_decompress_bc1_block(&ddata[y * dpitch_y + x * dstride_x + 0], dstride_x, dpitch_y, bdata + 8, true, false);
-            bdata += 16;
+            tabs[c][4*i+0] = colors[2*i+c].c.r;
+            tabs[c][4*i+1] = colors[2*i+c].c.g;
+            tabs[c][4*i+2] = colors[2*i+c].c.b;
+            tabs[c][4*i+3] = colors[2*i+c].c.a;
         }
     }
-}
-void tctex_decompress_bc4(void* dst, size_t dstride_x, size_t dpitch_y, const void* src, size_t w, size_t h, bool is_signed)
-{
-    uint8_t* ddata = TC__VOID_CAST(uint8_t*,dst);
-    const uint8_t* bdata = TC__VOID_CAST(const uint8_t*,src);
 
-    size_t y;
-    for(y = 0; y < h; y += 4)
+    uint8_t anchors[3] = {0, 0, 0};
+    if(minfo.NS == 3)
     {
-        size_t x;
-        for(x = 0; x < w; x += 4)
+        anchors[1] = tctex_i_bc7_partitions3_anchors[0][partition_set_id];
+        anchors[2] = tctex_i_bc7_partitions3_anchors[1][partition_set_id];
+    }
+    else if(minfo.NS == 2)
+        anchors[1] = tctex_i_bc6h7_partitions2_anchors[partition_set_id];
+
+    const uint8_t* factors[2];
+    factors[0] = tctex_i_bc6h7_interp_factors[minfo.IB-2];
+    factors[1] = minfo.IB2 ? tctex_i_bc6h7_interp_factors[minfo.IB2-2] : factors[0];
+
+    // all of the indices (or secondary indices) fit into 63 bits
+    uint32_t IBoffset = mode+1 + minfo.PB + minfo.RB + minfo.ISB + minfo.NS*(2*(3*minfo.CB + minfo.AB + minfo.EPB) + minfo.SPB);
+    uint64_t ibits = tctex_i_bc7_bits(bits, IBoffset);
+    uint64_t ibits2 = minfo.IB2 ? tctex_i_bc7_bits(bits, IBoffset + minfo.NS*(16*minfo.IB-1)) : 0;
+    for(i = 0; i < 16; i++)
+    {
+        uint8_t subset_index;
+        if(minfo.NS == 3)
+            subset_index = (tctex_i_bc7_partitions3[partition_set_id] >> (2*i)) & 3;
+        else if(minfo.NS == 2)
+            subset_index = (tctex_i_bc6h7_partitions2[partition_set_id] >> i) & 1;
+        else
+            subset_index = 0;
+        bool is_anchor = anchors[subset_index] == i;
+
+        uint8_t index[2];
+        uint8_t num = minfo.IB - is_anchor;
+        index[0] = ibits & ((1U << num) - 1U);
+        ibits >>= num;
+        if(minfo.IB2)
         {
-            tctex_decompress_bc4_block(&ddata[y * dpitch_y + x * dstride_x], dstride_x, dpitch_y, bdata, is_signed);
-            bdata += 8;
+            num = minfo.IB2 - is_anchor;
+            index[1] = ibits2 & ((1U << num) - 1U);
+            ibits2 >>= num;
+        }
+        else
+            index[1] = index[0];
+
+        tabs[2][i] = 4 * subset_index;
+        tabs[3][i] = factors[index_selection][index[index_selection]];
+        tabs[4][i] = factors[!index_selection][index[!index_selection]];
+    }
+    memcpy(tabs[5], tctex_i_bc7_rotations[rotation], 16 * sizeof(uint8_t));
+}
+
+#define TCTEX_I_V_BC1_BODY(OUT,BLK,SEL)                                        \
+    do {                                                                       \
+        /* 16-bit lanes of {c0,c1}: {r0,g0,b0,a0, r1,g1,b1,a1}, still in 5:6:5 */\
+        TCTEX_I_V c01_ = TCTEX_I_V_SHUF8(BLK, TCTEX_I_V_CONST(tctex_i_v_bc1_c01));\
+        TCTEX_I_V lo_ = TCTEX_I_V_MULHI16(TCTEX_I_V_AND(c01_, TCTEX_I_V_CONST(tctex_i_v_bc1_maskrg)), TCTEX_I_V_CONST(tctex_i_v_bc1_mulrg));\
+        lo_ = TCTEX_I_V_OR(TCTEX_I_V_OR(lo_, TCTEX_I_V_AND(c01_, TCTEX_I_V_CONST(tctex_i_v_bc1_maskb))), TCTEX_I_V_CONST(tctex_i_v_bc1_alpha));\
+        TCTEX_I_V ca_ = TCTEX_I_V_SHUF8(lo_, TCTEX_I_V_CONST(tctex_i_v_bc1_p0));\
+        TCTEX_I_V cb_ = TCTEX_I_V_SHUF8(lo_, TCTEX_I_V_CONST(tctex_i_v_bc1_p1));\
+        /* {c2,c3}: {(2*c0+c1+1)/3, (c0+2*c1+1)/3} or {(c0+c1)/2, 0}; x/3 == (x*21846)>>16 in this range */\
+        TCTEX_I_V hi4_ = TCTEX_I_V_ADD16(TCTEX_I_V_MULLO16(ca_, TCTEX_I_V_CONST(tctex_i_v_bc1_wa)), TCTEX_I_V_MULLO16(cb_, TCTEX_I_V_CONST(tctex_i_v_bc1_wb)));\
+        hi4_ = TCTEX_I_V_MULHI16(TCTEX_I_V_ADD16(hi4_, TCTEX_I_V_SET16(1)), TCTEX_I_V_SET16(21846));\
+        TCTEX_I_V hi3_ = TCTEX_I_V_AND(TCTEX_I_V_SRLI16(TCTEX_I_V_ADD16(ca_, cb_), 1), TCTEX_I_V_CONST(tctex_i_v_bc1_lohalf));\
+        TCTEX_I_V le_ = TCTEX_I_V_CMPLE_U16(TCTEX_I_V_SHUF8(BLK, TCTEX_I_V_CONST(tctex_i_v_bc1_c0)), TCTEX_I_V_SHUF8(BLK, TCTEX_I_V_CONST(tctex_i_v_bc1_c1)));\
+        TCTEX_I_V hi_ = TCTEX_I_V_SELECT(TCTEX_I_V_AND(le_, SEL), hi3_, hi4_); \
+        /* expand to 8 bits, giving the RGBA8 palette */                       \
+        TCTEX_I_V x8mul_ = TCTEX_I_V_CONST(tctex_i_v_bc1_x8mul), x8shr_ = TCTEX_I_V_CONST(tctex_i_v_bc1_x8shr);\
+        TCTEX_I_V pal_ = TCTEX_I_V_PACKLO16(TCTEX_I_V_MULHI16(TCTEX_I_V_MULLO16(lo_, x8mul_), x8shr_), TCTEX_I_V_MULHI16(TCTEX_I_V_MULLO16(hi_, x8mul_), x8shr_));\
+        /* one byte per pixel of `4 * index` */                                \
+        TCTEX_I_V idx_ = TCTEX_I_V_SHUF8(BLK, TCTEX_I_V_CONST(tctex_i_v_bc1_idx));\
+        idx_ = TCTEX_I_V_OR(TCTEX_I_V_OR(TCTEX_I_V_AND(idx_, TCTEX_I_V_CONST(tctex_i_v_bc1_idxmask[0])), TCTEX_I_V_AND(TCTEX_I_V_SRLI16(idx_, 2), TCTEX_I_V_CONST(tctex_i_v_bc1_idxmask[1]))),\
+                            TCTEX_I_V_OR(TCTEX_I_V_AND(TCTEX_I_V_SRLI16(idx_, 4), TCTEX_I_V_CONST(tctex_i_v_bc1_idxmask[2])), TCTEX_I_V_AND(TCTEX_I_V_SRLI16(idx_, 6), TCTEX_I_V_CONST(tctex_i_v_bc1_idxmask[3]))));\
+        idx_ = TCTEX_I_V_SLLI16(idx_, 2);                                      \
+        for(y_ = 0; y_ < 4; y_++)                                              \
+            (OUT)[y_] = TCTEX_I_V_SHUF8(pal_, TCTEX_I_V_OR(TCTEX_I_V_SHUF8(idx_, TCTEX_I_V_CONST(tctex_i_v_spread[y_])), TCTEX_I_V_CONST(tctex_i_v_chan)));\
+    } while(0)
+#define TCTEX_I_V_BC4_BODY(OUT,BLK,SIGNED)                                     \
+    do {                                                                       \
+        TCTEX_I_V a0_ = TCTEX_I_V_SHUF8(BLK, TCTEX_I_V_CONST(tctex_i_v_bc4_a0[SIGNED]));\
+        TCTEX_I_V a1_ = TCTEX_I_V_SHUF8(BLK, TCTEX_I_V_CONST(tctex_i_v_bc4_a1[SIGNED]));\
+        if(SIGNED)                                                             \
+        {                                                                      \
+            a0_ = TCTEX_I_V_SRAI16(a0_, 8);                                    \
+            a1_ = TCTEX_I_V_SRAI16(a1_, 8);                                    \
+        }                                                                      \
+        /* numerators of the 8- & 6-value palettes; x/7 == (x*9363)>>16 & x/5 == (x*13108)>>16 in this range */\
+        TCTEX_I_V n7_ = TCTEX_I_V_ADD16(TCTEX_I_V_MULLO16(a0_, TCTEX_I_V_CONST(tctex_i_v_bc4_f7a)), TCTEX_I_V_MULLO16(a1_, TCTEX_I_V_CONST(tctex_i_v_bc4_f7b)));\
+        TCTEX_I_V n5_ = TCTEX_I_V_ADD16(TCTEX_I_V_MULLO16(a0_, TCTEX_I_V_CONST(tctex_i_v_bc4_f5a)), TCTEX_I_V_MULLO16(a1_, TCTEX_I_V_CONST(tctex_i_v_bc4_f5b)));\
+        TCTEX_I_V pal_;                                                        \
+        if(SIGNED)                                                             \
+        {                                                                      \
+            /* division truncates towards zero */                              \
+            TCTEX_I_V s7_ = TCTEX_I_V_SRAI16(n7_, 15), s5_ = TCTEX_I_V_SRAI16(n5_, 15);\
+            TCTEX_I_V p7_ = TCTEX_I_V_SUB16(TCTEX_I_V_XOR(TCTEX_I_V_MULHI16(TCTEX_I_V_ABS16(n7_), TCTEX_I_V_SET16(9363)), s7_), s7_);\
+            TCTEX_I_V p5_ = TCTEX_I_V_SUB16(TCTEX_I_V_XOR(TCTEX_I_V_MULHI16(TCTEX_I_V_ABS16(n5_), TCTEX_I_V_SET16(13108)), s5_), s5_);\
+            p5_ = TCTEX_I_V_OR(p5_, TCTEX_I_V_CONST(tctex_i_v_bc4_ends[1]));   \
+            pal_ = TCTEX_I_V_AND(TCTEX_I_V_SELECT(TCTEX_I_V_CMPGT_S16(a0_, a1_), p7_, p5_), TCTEX_I_V_SET16(0xFF));\
+        }                                                                      \
+        else                                                                   \
+        {                                                                      \
+            TCTEX_I_V p7_ = TCTEX_I_V_MULHI16(n7_, TCTEX_I_V_SET16(9363));     \
+            TCTEX_I_V p5_ = TCTEX_I_V_OR(TCTEX_I_V_MULHI16(n5_, TCTEX_I_V_SET16(13108)), TCTEX_I_V_CONST(tctex_i_v_bc4_ends[0]));\
+            pal_ = TCTEX_I_V_SELECT(TCTEX_I_V_CMPLE_U16(a0_, a1_), p5_, p7_);  \
+        }                                                                      \
+        pal_ = TCTEX_I_V_PACKLO16(pal_, pal_);                                 \
+        /* one byte per pixel of the index */                                  \
+        TCTEX_I_V i0_ = TCTEX_I_V_MULLO16(TCTEX_I_V_SHUF8(BLK, TCTEX_I_V_CONST(tctex_i_v_bc4_iw[0])), TCTEX_I_V_CONST(tctex_i_v_bc4_imul));\
+        TCTEX_I_V i1_ = TCTEX_I_V_MULLO16(TCTEX_I_V_SHUF8(BLK, TCTEX_I_V_CONST(tctex_i_v_bc4_iw[1])), TCTEX_I_V_CONST(tctex_i_v_bc4_imul));\
+        i0_ = TCTEX_I_V_AND(TCTEX_I_V_SRLI16(i0_, 7), TCTEX_I_V_SET16(7));     \
+        i1_ = TCTEX_I_V_AND(TCTEX_I_V_SRLI16(i1_, 7), TCTEX_I_V_SET16(7));     \
+        (OUT) = TCTEX_I_V_SHUF8(pal_, TCTEX_I_V_PACKLO16(i0_, i1_));           \
+    } while(0)
+#define TCTEX_I_V_ALPHA4_BODY(OUT,BLK)                                         \
+    do {                                                                       \
+        TCTEX_I_V d_ = TCTEX_I_V_SHUF8(BLK, TCTEX_I_V_CONST(tctex_i_v_a4_dup));\
+        d_ = TCTEX_I_V_OR(TCTEX_I_V_AND(d_, TCTEX_I_V_SET16(0x000F)), TCTEX_I_V_AND(TCTEX_I_V_SRLI16(d_, 4), TCTEX_I_V_SET16(0x0F00)));\
+        (OUT) = TCTEX_I_V_MULLO16(d_, TCTEX_I_V_SET16(17));                    \
+    } while(0)
+#define TCTEX_I_V_BC7_INTERP(A,B,W)                                            \
+    TCTEX_I_V_SRLI16(TCTEX_I_V_ADD16(TCTEX_I_V_ADD16(TCTEX_I_V_MULLO16(TCTEX_I_V_SUB16(TCTEX_I_V_SET16(64), W), A), TCTEX_I_V_MULLO16(W, B)), TCTEX_I_V_SET16(32)), 6)
+#define TCTEX_I_V_BC7_BODY(OUT,TABS,TSTRIDE)                                   \
+    do {                                                                       \
+        TCTEX_I_V ea_ = TCTEX_I_V_LOAD((TABS)[0], TSTRIDE), eb_ = TCTEX_I_V_LOAD((TABS)[1], TSTRIDE);\
+        TCTEX_I_V sub_ = TCTEX_I_V_LOAD((TABS)[2], TSTRIDE);                   \
+        TCTEX_I_V wc_ = TCTEX_I_V_LOAD((TABS)[3], TSTRIDE), wa_ = TCTEX_I_V_LOAD((TABS)[4], TSTRIDE);\
+        TCTEX_I_V rot_ = TCTEX_I_V_LOAD((TABS)[5], TSTRIDE);                   \
+        for(y_ = 0; y_ < 4; y_++)                                              \
+        {                                                                      \
+            TCTEX_I_V sp_ = TCTEX_I_V_CONST(tctex_i_v_spread[y_]);             \
+            TCTEX_I_V ctl_ = TCTEX_I_V_OR(TCTEX_I_V_SHUF8(sub_, sp_), TCTEX_I_V_CONST(tctex_i_v_chan));\
+            TCTEX_I_V a_ = TCTEX_I_V_SHUF8(ea_, ctl_), b_ = TCTEX_I_V_SHUF8(eb_, ctl_);\
+            TCTEX_I_V w_ = TCTEX_I_V_OR(TCTEX_I_V_SHUF8(wc_, TCTEX_I_V_OR(sp_, TCTEX_I_V_CONST(tctex_i_v_noalpha))), TCTEX_I_V_SHUF8(wa_, TCTEX_I_V_OR(sp_, TCTEX_I_V_CONST(tctex_i_v_nocolor))));\
+            TCTEX_I_V lo_ = TCTEX_I_V_BC7_INTERP(TCTEX_I_V_UNPACKLO8(a_), TCTEX_I_V_UNPACKLO8(b_), TCTEX_I_V_UNPACKLO8(w_));\
+            TCTEX_I_V hi_ = TCTEX_I_V_BC7_INTERP(TCTEX_I_V_UNPACKHI8(a_), TCTEX_I_V_UNPACKHI8(b_), TCTEX_I_V_UNPACKHI8(w_));\
+            (OUT)[y_] = TCTEX_I_V_SHUF8(TCTEX_I_V_PACKLO16(lo_, hi_), rot_);   \
+        }                                                                      \
+    } while(0)
+
+#define TCTEX_I_V_KERNELS_DEF(ISA,NL)                                          \
+TCTEX_I_V_TARGET static void tctex_i_bc1_rows_##ISA(uint8_t* dst, size_t dpitch, const uint8_t* src, size_t nblocks, bool use_select)\
+{                                                                              \
+    TCTEX_I_V sel = TCTEX_I_V_SET16(use_select ? 0xFFFF : 0);                  \
+    TCTEX_I_V out[4];                                                          \
+    size_t b, y_;                                                              \
+    for(b = 0; b + (NL) <= nblocks; b += (NL))                                 \
+    {                                                                          \
+        TCTEX_I_V blk = TCTEX_I_V_LOADL(&src[b * 8], 8);                       \
+        TCTEX_I_V_BC1_BODY(out, blk, sel);                                     \
+        for(y_ = 0; y_ < 4; y_++)                                              \
+            TCTEX_I_V_STORE(&dst[y_ * dpitch + b * 16], out[y_]);              \
+    }                                                                          \
+    for(; b < nblocks; b++)                                                    \
+        tctex_decompress_bc1_block(&dst[b * 16], 4, dpitch, &src[b * 8], use_select, true);\
+}                                                                              \
+TCTEX_I_V_TARGET static void tctex_i_bc2_rows_##ISA(uint8_t* dst, size_t dpitch, const uint8_t* src, size_t nblocks, bool flag)\
+{                                                                              \
+    TCTEX_I_V out[4], alpha;                                                   \
+    size_t b, y_;                                                              \
+    (void)flag;                                                                \
+    for(b = 0; b + (NL) <= nblocks; b += (NL))                                 \
+    {                                                                          \
+        TCTEX_I_V blk = TCTEX_I_V_LOAD(&src[b * 16], 16);                      \
+        TCTEX_I_V_ALPHA4_BODY(alpha, blk);                                     \
+        TCTEX_I_V_BC1_BODY(out, TCTEX_I_V_SHUF8(blk, TCTEX_I_V_CONST(tctex_i_v_hi8)), TCTEX_I_V_SET16(0));\
+        for(y_ = 0; y_ < 4; y_++)                                              \
+        {                                                                      \
+            TCTEX_I_V a = TCTEX_I_V_SHUF8(alpha, TCTEX_I_V_OR(TCTEX_I_V_CONST(tctex_i_v_spread[y_]), TCTEX_I_V_CONST(tctex_i_v_nocolor)));\
+            TCTEX_I_V_STORE(&dst[y_ * dpitch + b * 16], TCTEX_I_V_OR(TCTEX_I_V_AND(out[y_], TCTEX_I_V_CONST(tctex_i_v_rgbmask)), a));\
+        }                                                                      \
+    }                                                                          \
+    for(; b < nblocks; b++)                                                    \
+    {                                                                          \
+        tctex_decompress_alpha4_block(&dst[b * 16 + 3], 4, dpitch, &src[b * 16]);\
+        tctex_decompress_bc1_block(&dst[b * 16 + 0], 4, dpitch, &src[b * 16 + 8], false, false);\
+    }                                                                          \
+}                                                                              \
+TCTEX_I_V_TARGET static void tctex_i_bc3_rows_##ISA(uint8_t* dst, size_t dpitch, const uint8_t* src, size_t nblocks, bool flag)\
+{                                                                              \
+    TCTEX_I_V out[4], alpha;                                                   \
+    size_t b, y_;                                                              \
+    (void)flag;                                                                \
+    for(b = 0; b + (NL) <= nblocks; b += (NL))                                 \
+    {                                                                          \
+        TCTEX_I_V blk = TCTEX_I_V_LOAD(&src[b * 16], 16);                      \
+        TCTEX_I_V_BC4_BODY(alpha, blk, 0);                                     \
+        TCTEX_I_V_BC1_BODY(out, TCTEX_I_V_SHUF8(blk, TCTEX_I_V_CONST(tctex_i_v_hi8)), TCTEX_I_V_SET16(0xFFFF));\
+        for(y_ = 0; y_ < 4; y_++)                                              \
+        {                                                                      \
+            TCTEX_I_V a = TCTEX_I_V_SHUF8(alpha, TCTEX_I_V_OR(TCTEX_I_V_CONST(tctex_i_v_spread[y_]), TCTEX_I_V_CONST(tctex_i_v_nocolor)));\
+            TCTEX_I_V_STORE(&dst[y_ * dpitch + b * 16], TCTEX_I_V_OR(TCTEX_I_V_AND(out[y_], TCTEX_I_V_CONST(tctex_i_v_rgbmask)), a));\
+        }                                                                      \
+    }                                                                          \
+    for(; b < nblocks; b++)                                                    \
+    {                                                                          \
+        tctex_decompress_bc4_block(&dst[b * 16 + 3], 4, dpitch, &src[b * 16], false);\
+        tctex_decompress_bc1_block(&dst[b * 16 + 0], 4, dpitch, &src[b * 16 + 8], true, false);\
+    }                                                                          \
+}                                                                              \
+TCTEX_I_V_TARGET static void tctex_i_bc4_rows_##ISA(uint8_t* dst, size_t dpitch, const uint8_t* src, size_t nblocks, bool is_signed)\
+{                                                                              \
+    uint8_t tmp[(NL) * 16];                                                    \
+    size_t b, y_, l;                                                           \
+    for(b = 0; b + (NL) <= nblocks; b += (NL))                                 \
+    {                                                                          \
+        TCTEX_I_V out;                                                         \
+        TCTEX_I_V_BC4_BODY(out, TCTEX_I_V_LOADL(&src[b * 8], 8), is_signed);   \
+        TCTEX_I_V_STORE(tmp, out);                                             \
+        for(l = 0; l < (NL); l++)                                              \
+            for(y_ = 0; y_ < 4; y_++)                                          \
+                memcpy(&dst[y_ * dpitch + (b + l) * 4], &tmp[l * 16 + y_ * 4], 4);\
+    }                                                                          \
+    for(; b < nblocks; b++)                                                    \
+        tctex_decompress_bc4_block(&dst[b * 4], 1, dpitch, &src[b * 8], is_signed);\
+}                                                                              \
+TCTEX_I_V_TARGET static void tctex_i_bc5_rows_##ISA(uint8_t* dst, size_t dpitch, const uint8_t* src, size_t nblocks, bool is_signed)\
+{                                                                              \
+    uint8_t tmp[2][(NL) * 16];                                                 \
+    size_t b, y_, l;                                                           \
+    for(b = 0; b + (NL) <= nblocks; b += (NL))                                 \
+    {                                                                          \
+        TCTEX_I_V blk = TCTEX_I_V_LOAD(&src[b * 16], 16);                      \
+        TCTEX_I_V r, g;                                                        \
+        TCTEX_I_V_BC4_BODY(r, blk, is_signed);                                 \
+        TCTEX_I_V_BC4_BODY(g, TCTEX_I_V_SHUF8(blk, TCTEX_I_V_CONST(tctex_i_v_hi8)), is_signed);\
+        /* interleave into RG8; rows 0 & 1 go into `tmp[0]`, 2 & 3 into `tmp[1]` */\
+        TCTEX_I_V_STORE(tmp[0], TCTEX_I_V_OR(TCTEX_I_V_UNPACKLO8(r), TCTEX_I_V_SLLI16(TCTEX_I_V_UNPACKLO8(g), 8)));\
+        TCTEX_I_V_STORE(tmp[1], TCTEX_I_V_OR(TCTEX_I_V_UNPACKHI8(r), TCTEX_I_V_SLLI16(TCTEX_I_V_UNPACKHI8(g), 8)));\
+        for(l = 0; l < (NL); l++)                                              \
+            for(y_ = 0; y_ < 4; y_++)                                          \
+                memcpy(&dst[y_ * dpitch + (b + l) * 8], &tmp[y_ >> 1][l * 16 + (y_ & 1) * 8], 8);\
+    }                                                                          \
+    for(; b < nblocks; b++)                                                    \
+    {                                                                          \
+        tctex_decompress_bc4_block(&dst[b * 8 + 0], 2, dpitch, &src[b * 16], is_signed);\
+        tctex_decompress_bc4_block(&dst[b * 8 + 1], 2, dpitch, &src[b * 16 + 8], is_signed);\
+    }                                                                          \
+}                                                                              \
+TCTEX_I_V_TARGET static void tctex_i_bc7_rows_##ISA(uint8_t* dst, size_t dpitch, const uint8_t* src, size_t nblocks, bool flag)\
+{                                                                              \
+    uint8_t tabs[NL][6][16];                                                   \
+    TCTEX_I_V out[4];                                                          \
+    size_t b, y_, l;                                                           \
+    (void)flag;                                                                \
+    for(b = 0; b + (NL) <= nblocks; b += (NL))                                 \
+    {                                                                          \
+        for(l = 0; l < (NL); l++)                                              \
+            tctex_i_bc7_prepare(tabs[l], &src[(b + l) * 16]);                  \
+        TCTEX_I_V_BC7_BODY(out, tabs[0], sizeof(tabs[0]));                     \
+        for(y_ = 0; y_ < 4; y_++)                                              \
+            TCTEX_I_V_STORE(&dst[y_ * dpitch + b * 16], out[y_]);              \
+    }                                                                          \
+    for(; b < nblocks; b++)                                                    \
+        tctex_decompress_bc7_block(&dst[b * 16], 4, dpitch, &src[b * 16]);     \
+}                                                                              \
+static tctex_i_row_kernel* const tctex_i_kernels_##ISA[] = {                   \
+    tctex_i_bc1_rows_##ISA,                                                    \
+    tctex_i_bc2_rows_##ISA,                                                    \
+    tctex_i_bc3_rows_##ISA,                                                    \
+    tctex_i_bc4_rows_##ISA,                                                    \
+    tctex_i_bc5_rows_##ISA,                                                    \
+    tctex_i_bc7_rows_##ISA,                                                    \
+};
+
+/*
+ * Encoder helpers: these find the nearest palette entry for each of the 16
+ * pixels of a block (in the order of `tctex_i_fit_rgba_ref()` and
+ * `tctex_i_fit_r8_ref()`), working on a single block at a time.
+ */
+#define TCTEX_I_V_FITS_DEF(ISA)                                                \
+TCTEX_I_V_TARGET static uint32_t tctex_i_fit_rgba_##ISA(uint8_t idx[16], const uint8_t* px, size_t npx, const uint8_t* pal, size_t npal, const uint8_t mask[4])\
+{                                                                              \
+    uint32_t m32, c32, err[16], eidx[16], total = 0;                           \
+    TCTEX_I_V p[4], e[4], ei[4];                                               \
+    size_t q, k;                                                               \
+    memcpy(&m32, mask, sizeof(m32));                                           \
+    TCTEX_I_V m = TCTEX_I_V_SET32(m32);                                        \
+    for(q = 0; q < 4; q++)                                                     \
+    {                                                                          \
+        p[q] = TCTEX_I_V_AND(TCTEX_I_V_LOAD(&px[16 * q], 0), m);               \
+        e[q] = TCTEX_I_V_SET32(0x7FFFFFFF);                                    \
+        ei[q] = TCTEX_I_V_SET32(0);                                            \
+    }                                                                          \
+    for(k = 0; k < npal; k++)                                                  \
+    {                                                                          \
+        memcpy(&c32, &pal[4 * k], sizeof(c32));                                \
+        TCTEX_I_V c = TCTEX_I_V_UNPACKLO8(TCTEX_I_V_AND(TCTEX_I_V_SET32(c32), m));\
+        TCTEX_I_V kv = TCTEX_I_V_SET32(k);                                     \
+        for(q = 0; q < 4; q++)                                                 \
+        {                                                                      \
+            /* squared distance of 4 pixels, in 32-bit lanes */                \
+            TCTEX_I_V dl = TCTEX_I_V_SUB16(TCTEX_I_V_UNPACKLO8(p[q]), c), dh = TCTEX_I_V_SUB16(TCTEX_I_V_UNPACKHI8(p[q]), c);\
+            TCTEX_I_V d = TCTEX_I_V_HADD32(TCTEX_I_V_MADD16(dl, dl), TCTEX_I_V_MADD16(dh, dh));\
+            TCTEX_I_V lt = TCTEX_I_V_CMPGT_S32(e[q], d);                       \
+            e[q] = TCTEX_I_V_SELECT(lt, d, e[q]);                              \
+            ei[q] = TCTEX_I_V_SELECT(lt, kv, ei[q]);                           \
+        }                                                                      \
+    }                                                                          \
+    for(q = 0; q < 4; q++)                                                     \
+    {                                                                          \
+        TCTEX_I_V_STORE(&err[4 * q], e[q]);                                    \
+        TCTEX_I_V_STORE(&eidx[4 * q], ei[q]);                                  \
+    }                                                                          \
+    for(q = 0; q < 16; q++)                                                    \
+        idx[q] = TC__STATIC_CAST(uint8_t,eidx[q]);                             \
+    for(q = 0; q < npx; q++)                                                   \
+        total += err[q];                                                       \
+    return total;                                                              \
+}                                                                              \
+TCTEX_I_V_TARGET static uint32_t tctex_i_fit_r8_##ISA(uint8_t idx[16], const uint8_t v[16], const uint8_t* pal, size_t npal)\
+{                                                                              \
+    uint8_t err[16];                                                           \
+    uint32_t total = 0;                                                        \
+    size_t k;                                                                  \
+    TCTEX_I_V x = TCTEX_I_V_LOAD(v, 0), ones = TCTEX_I_V_SET8(0xFF);           \
+    TCTEX_I_V e = ones, ei = TCTEX_I_V_SET8(0);                                \
+    for(k = 0; k < npal; k++)                                                  \
+    {                                                                          \
+        TCTEX_I_V c = TCTEX_I_V_SET8(pal[k]);                                  \
+        TCTEX_I_V d = TCTEX_I_V_OR(TCTEX_I_V_SUBS_U8(x, c), TCTEX_I_V_SUBS_U8(c, x));\
+        TCTEX_I_V emin = TCTEX_I_V_MIN_U8(e, d);                               \
+        TCTEX_I_V lt = TCTEX_I_V_XOR(TCTEX_I_V_CMPEQ8(emin, e), ones);         \
+        e = emin;                                                              \
+        ei = TCTEX_I_V_SELECT(lt, TCTEX_I_V_SET8(k), ei);                      \
+    }                                                                          \
+    TCTEX_I_V_STORE(err, e);                                                   \
+    TCTEX_I_V_STORE(idx, ei);                                                  \
+    for(k = 0; k < 16; k++)                                                    \
+        total += err[k] * err[k];                                              \
+    return total;                                                              \
+}
+
+
+#if defined(TCTEX_I_ACCEL_X86)
+/* SSE4.1: 1 block per iteration */
+#define TCTEX_I_V_TARGET            TCTEX_I_TARGET_X86("sse4.1")
+#define TCTEX_I_V                   __m128i
+#define TCTEX_I_V_LOAD(p,stride)    _mm_loadu_si128((const __m128i*)(p))
+#define TCTEX_I_V_LOADL(p,stride)   _mm_loadl_epi64((const __m128i*)(p))
+#define TCTEX_I_V_STORE(p,x)        _mm_storeu_si128((__m128i*)(p), x)
+#define TCTEX_I_V_CONST(p)          _mm_loadu_si128((const __m128i*)(p))
+#define TCTEX_I_V_SET16(c)          _mm_set1_epi16(TC__STATIC_CAST(short,c))
+#define TCTEX_I_V_AND(a,b)          _mm_and_si128(a, b)
+#define TCTEX_I_V_OR(a,b)           _mm_or_si128(a, b)
+#define TCTEX_I_V_XOR(a,b)          _mm_xor_si128(a, b)
+#define TCTEX_I_V_ADD16(a,b)        _mm_add_epi16(a, b)
+#define TCTEX_I_V_SUB16(a,b)        _mm_sub_epi16(a, b)
+#define TCTEX_I_V_MULLO16(a,b)      _mm_mullo_epi16(a, b)
+#define TCTEX_I_V_MULHI16(a,b)      _mm_mulhi_epu16(a, b)
+#define TCTEX_I_V_SRLI16(x,n)       _mm_srli_epi16(x, n)
+#define TCTEX_I_V_SLLI16(x,n)       _mm_slli_epi16(x, n)
+#define TCTEX_I_V_SRAI16(x,n)       _mm_srai_epi16(x, n)
+#define TCTEX_I_V_ABS16(x)          _mm_abs_epi16(x)
+#define TCTEX_I_V_CMPLE_U16(a,b)    _mm_cmpeq_epi16(_mm_max_epu16(a, b), b)
+#define TCTEX_I_V_CMPGT_S16(a,b)    _mm_cmpgt_epi16(a, b)
+#define TCTEX_I_V_SELECT(m,a,b)     _mm_blendv_epi8(b, a, m)
+#define TCTEX_I_V_SHUF8(t,i)        _mm_shuffle_epi8(t, i)
+#define TCTEX_I_V_PACKLO16(a,b)     _mm_packus_epi16(a, b)
+#define TCTEX_I_V_UNPACKLO8(x)      _mm_unpacklo_epi8(x, _mm_setzero_si128())
+#define TCTEX_I_V_UNPACKHI8(x)      _mm_unpackhi_epi8(x, _mm_setzero_si128())
+#define TCTEX_I_V_SET8(c)           _mm_set1_epi8(TC__STATIC_CAST(char,c))
+#define TCTEX_I_V_SET32(c)          _mm_set1_epi32(TC__STATIC_CAST(int,c))
+#define TCTEX_I_V_SUBS_U8(a,b)      _mm_subs_epu8(a, b)
+#define TCTEX_I_V_MIN_U8(a,b)       _mm_min_epu8(a, b)
+#define TCTEX_I_V_CMPEQ8(a,b)       _mm_cmpeq_epi8(a, b)
+#define TCTEX_I_V_MADD16(a,b)       _mm_madd_epi16(a, b)
+#define TCTEX_I_V_HADD32(a,b)       _mm_hadd_epi32(a, b)
+#define TCTEX_I_V_CMPGT_S32(a,b)    _mm_cmpgt_epi32(a, b)
+TCTEX_I_V_KERNELS_DEF(sse41,1)
+TCTEX_I_V_FITS_DEF(sse41)
+#undef TCTEX_I_V_TARGET
+#undef TCTEX_I_V
+#undef TCTEX_I_V_LOAD
+#undef TCTEX_I_V_LOADL
+#undef TCTEX_I_V_STORE
+#undef TCTEX_I_V_CONST
+#undef TCTEX_I_V_SET16
+#undef TCTEX_I_V_AND
+#undef TCTEX_I_V_OR
+#undef TCTEX_I_V_XOR
+#undef TCTEX_I_V_ADD16
+#undef TCTEX_I_V_SUB16
+#undef TCTEX_I_V_MULLO16
+#undef TCTEX_I_V_MULHI16
+#undef TCTEX_I_V_SRLI16
+#undef TCTEX_I_V_SLLI16
+#undef TCTEX_I_V_SRAI16
+#undef TCTEX_I_V_ABS16
+#undef TCTEX_I_V_CMPLE_U16
+#undef TCTEX_I_V_CMPGT_S16
+#undef TCTEX_I_V_SELECT
+#undef TCTEX_I_V_SHUF8
+#undef TCTEX_I_V_PACKLO16
+#undef TCTEX_I_V_UNPACKLO8
+#undef TCTEX_I_V_UNPACKHI8
+#undef TCTEX_I_V_SET8
+#undef TCTEX_I_V_SET32
+#undef TCTEX_I_V_SUBS_U8
+#undef TCTEX_I_V_MIN_U8
+#undef TCTEX_I_V_CMPEQ8
+#undef TCTEX_I_V_MADD16
+#undef TCTEX_I_V_HADD32
+#undef TCTEX_I_V_CMPGT_S32
+
+/* AVX2: 2 blocks per iteration */
+#define TCTEX_I_V_TARGET            TCTEX_I_TARGET_X86("avx2")
+#define TCTEX_I_V                   __m256i
+#define TCTEX_I_V_LOAD(p,stride)    _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128((const __m128i*)(p))), _mm_loadu_si128((const __m128i*)((const uint8_t*)(p) + (stride))), 1)
+#define TCTEX_I_V_LOADL(p,stride)   _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadl_epi64((const __m128i*)(p))), _mm_loadl_epi64((const __m128i*)((const uint8_t*)(p) + (stride))), 1)
+#define TCTEX_I_V_STORE(p,x)        _mm256_storeu_si256((__m256i*)(p), x)
+#define TCTEX_I_V_CONST(p)          _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)(p)))
+#define TCTEX_I_V_SET16(c)          _mm256_set1_epi16(TC__STATIC_CAST(short,c))
+#define TCTEX_I_V_AND(a,b)          _mm256_and_si256(a, b)
+#define TCTEX_I_V_OR(a,b)           _mm256_or_si256(a, b)
+#define TCTEX_I_V_XOR(a,b)          _mm256_xor_si256(a, b)
+#define TCTEX_I_V_ADD16(a,b)        _mm256_add_epi16(a, b)
+#define TCTEX_I_V_SUB16(a,b)        _mm256_sub_epi16(a, b)
+#define TCTEX_I_V_MULLO16(a,b)      _mm256_mullo_epi16(a, b)
+#define TCTEX_I_V_MULHI16(a,b)      _mm256_mulhi_epu16(a, b)
+#define TCTEX_I_V_SRLI16(x,n)       _mm256_srli_epi16(x, n)
+#define TCTEX_I_V_SLLI16(x,n)       _mm256_slli_epi16(x, n)
+#define TCTEX_I_V_SRAI16(x,n)       _mm256_srai_epi16(x, n)
+#define TCTEX_I_V_ABS16(x)          _mm256_abs_epi16(x)
+#define TCTEX_I_V_CMPLE_U16(a,b)    _mm256_cmpeq_epi16(_mm256_max_epu16(a, b), b)
+#define TCTEX_I_V_CMPGT_S16(a,b)    _mm256_cmpgt_epi16(a, b)
+#define TCTEX_I_V_SELECT(m,a,b)     _mm256_blendv_epi8(b, a, m)
+#define TCTEX_I_V_SHUF8(t,i)        _mm256_shuffle_epi8(t, i)
+#define TCTEX_I_V_PACKLO16(a,b)     _mm256_packus_epi16(a, b)
+#define TCTEX_I_V_UNPACKLO8(x)      _mm256_unpacklo_epi8(x, _mm256_setzero_si256())
+#define TCTEX_I_V_UNPACKHI8(x)      _mm256_unpackhi_epi8(x, _mm256_setzero_si256())
+TCTEX_I_V_KERNELS_DEF(avx2,2)
+#undef TCTEX_I_V_TARGET
+#undef TCTEX_I_V
+#undef TCTEX_I_V_LOAD
+#undef TCTEX_I_V_LOADL
+#undef TCTEX_I_V_STORE
+#undef TCTEX_I_V_CONST
+#undef TCTEX_I_V_SET16
+#undef TCTEX_I_V_AND
+#undef TCTEX_I_V_OR
+#undef TCTEX_I_V_XOR
+#undef TCTEX_I_V_ADD16
+#undef TCTEX_I_V_SUB16
+#undef TCTEX_I_V_MULLO16
+#undef TCTEX_I_V_MULHI16
+#undef TCTEX_I_V_SRLI16
+#undef TCTEX_I_V_SLLI16
+#undef TCTEX_I_V_SRAI16
+#undef TCTEX_I_V_ABS16
+#undef TCTEX_I_V_CMPLE_U16
+#undef TCTEX_I_V_CMPGT_S16
+#undef TCTEX_I_V_SELECT
+#undef TCTEX_I_V_SHUF8
+#undef TCTEX_I_V_PACKLO16
+#undef TCTEX_I_V_UNPACKLO8
+#undef TCTEX_I_V_UNPACKHI8
+#elif defined(TCTEX_I_ACCEL_ARM)
+/* unsigned 16x16->32-bit multiply, keeping the high halves (like `_mm_mulhi_epu16()`) */
+static uint8x16_t tctex_i_neon_mulhi16(uint8x16_t a, uint8x16_t b)
+{
+    uint32x4_t lo = vmull_u16(vget_low_u16(vreinterpretq_u16_u8(a)), vget_low_u16(vreinterpretq_u16_u8(b)));
+    uint32x4_t hi = vmull_high_u16(vreinterpretq_u16_u8(a), vreinterpretq_u16_u8(b));
+    return vreinterpretq_u8_u16(vuzp2q_u16(vreinterpretq_u16_u32(lo), vreinterpretq_u16_u32(hi)));
+}
+/* like `_mm_madd_epi16()`: signed 16x16->32-bit multiply, adding adjacent pairs */
+static uint8x16_t tctex_i_neon_madd16(uint8x16_t a, uint8x16_t b)
+{
+    int32x4_t lo = vmull_s16(vget_low_s16(vreinterpretq_s16_u8(a)), vget_low_s16(vreinterpretq_s16_u8(b)));
+    int32x4_t hi = vmull_high_s16(vreinterpretq_s16_u8(a), vreinterpretq_s16_u8(b));
+    return vreinterpretq_u8_s32(vpaddq_s32(lo, hi));
+}
+/* NEON: 1 block per iteration */
+#define TCTEX_I_V_TARGET
+#define TCTEX_I_V                   uint8x16_t
+#define TCTEX_I_V_U16(x)            vreinterpretq_u16_u8(x)
+#define TCTEX_I_V_S16(x)            vreinterpretq_s16_u8(x)
+#define TCTEX_I_V_LOAD(p,stride)    vld1q_u8((const uint8_t*)(p))
+#define TCTEX_I_V_LOADL(p,stride)   vcombine_u8(vld1_u8((const uint8_t*)(p)), vdup_n_u8(0))
+#define TCTEX_I_V_STORE(p,x)        vst1q_u8((uint8_t*)(p), x)
+#define TCTEX_I_V_CONST(p)          vld1q_u8((const uint8_t*)(p))
+#define TCTEX_I_V_SET16(c)          vreinterpretq_u8_u16(vdupq_n_u16(c))
+#define TCTEX_I_V_AND(a,b)          vandq_u8(a, b)
+#define TCTEX_I_V_OR(a,b)           vorrq_u8(a, b)
+#define TCTEX_I_V_XOR(a,b)          veorq_u8(a, b)
+#define TCTEX_I_V_ADD16(a,b)        vreinterpretq_u8_u16(vaddq_u16(TCTEX_I_V_U16(a), TCTEX_I_V_U16(b)))
+#define TCTEX_I_V_SUB16(a,b)        vreinterpretq_u8_u16(vsubq_u16(TCTEX_I_V_U16(a), TCTEX_I_V_U16(b)))
+#define TCTEX_I_V_MULLO16(a,b)      vreinterpretq_u8_u16(vmulq_u16(TCTEX_I_V_U16(a), TCTEX_I_V_U16(b)))
+#define TCTEX_I_V_MULHI16(a,b)      tctex_i_neon_mulhi16(a, b)
+#define TCTEX_I_V_SRLI16(x,n)       vreinterpretq_u8_u16(vshrq_n_u16(TCTEX_I_V_U16(x), n))
+#define TCTEX_I_V_SLLI16(x,n)       vreinterpretq_u8_u16(vshlq_n_u16(TCTEX_I_V_U16(x), n))
+#define TCTEX_I_V_SRAI16(x,n)       vreinterpretq_u8_s16(vshrq_n_s16(TCTEX_I_V_S16(x), n))
+#define TCTEX_I_V_ABS16(x)          vreinterpretq_u8_s16(vabsq_s16(TCTEX_I_V_S16(x)))
+#define TCTEX_I_V_CMPLE_U16(a,b)    vreinterpretq_u8_u16(vcleq_u16(TCTEX_I_V_U16(a), TCTEX_I_V_U16(b)))
+#define TCTEX_I_V_CMPGT_S16(a,b)    vreinterpretq_u8_u16(vcgtq_s16(TCTEX_I_V_S16(a), TCTEX_I_V_S16(b)))
+#define TCTEX_I_V_SELECT(m,a,b)     vbslq_u8(m, a, b)
+#define TCTEX_I_V_SHUF8(t,i)        vqtbl1q_u8(t, i)
+#define TCTEX_I_V_PACKLO16(a,b)     vcombine_u8(vmovn_u16(TCTEX_I_V_U16(a)), vmovn_u16(TCTEX_I_V_U16(b)))
+#define TCTEX_I_V_UNPACKLO8(x)      vreinterpretq_u8_u16(vmovl_u8(vget_low_u8(x)))
+#define TCTEX_I_V_UNPACKHI8(x)      vreinterpretq_u8_u16(vmovl_high_u8(x))
+#define TCTEX_I_V_SET8(c)           vdupq_n_u8(TC__STATIC_CAST(uint8_t,c))
+#define TCTEX_I_V_SET32(c)          vreinterpretq_u8_u32(vdupq_n_u32(c))
+#define TCTEX_I_V_SUBS_U8(a,b)      vqsubq_u8(a, b)
+#define TCTEX_I_V_MIN_U8(a,b)       vminq_u8(a, b)
+#define TCTEX_I_V_CMPEQ8(a,b)       vceqq_u8(a, b)
+#define TCTEX_I_V_MADD16(a,b)       tctex_i_neon_madd16(a, b)
+#define TCTEX_I_V_HADD32(a,b)       vreinterpretq_u8_s32(vpaddq_s32(vreinterpretq_s32_u8(a), vreinterpretq_s32_u8(b)))
+#define TCTEX_I_V_CMPGT_S32(a,b)    vreinterpretq_u8_u32(vcgtq_s32(vreinterpretq_s32_u8(a), vreinterpretq_s32_u8(b)))
+TCTEX_I_V_KERNELS_DEF(neon,1)
+TCTEX_I_V_FITS_DEF(neon)
+#undef TCTEX_I_V_TARGET
+#undef TCTEX_I_V
+#undef TCTEX_I_V_U16
+#undef TCTEX_I_V_S16
+#undef TCTEX_I_V_LOAD
+#undef TCTEX_I_V_LOADL
+#undef TCTEX_I_V_STORE
+#undef TCTEX_I_V_CONST
+#undef TCTEX_I_V_SET16
+#undef TCTEX_I_V_AND
+#undef TCTEX_I_V_OR
+#undef TCTEX_I_V_XOR
+#undef TCTEX_I_V_ADD16
+#undef TCTEX_I_V_SUB16
+#undef TCTEX_I_V_MULLO16
+#undef TCTEX_I_V_MULHI16
+#undef TCTEX_I_V_SRLI16
+#undef TCTEX_I_V_SLLI16
+#undef TCTEX_I_V_SRAI16
+#undef TCTEX_I_V_ABS16
+#undef TCTEX_I_V_CMPLE_U16
+#undef TCTEX_I_V_CMPGT_S16
+#undef TCTEX_I_V_SELECT
+#undef TCTEX_I_V_SHUF8
+#undef TCTEX_I_V_PACKLO16
+#undef TCTEX_I_V_UNPACKLO8
+#undef TCTEX_I_V_UNPACKHI8
+#undef TCTEX_I_V_SET8
+#undef TCTEX_I_V_SET32
+#undef TCTEX_I_V_SUBS_U8
+#undef TCTEX_I_V_MIN_U8
+#undef TCTEX_I_V_CMPEQ8
+#undef TCTEX_I_V_MADD16
+#undef TCTEX_I_V_HADD32
+#undef TCTEX_I_V_CMPGT_S32
+#endif
+#undef TCTEX_I_V_BC1_BODY
+#undef TCTEX_I_V_BC4_BODY
+#undef TCTEX_I_V_ALPHA4_BODY
+#undef TCTEX_I_V_BC7_INTERP
+#undef TCTEX_I_V_BC7_BODY
+#undef TCTEX_I_V_KERNELS_DEF
+#undef TCTEX_I_V_FITS_DEF
+#endif /* TCTEX_I_ACCEL_X86 || TCTEX_I_ACCEL_ARM */
+
+/* returns `NULL` if there is no SIMD kernel available */
+static tctex_i_row_kernel* tctex_i_get_kernel(int format)
+{
+#if defined(TCTEX_I_ACCEL_X86)
+    unsigned int accel = tctex_accel_get();
+    if(accel & TCTEX_ACCEL_X86_AVX2) return tctex_i_kernels_avx2[format];
+    if(accel & TCTEX_ACCEL_X86_SSE41) return tctex_i_kernels_sse41[format];
+#elif defined(TCTEX_I_ACCEL_ARM)
+    if(tctex_accel_get() & TCTEX_ACCEL_ARM_NEON) return tctex_i_kernels_neon[format];
+#else
+    (void)format;
+#endif
+    return NULL;
+}
+
+#define TCTEX_I_ROW_BLOCKS  32
+/*
+ * Decodes a full image one block row at a time. If the output is tightly-packed,
+ * the kernel writes into `dst` directly; otherwise, up to `TCTEX_I_ROW_BLOCKS`
+ * blocks at a time go through a temporary buffer, and only the first `nchan`
+ * channels of each pixel are copied out.
+ */
+static void tctex_i_decompress_rows(tctex_i_row_kernel* kernel, uint8_t* ddata, size_t dstride_x, size_t dpitch_y, const uint8_t* bdata, size_t w, size_t h, size_t bsize, size_t psize, size_t nchan, bool flag)
+{
+    uint8_t tmp[4 * TCTEX_I_ROW_BLOCKS * 4 * 4];
+    size_t tpitch = TCTEX_I_ROW_BLOCKS * 4 * psize;
+    size_t nblocks = (w + 3) / 4;
+
+    size_t y;
+    for(y = 0; y < h; y += 4)
+    {
+        if(dstride_x == psize && nchan == psize)
+        {
+            kernel(&ddata[y * dpitch_y], dpitch_y, bdata, nblocks, flag);
+            bdata += nblocks * bsize;
+            continue;
+        }
+
+        size_t x, n;
+        for(x = 0; x < nblocks; x += n)
+        {
+            n = nblocks - x < TCTEX_I_ROW_BLOCKS ? nblocks - x : TCTEX_I_ROW_BLOCKS;
+            kernel(tmp, tpitch, bdata, n, flag);
+            bdata += n * bsize;
+
+            size_t i, j;
+            for(j = 0; j < 4; j++)
+                for(i = 0; i < 4 * n; i++)
+                    memcpy(&ddata[(y + j) * dpitch_y + (4 * x + i) * dstride_x], &tmp[j * tpitch + i * psize], nchan);
+        }
+    }
+}
+
+
+
+void tctex_decompress_bc1(void* dst, size_t dstride_x, size_t dpitch_y, const void* src, size_t w, size_t h, bool use_select, bool use_alpha)
+{
+    uint8_t* ddata = TC__VOID_CAST(uint8_t*,dst);
+    const uint8_t* bdata = TC__VOID_CAST(const uint8_t*,src);
+
+    tctex_i_row_kernel* kernel = tctex_i_get_kernel(TCTEX_I_KERNEL_BC1);
+    if(kernel)
+    {
+        tctex_i_decompress_rows(kernel, ddata, dstride_x, dpitch_y, bdata, w, h, 8, 4, use_alpha ? 4 : 3, use_select);
+        return;
+    }
+
+    size_t y;
+    for(y = 0; y < h; y += 4)
+    {
+        size_t x;
+        for(x = 0; x < w; x += 4)
+        {
+            tctex_decompress_bc1_block(&ddata[y * dpitch_y + x * dstride_x], dstride_x, dpitch_y, bdata, use_select, use_alpha);
+            bdata += 8;
+        }
+    }
+}
+void tctex_decompress_bc2(void* dst, size_t dstride_x, size_t dpitch_y, const void* src, size_t w, size_t h)
+{
+    uint8_t* ddata = TC__VOID_CAST(uint8_t*,dst);
+    const uint8_t* bdata = TC__VOID_CAST(const uint8_t*,src);
+
+    tctex_i_row_kernel* kernel = tctex_i_get_kernel(TCTEX_I_KERNEL_BC2);
+    if(kernel)
+    {
+        tctex_i_decompress_rows(kernel, ddata, dstride_x, dpitch_y, bdata, w, h, 16, 4, 4, false);
+        return;
+    }
+
+    size_t y;
+    for(y = 0; y < h; y += 4)
+    {
+        size_t x;
+        for(x = 0; x < w; x += 4)
+        {
+            tctex_decompress_alpha4_block(&ddata[y * dpitch_y + x * dstride_x + 3], dstride_x, dpitch_y, bdata);
+            tctex_decompress_bc1_block(&ddata[y * dpitch_y + x * dstride_x + 0], dstride_x, dpitch_y, bdata + 8, false, false);
+            bdata += 16;
+        }
+    }
+}
+void tctex_decompress_bc3(void* dst, size_t dstride_x, size_t dpitch_y, const void* src, size_t w, size_t h)
+{
+    uint8_t* ddata = TC__VOID_CAST(uint8_t*,dst);
+    const uint8_t* bdata = TC__VOID_CAST(const uint8_t*,src);
+
+    tctex_i_row_kernel* kernel = tctex_i_get_kernel(TCTEX_I_KERNEL_BC3);
+    if(kernel)
+    {
+        tctex_i_decompress_rows(kernel, ddata, dstride_x, dpitch_y, bdata, w, h, 16, 4, 4, false);
+        return;
+    }
+
+    size_t y;
+    for(y = 0; y < h; y += 4)
+    {
+        size_t x;
+        for(x = 0; x < w; x += 4)
+        {
+            tctex_decompress_bc4_block(&ddata[y * dpitch_y + x * dstride_x + 3], dstride_x, dpitch_y, bdata, false);
+            tctex_decompress_bc1_block(&ddata[y * dpitch_y + x * dstride_x + 0], dstride_x, dpitch_y, bdata + 8, true, false);
+            bdata += 16;
+        }
+    }
+}
+void tctex_decompress_bc4(void* dst, size_t dstride_x, size_t dpitch_y, const void* src, size_t w, size_t h, bool is_signed)
+{
+    uint8_t* ddata = TC__VOID_CAST(uint8_t*,dst);
+    const uint8_t* bdata = TC__VOID_CAST(const uint8_t*,src);
+
+    tctex_i_row_kernel* kernel = tctex_i_get_kernel(TCTEX_I_KERNEL_BC4);
+    if(kernel)
+    {
+        tctex_i_decompress_rows(kernel, ddata, dstride_x, dpitch_y, bdata, w, h, 8, 1, 1, is_signed);
+        return;
+    }
+
+    size_t y;
+    for(y = 0; y < h; y += 4)
+    {
+        size_t x;
+        for(x = 0; x < w; x += 4)
+        {
+            tctex_decompress_bc4_block(&ddata[y * dpitch_y + x * dstride_x], dstride_x, dpitch_y, bdata, is_signed);
+            bdata += 8;
         }
     }
 }
@@ -1219,6 +2385,13 @@ void tctex_decompress_bc5(void* dst, size_t dstride_x, size_t dpitch_y, const vo
     uint8_t* ddata = TC__VOID_CAST(uint8_t*,dst);
     const uint8_t* bdata = TC__VOID_CAST(const uint8_t*,src);
 
+    tctex_i_row_kernel* kernel = tctex_i_get_kernel(TCTEX_I_KERNEL_BC5);
+    if(kernel)
+    {
+        tctex_i_decompress_rows(kernel, ddata, dstride_x, dpitch_y, bdata, w, h, 16, 2, 2, is_signed);
+        return;
+    }
+
     size_t y;
     for(y = 0; y < h; y += 4)
     {
@@ -1226,7 +2399,7 @@ void tctex_decompress_bc5(void* dst, size_t dstride_x, size_t dpitch_y, const vo
         for(x = 0; x < w; x += 4)
         {
             tctex_decompress_bc4_block(&ddata[y * dpitch_y + x * dstride_x + 0], dstride_x, dpitch_y, bdata, is_signed);
-            tctex_decompress_bc4_block(&ddata[y * dpitch_y + x * dstride_x + 1], dstride_x, dpitch_y, bdata + 4, is_signed);
+            tctex_decompress_bc4_block(&ddata[y * dpitch_y + x * dstride_x + 1], dstride_x, dpitch_y, bdata + 8, is_signed);
             bdata += 16;
         }
     }
@@ -1252,6 +2425,13 @@ void tctex_decompress_bc7(void* dst, size_t dstride_x, size_t dpitch_y, const vo
     uint8_t* ddata = TC__VOID_CAST(uint8_t*,dst);
     const uint8_t* bdata = TC__VOID_CAST(const uint8_t*,src);
 
+    tctex_i_row_kernel* kernel = tctex_i_get_kernel(TCTEX_I_KERNEL_BC7);
+    if(kernel)
+    {
+        tctex_i_decompress_rows(kernel, ddata, dstride_x, dpitch_y, bdata, w, h, 16, 4, 4, false);
+        return;
+    }
+
     size_t y;
     for(y = 0; y < h; y += 4)
     {
@@ -1264,33 +2444,1524 @@ void tctex_decompress_bc7(void* dst, size_t dstride_x, size_t dpitch_y, const vo
     }
 }
 
+void tctex_decompress(TCTex_CodecFormat format, void* dst, size_t dstride_x, size_t dpitch_y, const void* src, size_t w, size_t h)
+{
+    switch(format)
+    {
+    case TCTEX_CODEC_BC1: tctex_decompress_bc1(dst, dstride_x, dpitch_y, src, w, h, true, false); break;
+    case TCTEX_CODEC_BC1_ALPHA: tctex_decompress_bc1(dst, dstride_x, dpitch_y, src, w, h, true, true); break;
+    case TCTEX_CODEC_BC2: tctex_decompress_bc2(dst, dstride_x, dpitch_y, src, w, h); break;
+    case TCTEX_CODEC_BC3: tctex_decompress_bc3(dst, dstride_x, dpitch_y, src, w, h); break;
+    case TCTEX_CODEC_BC4: tctex_decompress_bc4(dst, dstride_x, dpitch_y, src, w, h, false); break;
+    case TCTEX_CODEC_BC4_SIGNED: tctex_decompress_bc4(dst, dstride_x, dpitch_y, src, w, h, true); break;
+    case TCTEX_CODEC_BC5: tctex_decompress_bc5(dst, dstride_x, dpitch_y, src, w, h, false); break;
+    case TCTEX_CODEC_BC5_SIGNED: tctex_decompress_bc5(dst, dstride_x, dpitch_y, src, w, h, true); break;
+    case TCTEX_CODEC_BC6H: tctex_decompress_bc6h(dst, dstride_x, dpitch_y, src, w, h, false); break;
+    case TCTEX_CODEC_BC6H_SIGNED: tctex_decompress_bc6h(dst, dstride_x, dpitch_y, src, w, h, true); break;
+    case TCTEX_CODEC_BC7: tctex_decompress_bc7(dst, dstride_x, dpitch_y, src, w, h); break;
+    }
+}
+
+#ifdef TC_THREAD_H_
+/* bands are sized by their compressed data, so that narrow images (or mip levels) still get a reasonable amount of work per job */
+#ifndef TCTEX_PARALLEL_BAND_BYTES
+#define TCTEX_PARALLEL_BAND_BYTES   65536
+#endif
+static size_t tctex_i_codec_block_size(TCTex_CodecFormat format)
+{
+    switch(format)
+    {
+    case TCTEX_CODEC_BC1: case TCTEX_CODEC_BC1_ALPHA:
+    case TCTEX_CODEC_BC4: case TCTEX_CODEC_BC4_SIGNED:
+        return 8;
+    default:
+        return 16;
+    }
+}
+typedef struct TCTex_I_DecompressBands
+{
+    TCTex_CodecFormat format;
+    const TCTex_DecompressImage* image;
+    tcthread_pool_t pool;
+} TCTex_I_DecompressBands;
+/* decodes block rows `[begin,end)` of a single image; each is exactly what a serial call would do for those rows */
+static void tctex_i_decompress_band(size_t begin, size_t end, void* udata)
+{
+    const TCTex_I_DecompressBands* bands = TC__VOID_CAST(const TCTex_I_DecompressBands*,udata);
+    const TCTex_DecompressImage* image = bands->image;
+    size_t rowsize = (image->w + 3) / 4 * tctex_i_codec_block_size(bands->format);
+    size_t y = begin * 4;
+    size_t h = end * 4 < image->h ? end * 4 - y : image->h - y;
+    tctex_decompress(bands->format, TC__STATIC_CAST(uint8_t*,image->dst) + y * image->dpitch_y, image->dstride_x, image->dpitch_y,
+        TC__STATIC_CAST(const uint8_t*,image->src) + begin * rowsize, image->w, h);
+}
+static void tctex_i_decompress_image_bands(TCTex_CodecFormat format, const TCTex_DecompressImage* image, tcthread_pool_t pool)
+{
+    TCTex_I_DecompressBands bands;
+    bands.format = format;
+    bands.image = image;
+    bands.pool = pool;
+
+    size_t rowsize = (image->w + 3) / 4 * tctex_i_codec_block_size(format);
+    size_t grain = rowsize ? TCTEX_PARALLEL_BAND_BYTES / rowsize : 0;
+    tcthread_pool_parallel_for(pool, (image->h + 3) / 4, grain ? grain : 1, tctex_i_decompress_band, &bands);
+}
+/* each image gets its own (nested) parallel loop, so that large images are split into bands, while small ones run concurrently */
+static void tctex_i_decompress_images(size_t begin, size_t end, void* udata)
+{
+    const TCTex_I_DecompressBands* all = TC__VOID_CAST(const TCTex_I_DecompressBands*,udata);
+    size_t i;
+    for(i = begin; i < end; i++)
+        tctex_i_decompress_image_bands(all->format, &all->image[i], all->pool);
+}
+void tctex_decompress_parallel(TCTex_CodecFormat format, void* dst, size_t dstride_x, size_t dpitch_y, const void* src, size_t w, size_t h, tcthread_pool_t pool)
+{
+    TCTex_DecompressImage image;
+    image.dst = dst;
+    image.dstride_x = dstride_x;
+    image.dpitch_y = dpitch_y;
+    image.src = src;
+    image.w = w;
+    image.h = h;
+    tctex_decompress_parallel_images(format, &image, 1, pool);
+}
+void tctex_decompress_parallel_images(TCTex_CodecFormat format, const TCTex_DecompressImage* images, size_t nimages, tcthread_pool_t pool)
+{
+    if(!tcthread_pool_is_valid(pool))
+    {
+        size_t i;
+        for(i = 0; i < nimages; i++)
+            tctex_decompress(format, images[i].dst, images[i].dstride_x, images[i].dpitch_y, images[i].src, images[i].w, images[i].h);
+        return;
+    }
+    if(nimages == 1)
+    {
+        tctex_i_decompress_image_bands(format, images, pool);
+        return;
+    }
+
+    TCTex_I_DecompressBands all;
+    all.format = format;
+    all.image = images;
+    all.pool = pool;
+    tcthread_pool_parallel_for(pool, nimages, 1, tctex_i_decompress_images, &all);
+}
+#endif /* TC_THREAD_H_ */
+
+
+/*
+ * Compression
+ *
+ * All of the encoders use the decoders' own palettes (`tctex_i_bc1_get_palette()`,
+ * `tctex_i_bc4_get_palette()`, and the BC7 interpolation) to pick the indices,
+ * so any error they report is the exact squared error of the decoded block.
+ */
+static int tctex_i_clampi(int x, int lo, int hi)
+{
+    return x < lo ? lo : x > hi ? hi : x;
+}
+static float tctex_i_clampf(float x, float lo, float hi)
+{
+    return x < lo ? lo : x > hi ? hi : x;
+}
+
+/* reference (scalar) versions of `tctex_i_fit_rgba_##ISA()` & `tctex_i_fit_r8_##ISA()`; ties go to the lowest index */
+static uint32_t tctex_i_fit_rgba_ref(uint8_t idx[16], const uint8_t* px, size_t npx, const uint8_t* pal, size_t npal, const uint8_t mask[4])
+{
+    uint32_t total = 0;
+    size_t i, k, c;
+    for(i = 0; i < 16; i++)
+    {
+        uint32_t best = 0x7FFFFFFF;
+        idx[i] = 0;
+        for(k = 0; k < npal; k++)
+        {
+            uint32_t err = 0;
+            for(c = 0; c < 4; c++)
+            {
+                int d = (px[4 * i + c] & mask[c]) - (pal[4 * k + c] & mask[c]);
+                err += d * d;
+            }
+            if(err < best)
+            {
+                best = err;
+                idx[i] = TC__STATIC_CAST(uint8_t,k);
+            }
+        }
+        if(i < npx) total += best;
+    }
+    return total;
+}
+static uint32_t tctex_i_fit_r8_ref(uint8_t idx[16], const uint8_t v[16], const uint8_t* pal, size_t npal)
+{
+    uint32_t total = 0;
+    size_t i, k;
+    for(i = 0; i < 16; i++)
+    {
+        int best = 0xFF;
+        idx[i] = 0;
+        for(k = 0; k < npal; k++)
+        {
+            int d = v[i] > pal[k] ? v[i] - pal[k] : pal[k] - v[i];
+            if(d < best)
+            {
+                best = d;
+                idx[i] = TC__STATIC_CAST(uint8_t,k);
+            }
+        }
+        total += best * best;
+    }
+    return total;
+}
+/* AVX2 has no fit of its own: with only 16 pixels per block, the SSE4.1 one is as fast */
+static tctex_i_fit_rgba_func* tctex_i_get_fit_rgba(void)
+{
+#if defined(TCTEX_I_ACCEL_X86)
+    if(tctex_accel_get() & (TCTEX_ACCEL_X86_AVX2 | TCTEX_ACCEL_X86_SSE41)) return tctex_i_fit_rgba_sse41;
+#elif defined(TCTEX_I_ACCEL_ARM)
+    if(tctex_accel_get() & TCTEX_ACCEL_ARM_NEON) return tctex_i_fit_rgba_neon;
+#endif
+    return tctex_i_fit_rgba_ref;
+}
+static tctex_i_fit_r8_func* tctex_i_get_fit_r8(void)
+{
+#if defined(TCTEX_I_ACCEL_X86)
+    if(tctex_accel_get() & (TCTEX_ACCEL_X86_AVX2 | TCTEX_ACCEL_X86_SSE41)) return tctex_i_fit_r8_sse41;
+#elif defined(TCTEX_I_ACCEL_ARM)
+    if(tctex_accel_get() & TCTEX_ACCEL_ARM_NEON) return tctex_i_fit_r8_neon;
+#endif
+    return tctex_i_fit_r8_ref;
+}
+
+/* reads a 4x4 block of `nchan`-channel pixels into RGBA8, filling missing channels with `fill` */
+static void tctex_i_load_block(uint8_t px[16][4], const uint8_t* sdata, size_t sstride_x, size_t spitch_y, size_t nchan, const uint8_t fill[4])
+{
+    size_t x, y;
+    for(y = 0; y < 4; y++)
+        for(x = 0; x < 4; x++)
+        {
+            memcpy(px[4 * y + x], fill, 4);
+            memcpy(px[4 * y + x], &sdata[y * spitch_y + x * sstride_x], nchan);
+        }
+}
+
+/*
+ * Mean & principal axis (by power iteration) of the first `nchan` channels of
+ * `npx` pixels; the other channels of `axis` are set to 0. Returns the residual
+ * (the summed squared distance of the pixels from the axis).
+ */
+static float tctex_i_pca(float mean[4], float axis[4], const uint8_t* px, size_t npx, size_t nchan)
+{
+    float cov[4][4] = {{0}};
+    size_t i, j, k;
+    for(j = 0; j < 4; j++)
+    {
+        mean[j] = 0.0f;
+        axis[j] = 0.0f;
+    }
+    for(i = 0; i < npx; i++)
+        for(j = 0; j < nchan; j++)
+            mean[j] += px[4 * i + j];
+    for(j = 0; j < nchan; j++)
+        mean[j] /= npx;
+    for(i = 0; i < npx; i++)
+        for(j = 0; j < nchan; j++)
+            for(k = j; k < nchan; k++)
+                cov[j][k] += (px[4 * i + j] - mean[j]) * (px[4 * i + k] - mean[k]);
+
+    float trace = 0.0f;
+    size_t jmax = 0;
+    for(j = 0; j < nchan; j++)
+    {
+        for(k = 0; k < j; k++)
+            cov[j][k] = cov[k][j];
+        trace += cov[j][j];
+        if(cov[j][j] > cov[jmax][jmax]) jmax = j;
+    }
+    if(trace <= 0.0f)
+        return 0.0f;
+
+    // start from the row with the largest variance, so that we never start orthogonal to the axis
+    for(k = 0; k < nchan; k++)
+        axis[k] = cov[jmax][k];
+    for(i = 0; i < 8; i++)
+    {
+        float v[4] = {0}, vmax = 0.0f;
+        for(j = 0; j < nchan; j++)
+        {
+            for(k = 0; k < nchan; k++)
+                v[j] += cov[j][k] * axis[k];
+            if(fabsf(v[j]) > vmax) vmax = fabsf(v[j]);
+        }
+        if(vmax <= 0.0f) break;
+        for(j = 0; j < nchan; j++)
+            axis[j] = v[j] / vmax;
+    }
+    float len2 = 0.0f, lambda = 0.0f;
+    for(j = 0; j < nchan; j++)
+        len2 += axis[j] * axis[j];
+    if(len2 <= 0.0f)
+        return trace;
+    for(j = 0; j < nchan; j++)
+        axis[j] /= sqrtf(len2);
+    for(j = 0; j < nchan; j++)
+        for(k = 0; k < nchan; k++)
+            lambda += axis[j] * cov[j][k] * axis[k];
+    return trace > lambda ? trace - lambda : 0.0f;
+}
+/* endpoints at the extreme projections of the pixels onto the axis */
+static void tctex_i_range_fit(float ea[4], float eb[4], const uint8_t* px, size_t npx, const float mean[4], const float axis[4])
+{
+    float tmin = 0.0f, tmax = 0.0f;
+    size_t i, c;
+    for(i = 0; i < npx; i++)
+    {
+        float t = 0.0f;
+        for(c = 0; c < 4; c++)
+            t += (px[4 * i + c] - mean[c]) * axis[c];
+        if(!i || t < tmin) tmin = t;
+        if(!i || t > tmax) tmax = t;
+    }
+    for(c = 0; c < 4; c++)
+    {
+        ea[c] = tctex_i_clampf(mean[c] + tmin * axis[c], 0.0f, 255.0f);
+        eb[c] = tctex_i_clampf(mean[c] + tmax * axis[c], 0.0f, 255.0f);
+    }
+}
+
 
-float tctex_util_linear_from_srgb(uint8_t srgb)
+/* BC1 */
+#define TCTEX_I_BC1_OPAQUE  0   /* opaque; 3-color mode is allowed, but not its transparent black */
+#define TCTEX_I_BC1_ALPHA   1   /* pixels with alpha below 128 become transparent black */
+#define TCTEX_I_BC1_4COLOR  2   /* 4-color mode only, as used by BC3 */
+typedef struct TCTex_BC1_Fit
+{
+    uint32_t err;
+    uint16_t c0, c1;
+    uint8_t idx[16];
+} TCTex_BC1_Fit;
+/* `v` should already be clamped to 0-255 */
+static uint8_t tctex_i_bc1_snap(float v, uint8_t bits, uint8_t* expanded)
 {
-    float fsrgb = srgb / 255.0f;
-    if(fsrgb <= 0.04045f) return fsrgb / 12.92f;
-    return powf((fsrgb + 0.055f) / 1.055f, 2.4f);
+    int q = TC__STATIC_CAST(int,v * ((1 << bits) - 1) / 255.0f + 0.5f);
+    if(expanded) *expanded = tctex_i_expandchannel8(TC__STATIC_CAST(uint8_t,q), bits);
+    return TC__STATIC_CAST(uint8_t,q);
 }
-static uint8_t tctex_i_clamp_u8f32(float f)
+static uint16_t tctex_i_bc1_quantize(const float c[3])
 {
-    int i = (int)f;
-    return i < 0 ? 0 : i > 255 ? 255 : i;
+    uint8_t r = tctex_i_bc1_snap(tctex_i_clampf(c[0], 0.0f, 255.0f), 5, NULL);
+    uint8_t g = tctex_i_bc1_snap(tctex_i_clampf(c[1], 0.0f, 255.0f), 6, NULL);
+    uint8_t b = tctex_i_bc1_snap(tctex_i_clampf(c[2], 0.0f, 255.0f), 5, NULL);
+    return (r << 11) | (g << 5) | b;
 }
-uint8_t tctex_util_srgb_from_linear(float linear)
+/* quantizes the endpoints, and keeps them if they beat `best` */
+static void tctex_i_bc1_try(TCTex_BC1_Fit* best, const float ca[3], const float cb[3], bool three_color, const uint8_t* px, size_t npx, tctex_i_fit_rgba_func* fit)
+{
+    static const uint8_t mask[4] = { 0xFF, 0xFF, 0xFF, 0x00 };
+    uint16_t c0 = tctex_i_bc1_quantize(ca), c1 = tctex_i_bc1_quantize(cb);
+    if(three_color ? c0 > c1 : c0 < c1)
+    {
+        uint16_t t = c0;
+        c0 = c1;
+        c1 = t;
+    }
+
+    TCTex_ColorB8G8R8A8 colors8[4];
+    uint8_t pal[4][4], idx[16];
+    size_t k, npal = c0 == c1 ? 1 : c0 < c1 ? 3 : 4; // never the transparent black
+    tctex_i_bc1_get_palette(colors8, c0, c1, c0 <= c1);
+    for(k = 0; k < npal; k++)
+    {
+        pal[k][0] = colors8[k].c.r;
+        pal[k][1] = colors8[k].c.g;
+        pal[k][2] = colors8[k].c.b;
+        pal[k][3] = 0xFF;
+    }
+    uint32_t err = fit(idx, px, npx, pal[0], npal, mask);
+    if(err < best->err)
+    {
+        best->err = err;
+        best->c0 = c0;
+        best->c1 = c1;
+        memcpy(best->idx, idx, sizeof(idx));
+    }
+}
+/*
+ * Cluster fit (as in squish): the pixels are sorted along `axis`, and every split
+ * of them into 4 (or 3) consecutive clusters gets least-squares endpoints; the
+ * split with the lowest error (after snapping to 565) wins. Returns `false` if
+ * no split is usable (e.g. a single pixel).
+ */
+static bool tctex_i_bc1_cluster_fit(float ca[3], float cb[3], const uint8_t* px, size_t npx, const float axis[4], bool three_color)
 {
-    if(linear <= 0.0f) return 0;
-    if(linear < 0.0031308f) return tctex_i_clamp_u8f32(255.0f * 12.92f * linear);
-    if(linear < 1.0f) return tctex_i_clamp_u8f32(255.0f * (1.055f * powf(linear, 0.41666f) - 0.055f));
-    return 255;
+    static const float alphas[2][4] = { { 1.0f, 2.0f / 3.0f, 1.0f / 3.0f, 0.0f }, { 1.0f, 0.5f, 0.0f, 0.0f } };
+    static const uint8_t bits[3] = { 5, 6, 5 };
+    const float* alpha = alphas[three_color];
+    float dots[16], sums[17][3], besterr = 0.0f;
+    uint8_t order[16];
+    size_t i, j, k, c;
+    bool found = false;
+
+    for(i = 0; i < npx; i++)
+    {
+        dots[i] = px[4 * i + 0] * axis[0] + px[4 * i + 1] * axis[1] + px[4 * i + 2] * axis[2];
+        for(j = i; j > 0 && dots[order[j - 1]] > dots[i]; j--)
+            order[j] = order[j - 1];
+        order[j] = TC__STATIC_CAST(uint8_t,i);
+    }
+    for(c = 0; c < 3; c++)
+        sums[0][c] = 0.0f;
+    for(i = 0; i < npx; i++)
+        for(c = 0; c < 3; c++)
+            sums[i + 1][c] = sums[i][c] + px[4 * order[i] + c];
+
+    for(i = 0; i <= npx; i++)
+        for(j = i; j <= npx; j++)
+            for(k = three_color ? npx : j; k <= npx; k++)
+            {
+                // the first endpoint has a weight of alpha[n] in cluster n, and the second one 1 - alpha[n]
+                float n1 = TC__STATIC_CAST(float,j - i), n2 = TC__STATIC_CAST(float,k - j);
+                float sa = i + n1 * alpha[1] + n2 * alpha[2];
+                float aa = i + n1 * alpha[1] * alpha[1] + n2 * alpha[2] * alpha[2];
+                float ab = sa - aa, bb = npx - 2.0f * sa + aa;
+                float ax[3], bx[3];
+                for(c = 0; c < 3; c++)
+                {
+                    ax[c] = sums[i][c] + alpha[1] * (sums[j][c] - sums[i][c]) + alpha[2] * (sums[k][c] - sums[j][c]);
+                    bx[c] = sums[npx][c] - ax[c];
+                }
+                float det = aa * bb - ab * ab;
+                if(det < 1e-4f) continue;
+                float rdet = 1.0f / det;
+
+                float a[3], b[3], err = 0.0f;
+                for(c = 0; c < 3; c++)
+                {
+                    uint8_t qa, qb;
+                    tctex_i_bc1_snap(tctex_i_clampf((ax[c] * bb - bx[c] * ab) * rdet, 0.0f, 255.0f), bits[c], &qa);
+                    tctex_i_bc1_snap(tctex_i_clampf((bx[c] * aa - ax[c] * ab) * rdet, 0.0f, 255.0f), bits[c], &qb);
+                    a[c] = qa;
+                    b[c] = qb;
+                    // the error, without the (constant) sum of squared pixels
+                    err += a[c] * a[c] * aa + b[c] * b[c] * bb + 2.0f * (a[c] * b[c] * ab - a[c] * ax[c] - b[c] * bx[c]);
+                }
+                if(!found || err < besterr)
+                {
+                    found = true;
+                    besterr = err;
+                    memcpy(ca, a, sizeof(a));
+                    memcpy(cb, b, sizeof(b));
+                }
+            }
+    return found;
 }
-float tctex_util_float_from_half(uint16_t shalf)
+static void tctex_i_bc1_encode(uint8_t* bdata, const uint8_t px[16][4], int quality, int alphamode, tctex_i_fit_rgba_func* fit)
 {
-    // s=1,e=5,m=10
-    // seeeeemmmmmmmmmm
-    uint16_t s = shalf & 0x8000;
-    if(s) shalf = -shalf;
-    float f = ldexpf((shalf & 0x3FF) | 0x400, (int)((shalf >> 10) & 0x1F) - 15 - 10);
-    return s ? -f : f;
+    uint8_t opx[16][4];
+    size_t map[16], npx = 0, i, iter;
+    for(i = 0; i < 16; i++)
+        if(alphamode != TCTEX_I_BC1_ALPHA || px[i][3] >= 128)
+        {
+            memcpy(opx[npx], px[i], 4);
+            map[npx++] = i;
+        }
+    // padding, for the fit
+    for(i = npx; i < 16; i++)
+        memcpy(opx[i], opx[0], 4);
+
+    TCTex_BC1_Fit best;
+    best.err = UINT32_MAX;
+    best.c0 = best.c1 = 0x0000U;
+    memset(best.idx, 0, sizeof(best.idx));
+    if(npx)
+    {
+        bool transparent = npx < 16;
+        bool try4 = !transparent;
+        bool try3 = transparent || (alphamode == TCTEX_I_BC1_OPAQUE && quality >= TCTEX_QUALITY_SLOW);
+
+        float mean[4], axis[4], ca[4], cb[4];
+        tctex_i_pca(mean, axis, opx[0], npx, 3);
+        tctex_i_range_fit(ca, cb, opx[0], npx, mean, axis);
+        if(try4) tctex_i_bc1_try(&best, ca, cb, false, opx[0], npx, fit);
+        if(try3) tctex_i_bc1_try(&best, ca, cb, true, opx[0], npx, fit);
+
+        if(quality >= TCTEX_QUALITY_NORMAL && best.err)
+        {
+            size_t niters = quality >= TCTEX_QUALITY_SLOW ? 4 : 1;
+            int mode;
+            for(mode = 0; mode < 2; mode++)
+            {
+                if(!(mode ? try3 : try4)) continue;
+                float caxis[4];
+                memcpy(caxis, axis, sizeof(caxis));
+                // iterative cluster fit: each iteration re-sorts the pixels along the previous endpoints
+                for(iter = 0; iter < niters; iter++)
+                {
+                    if(!tctex_i_bc1_cluster_fit(ca, cb, opx[0], npx, caxis, mode)) break;
+                    tctex_i_bc1_try(&best, ca, cb, mode, opx[0], npx, fit);
+                    if(!best.err) break;
+                    caxis[0] = cb[0] - ca[0];
+                    caxis[1] = cb[1] - ca[1];
+                    caxis[2] = cb[2] - ca[2];
+                }
+            }
+        }
+    }
+    else
+        best.err = 0; // fully transparent; 0,0 is 3-color mode
+
+    uint8_t idx[16];
+    memset(idx, 3, sizeof(idx));
+    for(i = 0; i < npx; i++)
+        idx[map[i]] = best.idx[i];
+    bdata[0] = best.c0 & 0xFF;
+    bdata[1] = best.c0 >> 8;
+    bdata[2] = best.c1 & 0xFF;
+    bdata[3] = best.c1 >> 8;
+    for(i = 0; i < 4; i++)
+        bdata[4 + i] = idx[4 * i + 0] | (idx[4 * i + 1] << 2) | (idx[4 * i + 2] << 4) | (idx[4 * i + 3] << 6);
+}
+
+
+/* BC4 */
+static void tctex_i_bc4_encode(uint8_t* bdata, const uint8_t v[16], int quality, bool is_signed, tctex_i_fit_r8_func* fit)
+{
+    static const int windows[] = { 0, 2, 6 };
+    // signed values are biased, so that both the range & the distances work as unsigned
+    uint8_t bias = is_signed ? 0x80 : 0x00;
+    uint8_t u[16], idx[16], pal[8];
+    int lo = 0xFF, hi = 0x00, lo6 = 0xFF, hi6 = 0x00;
+    size_t i, k;
+    for(i = 0; i < 16; i++)
+    {
+        u[i] = v[i] ^ bias;
+        if(u[i] < lo) lo = u[i];
+        if(u[i] > hi) hi = u[i];
+        // 6-value mode has exact 0x00 & 0xFF, so those don't count towards its range
+        if(u[i] != 0x00 && u[i] < lo6) lo6 = u[i];
+        if(u[i] != 0xFF && u[i] > hi6) hi6 = u[i];
+    }
+    if(lo6 > hi6) lo6 = hi6 = lo;
+
+    int window = windows[tctex_i_clampi(quality, TCTEX_QUALITY_FAST, TCTEX_QUALITY_SLOW)];
+    uint32_t best = UINT32_MAX;
+    int s, t, mode;
+    for(s = 0; s <= window && best; s++)
+        for(t = 0; t <= window && best; t++)
+            for(mode = 0; mode < 2; mode++)
+            {
+                // 8-value mode wants a0 > a1, 6-value mode a0 <= a1; the palette takes care of the rest
+                uint8_t a0 = TC__STATIC_CAST(uint8_t,tctex_i_clampi(mode ? lo6 + s : hi - s, 0x00, 0xFF)) ^ bias;
+                uint8_t a1 = TC__STATIC_CAST(uint8_t,tctex_i_clampi(mode ? hi6 - t : lo + t, 0x00, 0xFF)) ^ bias;
+                tctex_i_bc4_get_palette(pal, a0, a1, is_signed);
+                for(k = 0; k < 8; k++)
+                    pal[k] ^= bias;
+                uint32_t err = fit(idx, u, pal, 8);
+                if(err < best)
+                {
+                    uint64_t bits = 0;
+                    for(i = 0; i < 16; i++)
+                        bits |= TC__STATIC_CAST(uint64_t,idx[i]) << (3 * i);
+                    best = err;
+                    bdata[0] = a0;
+                    bdata[1] = a1;
+                    for(i = 0; i < 6; i++)
+                        bdata[2 + i] = TC__STATIC_CAST(uint8_t,bits >> (8 * i));
+                }
+            }
+}
+
+
+/* BC7 */
+static uint8_t tctex_i_bc7_subset(uint8_t ns, uint8_t partition, size_t i)
+{
+    if(ns == 3) return (tctex_i_bc7_partitions3[partition] >> (2 * i)) & 3;
+    if(ns == 2) return (tctex_i_bc6h7_partitions2[partition] >> i) & 1;
+    return 0;
+}
+/* writes the low `num` bits of `value` */
+static void tctex_i_bc7_put(uint64_t bits[2], uint32_t* offset, uint32_t value, uint32_t num)
+{
+    value &= (UINT32_C(1) << num) - 1U;
+    if(*offset < 64)
+    {
+        bits[0] |= TC__STATIC_CAST(uint64_t,value) << *offset;
+        if(*offset + num > 64)
+            bits[1] |= TC__STATIC_CAST(uint64_t,value) >> (64 - *offset);
+    }
+    else
+        bits[1] |= TC__STATIC_CAST(uint64_t,value) << (*offset - 64);
+    *offset += num;
+}
+/* the `bits`-bit code (plus p-bit `p`, if `pbits`) closest to `v` once expanded */
+static uint8_t tctex_i_bc7_quantize(float v, uint8_t bits, uint8_t pbits, uint8_t p, uint8_t* expanded)
+{
+    uint8_t nbits = bits + pbits;
+    int cmax = (1 << bits) - 1;
+    int c = tctex_i_clampi(TC__STATIC_CAST(int,v * ((1 << nbits) - 1) / 255.0f + 0.5f) >> pbits, 0, cmax);
+    int d, best = c;
+    float besterr = 1e9f;
+    for(d = c > 0 ? c - 1 : c; d <= c + 1 && d <= cmax; d++)
+    {
+        uint8_t e = tctex_i_expandchannel8(TC__STATIC_CAST(uint8_t,(d << pbits) | p), nbits);
+        if(fabsf(e - v) < besterr)
+        {
+            besterr = fabsf(e - v);
+            best = d;
+            *expanded = e;
+        }
+    }
+    return TC__STATIC_CAST(uint8_t,best);
+}
+typedef struct TCTex_BC7_Subset
+{
+    uint8_t codes[2][4];    // endpoint codes (RGBA)
+    uint8_t p[2];           // p-bits of each endpoint
+    uint8_t cidx[16];       // color indices
+    uint8_t aidx[16];       // alpha indices (modes 4 & 5)
+} TCTex_BC7_Subset;
+/*
+ * Quantizes the endpoints (trying every p-bit combination), and picks the indices.
+ * `cib` and `aib` are the color & alpha index bits; if `aib` is 0, the alpha
+ * shares the color index. Returns the error.
+ */
+static uint32_t tctex_i_bc7_fit_subset(TCTex_BC7_Subset* sub, const float ea[4], const float eb[4], const uint8_t* px, size_t npx, const TCTex_BC7_ModeInfo* minfo, uint8_t cib, uint8_t aib, tctex_i_fit_rgba_func* fit)
+{
+    static const uint8_t mask_all[4] = { 0xFF, 0xFF, 0xFF, 0xFF };
+    static const uint8_t mask_rgb[4] = { 0xFF, 0xFF, 0xFF, 0x00 };
+    static const uint8_t mask_a[4] = { 0x00, 0x00, 0x00, 0xFF };
+    uint8_t MPB = minfo->EPB ? minfo->EPB : minfo->SPB;
+    uint8_t npbits = minfo->EPB ? 4 : minfo->SPB ? 2 : 1;
+    const uint8_t* cfactors = tctex_i_bc6h7_interp_factors[cib - 2];
+    const uint8_t* afactors = aib ? tctex_i_bc6h7_interp_factors[aib - 2] : NULL;
+    uint32_t best = UINT32_MAX;
+    uint8_t pcombo, e, c, k;
+    for(pcombo = 0; pcombo < npbits; pcombo++)
+    {
+        TCTex_BC7_Subset cand;
+        uint8_t ends[2][4], pal[16][4], apal[8][4] = {{0}};
+        cand.p[0] = pcombo & 1;
+        cand.p[1] = minfo->EPB ? pcombo >> 1 : cand.p[0];
+        for(e = 0; e < 2; e++)
+        {
+            const float* target = e ? eb : ea;
+            for(c = 0; c < 3; c++)
+                cand.codes[e][c] = tctex_i_bc7_quantize(target[c], minfo->CB, MPB, cand.p[e], &ends[e][c]);
+            if(minfo->AB)
+                cand.codes[e][3] = tctex_i_bc7_quantize(target[3], minfo->AB, MPB, cand.p[e], &ends[e][3]);
+            else
+            {
+                cand.codes[e][3] = 0;
+                ends[e][3] = 0xFF;
+            }
+        }
+        for(k = 0; k < (1 << cib); k++)
+            for(c = 0; c < 4; c++)
+                pal[k][c] = ((64 - cfactors[k]) * ends[0][c] + cfactors[k] * ends[1][c] + 32) >> 6;
+        uint32_t err = fit(cand.cidx, px, npx, pal[0], 1 << cib, aib ? mask_rgb : mask_all);
+        if(aib)
+        {
+            for(k = 0; k < (1 << aib); k++)
+                apal[k][3] = ((64 - afactors[k]) * ends[0][3] + afactors[k] * ends[1][3] + 32) >> 6;
+            err += fit(cand.aidx, px, npx, apal[0], 1 << aib, mask_a);
+        }
+        else
+            memcpy(cand.aidx, cand.cidx, sizeof(cand.aidx));
+        if(err < best)
+        {
+            best = err;
+            *sub = cand;
+        }
+    }
+    return best;
+}
+/* least-squares endpoints of channels [c0,c1) for the given indices; degenerate channels are left as-is */
+static void tctex_i_bc7_refine(float ea[4], float eb[4], const uint8_t* px, size_t npx, const uint8_t* idx, const uint8_t* factors, size_t c0, size_t c1)
+{
+    float aa = 0.0f, bb = 0.0f, ab = 0.0f, ax[4] = {0}, bx[4] = {0};
+    size_t i, c;
+    for(i = 0; i < npx; i++)
+    {
+        float wb = factors[idx[i]] / 64.0f, wa = 1.0f - wb;
+        aa += wa * wa;
+        bb += wb * wb;
+        ab += wa * wb;
+        for(c = c0; c < c1; c++)
+        {
+            ax[c] += wa * px[4 * i + c];
+            bx[c] += wb * px[4 * i + c];
+        }
+    }
+    float det = aa * bb - ab * ab;
+    if(det < 1e-4f) return;
+    for(c = c0; c < c1; c++)
+    {
+        ea[c] = tctex_i_clampf((ax[c] * bb - bx[c] * ab) / det, 0.0f, 255.0f);
+        eb[c] = tctex_i_clampf((bx[c] * aa - ax[c] * ab) / det, 0.0f, 255.0f);
+    }
+}
+/*
+ * Encodes the block in the given mode, partition, rotation & index selection,
+ * with `iterations` least-squares refinements of the endpoints. Returns the
+ * squared error of the decoded block.
+ */
+static uint32_t tctex_i_bc7_encode_mode(uint8_t* bdata, const uint8_t px[16][4], uint8_t mode, uint8_t partition, uint8_t rotation, uint8_t isel, size_t iterations, tctex_i_fit_rgba_func* fit)
+{
+    const TCTex_BC7_ModeInfo* minfo = &tctex_i_bc7_modeinfos[mode];
+    uint8_t cib = isel ? minfo->IB2 : minfo->IB;
+    uint8_t aib = minfo->IB2 ? (isel ? minfo->IB : minfo->IB2) : 0;
+    const uint8_t* cfactors = tctex_i_bc6h7_interp_factors[cib - 2];
+    const uint8_t* afactors = aib ? tctex_i_bc6h7_interp_factors[aib - 2] : NULL;
+
+    // rotated pixels: the decoder swaps alpha with R, G or B *after* interpolation
+    uint8_t rpx[16][4];
+    size_t i, c, s, iter;
+    for(i = 0; i < 16; i++)
+    {
+        memcpy(rpx[i], px[i], 4);
+        if(rotation)
+        {
+            rpx[i][3] = px[i][rotation - 1];
+            rpx[i][rotation - 1] = px[i][3];
+        }
+    }
+
+    uint8_t anchors[3] = { 0, 0, 0 };
+    if(minfo->NS == 3)
+    {
+        anchors[1] = tctex_i_bc7_partitions3_anchors[0][partition];
+        anchors[2] = tctex_i_bc7_partitions3_anchors[1][partition];
+    }
+    else if(minfo->NS == 2)
+        anchors[1] = tctex_i_bc6h7_partitions2_anchors[partition];
+
+    TCTex_BC7_Subset subs[3];
+    uint8_t cidx[16], aidx[16];
+    uint32_t total = 0;
+    for(s = 0; s < minfo->NS; s++)
+    {
+        uint8_t spx[16][4];
+        size_t map[16], npx = 0;
+        for(i = 0; i < 16; i++)
+            if(tctex_i_bc7_subset(minfo->NS, partition, i) == s)
+            {
+                memcpy(spx[npx], rpx[i], 4);
+                map[npx++] = i;
+            }
+        for(i = npx; i < 16; i++)
+            memcpy(spx[i], spx[0], 4);
+
+        // initial endpoints: alpha is fit on its own if it has its own indices
+        float mean[4], axis[4], ea[4], eb[4];
+        tctex_i_pca(mean, axis, spx[0], npx, aib || !minfo->AB ? 3 : 4);
+        tctex_i_range_fit(ea, eb, spx[0], npx, mean, axis);
+        if(aib)
+        {
+            ea[3] = 255.0f;
+            eb[3] = 0.0f;
+            for(i = 0; i < npx; i++)
+            {
+                if(spx[i][3] < ea[3]) ea[3] = spx[i][3];
+                if(spx[i][3] > eb[3]) eb[3] = spx[i][3];
+            }
+        }
+
+        uint32_t err = tctex_i_bc7_fit_subset(&subs[s], ea, eb, spx[0], npx, minfo, cib, aib, fit);
+        for(iter = 0; iter < iterations && err; iter++)
+        {
+            TCTex_BC7_Subset cand;
+            tctex_i_bc7_refine(ea, eb, spx[0], npx, subs[s].cidx, cfactors, 0, aib ? 3 : 4);
+            if(aib) tctex_i_bc7_refine(ea, eb, spx[0], npx, subs[s].aidx, afactors, 3, 4);
+            uint32_t cerr = tctex_i_bc7_fit_subset(&cand, ea, eb, spx[0], npx, minfo, cib, aib, fit);
+            if(cerr >= err) break;
+            err = cerr;
+            subs[s] = cand;
+        }
+        total += err;
+
+        // the anchor index has an implicit 0 MSB; if it's set, swap the endpoints & invert the indices
+        size_t ai = 0;
+        for(i = 0; i < npx; i++)
+            if(map[i] == anchors[s])
+                ai = i;
+        if(subs[s].cidx[ai] >> (cib - 1))
+        {
+            for(c = 0; c < (aib ? 3u : 4u); c++)
+            {
+                uint8_t t = subs[s].codes[0][c];
+                subs[s].codes[0][c] = subs[s].codes[1][c];
+                subs[s].codes[1][c] = t;
+            }
+            uint8_t t = subs[s].p[0];
+            subs[s].p[0] = subs[s].p[1];
+            subs[s].p[1] = t;
+            for(i = 0; i < npx; i++)
+                subs[s].cidx[i] = TC__STATIC_CAST(uint8_t,((1 << cib) - 1) - subs[s].cidx[i]);
+        }
+        if(aib && subs[s].aidx[ai] >> (aib - 1))
+        {
+            uint8_t t = subs[s].codes[0][3];
+            subs[s].codes[0][3] = subs[s].codes[1][3];
+            subs[s].codes[1][3] = t;
+            for(i = 0; i < npx; i++)
+                subs[s].aidx[i] = TC__STATIC_CAST(uint8_t,((1 << aib) - 1) - subs[s].aidx[i]);
+        }
+        for(i = 0; i < npx; i++)
+        {
+            cidx[map[i]] = subs[s].cidx[i];
+            aidx[map[i]] = subs[s].aidx[i];
+        }
+    }
+
+    // same layout as read by `tctex_decompress_bc7_block()`
+    uint64_t bits[2] = { 0, 0 };
+    uint32_t offset = 0;
+    size_t e;
+    tctex_i_bc7_put(bits, &offset, 1U << mode, mode + 1);
+    tctex_i_bc7_put(bits, &offset, partition, minfo->PB);
+    tctex_i_bc7_put(bits, &offset, rotation, minfo->RB);
+    tctex_i_bc7_put(bits, &offset, isel, minfo->ISB);
+    for(c = 0; c < 3; c++)
+        for(e = 0; e < 2u * minfo->NS; e++)
+            tctex_i_bc7_put(bits, &offset, subs[e / 2].codes[e % 2][c], minfo->CB);
+    for(e = 0; e < 2u * minfo->NS; e++)
+        tctex_i_bc7_put(bits, &offset, subs[e / 2].codes[e % 2][3], minfo->AB);
+    for(e = 0; e < 2u * minfo->NS; e++)
+        tctex_i_bc7_put(bits, &offset, subs[e / 2].p[e % 2], minfo->EPB);
+    for(s = 0; s < minfo->NS; s++)
+        tctex_i_bc7_put(bits, &offset, subs[s].p[0], minfo->SPB);
+    for(i = 0; i < 16; i++)
+    {
+        bool is_anchor = anchors[tctex_i_bc7_subset(minfo->NS, partition, i)] == i;
+        tctex_i_bc7_put(bits, &offset, isel ? aidx[i] : cidx[i], minfo->IB - is_anchor);
+    }
+    if(minfo->IB2)
+        for(i = 0; i < 16; i++)
+            tctex_i_bc7_put(bits, &offset, isel ? cidx[i] : aidx[i], minfo->IB2 - !i);
+    for(i = 0; i < 16; i++)
+        bdata[i] = TC__STATIC_CAST(uint8_t,bits[i / 8] >> (8 * (i % 8)));
+    return total;
+}
+/* the `nbest` partitions of `ns` subsets with the lowest PCA residual, best first */
+static void tctex_i_bc7_rank_partitions(uint8_t* best, size_t nbest, const uint8_t px[16][4], uint8_t ns, size_t npartitions, size_t nchan)
+{
+    float residuals[64];
+    size_t p, s, i, j;
+    for(p = 0; p < npartitions; p++)
+    {
+        residuals[p] = 0.0f;
+        for(s = 0; s < ns; s++)
+        {
+            uint8_t spx[16][4];
+            size_t npx = 0;
+            for(i = 0; i < 16; i++)
+                if(tctex_i_bc7_subset(ns, TC__STATIC_CAST(uint8_t,p), i) == s)
+                    memcpy(spx[npx++], px[i], 4);
+            float mean[4], axis[4];
+            residuals[p] += tctex_i_pca(mean, axis, spx[0], npx, nchan);
+        }
+        // insertion into the (sorted) list of the best ones
+        size_t n = p < nbest ? p : nbest;
+        for(j = n; j > 0 && residuals[best[j - 1]] > residuals[p]; j--)
+            if(j < nbest) best[j] = best[j - 1];
+        if(j < nbest) best[j] = TC__STATIC_CAST(uint8_t,p);
+    }
+}
+static void tctex_i_bc7_encode(uint8_t* bdata, const uint8_t px[16][4], int quality, tctex_i_fit_rgba_func* fit)
+{
+    bool opaque = true;
+    size_t i;
+    for(i = 0; i < 16; i++)
+        opaque &= px[i][3] == 0xFF;
+
+    bool slow = quality >= TCTEX_QUALITY_SLOW;
+    size_t iterations = slow ? 2 : 1;
+    size_t nparts = slow ? 8 : 4;
+    uint8_t parts2[8], parts3[8];
+    uint8_t tmp[16];
+    uint32_t best = tctex_i_bc7_encode_mode(bdata, px, 6, 0, 0, 0, iterations, fit);
+    if(quality <= TCTEX_QUALITY_FAST || !best)
+        return;
+
+    // mode, partition, rotation, index selection
+    uint8_t tries[64][4];
+    size_t ntries = 0, p, r;
+#define TCTEX_I_BC7_TRY(M,P,R,I)    do { tries[ntries][0] = (M); tries[ntries][1] = TC__STATIC_CAST(uint8_t,P); tries[ntries][2] = TC__STATIC_CAST(uint8_t,R); tries[ntries][3] = TC__STATIC_CAST(uint8_t,I); ntries++; } while(0)
+    tctex_i_bc7_rank_partitions(parts2, nparts, px, 2, 64, opaque ? 3 : 4);
+    if(!slow)
+    {
+        if(opaque)
+        {
+            for(p = 0; p < 4; p++) TCTEX_I_BC7_TRY(1, parts2[p], 0, 0);
+            for(p = 0; p < 2; p++) TCTEX_I_BC7_TRY(3, parts2[p], 0, 0);
+        }
+        else
+        {
+            TCTEX_I_BC7_TRY(5, 0, 0, 0);
+            for(p = 0; p < 4; p++) TCTEX_I_BC7_TRY(7, parts2[p], 0, 0);
+        }
+    }
+    else
+    {
+        if(opaque)
+        {
+            tctex_i_bc7_rank_partitions(parts3, nparts, px, 3, 16, 3);
+            for(p = 0; p < nparts; p++) TCTEX_I_BC7_TRY(0, parts3[p], 0, 0);
+            tctex_i_bc7_rank_partitions(parts3, nparts, px, 3, 64, 3);
+            for(p = 0; p < nparts; p++) TCTEX_I_BC7_TRY(2, parts3[p], 0, 0);
+            for(p = 0; p < nparts; p++) TCTEX_I_BC7_TRY(1, parts2[p], 0, 0);
+            for(p = 0; p < nparts; p++) TCTEX_I_BC7_TRY(3, parts2[p], 0, 0);
+        }
+        for(r = 0; r < 8; r++) TCTEX_I_BC7_TRY(4, 0, r >> 1, r & 1);
+        for(r = 0; r < 4; r++) TCTEX_I_BC7_TRY(5, 0, r, 0);
+        for(p = 0; p < nparts; p++) TCTEX_I_BC7_TRY(7, parts2[p], 0, 0);
+    }
+#undef TCTEX_I_BC7_TRY
+    for(i = 0; i < ntries && best; i++)
+    {
+        uint32_t err = tctex_i_bc7_encode_mode(tmp, px, tries[i][0], tries[i][1], tries[i][2], tries[i][3], iterations, fit);
+        if(err < best)
+        {
+            best = err;
+            memcpy(bdata, tmp, sizeof(tmp));
+        }
+    }
+}
+
+
+void tctex_compress_bc1_block(void* block, const void* src, size_t sstride_x, size_t spitch_y, int quality, bool use_alpha)
+{
+    static const uint8_t fill[4] = { 0x00, 0x00, 0x00, 0xFF };
+    uint8_t px[16][4];
+    tctex_i_load_block(px, TC__VOID_CAST(const uint8_t*,src), sstride_x, spitch_y, use_alpha ? 4 : 3, fill);
+    tctex_i_bc1_encode(TC__VOID_CAST(uint8_t*,block), px, quality, use_alpha ? TCTEX_I_BC1_ALPHA : TCTEX_I_BC1_OPAQUE, tctex_i_get_fit_rgba());
+}
+void tctex_compress_bc3_block(void* block, const void* src, size_t sstride_x, size_t spitch_y, int quality)
+{
+    static const uint8_t fill[4] = { 0x00, 0x00, 0x00, 0xFF };
+    uint8_t* bdata = TC__VOID_CAST(uint8_t*,block);
+    uint8_t px[16][4], alpha[16];
+    size_t i;
+    tctex_i_load_block(px, TC__VOID_CAST(const uint8_t*,src), sstride_x, spitch_y, 4, fill);
+    for(i = 0; i < 16; i++)
+        alpha[i] = px[i][3];
+    tctex_i_bc4_encode(bdata, alpha, quality, false, tctex_i_get_fit_r8());
+    tctex_i_bc1_encode(bdata + 8, px, quality, TCTEX_I_BC1_4COLOR, tctex_i_get_fit_rgba());
+}
+void tctex_compress_bc4_block(void* block, const void* src, size_t sstride_x, size_t spitch_y, int quality, bool is_signed)
+{
+    static const uint8_t fill[4] = { 0x00, 0x00, 0x00, 0x00 };
+    uint8_t px[16][4], v[16];
+    size_t i;
+    tctex_i_load_block(px, TC__VOID_CAST(const uint8_t*,src), sstride_x, spitch_y, 1, fill);
+    for(i = 0; i < 16; i++)
+        v[i] = px[i][0];
+    tctex_i_bc4_encode(TC__VOID_CAST(uint8_t*,block), v, quality, is_signed, tctex_i_get_fit_r8());
+}
+void tctex_compress_bc5_block(void* block, const void* src, size_t sstride_x, size_t spitch_y, int quality, bool is_signed)
+{
+    const uint8_t* sdata = TC__VOID_CAST(const uint8_t*,src);
+    uint8_t* bdata = TC__VOID_CAST(uint8_t*,block);
+    tctex_compress_bc4_block(bdata + 0, sdata + 0, sstride_x, spitch_y, quality, is_signed);
+    tctex_compress_bc4_block(bdata + 8, sdata + 1, sstride_x, spitch_y, quality, is_signed);
+}
+void tctex_compress_bc7_block(void* block, const void* src, size_t sstride_x, size_t spitch_y, int quality)
+{
+    static const uint8_t fill[4] = { 0x00, 0x00, 0x00, 0xFF };
+    uint8_t px[16][4];
+    tctex_i_load_block(px, TC__VOID_CAST(const uint8_t*,src), sstride_x, spitch_y, 4, fill);
+    tctex_i_bc7_encode(TC__VOID_CAST(uint8_t*,block), px, quality, tctex_i_get_fit_rgba());
+}
+
+void tctex_compress_bc1(void* dst, const void* src, size_t sstride_x, size_t spitch_y, size_t w, size_t h, int quality, bool use_alpha)
+{
+    uint8_t* bdata = TC__VOID_CAST(uint8_t*,dst);
+    const uint8_t* sdata = TC__VOID_CAST(const uint8_t*,src);
+
+    size_t y;
+    for(y = 0; y < h; y += 4)
+    {
+        size_t x;
+        for(x = 0; x < w; x += 4)
+        {
+            tctex_compress_bc1_block(bdata, &sdata[y * spitch_y + x * sstride_x], sstride_x, spitch_y, quality, use_alpha);
+            bdata += 8;
+        }
+    }
+}
+void tctex_compress_bc3(void* dst, const void* src, size_t sstride_x, size_t spitch_y, size_t w, size_t h, int quality)
+{
+    uint8_t* bdata = TC__VOID_CAST(uint8_t*,dst);
+    const uint8_t* sdata = TC__VOID_CAST(const uint8_t*,src);
+
+    size_t y;
+    for(y = 0; y < h; y += 4)
+    {
+        size_t x;
+        for(x = 0; x < w; x += 4)
+        {
+            tctex_compress_bc3_block(bdata, &sdata[y * spitch_y + x * sstride_x], sstride_x, spitch_y, quality);
+            bdata += 16;
+        }
+    }
+}
+void tctex_compress_bc4(void* dst, const void* src, size_t sstride_x, size_t spitch_y, size_t w, size_t h, int quality, bool is_signed)
+{
+    uint8_t* bdata = TC__VOID_CAST(uint8_t*,dst);
+    const uint8_t* sdata = TC__VOID_CAST(const uint8_t*,src);
+
+    size_t y;
+    for(y = 0; y < h; y += 4)
+    {
+        size_t x;
+        for(x = 0; x < w; x += 4)
+        {
+            tctex_compress_bc4_block(bdata, &sdata[y * spitch_y + x * sstride_x], sstride_x, spitch_y, quality, is_signed);
+            bdata += 8;
+        }
+    }
+}
+void tctex_compress_bc5(void* dst, const void* src, size_t sstride_x, size_t spitch_y, size_t w, size_t h, int quality, bool is_signed)
+{
+    uint8_t* bdata = TC__VOID_CAST(uint8_t*,dst);
+    const uint8_t* sdata = TC__VOID_CAST(const uint8_t*,src);
+
+    size_t y;
+    for(y = 0; y < h; y += 4)
+    {
+        size_t x;
+        for(x = 0; x < w; x += 4)
+        {
+            tctex_compress_bc5_block(bdata, &sdata[y * spitch_y + x * sstride_x], sstride_x, spitch_y, quality, is_signed);
+            bdata += 16;
+        }
+    }
+}
+void tctex_compress_bc7(void* dst, const void* src, size_t sstride_x, size_t spitch_y, size_t w, size_t h, int quality)
+{
+    uint8_t* bdata = TC__VOID_CAST(uint8_t*,dst);
+    const uint8_t* sdata = TC__VOID_CAST(const uint8_t*,src);
+
+    size_t y;
+    for(y = 0; y < h; y += 4)
+    {
+        size_t x;
+        for(x = 0; x < w; x += 4)
+        {
+            tctex_compress_bc7_block(bdata, &sdata[y * spitch_y + x * sstride_x], sstride_x, spitch_y, quality);
+            bdata += 16;
+        }
+    }
+}
+
+
+/* sRGB (ARB_framebuffer_sRGB) decoded values of each code, and the linear values
+ * of the midpoints between codes (`i - 0.5`; the first entry is unused) */
+static const float tctex_i_srgb_to_linear[256] = {
+    0.0f, 0.000303526991f, 0.000607053982f, 0.000910580973f, 0.00121410796f, 0.00151763496f, 0.00182116195f, 0.00212468882f,
+    0.00242821593f, 0.0027317428f, 0.00303526991f, 0.00334653584f, 0.00367650739f, 0.00402471703f, 0.00439144205f, 0.00477695325f,
+    0.00518151652f, 0.00560539169f, 0.00604883302f, 0.00651209056f, 0.00699541019f, 0.00749903219f, 0.00802319311f, 0.00856812578f,
+    0.00913405884f, 0.00972121768f, 0.010329823f, 0.0109600937f, 0.0116122449f, 0.012286488f, 0.0129830325f, 0.0137020834f,
+    0.0144438436f, 0.0152085144f, 0.0159962941f, 0.0168073755f, 0.0176419541f, 0.01850022f, 0.0193823613f, 0.0202885624f,
+    0.0212190095f, 0.0221738853f, 0.0231533665f, 0.0241576321f, 0.0251868591f, 0.0262412224f, 0.0273208916f, 0.02842604f,
+    0.0295568351f, 0.0307134446f, 0.0318960324f, 0.0331047662f, 0.0343398079f, 0.0356013142f, 0.0368894488f, 0.0382043719f,
+    0.0395462364f, 0.0409151986f, 0.0423114114f, 0.043735031f, 0.045186203f, 0.0466650873f, 0.0481718257f, 0.0497065671f,
+    0.0512694567f, 0.0528606474f, 0.054480277f, 0.0561284907f, 0.0578054301f, 0.0595112368f, 0.0612460524f, 0.0630100146f,
+    0.064803265f, 0.0666259378f, 0.0684781671f, 0.0703600943f, 0.0722718537f, 0.0742135718f, 0.0761853829f, 0.078187421f,
+    0.0802198201f, 0.0822827071f, 0.0843762085f, 0.0865004584f, 0.0886555836f, 0.0908417106f, 0.0930589661f, 0.0953074694f,
+    0.097587347f, 0.0998987257f, 0.102241732f, 0.104616486f, 0.107023105f, 0.10946171f, 0.111932427f, 0.114435375f,
+    0.116970666f, 0.119538426f, 0.122138776f, 0.124771819f, 0.127437681f, 0.130136475f, 0.13286832f, 0.135633335f,
+    0.138431609f, 0.141263291f, 0.144128472f, 0.147027269f, 0.149959788f, 0.152926147f, 0.155926466f, 0.158960834f,
+    0.162029371f, 0.165132195f, 0.168269396f, 0.171441108f, 0.174647406f, 0.177888423f, 0.18116425f, 0.18447499f,
+    0.187820777f, 0.191201687f, 0.194617838f, 0.198069319f, 0.20155625f, 0.205078736f, 0.208636865f, 0.212230757f,
+    0.215860501f, 0.219526201f, 0.223227963f, 0.226965874f, 0.230740055f, 0.23455058f, 0.238397568f, 0.242281124f,
+    0.246201321f, 0.25015828f, 0.254152089f, 0.258182853f, 0.262250662f, 0.266355604f, 0.270497799f, 0.274677306f,
+    0.278894275f, 0.283148736f, 0.287440836f, 0.291770637f, 0.296138257f, 0.300543785f, 0.304987311f, 0.309468925f,
+    0.313988715f, 0.318546772f, 0.323143214f, 0.327778101f, 0.332451522f, 0.337163627f, 0.341914415f, 0.346704066f,
+    0.351532608f, 0.356400132f, 0.361306787f, 0.366252601f, 0.371237695f, 0.376262128f, 0.38132602f, 0.386429429f,
+    0.391572475f, 0.396755219f, 0.401977777f, 0.407240212f, 0.412542611f, 0.417885065f, 0.423267663f, 0.428690493f,
+    0.434153646f, 0.439657182f, 0.445201188f, 0.450785786f, 0.456411034f, 0.462076992f, 0.467783809f, 0.473531485f,
+    0.479320168f, 0.48514995f, 0.491020858f, 0.496932983f, 0.502886474f, 0.50888133f, 0.514917672f, 0.520995557f,
+    0.527115107f, 0.533276379f, 0.539479494f, 0.545724452f, 0.55201143f, 0.558340371f, 0.564711511f, 0.571124852f,
+    0.577580452f, 0.584078431f, 0.590618849f, 0.597201765f, 0.603827357f, 0.610495567f, 0.617206573f, 0.623960376f,
+    0.630757153f, 0.637596846f, 0.644479692f, 0.651405632f, 0.658374846f, 0.665387273f, 0.672443151f, 0.679542482f,
+    0.686685324f, 0.693871737f, 0.701101899f, 0.708375752f, 0.715693474f, 0.723055124f, 0.730460763f, 0.73791039f,
+    0.745404184f, 0.752942204f, 0.760524511f, 0.768151164f, 0.775822222f, 0.783537805f, 0.791297913f, 0.799102724f,
+    0.806952238f, 0.814846575f, 0.822785735f, 0.830769897f, 0.838799f, 0.846873224f, 0.854992628f, 0.863157213f,
+    0.871367097f, 0.8796224f, 0.887923121f, 0.896269381f, 0.904661179f, 0.913098633f, 0.921581864f, 0.930110872f,
+    0.938685715f, 0.947306514f, 0.955973327f, 0.964686275f, 0.973445296f, 0.982250571f, 0.991102099f, 1.0f,
+};
+static const float tctex_i_srgb_thresholds[256] = {
+    0.0f, 0.000151763496f, 0.000455290487f, 0.000758817478f, 0.00106234441f, 0.0013658714f, 0.00166939839f, 0.00197292538f,
+    0.00227645249f, 0.00257997937f, 0.00288350624f, 0.00318830088f, 0.00350925932f, 0.00384831498f, 0.00420574797f, 0.00458183279f,
+    0.00497683743f, 0.00539102405f, 0.00582465064f, 0.00627796957f, 0.00675122766f, 0.00724466844f, 0.00775853032f, 0.00829304848f,
+    0.00884845294f, 0.00942497049f, 0.0100228256f, 0.010642237f, 0.011283421f, 0.0119465925f, 0.0126319602f, 0.0133397318f,
+    0.0140701123f, 0.0148233026f, 0.0155995032f, 0.0163989104f, 0.0172217153f, 0.0180681143f, 0.0189382937f, 0.0198324434f,
+    0.0207507443f, 0.0216933824f, 0.0226605386f, 0.0236523896f, 0.0246691145f, 0.0257108882f, 0.0267778821f, 0.0278702695f,
+    0.0289882198f, 0.0301319025f, 0.0313014798f, 0.0324971229f, 0.0337189883f, 0.0349672437f, 0.0362420455f, 0.0375435539f,
+    0.0388719253f, 0.04022732f, 0.041609887f, 0.0430197865f, 0.0444571637f, 0.0459221713f, 0.0474149622f, 0.0489356853f,
+    0.0504844859f, 0.0520615056f, 0.0536668971f, 0.055300802f, 0.0569633618f, 0.0586547181f, 0.0603750125f, 0.0621243827f,
+    0.0639029741f, 0.0657109171f, 0.0675483495f, 0.0694154128f, 0.0713122338f, 0.0732389539f, 0.0751957074f, 0.0771826133f,
+    0.0791998208f, 0.0812474415f, 0.0833256245f, 0.085434489f, 0.0875741541f, 0.089744769f, 0.091946438f, 0.0941793025f,
+    0.0964434743f, 0.098739095f, 0.101066269f, 0.10342513f, 0.105815805f, 0.108238399f, 0.110693045f, 0.113179862f,
+    0.115698971f, 0.118250482f, 0.120834522f, 0.123451203f, 0.126100644f, 0.128782958f, 0.131498262f, 0.134246677f,
+    0.137028307f, 0.13984327f, 0.142691687f, 0.145573661f, 0.148489311f, 0.151438728f, 0.15442206f, 0.157439381f,
+    0.160490826f, 0.163576499f, 0.166696489f, 0.169850931f, 0.173039913f, 0.176263571f, 0.179521978f, 0.182815254f,
+    0.186143503f, 0.189506829f, 0.192905352f, 0.196339145f, 0.199808344f, 0.203313038f, 0.206853345f, 0.210429341f,
+    0.214041144f, 0.217688844f, 0.22137256f, 0.225092396f, 0.228848428f, 0.232640758f, 0.236469507f, 0.240334779f,
+    0.244236633f, 0.248175204f, 0.252150565f, 0.256162852f, 0.260212123f, 0.264298469f, 0.268422037f, 0.272582889f,
+    0.276781112f, 0.281016797f, 0.285290092f, 0.289601028f, 0.293949723f, 0.298336297f, 0.30276081f, 0.30722335f,
+    0.311724037f, 0.31626296f, 0.32084018f, 0.325455844f, 0.330109984f, 0.334802747f, 0.339534163f, 0.344304383f,
+    0.349113464f, 0.353961498f, 0.358848572f, 0.363774776f, 0.368740231f, 0.373744965f, 0.378789127f, 0.383872777f,
+    0.388996005f, 0.3941589f, 0.399361521f, 0.404604018f, 0.40988642f, 0.415208817f, 0.420571357f, 0.425974041f,
+    0.431417018f, 0.436900347f, 0.442424119f, 0.447988421f, 0.453593314f, 0.459238917f, 0.464925289f, 0.470652521f,
+    0.476420701f, 0.482229918f, 0.488080233f, 0.493971765f, 0.499904543f, 0.505878687f, 0.511894286f, 0.517951429f,
+    0.524050117f, 0.530190527f, 0.536372721f, 0.542596757f, 0.548862696f, 0.555170655f, 0.561520696f, 0.567912877f,
+    0.574347317f, 0.580824137f, 0.587343335f, 0.593904972f, 0.600509226f, 0.607156098f, 0.613845706f, 0.62057811f,
+    0.62735337f, 0.634171605f, 0.641032875f, 0.647937238f, 0.654884815f, 0.661875665f, 0.668909788f, 0.675987363f,
+    0.683108449f, 0.690273106f, 0.697481334f, 0.704733372f, 0.712029159f, 0.719368815f, 0.72675246f, 0.734180033f,
+    0.741651773f, 0.749167681f, 0.756727815f, 0.764332294f, 0.77198112f, 0.779674411f, 0.787412286f, 0.795194745f,
+    0.803021908f, 0.810893834f, 0.818810523f, 0.826772213f, 0.834778786f, 0.842830479f, 0.850927293f, 0.859069228f,
+    0.867256522f, 0.875489056f, 0.883767068f, 0.892090559f, 0.900459588f, 0.908874214f, 0.917334557f, 0.925840616f,
+    0.934392571f, 0.942990363f, 0.951634169f, 0.960324049f, 0.969060004f, 0.977842152f, 0.986670554f, 0.995545268f,
+};
+
+float tctex_util_linear_from_srgb(uint8_t srgb)
+{
+    return tctex_i_srgb_to_linear[srgb];
+}
+uint8_t tctex_util_srgb_from_linear(float linear)
+{
+    // binary search for the last midpoint <= linear (NaN ends up as 0)
+    unsigned int i = 0;
+    if(linear >= tctex_i_srgb_thresholds[i + 128]) i += 128;
+    if(linear >= tctex_i_srgb_thresholds[i + 64]) i += 64;
+    if(linear >= tctex_i_srgb_thresholds[i + 32]) i += 32;
+    if(linear >= tctex_i_srgb_thresholds[i + 16]) i += 16;
+    if(linear >= tctex_i_srgb_thresholds[i + 8]) i += 8;
+    if(linear >= tctex_i_srgb_thresholds[i + 4]) i += 4;
+    if(linear >= tctex_i_srgb_thresholds[i + 2]) i += 2;
+    if(linear >= tctex_i_srgb_thresholds[i + 1]) i += 1;
+    return TC__STATIC_CAST(uint8_t,i);
+}
+void tctex_util_linear_from_srgb_n(float* dst, const uint8_t* src, size_t n)
+{
+    size_t i;
+    for(i = 0; i < n; i++)
+        dst[i] = tctex_i_srgb_to_linear[src[i]];
+}
+void tctex_util_srgb_from_linear_n(uint8_t* dst, const float* src, size_t n)
+{
+    size_t i;
+    for(i = 0; i < n; i++)
+        dst[i] = tctex_util_srgb_from_linear(src[i]);
+}
+
+// source: https://gist.github.com/rygorous/2156668 (`half_to_float` & `float_to_half_fast3_rtne`)
+typedef union TCTex_I_F32
+{
+    uint32_t u;
+    float f;
+} TCTex_I_F32;
+float tctex_util_float_from_half(uint16_t half)
+{
+    // s=1,e=5,m=10
+    // seeeeemmmmmmmmmm
+    static const TCTex_I_F32 magic = { UINT32_C(113) << 23 };
+    TCTex_I_F32 o;
+    o.u = TC__STATIC_CAST(uint32_t,half & 0x7FFF) << 13; // exponent/mantissa bits
+    uint32_t exp = o.u & (UINT32_C(0x7C00) << 13);
+    o.u += (UINT32_C(127) - 15) << 23; // exponent adjust
+    if(exp == (UINT32_C(0x7C00) << 13)) // inf/NaN (NaNs are quieted, as by the hardware)
+    {
+        o.u += (UINT32_C(128) - 16) << 23;
+        if(half & 0x3FF) o.u |= UINT32_C(0x400000);
+    }
+    else if(!exp) // zero/subnormal: renormalize
+    {
+        o.u += UINT32_C(1) << 23;
+        o.f -= magic.f;
+    }
+    o.u |= TC__STATIC_CAST(uint32_t,half & 0x8000) << 16;
+    return o.f;
+}
+uint16_t tctex_util_half_from_float(float f)
+{
+    static const TCTex_I_F32 denorm_magic = { (UINT32_C(127) - 15 + 23 - 10 + 1) << 23 };
+    TCTex_I_F32 v;
+    v.f = f;
+    uint32_t sign = v.u & UINT32_C(0x80000000);
+    v.u ^= sign;
+
+    uint16_t o;
+    if(v.u >= UINT32_C(143) << 23) // overflow (=> inf), inf or NaN (=> quiet NaN, with the top of the payload)
+        o = v.u > UINT32_C(0x7F800000) ? TC__STATIC_CAST(uint16_t,0x7E00 | ((v.u >> 13) & 0x3FF)) : 0x7C00;
+    else if(v.u < UINT32_C(113) << 23) // subnormal or zero: let the FPU do the rounding
+    {
+        v.f += denorm_magic.f;
+        o = TC__STATIC_CAST(uint16_t,v.u - denorm_magic.u);
+    }
+    else
+    {
+        uint32_t mant_odd = (v.u >> 13) & 1; // resulting mantissa is odd
+        v.u += ((UINT32_C(15) - 127) << 23) + 0xFFF; // exponent adjust & rounding bias
+        v.u += mant_odd;
+        o = TC__STATIC_CAST(uint16_t,v.u >> 13);
+    }
+    return TC__STATIC_CAST(uint16_t,o | (sign >> 16));
+}
+
+#if defined(TCTEX_I_ACCEL_X86)
+TCTEX_I_TARGET_X86("avx,f16c") static size_t tctex_i_float_from_half_f16c(float* dst, const uint16_t* src, size_t n)
+{
+    size_t i;
+    for(i = 0; i + 8 <= n; i += 8)
+        _mm256_storeu_ps(&dst[i], _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*)&src[i])));
+    return i;
+}
+TCTEX_I_TARGET_X86("avx,f16c") static size_t tctex_i_half_from_float_f16c(uint16_t* dst, const float* src, size_t n)
+{
+    size_t i;
+    for(i = 0; i + 8 <= n; i += 8)
+        _mm_storeu_si128((__m128i*)&dst[i], _mm256_cvtps_ph(_mm256_loadu_ps(&src[i]), 0 /* nearest-even */));
+    return i;
+}
+#elif defined(TCTEX_I_ACCEL_ARM)
+static size_t tctex_i_float_from_half_neon(float* dst, const uint16_t* src, size_t n)
+{
+    size_t i;
+    for(i = 0; i + 4 <= n; i += 4)
+        vst1q_f32(&dst[i], vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(&src[i]))));
+    return i;
+}
+static size_t tctex_i_half_from_float_neon(uint16_t* dst, const float* src, size_t n)
+{
+    size_t i;
+    for(i = 0; i + 4 <= n; i += 4)
+        vst1_u16(&dst[i], vreinterpret_u16_f16(vcvt_f16_f32(vld1q_f32(&src[i]))));
+    return i;
+}
+#endif
+void tctex_util_float_from_half_n(float* dst, const uint16_t* src, size_t n)
+{
+    size_t i = 0;
+#if defined(TCTEX_I_ACCEL_X86)
+    if(tctex_accel_get() & TCTEX_ACCEL_X86_F16C) i = tctex_i_float_from_half_f16c(dst, src, n);
+#elif defined(TCTEX_I_ACCEL_ARM)
+    if(tctex_accel_get() & TCTEX_ACCEL_ARM_NEON) i = tctex_i_float_from_half_neon(dst, src, n);
+#endif
+    for(; i < n; i++)
+        dst[i] = tctex_util_float_from_half(src[i]);
+}
+void tctex_util_half_from_float_n(uint16_t* dst, const float* src, size_t n)
+{
+    size_t i = 0;
+#if defined(TCTEX_I_ACCEL_X86)
+    if(tctex_accel_get() & TCTEX_ACCEL_X86_F16C) i = tctex_i_half_from_float_f16c(dst, src, n);
+#elif defined(TCTEX_I_ACCEL_ARM)
+    if(tctex_accel_get() & TCTEX_ACCEL_ARM_NEON) i = tctex_i_half_from_float_neon(dst, src, n);
+#endif
+    for(; i < n; i++)
+        dst[i] = tctex_util_half_from_float(src[i]);
+}
+
+uint32_t tctex_mipmap_count(size_t w, size_t h)
+{
+    uint32_t n = 1;
+    while(w > 1 || h > 1)
+    {
+        w >>= 1;
+        h >>= 1;
+        n++;
+    }
+    return n;
+}
+size_t tctex_mipmap_chain_size(size_t w, size_t h, size_t nchan, uint32_t nlevels)
+{
+    size_t size = 0;
+    uint32_t i;
+    if(!nlevels) nlevels = tctex_mipmap_count(w, h);
+    for(i = 0; i < nlevels; i++)
+    {
+        size += w * h * nchan;
+        w = w > 1 ? w >> 1 : 1;
+        h = h > 1 ? h >> 1 : 1;
+    }
+    return size;
+}
+
+static float tctex_i_sinc(float x)
+{
+    if(fabsf(x) < 1e-6f) return 1.0f;
+    x *= 3.14159265358979f;
+    return sinf(x) / x;
+}
+// modified Bessel function of the first kind (order 0), for the Kaiser window
+static float tctex_i_bessel_i0(float x)
+{
+    float sum = 1.0f, term = 1.0f;
+    int k;
+    for(k = 1; k < 32 && term > sum * 1e-8f; k++)
+    {
+        term *= (x * x) / (4.0f * k * k);
+        sum += term;
+    }
+    return sum;
+}
+static float tctex_i_mip_filter_support(TCTex_MipFilter filter)
+{
+    return filter == TCTEX_MIP_FILTER_BOX ? 0.5f : 3.0f;
+}
+static float tctex_i_mip_filter(TCTex_MipFilter filter, float x)
+{
+    x = fabsf(x);
+    switch(filter)
+    {
+    case TCTEX_MIP_FILTER_BOX:
+        return x < 0.5f ? 1.0f : x == 0.5f ? 0.5f : 0.0f;
+    case TCTEX_MIP_FILTER_KAISER:
+        if(x >= 3.0f) return 0.0f;
+        return tctex_i_sinc(x) * tctex_i_bessel_i0(4.0f * sqrtf(1.0f - x * x / 9.0f)) / tctex_i_bessel_i0(4.0f);
+    case TCTEX_MIP_FILTER_LANCZOS3:
+        return x < 3.0f ? tctex_i_sinc(x) * tctex_i_sinc(x / 3.0f) : 0.0f;
+    }
+    return 0.0f;
+}
+
+/* the (normalized) filter taps for each destination pixel along one axis, with edges clamped */
+typedef struct TCTex_I_MipTaps
+{
+    size_t ntaps;
+    uint32_t* idx;
+    float* weights;
+} TCTex_I_MipTaps;
+static bool tctex_i_mip_taps(TCTex_I_MipTaps* taps, size_t slen, size_t dlen, TCTex_MipFilter filter)
+{
+    float ratio = TC__STATIC_CAST(float,slen) / dlen;
+    float radius = tctex_i_mip_filter_support(filter) * ratio;
+    taps->ntaps = TC__STATIC_CAST(size_t,ceilf(2.0f * radius)) + 1;
+    taps->idx = TC__VOID_CAST(uint32_t*,TC_MALLOC(dlen * taps->ntaps * sizeof(*taps->idx)));
+    taps->weights = TC__VOID_CAST(float*,TC_MALLOC(dlen * taps->ntaps * sizeof(*taps->weights)));
+    if(!taps->idx || !taps->weights) return false;
+
+    size_t i, t;
+    for(i = 0; i < dlen; i++)
+    {
+        float center = (i + 0.5f) * ratio;
+        long first = TC__STATIC_CAST(long,floorf(center - radius));
+        uint32_t* idx = &taps->idx[i * taps->ntaps];
+        float* weights = &taps->weights[i * taps->ntaps];
+        float sum = 0.0f;
+        for(t = 0; t < taps->ntaps; t++)
+        {
+            long j = first + TC__STATIC_CAST(long,t);
+            weights[t] = tctex_i_mip_filter(filter, (j + 0.5f - center) / ratio);
+            idx[t] = TC__STATIC_CAST(uint32_t,j < 0 ? 0 : TC__STATIC_CAST(size_t,j) >= slen ? slen - 1 : TC__STATIC_CAST(size_t,j));
+            sum += weights[t];
+        }
+        for(t = 0; t < taps->ntaps; t++)
+            weights[t] /= sum;
+    }
+    return true;
+}
+static void tctex_i_mip_taps_free(TCTex_I_MipTaps* taps)
+{
+    TC_FREE(taps->idx);
+    TC_FREE(taps->weights);
+}
+
+/* rows are filtered in chunks of destination pixels; the source span of a
+ * chunk is at most `CHUNK * 3 + 2 * 9 + 3` pixels (each level is at most 3x
+ * smaller, with a filter radius of up to 3), so that it fits on the stack */
+#define TCTEX_I_MIP_CHUNK   64
+#define TCTEX_I_MIP_BUFLEN  (4 * (TCTEX_I_MIP_CHUNK * 3 + 2 * 9 + 3))
+typedef struct TCTex_I_MipLevel
+{
+    uint8_t* dst;
+    const uint8_t* src;
+    size_t sw, dw;
+    size_t nchan;
+    TCTex_I_MipTaps htaps, vtaps;
+    const float* lut[4];
+    bool srgb[4];
+} TCTex_I_MipLevel;
+static void tctex_i_mip_rows(size_t begin, size_t end, void* udata)
+{
+    const TCTex_I_MipLevel* level = TC__VOID_CAST(const TCTex_I_MipLevel*,udata);
+    const TCTex_I_MipTaps* htaps = &level->htaps;
+    const TCTex_I_MipTaps* vtaps = &level->vtaps;
+    size_t nchan = level->nchan;
+    float buf[TCTEX_I_MIP_BUFLEN];
+
+    size_t y, x0, x, c, t, k;
+    for(y = begin; y < end; y++)
+    {
+        uint8_t* drow = &level->dst[y * level->dw * nchan];
+        for(x0 = 0; x0 < level->dw; x0 += TCTEX_I_MIP_CHUNK)
+        {
+            size_t x1 = x0 + TCTEX_I_MIP_CHUNK < level->dw ? x0 + TCTEX_I_MIP_CHUNK : level->dw;
+            size_t s0 = htaps->idx[x0 * htaps->ntaps];
+            size_t s1 = htaps->idx[(x1 - 1) * htaps->ntaps + htaps->ntaps - 1] + 1;
+
+            // vertical pass (into linear floats) over the source span ...
+            memset(buf, 0, (s1 - s0) * nchan * sizeof(*buf));
+            for(t = 0; t < vtaps->ntaps; t++)
+            {
+                float w = vtaps->weights[y * vtaps->ntaps + t];
+                if(w == 0.0f) continue;
+                const uint8_t* srow = &level->src[(vtaps->idx[y * vtaps->ntaps + t] * level->sw + s0) * nchan];
+                for(k = 0; k < (s1 - s0) * nchan; k += nchan)
+                    for(c = 0; c < nchan; c++)
+                        buf[k + c] += w * level->lut[c][srow[k + c]];
+            }
+            // ... then horizontal, back to 8 bits
+            for(x = x0; x < x1; x++)
+            {
+                const uint32_t* idx = &htaps->idx[x * htaps->ntaps];
+                const float* weights = &htaps->weights[x * htaps->ntaps];
+                for(c = 0; c < nchan; c++)
+                {
+                    float sum = 0.0f;
+                    for(t = 0; t < htaps->ntaps; t++)
+                        sum += weights[t] * buf[(idx[t] - s0) * nchan + c];
+                    if(level->srgb[c])
+                        drow[x * nchan + c] = tctex_util_srgb_from_linear(sum);
+                    else
+                    {
+                        sum = sum * 255.0f + 0.5f;
+                        drow[x * nchan + c] = sum <= 0.0f ? 0 : sum >= 255.0f ? 255 : TC__STATIC_CAST(uint8_t,sum);
+                    }
+                }
+            }
+        }
+    }
+}
+
+/* the number of pixels that pass the alpha test, with alpha scaled by `scale` */
+static size_t tctex_i_alpha_coverage(const size_t hist[256], float scale, float ref)
+{
+    size_t count = 0;
+    unsigned int a;
+    for(a = 0; a < 256; a++)
+        if(a * scale + 0.5f >= ref)
+            count += hist[a];
+    return count;
+}
+static void tctex_i_mip_preserve_coverage(uint8_t* pixels, size_t npixels, float ref, double target)
+{
+    size_t hist[256] = {0};
+    size_t i;
+    for(i = 0; i < npixels; i++)
+        hist[pixels[i * 4 + 3]]++;
+
+    // binary search for the scale that gets the closest to the target coverage (which increases with the scale)
+    float lo = 0.0f, hi = 256.0f, best = 1.0f;
+    double besterr = fabs(tctex_i_alpha_coverage(hist, 1.0f, ref) / TC__STATIC_CAST(double,npixels) - target);
+    int iter;
+    for(iter = 0; iter < 24 && besterr > 0.0; iter++)
+    {
+        float mid = 0.5f * (lo + hi);
+        double coverage = tctex_i_alpha_coverage(hist, mid, ref) / TC__STATIC_CAST(double,npixels);
+        if(fabs(coverage - target) < besterr)
+        {
+            besterr = fabs(coverage - target);
+            best = mid;
+        }
+        if(coverage < target) lo = mid;
+        else hi = mid;
+    }
+    if(best == 1.0f) return;
+    for(i = 0; i < npixels; i++)
+    {
+        float a = pixels[i * 4 + 3] * best + 0.5f;
+        pixels[i * 4 + 3] = a >= 255.0f ? 255 : TC__STATIC_CAST(uint8_t,a);
+    }
+}
+
+/* runs `func` over the `[0,nrows)` rows (of `rowsize` bytes each), either serially or on a thread pool */
+typedef void tctex_i_mip_run_func(void* ctx, size_t nrows, size_t rowsize, void (*func)(size_t begin, size_t end, void* udata), void* udata);
+static void tctex_i_mip_run_serial(void* ctx, size_t nrows, size_t rowsize, void (*func)(size_t begin, size_t end, void* udata), void* udata)
+{
+    (void)ctx;
+    (void)rowsize;
+    func(0, nrows, udata);
+}
+static bool tctex_i_generate_mipmaps(void* dst, const void* src, size_t spitch_y, size_t w, size_t h, size_t nchan, uint32_t nlevels, TCTex_MipFilter filter, unsigned int flags, float alpha_ref, tctex_i_mip_run_func* run, void* runctx)
+{
+    uint8_t* out = TC__VOID_CAST(uint8_t*,dst);
+    const uint8_t* in = TC__VOID_CAST(const uint8_t*,src);
+    if(!nlevels) nlevels = tctex_mipmap_count(w, h);
+    if(!w || !h || !nchan || nchan > 4) return true;
+
+    size_t y, c;
+    for(y = 0; y < h; y++)
+        memcpy(&out[y * w * nchan], &in[y * spitch_y], w * nchan);
+
+    float linear[256];
+    for(c = 0; c < 256; c++)
+        linear[c] = c / 255.0f;
+
+    TCTex_I_MipLevel level;
+    level.nchan = nchan;
+    for(c = 0; c < nchan; c++)
+    {
+        level.srgb[c] = (flags & TCTEX_MIP_SRGB) && c < 3;
+        level.lut[c] = level.srgb[c] ? tctex_i_srgb_to_linear : linear;
+    }
+
+    bool coverage = (flags & TCTEX_MIP_ALPHA_COVERAGE) && nchan == 4 && alpha_ref > 0.0f && alpha_ref <= 1.0f;
+    double target = 0.0;
+    if(coverage)
+    {
+        size_t count = 0, i;
+        for(i = 0; i < w * h; i++)
+            count += out[i * 4 + 3] >= alpha_ref * 255.0f;
+        target = count / TC__STATIC_CAST(double,w * h);
+    }
+
+    uint32_t i;
+    for(i = 1; i < nlevels; i++)
+    {
+        size_t dw = w > 1 ? w >> 1 : 1;
+        size_t dh = h > 1 ? h >> 1 : 1;
+        level.src = out;
+        level.dst = out + w * h * nchan;
+        level.sw = w;
+        level.dw = dw;
+        bool ok = tctex_i_mip_taps(&level.htaps, w, dw, filter) && tctex_i_mip_taps(&level.vtaps, h, dh, filter);
+        if(ok)
+        {
+            run(runctx, dh, dw * nchan, tctex_i_mip_rows, &level);
+            if(coverage) tctex_i_mip_preserve_coverage(level.dst, dw * dh, alpha_ref * 255.0f, target);
+        }
+        tctex_i_mip_taps_free(&level.htaps);
+        tctex_i_mip_taps_free(&level.vtaps);
+        if(!ok) return false;
+
+        out = level.dst;
+        w = dw;
+        h = dh;
+    }
+    return true;
+}
+bool tctex_generate_mipmaps(void* dst, const void* src, size_t spitch_y, size_t w, size_t h, size_t nchan, uint32_t nlevels, TCTex_MipFilter filter, unsigned int flags, float alpha_ref)
+{
+    return tctex_i_generate_mipmaps(dst, src, spitch_y, w, h, nchan, nlevels, filter, flags, alpha_ref, tctex_i_mip_run_serial, NULL);
+}
+#ifdef TC_THREAD_H_
+/* (uses the same band size as the decoders, but in terms of the output) */
+static void tctex_i_mip_run_pool(void* ctx, size_t nrows, size_t rowsize, void (*func)(size_t begin, size_t end, void* udata), void* udata)
+{
+    tcthread_pool_t* pool = TC__VOID_CAST(tcthread_pool_t*,ctx);
+    size_t grain = TCTEX_PARALLEL_BAND_BYTES / rowsize;
+    tcthread_pool_parallel_for(*pool, nrows, grain ? grain : 1, func, udata);
+}
+bool tctex_generate_mipmaps_parallel(void* dst, const void* src, size_t spitch_y, size_t w, size_t h, size_t nchan, uint32_t nlevels, TCTex_MipFilter filter, unsigned int flags, float alpha_ref, tcthread_pool_t pool)
+{
+    if(!tcthread_pool_is_valid(pool))
+        return tctex_generate_mipmaps(dst, src, spitch_y, w, h, nchan, nlevels, filter, flags, alpha_ref);
+    return tctex_i_generate_mipmaps(dst, src, spitch_y, w, h, nchan, nlevels, filter, flags, alpha_ref, tctex_i_mip_run_pool, &pool);
 }
+#endif /* TC_THREAD_H_ */
 
 #endif /* TC_TEXTURE_CODEC_IMPLEMENTATION */
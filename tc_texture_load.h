@@ -2,12 +2,17 @@
  * tc_texture_load.h: Texture image format loading.
  *
  * DEPENDS:
- * VERSION: 0.0.2 (2018-06-30)
+ * VERSION: 0.1.0 (2026-10-14)
  * LICENSE: CC0 & Boost (dual-licensed)
  * AUTHOR: Tim Cas
  * URL: https://github.com/darkuranium/tclib
  *
  * VERSION HISTORY:
+ * 0.1.0    added KTX2 support (optionally supercompressed with zstd or zlib; see `tctex_read_level`)
+ * 0.0.4    added partial reads of mipmap regions (`tctex_read_region`) & header-only loading via a reader
+ *          fixed the sizes of block-compressed mipmaps smaller than a block
+ * 0.0.3    added memory-mapped loading (`tctex_load_mapped`) & `tctex_prefetch_mipmaps`
+ *          fixed a memory leak in `tctex_load_file`
  * 0.0.2    fixed a crash when image height is set to 0 (thanks, American Fuzzy Lop!)
  * 0.0.1    initial public release (DDS files only)
  *
@@ -15,15 +20,16 @@
  * - Test, test, test, and then test some more!
  * - Handle a lack of provided pitch or linear size.
  * - More FourCC codes, more legacy DDS formats, et cetera.
- * - KTX (Khronos Texture) support
+ * - KTX (version 1) support
  *      - https://www.khronos.org/opengles/sdk/tools/KTX/file_format_spec/
+ * - KTX2: BasisLZ & UASTC (these need transcoding), and the key/value data
  * - ASTC support
  *      - https://www.khronos.org/registry/OpenGL/extensions/KHR/KHR_texture_compression_astc_hdr.txt
  *      - https://msdn.microsoft.com/en-us/library/windows/desktop/dn903790(v=vs.85).aspx
  *
  *
  *
- * A library for loading texture image formats, such as DDS.
+ * A library for loading texture image formats, such as DDS and KTX2.
  *
  * A single file should contain the following `#define` before including the header:
  *
@@ -36,11 +42,17 @@
  *      #define TC_TEXTURE_LOAD_VULKAN_FORMATS
  *      #define TC_TEXTURE_LOAD_OPENGL_FORMATS
  *      #define TC_TEXTURE_LOAD_DIRECT3D_FORMATS
+ *
+ * KTX2 levels can be supercompressed, in which case `tctex_read_level` has to
+ * be used to get at their data. It can take a decompression callback; if there
+ * is none, it uses zstd and zlib if `zstd.h` and `zlib.h` (respectively) have
+ * been included before the implementation of this library.
  */
 
 #ifndef TC_TEXTURE_LOAD_H_
 #define TC_TEXTURE_LOAD_H_
 
+#include <stddef.h>
 #include <stdint.h>
 #ifndef TC_TEXTURE_LOAD_NO_STDIO
 #include <stdio.h>
@@ -196,6 +208,7 @@ typedef enum TCTex_AlphaMode
 typedef struct TCTex_Texture
 {
     const uint8_t* memory;
+    size_t memlen; // (0 if `memory` is NULL)
     uint32_t offset0;
     uint32_t nbytes;
     struct { uint32_t x, y, z; } size;
@@ -213,18 +226,40 @@ typedef struct TCTex_Texture
     uint8_t alphamode;
     uint8_t isvolume: 1;
     uint8_t :7;
+    uint8_t supercompression; // TCTEX_SUPERCOMPRESSION_* (KTX2 only)
 
     TCTex_InternalFormat iformat;
     const char* errmsg;
 
     void* imem_; // internal!
+    size_t imemlen_; // internal! (non-zero if `imem_` is a file mapping)
+    const uint8_t* ilevels_; // internal! (KTX2 level index)
+    uint32_t ibpp_; // internal! (KTX2 bytes per texel, or per block for block-compressed formats)
 } TCTex_Texture;
 
+/* these map 1:1 to KTX2 */
+#define TCTEX_SUPERCOMPRESSION_NONE     0
+#define TCTEX_SUPERCOMPRESSION_BASISLZ  1
+#define TCTEX_SUPERCOMPRESSION_ZSTD     2
+#define TCTEX_SUPERCOMPRESSION_ZLIB     3
+
 TCTex_Texture* tctex_load_mem(TCTex_Texture* tex, const void* data, size_t datalen);
 
+// Reads up to `nbytes` at `offset` (from the start of the file) into `buf`, and
+// returns the number of bytes read.
+typedef size_t tctex_read_func(void* udata, uint64_t offset, void* buf, size_t nbytes);
+// Only reads (and parses) the header; `tex->memory` is NULL, and the data has to
+// be read via `tctex_read_region`, with the same reader.
+TCTex_Texture* tctex_load_reader(TCTex_Texture* tex, tctex_read_func* read, void* udata);
+
 #ifndef TC_TEXTURE_LOAD_NO_STDIO
 TCTex_Texture* tctex_load_file(TCTex_Texture* tex, FILE* file);
 TCTex_Texture* tctex_load_fname(TCTex_Texture* tex, const char* fname);
+// Like `tctex_load_fname`, but maps the file into memory instead of reading it;
+// only the header is touched, and the rest is paged in as it is accessed.
+TCTex_Texture* tctex_load_mapped(TCTex_Texture* tex, const char* fname);
+// A `tctex_read_func` for a `FILE*` (passed as `udata`).
+size_t tctex_read_stdio(void* udata, uint64_t offset, void* buf, size_t nbytes);
 #endif
 
 typedef struct TCTex_MipMapInfo
@@ -236,7 +271,53 @@ typedef struct TCTex_MipMapInfo
 } TCTex_MipMapInfo;
 // Get all the mipmaps for a texture at a specific array index.
 // Cubemap order is: +X, -X, +Y, -Y, +Z, -Z.
+// For block-compressed formats, `pitch.y` is the size of a row of blocks.
+// For supercompressed textures, `offset` is relative to the start of the level,
+// as written by `tctex_read_level`.
 uint32_t tctex_get_mipmaps(const TCTex_Texture* tex, TCTex_MipMapInfo* mipmaps, uint32_t maxmipmaps, uint32_t textureidx);
+// Get the smallest mipmap level that is at least `minsize` in both dimensions
+// (or level 0, if the texture itself is smaller than that).
+uint32_t tctex_get_mipmap_for_size(const TCTex_Texture* tex, uint32_t minsize);
+// Size (in bytes) of a 4x4 block, or 0 if the format is not block-compressed.
+uint32_t tctex_get_block_size(TCTex_InternalFormat iformat);
+
+typedef struct TCTex_Region
+{
+    uint32_t x, y; // in pixels
+    uint32_t w, h;
+} TCTex_Region;
+// Read only the compressed blocks that cover the `x,y,w,h` rectangle of a
+// mipmap level (of a block-compressed texture), one row of blocks after another
+// into `blocks` --- ready for `tctex_decompress_*` in tc_texture_codec.
+//
+// The rectangle is clipped to the level and expanded to whole blocks; the
+// result is stored in `region` (which gives the decoded size). If `blocks` is
+// NULL, only `region` is computed; the required size is then
+// `(region.w / 4) * (region.h / 4) * tctex_get_block_size(tex->iformat)` bytes.
+//
+// If `read` is NULL, the data is copied from `tex->memory` instead (which, with
+// `tctex_load_mapped`, only pages in the blocks needed). For volume textures,
+// only the first slice is read.
+TCTex_Texture* tctex_read_region(TCTex_Texture* tex, void* blocks, size_t blen, TCTex_Region* region, uint32_t miplevel, uint32_t textureidx, uint32_t x, uint32_t y, uint32_t w, uint32_t h, tctex_read_func* read, void* udata);
+
+// Decompress `srclen` bytes of `src` (with the given TCTEX_SUPERCOMPRESSION_*
+// scheme) into `dst`, returning the number of bytes written (or 0 on error).
+typedef size_t tctex_supercompression_func(void* udata, uint8_t scheme, void* dst, size_t dstlen, const void* src, size_t srclen);
+// Size of a mipmap level (all of the array elements & cubemap faces), once decompressed.
+uint64_t tctex_get_level_size(const TCTex_Texture* tex, uint32_t miplevel);
+// Copy (and, if supercompressed, decompress) a whole mipmap level straight into
+// `dst` (e.g. a mapped staging buffer), which must be at least
+// `tctex_get_level_size` bytes. The level is written as all of its array
+// elements & cubemap faces back-to-back, in the layout of `tctex_get_mipmaps`
+// (with `textureidx * nbytes` offsets), ready for a buffer-to-image copy.
+// As with `tctex_read_region`, `read` may be NULL to use `tex->memory`; with a
+// reader, uncompressed levels are read straight into `dst`, and zstd levels
+// are streamed. `decompress` may be NULL to use zstd/zlib, if available.
+TCTex_Texture* tctex_read_level(TCTex_Texture* tex, void* dst, size_t dstlen, uint32_t miplevel, tctex_read_func* read, void* udata, tctex_supercompression_func* decompress, void* decompress_udata);
+
+// Hint that the given mipmaps will be read soon, so that the OS can start paging
+// them in (asynchronously). This only does something for `tctex_load_mapped`.
+void tctex_prefetch_mipmaps(const TCTex_Texture* tex, const TCTex_MipMapInfo* mipmaps, uint32_t nmipmaps);
 
 void tctex_close(TCTex_Texture* tex);
 
@@ -280,13 +361,25 @@ TCTex_D3D_FormatInfo tctex_d3d_get_formatinfo(const TCTex_Texture* tex);
 
 #include <stdlib.h> // for malloc, free
 #include <stdbool.h>
+#include <string.h> // for memcpy (and strerror(int))
 
 #ifndef TC_TEXTURE_LOAD_NO_STDIO
-#include <string.h> // for strerror(int)
 #include <errno.h> // for int errno
 #define TC_FTELL(stream)                ftell(stream)
 #define TC_FSEEK(stream,offset,origin)  fseek(stream,offset,origin)
 typedef long int TC_foffset;
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
 #endif
 
 #ifndef TC__STATIC_OR_RUNTIME_ASSERT
@@ -925,20 +1018,244 @@ static TCTex_Texture* tctex_i_dds_load(TCTex_Texture* tex, const uint8_t* udata,
     return tex;
 }
 
-TCTex_Texture* tctex_load_mem(TCTex_Texture* tex, const void* data, size_t datalen)
+/* KTX2 (https://registry.khronos.org/KTX/specs/2.0/ktxspec.v2.html) */
+static const uint8_t tctex_i_ktx2_identifier[12] = { 0xAB, 0x4B, 0x54, 0x58, 0x20, 0x32, 0x30, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A };
+#define TCTEX_I_KTX2_HEADER_SIZE    80  // identifier, header & index
+#define TCTEX_I_KTX2_LEVEL_SIZE     24  // byteOffset, byteLength, uncompressedByteLength
+#define TCTEX_I_KTX2_MAX_DFD_SIZE   65536
+
+// the fields are not necessarily aligned (and the level index is 64-bit), so read them byte-by-byte
+static uint32_t tctex_i_read_le32(const uint8_t* p)
+{
+    return p[0] | (TC__STATIC_CAST(uint32_t,p[1]) << 8) | (TC__STATIC_CAST(uint32_t,p[2]) << 16) | (TC__STATIC_CAST(uint32_t,p[3]) << 24);
+}
+static uint64_t tctex_i_read_le64(const uint8_t* p)
+{
+    return tctex_i_read_le32(p) | (TC__STATIC_CAST(uint64_t,tctex_i_read_le32(p + 4)) << 32);
+}
+
+// VkFormat => internal format; the inverse of `tctex_i_vk_formats` (where that is exact), so that `tctex_vk_get_formatinfo` gives back the original
+// (`bsize` is the size of a texel, or of a 4x4 block for block-compressed formats)
+static const struct { uint32_t vkformat; TCTex_InternalFormat iformat; uint8_t bsize; } tctex_i_ktx2_formats[] = {
+    {3, TCTEX_IFORMAT_B4G4R4A4_UNORM, 2},        // B4G4R4A4_UNORM_PACK16
+    {5, TCTEX_IFORMAT_B5G6R5_UNORM, 2},          // B5G6R5_UNORM_PACK16
+    {7, TCTEX_IFORMAT_B5G5R5A1_UNORM, 2},        // B5G5R5A1_UNORM_PACK16
+    {9, TCTEX_IFORMAT_R8_UNORM, 1},
+    {10, TCTEX_IFORMAT_R8_SNORM, 1},
+    {13, TCTEX_IFORMAT_R8_UINT, 1},
+    {14, TCTEX_IFORMAT_R8_SINT, 1},
+    {16, TCTEX_IFORMAT_R8G8_UNORM, 2},
+    {17, TCTEX_IFORMAT_R8G8_SNORM, 2},
+    {20, TCTEX_IFORMAT_R8G8_UINT, 2},
+    {21, TCTEX_IFORMAT_R8G8_SINT, 2},
+    {37, TCTEX_IFORMAT_R8G8B8A8_UNORM, 4},
+    {38, TCTEX_IFORMAT_R8G8B8A8_SNORM, 4},
+    {41, TCTEX_IFORMAT_R8G8B8A8_UINT, 4},
+    {42, TCTEX_IFORMAT_R8G8B8A8_SINT, 4},
+    {43, TCTEX_IFORMAT_R8G8B8A8_SRGB, 4},
+    {44, TCTEX_IFORMAT_B8G8R8A8_UNORM, 4},
+    {50, TCTEX_IFORMAT_B8G8R8A8_SRGB, 4},
+    {64, TCTEX_IFORMAT_R10G10B10A2_UNORM, 4},    // A2B10G10R10_UNORM_PACK32
+    {68, TCTEX_IFORMAT_R10G10B10A2_UINT, 4},     // A2B10G10R10_UINT_PACK32
+    {70, TCTEX_IFORMAT_R16_UNORM, 2},
+    {71, TCTEX_IFORMAT_R16_SNORM, 2},
+    {74, TCTEX_IFORMAT_R16_UINT, 2},
+    {75, TCTEX_IFORMAT_R16_SINT, 2},
+    {76, TCTEX_IFORMAT_R16_SFLOAT, 2},
+    {77, TCTEX_IFORMAT_R16G16_UNORM, 4},
+    {78, TCTEX_IFORMAT_R16G16_SNORM, 4},
+    {81, TCTEX_IFORMAT_R16G16_UINT, 4},
+    {82, TCTEX_IFORMAT_R16G16_SINT, 4},
+    {83, TCTEX_IFORMAT_R16G16_SFLOAT, 4},
+    {91, TCTEX_IFORMAT_R16G16B16A16_UNORM, 8},
+    {92, TCTEX_IFORMAT_R16G16B16A16_SNORM, 8},
+    {95, TCTEX_IFORMAT_R16G16B16A16_UINT, 8},
+    {96, TCTEX_IFORMAT_R16G16B16A16_SINT, 8},
+    {97, TCTEX_IFORMAT_R16G16B16A16_SFLOAT, 8},
+    {98, TCTEX_IFORMAT_R32_UINT, 4},
+    {99, TCTEX_IFORMAT_R32_SINT, 4},
+    {100, TCTEX_IFORMAT_R32_SFLOAT, 4},
+    {101, TCTEX_IFORMAT_R32G32_UINT, 8},
+    {102, TCTEX_IFORMAT_R32G32_SINT, 8},
+    {103, TCTEX_IFORMAT_R32G32_SFLOAT, 8},
+    {104, TCTEX_IFORMAT_R32G32B32_UINT, 12},
+    {105, TCTEX_IFORMAT_R32G32B32_SINT, 12},
+    {106, TCTEX_IFORMAT_R32G32B32_SFLOAT, 12},
+    {107, TCTEX_IFORMAT_R32G32B32A32_UINT, 16},
+    {108, TCTEX_IFORMAT_R32G32B32A32_SINT, 16},
+    {109, TCTEX_IFORMAT_R32G32B32A32_SFLOAT, 16},
+    {122, TCTEX_IFORMAT_R11G11B10_SFLOAT, 4},    // B10G11R11_UFLOAT_PACK32
+    {123, TCTEX_IFORMAT_R9G9B9E5_UFLOAT, 4},     // E5B9G9R9_UFLOAT_PACK32
+    {124, TCTEX_IFORMAT_D16_UNORM, 2},
+    {126, TCTEX_IFORMAT_D32_SFLOAT, 4},
+    {129, TCTEX_IFORMAT_D24_UNORM_S8_UINT, 4},
+    {130, TCTEX_IFORMAT_D32_SFLOAT_S8X24_UINT, 8},
+    {131, TCTEX_IFORMAT_COMPRESSED_BC1_UNORM, 8},// BC1_RGB_UNORM_BLOCK (+ opaque alpha)
+    {132, TCTEX_IFORMAT_COMPRESSED_BC1_SRGB, 8}, // BC1_RGB_SRGB_BLOCK (+ opaque alpha)
+    {133, TCTEX_IFORMAT_COMPRESSED_BC1_UNORM, 8},
+    {134, TCTEX_IFORMAT_COMPRESSED_BC1_SRGB, 8},
+    {135, TCTEX_IFORMAT_COMPRESSED_BC2_UNORM, 16},
+    {136, TCTEX_IFORMAT_COMPRESSED_BC2_SRGB, 16},
+    {137, TCTEX_IFORMAT_COMPRESSED_BC3_UNORM, 16},
+    {138, TCTEX_IFORMAT_COMPRESSED_BC3_SRGB, 16},
+    {139, TCTEX_IFORMAT_COMPRESSED_BC4_UNORM, 8},
+    {140, TCTEX_IFORMAT_COMPRESSED_BC4_SNORM, 8},
+    {141, TCTEX_IFORMAT_COMPRESSED_BC5_UNORM, 16},
+    {142, TCTEX_IFORMAT_COMPRESSED_BC5_SNORM, 16},
+    {143, TCTEX_IFORMAT_COMPRESSED_BC6H_UFLOAT, 16},
+    {144, TCTEX_IFORMAT_COMPRESSED_BC6H_SFLOAT, 16},
+    {145, TCTEX_IFORMAT_COMPRESSED_BC7_UNORM, 16},
+    {146, TCTEX_IFORMAT_COMPRESSED_BC7_SRGB, 16},
+};
+
+// computes the (decompressed) size of a single texture at a mipmap level
+static uint64_t tctex_i_ktx2_texture_size(const TCTex_Texture* tex, uint32_t miplevel)
+{
+    uint64_t x = tctex_i_max32u(tex->size.x >> miplevel, 1U);
+    uint64_t y = tctex_i_max32u(tex->size.y >> miplevel, 1U);
+    uint64_t z = tctex_i_max32u(tex->size.z >> miplevel, 1U);
+    uint32_t bsize = tctex_get_block_size(tex->iformat);
+    if(bsize) return (x + 3U) / 4U * ((y + 3U) / 4U) * z * bsize;
+    return x * y * z * tex->ibpp_;
+}
+
+// `hasdata` is false if only the header, index & DFD are in memory (from `tctex_load_reader`), so the levels can't be checked
+static TCTex_Texture* tctex_i_ktx2_load(TCTex_Texture* tex, const uint8_t* udata, size_t udatalen, bool hasdata)
+{
+    if(udatalen < TCTEX_I_KTX2_HEADER_SIZE) TCTEX_I_RETERROR(tex, "Invalid KTX2 file (header truncated)");
+
+    uint32_t vkFormat = tctex_i_read_le32(udata + 12);
+    uint32_t pixelWidth = tctex_i_read_le32(udata + 20);
+    uint32_t pixelHeight = tctex_i_read_le32(udata + 24);
+    uint32_t pixelDepth = tctex_i_read_le32(udata + 28);
+    uint32_t layerCount = tctex_i_read_le32(udata + 32);
+    uint32_t faceCount = tctex_i_read_le32(udata + 36);
+    uint32_t levelCount = tctex_i_read_le32(udata + 40);
+    uint32_t supercompressionScheme = tctex_i_read_le32(udata + 44);
+    uint32_t dfdByteOffset = tctex_i_read_le32(udata + 48);
+    uint32_t dfdByteLength = tctex_i_read_le32(udata + 52);
+
+    if(!vkFormat) TCTEX_I_RETERROR(tex, "[TODO] UNHANDLED: KTX2 Basis Universal textures (BasisLZ/UASTC; these need transcoding)");
+    if(supercompressionScheme > TCTEX_SUPERCOMPRESSION_ZLIB) TCTEX_I_RETERROR(tex, "Unsupported KTX2 supercompression scheme");
+    if(!pixelWidth || (pixelDepth && !pixelHeight)) TCTEX_I_RETERROR(tex, "Invalid KTX2 file (invalid size)");
+    if(faceCount != 1 && faceCount != 6) TCTEX_I_RETERROR(tex, "Invalid KTX2 file (invalid face count)");
+    if(!levelCount) levelCount = 1; // 0 means "generate mipmaps", but it's still only a single level in the file
+    if(levelCount > 32) TCTEX_I_RETERROR(tex, "Invalid KTX2 file (too many mipmap levels)");
+    if(udatalen < TCTEX_I_KTX2_HEADER_SIZE + levelCount * TCTEX_I_KTX2_LEVEL_SIZE) TCTEX_I_RETERROR(tex, "Invalid KTX2 file (level index truncated)");
+    // we need the basic descriptor block (for the flags & bytes per pixel)
+    if(dfdByteLength < 24 || dfdByteLength > TCTEX_I_KTX2_MAX_DFD_SIZE || dfdByteOffset > udatalen || udatalen - dfdByteOffset < dfdByteLength) TCTEX_I_RETERROR(tex, "Invalid KTX2 file (data format descriptor truncated)");
+    const uint8_t* dfd = udata + dfdByteOffset;
+
+    size_t i;
+    tex->iformat = TCTEX_IFORMAT_UNDEFINED;
+    for(i = 0; i < sizeof(tctex_i_ktx2_formats) / sizeof(*tctex_i_ktx2_formats); i++)
+        if(tctex_i_ktx2_formats[i].vkformat == vkFormat)
+        {
+            tex->iformat = tctex_i_ktx2_formats[i].iformat;
+            tex->ibpp_ = tctex_i_ktx2_formats[i].bsize;
+            break;
+        }
+    if(!tex->iformat) TCTEX_I_RETERROR(tex, "[TODO] UNHANDLED: KTX2 Vulkan format");
+
+    tex->size.x = pixelWidth;
+    tex->size.y = tctex_i_max32u(pixelHeight, 1U);
+    tex->size.z = tctex_i_max32u(pixelDepth, 1U);
+    tex->dimension = pixelDepth ? 3 : pixelHeight ? 2 : 1;
+    tex->isvolume = !!pixelDepth;
+    tex->arraylen = tctex_i_max32u(layerCount, 1U);
+    if(faceCount == 6)
+    {
+        tex->cubefaces.num = 6;
+        tex->cubefaces.mask = TCTEX_CUBE_FACE_ALL;
+    }
+    tex->nmiplevels = levelCount;
+    tex->supercompression = TC__STATIC_CAST(uint8_t,supercompressionScheme);
+    if(vkFormat == 131 || vkFormat == 132) tex->alphamode = TCTEX_ALPHA_MODE_OPAQUE;
+    else tex->alphamode = (dfd[15] & 1) /* KHR_DF_FLAG_ALPHA_PREMULTIPLIED */ ? TCTEX_ALPHA_MODE_PREMULTIPLIED : TCTEX_ALPHA_MODE_STRAIGHT;
+    // bytesPlane0 (the block size, for block-compressed formats) is 0 if supercompressed, in which case the format's size applies
+    if(dfd[20] && dfd[20] != tex->ibpp_) TCTEX_I_RETERROR(tex, "Invalid KTX2 file (data format descriptor does not match the format)");
+    tex->ilevels_ = udata + TCTEX_I_KTX2_HEADER_SIZE;
+
+    uint32_t ntextures = tex->arraylen * tctex_i_max32u(tex->cubefaces.num, 1U);
+    for(i = 0; i < levelCount; i++)
+    {
+        const uint8_t* level = tex->ilevels_ + i * TCTEX_I_KTX2_LEVEL_SIZE;
+        uint64_t byteOffset = tctex_i_read_le64(level);
+        uint64_t byteLength = tctex_i_read_le64(level + 8);
+        uint64_t uncompressedByteLength = tctex_i_read_le64(level + 16);
+        uint64_t expected = tctex_i_ktx2_texture_size(tex, TC__STATIC_CAST(uint32_t,i)) * ntextures;
+        if(supercompressionScheme == TCTEX_SUPERCOMPRESSION_NONE ? byteLength < expected : uncompressedByteLength != expected)
+            TCTEX_I_RETERROR(tex, "Invalid KTX2 file (level size does not match the format)");
+        if(hasdata && (byteOffset > udatalen || udatalen - byteOffset < byteLength)) TCTEX_I_RETERROR(tex, "Invalid KTX2 file (file truncated)");
+    }
+
+    uint64_t offset0 = supercompressionScheme ? 0 : tctex_i_read_le64(tex->ilevels_);
+    uint64_t nbytes = tctex_i_ktx2_texture_size(tex, 0);
+    if(offset0 > UINT32_MAX || nbytes > UINT32_MAX) TCTEX_I_RETERROR(tex, "KTX2 file too large");
+    tex->offset0 = TC__STATIC_CAST(uint32_t,offset0);
+    tex->nbytes = TC__STATIC_CAST(uint32_t,nbytes);
+    if(tctex_get_block_size(tex->iformat))
+    {
+        tex->pitch.y = (tex->size.x + 3U) / 4U * tex->ibpp_;
+        tex->pitch.z = (tex->size.y + 3U) / 4U * tex->pitch.y;
+    }
+    else
+    {
+        tex->pitch.y = tex->size.x * tex->ibpp_; // rows are tightly packed
+        tex->pitch.z = tex->size.y * tex->pitch.y;
+    }
+    return tex;
+}
+
+static TCTex_Texture* tctex_i_load(TCTex_Texture* tex, const void* data, size_t datalen, bool hasdata)
 {
     static const TCTex_Texture Initial = {};
 
     if(!tex) return NULL;
     *tex = Initial;
-    if(datalen < 4 + sizeof(TCTex_DDS_HEADER)) TCTEX_I_RETERROR(tex, "Invalid file (not a DDS file or file truncated)");
-
     tex->memory = TC__VOID_CAST(const uint8_t*,data);
+    tex->memlen = datalen;
 
+    if(datalen >= sizeof(tctex_i_ktx2_identifier) && !memcmp(data, tctex_i_ktx2_identifier, sizeof(tctex_i_ktx2_identifier))) return tctex_i_ktx2_load(tex, tex->memory, datalen, hasdata);
+    if(datalen < 4 + sizeof(TCTex_DDS_HEADER)) TCTEX_I_RETERROR(tex, "Invalid file (not a DDS/KTX2 file or file truncated)");
     if(TCTEX__FROM_LE32(*TC__STATIC_CAST(const uint32_t*,data)) == 0x20534444U /* "DDS " */) return tctex_i_dds_load(tex, tex->memory, 4, datalen);
-    tex->errmsg = "Invalid filetype (not a DDS file)";
+    tex->errmsg = "Invalid filetype (not a DDS/KTX2 file)";
     return NULL;
 }
+TCTex_Texture* tctex_load_mem(TCTex_Texture* tex, const void* data, size_t datalen)
+{
+    return tctex_i_load(tex, data, datalen, true);
+}
+TCTex_Texture* tctex_load_reader(TCTex_Texture* tex, tctex_read_func* read, void* udata)
+{
+    if(!tex) return NULL;
+    // the magic, DDS_HEADER & DDS_HEADER_DXT10 are all we need for DDS (and KTX2's header & index fit in there as well)
+    uint32_t header[(4 + sizeof(TCTex_DDS_HEADER) + sizeof(TCTex_DDS_HEADER_DXT10)) / sizeof(uint32_t)];
+    size_t len = read(udata, 0, header, sizeof(header));
+    if(len >= TCTEX_I_KTX2_HEADER_SIZE && !memcmp(header, tctex_i_ktx2_identifier, sizeof(tctex_i_ktx2_identifier)))
+    {
+        // KTX2 also needs the level index & the DFD, which are kept around (in `imem_`) for later
+        const uint8_t* bheader = TC__STATIC_CAST(const uint8_t*,TC__VOID_CAST(const void*,header));
+        uint32_t levelCount = tctex_i_max32u(tctex_i_read_le32(bheader + 40), 1U);
+        uint32_t dfdByteOffset = tctex_i_read_le32(bheader + 48);
+        uint32_t dfdByteLength = tctex_i_read_le32(bheader + 52);
+        if(levelCount > 32 || dfdByteLength > TCTEX_I_KTX2_MAX_DFD_SIZE || dfdByteOffset > TCTEX_I_KTX2_HEADER_SIZE + 32 * TCTEX_I_KTX2_LEVEL_SIZE + TCTEX_I_KTX2_MAX_DFD_SIZE)
+            TCTEX_I_RETERROR(tex, "Invalid KTX2 file (invalid index)");
+        size_t mlen = tctex_i_max32u(TCTEX_I_KTX2_HEADER_SIZE + levelCount * TCTEX_I_KTX2_LEVEL_SIZE, dfdByteOffset + dfdByteLength);
+        void* mem = malloc(mlen);
+        if(!mem) { tex->errmsg = "Unable to allocate memory"; return NULL; }
+        mlen = read(udata, 0, mem, mlen);
+        if(!tctex_i_load(tex, mem, mlen, false)) { free(mem); return NULL; }
+        tex->imem_ = mem; // after `tctex_i_load`, which resets `tex`
+        tex->memory = NULL;
+        tex->memlen = 0;
+        return tex;
+    }
+    if(!tctex_i_load(tex, header, len, false)) return NULL;
+    tex->memory = NULL;
+    tex->memlen = 0;
+    return tex;
+}
 #ifndef TC_TEXTURE_LOAD_NO_STDIO
 TCTex_Texture* tctex_load_file(TCTex_Texture* tex, FILE* file)
 {
@@ -951,13 +1268,14 @@ TCTex_Texture* tctex_load_file(TCTex_Texture* tex, FILE* file)
     if(TC_FSEEK(file, head, SEEK_SET)) return NULL;
 
     TC_foffset len = tail - head;
-    tex->imem_ = malloc(len);
-    if(!tex->imem_) { tex->errmsg = "Unable to allocate memory"; return NULL; }
-    if(fread(tex->imem_, 1, len, file) != len) { tex->errmsg = strerror(errno); goto err_freemem; }
-    if(!tctex_load_mem(tex, tex->imem_, len)) goto err_freemem;
+    void* mem = malloc(len);
+    if(!mem) { tex->errmsg = "Unable to allocate memory"; return NULL; }
+    if(fread(mem, 1, len, file) != (size_t)len) { tex->errmsg = strerror(errno); goto err_freemem; }
+    if(!tctex_load_mem(tex, mem, len)) goto err_freemem;
+    tex->imem_ = mem; // after `tctex_load_mem`, which resets `tex`
     return tex;
 err_freemem:
-    free(tex->imem_);
+    free(mem);
     return NULL;
 }
 TCTex_Texture* tctex_load_fname(TCTex_Texture* tex, const char* fname)
@@ -973,11 +1291,80 @@ TCTex_Texture* tctex_load_fname(TCTex_Texture* tex, const char* fname)
     fclose(file);
     return tex;
 }
+TCTex_Texture* tctex_load_mapped(TCTex_Texture* tex, const char* fname)
+{
+    if(!tex) return NULL;
+
+    void* mem;
+    size_t len;
+#ifdef _WIN32
+    HANDLE file = CreateFileA(fname, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if(file == INVALID_HANDLE_VALUE) { tex->errmsg = "Unable to open file"; return NULL; }
+    LARGE_INTEGER fsize;
+    if(!GetFileSizeEx(file, &fsize)) { CloseHandle(file); tex->errmsg = "Unable to get file size"; return NULL; }
+    len = (size_t)fsize.QuadPart;
+    if(!len) { CloseHandle(file); return tctex_load_mem(tex, NULL, 0); } // can't map an empty file
+    HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    CloseHandle(file); // the mapping keeps the file open
+    if(!mapping) { tex->errmsg = "Unable to map file"; return NULL; }
+    mem = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(mapping); // ... and the view keeps the mapping open
+    if(!mem) { tex->errmsg = "Unable to map file"; return NULL; }
+#else
+    int fd = open(fname, O_RDONLY);
+    if(fd < 0) { tex->errmsg = strerror(errno); return NULL; }
+    struct stat st;
+    if(fstat(fd, &st)) { tex->errmsg = strerror(errno); close(fd); return NULL; }
+    len = (size_t)st.st_size;
+    if(!len) { close(fd); return tctex_load_mem(tex, NULL, 0); } // can't map an empty file
+    mem = mmap(NULL, len, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd); // the mapping keeps the file open
+    if(mem == MAP_FAILED) { tex->errmsg = strerror(errno); return NULL; }
+#endif
+
+    if(!tctex_load_mem(tex, mem, len))
+    {
+#ifdef _WIN32
+        UnmapViewOfFile(mem);
+#else
+        munmap(mem, len);
+#endif
+        return NULL;
+    }
+    tex->imem_ = mem;
+    tex->imemlen_ = len;
+    return tex;
+}
+size_t tctex_read_stdio(void* udata, uint64_t offset, void* buf, size_t nbytes)
+{
+    FILE* file = TC__VOID_CAST(FILE*,udata);
+    if(TC_FSEEK(file, TC__STATIC_CAST(TC_foffset,offset), SEEK_SET)) return 0;
+    return fread(buf, 1, nbytes, file);
+}
 #endif
 
+uint32_t tctex_get_block_size(TCTex_InternalFormat iformat)
+{
+    switch(iformat)
+    {
+    case TCTEX_IFORMAT_COMPRESSED_BC1_TYPELESS: case TCTEX_IFORMAT_COMPRESSED_BC1_UNORM: case TCTEX_IFORMAT_COMPRESSED_BC1_SRGB:
+    case TCTEX_IFORMAT_COMPRESSED_BC4_TYPELESS: case TCTEX_IFORMAT_COMPRESSED_BC4_UNORM: case TCTEX_IFORMAT_COMPRESSED_BC4_SNORM:
+        return 8;
+    case TCTEX_IFORMAT_COMPRESSED_BC2_TYPELESS: case TCTEX_IFORMAT_COMPRESSED_BC2_UNORM: case TCTEX_IFORMAT_COMPRESSED_BC2_SRGB:
+    case TCTEX_IFORMAT_COMPRESSED_BC3_TYPELESS: case TCTEX_IFORMAT_COMPRESSED_BC3_UNORM: case TCTEX_IFORMAT_COMPRESSED_BC3_SRGB:
+    case TCTEX_IFORMAT_COMPRESSED_BC5_TYPELESS: case TCTEX_IFORMAT_COMPRESSED_BC5_UNORM: case TCTEX_IFORMAT_COMPRESSED_BC5_SNORM:
+    case TCTEX_IFORMAT_COMPRESSED_BC6H_TYPELESS: case TCTEX_IFORMAT_COMPRESSED_BC6H_UFLOAT: case TCTEX_IFORMAT_COMPRESSED_BC6H_SFLOAT:
+    case TCTEX_IFORMAT_COMPRESSED_BC7_TYPELESS: case TCTEX_IFORMAT_COMPRESSED_BC7_UNORM: case TCTEX_IFORMAT_COMPRESSED_BC7_SRGB:
+        return 16;
+    default:
+        return 0;
+    }
+}
+
 uint32_t tctex_get_mipmaps(const TCTex_Texture* tex, TCTex_MipMapInfo* mipmaps, uint32_t maxmipmaps, uint32_t textureidx)
 {
     uint32_t nmipmaps = tctex_i_min32u(tex->nmiplevels, maxmipmaps);
+    uint32_t bsize = tctex_get_block_size(tex->iformat);
 
     TCTex_MipMapInfo mipmap;
     mipmap.offset = 0;
@@ -987,6 +1374,12 @@ uint32_t tctex_get_mipmaps(const TCTex_Texture* tex, TCTex_MipMapInfo* mipmaps,
     mipmap.pitch.y = tex->pitch.y;
     mipmap.pitch.z = tex->pitch.z;
     mipmap.nbytes = tex->nbytes;
+    if(bsize) // block-compressed: levels are stored as whole 4x4 blocks, even if they're smaller than that
+    {
+        mipmap.pitch.y = (mipmap.size.x + 3U) / 4U * bsize;
+        mipmap.pitch.z = (mipmap.size.y + 3U) / 4U * mipmap.pitch.y;
+        mipmap.nbytes = mipmap.size.z * mipmap.pitch.z;
+    }
 
     uint32_t i;
     // first, compute the base info
@@ -997,21 +1390,293 @@ uint32_t tctex_get_mipmaps(const TCTex_Texture* tex, TCTex_MipMapInfo* mipmaps,
         mipmap.size.x = tctex_i_max32u(mipmap.size.x >> 1, 1U);
         mipmap.size.y = tctex_i_max32u(mipmap.size.y >> 1, 1U);
         mipmap.size.z = tctex_i_max32u(mipmap.size.z >> 1, 1U);
-        //mipmap.pitch.y = tctex_i_max32u(((mipmap.pitch.y >> 1) + 3U) & ~3U, 4U);
-        mipmap.pitch.y = tctex_i_max32u(mipmap.pitch.y >> 1, 1U);
-        mipmap.pitch.z = mipmap.size.y * mipmap.pitch.y;
+        if(bsize)
+        {
+            mipmap.pitch.y = (mipmap.size.x + 3U) / 4U * bsize;
+            mipmap.pitch.z = (mipmap.size.y + 3U) / 4U * mipmap.pitch.y;
+        }
+        else
+        {
+            //mipmap.pitch.y = tctex_i_max32u(((mipmap.pitch.y >> 1) + 3U) & ~3U, 4U);
+            mipmap.pitch.y = tex->ibpp_ ? mipmap.size.x * tex->ibpp_ : tctex_i_max32u(mipmap.pitch.y >> 1, 1U);
+            mipmap.pitch.z = mipmap.size.y * mipmap.pitch.y;
+        }
         mipmap.nbytes = mipmap.size.z * mipmap.pitch.z;
     }
+    if(tex->ilevels_) // KTX2: each level is stored separately (and contains all textures)
+    {
+        for(i = 0; i < nmipmaps; i++)
+            mipmaps[i].offset = (tex->supercompression ? 0 : tctex_i_read_le64(tex->ilevels_ + i * TCTEX_I_KTX2_LEVEL_SIZE)) + TC__STATIC_CAST(uint64_t,textureidx) * mipmaps[i].nbytes;
+        return nmipmaps;
+    }
     // mipmap.offset now stores the total size!
     for(i = 0; i < nmipmaps; i++) // now, adjust all offsets
         mipmaps[i].offset += tex->offset0 + textureidx * mipmap.offset;
     return nmipmaps;
 }
 
+uint32_t tctex_get_mipmap_for_size(const TCTex_Texture* tex, uint32_t minsize)
+{
+    uint32_t level = 0;
+    uint32_t x = tex->size.x, y = tex->size.y;
+    while(level + 1 < tex->nmiplevels && tctex_i_max32u(x >> 1, 1U) >= minsize && tctex_i_max32u(y >> 1, 1U) >= minsize)
+    {
+        x = tctex_i_max32u(x >> 1, 1U);
+        y = tctex_i_max32u(y >> 1, 1U);
+        level++;
+    }
+    return level;
+}
+
+// the DDS loader only checks the header, so reads from `tex->memory` have to be checked against the actual size
+static bool tctex_i_in_memory(const TCTex_Texture* tex, uint64_t offset, uint64_t len)
+{
+    return offset <= tex->memlen && tex->memlen - offset >= len;
+}
+
+TCTex_Texture* tctex_read_region(TCTex_Texture* tex, void* blocks, size_t blen, TCTex_Region* region, uint32_t miplevel, uint32_t textureidx, uint32_t x, uint32_t y, uint32_t w, uint32_t h, tctex_read_func* read, void* udata)
+{
+    if(!tex) return NULL;
+    uint32_t bsize = tctex_get_block_size(tex->iformat);
+    if(!bsize) TCTEX_I_RETERROR(tex, "Partial reads are only supported for block-compressed formats");
+    if(tex->supercompression) TCTEX_I_RETERROR(tex, "Partial reads are not supported for supercompressed textures (use `tctex_read_level`)");
+    if(miplevel >= tex->nmiplevels || miplevel >= 32) TCTEX_I_RETERROR(tex, "Invalid mipmap level");
+    if(textureidx >= tex->arraylen * tctex_i_max32u(tex->cubefaces.num, 1U)) TCTEX_I_RETERROR(tex, "Invalid texture index");
+
+    TCTex_MipMapInfo mipmaps[32];
+    tctex_get_mipmaps(tex, mipmaps, miplevel + 1, textureidx);
+    const TCTex_MipMapInfo* mipmap = &mipmaps[miplevel];
+    if(x >= mipmap->size.x || y >= mipmap->size.y || !w || !h) TCTEX_I_RETERROR(tex, "Invalid region (empty, or outside of the mipmap level)");
+    w = tctex_i_min32u(w, mipmap->size.x - x);
+    h = tctex_i_min32u(h, mipmap->size.y - y);
+
+    uint32_t bx0 = x / 4U, by0 = y / 4U;
+    uint32_t bx1 = (x + w + 3U) / 4U, by1 = (y + h + 3U) / 4U;
+    TCTex_Region r;
+    r.x = bx0 * 4U;
+    r.y = by0 * 4U;
+    r.w = (bx1 - bx0) * 4U;
+    r.h = (by1 - by0) * 4U;
+    if(region) *region = r;
+    if(!blocks) return tex;
+
+    size_t rowlen = TC__STATIC_CAST(size_t,bx1 - bx0) * bsize;
+    size_t nrows = by1 - by0;
+    if(blen < rowlen * nrows) TCTEX_I_RETERROR(tex, "Buffer too small for the region");
+    if(!read && !tex->memory) TCTEX_I_RETERROR(tex, "Texture has no data in memory (loaded through a reader?)");
+
+    uint64_t offset = mipmap->offset + TC__STATIC_CAST(uint64_t,by0) * mipmap->pitch.y + TC__STATIC_CAST(uint64_t,bx0) * bsize;
+    if(rowlen == mipmap->pitch.y) // full rows are consecutive, so this can be done in a single read
+    {
+        rowlen *= nrows;
+        nrows = 1;
+    }
+    uint8_t* out = TC__VOID_CAST(uint8_t*,blocks);
+    size_t i;
+    for(i = 0; i < nrows; i++, out += rowlen, offset += mipmap->pitch.y)
+    {
+        if(!read)
+        {
+            if(!tctex_i_in_memory(tex, offset, rowlen)) TCTEX_I_RETERROR(tex, "Unable to read the texture data (file truncated)");
+            memcpy(out, tex->memory + offset, rowlen);
+        }
+        else if(read(udata, offset, out, rowlen) != rowlen)
+            TCTEX_I_RETERROR(tex, "Unable to read the texture data (file truncated?)");
+    }
+    return tex;
+}
+
+uint64_t tctex_get_level_size(const TCTex_Texture* tex, uint32_t miplevel)
+{
+    if(miplevel >= tex->nmiplevels || miplevel >= 32) return 0;
+    TCTex_MipMapInfo mipmaps[32];
+    tctex_get_mipmaps(tex, mipmaps, miplevel + 1, 0);
+    return TC__STATIC_CAST(uint64_t,mipmaps[miplevel].nbytes) * tex->arraylen * tctex_i_max32u(tex->cubefaces.num, 1U);
+}
+
+#if defined(ZSTD_VERSION_MAJOR) || defined(ZLIB_VERSION)
+static size_t tctex_i_default_decompress(void* udata, uint8_t scheme, void* dst, size_t dstlen, const void* src, size_t srclen)
+{
+    (void)udata;
+    switch(scheme)
+    {
+#ifdef ZSTD_VERSION_MAJOR
+    case TCTEX_SUPERCOMPRESSION_ZSTD: {
+            size_t ret = ZSTD_decompress(dst, dstlen, src, srclen);
+            return ZSTD_isError(ret) ? 0 : ret;
+        }
+#endif
+#ifdef ZLIB_VERSION
+    case TCTEX_SUPERCOMPRESSION_ZLIB: {
+            uLongf len = TC__STATIC_CAST(uLongf,dstlen);
+            return uncompress(TC__STATIC_CAST(Bytef*,dst), &len, TC__STATIC_CAST(const Bytef*,src), TC__STATIC_CAST(uLong,srclen)) == Z_OK ? TC__STATIC_CAST(size_t,len) : 0;
+        }
+#endif
+    default:
+        return 0;
+    }
+}
+#define TCTEX_I_DEFAULT_DECOMPRESS  tctex_i_default_decompress
+#else
+#define TCTEX_I_DEFAULT_DECOMPRESS  NULL
+#endif
+
+#ifdef ZSTD_VERSION_MAJOR
+// streams the level through a small buffer, so that it never has to be in memory in its entirety
+static TCTex_Texture* tctex_i_zstd_read_stream(TCTex_Texture* tex, void* dst, size_t dstlen, uint64_t offset, uint64_t length, tctex_read_func* read, void* udata)
+{
+    ZSTD_DStream* stream = ZSTD_createDStream();
+    size_t buflen = ZSTD_DStreamInSize();
+    void* buf = malloc(buflen);
+    if(!stream || !buf) { ZSTD_freeDStream(stream); free(buf); TCTEX_I_RETERROR(tex, "Unable to allocate memory"); }
+
+    ZSTD_outBuffer out = { dst, dstlen, 0 };
+    while(length && !tex->errmsg)
+    {
+        size_t len = length < buflen ? TC__STATIC_CAST(size_t,length) : buflen;
+        if(read(udata, offset, buf, len) != len) { tex->errmsg = "Unable to read the texture data (file truncated?)"; break; }
+        offset += len;
+        length -= len;
+        ZSTD_inBuffer in = { buf, len, 0 };
+        while(in.pos < in.size)
+        {
+            size_t inpos = in.pos, outpos = out.pos;
+            size_t ret = ZSTD_decompressStream(stream, &out, &in);
+            // (no progress means that `dst` is full, but the level isn't done)
+            if(ZSTD_isError(ret) || (in.pos == inpos && out.pos == outpos)) { tex->errmsg = "Unable to decompress the texture data"; break; }
+        }
+    }
+    ZSTD_freeDStream(stream);
+    free(buf);
+    if(tex->errmsg) return NULL;
+    if(out.pos != dstlen) TCTEX_I_RETERROR(tex, "Unable to decompress the texture data (level truncated)");
+    return tex;
+}
+#endif
+
+TCTex_Texture* tctex_read_level(TCTex_Texture* tex, void* dst, size_t dstlen, uint32_t miplevel, tctex_read_func* read, void* udata, tctex_supercompression_func* decompress, void* decompress_udata)
+{
+    if(!tex) return NULL;
+    if(miplevel >= tex->nmiplevels || miplevel >= 32) TCTEX_I_RETERROR(tex, "Invalid mipmap level");
+    uint64_t size = tctex_get_level_size(tex, miplevel);
+    if(dstlen < size) TCTEX_I_RETERROR(tex, "Buffer too small for the level");
+    if(!read && !tex->memory) TCTEX_I_RETERROR(tex, "Texture has no data in memory (loaded through a reader?)");
+    tex->errmsg = NULL;
+    dstlen = TC__STATIC_CAST(size_t,size);
+
+    if(!tex->ilevels_)
+    {
+        // DDS: gather the level from each texture's mipmap chain
+        uint32_t ntextures = tex->arraylen * tctex_i_max32u(tex->cubefaces.num, 1U);
+        uint8_t* out = TC__VOID_CAST(uint8_t*,dst);
+        TCTex_MipMapInfo mipmaps[32];
+        uint32_t i;
+        for(i = 0; i < ntextures; i++, out += mipmaps[miplevel].nbytes)
+        {
+            tctex_get_mipmaps(tex, mipmaps, miplevel + 1, i);
+            if(!read)
+            {
+                if(!tctex_i_in_memory(tex, mipmaps[miplevel].offset, mipmaps[miplevel].nbytes)) TCTEX_I_RETERROR(tex, "Unable to read the texture data (file truncated)");
+                memcpy(out, tex->memory + mipmaps[miplevel].offset, mipmaps[miplevel].nbytes);
+            }
+            else if(read(udata, mipmaps[miplevel].offset, out, mipmaps[miplevel].nbytes) != mipmaps[miplevel].nbytes)
+                TCTEX_I_RETERROR(tex, "Unable to read the texture data (file truncated?)");
+        }
+        return tex;
+    }
+
+    // KTX2: the level is already laid out like that, so it's a single copy (or decompression)
+    const uint8_t* level = tex->ilevels_ + miplevel * TCTEX_I_KTX2_LEVEL_SIZE;
+    uint64_t offset = tctex_i_read_le64(level);
+    uint64_t length = tctex_i_read_le64(level + 8);
+    if(!tex->supercompression)
+    {
+        if(!read)
+        {
+            if(!tctex_i_in_memory(tex, offset, dstlen)) TCTEX_I_RETERROR(tex, "Unable to read the texture data (file truncated)");
+            memcpy(dst, tex->memory + offset, dstlen);
+        }
+        else if(read(udata, offset, dst, dstlen) != dstlen)
+            TCTEX_I_RETERROR(tex, "Unable to read the texture data (file truncated?)");
+        return tex;
+    }
+    if(!decompress)
+    {
+#ifdef ZSTD_VERSION_MAJOR
+        if(read && tex->supercompression == TCTEX_SUPERCOMPRESSION_ZSTD)
+            return tctex_i_zstd_read_stream(tex, dst, dstlen, offset, length, read, udata);
+#endif
+        decompress = TCTEX_I_DEFAULT_DECOMPRESS;
+        if(!decompress) TCTEX_I_RETERROR(tex, "No decompressor available for the supercompression scheme");
+    }
+    if(length > SIZE_MAX) TCTEX_I_RETERROR(tex, "Level too large");
+
+    const void* src;
+    void* mem = NULL;
+    if(!read)
+    {
+        if(!tctex_i_in_memory(tex, offset, length)) TCTEX_I_RETERROR(tex, "Unable to read the texture data (file truncated)");
+        src = tex->memory + offset;
+    }
+    else
+    {
+        // a generic decompressor needs the entire (compressed) level
+        if(!(mem = malloc(TC__STATIC_CAST(size_t,length)))) TCTEX_I_RETERROR(tex, "Unable to allocate memory");
+        if(read(udata, offset, mem, TC__STATIC_CAST(size_t,length)) != length) { free(mem); TCTEX_I_RETERROR(tex, "Unable to read the texture data (file truncated?)"); }
+        src = mem;
+    }
+    size_t len = decompress(decompress_udata, tex->supercompression, dst, dstlen, src, TC__STATIC_CAST(size_t,length));
+    free(mem);
+    if(len != dstlen) TCTEX_I_RETERROR(tex, "Unable to decompress the texture data");
+    return tex;
+}
+
+void tctex_prefetch_mipmaps(const TCTex_Texture* tex, const TCTex_MipMapInfo* mipmaps, uint32_t nmipmaps)
+{
+    if(!tex || !tex->imemlen_ || !nmipmaps) return; // not mapped, so it's already in memory
+    if(tex->supercompression) return; // offsets are into the decompressed levels, not the file
+#ifndef TC_TEXTURE_LOAD_NO_STDIO
+    // the mipmaps of a texture are consecutive, so this is just a single range
+    uint64_t begin = mipmaps[0].offset, end = mipmaps[0].offset + mipmaps[0].nbytes;
+    uint32_t i;
+    for(i = 1; i < nmipmaps; i++)
+    {
+        if(begin > mipmaps[i].offset) begin = mipmaps[i].offset;
+        if(end < mipmaps[i].offset + mipmaps[i].nbytes) end = mipmaps[i].offset + mipmaps[i].nbytes;
+    }
+    if(end > tex->imemlen_) end = tex->imemlen_;
+    if(begin >= end) return;
+#ifdef _WIN32
+#if defined(_WIN32_WINNT) && _WIN32_WINNT >= 0x0602 /* PrefetchVirtualMemory is Windows 8+ */
+    WIN32_MEMORY_RANGE_ENTRY range;
+    range.VirtualAddress = TC__STATIC_CAST(uint8_t*,tex->imem_) + begin;
+    range.NumberOfBytes = TC__STATIC_CAST(SIZE_T,end - begin);
+    PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+#endif
+#elif defined(POSIX_MADV_WILLNEED) /* not declared in strict ISO C modes */
+    // madvise requires a page-aligned address
+    uint64_t pagesize = TC__STATIC_CAST(uint64_t,sysconf(_SC_PAGESIZE));
+    begin &= ~(pagesize - 1);
+    posix_madvise(TC__STATIC_CAST(uint8_t*,tex->imem_) + begin, TC__STATIC_CAST(size_t,end - begin), POSIX_MADV_WILLNEED);
+#endif
+#endif
+}
+
 void tctex_close(TCTex_Texture* tex)
 {
-    if(!tex) return;
-    if(tex->imem_) free(tex->imem_);
+    if(!tex || !tex->imem_) return;
+#ifndef TC_TEXTURE_LOAD_NO_STDIO
+    if(tex->imemlen_)
+    {
+#ifdef _WIN32
+        UnmapViewOfFile(tex->imem_);
+#else
+        munmap(tex->imem_, tex->imemlen_);
+#endif
+        return;
+    }
+#endif
+    free(tex->imem_);
 }
 
 #ifdef TC_TEXTURE_LOAD_VULKAN_FORMATS
@@ -2,12 +2,15 @@
  * tc_thread.h: Cross-platform threading & atomics.
  *
  * DEPENDS:
- * VERSION: 0.2.0 (2021-07-10)
+ * VERSION: 0.5.0 (2026-10-14)
  * LICENSE: CC0 & Boost (dual-licensed)
  * AUTHOR: Tim Cas
  * URL: https://github.com/darkuranium/tclib
  *
  * VERSION HISTORY:
+ * 0.5.0    added lock-free SPSC & MPMC queues, and cache-line padding helpers
+ * 0.4.0    added spinlocks, adaptive mutexes, and atomic wait/notify (futex-style)
+ * 0.3.0    added work-stealing thread pool & job system
  * 0.2.2    fixed some instances of malloc() not using TC_MALLOC
  * 0.2.1    fixed macros tcthread_atomic{32,sz}_{inc,dec}
  * 0.2.0    implemented semaphores & RW locks
@@ -17,8 +20,9 @@
  * - document semaphores, RW locks, and atomics
  * - tcthread_atexit; maybe tcthread_cancel (+ destructors)?
  * - initializers (if possible)
- * - spinlocks
- * - high-level threading: threadpool + job system
+ * - timed variant of `tcthread_atomic32_wait`
+ * - blocking variants of the lock-free queue operations (via `tcthread_atomic32_wait`)
+ * - thread pool: job allocation from a per-worker freelist
  *
  *
  *
@@ -152,6 +156,18 @@
  *
  *
  * SYNOPSIS:
+ *  void tcthread_yield(void);
+ *  void tcthread_cpu_relax(void);
+ * DESCRIPTION:
+ *  `tcthread_yield` gives up the rest of the current thread's time slice.
+ *
+ *  `tcthread_cpu_relax` does *not* give up the time slice; it only hints to
+ *  the processor that the thread is in a spin-wait loop (which reduces power
+ *  use and frees resources for its hyper-threaded sibling). It is a no-op on
+ *  processors that have no such hint.
+ *
+ *
+ * SYNOPSIS:
  *  tcthread_t tcthread_self(void);
  * RETURN VALUE:
  *  Returns a handle to own thread, or an invalid handle if this failed.
@@ -328,6 +344,249 @@
  *
  * SEE ALSO:
  *  - `tcthread_cond_wait` & `tcthread_cond_timed_wait` to wait on a condition variable (the opposite operation)
+ *
+ *
+ * ========== LIGHTWEIGHT LOCKS ==========
+ *
+ * SYNOPSIS:
+ *  #define TCTHREAD_SPINLOCK_INIT {0}
+ *  void tcthread_spinlock_init(tcthread_spinlock_t* lock);
+ *  void tcthread_spinlock_lock(tcthread_spinlock_t* lock);
+ *  bool tcthread_spinlock_try_lock(tcthread_spinlock_t* lock);
+ *  void tcthread_spinlock_unlock(tcthread_spinlock_t* lock);
+ *
+ *  #define TCTHREAD_AMUTEX_INIT {0}
+ *  void tcthread_amutex_init(tcthread_amutex_t* mutex);
+ *  void tcthread_amutex_lock(tcthread_amutex_t* mutex);
+ *  bool tcthread_amutex_try_lock(tcthread_amutex_t* mutex);
+ *  void tcthread_amutex_unlock(tcthread_amutex_t* mutex);
+ * PARAMETERS:
+ *  - lock, mutex: lock to operate on
+ * RETURN VALUE:
+ *  - tcthread_{spinlock,amutex}_try_lock: `true` if the lock was acquired, `false` otherwise
+ * DESCRIPTION:
+ *  Allocation-free locks, for short critical sections.
+ *
+ *  Unlike `tcthread_mutex_t`, these are plain values (they can be embedded
+ *  into other structures, and initialized statically with the `_INIT` macros
+ *  or dynamically with the `_init` functions), and need no destruction. The
+ *  uncontended lock and unlock are inlined, and need a single atomic operation
+ *  each.
+ *
+ *  `tcthread_spinlock_t` never sleeps: contended locks spin on a load (with
+ *  exponential backoff), and eventually start yielding the time slice. It is
+ *  best used when the lock is held for a few instructions at most.
+ *
+ *  `tcthread_amutex_t` (adaptive mutex) spins for a bounded time first, and
+ *  then parks the thread via `tcthread_atomic32_wait`. It is a good default.
+ *
+ *  Neither is recursive.
+ *
+ *
+ * ========== ATOMIC WAIT ==========
+ *
+ * SYNOPSIS:
+ *  void tcthread_atomic32_wait(volatile tcthread_atomic32_t* ptr, tcthread_atomic32_t expected);
+ *  void tcthread_atomic32_notify_one(volatile tcthread_atomic32_t* ptr);
+ *  void tcthread_atomic32_notify_all(volatile tcthread_atomic32_t* ptr);
+ * PARAMETERS:
+ *  - ptr: address to wait on or notify
+ *  - expected: value to compare against
+ * DESCRIPTION:
+ *  Wait for a value to change, and wake up threads waiting for it to change.
+ *
+ *  If `*ptr == expected`, `tcthread_atomic32_wait` puts the thread to sleep
+ *  until it is woken up by a notify on the same address; the check and sleep
+ *  are a single atomic step with respect to notifications. Spurious wakeups
+ *  are possible, so the value should be rechecked in a loop:
+ *
+ *      while(tcthread_atomic32_load_explicit(&flag, TCTHREAD_MEMORDER_ACQUIRE) == 0)
+ *          tcthread_atomic32_wait(&flag, 0);
+ *
+ *  `notify_one` wakes (at least) one waiter, `notify_all` wakes all of them.
+ *  They should be called *after* the value has been modified.
+ *
+ *  This uses futexes on Linux, `__ulock_wait` on macOS, `WaitOnAddress` on
+ *  Windows 8+, and a table of condition variables hashed by address elsewhere.
+ *
+ *
+ * ========== LOCK-FREE QUEUES ==========
+ *
+ * SYNOPSIS:
+ *  #define TCTHREAD_CACHELINE  64
+ *  #define TCTHREAD_CACHELINE_ALIGNED
+ *  typedef struct tcthread_atomic32_padded { tcthread_atomic32_t value; ... } tcthread_atomic32_padded_t;
+ *  typedef struct tcthread_atomicsz_padded { tcthread_atomicsz_t value; ... } tcthread_atomicsz_padded_t;
+ * DESCRIPTION:
+ *  Helpers to avoid false sharing.
+ *
+ *  `TCTHREAD_CACHELINE` is the (assumed) size of a cache line; it can be
+ *  overridden by defining it before including the header. It is 128 on Apple
+ *  ARM and 64-bit POWER, and 64 elsewhere.
+ *
+ *  `TCTHREAD_CACHELINE_ALIGNED` is an alignment specifier for declarations,
+ *  as in `TCTHREAD_CACHELINE_ALIGNED tcthread_atomic32_t counter;`. Note that
+ *  `malloc` does not honor such alignment.
+ *
+ *  The padded types occupy (and are aligned to) one full cache line each.
+ *
+ *
+ * SYNOPSIS:
+ *  tcthread_spsc_queue_t tcthread_spsc_queue_create(size_t capacity);
+ *  bool tcthread_spsc_queue_is_valid(tcthread_spsc_queue_t queue);
+ *  void tcthread_spsc_queue_destroy(tcthread_spsc_queue_t queue);
+ *  bool tcthread_spsc_queue_try_push(tcthread_spsc_queue_t queue, void* item);
+ *  bool tcthread_spsc_queue_try_pop(tcthread_spsc_queue_t queue, void** item);
+ *
+ *  tcthread_mpmc_queue_t tcthread_mpmc_queue_create(size_t capacity);
+ *  bool tcthread_mpmc_queue_is_valid(tcthread_mpmc_queue_t queue);
+ *  void tcthread_mpmc_queue_destroy(tcthread_mpmc_queue_t queue);
+ *  bool tcthread_mpmc_queue_try_push(tcthread_mpmc_queue_t queue, void* item);
+ *  bool tcthread_mpmc_queue_try_pop(tcthread_mpmc_queue_t queue, void** item);
+ * PARAMETERS:
+ *  - capacity: maximum number of items in the queue; rounded up to a power of 2
+ *  - queue: queue to operate on
+ *  - item: item to push, or where to store the popped item
+ * RETURN VALUE:
+ *  - tcthread_*_queue_try_push: `false` if the queue was full
+ *  - tcthread_*_queue_try_pop: `false` if the queue was empty
+ * DESCRIPTION:
+ *  Lock-free, bounded FIFO queues of `void*` items.
+ *
+ *  `tcthread_spsc_queue_t` is a ring buffer that allows a single producer
+ *  thread and a single consumer thread (at a time). Each side keeps a cached
+ *  copy of the other side's index, so that it only needs to touch the other
+ *  side's cache line when the queue looks full (or empty).
+ *
+ *  `tcthread_mpmc_queue_t` is Dmitry Vyukov's bounded MPMC queue, which allows
+ *  any number of producers and consumers. Each push & pop is a single CAS in
+ *  the common case.
+ *
+ *  Neither operation blocks; if waiting is needed, combine the queue with
+ *  e.g. `tcthread_sem_t` or `tcthread_atomic32_wait` (or spin with
+ *  `tcthread_cpu_relax`, in latency-critical code).
+ *
+ *
+ * ========== THREAD POOL ==========
+ *
+ * SYNOPSIS:
+ *  tcthread_pool_t tcthread_pool_create(uint32_t nthreads, uint32_t flags);
+ *  bool tcthread_pool_is_valid(tcthread_pool_t pool);
+ * PARAMETERS:
+ *  - nthreads: number of worker threads, or `0` to use `tcthread_get_cpu_count()`
+ *  - flags: `0` or `TCTHREAD_POOL_PIN_THREADS`
+ *  - pool: pool to check the validity of
+ * RETURN VALUE:
+ *  - tcthread_pool_create: the newly-created pool; use `tcthread_pool_is_valid` to verify if creation was successful
+ *  - tcthread_pool_is_valid: whether the pool creation was successful
+ * DESCRIPTION:
+ *  Create a work-stealing thread pool.
+ *
+ *  Each worker owns a Chase-Lev deque: jobs submitted from within a worker go
+ *  onto that worker's own deque (and are run LIFO by it), while idle workers
+ *  steal from the other end of other workers' deques. Jobs submitted from
+ *  threads outside the pool (or that do not fit into a full deque, which holds
+ *  `TCTHREAD_POOL_DEQUE_SIZE` jobs) go into a shared FIFO queue instead. Idle
+ *  workers spin briefly before going to sleep.
+ *
+ *  With `TCTHREAD_POOL_PIN_THREADS`, worker `i` is pinned to logical core
+ *  `i % tcthread_get_cpu_count()`. This is a hint; it is silently ignored if
+ *  unsupported (on Linux, it requires `_GNU_SOURCE` to be defined before any
+ *  system header is included).
+ *
+ *
+ * SYNOPSIS:
+ *  void tcthread_pool_destroy(tcthread_pool_t pool);
+ * PARAMETERS:
+ *  - pool: pool to destroy
+ * DESCRIPTION:
+ *  Run all remaining submitted jobs, then stop and join all workers.
+ *
+ *  This must not be called from within one of the pool's own jobs.
+ *
+ *
+ * SYNOPSIS:
+ *  uint32_t tcthread_pool_get_thread_count(tcthread_pool_t pool);
+ *  int32_t tcthread_pool_get_worker_index(tcthread_pool_t pool);
+ * RETURN VALUE:
+ *  - tcthread_pool_get_thread_count: number of worker threads in the pool
+ *  - tcthread_pool_get_worker_index: index of the calling worker (in `[0,nthreads)`), or `-1` if the caller is not one of `pool`'s workers
+ * DESCRIPTION:
+ *  The worker index is useful for indexing per-thread scratch or accumulation
+ *  buffers from within jobs.
+ *
+ *
+ * SYNOPSIS:
+ *  typedef void tcthread_jobfunc_t(tcthread_job_t job, void* udata);
+ *  tcthread_job_t tcthread_job_create(tcthread_pool_t pool, tcthread_job_t parent, tcthread_jobfunc_t* func, void* udata);
+ *  bool tcthread_job_is_valid(tcthread_job_t job);
+ *  void tcthread_job_submit(tcthread_job_t job);
+ *  void tcthread_job_release(tcthread_job_t job);
+ * PARAMETERS:
+ *  - pool: pool to run the job on
+ *  - parent: parent job, or a zero-initialized handle for none
+ *  - func: function to run; may be `NULL` for a job that only serves as a synchronization point
+ *  - udata: user data, passed to the function
+ *  - job: job to submit or release
+ * DESCRIPTION:
+ *  Create, submit, and release a job.
+ *
+ *  A job is only *done* once its function has returned *and* all of its
+ *  children (jobs created with it as `parent`) are done. Children must be
+ *  created before the parent is done --- typically, from within the parent's
+ *  function, or before the parent is submitted.
+ *
+ *  Every created job must be submitted exactly once. A job runs as soon as it
+ *  has been submitted and all of its predecessors (see `tcthread_job_then`)
+ *  are done.
+ *
+ *  Every created job must also be released exactly once, after which the
+ *  handle must not be used again. Releasing a job that has not yet finished
+ *  is allowed; the job still runs, with its memory freed afterwards.
+ *
+ *
+ * SYNOPSIS:
+ *  bool tcthread_job_then(tcthread_job_t job, tcthread_job_t continuation);
+ * PARAMETERS:
+ *  - job: the predecessor
+ *  - continuation: job to run once `job` is done
+ * RETURN VALUE:
+ *  `true` on success, `false` if `job` already has `TCTHREAD_JOB_MAX_CONTINUATIONS` continuations.
+ * DESCRIPTION:
+ *  Make `continuation` wait for `job` to be done before it is allowed to run.
+ *
+ *  Both jobs must not have been submitted yet. A continuation may have any
+ *  number of predecessors.
+ *
+ *
+ * SYNOPSIS:
+ *  bool tcthread_job_is_done(tcthread_job_t job);
+ *  void tcthread_job_wait(tcthread_job_t job);
+ * PARAMETERS:
+ *  - job: job to check or wait for
+ * DESCRIPTION:
+ *  Check whether a job (and all its children) is done, or wait for it to be.
+ *
+ *  Instead of simply blocking, `tcthread_job_wait` runs other pending jobs
+ *  while it waits; it only sleeps if there is no other work available. As such,
+ *  it is safe (and recommended) to use from within a job itself.
+ *
+ *
+ * SYNOPSIS:
+ *  typedef void tcthread_rangefunc_t(size_t begin, size_t end, void* udata);
+ *  void tcthread_pool_parallel_for(tcthread_pool_t pool, size_t count, size_t grain, tcthread_rangefunc_t* func, void* udata);
+ * PARAMETERS:
+ *  - pool: pool to run on
+ *  - count: number of items; `func` is called for subranges of `[0,count)`
+ *  - grain: minimum number of items per call, or `0` to pick one automatically
+ *  - func: function to call for each subrange `[begin,end)`
+ *  - udata: user data, passed to the function
+ * DESCRIPTION:
+ *  Process `[0,count)` in parallel, and wait for the processing to complete.
+ *
+ *  The range is split lazily: each job keeps splitting off the upper half of
+ *  its range as a new (stealable) job, until it is down to `grain` items. This
+ *  keeps the number of jobs low when the other workers are busy.
  */
 
 #ifndef TC_THREAD_H_
@@ -362,6 +621,26 @@ extern "C" {
 #endif
 #endif /* TC__REINTERPRET_CAST */
 
+#ifndef TCTHREAD_CACHELINE
+#if (defined(__APPLE__) && defined(__aarch64__)) || defined(__powerpc64__) || defined(__ppc64__)
+#define TCTHREAD_CACHELINE  128
+#else
+#define TCTHREAD_CACHELINE  64
+#endif
+#endif /* TCTHREAD_CACHELINE */
+// alignment specifier (used as a prefix), for values that should not share a cache line with others
+#if defined(__cplusplus) && __cplusplus >= 201103L
+#define TCTHREAD_CACHELINE_ALIGNED  alignas(TCTHREAD_CACHELINE)
+#elif __STDC_VERSION__ >= 201112L
+#define TCTHREAD_CACHELINE_ALIGNED  _Alignas(TCTHREAD_CACHELINE)
+#elif defined(_MSC_VER)
+#define TCTHREAD_CACHELINE_ALIGNED  __declspec(align(TCTHREAD_CACHELINE))
+#elif defined(__GNUC__)
+#define TCTHREAD_CACHELINE_ALIGNED  __attribute__((aligned(TCTHREAD_CACHELINE)))
+#else
+#define TCTHREAD_CACHELINE_ALIGNED
+#endif
+
 // wrapped in structs for type-safety, but otherwise raw handles
 typedef struct tcthread { uintptr_t handle; } tcthread_t;
 typedef struct tcthread_mutex { uintptr_t handle; } tcthread_mutex_t;
@@ -382,6 +661,9 @@ void tcthread_detach(tcthread_t thread);
 // works with current thread
 TC_HINT_NORETURN void tcthread_exit(void* retval);   // WARNING: May or may not run C++ destructors
 void tcthread_sleep(uint32_t ms);
+void tcthread_yield(void);
+// hint to the CPU that we're in a spin-wait loop (`pause` on x86, `yield` on ARM)
+void tcthread_cpu_relax(void);
 // only works with threads started with `tcthread_create`; TODO: make it work for all
 tcthread_t tcthread_self(void);
 
@@ -424,6 +706,28 @@ void tcthread_rwlock_lock_wr(tcthread_rwlock_t rwlock);
 bool tcthread_rwlock_try_lock_wr(tcthread_rwlock_t rwlock);
 void tcthread_rwlock_unlock_wr(tcthread_rwlock_t rwlock);
 
+// Thread Pool & Jobs
+#define TCTHREAD_POOL_PIN_THREADS   0x1     // pin each worker to a single logical core
+typedef struct tcthread_pool { uintptr_t handle; } tcthread_pool_t;
+typedef struct tcthread_job { uintptr_t handle; } tcthread_job_t;
+typedef void tcthread_jobfunc_t(tcthread_job_t job, void* udata);
+typedef void tcthread_rangefunc_t(size_t begin, size_t end, void* udata);
+tcthread_pool_t tcthread_pool_create(uint32_t nthreads, uint32_t flags);
+inline bool tcthread_pool_is_valid(tcthread_pool_t pool) { return pool.handle; }
+void tcthread_pool_destroy(tcthread_pool_t pool);
+uint32_t tcthread_pool_get_thread_count(tcthread_pool_t pool);
+// returns -1 if the calling thread is not a worker of `pool`
+int32_t tcthread_pool_get_worker_index(tcthread_pool_t pool);
+void tcthread_pool_parallel_for(tcthread_pool_t pool, size_t count, size_t grain, tcthread_rangefunc_t* func, void* udata);
+
+tcthread_job_t tcthread_job_create(tcthread_pool_t pool, tcthread_job_t parent, tcthread_jobfunc_t* func, void* udata);
+inline bool tcthread_job_is_valid(tcthread_job_t job) { return job.handle; }
+bool tcthread_job_then(tcthread_job_t job, tcthread_job_t continuation);
+void tcthread_job_submit(tcthread_job_t job);
+bool tcthread_job_is_done(tcthread_job_t job);
+void tcthread_job_wait(tcthread_job_t job);
+void tcthread_job_release(tcthread_job_t job);
+
 // ********** ATOMICS **********
 typedef uint8_t tcthread_atomicbool_t;  // uses the smallest available atomic type
 typedef uint32_t tcthread_atomic32_t;
@@ -1383,6 +1687,75 @@ inline tcthread_atomicptr_t tcthread_atomicptr_compare_exchange_weak_explicit(vo
 #define tcthread_atomic32_initref(ptr, value)   tcthread_atomic32_store_explicit(ptr, value, TCTHREAD_MEMORDER_RELEASE)
 #define tcthread_atomic32_loadref(ptr)          tcthread_atomic32_load_explicit(ptr, TCTHREAD_MEMORDER_ACQUIRE)
 
+// ***** wait & notify *****
+// blocks while `*ptr == expected`; may wake up spuriously, so this should be used in a loop
+void tcthread_atomic32_wait(volatile tcthread_atomic32_t* ptr, tcthread_atomic32_t expected);
+void tcthread_atomic32_notify_one(volatile tcthread_atomic32_t* ptr);
+void tcthread_atomic32_notify_all(volatile tcthread_atomic32_t* ptr);
+
+// ********** LIGHTWEIGHT LOCKS **********
+// these need no allocation (and no _destroy); uncontended lock & unlock are a single atomic operation each
+
+// Spinlock (test-and-test-and-set, with backoff)
+typedef struct tcthread_spinlock { tcthread_atomic32_t state; } tcthread_spinlock_t;
+#define TCTHREAD_SPINLOCK_INIT  {0}
+void tcthread_spinlock_lock_slow_(tcthread_spinlock_t* lock);
+inline void tcthread_spinlock_init(tcthread_spinlock_t* lock) { tcthread_atomic32_store_explicit(&lock->state, 0, TCTHREAD_MEMORDER_RELAXED); }
+inline void tcthread_spinlock_lock(tcthread_spinlock_t* lock)
+{
+    if(tcthread_atomic32_exchange_explicit(&lock->state, 1, TCTHREAD_MEMORDER_ACQUIRE))
+        tcthread_spinlock_lock_slow_(lock);
+}
+inline bool tcthread_spinlock_try_lock(tcthread_spinlock_t* lock)
+{
+    return !tcthread_atomic32_load_explicit(&lock->state, TCTHREAD_MEMORDER_RELAXED)
+        && !tcthread_atomic32_exchange_explicit(&lock->state, 1, TCTHREAD_MEMORDER_ACQUIRE);
+}
+inline void tcthread_spinlock_unlock(tcthread_spinlock_t* lock) { tcthread_atomic32_store_explicit(&lock->state, 0, TCTHREAD_MEMORDER_RELEASE); }
+
+// Adaptive Mutex (spins for a while, then parks via `tcthread_atomic32_wait`); non-recursive
+typedef struct tcthread_amutex { tcthread_atomic32_t state; } tcthread_amutex_t;   // 0=unlocked, 1=locked, 2=locked & (possibly) contended
+#define TCTHREAD_AMUTEX_INIT    {0}
+void tcthread_amutex_lock_slow_(tcthread_amutex_t* mutex);
+inline void tcthread_amutex_init(tcthread_amutex_t* mutex) { tcthread_atomic32_store_explicit(&mutex->state, 0, TCTHREAD_MEMORDER_RELAXED); }
+inline void tcthread_amutex_lock(tcthread_amutex_t* mutex)
+{
+    if(tcthread_atomic32_compare_exchange_strong_explicit(&mutex->state, 0, 1, TCTHREAD_MEMORDER_ACQUIRE, TCTHREAD_MEMORDER_RELAXED))
+        tcthread_amutex_lock_slow_(mutex);
+}
+inline bool tcthread_amutex_try_lock(tcthread_amutex_t* mutex)
+{
+    return !tcthread_atomic32_compare_exchange_strong_explicit(&mutex->state, 0, 1, TCTHREAD_MEMORDER_ACQUIRE, TCTHREAD_MEMORDER_RELAXED);
+}
+inline void tcthread_amutex_unlock(tcthread_amutex_t* mutex)
+{
+    if(tcthread_atomic32_exchange_explicit(&mutex->state, 0, TCTHREAD_MEMORDER_RELEASE) == 2)
+        tcthread_atomic32_notify_one(&mutex->state);
+}
+
+// ********** LOCK-FREE QUEUES **********
+// padded atomics, to prevent false sharing between values that are written by different threads
+typedef struct tcthread_atomic32_padded { TCTHREAD_CACHELINE_ALIGNED tcthread_atomic32_t value; char pad_[TCTHREAD_CACHELINE - sizeof(tcthread_atomic32_t)]; } tcthread_atomic32_padded_t;
+typedef struct tcthread_atomicsz_padded { TCTHREAD_CACHELINE_ALIGNED tcthread_atomicsz_t value; char pad_[TCTHREAD_CACHELINE - sizeof(tcthread_atomicsz_t)]; } tcthread_atomicsz_padded_t;
+
+// bounded queues of `void*` items; capacity is rounded up to a power of 2
+typedef struct tcthread_spsc_queue { uintptr_t handle; } tcthread_spsc_queue_t;
+typedef struct tcthread_mpmc_queue { uintptr_t handle; } tcthread_mpmc_queue_t;
+
+// Single-Producer Single-Consumer
+tcthread_spsc_queue_t tcthread_spsc_queue_create(size_t capacity);
+inline bool tcthread_spsc_queue_is_valid(tcthread_spsc_queue_t queue) { return queue.handle; }
+void tcthread_spsc_queue_destroy(tcthread_spsc_queue_t queue);
+bool tcthread_spsc_queue_try_push(tcthread_spsc_queue_t queue, void* item);
+bool tcthread_spsc_queue_try_pop(tcthread_spsc_queue_t queue, void** item);
+
+// Multi-Producer Multi-Consumer
+tcthread_mpmc_queue_t tcthread_mpmc_queue_create(size_t capacity);
+inline bool tcthread_mpmc_queue_is_valid(tcthread_mpmc_queue_t queue) { return queue.handle; }
+void tcthread_mpmc_queue_destroy(tcthread_mpmc_queue_t queue);
+bool tcthread_mpmc_queue_try_push(tcthread_mpmc_queue_t queue, void* item);
+bool tcthread_mpmc_queue_try_pop(tcthread_mpmc_queue_t queue, void** item);
+
 #ifdef __cplusplus
 }
 #endif
@@ -1429,7 +1802,7 @@ inline tcthread_atomicptr_t tcthread_atomicptr_compare_exchange_weak_explicit(vo
 
 #ifdef _WIN32
 #define TCTHREAD__PLATFORM_WINDOWS
-#elif (defined(__unix__) || defined(unix)) && !defined(USG)
+#elif ((defined(__unix__) || defined(unix)) && !defined(USG)) || (defined(__APPLE__) && defined(__MACH__))
 #define TCTHREAD__PLATFORM_POSIX
 #include <sys/param.h>
 #if defined(BSD) && (BSD >= 199103)
@@ -1503,7 +1876,7 @@ union winapi_GetActiveProcessorCount_conv
 };
 #elif defined(TCTHREAD__PLATFORM_POSIX)
 
-#if TCTHREAD__PLATFORM_POSIX_BSD
+#ifdef TCTHREAD__PLATFORM_POSIX_BSD
 #include <sys/sysctl.h> // for sysctl
 #else
 #include <unistd.h>     // for sysconf
@@ -1514,6 +1887,20 @@ union winapi_GetActiveProcessorCount_conv
 #include <semaphore.h>
 #include <time.h>
 #include <errno.h>
+#include <limits.h>
+#include <sched.h>      // for sched_yield & sched_setaffinity (the latter only on Linux, with _GNU_SOURCE)
+#if defined(__linux__)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>     // for syscall
+#elif defined(__APPLE__) && defined(__MACH__)
+// private (but stable) API, as used by libc++ for `std::atomic::wait`
+extern int __ulock_wait(uint32_t operation, void* addr, uint64_t value, uint32_t timeout_us);
+extern int __ulock_wake(uint32_t operation, void* addr, uint64_t wake_value);
+#define TCTHREAD__UL_COMPARE_AND_WAIT   1
+#define TCTHREAD__ULF_WAKE_ALL          0x00000100
+#define TCTHREAD__ULF_NO_ERRNO          0x01000000
+#endif
 static pthread_once_t tcthread_init_once_ = PTHREAD_ONCE_INIT;
 static pthread_key_t tcthread_tls_key_;
 static void tcthread_init_once_runner_(void)
@@ -1821,6 +2208,27 @@ void tcthread_sleep(uint32_t ms)
     #pragma message ("Warning: tcthread_sleep uninplemented on platform")
 #endif
 }
+void tcthread_yield(void)
+{
+#if defined(TCTHREAD__PLATFORM_WINDOWS)
+    SwitchToThread();
+#elif defined(TCTHREAD__PLATFORM_POSIX)
+    sched_yield();
+#else
+    #pragma message ("Warning: tcthread_yield uninplemented on platform")
+#endif
+}
+void tcthread_cpu_relax(void)
+{
+#if defined(TCTHREAD__PLATFORM_WINDOWS)
+    YieldProcessor();
+#elif defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+    __builtin_ia32_pause();
+#elif defined(__GNUC__) && (defined(__aarch64__) || (defined(__arm__) && __ARM_ARCH >= 7))
+    __asm__ __volatile__("yield");
+#endif
+    // (no-op on other platforms, which is fine)
+}
 tcthread_t tcthread_self(void)
 {
 #if defined(TCTHREAD__PLATFORM_WINDOWS)
@@ -2326,6 +2734,953 @@ void tcthread_rwlock_unlock_wr(tcthread_rwlock_t rwlock)
 }
 
 
+// Atomic Wait & Notify
+/*
+ * Where no native address-based wait is available (everything except Linux,
+ * macOS, and Windows 8+), waiters park on one of a fixed set of mutex+condvar
+ * buckets, selected by address. Since buckets are shared, `notify_one` has to
+ * wake all of the bucket's waiters in that case.
+ */
+#if defined(TCTHREAD__PLATFORM_WINDOWS) || (defined(TCTHREAD__PLATFORM_POSIX) && !defined(__linux__) && !(defined(__APPLE__) && defined(__MACH__)))
+#define TCTHREAD__WAIT_PARKING
+#define TCTHREAD__PARKING_NBUCKETS  64
+static uint32_t tcthread_parking_index_(volatile tcthread_atomic32_t* ptr)
+{
+    uintptr_t addr = TC__REINTERPRET_CAST(uintptr_t, ptr);
+    return TC__STATIC_CAST(uint32_t, (addr >> 2) * UINT32_C(2654435761)) >> (32 - 6);
+}
+#endif
+#if defined(TCTHREAD__PLATFORM_WINDOWS)
+typedef BOOL WINAPI winapi_WaitOnAddress_t(volatile VOID*, PVOID, SIZE_T, DWORD);
+typedef VOID WINAPI winapi_WakeByAddress_t(PVOID);
+union winapi_WaitOnAddress_conv
+{
+    FARPROC farproc;
+    winapi_WaitOnAddress_t* wait;
+    winapi_WakeByAddress_t* wake;
+};
+static winapi_WaitOnAddress_t* winapi_WaitOnAddress;
+static winapi_WakeByAddress_t* winapi_WakeByAddressSingle;
+static winapi_WakeByAddress_t* winapi_WakeByAddressAll;
+static INIT_ONCE tcthread_wait_init_once_ = INIT_ONCE_STATIC_INIT;
+static BOOL CALLBACK tcthread_wait_init_once_runner_(PINIT_ONCE init_once, PVOID param, PVOID* context)
+{
+    TC__PARAM_UNUSED(init_once);
+    TC__PARAM_UNUSED(param);
+    *context = NULL;
+    // loaded at runtime, since `WaitOnAddress` needs Windows 8 (we want to support Vista & Server 2008)
+    HMODULE lib = LoadLibraryW(L"api-ms-win-core-synch-l1-2-0.dll");
+    if(!lib)
+        return TRUE;    // (not an error; we just use the fallback)
+    union winapi_WaitOnAddress_conv wait, wake_single, wake_all;
+    wait.farproc = GetProcAddress(lib, "WaitOnAddress");
+    wake_single.farproc = GetProcAddress(lib, "WakeByAddressSingle");
+    wake_all.farproc = GetProcAddress(lib, "WakeByAddressAll");
+    if(wait.farproc && wake_single.farproc && wake_all.farproc)
+    {
+        winapi_WaitOnAddress = wait.wait;
+        winapi_WakeByAddressSingle = wake_single.wake;
+        winapi_WakeByAddressAll = wake_all.wake;
+    }
+    else
+        FreeLibrary(lib);
+    return TRUE;
+}
+static struct tcthread_parking_bucket_
+{
+    SRWLOCK lock;
+    CONDITION_VARIABLE cond;
+} tcthread_parking_buckets_[TCTHREAD__PARKING_NBUCKETS];    // zero-initialization is equivalent to SRWLOCK_INIT & CONDITION_VARIABLE_INIT
+#elif defined(TCTHREAD__WAIT_PARKING)
+static struct tcthread_parking_bucket_
+{
+    pthread_mutex_t mutex;
+    pthread_cond_t cond;
+} tcthread_parking_buckets_[TCTHREAD__PARKING_NBUCKETS];
+static pthread_once_t tcthread_parking_init_once_ = PTHREAD_ONCE_INIT;
+static void tcthread_parking_init_once_runner_(void)
+{
+    for(uint32_t i = 0; i < TCTHREAD__PARKING_NBUCKETS; i++)
+    {
+        pthread_mutex_init(&tcthread_parking_buckets_[i].mutex, NULL);
+        pthread_cond_init(&tcthread_parking_buckets_[i].cond, NULL);
+    }
+}
+#endif
+#ifdef TCTHREAD__WAIT_PARKING
+static void tcthread_parking_wait_(volatile tcthread_atomic32_t* ptr, tcthread_atomic32_t expected)
+{
+    struct tcthread_parking_bucket_* bucket = &tcthread_parking_buckets_[tcthread_parking_index_(ptr)];
+#if defined(TCTHREAD__PLATFORM_WINDOWS)
+    AcquireSRWLockExclusive(&bucket->lock);
+    if(tcthread_atomic32_load_explicit(ptr, TCTHREAD_MEMORDER_RELAXED) == expected)
+        SleepConditionVariableSRW(&bucket->cond, &bucket->lock, INFINITE, 0);
+    ReleaseSRWLockExclusive(&bucket->lock);
+#else
+    pthread_once(&tcthread_parking_init_once_, tcthread_parking_init_once_runner_);
+    pthread_mutex_lock(&bucket->mutex);
+    if(tcthread_atomic32_load_explicit(ptr, TCTHREAD_MEMORDER_RELAXED) == expected)
+        pthread_cond_wait(&bucket->cond, &bucket->mutex);
+    pthread_mutex_unlock(&bucket->mutex);
+#endif
+}
+static void tcthread_parking_notify_(volatile tcthread_atomic32_t* ptr)
+{
+    struct tcthread_parking_bucket_* bucket = &tcthread_parking_buckets_[tcthread_parking_index_(ptr)];
+    // lock & unlock to ensure a waiter is either fully asleep, or yet to see the new value
+#if defined(TCTHREAD__PLATFORM_WINDOWS)
+    AcquireSRWLockExclusive(&bucket->lock);
+    ReleaseSRWLockExclusive(&bucket->lock);
+    WakeAllConditionVariable(&bucket->cond);
+#else
+    pthread_once(&tcthread_parking_init_once_, tcthread_parking_init_once_runner_);
+    pthread_mutex_lock(&bucket->mutex);
+    pthread_mutex_unlock(&bucket->mutex);
+    pthread_cond_broadcast(&bucket->cond);
+#endif
+}
+#endif /* TCTHREAD__WAIT_PARKING */
+void tcthread_atomic32_wait(volatile tcthread_atomic32_t* ptr, tcthread_atomic32_t expected)
+{
+#if defined(TCTHREAD__PLATFORM_WINDOWS)
+    PVOID init_once_context;
+    InitOnceExecuteOnce(&tcthread_wait_init_once_, tcthread_wait_init_once_runner_, NULL, &init_once_context);
+    if(winapi_WaitOnAddress)
+        winapi_WaitOnAddress(ptr, &expected, sizeof(expected), INFINITE);
+    else
+        tcthread_parking_wait_(ptr, expected);
+#elif defined(TCTHREAD__PLATFORM_POSIX) && defined(__linux__)
+    // EAGAIN (value already changed) and EINTR are simply treated as spurious wakeups
+    syscall(SYS_futex, ptr, FUTEX_WAIT_PRIVATE, expected, NULL, NULL, 0);
+#elif defined(TCTHREAD__PLATFORM_POSIX) && defined(__APPLE__) && defined(__MACH__)
+    __ulock_wait(TCTHREAD__UL_COMPARE_AND_WAIT | TCTHREAD__ULF_NO_ERRNO, (void*)ptr, expected, 0);
+#elif defined(TCTHREAD__PLATFORM_POSIX)
+    tcthread_parking_wait_(ptr, expected);
+#else
+    #pragma message ("Warning: tcthread_atomic32_wait uninplemented on platform")
+#endif
+}
+void tcthread_atomic32_notify_one(volatile tcthread_atomic32_t* ptr)
+{
+#if defined(TCTHREAD__PLATFORM_WINDOWS)
+    PVOID init_once_context;
+    InitOnceExecuteOnce(&tcthread_wait_init_once_, tcthread_wait_init_once_runner_, NULL, &init_once_context);
+    if(winapi_WakeByAddressSingle)
+        winapi_WakeByAddressSingle((PVOID)ptr);
+    else
+        tcthread_parking_notify_(ptr);
+#elif defined(TCTHREAD__PLATFORM_POSIX) && defined(__linux__)
+    syscall(SYS_futex, ptr, FUTEX_WAKE_PRIVATE, 1, NULL, NULL, 0);
+#elif defined(TCTHREAD__PLATFORM_POSIX) && defined(__APPLE__) && defined(__MACH__)
+    __ulock_wake(TCTHREAD__UL_COMPARE_AND_WAIT | TCTHREAD__ULF_NO_ERRNO, (void*)ptr, 0);
+#elif defined(TCTHREAD__PLATFORM_POSIX)
+    tcthread_parking_notify_(ptr);
+#else
+    #pragma message ("Warning: tcthread_atomic32_notify_one uninplemented on platform")
+#endif
+}
+void tcthread_atomic32_notify_all(volatile tcthread_atomic32_t* ptr)
+{
+#if defined(TCTHREAD__PLATFORM_WINDOWS)
+    PVOID init_once_context;
+    InitOnceExecuteOnce(&tcthread_wait_init_once_, tcthread_wait_init_once_runner_, NULL, &init_once_context);
+    if(winapi_WakeByAddressAll)
+        winapi_WakeByAddressAll((PVOID)ptr);
+    else
+        tcthread_parking_notify_(ptr);
+#elif defined(TCTHREAD__PLATFORM_POSIX) && defined(__linux__)
+    syscall(SYS_futex, ptr, FUTEX_WAKE_PRIVATE, INT_MAX, NULL, NULL, 0);
+#elif defined(TCTHREAD__PLATFORM_POSIX) && defined(__APPLE__) && defined(__MACH__)
+    __ulock_wake(TCTHREAD__UL_COMPARE_AND_WAIT | TCTHREAD__ULF_NO_ERRNO | TCTHREAD__ULF_WAKE_ALL, (void*)ptr, 0);
+#elif defined(TCTHREAD__PLATFORM_POSIX)
+    tcthread_parking_notify_(ptr);
+#else
+    #pragma message ("Warning: tcthread_atomic32_notify_all uninplemented on platform")
+#endif
+}
+
+
+// Lightweight Locks
+#ifndef TCTHREAD_SPINLOCK_MAX_BACKOFF
+#define TCTHREAD_SPINLOCK_MAX_BACKOFF   64      // max # of `tcthread_cpu_relax` per iteration, before we start yielding instead
+#endif
+#ifndef TCTHREAD_AMUTEX_SPIN_COUNT
+#define TCTHREAD_AMUTEX_SPIN_COUNT      100     // # of spins before parking
+#endif
+void tcthread_spinlock_lock_slow_(tcthread_spinlock_t* lock)
+{
+    uint32_t backoff = 1;
+    do
+    {
+        // spin on a plain load (keeping the cache line shared), and only retry the exchange once it looks free
+        while(tcthread_atomic32_load_explicit(&lock->state, TCTHREAD_MEMORDER_RELAXED))
+        {
+            if(backoff <= TCTHREAD_SPINLOCK_MAX_BACKOFF)
+            {
+                for(uint32_t i = 0; i < backoff; i++)
+                    tcthread_cpu_relax();
+                backoff <<= 1;
+            }
+            else
+                tcthread_yield();
+        }
+    }
+    while(tcthread_atomic32_exchange_explicit(&lock->state, 1, TCTHREAD_MEMORDER_ACQUIRE));
+}
+void tcthread_spinlock_init(tcthread_spinlock_t* lock);
+void tcthread_spinlock_lock(tcthread_spinlock_t* lock);
+bool tcthread_spinlock_try_lock(tcthread_spinlock_t* lock);
+void tcthread_spinlock_unlock(tcthread_spinlock_t* lock);
+
+// see "Futexes Are Tricky" (Drepper, 2011), mutex #2; plus a bounded spin before parking
+void tcthread_amutex_lock_slow_(tcthread_amutex_t* mutex)
+{
+    for(uint32_t i = 0; i < TCTHREAD_AMUTEX_SPIN_COUNT; i++)
+    {
+        tcthread_atomic32_t state = tcthread_atomic32_load_explicit(&mutex->state, TCTHREAD_MEMORDER_RELAXED);
+        if(!state)
+        {
+            if(!tcthread_atomic32_compare_exchange_strong_explicit(&mutex->state, 0, 1, TCTHREAD_MEMORDER_ACQUIRE, TCTHREAD_MEMORDER_RELAXED))
+                return;
+        }
+        else if(state == 2)
+            break;  // others are already parked; no point in spinning
+        tcthread_cpu_relax();
+    }
+    // mark as contended; if we acquire it this way, the state stays at 2 (costing an extra notify on unlock, which is harmless)
+    while(tcthread_atomic32_exchange_explicit(&mutex->state, 2, TCTHREAD_MEMORDER_ACQUIRE))
+        tcthread_atomic32_wait(&mutex->state, 2);
+}
+void tcthread_amutex_init(tcthread_amutex_t* mutex);
+void tcthread_amutex_lock(tcthread_amutex_t* mutex);
+bool tcthread_amutex_try_lock(tcthread_amutex_t* mutex);
+void tcthread_amutex_unlock(tcthread_amutex_t* mutex);
+
+// Lock-Free Queues
+// allocation aligned to TCTHREAD_CACHELINE; the original pointer is stored in front of the data
+static void* tcthread_aligned_alloc_(size_t size)
+{
+    void* mem = TC_MALLOC(size + TCTHREAD_CACHELINE + sizeof(void*));
+    if(!mem) return NULL;
+    uintptr_t addr = (TC__REINTERPRET_CAST(uintptr_t, mem) + sizeof(void*) + TCTHREAD_CACHELINE - 1) & ~TC__STATIC_CAST(uintptr_t, TCTHREAD_CACHELINE - 1);
+    TC__REINTERPRET_CAST(void**, addr)[-1] = mem;
+    return TC__REINTERPRET_CAST(void*, addr);
+}
+static void tcthread_aligned_free_(void* ptr)
+{
+    if(ptr) TC_FREE(TC__STATIC_CAST(void**, ptr)[-1]);
+}
+static size_t tcthread_queue_capacity_(size_t capacity)
+{
+    size_t pot = 1;
+    while(pot < capacity) pot <<= 1;
+    return pot;
+}
+
+struct tcthread_spsc_queue_internal_
+{
+    // written by the consumer
+    TCTHREAD_CACHELINE_ALIGNED tcthread_atomicsz_t head;
+    tcthread_atomicsz_t tail_cache;
+    // written by the producer
+    TCTHREAD_CACHELINE_ALIGNED tcthread_atomicsz_t tail;
+    tcthread_atomicsz_t head_cache;
+    // read-only
+    TCTHREAD_CACHELINE_ALIGNED size_t mask;
+    void* items[1];
+};
+tcthread_spsc_queue_t tcthread_spsc_queue_create(size_t capacity)
+{
+    tcthread_spsc_queue_t queue = {0};
+    capacity = tcthread_queue_capacity_(capacity);
+    struct tcthread_spsc_queue_internal_* q = TC__VOID_CAST(struct tcthread_spsc_queue_internal_*, tcthread_aligned_alloc_(offsetof(struct tcthread_spsc_queue_internal_, items) + capacity * sizeof(void*)));
+    if(!q) return queue;
+    q->head = q->tail_cache = 0;
+    q->tail = q->head_cache = 0;
+    q->mask = capacity - 1;
+    queue.handle = TC__REINTERPRET_CAST(uintptr_t, q);
+    return queue;
+}
+bool tcthread_spsc_queue_is_valid(tcthread_spsc_queue_t queue);
+void tcthread_spsc_queue_destroy(tcthread_spsc_queue_t queue)
+{
+    if(!queue.handle) return;   // _destroy silently allows null handles
+    tcthread_aligned_free_(TC__REINTERPRET_CAST(void*, queue.handle));
+}
+bool tcthread_spsc_queue_try_push(tcthread_spsc_queue_t queue, void* item)
+{
+    TC_ASSERT(queue.handle, "tcthread_spsc_queue_try_push passed null `queue` parameter");
+    struct tcthread_spsc_queue_internal_* q = TC__REINTERPRET_CAST(struct tcthread_spsc_queue_internal_*, queue.handle);
+    tcthread_atomicsz_t tail = tcthread_atomicsz_load_explicit(&q->tail, TCTHREAD_MEMORDER_RELAXED);
+    if(tail - q->head_cache > q->mask)
+    {
+        // looks full; refresh our view of the consumer's progress
+        q->head_cache = tcthread_atomicsz_load_explicit(&q->head, TCTHREAD_MEMORDER_ACQUIRE);
+        if(tail - q->head_cache > q->mask)
+            return false;
+    }
+    q->items[tail & q->mask] = item;
+    tcthread_atomicsz_store_explicit(&q->tail, tail + 1, TCTHREAD_MEMORDER_RELEASE);
+    return true;
+}
+bool tcthread_spsc_queue_try_pop(tcthread_spsc_queue_t queue, void** item)
+{
+    TC_ASSERT(queue.handle, "tcthread_spsc_queue_try_pop passed null `queue` parameter");
+    struct tcthread_spsc_queue_internal_* q = TC__REINTERPRET_CAST(struct tcthread_spsc_queue_internal_*, queue.handle);
+    tcthread_atomicsz_t head = tcthread_atomicsz_load_explicit(&q->head, TCTHREAD_MEMORDER_RELAXED);
+    if(head == q->tail_cache)
+    {
+        // looks empty; refresh our view of the producer's progress
+        q->tail_cache = tcthread_atomicsz_load_explicit(&q->tail, TCTHREAD_MEMORDER_ACQUIRE);
+        if(head == q->tail_cache)
+            return false;
+    }
+    *item = q->items[head & q->mask];
+    tcthread_atomicsz_store_explicit(&q->head, head + 1, TCTHREAD_MEMORDER_RELEASE);
+    return true;
+}
+
+// see http://www.1024cores.net/home/lock-free-algorithms/queues/bounded-mpmc-queue
+struct tcthread_mpmc_queue_cell_
+{
+    tcthread_atomicsz_t seq;    // == position if free for a push at `position`, == position+1 if ready for a pop at `position`
+    void* item;
+};
+struct tcthread_mpmc_queue_internal_
+{
+    tcthread_atomicsz_padded_t enqueue_pos;
+    tcthread_atomicsz_padded_t dequeue_pos;
+    TCTHREAD_CACHELINE_ALIGNED size_t mask;
+    struct tcthread_mpmc_queue_cell_ cells[1];
+};
+tcthread_mpmc_queue_t tcthread_mpmc_queue_create(size_t capacity)
+{
+    tcthread_mpmc_queue_t queue = {0};
+    capacity = tcthread_queue_capacity_(capacity < 2 ? 2 : capacity);  // with a single cell, `seq` could not distinguish "full" from "ready"
+    struct tcthread_mpmc_queue_internal_* q = TC__VOID_CAST(struct tcthread_mpmc_queue_internal_*, tcthread_aligned_alloc_(offsetof(struct tcthread_mpmc_queue_internal_, cells) + capacity * sizeof(struct tcthread_mpmc_queue_cell_)));
+    if(!q) return queue;
+    q->enqueue_pos.value = 0;
+    q->dequeue_pos.value = 0;
+    q->mask = capacity - 1;
+    for(size_t i = 0; i < capacity; i++)
+        q->cells[i].seq = i;
+    queue.handle = TC__REINTERPRET_CAST(uintptr_t, q);
+    return queue;
+}
+bool tcthread_mpmc_queue_is_valid(tcthread_mpmc_queue_t queue);
+void tcthread_mpmc_queue_destroy(tcthread_mpmc_queue_t queue)
+{
+    if(!queue.handle) return;   // _destroy silently allows null handles
+    tcthread_aligned_free_(TC__REINTERPRET_CAST(void*, queue.handle));
+}
+bool tcthread_mpmc_queue_try_push(tcthread_mpmc_queue_t queue, void* item)
+{
+    TC_ASSERT(queue.handle, "tcthread_mpmc_queue_try_push passed null `queue` parameter");
+    struct tcthread_mpmc_queue_internal_* q = TC__REINTERPRET_CAST(struct tcthread_mpmc_queue_internal_*, queue.handle);
+    tcthread_atomicsz_t pos = tcthread_atomicsz_load_explicit(&q->enqueue_pos.value, TCTHREAD_MEMORDER_RELAXED);
+    struct tcthread_mpmc_queue_cell_* cell;
+    for(;;)
+    {
+        cell = &q->cells[pos & q->mask];
+        tcthread_atomicsz_t seq = tcthread_atomicsz_load_explicit(&cell->seq, TCTHREAD_MEMORDER_ACQUIRE);
+        intptr_t diff = TC__STATIC_CAST(intptr_t, seq - pos);
+        if(!diff)
+        {
+            // (strong CAS, since our CAS returns the previous value, which cannot detect spurious failure)
+            tcthread_atomicsz_t prev = tcthread_atomicsz_compare_exchange_strong_explicit(&q->enqueue_pos.value, pos, pos + 1, TCTHREAD_MEMORDER_RELAXED, TCTHREAD_MEMORDER_RELAXED);
+            if(prev == pos)
+                break;
+            pos = prev;
+        }
+        else if(diff < 0)
+            return false;   // full
+        else
+            pos = tcthread_atomicsz_load_explicit(&q->enqueue_pos.value, TCTHREAD_MEMORDER_RELAXED);
+    }
+    cell->item = item;
+    tcthread_atomicsz_store_explicit(&cell->seq, pos + 1, TCTHREAD_MEMORDER_RELEASE);
+    return true;
+}
+bool tcthread_mpmc_queue_try_pop(tcthread_mpmc_queue_t queue, void** item)
+{
+    TC_ASSERT(queue.handle, "tcthread_mpmc_queue_try_pop passed null `queue` parameter");
+    struct tcthread_mpmc_queue_internal_* q = TC__REINTERPRET_CAST(struct tcthread_mpmc_queue_internal_*, queue.handle);
+    tcthread_atomicsz_t pos = tcthread_atomicsz_load_explicit(&q->dequeue_pos.value, TCTHREAD_MEMORDER_RELAXED);
+    struct tcthread_mpmc_queue_cell_* cell;
+    for(;;)
+    {
+        cell = &q->cells[pos & q->mask];
+        tcthread_atomicsz_t seq = tcthread_atomicsz_load_explicit(&cell->seq, TCTHREAD_MEMORDER_ACQUIRE);
+        intptr_t diff = TC__STATIC_CAST(intptr_t, seq - (pos + 1));
+        if(!diff)
+        {
+            tcthread_atomicsz_t prev = tcthread_atomicsz_compare_exchange_strong_explicit(&q->dequeue_pos.value, pos, pos + 1, TCTHREAD_MEMORDER_RELAXED, TCTHREAD_MEMORDER_RELAXED);
+            if(prev == pos)
+                break;
+            pos = prev;
+        }
+        else if(diff < 0)
+            return false;   // empty
+        else
+            pos = tcthread_atomicsz_load_explicit(&q->dequeue_pos.value, TCTHREAD_MEMORDER_RELAXED);
+    }
+    *item = cell->item;
+    tcthread_atomicsz_store_explicit(&cell->seq, pos + q->mask + 1, TCTHREAD_MEMORDER_RELEASE);
+    return true;
+}
+
+// Thread Pool & Jobs
+#ifndef TCTHREAD_POOL_DEQUE_SIZE
+#define TCTHREAD_POOL_DEQUE_SIZE        4096    // per-worker; must be a power of 2
+#endif
+#ifndef TCTHREAD_JOB_MAX_CONTINUATIONS
+#define TCTHREAD_JOB_MAX_CONTINUATIONS  8
+#endif
+#ifndef TCTHREAD_POOL_SPIN_COUNT
+#define TCTHREAD_POOL_SPIN_COUNT        32      // # of attempts to find work before going to sleep
+#endif
+
+#if defined(__cplusplus) && __cplusplus >= 201103L
+#define TCTHREAD__THREAD_LOCAL  thread_local
+#elif __STDC_VERSION__ >= 201112L
+#define TCTHREAD__THREAD_LOCAL  _Thread_local
+#elif defined(_MSC_VER)
+#define TCTHREAD__THREAD_LOCAL  __declspec(thread)
+#elif defined(__GNUC__)
+#define TCTHREAD__THREAD_LOCAL  __thread
+#else
+#error "tc_thread: no thread-local storage specifier available for the thread pool"
+#endif
+
+struct tcthread_pool_internal_;
+struct tcthread_job_internal_
+{
+    tcthread_jobfunc_t* func;
+    void* udata;
+    struct tcthread_pool_internal_* pool;
+    struct tcthread_job_internal_* parent;
+    struct tcthread_job_internal_* next;        // link in the injection queue
+    volatile tcthread_atomic32_t unfinished;    // self + # of unfinished children; job is done when this reaches 0
+    volatile tcthread_atomic32_t pending;       // submit + # of unfinished predecessors; job is runnable when this reaches 0
+    volatile tcthread_atomic32_t refcount;
+    uint32_t ncontinuations;
+    struct tcthread_job_internal_* continuations[TCTHREAD_JOB_MAX_CONTINUATIONS];
+};
+// Chase-Lev deque (fixed-size variant); see "Correct and Efficient Work-Stealing for Weak Memory Models" (Le et al., 2013)
+struct tcthread_pool_deque_
+{
+    tcthread_atomicsz_padded_t top;
+    tcthread_atomicsz_padded_t bottom;
+    volatile tcthread_atomicptr_t items[TCTHREAD_POOL_DEQUE_SIZE];
+};
+struct tcthread_pool_worker_
+{
+    struct tcthread_pool_deque_ deque;
+    struct tcthread_pool_internal_* pool;
+    tcthread_t thread;
+    uint32_t index;
+};
+struct tcthread_pool_internal_
+{
+    struct tcthread_pool_worker_* workers;
+    uint32_t nworkers;
+    uint32_t flags;
+    volatile tcthread_atomicbool_t stop;
+    // everything below is protected by `mutex` (except for the atomic counters)
+    tcthread_mutex_t mutex;
+    tcthread_cond_t work_cond;      // idle workers sleep on this
+    tcthread_cond_t wait_cond;      // threads in `tcthread_job_wait` sleep on this
+    uint32_t epoch;                 // incremented on every wakeup, to prevent lost wakeups
+    volatile tcthread_atomic32_t nsleeping;
+    volatile tcthread_atomic32_t nwaiters;
+    // injection queue (FIFO), for jobs submitted from outside the pool
+    struct tcthread_job_internal_* inject_head;
+    struct tcthread_job_internal_* inject_tail;
+    volatile tcthread_atomicsz_t ninjected;
+};
+static TCTHREAD__THREAD_LOCAL struct tcthread_pool_worker_* tcthread_pool_tls_worker_;
+static TCTHREAD__THREAD_LOCAL uint32_t tcthread_pool_tls_rng_;
+
+static void tcthread_pool_pin_self_(uint32_t index)
+{
+    uint32_t ncpu = tcthread_get_cpu_count();
+    if(!ncpu) return;
+#if defined(TCTHREAD__PLATFORM_WINDOWS)
+    SetThreadAffinityMask(GetCurrentThread(), TC__STATIC_CAST(DWORD_PTR, 1) << (index % ncpu % (sizeof(DWORD_PTR) * 8)));
+#elif defined(TCTHREAD__PLATFORM_POSIX) && defined(__linux__) && defined(CPU_SET)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(index % ncpu, &set);
+    sched_setaffinity(0, sizeof(set), &set);    // it's only a hint, so failure is fine
+#else
+    TC__PARAM_UNUSED(index);
+#endif
+}
+
+// deque; `push` and `take` may only be called by the owner, `steal` by anyone
+static bool tcthread_pool_deque_push_(struct tcthread_pool_deque_* deque, struct tcthread_job_internal_* job)
+{
+    tcthread_atomicsz_t b = tcthread_atomicsz_load_explicit(&deque->bottom.value, TCTHREAD_MEMORDER_RELAXED);
+    tcthread_atomicsz_t t = tcthread_atomicsz_load_explicit(&deque->top.value, TCTHREAD_MEMORDER_ACQUIRE);
+    if(b - t >= TCTHREAD_POOL_DEQUE_SIZE)
+        return false;   // full
+    tcthread_atomicptr_store_explicit(&deque->items[b & (TCTHREAD_POOL_DEQUE_SIZE - 1)], job, TCTHREAD_MEMORDER_RELAXED);
+    tcthread_atomicsz_store_explicit(&deque->bottom.value, b + 1, TCTHREAD_MEMORDER_RELEASE);
+    return true;
+}
+static struct tcthread_job_internal_* tcthread_pool_deque_take_(struct tcthread_pool_deque_* deque)
+{
+    tcthread_atomicsz_t b = tcthread_atomicsz_load_explicit(&deque->bottom.value, TCTHREAD_MEMORDER_RELAXED) - 1;
+    tcthread_atomicsz_store_explicit(&deque->bottom.value, b, TCTHREAD_MEMORDER_SEQ_CST);
+    tcthread_atomicsz_t t = tcthread_atomicsz_load_explicit(&deque->top.value, TCTHREAD_MEMORDER_SEQ_CST);
+    struct tcthread_job_internal_* job = NULL;
+    if(TC__STATIC_CAST(intptr_t, b - t) >= 0)
+    {
+        job = TC__STATIC_CAST(struct tcthread_job_internal_*, tcthread_atomicptr_load_explicit(&deque->items[b & (TCTHREAD_POOL_DEQUE_SIZE - 1)], TCTHREAD_MEMORDER_RELAXED));
+        if(t == b)  // last item; race against stealers
+        {
+            if(tcthread_atomicsz_compare_exchange_strong_explicit(&deque->top.value, t, t + 1, TCTHREAD_MEMORDER_SEQ_CST, TCTHREAD_MEMORDER_RELAXED) != t)
+                job = NULL; // lost the race
+            tcthread_atomicsz_store_explicit(&deque->bottom.value, b + 1, TCTHREAD_MEMORDER_RELAXED);
+        }
+    }
+    else    // empty
+        tcthread_atomicsz_store_explicit(&deque->bottom.value, b + 1, TCTHREAD_MEMORDER_RELAXED);
+    return job;
+}
+static struct tcthread_job_internal_* tcthread_pool_deque_steal_(struct tcthread_pool_deque_* deque)
+{
+    tcthread_atomicsz_t t = tcthread_atomicsz_load_explicit(&deque->top.value, TCTHREAD_MEMORDER_SEQ_CST);
+    tcthread_atomicsz_t b = tcthread_atomicsz_load_explicit(&deque->bottom.value, TCTHREAD_MEMORDER_SEQ_CST);
+    if(TC__STATIC_CAST(intptr_t, b - t) <= 0)
+        return NULL;    // empty
+    struct tcthread_job_internal_* job = TC__STATIC_CAST(struct tcthread_job_internal_*, tcthread_atomicptr_load_explicit(&deque->items[t & (TCTHREAD_POOL_DEQUE_SIZE - 1)], TCTHREAD_MEMORDER_RELAXED));
+    if(tcthread_atomicsz_compare_exchange_strong_explicit(&deque->top.value, t, t + 1, TCTHREAD_MEMORDER_SEQ_CST, TCTHREAD_MEMORDER_RELAXED) != t)
+        return NULL;    // lost the race (to the owner or another stealer)
+    return job;
+}
+
+/*
+ * Sleeping uses an epoch counter to avoid lost wakeups: a sleeper reads the
+ * epoch, announces itself via `nsleeping`/`nwaiters`, re-checks for work, and
+ * only then sleeps until the epoch changes. A waker publishes its work, and
+ * then reads the counter via an RMW (which orders it after the publication).
+ */
+static void tcthread_pool_wake_waiters_(struct tcthread_pool_internal_* pool)
+{
+    if(!tcthread_atomic32_fetch_add_explicit(&pool->nwaiters, 0, TCTHREAD_MEMORDER_SEQ_CST))
+        return;
+    tcthread_mutex_lock(pool->mutex);
+    pool->epoch++;
+    tcthread_mutex_unlock(pool->mutex);
+    tcthread_cond_broadcast(pool->wait_cond);
+}
+static void tcthread_pool_wake_(struct tcthread_pool_internal_* pool)
+{
+    if(tcthread_atomic32_fetch_add_explicit(&pool->nsleeping, 0, TCTHREAD_MEMORDER_SEQ_CST))
+    {
+        tcthread_mutex_lock(pool->mutex);
+        pool->epoch++;
+        tcthread_mutex_unlock(pool->mutex);
+        tcthread_cond_signal(pool->work_cond);
+    }
+    // waiters help out with work, so they get woken up too
+    tcthread_pool_wake_waiters_(pool);
+}
+static void tcthread_pool_enqueue_(struct tcthread_pool_internal_* pool, struct tcthread_job_internal_* job)
+{
+    struct tcthread_pool_worker_* worker = tcthread_pool_tls_worker_;
+    if(!worker || worker->pool != pool || !tcthread_pool_deque_push_(&worker->deque, job))
+    {
+        job->next = NULL;
+        tcthread_mutex_lock(pool->mutex);
+        if(pool->inject_tail)
+            pool->inject_tail->next = job;
+        else
+            pool->inject_head = job;
+        pool->inject_tail = job;
+        tcthread_atomicsz_inc_explicit(&pool->ninjected, TCTHREAD_MEMORDER_RELEASE);
+        tcthread_mutex_unlock(pool->mutex);
+    }
+    tcthread_pool_wake_(pool);
+}
+static struct tcthread_job_internal_* tcthread_pool_inject_pop_(struct tcthread_pool_internal_* pool)
+{
+    if(!tcthread_atomicsz_load_explicit(&pool->ninjected, TCTHREAD_MEMORDER_ACQUIRE))
+        return NULL;
+    tcthread_mutex_lock(pool->mutex);
+    struct tcthread_job_internal_* job = pool->inject_head;
+    if(job)
+    {
+        pool->inject_head = job->next;
+        if(!pool->inject_head)
+            pool->inject_tail = NULL;
+        tcthread_atomicsz_dec_explicit(&pool->ninjected, TCTHREAD_MEMORDER_RELAXED);
+    }
+    tcthread_mutex_unlock(pool->mutex);
+    return job;
+}
+// order: own deque, injection queue, then steal from others (starting at a random victim)
+static struct tcthread_job_internal_* tcthread_pool_find_work_(struct tcthread_pool_internal_* pool)
+{
+    struct tcthread_pool_worker_* self = tcthread_pool_tls_worker_;
+    if(self && self->pool != pool) self = NULL;
+    struct tcthread_job_internal_* job;
+    if(self && (job = tcthread_pool_deque_take_(&self->deque)))
+        return job;
+    if((job = tcthread_pool_inject_pop_(pool)))
+        return job;
+
+    // xorshift32
+    uint32_t rng = tcthread_pool_tls_rng_;
+    if(!rng) rng = TC__STATIC_CAST(uint32_t, TC__REINTERPRET_CAST(uintptr_t, &rng) >> 4) | 1u;
+    rng ^= rng << 13;
+    rng ^= rng >> 17;
+    rng ^= rng << 5;
+    tcthread_pool_tls_rng_ = rng;
+
+    for(uint32_t i = 0; i < pool->nworkers; i++)
+    {
+        struct tcthread_pool_worker_* victim = &pool->workers[(rng + i) % pool->nworkers];
+        if(victim == self) continue;
+        if((job = tcthread_pool_deque_steal_(&victim->deque)))
+            return job;
+    }
+    return NULL;
+}
+
+static void tcthread_job_release_internal_(struct tcthread_job_internal_* job)
+{
+    if(!tcthread_atomic32_dec_explicit(&job->refcount, TCTHREAD_MEMORDER_ACQ_REL))
+        TC_FREE(job);
+}
+static void tcthread_job_finish_(struct tcthread_job_internal_* job)
+{
+    if(tcthread_atomic32_dec_explicit(&job->unfinished, TCTHREAD_MEMORDER_SEQ_CST))
+        return; // children still running
+    struct tcthread_pool_internal_* pool = job->pool;
+    for(uint32_t i = 0; i < job->ncontinuations; i++)
+    {
+        struct tcthread_job_internal_* cont = job->continuations[i];
+        if(!tcthread_atomic32_dec_explicit(&cont->pending, TCTHREAD_MEMORDER_ACQ_REL))
+            tcthread_pool_enqueue_(pool, cont);
+        tcthread_job_release_internal_(cont);
+    }
+    tcthread_pool_wake_waiters_(pool);
+    struct tcthread_job_internal_* parent = job->parent;
+    tcthread_job_release_internal_(job);    // internal reference (held until done)
+    if(parent)
+    {
+        tcthread_job_finish_(parent);
+        tcthread_job_release_internal_(parent);
+    }
+}
+static void tcthread_job_run_(struct tcthread_job_internal_* job)
+{
+    if(job->func)
+    {
+        tcthread_job_t handle;
+        handle.handle = TC__REINTERPRET_CAST(uintptr_t, job);
+        job->func(handle, job->udata);
+    }
+    tcthread_job_finish_(job);
+}
+
+static void* tcthread_pool_worker_runner_(void* ptr)
+{
+    struct tcthread_pool_worker_* worker = TC__VOID_CAST(struct tcthread_pool_worker_*, ptr);
+    struct tcthread_pool_internal_* pool = worker->pool;
+    tcthread_pool_tls_worker_ = worker;
+    tcthread_pool_tls_rng_ = 0x9E3779B9u * (worker->index + 1);
+    if(pool->flags & TCTHREAD_POOL_PIN_THREADS)
+        tcthread_pool_pin_self_(worker->index);
+
+    for(;;)
+    {
+        struct tcthread_job_internal_* job = NULL;
+        for(uint32_t i = 0; i < TCTHREAD_POOL_SPIN_COUNT && !job; i++)
+        {
+            if(i) tcthread_cpu_relax();
+            job = tcthread_pool_find_work_(pool);
+        }
+        if(!job)
+        {
+            // exiting only once there's no work left is what drains the pool on destroy
+            if(tcthread_atomicbool_load_explicit(&pool->stop, TCTHREAD_MEMORDER_ACQUIRE))
+                break;
+            tcthread_mutex_lock(pool->mutex);
+            uint32_t epoch = pool->epoch;
+            tcthread_mutex_unlock(pool->mutex);
+            tcthread_atomic32_inc_explicit(&pool->nsleeping, TCTHREAD_MEMORDER_SEQ_CST);
+            job = tcthread_pool_find_work_(pool);
+            if(!job)
+            {
+                tcthread_mutex_lock(pool->mutex);
+                while(pool->epoch == epoch && !tcthread_atomicbool_load_explicit(&pool->stop, TCTHREAD_MEMORDER_ACQUIRE))
+                    tcthread_cond_wait(pool->work_cond, pool->mutex);
+                tcthread_mutex_unlock(pool->mutex);
+            }
+            tcthread_atomic32_dec_explicit(&pool->nsleeping, TCTHREAD_MEMORDER_SEQ_CST);
+            if(!job) continue;
+        }
+        tcthread_job_run_(job);
+    }
+    tcthread_pool_tls_worker_ = NULL;
+    return NULL;
+}
+static void tcthread_pool_free_(struct tcthread_pool_internal_* pool, uint32_t nstarted)
+{
+    tcthread_mutex_lock(pool->mutex);
+    tcthread_atomicbool_store_explicit(&pool->stop, true, TCTHREAD_MEMORDER_RELEASE);
+    pool->epoch++;
+    tcthread_mutex_unlock(pool->mutex);
+    tcthread_cond_broadcast(pool->work_cond);
+    for(uint32_t i = 0; i < nstarted; i++)
+        tcthread_join(pool->workers[i].thread, NULL);
+    tcthread_cond_destroy(pool->wait_cond);
+    tcthread_cond_destroy(pool->work_cond);
+    tcthread_mutex_destroy(pool->mutex);
+    tcthread_aligned_free_(pool->workers);
+    TC_FREE(pool);
+}
+tcthread_pool_t tcthread_pool_create(uint32_t nthreads, uint32_t flags)
+{
+    tcthread_pool_t handle = {0};
+    if(!nthreads) nthreads = tcthread_get_cpu_count();
+    if(!nthreads) nthreads = 1;
+
+    struct tcthread_pool_internal_* pool = TC__VOID_CAST(struct tcthread_pool_internal_*, TC_MALLOC(sizeof(struct tcthread_pool_internal_)));
+    if(!pool) return handle;
+    pool->workers = TC__VOID_CAST(struct tcthread_pool_worker_*, tcthread_aligned_alloc_(nthreads * sizeof(struct tcthread_pool_worker_)));
+    pool->nworkers = nthreads;
+    pool->flags = flags;
+    pool->stop = false;
+    pool->mutex = tcthread_mutex_create(false);
+    pool->work_cond = tcthread_cond_create();
+    pool->wait_cond = tcthread_cond_create();
+    pool->epoch = 0;
+    pool->nsleeping = 0;
+    pool->nwaiters = 0;
+    pool->inject_head = pool->inject_tail = NULL;
+    pool->ninjected = 0;
+    if(!pool->workers || !tcthread_mutex_is_valid(pool->mutex) || !tcthread_cond_is_valid(pool->work_cond) || !tcthread_cond_is_valid(pool->wait_cond))
+    {
+        tcthread_cond_destroy(pool->wait_cond);
+        tcthread_cond_destroy(pool->work_cond);
+        tcthread_mutex_destroy(pool->mutex);
+        tcthread_aligned_free_(pool->workers);
+        TC_FREE(pool);
+        return handle;
+    }
+    for(uint32_t i = 0; i < nthreads; i++)
+    {
+        struct tcthread_pool_worker_* worker = &pool->workers[i];
+        worker->deque.top.value = 0;
+        worker->deque.bottom.value = 0;
+        worker->pool = pool;
+        worker->index = i;
+    }
+    for(uint32_t i = 0; i < nthreads; i++)
+    {
+        pool->workers[i].thread = tcthread_create(0, tcthread_pool_worker_runner_, &pool->workers[i]);
+        if(!tcthread_is_valid(pool->workers[i].thread))
+        {
+            tcthread_pool_free_(pool, i);
+            return handle;
+        }
+    }
+    handle.handle = TC__REINTERPRET_CAST(uintptr_t, pool);
+    return handle;
+}
+bool tcthread_pool_is_valid(tcthread_pool_t pool);
+void tcthread_pool_destroy(tcthread_pool_t pool)
+{
+    if(!pool.handle) return;    // _destroy silently allows null handles
+    TC_ASSERT(tcthread_pool_get_worker_index(pool) < 0, "tcthread_pool_destroy called from within one of the pool's jobs");
+    tcthread_pool_free_(TC__REINTERPRET_CAST(struct tcthread_pool_internal_*, pool.handle), TC__REINTERPRET_CAST(struct tcthread_pool_internal_*, pool.handle)->nworkers);
+}
+uint32_t tcthread_pool_get_thread_count(tcthread_pool_t pool)
+{
+    TC_ASSERT(pool.handle, "tcthread_pool_get_thread_count passed null `pool` parameter");
+    return TC__REINTERPRET_CAST(struct tcthread_pool_internal_*, pool.handle)->nworkers;
+}
+int32_t tcthread_pool_get_worker_index(tcthread_pool_t pool)
+{
+    struct tcthread_pool_worker_* worker = tcthread_pool_tls_worker_;
+    if(!worker || worker->pool != TC__REINTERPRET_CAST(struct tcthread_pool_internal_*, pool.handle))
+        return -1;
+    return worker->index;
+}
+
+struct tcthread_pool_range_ctx_
+{
+    tcthread_pool_t pool;
+    tcthread_rangefunc_t* func;
+    void* udata;
+    size_t grain;
+    struct tcthread_pool_range_* ranges;    // preallocated; one per possible split
+    volatile tcthread_atomicsz_t nranges;
+};
+struct tcthread_pool_range_
+{
+    struct tcthread_pool_range_ctx_* ctx;
+    size_t begin, end;
+};
+static void tcthread_pool_range_runner_(tcthread_job_t job, void* udata)
+{
+    struct tcthread_pool_range_* range = TC__VOID_CAST(struct tcthread_pool_range_*, udata);
+    struct tcthread_pool_range_ctx_* ctx = range->ctx;
+    // lazy binary splitting: hand off the upper half as a stealable job, then keep the lower half
+    while(range->end - range->begin > ctx->grain)
+    {
+        size_t nchunks = (range->end - range->begin + ctx->grain - 1) / ctx->grain;
+        size_t mid = range->begin + nchunks / 2 * ctx->grain;
+        struct tcthread_pool_range_* upper = &ctx->ranges[tcthread_atomicsz_fetch_add_explicit(&ctx->nranges, 1, TCTHREAD_MEMORDER_RELAXED)];
+        upper->ctx = ctx;
+        upper->begin = mid;
+        upper->end = range->end;
+        tcthread_job_t child = tcthread_job_create(ctx->pool, job, tcthread_pool_range_runner_, upper);
+        if(!tcthread_job_is_valid(child))
+            break;  // out of memory; just process the rest here
+        tcthread_job_submit(child);
+        tcthread_job_release(child);
+        range->end = mid;
+    }
+    ctx->func(range->begin, range->end, ctx->udata);
+}
+void tcthread_pool_parallel_for(tcthread_pool_t pool, size_t count, size_t grain, tcthread_rangefunc_t* func, void* udata)
+{
+    TC_ASSERT(pool.handle, "tcthread_pool_parallel_for passed null `pool` parameter");
+    if(!count) return;
+    if(!grain)
+    {
+        grain = count / (tcthread_pool_get_thread_count(pool) * 8u);
+        if(!grain) grain = 1;
+    }
+    if(count <= grain)
+    {
+        func(0, count, udata);
+        return;
+    }
+
+    struct tcthread_pool_range_ctx_ ctx;
+    ctx.pool = pool;
+    ctx.func = func;
+    ctx.udata = udata;
+    ctx.grain = grain;
+    ctx.ranges = TC__VOID_CAST(struct tcthread_pool_range_*, TC_MALLOC((count + grain - 1) / grain * sizeof(struct tcthread_pool_range_)));
+    ctx.nranges = 1;
+    tcthread_job_t root = {0};
+    if(ctx.ranges)
+    {
+        ctx.ranges[0].ctx = &ctx;
+        ctx.ranges[0].begin = 0;
+        ctx.ranges[0].end = count;
+        tcthread_job_t none = {0};
+        root = tcthread_job_create(pool, none, tcthread_pool_range_runner_, &ctx.ranges[0]);
+    }
+    if(!tcthread_job_is_valid(root))
+    {
+        TC_FREE(ctx.ranges);
+        func(0, count, udata);  // out of memory; do it all here
+        return;
+    }
+    tcthread_job_submit(root);
+    tcthread_job_wait(root);
+    tcthread_job_release(root);
+    TC_FREE(ctx.ranges);
+}
+
+tcthread_job_t tcthread_job_create(tcthread_pool_t pool, tcthread_job_t parent, tcthread_jobfunc_t* func, void* udata)
+{
+    TC_ASSERT(pool.handle, "tcthread_job_create passed null `pool` parameter");
+    tcthread_job_t handle = {0};
+    struct tcthread_job_internal_* job = TC__VOID_CAST(struct tcthread_job_internal_*, TC_MALLOC(sizeof(struct tcthread_job_internal_)));
+    if(!job) return handle;
+    job->func = func;
+    job->udata = udata;
+    job->pool = TC__REINTERPRET_CAST(struct tcthread_pool_internal_*, pool.handle);
+    job->parent = TC__REINTERPRET_CAST(struct tcthread_job_internal_*, parent.handle);
+    job->next = NULL;
+    job->unfinished = 1;
+    job->pending = 1;
+    job->refcount = 2;  // user handle + internal (released once done)
+    job->ncontinuations = 0;
+    if(job->parent)
+    {
+        TC_ASSERT(job->parent->pool == job->pool, "tcthread_job_create passed a `parent` from a different pool");
+        tcthread_atomic32_inc_explicit(&job->parent->unfinished, TCTHREAD_MEMORDER_RELAXED);
+        tcthread_atomic32_inc_explicit(&job->parent->refcount, TCTHREAD_MEMORDER_RELAXED);
+    }
+    handle.handle = TC__REINTERPRET_CAST(uintptr_t, job);
+    return handle;
+}
+bool tcthread_job_is_valid(tcthread_job_t job);
+bool tcthread_job_then(tcthread_job_t job, tcthread_job_t continuation)
+{
+    TC_ASSERT(job.handle, "tcthread_job_then passed null `job` parameter");
+    TC_ASSERT(continuation.handle, "tcthread_job_then passed null `continuation` parameter");
+    struct tcthread_job_internal_* ijob = TC__REINTERPRET_CAST(struct tcthread_job_internal_*, job.handle);
+    struct tcthread_job_internal_* icont = TC__REINTERPRET_CAST(struct tcthread_job_internal_*, continuation.handle);
+    if(ijob->ncontinuations >= TCTHREAD_JOB_MAX_CONTINUATIONS)
+        return false;
+    ijob->continuations[ijob->ncontinuations++] = icont;
+    tcthread_atomic32_inc_explicit(&icont->pending, TCTHREAD_MEMORDER_RELAXED);
+    tcthread_atomic32_inc_explicit(&icont->refcount, TCTHREAD_MEMORDER_RELAXED);
+    return true;
+}
+void tcthread_job_submit(tcthread_job_t job)
+{
+    TC_ASSERT(job.handle, "tcthread_job_submit passed null `job` parameter");
+    struct tcthread_job_internal_* ijob = TC__REINTERPRET_CAST(struct tcthread_job_internal_*, job.handle);
+    if(!tcthread_atomic32_dec_explicit(&ijob->pending, TCTHREAD_MEMORDER_ACQ_REL))
+        tcthread_pool_enqueue_(ijob->pool, ijob);
+}
+bool tcthread_job_is_done(tcthread_job_t job)
+{
+    TC_ASSERT(job.handle, "tcthread_job_is_done passed null `job` parameter");
+    struct tcthread_job_internal_* ijob = TC__REINTERPRET_CAST(struct tcthread_job_internal_*, job.handle);
+    return !tcthread_atomic32_load_explicit(&ijob->unfinished, TCTHREAD_MEMORDER_ACQUIRE);
+}
+void tcthread_job_wait(tcthread_job_t job)
+{
+    TC_ASSERT(job.handle, "tcthread_job_wait passed null `job` parameter");
+    struct tcthread_job_internal_* ijob = TC__REINTERPRET_CAST(struct tcthread_job_internal_*, job.handle);
+    struct tcthread_pool_internal_* pool = ijob->pool;
+    while(!tcthread_job_is_done(job))
+    {
+        // help out instead of blocking
+        struct tcthread_job_internal_* other = NULL;
+        for(uint32_t i = 0; i < TCTHREAD_POOL_SPIN_COUNT && !other && !tcthread_job_is_done(job); i++)
+        {
+            if(i) tcthread_cpu_relax();
+            other = tcthread_pool_find_work_(pool);
+        }
+        if(!other)
+        {
+            tcthread_mutex_lock(pool->mutex);
+            uint32_t epoch = pool->epoch;
+            tcthread_mutex_unlock(pool->mutex);
+            tcthread_atomic32_inc_explicit(&pool->nwaiters, TCTHREAD_MEMORDER_SEQ_CST);
+            if(!tcthread_job_is_done(job) && !(other = tcthread_pool_find_work_(pool)))
+            {
+                tcthread_mutex_lock(pool->mutex);
+                while(pool->epoch == epoch)
+                    tcthread_cond_wait(pool->wait_cond, pool->mutex);
+                tcthread_mutex_unlock(pool->mutex);
+            }
+            tcthread_atomic32_dec_explicit(&pool->nwaiters, TCTHREAD_MEMORDER_SEQ_CST);
+        }
+        if(other)
+            tcthread_job_run_(other);
+    }
+}
+void tcthread_job_release(tcthread_job_t job)
+{
+    if(!job.handle) return;
+    tcthread_job_release_internal_(TC__REINTERPRET_CAST(struct tcthread_job_internal_*, job.handle));
+}
+
 // ********** ATOMICS **********
 
 // ***** atomicptr (wrappers around `atomicsz`) *****
@@ -1,13 +1,17 @@
 /*
  * tc_vox.h: MagicaVoxel *.vox file loader.
  *
- * DEPENDS:
- * VERSION: 0.2.1 (2024-10-23)
+ * DEPENDS: tc_thread (optional)
+ * VERSION: 0.5.0 (2026-10-15)
  * LICENSE: CC0 & Boost (dual-licensed)
  * AUTHOR: Tim Čas
  * URL: https://github.com/darkuranium/tclib
  *
  * VERSION HISTORY:
+ * 0.5.0    scenes are now allocated as a single block, `tcvox_load_fname()` maps the file into memory (using voxel data in-place),
+ *          and identical models are deduplicated (see `tcvox_model_t.original`)
+ * 0.4.0    added a greedy mesher, see `tcvox_model_build_mesh()` & `tcvox_scene_get_mesh()` (with parallel meshing if tc_thread is available)
+ * 0.3.0    added optional per-model sparse brick maps, for O(1) voxel queries and bitmask-based surface voxel iteration
  * 0.2.1    properly handle "simple" .vox files, i.e. those without nodes but only model(s)
  *          fix an issue with transforms not being properly reset when we finish iterating a node
  * 0.2.0    added rOBJ & IMAP chunk handling
@@ -139,13 +143,58 @@ typedef struct tcvox_voxel
     uint8_t index;
 } tcvox_voxel_t;
 
+/*
+    Voxels are grouped into bricks of 8x8x8, with (x,y,z) stored at bit `y*8 + x` of `occupancy[z]`.
+    This allows neighbour tests for an entire 8x8 slice at a time, via shifts (see `tcvox_model_brick_faces`).
+ */
+#define TCVOX_BRICK_SIZE    8
+#define TCVOX_BRICK_NONE    0xFFFF
+typedef struct tcvox_brick
+{
+    uint64_t occupancy[8];
+    uint8_t index[8][8][8];     // [z][y][x]; palette index, 0 if empty
+} tcvox_brick_t;
+
+typedef struct tcvox_brickmap
+{
+    tcvox_ivec3_t size;         // # of bricks in each axis
+    uint16_t* map;              // [z][y][x]; index into `bricks`, or TCVOX_BRICK_NONE if the brick is empty
+    uint32_t nbricks;
+    tcvox_brick_t* bricks;
+} tcvox_brickmap_t;
+
+/*
+    Each quad of a mesh is 4 consecutive vertices, in counter-clockwise order when viewed from the outside;
+    it can be drawn as triangles (0,1,2) & (0,2,3).
+ */
+typedef struct tcvox_mesh_vertex
+{
+    int16_t xyz[3];     // voxel (x,y,z) spans from (x,y,z) to (x+1,y+1,z+1)
+    uint8_t normal;     // outward normal; 0=-X, 1=+X, 2=-Y, 3=+Y, 4=-Z, 5=+Z (i.e. the bit index of the corresponding `tcvox_face_t`)
+    uint8_t index;      // palette index
+} tcvox_mesh_vertex_t;
+
+typedef struct tcvox_mesh
+{
+    uint32_t nvertices;
+    tcvox_mesh_vertex_t* vertices;
+} tcvox_mesh_t;
+
 typedef struct tcvox_model
 {
     uint32_t id;
     tcvox_ivec3_t size;
 
     uint32_t nvoxels;
-    tcvox_voxel_t* voxels;
+    tcvox_voxel_t* voxels;  // read-only if loaded via `tcvox_load_fname` (it points into the file mapping)
+
+    // If non-NULL, this model is identical (same size & voxels) to `original`, which shape nodes refer to instead;
+    // in that case, it shares `voxels` with the original.
+    const struct tcvox_model* original;
+
+    // optional; see `tcvox_model_build_bricks` & `tcvox_model_build_mesh`
+    tcvox_brickmap_t* bricks;
+    tcvox_mesh_t mesh;
 } tcvox_model_t;
 
 typedef struct tcvox_layer
@@ -302,6 +351,11 @@ typedef struct tcvox_scene
         uint32_t ntransforms;
         tcvox_transform_node_t* transforms;
     } nodes;
+
+// private data follows
+    void* _arena;       // all of the above is allocated from this single block
+    void* _mapping;     // file mapping, if loaded via `tcvox_load_fname`
+    size_t _mapping_len;
 } tcvox_scene_t;
 
 typedef struct tcvox_iter
@@ -329,6 +383,11 @@ extern const tcvox_palette_t tcvox_default_palette;
 
 extern const tcvox_transform_t tcvox_transform_identity;
 
+/*
+    All of the scene's data is allocated in a single block. `tcvox_load_memory` copies voxel data out of `ptr`, while `tcvox_load_fname`
+    maps the file into memory and uses voxel data directly from the mapping (so it remains mapped until `tcvox_unload`).
+    Models with identical voxel data are only stored once (see `tcvox_model_t.original`).
+ */
 tcvox_scene_t* tcvox_load_memory(tcvox_scene_t* scene, const void* ptr, size_t length);
 tcvox_scene_t* tcvox_load_fname(tcvox_scene_t* scene, const char* fname);
 void tcvox_unload(const tcvox_scene_t* scene);
@@ -348,6 +407,61 @@ void tcvox_iter_finish(tcvox_iter_t* it);   // Only required to be called if we
 // Compute a bounding box of the entire scene (min/max in each axis). Note that this does *not* inspect voxel data, but merely uses the outer boxes of each model/node.
 bool tcvox_scene_compute_bounds(tcvox_scene_t* scene, tcvox_ivec3_t bounds[TC__STATIC_SIZE(2)], bool include_hidden);
 
+// Build the (sparse) brick map of a model (or of all models in a scene), for fast voxel queries. Returns false if out of memory.
+// The brick map is freed along with the scene. The scene variants skip duplicate models (see `tcvox_model_t.original`), as no shape refers to them.
+bool tcvox_model_build_bricks(tcvox_model_t* model);
+bool tcvox_scene_build_bricks(tcvox_scene_t* scene);
+// Get the palette index of voxel (x,y,z), or 0 if it is empty (or outside of the model).
+// This is O(1) if the model's brick map was built, and a linear search otherwise.
+uint8_t tcvox_model_get(const tcvox_model_t* model, int32_t x, int32_t y, int32_t z);
+
+typedef enum tcvox_face
+{
+    TCVOX_FACE_NEG_X = 0x01,
+    TCVOX_FACE_POS_X = 0x02,
+    TCVOX_FACE_NEG_Y = 0x04,
+    TCVOX_FACE_POS_Y = 0x08,
+    TCVOX_FACE_NEG_Z = 0x10,
+    TCVOX_FACE_POS_Z = 0x20,
+} tcvox_face_t;
+// For each face direction (in order of `tcvox_face_t` bits), compute which voxels of brick (bx,by,bz) have that face exposed (i.e. have an empty neighbour),
+// in the same layout as `tcvox_brick_t.occupancy`. Requires the brick map.
+void tcvox_model_brick_faces(const tcvox_model_t* model, int32_t bx, int32_t by, int32_t bz, uint64_t faces[TC__STATIC_SIZE(6)][8]);
+
+// Iterate over all surface voxels (i.e. ones with at least one face exposed) of a model, brick by brick. Requires the brick map.
+typedef struct tcvox_surface_iter
+{
+    const tcvox_model_t* model;
+    tcvox_ivec3_t pos;
+    uint8_t index;      // palette index
+    uint8_t faces;      // exposed faces; a combination of `tcvox_face_t`
+
+// private data follows
+    uint32_t _brick;    // index into `model->bricks->map`
+    uint32_t _z;
+    uint64_t _bits;     // remaining surface voxels in the current slice
+    uint64_t _faces[6][8];
+} tcvox_surface_iter_t;
+tcvox_surface_iter_t tcvox_model_iter_surface(const tcvox_model_t* model);
+bool tcvox_surface_iter_next(tcvox_surface_iter_t* it);
+
+// Build the mesh of a model (or of all models in a scene), in model space. Hidden faces are culled, and neighbouring faces of the same palette index are merged into larger quads.
+// This also builds the brick map, if it wasn't already. Returns false if out of memory. The mesh is freed along with the scene. As with brick maps, the scene variants skip duplicate models.
+bool tcvox_model_build_mesh(tcvox_model_t* model);
+bool tcvox_scene_build_meshes(tcvox_scene_t* scene);
+#ifdef TC_THREAD_H_
+// As above, but mesh the models in parallel on `pool`.
+bool tcvox_scene_build_meshes_parallel(tcvox_scene_t* scene, tcthread_pool_t pool);
+#endif /* TC_THREAD_H_ */
+/*
+    Get a mesh of the entire scene, with the transform of each shape baked in. Models that have no mesh yet are meshed first (serially).
+    As in MagicaVoxel, each model is centered on its (rounded down) `size / 2`; the resulting positions must fit into `int16_t`.
+
+    Writes at most `maxvertices` vertices, and returns the number of vertices in the full mesh (so a return value larger than `maxvertices`
+    means that the buffer was too small), or SIZE_MAX if out of memory.
+ */
+size_t tcvox_scene_get_mesh(tcvox_scene_t* scene, tcvox_mesh_vertex_t* vertices, size_t maxvertices, bool include_hidden);
+
 #endif /* TC_VOX_H_ */
 
 
@@ -362,6 +476,21 @@ bool tcvox_scene_compute_bounds(tcvox_scene_t* scene, tcvox_ivec3_t bounds[TC__S
 #include <stdlib.h>
 #include <string.h>
 #include <assert.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
 
 #ifdef __cplusplus
     #if defined(_MSC_VER) || defined(__GNUC__)
@@ -372,11 +501,13 @@ bool tcvox_scene_compute_bounds(tcvox_scene_t* scene, tcvox_ivec3_t bounds[TC__S
 //#define TC__RESTRICT(T)     T restrict
 #endif
 
+#ifndef TC__VOID_CAST
 #ifdef __cplusplus
 #define TC__VOID_CAST(T,x)  static_cast<T>(x)
 #else
 #define TC__VOID_CAST(T,x)  (x)
 #endif
+#endif /* TC__VOID_CAST */
 
 #define TCVOX_TAG_(A,B,C,D) ((uint32_t)(A)<<0 | (uint32_t)(B)<<8 | (uint32_t)(C)<<16 | (uint32_t)(D)<<24)
 
@@ -501,22 +632,53 @@ const tcvox_transform_t tcvox_transform_identity = {
 };
 
 #define TCVOX_CHECK_(cond, msg) do { if(!(cond)) { error = (msg); goto error; } } while(0)
-#define TCVOX_ALLOC_CHECK_(ptr, num, name)      \
+
+/*
+    Everything in a scene is allocated from a single block (`tcvox_scene_t._arena`), sized by a first pass over the file.
+    Aligned allocations (the structures themselves) come first, followed by unaligned ones (strings & voxels).
+ */
+#define TCVOX_ARENA_ALIGN_(n)   (((n) + 7) & ~(size_t)7)
+struct tcvox_arena_
+{
+    char* data;
+    char* data_end;
+    char* bytes;
+    char* bytes_end;
+};
+static void* tcvox_arena_alloc_(struct tcvox_arena_* arena, size_t nbytes)
+{
+    nbytes = TCVOX_ARENA_ALIGN_(nbytes);
+    // (only if the first pass missed something, which would be a bug)
+    if(nbytes > (size_t)(arena->data_end - arena->data))
+        return NULL;
+    void* ptr = arena->data;
+    arena->data += nbytes;
+    return ptr;
+}
+static char* tcvox_arena_alloc_bytes_(struct tcvox_arena_* arena, size_t nbytes)
+{
+    if(nbytes > (size_t)(arena->bytes_end - arena->bytes))
+        return NULL;
+    char* ptr = arena->bytes;
+    arena->bytes += nbytes;
+    return ptr;
+}
+#define TCVOX_ARENA_ALLOC_(ptr, num, name)      \
     do {                                        \
-        (ptr) = calloc((num), sizeof(*(ptr)));   \
-        TCVOX_CHECK_((ptr), "Cannot allocate " name ": Out of memory"); \
+        (ptr) = tcvox_arena_alloc_(&arena, (num) * sizeof(*(ptr)));    \
+        TCVOX_CHECK_((ptr), "Cannot allocate " name ": Arena size mismatch"); \
     } while(0)
-#define TCVOX_ALLOC_CHECK_NOINIT_(ptr, num, name)   \
+#define TCVOX_ARENA_ALLOC_BYTES_(ptr, num, name)    \
     do {                                            \
-        (ptr) = malloc((num) * sizeof(*(ptr)));     \
-        TCVOX_CHECK_((ptr), "Cannot allocate " name ": Out of memory"); \
+        (ptr) = tcvox_arena_alloc_bytes_(&arena, (num));   \
+        TCVOX_CHECK_((ptr), "Cannot allocate " name ": Arena size mismatch"); \
     } while(0)
 
-static const char* tcvox_make_attr_(tcvox_attr_t* restrict attr, const char* key, size_t klen, const char* value, size_t vlen)
+static const char* tcvox_make_attr_(struct tcvox_arena_* arena, tcvox_attr_t* restrict attr, const char* key, size_t klen, const char* value, size_t vlen)
 {
-    const char* error = NULL;
-
-    TCVOX_ALLOC_CHECK_(attr->key, klen + 1 + vlen + 1, "attribute");
+    attr->key = tcvox_arena_alloc_bytes_(arena, klen + 1 + vlen + 1);
+    if(!attr->key)
+        return "Cannot allocate attribute: Arena size mismatch";
     attr->value = attr->key + (klen + 1);
 
     memcpy(attr->key, key, klen);
@@ -525,10 +687,9 @@ static const char* tcvox_make_attr_(tcvox_attr_t* restrict attr, const char* key
     memcpy(attr->value, value, vlen);
     attr->value[vlen] = 0;
 
-error:
-    return error;
+    return NULL;
 }
-#define TCVOX_MAKE_ATTR_(attr)  do { if((error = tcvox_make_attr_(attr, key, klen, val, vlen))) goto error; } while(0)
+#define TCVOX_MAKE_ATTR_(attr)  do { if((error = tcvox_make_attr_(&arena, attr, key, klen, val, vlen))) goto error; } while(0)
 
 static const char* tcvox_read_bytes_(void* restrict dst, size_t nbytes, const void* restrict ptr, size_t length, size_t offset)
 {
@@ -606,13 +767,66 @@ error:
 }
 #define TCVOX_READ_CHUNK_HEADER_(dst, offset)   do { if((error = tcvox_read_chunk_header_(dst, ptr, length, offset))) goto error; } while(0)
 
+// Add the arena space required by the DICT at `*offset` to `*nbytes` & `*nbytes_unaligned`, and skip over it.
+static const char* tcvox_measure_dict_(size_t* restrict nbytes, size_t* restrict nbytes_unaligned, uint32_t* restrict offset, const void* restrict ptr, size_t length)
+{
+    const char* error;
+
+    uint32_t nattrs;
+    TCVOX_READ_32LE_(&nattrs, *offset); *offset += sizeof(uint32_t);
+    // each attribute is at least 2 lengths; checking this keeps a bogus count from overflowing the size
+    TCVOX_CHECK_(nattrs <= (length - *offset) / (2 * sizeof(uint32_t)), "Invalid DICT size (truncated chunk?)");
+    *nbytes += TCVOX_ARENA_ALIGN_(nattrs * sizeof(tcvox_attr_t));
+
+    for(uint32_t a = 0; a < 2 * nattrs; a++)    // keys & values
+    {
+        const char* str; uint32_t len;
+        TCVOX_READ_STRING_NOCPY_(&str, &len, *offset); *offset += sizeof(uint32_t) + len;
+        *nbytes_unaligned += len + 1;
+    }
+
+error:
+    return error;
+}
+#define TCVOX_MEASURE_DICT_(offset) do { if((error = tcvox_measure_dict_(&nbytes, &nbytes_unaligned, offset, ptr, length))) goto error; } while(0)
+
+// used to find duplicate models
+struct tcvox_model_info_
+{
+    uint32_t size[3];
+    uint32_t nvoxels;
+    const uint8_t* voxels;
+    uint32_t index;
+    uint32_t original;  // index of the first model with the same contents (possibly `index` itself)
+};
+static int tcvox_model_info_cmp_contents_(const struct tcvox_model_info_* a, const struct tcvox_model_info_* b)
+{
+    for(size_t i = 0; i < 3; i++)
+        if(a->size[i] != b->size[i])
+            return a->size[i] < b->size[i] ? -1 : +1;
+    if(a->nvoxels != b->nvoxels)
+        return a->nvoxels < b->nvoxels ? -1 : +1;
+    // we only get here if the sizes match, so most models never need their voxels touched
+    return a->nvoxels ? memcmp(a->voxels, b->voxels, a->nvoxels * sizeof(tcvox_voxel_t)) : 0;
+}
+static int tcvox_model_info_cmp_(const void* a, const void* b)
+{
+    const struct tcvox_model_info_* ia = *(const struct tcvox_model_info_* const*)a;
+    const struct tcvox_model_info_* ib = *(const struct tcvox_model_info_* const*)b;
+    int cmp = tcvox_model_info_cmp_contents_(ia, ib);
+    if(cmp) return cmp;
+    // among identical models, the first one in the file comes first
+    return ia->index < ib->index ? -1 : ia->index > ib->index;
+}
+
 #define TCVOX_IS_KEY_(S)    (klen == sizeof(#S) - 1U && !memcmp(key, #S, sizeof(#S) - 1U))
 #define TCVOX_IS_VAL_(S)    (vlen == sizeof(#S) - 1U && !memcmp(val, #S, sizeof(#S) - 1U))
 
-// Main function.
-static const char* tcvox_load_memory_(tcvox_scene_t* scene, const void* ptr, size_t length)
+// Main function. If `borrow` is set, `ptr` must outlive the scene, as voxel data is used directly from it.
+static const char* tcvox_load_memory_(tcvox_scene_t* scene, const void* ptr, size_t length, bool borrow)
 {
     const char* error;
+    struct tcvox_model_info_* infos = NULL;
 
     uint32_t tag;
     TCVOX_READ_32LE_(&tag, 0 * sizeof(uint32_t));
@@ -628,12 +842,14 @@ static const char* tcvox_load_memory_(tcvox_scene_t* scene, const void* ptr, siz
     TCVOX_CHECK_(c_MAIN.tag == TCVOX_TAG_('M','A','I','N'), "Wrong initial file chunk");
     TCVOX_CHECK_(c_MAIN.nbytes_data == 0, "Expected initial chunk to have no data");
 
-    // First, iterate over chunks, gather various counts.
+    // First, iterate over chunks, gather various counts, and the arena space needed by everything that isn't fixed-size.
     uint32_t pack_nmodels = UINT32_MAX;
+    size_t nbytes = 0, nbytes_unaligned = 0;
     for(uint32_t offset = c_MAIN.offset_children; offset < length;)
     {
         struct tcvox_chunk_ c;
         TCVOX_READ_CHUNK_HEADER_(&c, offset);
+        uint32_t ioffset = c.offset_data;
         switch(c.tag)
         {
         case TCVOX_TAG_('P','A','C','K'):
@@ -643,24 +859,69 @@ static const char* tcvox_load_memory_(tcvox_scene_t* scene, const void* ptr, siz
         case TCVOX_TAG_('S','I','Z','E'):
             ++scene->nmodels;
             break;
-        case TCVOX_TAG_('n','T','R','N'):
+        case TCVOX_TAG_('n','T','R','N'): {
             ++scene->nodes.ntransforms;
-            break;
-        case TCVOX_TAG_('n','G','R','P'):
+            ioffset += 1 * sizeof(uint32_t);    // node ID
+            TCVOX_MEASURE_DICT_(&ioffset);
+            ioffset += 3 * sizeof(uint32_t);    // child, reserved, and layer ID
+
+            uint32_t nframes;
+            TCVOX_READ_32LE_(&nframes, ioffset); ioffset += sizeof(uint32_t);
+            TCVOX_CHECK_(nframes <= (length - ioffset) / sizeof(uint32_t), "Invalid number of frames in nTRN (truncated chunk?)");
+            nbytes += TCVOX_ARENA_ALIGN_(nframes * sizeof(tcvox_frame_t));
+            for(uint32_t f = 0; f < nframes; f++)
+                TCVOX_MEASURE_DICT_(&ioffset);
+            } break;
+        case TCVOX_TAG_('n','G','R','P'): {
             ++scene->nodes.ngroups;
-            break;
-        case TCVOX_TAG_('n','S','H','P'):
+            ioffset += 1 * sizeof(uint32_t);    // node ID
+            TCVOX_MEASURE_DICT_(&ioffset);
+
+            uint32_t nchildren;
+            TCVOX_READ_32LE_(&nchildren, ioffset); ioffset += sizeof(uint32_t);
+            TCVOX_CHECK_(nchildren <= (length - ioffset) / sizeof(uint32_t), "Invalid number of children in nGRP (truncated chunk?)");
+            nbytes += TCVOX_ARENA_ALIGN_(nchildren * sizeof(tcvox_transform_node_t*));
+            } break;
+        case TCVOX_TAG_('n','S','H','P'): {
             ++scene->nodes.nshapes;
-            break;
+            ioffset += 1 * sizeof(uint32_t);    // node ID
+            TCVOX_MEASURE_DICT_(&ioffset);
+
+            uint32_t nmodels;
+            TCVOX_READ_32LE_(&nmodels, ioffset); ioffset += sizeof(uint32_t);
+            TCVOX_CHECK_(nmodels <= (length - ioffset) / (2 * sizeof(uint32_t)), "Invalid number of models in nSHP (truncated chunk?)");
+            nbytes += TCVOX_ARENA_ALIGN_(nmodels * sizeof(tcvox_shape_node_model_t));
+            for(uint32_t m = 0; m < nmodels; m++)
+            {
+                ioffset += sizeof(uint32_t);    // model ID
+                TCVOX_MEASURE_DICT_(&ioffset);
+            }
+            } break;
         case TCVOX_TAG_('L','A','Y','R'):
             ++scene->nlayers;
+            ioffset += 1 * sizeof(uint32_t);    // layer ID
+            TCVOX_MEASURE_DICT_(&ioffset);
             break;
         case TCVOX_TAG_('r','C','A','M'):
             ++scene->ncameras;
+            ioffset += 1 * sizeof(uint32_t);    // camera ID
+            TCVOX_MEASURE_DICT_(&ioffset);
             break;
         case TCVOX_TAG_('r','O','B','J'):
             ++scene->nobjects;
+            TCVOX_MEASURE_DICT_(&ioffset);
             break;
+        case TCVOX_TAG_('N','O','T','E'): {
+            uint32_t nnames;
+            TCVOX_READ_32LE_(&nnames, ioffset); ioffset += sizeof(uint32_t);
+            TCVOX_CHECK_(nnames < 256, "Palette names out of bounds");
+            for(uint32_t n = 0; n < nnames; n++)
+            {
+                const char* name; uint32_t nlen;
+                TCVOX_READ_STRING_NOCPY_(&name, &nlen, ioffset); ioffset += sizeof(uint32_t) + nlen;
+                nbytes_unaligned += nlen + 1;
+            }
+            } break;
         }
         offset = c.offset_end;
     }
@@ -671,16 +932,84 @@ static const char* tcvox_load_memory_(tcvox_scene_t* scene, const void* ptr, siz
         //scene->nmodels = pack_nmodels;
     }
 
-    TCVOX_ALLOC_CHECK_(scene->models, scene->nmodels, "models");
-    TCVOX_ALLOC_CHECK_(scene->layers, scene->nlayers, "layers");
-    TCVOX_ALLOC_CHECK_(scene->cameras, scene->ncameras, "cameras");
-    TCVOX_ALLOC_CHECK_(scene->objects, scene->nobjects, "objects");
+    // Find models with identical contents, so that we can store each only once.
+    infos = TC__VOID_CAST(struct tcvox_model_info_*, calloc(scene->nmodels ? scene->nmodels : 1, sizeof(*infos) + sizeof(struct tcvox_model_info_*)));
+    TCVOX_CHECK_(infos, "Cannot allocate model information: Out of memory");
+    {
+        struct tcvox_model_info_* info = &infos[0];
+        for(uint32_t offset = c_MAIN.offset_children; offset < length;)
+        {
+            struct tcvox_chunk_ c;
+            TCVOX_READ_CHUNK_HEADER_(&c, offset);
+            // (errors in these chunks are reported by the final read, below)
+            if(info - infos < scene->nmodels)
+            {
+                if(c.tag == TCVOX_TAG_('S','I','Z','E') && c.nbytes_data == 3 * sizeof(uint32_t))
+                {
+                    for(size_t i = 0; i < 3; i++)
+                        TCVOX_READ_32LE_(&info->size[i], c.offset_data + i * sizeof(uint32_t));
+                }
+                else if(c.tag == TCVOX_TAG_('X','Y','Z','I'))
+                {
+                    TCVOX_READ_32LE_(&info->nvoxels, c.offset_data + 0 * sizeof(uint32_t));
+                    TCVOX_CHECK_(c.nbytes_data >= sizeof(uint32_t) + (size_t)info->nvoxels * sizeof(uint32_t), "Invalid XYZI chunk size (truncated chunk?)");
+                    TCVOX_READ_BYTES_NOCPY_(&info->voxels, (size_t)info->nvoxels * sizeof(uint32_t), c.offset_data + 1 * sizeof(uint32_t));
+                    ++info;
+                }
+            }
+            offset = c.offset_end;
+        }
+
+        struct tcvox_model_info_** sorted = (struct tcvox_model_info_**)&infos[scene->nmodels];
+        for(uint32_t m = 0; m < scene->nmodels; m++)
+        {
+            infos[m].index = m;
+            sorted[m] = &infos[m];
+        }
+        qsort(sorted, scene->nmodels, sizeof(*sorted), tcvox_model_info_cmp_);
+        for(uint32_t m = 0; m < scene->nmodels; m++)
+        {
+            sorted[m]->original = m && !tcvox_model_info_cmp_contents_(sorted[m - 1], sorted[m]) ? sorted[m - 1]->original : sorted[m]->index;
+            if(sorted[m]->original == sorted[m]->index && !borrow)
+                nbytes_unaligned += sorted[m]->nvoxels * sizeof(tcvox_voxel_t);
+        }
+    }
 
     scene->nodes.nindex = scene->nodes.ngroups + scene->nodes.nshapes + scene->nodes.ntransforms;
-    TCVOX_ALLOC_CHECK_(scene->nodes.index, scene->nodes.nindex, "nodes index");
-    TCVOX_ALLOC_CHECK_(scene->nodes.groups, scene->nodes.ngroups, "group nodes");
-    TCVOX_ALLOC_CHECK_(scene->nodes.shapes, scene->nodes.nshapes, "shape nodes");
-    TCVOX_ALLOC_CHECK_(scene->nodes.transforms, scene->nodes.ntransforms, "transform nodes");
+    scene->no_nodes_in_file = !scene->nodes.nindex;
+
+    nbytes += TCVOX_ARENA_ALIGN_(scene->nmodels * sizeof(*scene->models))
+            + TCVOX_ARENA_ALIGN_(scene->nlayers * sizeof(*scene->layers))
+            + TCVOX_ARENA_ALIGN_(scene->ncameras * sizeof(*scene->cameras))
+            + TCVOX_ARENA_ALIGN_(scene->nobjects * sizeof(*scene->objects))
+            + TCVOX_ARENA_ALIGN_(scene->nodes.nindex * sizeof(*scene->nodes.index))
+            + TCVOX_ARENA_ALIGN_(scene->nodes.ngroups * sizeof(*scene->nodes.groups))
+            + TCVOX_ARENA_ALIGN_(scene->nodes.nshapes * sizeof(*scene->nodes.shapes))
+            + TCVOX_ARENA_ALIGN_(scene->nodes.ntransforms * sizeof(*scene->nodes.transforms));
+    if(scene->no_nodes_in_file && scene->nmodels)   // see the special case at the end
+        nbytes += TCVOX_ARENA_ALIGN_(sizeof(*scene->nodes.index))
+                + TCVOX_ARENA_ALIGN_(sizeof(*scene->nodes.shapes))
+                + TCVOX_ARENA_ALIGN_(scene->nmodels * sizeof(tcvox_shape_node_model_t));
+
+    // (+1, so that even an empty scene has a valid block)
+    scene->_arena = calloc(nbytes + nbytes_unaligned + 1, 1);
+    TCVOX_CHECK_(scene->_arena, "Cannot allocate scene: Out of memory");
+    struct tcvox_arena_ arena = {
+        .data = TC__VOID_CAST(char*, scene->_arena),
+        .data_end = TC__VOID_CAST(char*, scene->_arena) + nbytes,
+        .bytes = TC__VOID_CAST(char*, scene->_arena) + nbytes,
+        .bytes_end = TC__VOID_CAST(char*, scene->_arena) + nbytes + nbytes_unaligned,
+    };
+
+    TCVOX_ARENA_ALLOC_(scene->models, scene->nmodels, "models");
+    TCVOX_ARENA_ALLOC_(scene->layers, scene->nlayers, "layers");
+    TCVOX_ARENA_ALLOC_(scene->cameras, scene->ncameras, "cameras");
+    TCVOX_ARENA_ALLOC_(scene->objects, scene->nobjects, "objects");
+
+    TCVOX_ARENA_ALLOC_(scene->nodes.index, scene->nodes.nindex, "nodes index");
+    TCVOX_ARENA_ALLOC_(scene->nodes.groups, scene->nodes.ngroups, "group nodes");
+    TCVOX_ARENA_ALLOC_(scene->nodes.shapes, scene->nodes.nshapes, "shape nodes");
+    TCVOX_ARENA_ALLOC_(scene->nodes.transforms, scene->nodes.ntransforms, "transform nodes");
 
     tcvox_model_t* model;
     tcvox_object_t* object;
@@ -803,6 +1132,8 @@ static const char* tcvox_load_memory_(tcvox_scene_t* scene, const void* ptr, siz
             }
 
             model->id = model - scene->models;
+            if(infos[model->id].original != model->id)
+                model->original = &scene->models[infos[model->id].original];
             break;
 
         case TCVOX_TAG_('X','Y','Z','I'):
@@ -813,8 +1144,17 @@ static const char* tcvox_load_memory_(tcvox_scene_t* scene, const void* ptr, siz
             TCVOX_READ_32LE_(&model->nvoxels, c.offset_data + 0 * sizeof(uint32_t));
             TCVOX_CHECK_(c.nbytes_data >= sizeof(uint32_t) + model->nvoxels * sizeof(uint32_t), "Invalid XYZI chunk size (truncated chunk?)");
 
-            model->voxels = malloc(model->nvoxels * sizeof(*model->voxels));
-            TCVOX_READ_BYTES_(model->voxels, model->nvoxels * 4, c.offset_data + 1 * sizeof(uint32_t));
+            // the original always comes first, so its voxels have already been read
+            if(model->original)
+                model->voxels = model->original->voxels;
+            else if(borrow)
+                model->voxels = (tcvox_voxel_t*)infos[model->id].voxels;
+            else
+            {
+                model->voxels = (tcvox_voxel_t*)tcvox_arena_alloc_bytes_(&arena, model->nvoxels * sizeof(*model->voxels));
+                TCVOX_CHECK_(model->voxels, "Cannot allocate voxels: Arena size mismatch");
+                TCVOX_READ_BYTES_(model->voxels, model->nvoxels * 4, c.offset_data + 1 * sizeof(uint32_t));
+            }
 
             ++model;
             break;
@@ -828,7 +1168,7 @@ static const char* tcvox_load_memory_(tcvox_scene_t* scene, const void* ptr, siz
             TCVOX_READ_32LE_(&transform->nattrs, c.offset_data + 1 * sizeof(uint32_t));
             uint32_t ioffset = c.offset_data + 2 * sizeof(uint32_t);
 
-            TCVOX_ALLOC_CHECK_(transform->attrs, transform->nattrs, "transform attributes");
+            TCVOX_ARENA_ALLOC_(transform->attrs, transform->nattrs, "transform attributes");
             for(size_t a = 0; a < transform->nattrs; a++)
             {
                 const char* key; uint32_t klen;
@@ -869,14 +1209,14 @@ static const char* tcvox_load_memory_(tcvox_scene_t* scene, const void* ptr, siz
 
             TCVOX_READ_32LE_(&transform->nframes, ioffset); ioffset += sizeof(uint32_t);
             TCVOX_CHECK_(transform->nframes > 0, "Number of frames in nTRN must be at least 1");
-            TCVOX_ALLOC_CHECK_(transform->frames, transform->nframes, "transform frames");
+            TCVOX_ARENA_ALLOC_(transform->frames, transform->nframes, "transform frames");
 
             for(size_t f = 0; f < transform->nframes; f++)
             {
                 tcvox_frame_t* frame = &transform->frames[f];
 
                 TCVOX_READ_32LE_(&frame->nattrs, ioffset); ioffset += sizeof(uint32_t);
-                TCVOX_ALLOC_CHECK_(frame->attrs, frame->nattrs, "frame attributes");
+                TCVOX_ARENA_ALLOC_(frame->attrs, frame->nattrs, "frame attributes");
 
                 // initialize values to defaults
                 for(size_t i = 0; i < 3; i++)
@@ -930,7 +1270,7 @@ static const char* tcvox_load_memory_(tcvox_scene_t* scene, const void* ptr, siz
             TCVOX_READ_32LE_(&group->nattrs, c.offset_data + 1 * sizeof(uint32_t));
             uint32_t ioffset = c.offset_data + 2 * sizeof(uint32_t);
 
-            TCVOX_ALLOC_CHECK_(group->attrs, group->nattrs, "group attributes");
+            TCVOX_ARENA_ALLOC_(group->attrs, group->nattrs, "group attributes");
             for(size_t a = 0; a < group->nattrs; a++)
             {
                 const char* key; uint32_t klen;
@@ -941,7 +1281,7 @@ static const char* tcvox_load_memory_(tcvox_scene_t* scene, const void* ptr, siz
             }
 
             TCVOX_READ_32LE_(&group->nchildren, ioffset); ioffset += sizeof(uint32_t);
-            TCVOX_ALLOC_CHECK_(group->children, group->nchildren, "group children");
+            TCVOX_ARENA_ALLOC_(group->children, group->nchildren, "group children");
             for(size_t c = 0; c < group->nchildren; c++)
             {
                 uint32_t child_id;
@@ -963,7 +1303,7 @@ static const char* tcvox_load_memory_(tcvox_scene_t* scene, const void* ptr, siz
             TCVOX_READ_32LE_(&shape->nattrs, c.offset_data + 1 * sizeof(uint32_t));
             uint32_t ioffset = c.offset_data + 2 * sizeof(uint32_t);
 
-            TCVOX_ALLOC_CHECK_(shape->attrs, shape->nattrs, "shape attributes");
+            TCVOX_ARENA_ALLOC_(shape->attrs, shape->nattrs, "shape attributes");
             for(size_t a = 0; a < shape->nattrs; a++)
             {
                 const char* key; uint32_t klen;
@@ -975,7 +1315,7 @@ static const char* tcvox_load_memory_(tcvox_scene_t* scene, const void* ptr, siz
 
             TCVOX_READ_32LE_(&shape->nmodels, ioffset); ioffset += sizeof(uint32_t);
             TCVOX_CHECK_(shape->nmodels > 0, "A shape must have at least 1 model");
-            TCVOX_ALLOC_CHECK_(shape->models, shape->nmodels, "shape models");
+            TCVOX_ARENA_ALLOC_(shape->models, shape->nmodels, "shape models");
             for(size_t m = 0; m < shape->nmodels; m++)
             {
                 tcvox_shape_node_model_t* smodel = &shape->models[m];
@@ -983,10 +1323,10 @@ static const char* tcvox_load_memory_(tcvox_scene_t* scene, const void* ptr, siz
                 uint32_t model_id;
                 TCVOX_READ_32LE_(&model_id, ioffset); ioffset += sizeof(uint32_t);
                 TCVOX_CHECK_(model_id < scene->nmodels, "Shape model ID out of bounds");
-                smodel->model = &scene->models[model_id];
+                smodel->model = &scene->models[infos[model_id].original];
 
                 TCVOX_READ_32LE_(&smodel->nattrs, ioffset); ioffset += sizeof(uint32_t);
-                TCVOX_ALLOC_CHECK_(smodel->attrs, smodel->nattrs, "shape model attributes");
+                TCVOX_ARENA_ALLOC_(smodel->attrs, smodel->nattrs, "shape model attributes");
                 for(size_t a = 0; a < smodel->nattrs; a++)
                 {
                     const char* key; uint32_t klen;
@@ -1014,7 +1354,7 @@ static const char* tcvox_load_memory_(tcvox_scene_t* scene, const void* ptr, siz
             TCVOX_READ_32LE_(&layer->nattrs, c.offset_data + 1 * sizeof(uint32_t));
             uint32_t ioffset = c.offset_data + 2 * sizeof(uint32_t);
 
-            TCVOX_ALLOC_CHECK_(layer->attrs, layer->nattrs, "layer attributes");
+            TCVOX_ARENA_ALLOC_(layer->attrs, layer->nattrs, "layer attributes");
             for(size_t a = 0; a < layer->nattrs; a++)
             {
                 const char* key; uint32_t klen;
@@ -1054,7 +1394,7 @@ static const char* tcvox_load_memory_(tcvox_scene_t* scene, const void* ptr, siz
             TCVOX_READ_32LE_(&object->nattrs, c.offset_data + 0 * sizeof(uint32_t));
             uint32_t ioffset = c.offset_data + 1 * sizeof(uint32_t);
 
-            TCVOX_ALLOC_CHECK_(object->attrs, object->nattrs, "object attributes");
+            TCVOX_ARENA_ALLOC_(object->attrs, object->nattrs, "object attributes");
             for(size_t a = 0; a < object->nattrs; a++)
             {
                 const char* key; uint32_t klen;
@@ -1081,7 +1421,7 @@ static const char* tcvox_load_memory_(tcvox_scene_t* scene, const void* ptr, siz
             TCVOX_READ_32LE_(&camera->nattrs, c.offset_data + 1 * sizeof(uint32_t));
             uint32_t ioffset = c.offset_data + 2 * sizeof(uint32_t);
 
-            TCVOX_ALLOC_CHECK_(camera->attrs, camera->nattrs, "camera attributes");
+            TCVOX_ARENA_ALLOC_(camera->attrs, camera->nattrs, "camera attributes");
             for(size_t a = 0; a < camera->nattrs; a++)
             {
                 const char* key; uint32_t klen;
@@ -1239,7 +1579,7 @@ static const char* tcvox_load_memory_(tcvox_scene_t* scene, const void* ptr, siz
             if(total)
             {
                 char* ptr;
-                TCVOX_ALLOC_CHECK_NOINIT_(ptr, total, "palette names");
+                TCVOX_ARENA_ALLOC_BYTES_(ptr, total, "palette names");
 
                 for(size_t n = 0; n < nnames; n++)
                 {
@@ -1269,31 +1609,32 @@ static const char* tcvox_load_memory_(tcvox_scene_t* scene, const void* ptr, siz
     }
 
     // special case: some .vox files only have model (SIZE/XYZI) information, without nodes; in that case, create some dummy nodes
-    scene->no_nodes_in_file = !scene->nodes.nindex;
     if(scene->no_nodes_in_file && scene->nmodels)
     {
         assert(!scene->nodes.nshapes);
         scene->nodes.nindex = 1;
         scene->nodes.nshapes = 1;
-        TCVOX_ALLOC_CHECK_NOINIT_(scene->nodes.index, scene->nodes.nindex, "index for single model");
-        TCVOX_ALLOC_CHECK_NOINIT_(scene->nodes.shapes, scene->nodes.nshapes, "shape for single model");
+        TCVOX_ARENA_ALLOC_(scene->nodes.index, scene->nodes.nindex, "index for single model");
+        TCVOX_ARENA_ALLOC_(scene->nodes.shapes, scene->nodes.nshapes, "shape for single model");
 
         scene->nodes.index[0] = (tcvox_node_ref_t){ 0, TCVOX_NODE_REF_TYPE_SHAPE };
         scene->nodes.shapes[0] = (tcvox_shape_node_t){
             .nmodels = scene->nmodels,
         };
-        TCVOX_ALLOC_CHECK_NOINIT_(scene->nodes.shapes[0].models, scene->nodes.shapes[0].nmodels, "shape models");
+        TCVOX_ARENA_ALLOC_(scene->nodes.shapes[0].models, scene->nodes.shapes[0].nmodels, "shape models");
 
         for(size_t m = 0; m < scene->nmodels; m++)
             scene->nodes.shapes[0].models[m] = (tcvox_shape_node_model_t){
-                .model = &scene->models[m],
+                .model = &scene->models[infos[m].original],
             };
     }
 
     assert(!error);
+    free(infos);
     return NULL;
 error:
     assert(error);
+    free(infos);
     tcvox_unload(scene);
     return error;
 }
@@ -1302,124 +1643,76 @@ tcvox_scene_t* tcvox_load_memory(tcvox_scene_t* scene, const void* ptr, size_t l
 {
     if(!scene) return NULL;
     *scene = (tcvox_scene_t){ NULL };
-    scene->error = tcvox_load_memory_(scene, ptr, length);
+    scene->error = tcvox_load_memory_(scene, ptr, length, false);
     return !scene->error ? scene : NULL;
 }
 
+static void tcvox_unmap_(void* data, size_t len)
+{
+#ifdef _WIN32
+    (void)len;
+    UnmapViewOfFile(data);
+#else
+    munmap(data, len);
+#endif
+}
 tcvox_scene_t* tcvox_load_fname(tcvox_scene_t* scene, const char* fname)
 {
     if(!scene) return NULL;
+    *scene = (tcvox_scene_t){ NULL };
 
-    void* data = NULL;
-    FILE* file = fopen(fname, "rb");
-    if(!file)
-    {
-        scene->error = "Unable to open file";
-        goto error;
-    }
-
-    fseek(file, 0, SEEK_END);
-    long int len = ftell(file);
-    if(len < 0)
-    {
-        scene->error = "Unable to determine filesize";
-        goto error;
-    }
-    rewind(file);
-
-    data = malloc(len);
-    if(!data)
-    {
-        scene->error = "Out of memory";
-        goto error;
-    }
+    void* data;
+    size_t len;
+#ifdef _WIN32
+    HANDLE file = CreateFileA(fname, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if(file == INVALID_HANDLE_VALUE) { scene->error = "Unable to open file"; return NULL; }
+    LARGE_INTEGER fsize;
+    if(!GetFileSizeEx(file, &fsize)) { CloseHandle(file); scene->error = "Unable to determine filesize"; return NULL; }
+    len = (size_t)fsize.QuadPart;
+    if(!len) { CloseHandle(file); return tcvox_load_memory(scene, NULL, 0); }    // can't map an empty file
+    HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    CloseHandle(file);      // the mapping keeps the file open
+    if(!mapping) { scene->error = "Unable to map file"; return NULL; }
+    data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(mapping);   // ... and the view keeps the mapping open
+    if(!data) { scene->error = "Unable to map file"; return NULL; }
+#else
+    int fd = open(fname, O_RDONLY);
+    if(fd < 0) { scene->error = "Unable to open file"; return NULL; }
+    struct stat st;
+    if(fstat(fd, &st)) { close(fd); scene->error = "Unable to determine filesize"; return NULL; }
+    len = (size_t)st.st_size;
+    if(!len) { close(fd); return tcvox_load_memory(scene, NULL, 0); }  // can't map an empty file
+    data = mmap(NULL, len, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);  // the mapping keeps the file open
+    if(data == MAP_FAILED) { scene->error = "Unable to map file"; return NULL; }
+#endif
 
-    if(fread(data, 1, len, file) != len)
+    scene->error = tcvox_load_memory_(scene, data, len, true);
+    if(scene->error)
     {
-        scene->error = "Unable to read file";
-        goto error;
+        tcvox_unmap_(data, len);
+        return NULL;
     }
-
-    scene = tcvox_load_memory(scene, data, len);
-
-    free(data);
+    scene->_mapping = data;
+    scene->_mapping_len = len;
     return scene;
-error:
-    if(data) free(data);
-    if(file) fclose(file);
-    return NULL;
-}
-
-static void tcvox_free_attrs_(tcvox_attr_t* attrs, uint32_t nattrs)
-{
-    if(!attrs) return;
-
-    while(nattrs--)
-        free(attrs[nattrs].key);    // value is assigned from key
-    free(attrs);
 }
 
 void tcvox_unload(const tcvox_scene_t* scene)
 {
     if(!scene) return;
 
+    // brick maps & meshes are built after loading, so they are the only things not in the arena
     if(scene->models)
-    {
         for(size_t i = 0; i < scene->nmodels; i++)
-            free(scene->models[i].voxels);
-        free(scene->models);
-    }
-    if(scene->layers)
-    {
-        for(size_t i = 0; i < scene->nlayers; i++)
-            tcvox_free_attrs_(scene->layers[i].attrs, scene->layers[i].nattrs);
-        free(scene->layers);
-    }
-    if(scene->cameras)
-    {
-        for(size_t i = 0; i < scene->ncameras; i++)
-            tcvox_free_attrs_(scene->cameras[i].attrs, scene->cameras[i].nattrs);
-        free(scene->cameras);
-    }
-
-    free(scene->nodes.index);
-    if(scene->nodes.groups)
-    {
-        for(size_t i = 0; i < scene->nodes.ngroups; i++)
         {
-            tcvox_free_attrs_(scene->nodes.groups[i].attrs, scene->nodes.groups[i].nattrs);
-            free(scene->nodes.groups[i].children);
+            free(scene->models[i].bricks);
+            free(scene->models[i].mesh.vertices);
         }
-        free(scene->nodes.groups);
-    }
-    if(scene->nodes.shapes)
-    {
-        for(size_t i = 0; i < scene->nodes.nshapes; i++)
-        {
-            tcvox_free_attrs_(scene->nodes.shapes[i].attrs, scene->nodes.shapes[i].nattrs);
-            if(scene->nodes.shapes[i].models)
-            {
-                for(size_t m = 0; m < scene->nodes.shapes[i].nmodels; m++)
-                    tcvox_free_attrs_(scene->nodes.shapes[i].models[m].attrs, scene->nodes.shapes[i].models[m].nattrs);
-                free(scene->nodes.shapes[i].models);
-            }
-        }
-        free(scene->nodes.shapes);
-    }
-    if(scene->nodes.transforms)
-    {
-        for(size_t i = 0; i < scene->nodes.ntransforms; i++)
-        {
-            tcvox_free_attrs_(scene->nodes.transforms[i].attrs, scene->nodes.transforms[i].nattrs);
-            if(scene->nodes.transforms[i].frames)
-            {
-                for(size_t f = 0; f < scene->nodes.transforms[i].nframes; f++)
-                    tcvox_free_attrs_(scene->nodes.transforms[i].frames[f].attrs, scene->nodes.transforms[i].frames[f].nattrs);
-                free(scene->nodes.transforms[i].frames);
-            }
-        }
-        free(scene->nodes.transforms);
-    }
+    free(scene->_arena);
+    if(scene->_mapping)
+        tcvox_unmap_(scene->_mapping, scene->_mapping_len);
 }
 
 tcvox_transform_t tcvox_transform_combine(tcvox_transform_t parent, tcvox_transform_t child)
@@ -1631,5 +1924,477 @@ bool tcvox_scene_compute_bounds(tcvox_scene_t* scene, tcvox_ivec3_t bounds[TC__S
     return true;
 }
 
+static int tcvox_ctz64_(uint64_t x)
+{
+#if defined(_MSC_VER) && defined(_M_X64)
+    unsigned long index;
+    _BitScanForward64(&index, x);
+    return index;
+#elif defined(__GNUC__)
+    return __builtin_ctzll(x);
+#else
+    int n = 0;
+    while(!(x & 1)) { x >>= 1; n++; }
+    return n;
+#endif
+}
+
+bool tcvox_model_build_bricks(tcvox_model_t* model)
+{
+    if(model->bricks)
+        return true;
+
+    tcvox_ivec3_t nbricks;
+    for(size_t i = 0; i < 3; i++)
+    {
+        // voxel coordinates are 8-bit, so anything beyond 256 cannot be occupied
+        int32_t size = model->size.xyz[i] < 256 ? model->size.xyz[i] : 256;
+        nbricks.xyz[i] = size > 0 ? (size + TCVOX_BRICK_SIZE - 1) / TCVOX_BRICK_SIZE : 0;
+    }
+    size_t nmap = (size_t)nbricks.x * nbricks.y * nbricks.z;
+    // align so that the bricks (which follow the map) are properly aligned
+    size_t offset_map = (sizeof(tcvox_brickmap_t) + sizeof(uint64_t) - 1) & ~(sizeof(uint64_t) - 1);
+    size_t offset_bricks = (offset_map + nmap * sizeof(uint16_t) + sizeof(uint64_t) - 1) & ~(sizeof(uint64_t) - 1);
+
+    // We do this in two passes: first to count the (non-empty) bricks, then to fill them in.
+    tcvox_brickmap_t* bricks = TC__VOID_CAST(tcvox_brickmap_t*, malloc(offset_bricks));
+    if(!bricks) return false;
+    uint16_t* map = (uint16_t*)((char*)bricks + offset_map);
+    memset(map, 0xFF, nmap * sizeof(*map));
+
+    uint32_t nfilled = 0;
+    for(uint32_t v = 0; v < model->nvoxels; v++)
+    {
+        const uint8_t* xyz = model->voxels[v].xyz;
+        if(xyz[0] >= model->size.x || xyz[1] >= model->size.y || xyz[2] >= model->size.z)
+            continue;
+        uint16_t* b = &map[((size_t)(xyz[2] >> 3) * nbricks.y + (xyz[1] >> 3)) * nbricks.x + (xyz[0] >> 3)];
+        if(*b == TCVOX_BRICK_NONE)
+            *b = nfilled++;
+    }
+
+    tcvox_brickmap_t* nbm = TC__VOID_CAST(tcvox_brickmap_t*, realloc(bricks, offset_bricks + nfilled * sizeof(tcvox_brick_t)));
+    if(!nbm) { free(bricks); return false; }
+    bricks = nbm;
+    bricks->size = nbricks;
+    bricks->map = (uint16_t*)((char*)bricks + offset_map);
+    bricks->nbricks = nfilled;
+    bricks->bricks = (tcvox_brick_t*)((char*)bricks + offset_bricks);
+    memset(bricks->bricks, 0, nfilled * sizeof(tcvox_brick_t));
+
+    for(uint32_t v = 0; v < model->nvoxels; v++)
+    {
+        const tcvox_voxel_t* voxel = &model->voxels[v];
+        const uint8_t* xyz = voxel->xyz;
+        if(xyz[0] >= model->size.x || xyz[1] >= model->size.y || xyz[2] >= model->size.z)
+            continue;
+        tcvox_brick_t* brick = &bricks->bricks[bricks->map[((size_t)(xyz[2] >> 3) * nbricks.y + (xyz[1] >> 3)) * nbricks.x + (xyz[0] >> 3)]];
+        uint8_t x = xyz[0] & 7, y = xyz[1] & 7, z = xyz[2] & 7;
+        // a zero index would be indistinguishable from an empty voxel, so treat it as such
+        if(voxel->index)
+            brick->occupancy[z] |= (uint64_t)1 << (y * 8 + x);
+        else
+            brick->occupancy[z] &= ~((uint64_t)1 << (y * 8 + x));
+        brick->index[z][y][x] = voxel->index;
+    }
+
+    model->bricks = bricks;
+    return true;
+}
+bool tcvox_scene_build_bricks(tcvox_scene_t* scene)
+{
+    for(size_t i = 0; i < scene->nmodels; i++)
+        if(!scene->models[i].original && !tcvox_model_build_bricks(&scene->models[i]))
+            return false;
+    return true;
+}
+uint8_t tcvox_model_get(const tcvox_model_t* model, int32_t x, int32_t y, int32_t z)
+{
+    if(x < 0 || y < 0 || z < 0 || model->size.x <= x || model->size.y <= y || model->size.z <= z)
+        return 0;
+
+    const tcvox_brickmap_t* bricks = model->bricks;
+    if(!bricks)
+    {
+        // the last voxel wins, to match the brick map
+        uint8_t index = 0;
+        for(uint32_t v = 0; v < model->nvoxels; v++)
+        {
+            const uint8_t* xyz = model->voxels[v].xyz;
+            if(xyz[0] == x && xyz[1] == y && xyz[2] == z)
+                index = model->voxels[v].index;
+        }
+        return index;
+    }
+
+    if(bricks->size.x * TCVOX_BRICK_SIZE <= x || bricks->size.y * TCVOX_BRICK_SIZE <= y || bricks->size.z * TCVOX_BRICK_SIZE <= z)
+        return 0;
+    uint16_t b = bricks->map[((size_t)(z >> 3) * bricks->size.y + (y >> 3)) * bricks->size.x + (x >> 3)];
+    if(b == TCVOX_BRICK_NONE)
+        return 0;
+    return bricks->bricks[b].index[z & 7][y & 7][x & 7];
+}
+
+static const uint64_t* tcvox_brick_occupancy_(const tcvox_brickmap_t* bricks, int32_t bx, int32_t by, int32_t bz)
+{
+    static const uint64_t empty[8] = {0};
+    if(bx < 0 || by < 0 || bz < 0 || bricks->size.x <= bx || bricks->size.y <= by || bricks->size.z <= bz)
+        return empty;
+    uint16_t b = bricks->map[((size_t)bz * bricks->size.y + by) * bricks->size.x + bx];
+    return b != TCVOX_BRICK_NONE ? bricks->bricks[b].occupancy : empty;
+}
+void tcvox_model_brick_faces(const tcvox_model_t* model, int32_t bx, int32_t by, int32_t bz, uint64_t faces[TC__STATIC_SIZE(6)][8])
+{
+    // bits where x=0 and x=7, respectively
+    const uint64_t X0 = UINT64_C(0x0101010101010101);
+    const uint64_t X7 = UINT64_C(0x8080808080808080);
+
+    const tcvox_brickmap_t* bricks = model->bricks;
+    const uint64_t* c = tcvox_brick_occupancy_(bricks, bx, by, bz);
+    const uint64_t* nx = tcvox_brick_occupancy_(bricks, bx - 1, by, bz);
+    const uint64_t* px = tcvox_brick_occupancy_(bricks, bx + 1, by, bz);
+    const uint64_t* ny = tcvox_brick_occupancy_(bricks, bx, by - 1, bz);
+    const uint64_t* py = tcvox_brick_occupancy_(bricks, bx, by + 1, bz);
+    const uint64_t* nz = tcvox_brick_occupancy_(bricks, bx, by, bz - 1);
+    const uint64_t* pz = tcvox_brick_occupancy_(bricks, bx, by, bz + 1);
+    for(size_t z = 0; z < 8; z++)
+    {
+        uint64_t s = c[z];
+        // shift each neighbour into the voxel's position, filling in the border from the adjacent brick
+        faces[0][z] = s & ~(((s << 1) & ~X0) | ((nx[z] & X7) >> 7));
+        faces[1][z] = s & ~(((s >> 1) & ~X7) | ((px[z] & X0) << 7));
+        faces[2][z] = s & ~((s << 8) | (ny[z] >> 56));
+        faces[3][z] = s & ~((s >> 8) | (py[z] << 56));
+        faces[4][z] = s & ~(z > 0 ? c[z - 1] : nz[7]);
+        faces[5][z] = s & ~(z < 7 ? c[z + 1] : pz[0]);
+    }
+}
+
+tcvox_surface_iter_t tcvox_model_iter_surface(const tcvox_model_t* model)
+{
+    tcvox_surface_iter_t it;
+    memset(&it, 0, sizeof(it));
+    it.model = model;
+    it._brick = UINT32_MAX;
+    it._z = 8;
+    return it;
+}
+bool tcvox_surface_iter_next(tcvox_surface_iter_t* it)
+{
+    const tcvox_brickmap_t* bricks = it->model->bricks;
+    if(!bricks)
+        return false;
+    uint32_t nmap = (uint32_t)bricks->size.x * bricks->size.y * bricks->size.z;
+    while(!it->_bits)
+    {
+        if(++it->_z >= 8)
+        {
+            // advance to the next non-empty brick
+            do
+                if(++it->_brick >= nmap)
+                {
+                    it->_brick = nmap;
+                    return false;
+                }
+            while(bricks->map[it->_brick] == TCVOX_BRICK_NONE);
+
+            int32_t bx = it->_brick % bricks->size.x;
+            int32_t by = it->_brick / bricks->size.x % bricks->size.y;
+            int32_t bz = it->_brick / bricks->size.x / bricks->size.y;
+            tcvox_model_brick_faces(it->model, bx, by, bz, it->_faces);
+            it->_z = 0;
+        }
+        it->_bits = it->_faces[0][it->_z] | it->_faces[1][it->_z] | it->_faces[2][it->_z]
+                  | it->_faces[3][it->_z] | it->_faces[4][it->_z] | it->_faces[5][it->_z];
+    }
+
+    int bit = tcvox_ctz64_(it->_bits);
+    it->_bits &= it->_bits - 1;
+
+    uint32_t x = bit & 7, y = bit >> 3, z = it->_z;
+    it->pos.x = it->_brick % bricks->size.x * TCVOX_BRICK_SIZE + x;
+    it->pos.y = it->_brick / bricks->size.x % bricks->size.y * TCVOX_BRICK_SIZE + y;
+    it->pos.z = it->_brick / bricks->size.x / bricks->size.y * TCVOX_BRICK_SIZE + z;
+    it->index = bricks->bricks[bricks->map[it->_brick]].index[z][y][x];
+    it->faces = 0;
+    for(size_t f = 0; f < 6; f++)
+        it->faces |= ((it->_faces[f][z] >> bit) & 1) << f;
+    return true;
+}
+
+
+// length of the run of set bits in `bits`, starting at `start` (and stopping at `end`)
+static uint32_t tcvox_bits_run_(const uint64_t* bits, uint32_t start, uint32_t end)
+{
+    uint32_t i = start;
+    while(i < end)
+    {
+        // (the shift fills in zeroes, i.e. ones in `bits`, so a run continuing into the next word yields 0 here)
+        uint64_t word = ~bits[i >> 6] >> (i & 63);
+        if(word)
+        {
+            i += tcvox_ctz64_(word);
+            break;
+        }
+        i = (i | 63) + 1;
+    }
+    return (i < end ? i : end) - start;
+}
+static void tcvox_bits_clear_(uint64_t* bits, uint32_t start, uint32_t end)
+{
+    for(uint32_t i = start; i < end; i = (i | 63) + 1)
+    {
+        uint32_t n = end - i < 64 - (i & 63) ? end - i : 64 - (i & 63);
+        uint64_t mask = n < 64 ? (((uint64_t)1 << n) - 1) << (i & 63) : ~(uint64_t)0;
+        bits[i >> 6] &= ~mask;
+    }
+}
+// like `tcvox_model_get()`, but without bounds checks
+static uint8_t tcvox_brickmap_get_(const tcvox_brickmap_t* bricks, const uint32_t xyz[TC__STATIC_SIZE(3)])
+{
+    uint16_t b = bricks->map[((size_t)(xyz[2] >> 3) * bricks->size.y + (xyz[1] >> 3)) * bricks->size.x + (xyz[0] >> 3)];
+    return b != TCVOX_BRICK_NONE ? bricks->bricks[b].index[xyz[2] & 7][xyz[1] & 7][xyz[0] & 7] : 0;
+}
+static bool tcvox_mesh_push_quad_(tcvox_mesh_t* mesh, uint32_t* mem, const uint32_t corners[TC__STATIC_SIZE(4)][3], uint8_t normal, uint8_t index)
+{
+    if(mesh->nvertices + 4 > *mem)
+    {
+        tcvox_mesh_vertex_t* nvertices = TC__VOID_CAST(tcvox_mesh_vertex_t*, realloc(mesh->vertices, *mem * 2 * sizeof(*mesh->vertices)));
+        if(!nvertices) return false;
+        mesh->vertices = nvertices;
+        *mem *= 2;
+    }
+    for(size_t i = 0; i < 4; i++)
+    {
+        tcvox_mesh_vertex_t* vertex = &mesh->vertices[mesh->nvertices++];
+        for(size_t j = 0; j < 3; j++)
+            vertex->xyz[j] = corners[i][j];
+        vertex->normal = normal;
+        vertex->index = index;
+    }
+    return true;
+}
+
+/*
+    This is a "binary" greedy mesher: for each axis, we gather the occupancy of every column along that axis as a bitset,
+    so that hidden faces can be culled for an entire column at once (`column & ~(column >> 1)` & similar).
+    The remaining faces are transposed into one bitset per row of each slice, where runs of faces are found & merged via bit scans.
+    Since models are at most 256 voxels in each axis, each bitset is at most 4 words.
+ */
+bool tcvox_model_build_mesh(tcvox_model_t* model)
+{
+    if(model->mesh.vertices)
+        return true;
+    if(!tcvox_model_build_bricks(model))
+        return false;
+    const tcvox_brickmap_t* bricks = model->bricks;
+
+    tcvox_mesh_t mesh = {0};
+    uint32_t mem = 64;
+    uint64_t* columns = NULL;
+    uint64_t* rows = NULL;
+    mesh.vertices = TC__VOID_CAST(tcvox_mesh_vertex_t*, malloc(mem * sizeof(*mesh.vertices)));
+    if(!mesh.vertices) goto error;
+
+    uint32_t size[3];
+    for(size_t i = 0; i < 3; i++)
+        size[i] = bricks->size.xyz[i] * TCVOX_BRICK_SIZE < model->size.xyz[i] ? bricks->size.xyz[i] * TCVOX_BRICK_SIZE : model->size.xyz[i];
+
+    for(uint32_t a = 0; a < 3 && bricks->nbricks; a++)
+    {
+        // the slice of each axis is spanned by the other two, in cyclic order (so that u x v = a)
+        uint32_t ua = (a + 1) % 3, va = (a + 2) % 3;
+        uint32_t su = size[ua], sv = size[va], sa = size[a];
+        uint32_t nwa = (sa + 63) >> 6, nwu = (su + 63) >> 6;
+
+        // columns[v][u][nwa], as bitsets along `a`
+        columns = TC__VOID_CAST(uint64_t*, calloc((size_t)sv * su * nwa, sizeof(uint64_t)));
+        // rows[d][v][nwu], as bitsets along `u`
+        rows = TC__VOID_CAST(uint64_t*, malloc((size_t)sa * sv * nwu * sizeof(uint64_t)));
+        if(!columns || !rows) goto error;
+
+        for(uint32_t b = 0, nmap = (uint32_t)bricks->size.x * bricks->size.y * bricks->size.z; b < nmap; b++)
+        {
+            if(bricks->map[b] == TCVOX_BRICK_NONE)
+                continue;
+            const tcvox_brick_t* brick = &bricks->bricks[bricks->map[b]];
+            uint32_t base[3] = {
+                b % bricks->size.x * TCVOX_BRICK_SIZE,
+                b / bricks->size.x % bricks->size.y * TCVOX_BRICK_SIZE,
+                b / bricks->size.x / bricks->size.y * TCVOX_BRICK_SIZE,
+            };
+            for(uint32_t z = 0; z < 8; z++)
+                for(uint64_t bits = brick->occupancy[z]; bits; bits &= bits - 1)
+                {
+                    int bit = tcvox_ctz64_(bits);
+                    uint32_t p[3] = { base[0] + (bit & 7), base[1] + (bit >> 3), base[2] + z };
+                    columns[((size_t)p[va] * su + p[ua]) * nwa + (p[a] >> 6)] |= (uint64_t)1 << (p[a] & 63);
+                }
+        }
+
+        for(uint32_t positive = 0; positive < 2; positive++)
+        {
+            // cull faces & transpose them into rows
+            memset(rows, 0, (size_t)sa * sv * nwu * sizeof(uint64_t));
+            for(uint32_t v = 0; v < sv; v++)
+                for(uint32_t u = 0; u < su; u++)
+                {
+                    const uint64_t* column = &columns[((size_t)v * su + u) * nwa];
+                    for(uint32_t w = 0; w < nwa; w++)
+                    {
+                        // the neighbour of each voxel, in the direction of the face
+                        uint64_t neighbour = positive
+                                           ? column[w] >> 1 | (w + 1 < nwa ? column[w + 1] << 63 : 0)
+                                           : column[w] << 1 | (w ? column[w - 1] >> 63 : 0);
+                        for(uint64_t faces = column[w] & ~neighbour; faces; faces &= faces - 1)
+                        {
+                            uint32_t d = w * 64 + tcvox_ctz64_(faces);
+                            rows[((size_t)d * sv + v) * nwu + (u >> 6)] |= (uint64_t)1 << (u & 63);
+                        }
+                    }
+                }
+
+            // merge faces of the same palette index, first along `u` (within a row), and then along `v` (across rows)
+            for(uint32_t d = 0; d < sa; d++)
+            {
+                uint64_t* slice = &rows[(size_t)d * sv * nwu];
+                for(uint32_t v = 0; v < sv; v++)
+                    for(uint32_t w = 0; w < nwu; w++)
+                        while(slice[v * nwu + w])
+                        {
+                            uint32_t u = w * 64 + tcvox_ctz64_(slice[v * nwu + w]);
+                            uint32_t p[3];
+                            p[a] = d; p[ua] = u; p[va] = v;
+                            uint8_t index = tcvox_brickmap_get_(bricks, p);
+
+                            uint32_t width = tcvox_bits_run_(&slice[v * nwu], u, su);
+                            for(uint32_t i = 1; i < width; i++)
+                            {
+                                p[ua] = u + i;
+                                if(tcvox_brickmap_get_(bricks, p) != index)
+                                {
+                                    width = i;
+                                    break;
+                                }
+                            }
+
+                            uint32_t height = 1;
+                            for(; v + height < sv; height++)
+                            {
+                                if(tcvox_bits_run_(&slice[(v + height) * nwu], u, u + width) != width)
+                                    break;
+                                p[va] = v + height;
+                                uint32_t i;
+                                for(i = 0; i < width; i++)
+                                {
+                                    p[ua] = u + i;
+                                    if(tcvox_brickmap_get_(bricks, p) != index)
+                                        break;
+                                }
+                                if(i < width)
+                                    break;
+                            }
+                            for(uint32_t i = 0; i < height; i++)
+                                tcvox_bits_clear_(&slice[(v + i) * nwu], u, u + width);
+
+                            // (u,v) -> (u+w,v) -> (u+w,v+h) -> (u,v+h) is counter-clockwise when viewed from +a
+                            static const uint8_t order[2][4] = { {0, 3, 2, 1}, {0, 1, 2, 3} };
+                            uint32_t uv[4][2] = { {u, v}, {u + width, v}, {u + width, v + height}, {u, v + height} };
+                            uint32_t corners[4][3];
+                            for(size_t i = 0; i < 4; i++)
+                            {
+                                corners[i][a] = d + positive;
+                                corners[i][ua] = uv[order[positive][i]][0];
+                                corners[i][va] = uv[order[positive][i]][1];
+                            }
+                            if(!tcvox_mesh_push_quad_(&mesh, &mem, corners, a * 2 + positive, index))
+                                goto error;
+                        }
+            }
+        }
+
+        free(columns); columns = NULL;
+        free(rows); rows = NULL;
+    }
+
+    model->mesh = mesh;
+    return true;
+error:
+    free(mesh.vertices);
+    free(columns);
+    free(rows);
+    return false;
+}
+bool tcvox_scene_build_meshes(tcvox_scene_t* scene)
+{
+    for(size_t i = 0; i < scene->nmodels; i++)
+        if(!scene->models[i].original && !tcvox_model_build_mesh(&scene->models[i]))
+            return false;
+    return true;
+}
+
+#ifdef TC_THREAD_H_
+static void tcvox_build_meshes_range_(size_t begin, size_t end, void* udata)
+{
+    tcvox_scene_t* scene = TC__VOID_CAST(tcvox_scene_t*, udata);
+    for(size_t i = begin; i < end; i++)
+        if(!scene->models[i].original)
+            tcvox_model_build_mesh(&scene->models[i]);
+}
+bool tcvox_scene_build_meshes_parallel(tcvox_scene_t* scene, tcthread_pool_t pool)
+{
+    tcthread_pool_parallel_for(pool, scene->nmodels, 1, tcvox_build_meshes_range_, scene);
+    // models that failed (i.e. ran out of memory) have no mesh
+    for(size_t i = 0; i < scene->nmodels; i++)
+        if(!scene->models[i].original && !scene->models[i].mesh.vertices)
+            return false;
+    return true;
+}
+#endif /* TC_THREAD_H_ */
+
+size_t tcvox_scene_get_mesh(tcvox_scene_t* scene, tcvox_mesh_vertex_t* vertices, size_t maxvertices, bool include_hidden)
+{
+    size_t nvertices = 0;
+
+    tcvox_iter_t it = tcvox_scene_iter_shapes(scene, include_hidden);
+    if(it.is_finished)  // out-of-memory
+        return SIZE_MAX;
+    while(tcvox_iter_next(&it))
+    {
+        tcvox_rotation_t r = it.transform.r;
+        // if the rotation is a reflection, we must flip the winding order; it is one iff (# of negated axes) + (parity of the permutation) is odd
+        // (a permutation of 3 elements is odd iff it has exactly 1 fixed point)
+        bool flip = (r.xyz[0].sign ^ r.xyz[1].sign ^ r.xyz[2].sign)
+                  ^ ((r.xyz[0].index == 0) + (r.xyz[1].index == 1) + (r.xyz[2].index == 2) == 1);
+
+        for(size_t m = 0; m < it.shape->nmodels; m++)
+        {
+            tcvox_model_t* model = it.shape->models[m].model;
+            if(!tcvox_model_build_mesh(model))
+            {
+                tcvox_iter_finish(&it);
+                return SIZE_MAX;
+            }
+
+            for(uint32_t v = 0; v < model->mesh.nvertices && nvertices + v < maxvertices; v++)
+            {
+                const tcvox_mesh_vertex_t* vertex = &model->mesh.vertices[flip ? (v & ~3u) | (-v & 3u) : v];
+                tcvox_ivec3_t pos;
+                for(size_t i = 0; i < 3; i++)
+                    pos.xyz[i] = vertex->xyz[i] - model->size.xyz[i] / 2;
+                pos = tcvox_transform_apply(it.transform, pos, true);
+
+                tcvox_mesh_vertex_t* out = &vertices[nvertices + v];
+                for(size_t i = 0; i < 3; i++)
+                    out->xyz[i] = pos.xyz[i];
+                tcvox_rotation_axis_t axis = r.xyz[vertex->normal >> 1];
+                out->normal = axis.index * 2 + ((vertex->normal & 1) ^ axis.sign);
+                out->index = vertex->index;
+            }
+            nvertices += model->mesh.nvertices;
+        }
+    }
+    return nvertices;
+}
 
 #endif /* TC_VOX_IMPLEMENTATION */
@@ -1,25 +1,33 @@
 /*
  * tc_xml.h: XML file parser.
  *
- * DEPENDS:
- * VERSION: 0.1.0 (2024-08-01)
+ * DEPENDS: tc_thread (optional)
+ * VERSION: 0.4.0 (2026-10-15)
  * LICENSE: CC0 & Boost (dual-licensed)
  * AUTHOR: Tim Čas
  * URL: https://github.com/darkuranium/tclib
  *
  * VERSION HISTORY:
+ * 0.4.0    added parallel parsing of record-oriented documents via `tcxml_sax_process_parallel()` (requires tc_thread)
+ * 0.3.0    added an arena-allocated DOM, see `tcxml_dom_*()`
+ * 0.2.2    SIMD (SSE2/AVX2/NEON) scanning, see `tcxml_accel_*()`;
+ *          added `tcxml_utf8_validate()` & `TCXML_VALIDATE_UTF8`
+ * 0.2.1    added opt-in zero-copy strings via `TCXML_BORROW_STRINGS`
+ * 0.2.0    added push-mode (chunked) parsing via `tcxml_sax_begin/feed/end()`;
+ *          parser no longer uses recursion for nested elements;
+ *          references in text content are no longer dropped
  * 0.1.0    initial public release
  *
  * TODOS:
  * - Ensure full compliance with XML spec (for non-validating parsers)
- * - Introduce a node-based / DOM-like API
- *   - Add an XPath-like parser to it (but might be a separate lib)
+ * - Add an XPath-like query API to the DOM (but might be a separate lib)
  * - [maybe] Introduce various helper flags (like TCXML_CONCAT_CDATA)
  * - Full C++-compilation-mode support
  */
 #ifndef TC_XML_H_
 #define TC_XML_H_
 
+#include <stddef.h>
 #include <stdint.h>
 #include <stdbool.h>
 
@@ -27,6 +35,8 @@ typedef struct tcxml_string
 {
     size_t len;
     char* ptr;
+    // if set, `ptr` points directly into the source document: it is *not* `\0`-terminated, and must not be modified (see `TCXML_BORROW_STRINGS`)
+    bool borrowed;
 } tcxml_string_t;
 
 typedef struct tcxml_error
@@ -44,9 +54,32 @@ size_t tcxml_utf8_from_utf32(char utf8[4], uint32_t utf32);
 // Convert UTF-8 to UTF-32, returning the number of characters read from `utf8` (or 0 on error).
 // `utf32` may be NULL, in which case this simply counts bytes that make up 1 UTF-32 character.
 size_t tcxml_utf32_from_utf8(uint32_t* utf32, const char* utf8, size_t utf8len);
+// Validate UTF-8 (rejecting overlong forms, surrogates, and code points above U+10FFFF), returning the length of the longest valid prefix (`utf8len` if all of it is valid).
+size_t tcxml_utf8_validate(const char* utf8, size_t utf8len);
+
+// Hardware acceleration (SIMD) for scanning text; works the same as `tcsum_accel_*()` in tc_checksum.h.
+// `get_supported` returns what both the CPU & build support, `get` what is in use, and `set` restricts it (returning the new value).
+// All implementations produce identical results. Define `TCXML_NO_ACCEL` before including the implementation to disable it entirely.
+#define TCXML_ACCEL_NONE        0x0000u
+#define TCXML_ACCEL_X86_SSE2    0x0001u
+#define TCXML_ACCEL_X86_AVX2    0x0002u
+#define TCXML_ACCEL_ARM_NEON    0x0100u
+#define TCXML_ACCEL_ALL         (~0u)
+unsigned int tcxml_accel_get_supported(void);
+unsigned int tcxml_accel_get(void);
+unsigned int tcxml_accel_set(unsigned int accel);
+
+// Pass strings to callbacks as slices of the source document wherever possible (i.e. when no entity references need replacing, and no line endings need normalizing), instead of copying them.
+// Such strings have `borrowed` set, and are only valid for the duration of the callback.
+#define TCXML_BORROW_STRINGS    0x20
+// Report an error on invalid UTF-8. This is checked after each item (tag, text run, comment, ...), so the item's callbacks have already seen the invalid data.
+#define TCXML_VALIDATE_UTF8     0x40
 
 typedef struct tcxml_sax_callbacks
 {
+    // TCXML_BORROW_STRINGS, TCXML_VALIDATE_UTF8, or 0
+    uint32_t flags;
+
     // start of parse
     void (*start)(void* udata);
     // end of parse
@@ -110,12 +143,24 @@ typedef struct tcxml_sax_buffers
         tcxml_string_t* ptr;
     } attrs;
 
-    // element tag name stack
-    /*struct
+    // element tag name stack; `ptr` holds offsets of (`\0`-terminated) names within `chars`
+    struct
     {
         size_t mem, len;
-        tcxml_string_t* ptr;
-    } stack;*/
+        size_t* ptr;
+        struct
+        {
+            size_t mem, len;
+            char* ptr;
+        } chars;
+    } stack;
+
+    // push-mode input that has not been parsed yet (at most one incomplete item, plus whatever the last chunk contained)
+    struct
+    {
+        size_t mem, len;
+        char* ptr;
+    } input;
 } tcxml_sax_buffers_t;
 
 tcxml_sax_buffers_t* tcxml_sax_buffers_init(tcxml_sax_buffers_t* bufs);
@@ -124,12 +169,64 @@ void tcxml_sax_buffers_deinit(const tcxml_sax_buffers_t* bufs);
 /// `bufs` is optional. If NULL, will allocate a temporary context.
 tcxml_error_t tcxml_sax_process(tcxml_sax_buffers_t* bufs, const char* src, const tcxml_sax_callbacks_t* cbs, void* udata);
 
+/// Push-mode (incremental) parsing, for when the document is not available all at once (e.g. when reading from a socket).
+/// Only the unparsed remainder of the input is kept, so memory use is bounded by the largest item (tag, text run, comment, ...), not the document.
+///
+/// Usage:
+///     tcxml_sax_context_t* ctx = tcxml_sax_begin(bufs, &cbs, udata);
+///     while(<have data>)
+///         if(!TCXML_ERROR_IS_OK(tcxml_sax_feed(ctx, chunk, chunk_len)))
+///             break;
+///     error = tcxml_sax_end(ctx);
+///
+/// Callbacks are invoked from within `tcxml_sax_feed()` as soon as each item is complete; chunks may be split at arbitrary byte boundaries.
+typedef struct tcxml_parse_context_ tcxml_sax_context_t;
+
+/// `bufs` is optional. If NULL, will allocate a temporary context. Returns NULL on allocation failure.
+tcxml_sax_context_t* tcxml_sax_begin(tcxml_sax_buffers_t* bufs, const tcxml_sax_callbacks_t* cbs, void* udata);
+/// Errors are sticky: once an error is returned, further chunks are ignored (and `tcxml_sax_end()` returns the same error).
+tcxml_error_t tcxml_sax_feed(tcxml_sax_context_t* ctx, const char* chunk, size_t len);
+/// Finish parsing (signalling end-of-file), and free `ctx`.
+tcxml_error_t tcxml_sax_end(tcxml_sax_context_t* ctx);
+
+#ifdef TC_THREAD_H_
+/// Parallel parsing of record-oriented documents, i.e. a root element wrapping many independent child elements ("records").
+///
+/// A fast structural pre-scan finds where each record starts (skipping over comments, CDATA, PIs, and quoted attribute values),
+/// and ranges of records are then parsed as independent SAX passes on `pool`. Everything else (the prolog & root start tag before
+/// the first record, and the root end tag & epilog after the last one) is parsed on the calling thread, before & after the records.
+///
+/// The `udata` passed to every callback is a `tcxml_sax_record_t*`, identifying where the event came from:
+/// - `seq` is the index of the record (the n-th child element of the root) the event belongs to, or `TCXML_SEQ_NONE` outside of records;
+///   text, comments, etc. between two records belong to the preceding one
+/// - `worker` is the calling thread's `tcthread_pool_get_worker_index()`, or the pool's thread count for other threads (e.g. the caller);
+///   this can be used to index per-thread data without locking
+/// - `udata` is the user's `udata`
+/// Events within a record are delivered in order, but different records are delivered concurrently and in no particular order (use `seq` to restore it).
+///
+/// The result (including the error, if any) is the same as with `tcxml_sax_process()`. On error, records other than the one with the error may
+/// have already been reported (including ones that come after it). If the pre-scan cannot make sense of the document, or if `pool` is invalid,
+/// the document is parsed on the calling thread (with `seq` still being provided).
+#define TCXML_SEQ_NONE      SIZE_MAX
+typedef struct tcxml_sax_record
+{
+    size_t seq;
+    uint32_t worker;
+    void* udata;
+} tcxml_sax_record_t;
+
+/// `bufs` is optional (and only used by the calling thread).
+tcxml_error_t tcxml_sax_process_parallel(tcxml_sax_buffers_t* bufs, const char* src, const tcxml_sax_callbacks_t* cbs, void* udata, tcthread_pool_t pool);
+#endif /* TC_THREAD_H_ */
+
 /*
 #define TCXML_CONCAT_CDATA                  0x01    // concatenate neighbouring cdata, e.g. `<![CDATA[foo]]><![CDATA[bar]]>` into `foobar`
 #define TCXML_ALLOW_HTML_LIKE_ATTRIBS       0x02    // allow HTML-like attributes (`<x foo=bar baz/>` --- no quotes and attribs without values)
 #define TCXML_ALLOW_NONCOMPLIANT_COMMENTS   0x04    // allow non-compliant comments, i.e. comments containing `--`
 #define TCXML_INSERT_MISSING_START          0x08    // insert missing start elements (this prevents `error_element_start_missing` from being called)
 #define TCXML_INSERT_MISSING_END            0x10    // insert missing end elements (this prevents `error_element_end_missing` from being called)
+// (0x20 is TCXML_BORROW_STRINGS, 0x40 is TCXML_VALIDATE_UTF8)
+*/
 
 #define TCXML_NODE_XML_DECL                 0   // <?xml ...?>
 #define TCXML_NODE_CDATA                    1   // <![CDATA[...]]>
@@ -137,24 +234,102 @@ tcxml_error_t tcxml_sax_process(tcxml_sax_buffers_t* bufs, const char* src, cons
 #define TCXML_NODE_ELEMENT                  3   // <foo>...</foo> <bar/>
 #define TCXML_NODE_PROCESSING_INSTRUCTION   4   // <?foo ...?>
 #define TCXML_NODE_COMMENT                  5   // <!-- ... -->
-*/
+#define TCXML_NODE_DOCUMENT                 6   // the document itself (always node 0)
+
+/// A compact document tree (DOM), built on top of the SAX parser.
+///
+/// Nodes are stored in a flat array in document order, and refer to each other by index (`TCXML_DOM_NONE` meaning "no node").
+/// All strings live in a bump allocator owned by the `tcxml_dom_t` (usually a single block, sized from the document), so a
+/// document is destroyed (or `tcxml_dom_reset()` for the next one) without visiting individual nodes, and all memory is reused.
+///
+/// Element, processing instruction & attribute names are interned: each distinct name is stored once, and referred to by
+/// its index into `names`. Look a name up once with `tcxml_dom_name_find()`, and then compare indices instead of strings.
+///
+/// Usage:
+///     tcxml_dom_t dom;
+///     tcxml_dom_init(&dom);
+///     error = tcxml_dom_parse(&dom, NULL, src, 0);
+///     uint32_t item = tcxml_dom_name_find(&dom, "item");
+///     for(uint32_t i = tcxml_dom_first_element(&dom, tcxml_dom_root(&dom), item); i != TCXML_DOM_NONE; i = tcxml_dom_next_element(&dom, i, item))
+///         ...
+///     tcxml_dom_deinit(&dom);
+#define TCXML_DOM_NONE      UINT32_MAX
+
+typedef struct tcxml_dom_node
+{
+    uint8_t type;           // TCXML_NODE_*
+    // VALID IN: all (`TCXML_DOM_NONE` in the document node)
+    uint32_t parent;
+    uint32_t next_sibling;
+    // VALID IN: document, element
+    uint32_t first_child, last_child;
+    // VALID IN: xml_decl (always "xml"), element, processing_instruction (the target); index into `names`
+    uint32_t name;
+    // VALID IN: xml_decl (version, encoding, standalone --- if present), element; `attrs.ptr[attr_head]` to `attrs.ptr[attr_head+nattrs-1]`
+    uint32_t attr_head, nattrs;
+    // VALID IN: cdata, text, processing_instruction (the body), comment
+    tcxml_string_t text;
+} tcxml_dom_node_t;
+
+typedef struct tcxml_dom_attr
+{
+    uint32_t name;          // index into `names`
+    tcxml_string_t value;
+} tcxml_dom_attr_t;
+
+typedef struct tcxml_dom
+{
+    struct
+    {
+        size_t mem, len;
+        tcxml_dom_node_t* ptr;
+    } nodes;
+    struct
+    {
+        size_t mem, len;
+        tcxml_dom_attr_t* ptr;
+    } attrs;
+    // interned names (all `\0`-terminated)
+    struct
+    {
+        size_t mem, len;
+        tcxml_string_t* ptr;
+    } names;
 
-typedef struct tcxml_node
-{
-    uint8_t type;
-    // VALID IN: all
-    char* whitespace_pre;   // preceding ignorable whitespace
-    char* whitespace_post;  // following ignorable whitespace
-    // VALID IN: xml_decl (always "xml"), element, processing_instruction
-    char* tag;
-    // VALID IN: cdata, text, processing_instruction, comment
-    tcxml_string_t text;    // text contents
-    // VALID IN: xml_decl, element
-    tcxml_string_t const* args;
-    // VALID IN: element
-    size_t nchildren;
-    struct tcxml_node* children;
-} tcxml_node_t;
+    // (internal) open-addressing hash table of indices into `names`; `mem` is a power of 2
+    struct
+    {
+        size_t mem;
+        uint32_t* ptr;
+    } name_table;
+    // (internal) string storage; a list of blocks, newest first
+    struct tcxml_dom_block_* blocks;
+    // (internal) element that new nodes are being added to
+    uint32_t current;
+    // (internal) these are passed to the SAX parser
+    tcxml_sax_callbacks_t cbs;
+} tcxml_dom_t;
+
+tcxml_dom_t* tcxml_dom_init(tcxml_dom_t* dom);
+void tcxml_dom_deinit(tcxml_dom_t* dom);
+/// Clear the document, but keep the memory for the next one.
+void tcxml_dom_reset(tcxml_dom_t* dom);
+
+/// Reset `dom`, and parse `src` into it. `bufs` is optional (see `tcxml_sax_process()`).
+/// `flags` are the SAX flags (`TCXML_VALIDATE_UTF8` or 0). On error, `dom` holds the part of the document before the error.
+tcxml_error_t tcxml_dom_parse(tcxml_dom_t* dom, tcxml_sax_buffers_t* bufs, const char* src, uint32_t flags);
+/// Push-mode variant of `tcxml_dom_parse()`: reset `dom`, and return a context to be used with `tcxml_sax_feed()` & `tcxml_sax_end()`.
+tcxml_sax_context_t* tcxml_dom_begin(tcxml_dom_t* dom, tcxml_sax_buffers_t* bufs, uint32_t flags);
+
+/// Find the index of an interned name, or `TCXML_DOM_NONE` if no node or attribute in the document uses it.
+uint32_t tcxml_dom_name_find(const tcxml_dom_t* dom, const char* name);
+/// The root element, or `TCXML_DOM_NONE` if there is none (yet).
+uint32_t tcxml_dom_root(const tcxml_dom_t* dom);
+/// First child element of `node` (or next sibling element after `node`) called `name`; `TCXML_DOM_NONE` for `name` matches any element.
+uint32_t tcxml_dom_first_element(const tcxml_dom_t* dom, uint32_t node, uint32_t name);
+uint32_t tcxml_dom_next_element(const tcxml_dom_t* dom, uint32_t node, uint32_t name);
+/// Value of attribute `name` of `node`, or NULL if there is no such attribute.
+const tcxml_string_t* tcxml_dom_attr_find(const tcxml_dom_t* dom, uint32_t node, uint32_t name);
 
 #endif /* TC_XML_H_ */
 
@@ -176,6 +351,269 @@ typedef struct tcxml_node
 //#define TC__RESTRICT(T)     T restrict
 #endif
 
+// hardware acceleration; see `tcxml_accel_*()`
+#ifndef TCXML_NO_ACCEL
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define TCXML_HAVE_X86_
+#define TCXML_TARGET_X86_(T)    __attribute__((target(T)))
+#include <cpuid.h>
+#include <immintrin.h>
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#define TCXML_HAVE_X86_
+#define TCXML_TARGET_X86_(T)
+#include <intrin.h>
+#include <immintrin.h>
+#elif (defined(__GNUC__) || defined(__clang__)) && defined(__aarch64__)
+#define TCXML_HAVE_ARM_
+#include <arm_neon.h>
+#elif defined(_MSC_VER) && defined(_M_ARM64)
+#define TCXML_HAVE_ARM_
+#include <intrin.h>
+#include <arm_neon.h>
+#endif
+#endif /* TCXML_NO_ACCEL */
+
+#define TCXML_ACCEL_UNINIT_     0x80000000u
+static unsigned int tcxml_accel_ = TCXML_ACCEL_UNINIT_;
+
+#ifdef TCXML_HAVE_X86_
+// regs: {eax,ebx,ecx,edx}; returns 0 if the leaf is not available
+static int tcxml_cpuid_(uint32_t regs[4], uint32_t leaf, uint32_t subleaf)
+{
+#ifdef _MSC_VER
+    int iregs[4];
+    __cpuid(iregs, leaf & 0x80000000u);
+    if((uint32_t)iregs[0] < leaf) return 0;
+    __cpuidex(iregs, leaf, subleaf);
+    regs[0] = iregs[0]; regs[1] = iregs[1]; regs[2] = iregs[2]; regs[3] = iregs[3];
+    return 1;
+#else
+    unsigned int a, b, c, d;
+    if(__get_cpuid_max(leaf & 0x80000000u, NULL) < leaf) return 0;
+    __cpuid_count(leaf, subleaf, a, b, c, d);
+    regs[0] = a; regs[1] = b; regs[2] = c; regs[3] = d;
+    return 1;
+#endif
+}
+// only valid if CPUID.1:ECX[27] (OSXSAVE) is set
+static uint64_t tcxml_xgetbv_(uint32_t idx)
+{
+#ifdef _MSC_VER
+    return _xgetbv(idx);
+#else
+    uint32_t lo, hi;
+    __asm__ __volatile__("xgetbv" : "=a"(lo), "=d"(hi) : "c"(idx));
+    return ((uint64_t)hi << 32) | lo;
+#endif
+}
+#endif /* TCXML_HAVE_X86_ */
+unsigned int tcxml_accel_get_supported(void)
+{
+    unsigned int accel = TCXML_ACCEL_NONE;
+#if defined(TCXML_HAVE_X86_)
+    uint32_t r1[4], r7[4];
+    if(!tcxml_cpuid_(r1, 1, 0)) return accel;
+    if(!tcxml_cpuid_(r7, 7, 0)) r7[0] = r7[1] = r7[2] = r7[3] = 0;
+
+    // SSE2: CPUID.1:EDX[26]
+    if(r1[3] & (UINT32_C(1) << 26))
+        accel |= TCXML_ACCEL_X86_SSE2;
+    // AVX2 also requires the OS to save the YMM state (XCR0[2:1])
+    if((r1[2] & (UINT32_C(1) << 27)) && (r1[2] & (UINT32_C(1) << 28)))
+    {
+        uint64_t xcr0 = tcxml_xgetbv_(0);
+        // AVX2: CPUID.7.0:EBX[5]
+        if((xcr0 & 0x06) == 0x06 && (r7[1] & (UINT32_C(1) << 5)))
+            accel |= TCXML_ACCEL_X86_AVX2;
+    }
+#elif defined(TCXML_HAVE_ARM_)
+    // Advanced SIMD is mandatory on AArch64
+    accel |= TCXML_ACCEL_ARM_NEON;
+#endif
+    return accel;
+}
+unsigned int tcxml_accel_get(void)
+{
+    if(tcxml_accel_ & TCXML_ACCEL_UNINIT_)
+        tcxml_accel_ = tcxml_accel_get_supported();
+    return tcxml_accel_;
+}
+unsigned int tcxml_accel_set(unsigned int accel)
+{
+    return tcxml_accel_ = accel & tcxml_accel_get_supported() & ~TCXML_ACCEL_UNINIT_;
+}
+
+/*
+ * Scanning primitives. These search [ptr,end) and return `end` if nothing was found.
+ * The parser always has `*end == 0`, so stopping at `end` is the same as stopping at the `\0` terminator.
+ */
+// Find the first byte that is one of the 4 in `set` (repeat entries to use fewer), or with `invert`, the first that isn't.
+static const char* tcxml_find_scalar_(const char* ptr, const char* end, const char set[4], bool invert)
+{
+    for(; ptr < end; ptr++)
+        if((*ptr == set[0] || *ptr == set[1] || *ptr == set[2] || *ptr == set[3]) != invert)
+            break;
+    return ptr;
+}
+// Find the first byte that is not ASCII.
+static const char* tcxml_find_nonascii_scalar_(const char* ptr, const char* end)
+{
+    // 8 bytes at a time, then 1 at a time
+    for(; end - ptr >= 8; ptr += 8)
+    {
+        uint64_t v;
+        memcpy(&v, ptr, sizeof(v));
+        if(v & UINT64_C(0x8080808080808080))
+            break;
+    }
+    for(; ptr < end; ptr++)
+        if(*ptr & 0x80)
+            break;
+    return ptr;
+}
+
+#if defined(TCXML_HAVE_X86_)
+static unsigned int tcxml_ctz32_(uint32_t v)
+{
+#ifdef _MSC_VER
+    unsigned long idx;
+    _BitScanForward(&idx, v);
+    return idx;
+#else
+    return __builtin_ctz(v);
+#endif
+}
+
+TCXML_TARGET_X86_("sse2")
+static const char* tcxml_find_sse2_(const char* ptr, const char* end, const char set[4], bool invert)
+{
+    __m128i c0 = _mm_set1_epi8(set[0]), c1 = _mm_set1_epi8(set[1]), c2 = _mm_set1_epi8(set[2]), c3 = _mm_set1_epi8(set[3]);
+    uint32_t flip = invert ? 0xFFFF : 0;
+    for(; end - ptr >= 16; ptr += 16)
+    {
+        __m128i v = _mm_loadu_si128((const __m128i*)ptr);
+        __m128i eq = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, c0), _mm_cmpeq_epi8(v, c1)), _mm_or_si128(_mm_cmpeq_epi8(v, c2), _mm_cmpeq_epi8(v, c3)));
+        uint32_t mask = (uint32_t)_mm_movemask_epi8(eq) ^ flip;
+        if(mask)
+            return ptr + tcxml_ctz32_(mask);
+    }
+    return tcxml_find_scalar_(ptr, end, set, invert);
+}
+TCXML_TARGET_X86_("sse2")
+static const char* tcxml_find_nonascii_sse2_(const char* ptr, const char* end)
+{
+    for(; end - ptr >= 16; ptr += 16)
+    {
+        uint32_t mask = (uint32_t)_mm_movemask_epi8(_mm_loadu_si128((const __m128i*)ptr));
+        if(mask)
+            return ptr + tcxml_ctz32_(mask);
+    }
+    return tcxml_find_nonascii_scalar_(ptr, end);
+}
+
+TCXML_TARGET_X86_("avx2")
+static const char* tcxml_find_avx2_(const char* ptr, const char* end, const char set[4], bool invert)
+{
+    __m256i c0 = _mm256_set1_epi8(set[0]), c1 = _mm256_set1_epi8(set[1]), c2 = _mm256_set1_epi8(set[2]), c3 = _mm256_set1_epi8(set[3]);
+    uint32_t flip = invert ? 0xFFFFFFFF : 0;
+
+    // most matches are close by (e.g. the `<` after a short text), so try a 16-byte window first
+    {
+        __m128i v = _mm_loadu_si128((const __m128i*)ptr);
+        __m128i eq = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, _mm256_castsi256_si128(c0)), _mm_cmpeq_epi8(v, _mm256_castsi256_si128(c1))), _mm_or_si128(_mm_cmpeq_epi8(v, _mm256_castsi256_si128(c2)), _mm_cmpeq_epi8(v, _mm256_castsi256_si128(c3))));
+        uint32_t mask = ((uint32_t)_mm_movemask_epi8(eq) ^ flip) & 0xFFFF;
+        if(mask)
+            return ptr + tcxml_ctz32_(mask);
+        ptr += 16;
+    }
+
+    for(; end - ptr >= 32; ptr += 32)
+    {
+        __m256i v = _mm256_loadu_si256((const __m256i*)ptr);
+        __m256i eq = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(v, c0), _mm256_cmpeq_epi8(v, c1)), _mm256_or_si256(_mm256_cmpeq_epi8(v, c2), _mm256_cmpeq_epi8(v, c3)));
+        uint32_t mask = (uint32_t)_mm256_movemask_epi8(eq) ^ flip;
+        if(mask)
+            return ptr + tcxml_ctz32_(mask);
+    }
+    return tcxml_find_scalar_(ptr, end, set, invert);
+}
+#elif defined(TCXML_HAVE_ARM_)
+// NEON has no movemask; narrow each 0x00/0xFF byte to a nibble instead, giving a 64-bit mask with 4 bits per byte
+static uint64_t tcxml_neon_mask_(uint8x16_t eq)
+{
+    return vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(eq), 4)), 0);
+}
+static unsigned int tcxml_ctz64_(uint64_t v)
+{
+#ifdef _MSC_VER
+    unsigned long idx;
+    _BitScanForward64(&idx, v);
+    return idx;
+#else
+    return __builtin_ctzll(v);
+#endif
+}
+
+static const char* tcxml_find_neon_(const char* ptr, const char* end, const char set[4], bool invert)
+{
+    uint8x16_t c0 = vdupq_n_u8(set[0]), c1 = vdupq_n_u8(set[1]), c2 = vdupq_n_u8(set[2]), c3 = vdupq_n_u8(set[3]);
+    uint64_t flip = invert ? UINT64_MAX : 0;
+    for(; end - ptr >= 16; ptr += 16)
+    {
+        uint8x16_t v = vld1q_u8((const uint8_t*)ptr);
+        uint8x16_t eq = vorrq_u8(vorrq_u8(vceqq_u8(v, c0), vceqq_u8(v, c1)), vorrq_u8(vceqq_u8(v, c2), vceqq_u8(v, c3)));
+        uint64_t mask = tcxml_neon_mask_(eq) ^ flip;
+        if(mask)
+            return ptr + (tcxml_ctz64_(mask) >> 2);
+    }
+    return tcxml_find_scalar_(ptr, end, set, invert);
+}
+static const char* tcxml_find_nonascii_neon_(const char* ptr, const char* end)
+{
+    for(; end - ptr >= 16; ptr += 16)
+    {
+        uint8x16_t v = vld1q_u8((const uint8_t*)ptr);
+        if(vmaxvq_u8(v) & 0x80)
+            return ptr + (tcxml_ctz64_(tcxml_neon_mask_(vcltq_s8(vreinterpretq_s8_u8(v), vdupq_n_s8(0)))) >> 2);
+    }
+    return tcxml_find_nonascii_scalar_(ptr, end);
+}
+#endif
+
+static const char* tcxml_find_(const char* ptr, const char* end, const char set[4], bool invert)
+{
+#if defined(TCXML_HAVE_X86_)
+    if(end - ptr >= 16)
+    {
+        unsigned int accel = tcxml_accel_get();
+        if(accel & TCXML_ACCEL_X86_AVX2)
+            return tcxml_find_avx2_(ptr, end, set, invert);
+        if(accel & TCXML_ACCEL_X86_SSE2)
+            return tcxml_find_sse2_(ptr, end, set, invert);
+    }
+#elif defined(TCXML_HAVE_ARM_)
+    if(end - ptr >= 16 && (tcxml_accel_get() & TCXML_ACCEL_ARM_NEON))
+        return tcxml_find_neon_(ptr, end, set, invert);
+#endif
+    return tcxml_find_scalar_(ptr, end, set, invert);
+}
+static const char* tcxml_find_nonascii_(const char* ptr, const char* end)
+{
+#if defined(TCXML_HAVE_X86_)
+    if(end - ptr >= 16)
+    {
+        // (there is no AVX2 version: non-ASCII text tends to have a multi-byte character every few dozen bytes, where it was slower than SSE2)
+        if(tcxml_accel_get() & TCXML_ACCEL_X86_SSE2)
+            return tcxml_find_nonascii_sse2_(ptr, end);
+    }
+#elif defined(TCXML_HAVE_ARM_)
+    if(end - ptr >= 16 && (tcxml_accel_get() & TCXML_ACCEL_ARM_NEON))
+        return tcxml_find_nonascii_neon_(ptr, end);
+#endif
+    return tcxml_find_nonascii_scalar_(ptr, end);
+}
+#define TCXML_SET_WSPACE_   ((const char[4]){ ' ', '\t', '\r', '\n' })
+
 size_t tcxml_utf8_from_utf32(char utf8[4], uint32_t utf32)
 {
     if(utf32 <= 0x7F)
@@ -200,8 +638,8 @@ size_t tcxml_utf8_from_utf32(char utf8[4], uint32_t utf32)
     {
         utf8[0] = 0xF0 | (utf32 >> 18);         // 11110xxx
         utf8[1] = 0x80 | ((utf32 >> 12) & 0x3F);// 10xxxxxx
-        utf8[1] = 0x80 | ((utf32 >> 6) & 0x3F); // 10xxxxxx
-        utf8[2] = 0x80 | (utf32 & 0x3F);        // 10xxxxxx
+        utf8[2] = 0x80 | ((utf32 >> 6) & 0x3F); // 10xxxxxx
+        utf8[3] = 0x80 | (utf32 & 0x3F);        // 10xxxxxx
         return 4;
     }
     return 0;   // invalid
@@ -253,7 +691,7 @@ size_t tcxml_utf32_from_utf8(uint32_t* utf32, const char* utf8, size_t utf8len)
     && (utf8[2] & 0xC0) == 0x80     // 10xxxxxx
     && (utf8[3] & 0xC0) == 0x80)    // 10xxxxxx
     {
-        *utf32 = (utf8[0] & 0x0F) << 18
+        *utf32 = (utf8[0] & 0x07) << 18
                | (utf8[1] & 0x3F) << 12
                | (utf8[2] & 0x3F) << 6
                | (utf8[3] & 0x3F);
@@ -264,6 +702,49 @@ size_t tcxml_utf32_from_utf8(uint32_t* utf32, const char* utf8, size_t utf8len)
     return 0;   // invalid UTF-8
 }
 
+size_t tcxml_utf8_validate(const char* utf8, size_t utf8len)
+{
+    const char* end = utf8 + utf8len;
+    const char* ptr = utf8;
+    for(;;)
+    {
+        // skip ASCII (SIMD), then check any non-ASCII sequences one by one
+        ptr = tcxml_find_nonascii_(ptr, end);
+        while(ptr < end && (*ptr & 0x80))
+        {
+            // well-formed byte sequences, as per the Unicode standard (table 3-7)
+            const unsigned char* u = (const unsigned char*)ptr;
+            size_t n;
+            unsigned char lo = 0x80, hi = 0xBF;   // range of 2nd byte
+            if(0xC2 <= u[0] && u[0] <= 0xDF)
+                n = 2;
+            else if(0xE0 <= u[0] && u[0] <= 0xEF)
+            {
+                n = 3;
+                if(u[0] == 0xE0) lo = 0xA0;         // overlong
+                else if(u[0] == 0xED) hi = 0x9F;    // surrogates
+            }
+            else if(0xF0 <= u[0] && u[0] <= 0xF4)
+            {
+                n = 4;
+                if(u[0] == 0xF0) lo = 0x90;         // overlong
+                else if(u[0] == 0xF4) hi = 0x8F;    // above U+10FFFF
+            }
+            else
+                return ptr - utf8;
+
+            if((size_t)(end - ptr) < n || u[1] < lo || hi < u[1])
+                return ptr - utf8;
+            for(size_t i = 2; i < n; i++)
+                if((u[i] & 0xC0) != 0x80)
+                    return ptr - utf8;
+            ptr += n;
+        }
+        if(ptr == end)
+            return utf8len;
+    }
+}
+
 
 tcxml_sax_buffers_t* tcxml_sax_buffers_init(tcxml_sax_buffers_t* bufs)
 {
@@ -282,7 +763,9 @@ void tcxml_sax_buffers_deinit(const tcxml_sax_buffers_t* bufs)
 
     free(mbufs.text_buf.ptr);
     free(mbufs.attrs.ptr);
-    //free(mbufs.stack.ptr);
+    free(mbufs.stack.ptr);
+    free(mbufs.stack.chars.ptr);
+    free(mbufs.input.ptr);
 }
 
 
@@ -300,8 +783,23 @@ struct tcxml_parse_context_
 
     // a temporary used by various functions
     tcxml_string_t capture;
+
+    int state;          // TCXML_STATE_*_
+    char* end;          // end of available input (always points to a `\0`)
+    size_t scan;        // (push-mode only) offset from `ptr` from which to resume searching for the end of the current item
+    size_t base;        // offset of `str` within the document (push-mode discards input that was already parsed)
+    char* lc_head;      // start of input not yet accounted for in `lc`
+    tcxml_error_t lc;   // line & column of `lc_head`
+    bool fragment;      // (parallel-mode only) input is a slice of the root element's content, which ends at `\0` instead of its end tag
+
+    tcxml_sax_buffers_t bufs_own;   // used if the user did not provide `bufs`
 };
 
+#define TCXML_STATE_BEGIN_      0   // before optional BOM & XMLDecl
+#define TCXML_STATE_PROLOG_     1   // Misc* before the root element
+#define TCXML_STATE_CONTENT_    2   // inside the root element
+#define TCXML_STATE_EPILOG_     3   // Misc* after the root element
+
 static size_t tcxml_next_pow_2_(size_t v)
 {
     v--;
@@ -327,7 +825,8 @@ static void tcxml_arr_ensuremem_impl_(void** ptr, size_t size, size_t* mem, size
 }
 //#define TCXML_ARR_ENSUREMEM_(arr) tcxml_arr_ensuremem_impl_(&(arr)->ptr, sizeof(*(arr)->ptr), &(arr)->mem, (arr)->len)
 
-#define TCXML_ARR_APPENDN_(arr, n)  (tcxml_arr_ensuremem_impl_((void**)&(arr)->ptr, sizeof(*(arr)->ptr), &(arr)->mem, ((arr)->len += (n))), &(arr)->ptr[(arr)->len - (n)])
+// (the capacity check is done inline, as this is used several times per item, and the buffers rarely need to grow)
+#define TCXML_ARR_APPENDN_(arr, n)  ((arr)->len += (n), (arr)->mem < (arr)->len ? tcxml_arr_ensuremem_impl_((void**)&(arr)->ptr, sizeof(*(arr)->ptr), &(arr)->mem, (arr)->len) : (void)0, &(arr)->ptr[(arr)->len - (n)])
 //#define TCXML_ARR_PUSH_(arr, item)  (*TCXML_ARR_APPENDN_(arr, 1) = (item))
 //#define TCXML_ARR_POP_(arr)         (assert((arr)->len), (arr)->ptr[--(arr)->len])
 
@@ -341,7 +840,7 @@ static tcxml_string_t tcxml_data_push_(tcxml_sax_buffers_t* restrict bufs, tcxml
     size_t index = bufs->data_buf.len;
 
     // reserve a data slot
-    TCXML_ARR_APPENDN_(&bufs->data_buf, 1);
+    (void)TCXML_ARR_APPENDN_(&bufs->data_buf, 1);
     if(bufs->data_buf.maxlen < bufs->data_buf.len)
     {
         assert(bufs->data_buf.maxlen + 1 == bufs->data_buf.len);
@@ -355,23 +854,25 @@ static tcxml_string_t tcxml_data_push_(tcxml_sax_buffers_t* restrict bufs, tcxml
     bufs->data_buf.ptr[index].len = 0;
 
     if(!str.ptr)
-        return (tcxml_string_t){ 0, NULL };
+        return (tcxml_string_t){ 0, NULL, false };
 
-    TCXML_ARR_APPENDN_(&bufs->data_buf.ptr[index], str.len + 1);
+    (void)TCXML_ARR_APPENDN_(&bufs->data_buf.ptr[index], str.len + 1);
     memcpy(bufs->data_buf.ptr[index].ptr, str.ptr, str.len);
     bufs->data_buf.ptr[index].ptr[str.len] = 0;
     return (tcxml_string_t){
         str.len,
         bufs->data_buf.ptr[index].ptr,
+        false,
     };
 }
-static tcxml_string_t tcxml_data_pushpp_(tcxml_sax_buffers_t* restrict bufs, const char* head, const char* tail)
-{
-    return tcxml_data_push_(bufs, (tcxml_string_t){ tail - head, (char*)head });
-}
-static tcxml_string_t tcxml_data_pushpn_(tcxml_sax_buffers_t* restrict bufs, const char* str, size_t len)
+// Like tcxml_data_push_(), but passes `str` (a slice of the source) through as-is in TCXML_BORROW_STRINGS mode.
+static tcxml_string_t tcxml_data_pass_(tcxml_sax_buffers_t* restrict bufs, const tcxml_sax_callbacks_t* cbs, tcxml_string_t str)
 {
-    return tcxml_data_push_(bufs, (tcxml_string_t){ len, (char*)str });
+    if(!(cbs->flags & TCXML_BORROW_STRINGS) || !str.ptr)
+        return tcxml_data_push_(bufs, str);
+    tcxml_data_push_(bufs, (tcxml_string_t){ 0, NULL, false });    // reserve an (empty) slot anyway, so that tcxml_data_popn_() stays balanced
+    str.borrowed = true;
+    return str;
 }
 // Guaranteed to *not* free memory.
 static void tcxml_data_popn_(tcxml_sax_buffers_t* restrict bufs, size_t n)
@@ -396,6 +897,7 @@ static void tcxml_text_append_(tcxml_sax_buffers_t* restrict bufs, tcxml_string_
         else
         {
             // normalize line endings as we copy; this may reduce the string length, so we fix that up at the end
+            ptr = bufs->text_buf.ptr;   // (we index by `olen` below)
             size_t pos = 0;
             for(;;)
             {
@@ -426,17 +928,36 @@ static void tcxml_text_append_(tcxml_sax_buffers_t* restrict bufs, tcxml_string_
 }
 static void tcxml_text_appendpp_(tcxml_sax_buffers_t* restrict bufs, const char* head, const char* tail, bool normalize_eol)
 {
-    tcxml_text_append_(bufs, (tcxml_string_t){ tail - head, (char*)head }, normalize_eol);
+    tcxml_text_append_(bufs, (tcxml_string_t){ tail - head, (char*)head, false }, normalize_eol);
 }
 static void tcxml_text_appendpn_(tcxml_sax_buffers_t* restrict bufs, const char* str, size_t len, bool normalize_eol)
 {
-    tcxml_text_append_(bufs, (tcxml_string_t){ len, (char*)str }, normalize_eol);
+    tcxml_text_append_(bufs, (tcxml_string_t){ len, (char*)str, false }, normalize_eol);
 }
 static tcxml_string_t tcxml_text_finish_(tcxml_sax_buffers_t* restrict bufs)
 {
-    tcxml_string_t str = {bufs->text_buf.len, bufs->text_buf.ptr};
-    *TCXML_ARR_APPENDN_(&bufs->text_buf, 1) = 0;
-    return str;
+    *TCXML_ARR_APPENDN_(&bufs->text_buf, 1) = 0;   // (may reallocate, so do this first)
+    return (tcxml_string_t){ --bufs->text_buf.len, bufs->text_buf.ptr, false };
+}
+
+
+static void tcxml_stack_push_(tcxml_sax_buffers_t* restrict bufs, tcxml_string_t tag)
+{
+    *TCXML_ARR_APPENDN_(&bufs->stack, 1) = bufs->stack.chars.len;
+    char* ptr = TCXML_ARR_APPENDN_(&bufs->stack.chars, tag.len + 1);
+    memcpy(ptr, tag.ptr, tag.len);
+    ptr[tag.len] = 0;
+}
+static tcxml_string_t tcxml_stack_top_(const tcxml_sax_buffers_t* restrict bufs)
+{
+    assert(bufs->stack.len);
+    size_t offset = bufs->stack.ptr[bufs->stack.len - 1];
+    return (tcxml_string_t){ bufs->stack.chars.len - offset - 1, &bufs->stack.chars.ptr[offset], false };
+}
+static void tcxml_stack_pop_(tcxml_sax_buffers_t* restrict bufs)
+{
+    assert(bufs->stack.len);
+    bufs->stack.chars.len = bufs->stack.ptr[--bufs->stack.len];
 }
 
 
@@ -453,32 +974,36 @@ static int tcxml_string_cmpz_(tcxml_string_t str1, const char* str2)
 
 static bool tcxml_starts_with_(const char* str, const char* start)
 {
-    return !memcmp(str, start, strlen(start));
+    // (not memcmp, so that we stop at the `\0` terminator; and not strncmp, as this is called for nearly every item, with very short strings)
+    for(; *start; str++, start++)
+        if(*str != *start)
+            return false;
+    return true;
+}
+// check if `str` (of length `len`) is a proper prefix of `full`, i.e. whether more input could still make it match
+static bool tcxml_is_partial_(const char* str, size_t len, const char* full)
+{
+    return len < strlen(full) && !memcmp(str, full, len);
 }
 
 static void tcxml_advance_line_col_(const char* head, const char* tail, tcxml_error_t* error)
 {
     while(head < tail)
     {
-        size_t u8chars;
-        switch(head[0])
+        // jump from line break to line break, only looking at the last line's characters
+        const char* eol = tcxml_find_(head, tail, (const char[4]){ '\r', '\n', '\n', '\n' }, false);
+        if(eol == tail)
         {
-        case '\r':
-            if(head + 1 < tail && head[1] == '\n')
-                ++head; // skip over next `head`
-            /* (fallthrough) */
-        case '\n':
-            ++error->line;
-            error->column = 0;
-            ++head;
-            break;
-        default:
-            u8chars = tcxml_utf32_from_utf8(NULL, head, tail - head);
-            if(!u8chars) u8chars = 1;   // in case of invalid UTF-8, we assume 1 char
-            error->column += u8chars;
-            head += u8chars;
+            // count code points, i.e. everything except UTF-8 continuation bytes
+            for(; head < tail; head++)
+                error->column += (*head & 0xC0) != 0x80;
             break;
         }
+        if(eol[0] == '\r' && eol + 1 < tail && eol[1] == '\n')
+            ++eol;  // CRLF counts as one line break
+        ++error->line;
+        error->column = 0;
+        head = eol + 1;
     }
 }
 
@@ -503,11 +1028,7 @@ static bool tcxml_match_(const char* str, struct tcxml_parse_context_* restrict
 #define TCXML_WSPACE_CHARS_ " \t\r\n"
 static size_t tcxml_measure_wspace_left_(tcxml_string_t str)
 {
-    size_t i;
-    for(i = 0; i < str.len; i++)
-        if(!strchr(TCXML_WSPACE_CHARS_, str.ptr[i]))
-            break;
-    return i;
+    return tcxml_find_(str.ptr, str.ptr + str.len, TCXML_SET_WSPACE_, true) - str.ptr;
 }
 static size_t tcxml_measure_wspace_right_(tcxml_string_t str)
 {
@@ -519,41 +1040,14 @@ static size_t tcxml_measure_wspace_right_(tcxml_string_t str)
 }
 
 #define TCXML_ERROR_(MESSAGE)       (ctx->error = tcxml_make_error_(ctx, MESSAGE), false)
-#define TCXML_CAPTURE_(HEAD,TAIL)   (ctx->capture = (tcxml_string_t){ (TAIL) - (HEAD), (HEAD) }, true)
+#define TCXML_CAPTURE_(HEAD,TAIL)   (ctx->capture = (tcxml_string_t){ (TAIL) - (HEAD), (HEAD), false }, true)
 
-static bool tcxml_px_prolog_(struct tcxml_parse_context_* restrict ctx);
-static bool tcxml_px_Misc_(struct tcxml_parse_context_* restrict ctx);
-static bool tcxml_px_CDSect_(struct tcxml_parse_context_* restrict ctx);
 static bool tcxml_p_SDDecl_(struct tcxml_parse_context_* restrict ctx);
-static bool tcxml_px_element_(struct tcxml_parse_context_* restrict ctx);
-static bool tcxml_p_STag_(struct tcxml_parse_context_* restrict ctx);
+static bool tcxml_p_STag_(struct tcxml_parse_context_* restrict ctx, bool* is_empty);
 static bool tcxml_p_ETag_(struct tcxml_parse_context_* restrict ctx);
-static bool tcxml_px_content_(struct tcxml_parse_context_* restrict ctx);
-static bool tcxml_p_EmptyElemTag_(struct tcxml_parse_context_* restrict ctx);
 static bool tcxml_p_Reference_(struct tcxml_parse_context_* restrict ctx);
 static bool tcxml_p_EncodingDecl_(struct tcxml_parse_context_* restrict ctx);
 
-/*
-document    ::= prolog element Misc*
-*/
-static bool tcxml_px_document_(struct tcxml_parse_context_* restrict ctx)
-{
-    if(!tcxml_px_prolog_(ctx))
-        return false;   // forward error
-    if(!tcxml_px_element_(ctx))
-        return false;   // forward error
-
-    char* ptr;
-    do
-    {
-        ptr = ctx->ptr;
-    }
-    while(tcxml_px_Misc_(ctx));
-    ctx->ptr = ptr; // undo last, partial tcxml_p_Misc_
-
-    return true;    // no capture
-}
-
 /*
 ==SKIP==
 Char    ::= #x9 | #xA | #xD | [#x20-#xD7FF] | [#xE000-#xFFFD] | [#x10000-#x10FFFF]
@@ -563,10 +1057,18 @@ Char    ::= #x9 | #xA | #xD | [#x20-#xD7FF] | [#xE000-#xFFFD] | [#x10000-#x10FFF
 /*
 S	   ::=   	(#x20 | #x9 | #xD | #xA)+
  */
+static bool tcxml_is_S_(char c)
+{
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
 static bool tcxml_p_S_(struct tcxml_parse_context_* restrict ctx)
 {
     char* head = ctx->ptr;
-    ctx->ptr += strspn(ctx->ptr, " \t\r\n");
+    // nearly all runs are short (a space between attributes, or a line break & indentation), which isn't worth a SIMD scan
+    while(tcxml_is_S_(*ctx->ptr) && ctx->ptr - head < 16)
+        ++ctx->ptr;
+    if(ctx->ptr - head == 16)
+        ctx->ptr = (char*)tcxml_find_(ctx->ptr, ctx->end, TCXML_SET_WSPACE_, true);
     if(head == ctx->ptr)
         return TCXML_ERROR_("Expected whitespace");
     return TCXML_CAPTURE_(head, ctx->ptr);
@@ -583,39 +1085,30 @@ NameChar        ::= NameStartChar | "-" | "." | [0-9] | #xB7 | [#x0300-#x036F] |
                     [#x203F-#x2040]
 Name            ::= NameStartChar (NameChar)*
 */
-static bool tcxml_p_NameStartChar_(struct tcxml_parse_context_* restrict ctx)
+static bool tcxml_is_NameStartChar_(char c)
 {
     // $$$ TODO: Handle UTF-8
-    if(*ctx->ptr == ':'
-    || ('A' <= *ctx->ptr && *ctx->ptr <= 'Z')
-    || *ctx->ptr == '_'
-    || ('a' <= *ctx->ptr && *ctx->ptr <= 'z'))
-    {
-        char* head = ctx->ptr++;
-        return TCXML_CAPTURE_(head, ctx->ptr);
-    }
-    return TCXML_ERROR_("Expected start of XML name character");
+    return c == ':'
+        || ('A' <= c && c <= 'Z')
+        || c == '_'
+        || ('a' <= c && c <= 'z');
 }
-static bool tcxml_p_NameChar_(struct tcxml_parse_context_* restrict ctx)
+static bool tcxml_is_NameChar_(char c)
 {
-    if(tcxml_p_NameStartChar_(ctx))
-        return true;
     // $$$ TODO: Handle UTF-8
-    if(*ctx->ptr == '-'
-    || *ctx->ptr == '.'
-    || ('0' <= *ctx->ptr && *ctx->ptr <= '9'))
-    {
-        char* head = ctx->ptr++;
-        return TCXML_CAPTURE_(head, ctx->ptr);
-    }
-    return TCXML_ERROR_("Expected XML name character");
+    return tcxml_is_NameStartChar_(c)
+        || c == '-'
+        || c == '.'
+        || ('0' <= c && c <= '9');
 }
 static bool tcxml_p_Name_(struct tcxml_parse_context_* restrict ctx)
 {
     char* head = ctx->ptr;
-    if(!tcxml_p_NameStartChar_(ctx))
+    if(!tcxml_is_NameStartChar_(*ctx->ptr))
         return TCXML_ERROR_("Expected XML name");
-    while(tcxml_p_NameChar_(ctx)) { /* nothing to do */ }
+    do
+        ++ctx->ptr;
+    while(tcxml_is_NameChar_(*ctx->ptr));   // (stops at the `\0` terminator)
     return TCXML_CAPTURE_(head, ctx->ptr);
 }
 /*
@@ -632,31 +1125,45 @@ EntityValue     ::= '"' ([^%&"] | PEReference | Reference)* '"' |
 AttValue	    ::= '"' ([^<&"] | Reference)* '"' |
                     "'" ([^<&'] | Reference)* "'"
 */
-static bool tcxml_p_AttValue_(struct tcxml_parse_context_* restrict ctx)
+// `*verbatim` is set if the value needed no conversion; the result is then a slice of the source
+static bool tcxml_p_AttValue_(struct tcxml_parse_context_* restrict ctx, bool* verbatim)
 {
     char quot = *ctx->ptr;
     if(quot != '"' && quot != '\'')
         return TCXML_ERROR_("Expected `\"` or `'` to start attribute value");
     ++ctx->ptr; // quot
 
+    char* vhead = ctx->ptr;
+    *verbatim = true;
     tcxml_text_reset_(ctx->bufs);
     while(*ctx->ptr && *ctx->ptr != quot)
     {
-        size_t span = strcspn(ctx->ptr, quot == '"' ? "<&\"" : "<&'");
+        size_t span = tcxml_find_(ctx->ptr, ctx->end, (const char[4]){ '<', '&', quot, quot }, false) - ctx->ptr;
+        if(*verbatim && (!span || memchr(ctx->ptr, '\r', span)))
+        {
+            // first reference or CR; from here on, we need to build a converted copy
+            *verbatim = false;
+            tcxml_text_appendpp_(ctx->bufs, vhead, ctx->ptr, false);
+        }
         if(span)
         {
-            tcxml_text_appendpn_(ctx->bufs, ctx->ptr, span, true);
+            if(!*verbatim)
+                tcxml_text_appendpn_(ctx->bufs, ctx->ptr, span, true);
             ctx->ptr += span;
         }
         else if(!tcxml_p_Reference_(ctx))
             return TCXML_ERROR_("Invalid attribute value contents");
     }
+    char* vtail = ctx->ptr;
 
     if(*ctx->ptr != quot)
         return TCXML_ERROR_("Expected end of attribute value quoted string");
     ++ctx->ptr; // quot
 
-    return true;    // forward capture
+    if(*verbatim)
+        return TCXML_CAPTURE_(vhead, vtail);
+    ctx->capture = (tcxml_string_t){ ctx->bufs->text_buf.len, ctx->bufs->text_buf.ptr, false };
+    return true;    // return value in capture
 }
 
 /*
@@ -672,9 +1179,8 @@ CharData        ::= [^<&]* - ([^<&]* ']]>' [^<&]*)
 static bool tcxml_p_CharData_(struct tcxml_parse_context_* restrict ctx)
 {
     char* head = ctx->ptr;
-    ctx->ptr += strcspn(ctx->ptr, "<&");
-    tcxml_text_appendpp_(ctx->bufs, head, ctx->ptr, false);
-    return true;    // CharData always succeeds, as it can be empty
+    ctx->ptr = (char*)tcxml_find_(ctx->ptr, ctx->end, (const char[4]){ '<', '&', '&', '&' }, false);
+    return TCXML_CAPTURE_(head, ctx->ptr);  // CharData always succeeds, as it can be empty
 }
 
 /*
@@ -686,7 +1192,7 @@ static bool tcxml_px_Comment_(struct tcxml_parse_context_* restrict ctx)
         return TCXML_ERROR_("Expected start of a comment");
 
     char* chead = ctx->ptr;
-    while(ctx->ptr[0] && (ctx->ptr[0] != '-' || ctx->ptr[1] != '-'))
+    while((ctx->ptr = (char*)tcxml_find_(ctx->ptr, ctx->end, (const char[4]){ '-', '-', '-', '-' }, false))[0] && ctx->ptr[1] != '-')
         ++ctx->ptr;
     char* ctail = ctx->ptr;
 
@@ -695,7 +1201,7 @@ static bool tcxml_px_Comment_(struct tcxml_parse_context_* restrict ctx)
 
     if(ctx->cbs->comment)
     {
-        tcxml_string_t text = tcxml_data_pushpp_(ctx->bufs, chead, ctail);
+        tcxml_string_t text = tcxml_data_pass_(ctx->bufs, ctx->cbs, (tcxml_string_t){ ctail - chead, chead, false });
         ctx->cbs->comment(text, ctx->udata);
         tcxml_data_popn_(ctx->bufs, 1);
     }
@@ -730,21 +1236,21 @@ static bool tcxml_px_PI_(struct tcxml_parse_context_* restrict ctx)
     if(tcxml_p_S_(ctx))
     {
         char* bhead = ctx->ptr;
-        while(ctx->ptr[0] && (ctx->ptr[0] != '?' || ctx->ptr[1] != '>'))
+        while((ctx->ptr = (char*)tcxml_find_(ctx->ptr, ctx->end, (const char[4]){ '?', '?', '?', '?' }, false))[0] && ctx->ptr[1] != '>')
             ++ctx->ptr;
         char* btail = ctx->ptr;
-        body = (tcxml_string_t){ btail - bhead, bhead };
+        body = (tcxml_string_t){ btail - bhead, bhead, false };
     }
     else
-        body = (tcxml_string_t){ 0, NULL }; // no body => no capture
+        body = (tcxml_string_t){ 0, NULL, false }; // no body => no capture
 
     if(!tcxml_match_("?>", ctx))
         return TCXML_ERROR_("Expected end of processing instruction");
 
     if(ctx->cbs->processing_instruction)
     {
-        target = tcxml_data_push_(ctx->bufs, target);
-        body = tcxml_data_push_(ctx->bufs, body);
+        target = tcxml_data_pass_(ctx->bufs, ctx->cbs, target);
+        body = tcxml_data_pass_(ctx->bufs, ctx->cbs, body);
         ctx->cbs->processing_instruction(target, body, ctx->udata);
         tcxml_data_popn_(ctx->bufs, 2);
     }
@@ -767,11 +1273,10 @@ static bool tcxml_p_CDStart_(struct tcxml_parse_context_* restrict ctx)
 static bool tcxml_p_CData_(struct tcxml_parse_context_* restrict ctx)
 {
     char* dhead = ctx->ptr;
-    while(ctx->ptr[0] && (ctx->ptr[0] != ']' || ctx->ptr[1] != ']' || ctx->ptr[2] != '>'))
+    while((ctx->ptr = (char*)tcxml_find_(ctx->ptr, ctx->end, (const char[4]){ ']', ']', ']', ']' }, false))[0] && (ctx->ptr[1] != ']' || ctx->ptr[2] != '>'))
         ++ctx->ptr;
     char* dtail = ctx->ptr;
-    tcxml_text_appendpp_(ctx->bufs, dhead, dtail, true);
-    return true;    // result in text_buf
+    return TCXML_CAPTURE_(dhead, dtail);
 }
 static bool tcxml_p_CDEnd_(struct tcxml_parse_context_* restrict ctx)
 {
@@ -784,17 +1289,28 @@ static bool tcxml_px_CDSect_(struct tcxml_parse_context_* restrict ctx)
     if(!tcxml_p_CDStart_(ctx))
         return false;   // forward error
 
-    tcxml_text_reset_(ctx->bufs);
     if(!tcxml_p_CData_(ctx))
         return false;   // forward error
+    tcxml_string_t cdata = ctx->capture;
 
     if(!tcxml_p_CDEnd_(ctx))
         return false;   // forward error
 
     if(ctx->cbs->cdata)
     {
-        tcxml_string_t cdata = tcxml_text_finish_(ctx->bufs);
-        ctx->cbs->cdata(cdata, ctx->udata);
+        if(memchr(cdata.ptr, '\r', cdata.len))
+        {
+            tcxml_text_reset_(ctx->bufs);
+            tcxml_text_append_(ctx->bufs, cdata, true);
+            cdata = tcxml_text_finish_(ctx->bufs);
+            ctx->cbs->cdata(cdata, ctx->udata);
+        }
+        else
+        {
+            cdata = tcxml_data_pass_(ctx->bufs, ctx->cbs, cdata);
+            ctx->cbs->cdata(cdata, ctx->udata);
+            tcxml_data_popn_(ctx->bufs, 1);
+        }
     }
 
     return true;
@@ -868,7 +1384,7 @@ static bool tcxml_px_XMLDecl_(struct tcxml_parse_context_* restrict ctx)
         encoding = ctx->capture;
     else
     {
-        encoding = (tcxml_string_t){ 0, NULL };
+        encoding = (tcxml_string_t){ 0, NULL, false };
         ctx->ptr = ptr;
     }
 
@@ -889,8 +1405,8 @@ static bool tcxml_px_XMLDecl_(struct tcxml_parse_context_* restrict ctx)
 
     if(ctx->cbs->xml_decl)
     {
-        version = tcxml_data_push_(ctx->bufs, version);
-        encoding = tcxml_data_push_(ctx->bufs, encoding);
+        version = tcxml_data_pass_(ctx->bufs, ctx->cbs, version);
+        encoding = tcxml_data_pass_(ctx->bufs, ctx->cbs, encoding);
         bool standalone_bool = standalone;
         ctx->cbs->xml_decl(version, encoding, standalone != -1 ? &standalone_bool : NULL, ctx->udata);
         tcxml_data_popn_(ctx->bufs, 2);
@@ -898,34 +1414,19 @@ static bool tcxml_px_XMLDecl_(struct tcxml_parse_context_* restrict ctx)
 
     return true;
 }
-static bool tcxml_px_prolog_(struct tcxml_parse_context_* restrict ctx)
+static bool tcxml_is_Misc_(const char* ptr)
 {
-    char* ptr;
-
-    ptr = ctx->ptr;
-    if(!tcxml_px_XMLDecl_(ctx))
-        ctx->ptr = ptr;
-
-    do
-    {
-        ptr = ctx->ptr;
-    }
-    while(tcxml_px_Misc_(ctx));
-    ctx->ptr = ptr; // undo last, partial tcxml_px_Misc_
-
-    return true;
+    return tcxml_starts_with_(ptr, "<!--")
+        || tcxml_starts_with_(ptr, "<?")
+        || (*ptr && strchr(TCXML_WSPACE_CHARS_, *ptr));
 }
 static bool tcxml_px_Misc_(struct tcxml_parse_context_* restrict ctx)
 {
-    char* ptr = ctx->ptr;
-
-    if(tcxml_px_Comment_(ctx))
-        return true;
-    ctx->ptr = ptr;
-
-    if(tcxml_px_PI_(ctx))
-        return true;
-    ctx->ptr = ptr;
+    // (we can decide by the first few characters, so no need to backtrack)
+    if(tcxml_starts_with_(ctx->ptr, "<!--"))
+        return tcxml_px_Comment_(ctx);
+    if(tcxml_starts_with_(ctx->ptr, "<?"))
+        return tcxml_px_PI_(ctx);
 
     if(tcxml_p_S_(ctx))
     {
@@ -937,7 +1438,6 @@ static bool tcxml_px_Misc_(struct tcxml_parse_context_* restrict ctx)
         }*/
         return true;
     }
-    //ctx->ptr = ptr;
 
     return TCXML_ERROR_("Expected comment, processing instruction, or whitespace");
 }
@@ -976,83 +1476,75 @@ static bool tcxml_p_SDDecl_(struct tcxml_parse_context_* restrict ctx)
 /*
 element         ::= EmptyElemTag |
                     STag content ETag
+    -- NOTE: parsed iteratively, with an explicit tag stack (see tcxml_parse_item_) --
 */
-static bool tcxml_px_element_(struct tcxml_parse_context_* restrict ctx)
+static bool tcxml_px_element_start_(struct tcxml_parse_context_* restrict ctx)
 {
-    char* ptr;
-
-    ptr = ctx->ptr;
-    if(tcxml_p_EmptyElemTag_(ctx))
-    {
-        if(ctx->cbs->element_start || ctx->cbs->element_end)
-        {
-            assert((ctx->bufs->attrs.len & 1) == 0 && "Expected an even number of attribute elements");
-
-            tcxml_string_t tag = tcxml_data_push_(ctx->bufs, ctx->capture);
-            if(ctx->cbs->element_start)
-                ctx->cbs->element_start(tag, ctx->bufs->attrs.ptr, ctx->bufs->attrs.len / 2, ctx->udata);
-            if(ctx->cbs->element_end)
-                ctx->cbs->element_end(tag, ctx->udata);
-            tcxml_data_popn_(ctx->bufs, 1);
-        }
-        tcxml_data_reset_(ctx->bufs); // (optional)
-        return true;    // don't care about capture (we've already invoked events)
-    }
-    ctx->ptr = ptr;
-
-    if(!tcxml_p_STag_(ctx))
+    bool is_empty;
+    if(!tcxml_p_STag_(ctx, &is_empty))
         return false;   // forward error
     tcxml_string_t start_tag = ctx->capture;
 
-    // TODO: adjust stack
-
-    if(ctx->cbs->element_start)
+    if(ctx->cbs->element_start || (is_empty && ctx->cbs->element_end))
     {
         assert((ctx->bufs->attrs.len & 1) == 0 && "Expected an even number of attribute elements");
 
-        tcxml_string_t tag = tcxml_data_push_(ctx->bufs, start_tag);
-        ctx->cbs->element_start(tag, ctx->bufs->attrs.ptr, ctx->bufs->attrs.len / 2, ctx->udata);
+        tcxml_string_t tag = tcxml_data_pass_(ctx->bufs, ctx->cbs, start_tag);
+        if(ctx->cbs->element_start)
+            ctx->cbs->element_start(tag, ctx->bufs->attrs.ptr, ctx->bufs->attrs.len / 2, ctx->udata);
+        if(is_empty && ctx->cbs->element_end)
+            ctx->cbs->element_end(tag, ctx->udata);
         tcxml_data_popn_(ctx->bufs, 1);
     }
-
     tcxml_data_reset_(ctx->bufs); // (optional)
 
-    tcxml_text_reset_(ctx->bufs);
-    if(!tcxml_px_content_(ctx))
-        return false;   // forward error
-
+    if(!is_empty)
+        tcxml_stack_push_(ctx->bufs, start_tag);
+    return true;    // don't care about capture (we've already invoked events)
+}
+static bool tcxml_px_element_end_(struct tcxml_parse_context_* restrict ctx)
+{
+    char* head = ctx->ptr;
     if(!tcxml_p_ETag_(ctx))
         return false;   // forward error
 
+    tcxml_string_t start_tag = tcxml_stack_top_(ctx->bufs);
     if(start_tag.len != ctx->capture.len || memcmp(start_tag.ptr, ctx->capture.ptr, start_tag.len))
+    {
+        ctx->ptr = head;    // report error at start of end tag
         return TCXML_ERROR_("Mismatched element start/end tags");
+    }
 
     if(ctx->cbs->element_end)
     {
-        tcxml_string_t tag = tcxml_data_push_(ctx->bufs, ctx->capture);
+        tcxml_string_t tag = tcxml_data_pass_(ctx->bufs, ctx->cbs, ctx->capture);
         ctx->cbs->element_end(tag, ctx->udata);
         tcxml_data_popn_(ctx->bufs, 1);
     }
 
+    tcxml_stack_pop_(ctx->bufs);
     return true;    // return nothing
 }
 
 /*
 STag            ::= '<' Name (S Attribute)* S? '>'
+EmptyElemTag    ::= '<' Name (S Attribute)* S? '/>'
 Attribute       ::= Name Eq AttValue
+    -- NOTE: both tags are parsed by the same function, with `is_empty` telling them apart --
 */
 static bool tcxml_p_Attribute_(struct tcxml_parse_context_* restrict ctx)
 {
     if(!tcxml_p_Name_(ctx))
         return TCXML_ERROR_("Expected attribute name");
-    tcxml_string_t name = tcxml_data_push_(ctx->bufs, ctx->capture);
+    tcxml_string_t name = tcxml_data_pass_(ctx->bufs, ctx->cbs, ctx->capture);
 
     if(!tcxml_p_Eq_(ctx))
         return false;   // forward error
 
-    if(!tcxml_p_AttValue_(ctx))
+    bool verbatim;
+    if(!tcxml_p_AttValue_(ctx, &verbatim))
         return false;   // forward error
-    tcxml_string_t value = tcxml_data_pushpn_(ctx->bufs, ctx->bufs->text_buf.ptr, ctx->bufs->text_buf.len);
+    tcxml_string_t value = verbatim ? tcxml_data_pass_(ctx->bufs, ctx->cbs, ctx->capture) : tcxml_data_push_(ctx->bufs, ctx->capture);
 
     tcxml_string_t* attr = TCXML_ARR_APPENDN_(&ctx->bufs->attrs, 2);
     attr[0] = name;
@@ -1060,7 +1552,7 @@ static bool tcxml_p_Attribute_(struct tcxml_parse_context_* restrict ctx)
 
     return true;
 }
-static bool tcxml_p_STag_(struct tcxml_parse_context_* restrict ctx)
+static bool tcxml_p_STag_(struct tcxml_parse_context_* restrict ctx, bool* is_empty)
 {
     char* ptr;
 
@@ -1086,7 +1578,11 @@ static bool tcxml_p_STag_(struct tcxml_parse_context_* restrict ctx)
 
     tcxml_p_S_(ctx);
 
-    if(!tcxml_match_(">", ctx))
+    if(tcxml_match_("/>", ctx))
+        *is_empty = true;
+    else if(tcxml_match_(">", ctx))
+        *is_empty = false;
+    else
         return TCXML_ERROR_("Expected '>' to end element");
 
     ctx->capture = name;
@@ -1103,115 +1599,66 @@ static bool tcxml_p_ETag_(struct tcxml_parse_context_* restrict ctx)
 
     if(!tcxml_p_Name_(ctx))
         return TCXML_ERROR_("Expected XML element tag");
+    tcxml_string_t name = ctx->capture;
 
     tcxml_p_S_(ctx);
 
     if(!tcxml_match_(">", ctx))
         return TCXML_ERROR_("Expected > to end element");
 
-    return true;    // forward Name in capture
+    ctx->capture = name;
+    return true;    // return name in capture
 }
 
 /*
 content         ::= CharData? ((element | Reference | CDSect | PI | Comment) CharData?)*
+    -- NOTE: parsed iteratively (see tcxml_parse_item_); this handles a run of `(CharData | Reference)*`, emitted as a single text event --
 */
-static bool tcxml_px_content_(struct tcxml_parse_context_* restrict ctx)
+static bool tcxml_px_text_(struct tcxml_parse_context_* restrict ctx)
 {
-    tcxml_text_reset_(ctx->bufs);
     tcxml_p_CharData_(ctx);
-    if(ctx->bufs->text_buf.len && ctx->cbs->text)
-    {
-        size_t body_head = tcxml_measure_wspace_left_((tcxml_string_t){ ctx->bufs->text_buf.len, ctx->bufs->text_buf.ptr });
-        size_t body_tail = body_head != ctx->bufs->text_buf.len ? ctx->bufs->text_buf.len - tcxml_measure_wspace_right_((tcxml_string_t){ ctx->bufs->text_buf.len, ctx->bufs->text_buf.ptr }) : body_head;
-        ctx->cbs->text(tcxml_text_finish_(ctx->bufs), body_head, body_tail, ctx->udata);
-    }
+    tcxml_string_t text = ctx->capture;
 
-    for(;;)
+    bool verbatim = *ctx->ptr != '&';
+    if(!verbatim)
     {
-        char* ptr = ctx->ptr;
-
-        if(tcxml_px_element_(ctx))
-            goto alt_parse_ok;
-        ctx->ptr = ptr;
-
-        if(tcxml_p_Reference_(ctx))
-            goto alt_parse_ok;
-        ctx->ptr = ptr;
-
-        if(tcxml_px_CDSect_(ctx))
-            goto alt_parse_ok;
-        ctx->ptr = ptr;
-
-        if(tcxml_px_PI_(ctx))
-            goto alt_parse_ok;
-        ctx->ptr = ptr;
-
-        if(tcxml_px_Comment_(ctx))
-            goto alt_parse_ok;
-        ctx->ptr = ptr;
-
-        break;  // none of these options were valid
-
-alt_parse_ok:
         tcxml_text_reset_(ctx->bufs);
-        tcxml_p_CharData_(ctx);
-        if(ctx->bufs->text_buf.len && ctx->cbs->text)
+        tcxml_text_append_(ctx->bufs, text, false);
+        do
         {
-            size_t body_head = tcxml_measure_wspace_left_((tcxml_string_t){ ctx->bufs->text_buf.len, ctx->bufs->text_buf.ptr });
-            size_t body_tail = body_head != ctx->bufs->text_buf.len ? ctx->bufs->text_buf.len - tcxml_measure_wspace_right_((tcxml_string_t){ ctx->bufs->text_buf.len, ctx->bufs->text_buf.ptr }) : body_head;
-            ctx->cbs->text(tcxml_text_finish_(ctx->bufs), body_head, body_tail, ctx->udata);
+            if(!tcxml_p_Reference_(ctx))
+                return false;   // forward error
+            tcxml_p_CharData_(ctx);
+            tcxml_text_append_(ctx->bufs, ctx->capture, false);
         }
+        while(*ctx->ptr == '&');
+        text = tcxml_text_finish_(ctx->bufs);
+    }
+
+    if(text.len && ctx->cbs->text)
+    {
+        if(verbatim)
+            text = tcxml_data_pass_(ctx->bufs, ctx->cbs, text);
+        size_t body_head = tcxml_measure_wspace_left_(text);
+        size_t body_tail = body_head != text.len ? text.len - tcxml_measure_wspace_right_(text) : body_head;
+        ctx->cbs->text(text, body_head, body_tail, ctx->udata);
+        if(verbatim)
+            tcxml_data_popn_(ctx->bufs, 1);
     }
 
-    return true;    // always ok, as `content` can be empty
+    return true;
 }
 
 /*
-EmptyElemTag    ::= '<' Name (S Attribute)* S? '/>'
+CharRef         ::= '&#' [0-9]+ ';' |
+                    '&#x' [0-9a-fA-F]+ ';'
 */
-static bool tcxml_p_EmptyElemTag_(struct tcxml_parse_context_* restrict ctx)
+static bool tcxml_p_CharRef_(struct tcxml_parse_context_* restrict ctx)
 {
-    char* ptr;
+    if(!tcxml_match_("&#", ctx))
+        return TCXML_ERROR_("Expected '&#' for start of character reference");
 
-    if(!tcxml_match_("<", ctx))
-        return TCXML_ERROR_("Expected '<' for start of element tag");
-
-    if(!tcxml_p_Name_(ctx))
-        return TCXML_ERROR_("Expected XML element tag");
-    tcxml_string_t name = ctx->capture;
-
-    ctx->bufs->attrs.len = 0; // reset # of attributes
-    for(;;)
-    {
-        ptr = ctx->ptr;
-
-        if(!tcxml_p_S_(ctx))
-            break;
-
-        if(!tcxml_p_Attribute_(ctx))
-            break;
-    }
-    ctx->ptr = ptr; // restore ctx->ptr to just before `S Attribute`
-
-    tcxml_p_S_(ctx);
-
-    if(!tcxml_match_("/>", ctx))
-        return TCXML_ERROR_("Expected '/>' to end empty element tag");
-
-    ctx->capture = name;
-    return true;    // return name in capture
-}
-
-/*
-CharRef         ::= '&#' [0-9]+ ';' |
-                    '&#x' [0-9a-fA-F]+ ';'
-*/
-static bool tcxml_p_CharRef_(struct tcxml_parse_context_* restrict ctx)
-{
-    if(!tcxml_match_("&#", ctx))
-        return TCXML_ERROR_("Expected '&#' for start of character reference");
-
-    bool is_hex = tcxml_match_("x", ctx);
+    bool is_hex = tcxml_match_("x", ctx);
 
     char* head = ctx->ptr;
     ctx->ptr += strspn(ctx->ptr, &"ABCDEFabcdef0123456789"[is_hex ? 0 : sizeof("ABCDEFabcdef") - 1]);
@@ -1219,7 +1666,7 @@ static bool tcxml_p_CharRef_(struct tcxml_parse_context_* restrict ctx)
         return TCXML_ERROR_("Expected hexadecimal digits for character reference");
 
     // get a \0-terminated copy of the number
-    tcxml_string_t num = tcxml_data_push_(ctx->bufs, (tcxml_string_t){ ctx->ptr - head, head });
+    tcxml_string_t num = tcxml_data_push_(ctx->bufs, (tcxml_string_t){ ctx->ptr - head, head, false });
     uint32_t code_point = strtoul(num.ptr, NULL, is_hex ? 16 : 10);
     tcxml_data_popn_(ctx->bufs, 1);
 
@@ -1260,20 +1707,20 @@ static bool tcxml_p_EntityRef_(struct tcxml_parse_context_* restrict ctx)
 
     // TODO performance: Use switch statement, perfect hashing, or similar to quickly identify known strings.
     if(!tcxml_string_cmpz_(ctx->capture, "amp"))
-        replacement = (tcxml_string_t){ 1, "&" };
+        replacement = (tcxml_string_t){ 1, "&", false };
     else if(!tcxml_string_cmpz_(ctx->capture, "lt"))
-        replacement = (tcxml_string_t){ 1, "<" };
+        replacement = (tcxml_string_t){ 1, "<", false };
     else if(!tcxml_string_cmpz_(ctx->capture, "gt"))
-        replacement = (tcxml_string_t){ 1, ">" };
+        replacement = (tcxml_string_t){ 1, ">", false };
     else if(!tcxml_string_cmpz_(ctx->capture, "apos"))
-        replacement = (tcxml_string_t){ 1, "'" };
+        replacement = (tcxml_string_t){ 1, "'", false };
     else if(!tcxml_string_cmpz_(ctx->capture, "quot"))
-        replacement = (tcxml_string_t){ 1, "\"" };
+        replacement = (tcxml_string_t){ 1, "\"", false };
     else if(ctx->cbs->unknown_entity_reference)
     {
         // default replacement is simply the entire entity reference, e.g. &foo;
-        replacement = tcxml_data_push_(ctx->bufs, (tcxml_string_t){ tail - head, head });
-        tcxml_string_t ref = tcxml_data_push_(ctx->bufs, ctx->capture);
+        replacement = tcxml_data_pass_(ctx->bufs, ctx->cbs, (tcxml_string_t){ tail - head, head, false });
+        tcxml_string_t ref = tcxml_data_pass_(ctx->bufs, ctx->cbs, ctx->capture);
         bool ok = ctx->cbs->unknown_entity_reference(&replacement, ref, ctx->udata);
         tcxml_data_popn_(ctx->bufs, 2);
         if(!ok)
@@ -1290,14 +1737,11 @@ static bool tcxml_p_EntityRef_(struct tcxml_parse_context_* restrict ctx)
 }
 static bool tcxml_p_Reference_(struct tcxml_parse_context_* restrict ctx)
 {
-    char* ptr = ctx->ptr;
-
-    if(tcxml_p_EntityRef_(ctx))
-        return true;    // forward return
-    ctx->ptr = ptr;
-
-    if(tcxml_p_CharRef_(ctx))
-        return true;    // forward return
+    // (we can decide by the first 2 characters, so no need to backtrack; this also preserves the more specific error message)
+    if(tcxml_starts_with_(ctx->ptr, "&#"))
+        return tcxml_p_CharRef_(ctx);   // forward return
+    if(tcxml_starts_with_(ctx->ptr, "&"))
+        return tcxml_p_EntityRef_(ctx); // forward return
 
     return TCXML_ERROR_("Expected &...; reference");
 }
@@ -1349,47 +1793,1016 @@ static bool tcxml_p_EncodingDecl_(struct tcxml_parse_context_* restrict ctx)
     return true;    // return EncName in capture
 }
 
-tcxml_error_t tcxml_sax_process(tcxml_sax_buffers_t* bufs, const char* src, const tcxml_sax_callbacks_t* cbs, void* udata)
+/*
+document    ::= prolog element Misc*
+    -- NOTE: parsed one item (tag, text run, comment, ...) at a time, so that parsing can be suspended between items in push-mode --
+*/
+static bool tcxml_parse_item_(struct tcxml_parse_context_* restrict ctx)
 {
-    tcxml_sax_buffers_t bufs_tmp;
-    if(!bufs)
-        bufs = tcxml_sax_buffers_init(&bufs_tmp);
-    struct tcxml_parse_context_ ctx = {
-        .bufs = bufs,
+    char* ptr;
+    switch(ctx->state)
+    {
+    case TCXML_STATE_BEGIN_:
+        if(tcxml_match_("\xEF\xBB\xBF", ctx))
+            ctx->lc_head = ctx->ptr;    // skip UTF-8 BOM (which does not count towards the column)
+
+        ptr = ctx->ptr;
+        if(!tcxml_px_XMLDecl_(ctx))
+            ctx->ptr = ptr;
+        ctx->state = TCXML_STATE_PROLOG_;
+        return true;
+    case TCXML_STATE_PROLOG_:
+        if(tcxml_is_Misc_(ctx->ptr))
+            return tcxml_px_Misc_(ctx);
+
+        if(!tcxml_px_element_start_(ctx))
+            return false;   // forward error
+        ctx->state = ctx->bufs->stack.len ? TCXML_STATE_CONTENT_ : TCXML_STATE_EPILOG_;
+        return true;
+    case TCXML_STATE_CONTENT_:
+        if(!*ctx->ptr)
+            return TCXML_ERROR_("Expected </ for element end");
+        if(*ctx->ptr != '<')
+            return tcxml_px_text_(ctx);
+        if(tcxml_starts_with_(ctx->ptr, "</"))
+        {
+            if(!tcxml_px_element_end_(ctx))
+                return false;   // forward error
+            if(!ctx->bufs->stack.len)
+                ctx->state = TCXML_STATE_EPILOG_;
+            return true;
+        }
+        if(tcxml_starts_with_(ctx->ptr, "<![CDATA["))
+            return tcxml_px_CDSect_(ctx);
+        if(tcxml_starts_with_(ctx->ptr, "<?"))
+            return tcxml_px_PI_(ctx);
+        if(tcxml_starts_with_(ctx->ptr, "<!--"))
+            return tcxml_px_Comment_(ctx);
+        return tcxml_px_element_start_(ctx);
+    case TCXML_STATE_EPILOG_:
+        if(tcxml_is_Misc_(ctx->ptr))
+            return tcxml_px_Misc_(ctx);
+        return TCXML_ERROR_("Expected end-of-file"); // we have some trailing data that wasn't parsed
+    default:
+        assert(0 && "Invalid parser state");
+        return false;
+    }
+}
+
+// Search for `needle` (followed by at least `lookahead` more characters), starting `skip` bytes into the current item.
+// In push-mode, the same item may be checked many times (once per chunk), so we resume where the last (failed) search left off.
+static bool tcxml_scan_for_(struct tcxml_parse_context_* restrict ctx, size_t skip, const char* needle, size_t lookahead)
+{
+    size_t nlen = strlen(needle);
+    size_t avail = ctx->end - ctx->ptr;
+    if(ctx->scan < skip)
+        ctx->scan = skip;
+
+    const char* found = strstr(ctx->ptr + ctx->scan, needle);
+    if(found && (size_t)(ctx->end - found) >= nlen + lookahead)
+        return true;
+
+    // not found (yet); the tail end of the input may still be a partial match, so we can't skip over that
+    if(avail > nlen - 1 + lookahead && ctx->scan < avail - (nlen - 1 + lookahead))
+        ctx->scan = avail - (nlen - 1 + lookahead);
+    return false;
+}
+// Search for the `>` that ends a tag (ignoring any inside quoted attribute values).
+static bool tcxml_scan_tag_end_(struct tcxml_parse_context_* restrict ctx)
+{
+    const char* ptr = ctx->ptr + 1;
+    for(;;)
+    {
+        ptr = tcxml_find_(ptr, ctx->end, (const char[4]){ '>', '"', '\'', '\'' }, false);
+        if(ptr == ctx->end)
+            return false;
+        if(*ptr == '>')
+            return true;
+        // skip quoted string
+        ptr = tcxml_find_(ptr + 1, ctx->end, (const char[4]){ *ptr, *ptr, *ptr, *ptr }, false);
+        if(ptr == ctx->end)
+            return false;
+        ++ptr;
+    }
+}
+// Check whether the next item is complete within the available (push-mode) input.
+// The parser treats `\0` as end-of-file, so it must never be let loose on an item that straddles a chunk boundary.
+static bool tcxml_item_complete_(struct tcxml_parse_context_* restrict ctx)
+{
+    const char* ptr = ctx->ptr;
+    size_t avail = ctx->end - ptr;
+    if(!avail)
+        return false;
+
+    if(ctx->state == TCXML_STATE_BEGIN_)
+    {
+        if(tcxml_is_partial_(ptr, avail, "\xEF\xBB\xBF"))
+            return false;
+        if(tcxml_starts_with_(ptr, "\xEF\xBB\xBF"))
+        {
+            ptr += 3;
+            avail -= 3;
+        }
+        if(tcxml_is_partial_(ptr, avail, "<?xml"))
+            return false;
+        if(tcxml_starts_with_(ptr, "<?xml"))
+            return tcxml_scan_for_(ctx, ptr + 5 - ctx->ptr, "?>", 0);
+        return true;
+    }
+
+    if(*ptr == '<')
+    {
+        if(avail < 2 || tcxml_is_partial_(ptr, avail, "<!--") || tcxml_is_partial_(ptr, avail, "<![CDATA["))
+            return false;
+        if(tcxml_starts_with_(ptr, "<!--"))
+            return tcxml_scan_for_(ctx, 4, "--", 1);  // (need 1 more character to tell `-->` from an invalid `--`)
+        if(tcxml_starts_with_(ptr, "<![CDATA["))
+            return tcxml_scan_for_(ctx, 9, "]]>", 0);
+        if(tcxml_starts_with_(ptr, "<?"))
+            return tcxml_scan_for_(ctx, 2, "?>", 0);
+        return tcxml_scan_tag_end_(ctx);
+    }
+
+    // a text run ends at the next markup
+    if(ctx->state == TCXML_STATE_CONTENT_)
+        return tcxml_scan_for_(ctx, 0, "<", 0);
+
+    // whitespace (in prolog or epilog) ends at the first non-whitespace character
+    if(strchr(TCXML_WSPACE_CHARS_, *ptr))
+    {
+        ctx->scan = tcxml_find_(ptr + ctx->scan, ctx->end, TCXML_SET_WSPACE_, true) - ptr;
+        return ctx->scan < avail;
+    }
+
+    return true;    // this is an error; but we don't need any more data to report it
+}
+
+static bool tcxml_parse_items_(struct tcxml_parse_context_* restrict ctx, bool final)
+{
+    for(;;)
+    {
+        if(final)
+        {
+            if(!*ctx->ptr && (ctx->state == TCXML_STATE_EPILOG_ || (ctx->fragment && ctx->bufs->stack.len == 1)))
+                return true;    // document (or fragment) parsed OK
+        }
+        else if(!tcxml_item_complete_(ctx))
+            return true;        // wait for more data
+
+        char* head = ctx->ptr;
+        if(!tcxml_parse_item_(ctx))
+            return false;   // forward error
+        ctx->scan = 0;
+
+        if(ctx->cbs->flags & TCXML_VALIDATE_UTF8)
+        {
+            size_t len = ctx->ptr - head;
+            size_t valid = tcxml_utf8_validate(head, len);
+            if(valid != len)
+            {
+                ctx->ptr = head + valid;
+                return TCXML_ERROR_("Invalid UTF-8");
+            }
+        }
+    }
+}
+
+static void tcxml_parse_init_(struct tcxml_parse_context_* restrict ctx, tcxml_sax_buffers_t* bufs, const tcxml_sax_callbacks_t* cbs, void* udata, char* src)
+{
+    *ctx = (struct tcxml_parse_context_){
         .cbs = cbs,
         .udata = udata,
 
-        .str = (char*)src,
-        .ptr = (char*)src,
+        .str = src,
+        .ptr = src,
+        .lc_head = src,
+        .state = TCXML_STATE_BEGIN_,
     };
+    ctx->bufs = bufs ? bufs : tcxml_sax_buffers_init(&ctx->bufs_own);
+
+    // in case `bufs` are being reused after an error
+    ctx->bufs->stack.len = 0;
+    ctx->bufs->stack.chars.len = 0;
+}
+static void tcxml_locate_error_(struct tcxml_parse_context_* restrict ctx)
+{
+    // make error offset absolute & compute line/column
+    ctx->error.line = ctx->lc.line;
+    ctx->error.column = ctx->lc.column;
+    tcxml_advance_line_col_(ctx->lc_head, ctx->str + ctx->error.offset, &ctx->error);
+    ctx->error.offset += ctx->base;
+}
+static void tcxml_parse_run_(struct tcxml_parse_context_* restrict ctx, bool final)
+{
+    if(tcxml_parse_items_(ctx, final))
+        ctx->error = (tcxml_error_t){ 0 };  // clear any error left over from backtracking
+    else
+        tcxml_locate_error_(ctx);
+}
+static void tcxml_parse_deinit_(struct tcxml_parse_context_* restrict ctx)
+{
+    if(ctx->bufs == &ctx->bufs_own)
+        tcxml_sax_buffers_deinit(&ctx->bufs_own);
+}
+
+tcxml_error_t tcxml_sax_process(tcxml_sax_buffers_t* bufs, const char* src, const tcxml_sax_callbacks_t* cbs, void* udata)
+{
+    struct tcxml_parse_context_ ctx;
+    tcxml_parse_init_(&ctx, bufs, cbs, udata, (char*)src);
+    ctx.end = ctx.str + strlen(src);
 
     if(cbs->start)
         cbs->start(udata);
 
-    bool has_bom = tcxml_starts_with_(ctx.ptr, "\xEF\xBB\xBF");
-    if(has_bom)
-        ctx.ptr += 3;   // skip UTF-8 BOM
+    tcxml_parse_run_(&ctx, true);
+    if(!ctx.error.message && cbs->end)
+        cbs->end(udata);
+
+    tcxml_parse_deinit_(&ctx);
+    return ctx.error;
+}
+
+tcxml_sax_context_t* tcxml_sax_begin(tcxml_sax_buffers_t* bufs, const tcxml_sax_callbacks_t* cbs, void* udata)
+{
+    tcxml_sax_context_t* ctx = malloc(sizeof(*ctx));
+    if(!ctx) return NULL;
+    tcxml_parse_init_(ctx, bufs, cbs, udata, NULL);
+
+    // start out with empty (but `\0`-terminated) input
+    ctx->bufs->input.len = 0;
+    *TCXML_ARR_APPENDN_(&ctx->bufs->input, 1) = 0;
+    ctx->bufs->input.len = 0;
+    ctx->str = ctx->ptr = ctx->end = ctx->lc_head = ctx->bufs->input.ptr;
+
+    if(cbs->start)
+        cbs->start(udata);
+    return ctx;
+}
+tcxml_error_t tcxml_sax_feed(tcxml_sax_context_t* ctx, const char* chunk, size_t len)
+{
+    if(ctx->error.message)
+        return ctx->error;  // errors are sticky
+
+    tcxml_sax_buffers_t* bufs = ctx->bufs;
+
+    // discard input that was already parsed (items never end in the middle of a CRLF, so line counting is unaffected)
+    size_t consumed = ctx->ptr - ctx->str;
+    if(consumed)
+    {
+        tcxml_advance_line_col_(ctx->lc_head, ctx->ptr, &ctx->lc);
+        memmove(bufs->input.ptr, ctx->ptr, bufs->input.len - consumed);
+        bufs->input.len -= consumed;
+        ctx->base += consumed;
+    }
+
+    // append the new chunk, keeping the input `\0`-terminated (which the parser relies on)
+    char* dst = TCXML_ARR_APPENDN_(&bufs->input, len + 1);
+    memcpy(dst, chunk, len);
+    dst[len] = 0;
+    --bufs->input.len;
+
+    // the buffer may have been reallocated
+    ctx->str = ctx->ptr = ctx->lc_head = bufs->input.ptr;
+    ctx->end = ctx->str + bufs->input.len;
 
-    if(tcxml_px_document_(&ctx))
+    const char* nul = memchr(dst, 0, len);
+    if(nul)
     {
-        if(*ctx.ptr == 0)
-            ctx.error.message = NULL;                                                 // document parsed OK, clear error message
+        // we could parse up to this point first, but the document is broken either way
+        ctx->ptr = (char*)nul;
+        ctx->error = tcxml_make_error_(ctx, "Unexpected NUL character");
+        tcxml_locate_error_(ctx);
+        return ctx->error;
+    }
+
+    tcxml_parse_run_(ctx, false);
+    return ctx->error;
+}
+tcxml_error_t tcxml_sax_end(tcxml_sax_context_t* ctx)
+{
+    if(!ctx->error.message)
+    {
+        tcxml_parse_run_(ctx, true);
+        if(!ctx->error.message && ctx->cbs->end)
+            ctx->cbs->end(ctx->udata);
+    }
+
+    tcxml_error_t error = ctx->error;
+    tcxml_parse_deinit_(ctx);
+    free(ctx);
+    return error;
+}
+
+
+#ifdef TC_THREAD_H_
+/* ranges of records are at least this large (the overhead per range is small, but we want to give idle workers something to steal) */
+#ifndef TCXML_PARALLEL_RANGE_BYTES
+#define TCXML_PARALLEL_RANGE_BYTES  65536
+#endif
+
+// forwards events to the user's callbacks, keeping track of which record they belong to
+struct tcxml_parallel_pass_
+{
+    tcxml_sax_record_t record;
+    const tcxml_sax_callbacks_t* cbs;
+    size_t depth;       // element depth (so the root element's children are at depth 1)
+    size_t next_seq;    // sequence number of the next record
+};
+static void tcxml_parallel_cb_xml_decl_(tcxml_string_t version, tcxml_string_t encoding, bool* standalone, void* udata)
+{
+    struct tcxml_parallel_pass_* pass = udata;
+    pass->cbs->xml_decl(version, encoding, standalone, &pass->record);
+}
+static void tcxml_parallel_cb_cdata_(tcxml_string_t data, void* udata)
+{
+    struct tcxml_parallel_pass_* pass = udata;
+    pass->cbs->cdata(data, &pass->record);
+}
+static void tcxml_parallel_cb_text_(tcxml_string_t text, size_t body_head, size_t body_tail, void* udata)
+{
+    struct tcxml_parallel_pass_* pass = udata;
+    pass->cbs->text(text, body_head, body_tail, &pass->record);
+}
+static void tcxml_parallel_cb_element_start_(tcxml_string_t tag, tcxml_string_t* attrs, size_t nattrs, void* udata)
+{
+    struct tcxml_parallel_pass_* pass = udata;
+    if(pass->depth++ == 1)
+        pass->record.seq = pass->next_seq++;
+    if(pass->cbs->element_start)
+        pass->cbs->element_start(tag, attrs, nattrs, &pass->record);
+}
+static void tcxml_parallel_cb_element_end_(tcxml_string_t tag, void* udata)
+{
+    struct tcxml_parallel_pass_* pass = udata;
+    if(--pass->depth == 0)
+        pass->record.seq = TCXML_SEQ_NONE;
+    if(pass->cbs->element_end)
+        pass->cbs->element_end(tag, &pass->record);
+}
+static void tcxml_parallel_cb_processing_instruction_(tcxml_string_t target, tcxml_string_t body, void* udata)
+{
+    struct tcxml_parallel_pass_* pass = udata;
+    pass->cbs->processing_instruction(target, body, &pass->record);
+}
+static void tcxml_parallel_cb_comment_(tcxml_string_t text, void* udata)
+{
+    struct tcxml_parallel_pass_* pass = udata;
+    pass->cbs->comment(text, &pass->record);
+}
+static bool tcxml_parallel_cb_unknown_entity_reference_(tcxml_string_t* replacement, tcxml_string_t ref, void* udata)
+{
+    struct tcxml_parallel_pass_* pass = udata;
+    return pass->cbs->unknown_entity_reference(replacement, ref, &pass->record);
+}
+
+struct tcxml_offsets_
+{
+    size_t mem, len;
+    size_t* ptr;
+};
+struct tcxml_prescan_chunk_;
+struct tcxml_parallel_
+{
+    const char* src;
+    const char* end;
+    struct tcxml_prescan_chunk_* chunks;
+    const size_t* records;          // offset of each record's start tag, plus that of the root's end tag
+    tcxml_string_t root;            // root element name
+    const tcxml_sax_callbacks_t* cbs;
+    tcxml_sax_callbacks_t pass_cbs;
+    void* udata;
+
+    tcthread_pool_t pool;
+    uint32_t nthreads;
+    tcxml_sax_buffers_t* bufs;      // one per worker, plus one for other threads
+
+    tcthread_mutex_t lock;
+    tcxml_error_t error;            // the first error (by offset)
+    volatile tcthread_atomicsz_t error_offset;  // `error.offset` (or SIZE_MAX), readable without the lock
+};
+
+/*
+ * The pre-scan only looks at as much of the structure as is needed to track element depth; the actual parse checks everything else.
+ *
+ * To keep it from becoming the bottleneck, it is itself done in parallel, by splitting the document into chunks. All but the first
+ * chunk start in an unknown state (we might be in the middle of a comment, CDATA, or a tag), so each chunk is scanned as if it started
+ * in content, with depth relative to its start. Then, the chunks are stitched together in order: the (correctly-scanned) previous chunk
+ * tells us the state at the first token after it; if the speculative scan also saw that token among its first few, it was in sync from
+ * there on, and only needs its depth adjusted. Otherwise, the chunk is simply scanned again.
+ */
+#ifndef TCXML_PRESCAN_CHUNK_BYTES
+#define TCXML_PRESCAN_CHUNK_BYTES   (1024 * 1024)
+#endif
+#define TCXML_PRESCAN_WINDOW_       64  // # of tokens in which a speculative scan must get in sync
+struct tcxml_prescan_tag_
+{
+    size_t offset;
+    ptrdiff_t depth;    // relative depth before a start tag, or after an end tag
+    bool end;
+};
+struct tcxml_prescan_chunk_
+{
+    size_t head, tail;  // scan tokens that start within `[head,tail)`
+    bool ok;
+    // the first tokens, and the depth before each
+    size_t ntokens;
+    size_t tokens[TCXML_PRESCAN_WINDOW_];
+    ptrdiff_t token_depths[TCXML_PRESCAN_WINDOW_];
+    // the first token at or after `tail` (or the end of input), and the depth before it
+    size_t stop;
+    ptrdiff_t stop_depth;
+    // tags that may be record starts or the root end (we don't know the absolute depth yet, so this includes some extras)
+    struct
+    {
+        size_t mem, len;
+        struct tcxml_prescan_tag_* ptr;
+    } tags;
+};
+static void tcxml_prescan_chunk_(const char* src, const char* end, struct tcxml_prescan_chunk_* chunk)
+{
+    const char* ptr = src + chunk->head;
+    ptrdiff_t depth = 0, min = PTRDIFF_MAX;
+    chunk->ok = false;
+    chunk->ntokens = 0;
+    chunk->tags.len = 0;
+    for(;;)
+    {
+        ptr = tcxml_find_(ptr, end, (const char[4]){ '<', '<', '<', '<' }, false);
+        size_t offset = ptr - src;
+        if(ptr == end || offset >= chunk->tail)
+        {
+            chunk->stop = offset;
+            chunk->stop_depth = depth;
+            chunk->ok = true;
+            return;
+        }
+
+        // within the window, the scan may not be in sync yet, so we keep all tags (and don't let them affect `min`)
+        bool window = chunk->ntokens < TCXML_PRESCAN_WINDOW_;
+        if(window)
+        {
+            chunk->tokens[chunk->ntokens] = offset;
+            chunk->token_depths[chunk->ntokens] = depth;
+            ++chunk->ntokens;
+        }
+        else if(min == PTRDIFF_MAX)
+            min = depth;
+
+        if(ptr[1] == '/')
+        {
+            if(!(ptr = memchr(ptr, '>', end - ptr)))
+                return;
+            if(--depth < min && !window)
+                min = depth;
+            if(window || depth == min)
+                *TCXML_ARR_APPENDN_(&chunk->tags, 1) = (struct tcxml_prescan_tag_){ offset, depth, true };
+        }
+        else if(tcxml_starts_with_(ptr, "<!--"))
+            ptr = strstr(ptr + 4, "-->");
+        else if(tcxml_starts_with_(ptr, "<![CDATA["))
+            ptr = strstr(ptr + 9, "]]>");
+        else if(ptr[1] == '?')
+            ptr = strstr(ptr + 2, "?>");
+        else if(ptr[1] == '!')
+            return;     // DOCTYPE or garbage
         else
-            ctx.error = tcxml_make_error_(&ctx, "Expected end-of-file"); // we have some trailing data that wasn't parsed
+        {
+            // skip over the attributes (which may contain `>` within quotes)
+            for(;;)
+            {
+                ptr = tcxml_find_(ptr + 1, end, (const char[4]){ '>', '"', '\'', '\'' }, false);
+                if(ptr == end)
+                    return;
+                if(*ptr == '>')
+                    break;
+                if(!(ptr = memchr(ptr + 1, *ptr, end - ptr - 1)))
+                    return;
+            }
+            // records are one level below the shallowest point, i.e. the content of the root element
+            if(window || depth <= min + 1)
+                *TCXML_ARR_APPENDN_(&chunk->tags, 1) = (struct tcxml_prescan_tag_){ offset, depth, false };
+            if(ptr[-1] != '/')
+                ++depth;
+        }
+        if(!ptr)
+            return;
+        ++ptr;
+    }
+}
+static void tcxml_prescan_chunks_(size_t begin, size_t end, void* udata)
+{
+    struct tcxml_parallel_* job = udata;
+    for(size_t i = begin; i < end; i++)
+        tcxml_prescan_chunk_(job->src, job->end, &job->chunks[i]);
+}
+// Find the start tag of each child element of the root, and the root's end tag (which is appended last).
+// Returns false if the document does not have a structure we understand, in which case it is simply parsed serially.
+static bool tcxml_prescan_records_(struct tcxml_parallel_* job, struct tcxml_offsets_* records)
+{
+    size_t len = job->end - job->src;
+    size_t nchunks = len / TCXML_PRESCAN_CHUNK_BYTES;
+    if(nchunks > job->nthreads * 4)
+        nchunks = job->nthreads * 4;
+    if(!nchunks)
+        nchunks = 1;
+
+    job->chunks = malloc(nchunks * sizeof(*job->chunks));
+    for(size_t i = 0; i < nchunks; i++)
+    {
+        job->chunks[i].head = len * i / nchunks;
+        job->chunks[i].tail = len * (i + 1) / nchunks;
+        job->chunks[i].tags.mem = job->chunks[i].tags.len = 0;
+        job->chunks[i].tags.ptr = NULL;
+    }
+    tcthread_pool_parallel_for(job->pool, nchunks, 1, tcxml_prescan_chunks_, job);
+
+    // stitch the chunks together; the state is known to be "outside of markup, at depth `depth`" at `pos`
+    size_t pos = 0;
+    ptrdiff_t depth = 0;
+    bool found = false;
+    for(size_t i = 0; i < nchunks && !found; i++)
+    {
+        struct tcxml_prescan_chunk_* chunk = &job->chunks[i];
+        if(pos >= chunk->tail)
+            continue;   // the previous chunk's last token extended past this entire chunk
+
+        ptrdiff_t base = depth;
+        if(chunk->head != pos)
+        {
+            size_t t = 0;
+            if(chunk->ok)
+                while(t < chunk->ntokens && chunk->tokens[t] < pos)
+                    ++t;
+            if(chunk->ok && t < chunk->ntokens && chunk->tokens[t] == pos)
+                base = depth - chunk->token_depths[t];
+            else
+            {
+                // not in sync; scan this chunk again, from a known state
+                chunk->head = pos;
+                tcxml_prescan_chunk_(job->src, job->end, chunk);
+            }
+        }
+        if(!chunk->ok)
+            break;
+
+        for(size_t t = 0; t < chunk->tags.len; t++)
+        {
+            const struct tcxml_prescan_tag_* tag = &chunk->tags.ptr[t];
+            if(tag->offset < pos)
+                continue;
+            if(!tag->end && tag->depth + base == 1)
+                *TCXML_ARR_APPENDN_(records, 1) = tag->offset;
+            else if(tag->end && tag->depth + base == 0)
+            {
+                *TCXML_ARR_APPENDN_(records, 1) = tag->offset;
+                found = true;
+                break;
+            }
+        }
+        pos = chunk->stop;
+        depth = chunk->stop_depth + base;
     }
 
-    // compute error offset if we had an error
+    for(size_t i = 0; i < nchunks; i++)
+        free(job->chunks[i].tags.ptr);
+    free(job->chunks);
+    return found;
+}
+
+// parse records `[begin,end)` (plus any content that follows them) as an independent fragment
+static void tcxml_parallel_range_(size_t begin, size_t end, void* udata)
+{
+    struct tcxml_parallel_* job = udata;
+    size_t head = job->records[begin], tail = job->records[end];
+
+    // no point in parsing past an error that was already found (the ones before it still need checking, as we report the first one)
+    if(head > tcthread_atomicsz_load_explicit(&job->error_offset, TCTHREAD_MEMORDER_RELAXED))
+        return;
+
+    int32_t worker = tcthread_pool_get_worker_index(job->pool);
+    if(worker < 0)
+        worker = job->nthreads;
+    tcxml_sax_buffers_t* bufs = &job->bufs[worker];
+
+    // the parser relies on input being `\0`-terminated, so we need a copy
+    bufs->input.len = 0;
+    char* src = TCXML_ARR_APPENDN_(&bufs->input, tail - head + 1);
+    memcpy(src, job->src + head, tail - head);
+    src[tail - head] = 0;
+
+    struct tcxml_parallel_pass_ pass = {
+        .record = { TCXML_SEQ_NONE, worker, job->udata },
+        .cbs = job->cbs,
+        .depth = 1,
+        .next_seq = begin,
+    };
+    struct tcxml_parse_context_ ctx;
+    tcxml_parse_init_(&ctx, bufs, &job->pass_cbs, &pass, src);
+    ctx.end = src + (tail - head);
+    ctx.state = TCXML_STATE_CONTENT_;
+    ctx.fragment = true;
+    tcxml_stack_push_(bufs, job->root);
+
+    tcxml_parse_run_(&ctx, true);
     if(ctx.error.message)
     {
-        ctx.error.line = ctx.error.column = 0;
-        tcxml_advance_line_col_(ctx.str + (has_bom ? 3 : 0), ctx.str + ctx.error.offset, &ctx.error);
+        tcthread_mutex_lock(job->lock);
+        ctx.error.offset += head;   // (line & column are fixed up at the end; only the first error needs them)
+        if(!job->error.message || ctx.error.offset < job->error.offset)
+        {
+            job->error = ctx.error;
+            tcthread_atomicsz_store_explicit(&job->error_offset, ctx.error.offset, TCTHREAD_MEMORDER_RELAXED);
+        }
+        tcthread_mutex_unlock(job->lock);
     }
-    else if(cbs->end)
-        cbs->end(udata);
+}
+
+tcxml_error_t tcxml_sax_process_parallel(tcxml_sax_buffers_t* bufs, const char* src, const tcxml_sax_callbacks_t* cbs, void* udata, tcthread_pool_t pool)
+{
+    struct tcxml_parallel_ job = {
+        .src = src,
+        .cbs = cbs,
+        .pass_cbs = {
+            .flags = cbs->flags,
+            .xml_decl = cbs->xml_decl ? tcxml_parallel_cb_xml_decl_ : NULL,
+            .cdata = cbs->cdata ? tcxml_parallel_cb_cdata_ : NULL,
+            .text = cbs->text ? tcxml_parallel_cb_text_ : NULL,
+            .element_start = tcxml_parallel_cb_element_start_,
+            .element_end = tcxml_parallel_cb_element_end_,
+            .processing_instruction = cbs->processing_instruction ? tcxml_parallel_cb_processing_instruction_ : NULL,
+            .comment = cbs->comment ? tcxml_parallel_cb_comment_ : NULL,
+            .unknown_entity_reference = cbs->unknown_entity_reference ? tcxml_parallel_cb_unknown_entity_reference_ : NULL,
+        },
+        .udata = udata,
+        .pool = pool,
+        .error_offset = SIZE_MAX,
+    };
+    struct tcxml_parallel_pass_ pass = {
+        .record = { TCXML_SEQ_NONE, tcthread_pool_is_valid(pool) ? tcthread_pool_get_thread_count(pool) : 0, udata },
+        .cbs = cbs,
+    };
 
-    if(bufs == &bufs_tmp)
-        tcxml_sax_buffers_deinit(&bufs_tmp);
+    struct tcxml_parse_context_ ctx;
+    tcxml_parse_init_(&ctx, bufs, &job.pass_cbs, &pass, (char*)src);
+    ctx.end = ctx.str + strlen(src);
+
+    struct tcxml_offsets_ records = {0};
+    bool parallel = false;
+    if(tcthread_pool_is_valid(pool))
+    {
+        job.end = ctx.end;
+        job.nthreads = tcthread_pool_get_thread_count(pool);
+        parallel = tcxml_prescan_records_(&job, &records) && records.len > 2;
+    }
+
+    if(cbs->start)
+        cbs->start(&pass.record);
+
+    if(parallel)
+    {
+        // parse everything up to the first record; we let the parser see the `<` of that record, so that it knows any text before it is complete
+        char* end = ctx.end;
+        ctx.end = ctx.str + records.ptr[0] + 1;
+        tcxml_parse_run_(&ctx, false);
+        ctx.end = end;
+        ctx.scan = 0;
+        // if the parser disagrees with the pre-scan, we'll simply continue serially from here
+        parallel = !ctx.error.message && ctx.ptr == ctx.str + records.ptr[0] && ctx.state == TCXML_STATE_CONTENT_ && pass.depth == 1;
+    }
+    if(parallel)
+    {
+        size_t nrecords = records.len - 1;
+        job.records = records.ptr;
+        job.root = tcxml_stack_top_(ctx.bufs);
+        job.bufs = malloc((job.nthreads + 1) * sizeof(*job.bufs));
+        for(uint32_t i = 0; i <= job.nthreads; i++)
+            tcxml_sax_buffers_init(&job.bufs[i]);
+        job.lock = tcthread_mutex_create(false);
+
+        size_t avg = (records.ptr[nrecords] - records.ptr[0]) / nrecords;
+        tcthread_pool_parallel_for(pool, nrecords, TCXML_PARALLEL_RANGE_BYTES / (avg ? avg : 1) + 1, tcxml_parallel_range_, &job);
+
+        tcthread_mutex_destroy(job.lock);
+        for(uint32_t i = 0; i <= job.nthreads; i++)
+            tcxml_sax_buffers_deinit(&job.bufs[i]);
+        free(job.bufs);
+
+        if(job.error.message)
+        {
+            ctx.error = job.error;
+            ctx.error.line = ctx.error.column = 0;
+            tcxml_advance_line_col_(ctx.lc_head, ctx.str + ctx.error.offset, &ctx.error);
+        }
+        else
+        {
+            // continue with the root's end tag
+            ctx.ptr = ctx.str + records.ptr[nrecords];
+            pass.next_seq = nrecords;
+        }
+    }
+    if(!ctx.error.message)
+        tcxml_parse_run_(&ctx, true);
+    free(records.ptr);
+
+    if(!ctx.error.message && cbs->end)
+        cbs->end(&pass.record);
+
+    tcxml_parse_deinit_(&ctx);
     return ctx.error;
 }
+#endif /* TC_THREAD_H_ */
+
+
+// string storage for the DOM
+struct tcxml_dom_block_
+{
+    struct tcxml_dom_block_* next;
+    size_t size, used;
+    char data[];
+};
+#define TCXML_DOM_BLOCK_MIN_    65536
+
+static char* tcxml_dom_alloc_(tcxml_dom_t* restrict dom, size_t len)
+{
+    struct tcxml_dom_block_* block = dom->blocks;
+    if(!block || block->size - block->used < len)
+    {
+        // (the old block's leftover space is wasted; but since blocks grow geometrically, that is only a small fraction)
+        size_t size = block ? block->size * 2 : TCXML_DOM_BLOCK_MIN_;
+        if(size < len)
+            size = len;
+        block = malloc(sizeof(*block) + size);
+        block->next = dom->blocks;
+        block->size = size;
+        block->used = 0;
+        dom->blocks = block;
+    }
+    char* ptr = &block->data[block->used];
+    block->used += len;
+    return ptr;
+}
+// make sure that the next `len` bytes of strings fit into a single block
+static void tcxml_dom_reserve_(tcxml_dom_t* restrict dom, size_t len)
+{
+    struct tcxml_dom_block_* block = dom->blocks;
+    if(block && block->size - block->used >= len)
+        return;
+    if(block && !block->used)
+    {
+        dom->blocks = block->next;
+        free(block);
+    }
+    tcxml_dom_alloc_(dom, len);
+    dom->blocks->used = 0;
+}
+static tcxml_string_t tcxml_dom_strdup_(tcxml_dom_t* restrict dom, tcxml_string_t str)
+{
+    char* ptr = tcxml_dom_alloc_(dom, str.len + 1);
+    memcpy(ptr, str.ptr, str.len);
+    ptr[str.len] = 0;
+    return (tcxml_string_t){ str.len, ptr, false };
+}
+
+// FNV-1a
+static uint32_t tcxml_dom_hash_(const char* str, size_t len)
+{
+    uint32_t hash = 2166136261u;
+    for(size_t i = 0; i < len; i++)
+        hash = (hash ^ (uint8_t)str[i]) * 16777619u;
+    return hash;
+}
+static uint32_t* tcxml_dom_name_slot_(uint32_t* table, size_t mem, const tcxml_string_t* names, const char* str, size_t len)
+{
+    size_t mask = mem - 1;
+    for(size_t i = tcxml_dom_hash_(str, len) & mask;; i = (i + 1) & mask)
+        if(table[i] == TCXML_DOM_NONE || (names[table[i]].len == len && !memcmp(names[table[i]].ptr, str, len)))
+            return &table[i];
+}
+static uint32_t tcxml_dom_intern_(tcxml_dom_t* restrict dom, tcxml_string_t name)
+{
+    // keep the load factor at most 1/2
+    if((dom->names.len + 1) * 2 > dom->name_table.mem)
+    {
+        size_t mem = dom->name_table.mem ? dom->name_table.mem * 2 : 64;
+        uint32_t* table = malloc(mem * sizeof(*table));
+        memset(table, 0xFF, mem * sizeof(*table));
+        for(uint32_t i = 0; i < dom->names.len; i++)
+            *tcxml_dom_name_slot_(table, mem, dom->names.ptr, dom->names.ptr[i].ptr, dom->names.ptr[i].len) = i;
+        free(dom->name_table.ptr);
+        dom->name_table.mem = mem;
+        dom->name_table.ptr = table;
+    }
+
+    uint32_t* slot = tcxml_dom_name_slot_(dom->name_table.ptr, dom->name_table.mem, dom->names.ptr, name.ptr, name.len);
+    if(*slot == TCXML_DOM_NONE)
+    {
+        *slot = dom->names.len;
+        *TCXML_ARR_APPENDN_(&dom->names, 1) = tcxml_dom_strdup_(dom, name);
+    }
+    return *slot;
+}
+
+// add a node as the last child of the current element
+static uint32_t tcxml_dom_add_node_(tcxml_dom_t* restrict dom, uint8_t type)
+{
+    uint32_t index = dom->nodes.len;
+    *TCXML_ARR_APPENDN_(&dom->nodes, 1) = (tcxml_dom_node_t){
+        .type = type,
+        .parent = dom->current,
+        .next_sibling = TCXML_DOM_NONE,
+        .first_child = TCXML_DOM_NONE,
+        .last_child = TCXML_DOM_NONE,
+        .name = TCXML_DOM_NONE,
+        .attr_head = dom->attrs.len,
+    };
+    if(dom->current != TCXML_DOM_NONE)
+    {
+        tcxml_dom_node_t* parent = &dom->nodes.ptr[dom->current];
+        if(parent->last_child != TCXML_DOM_NONE)
+            dom->nodes.ptr[parent->last_child].next_sibling = index;
+        else
+            parent->first_child = index;
+        parent->last_child = index;
+    }
+    return index;
+}
+static void tcxml_dom_add_attr_(tcxml_dom_t* restrict dom, uint32_t node, tcxml_string_t name, tcxml_string_t value)
+{
+    tcxml_dom_attr_t* attr = TCXML_ARR_APPENDN_(&dom->attrs, 1);
+    attr->name = tcxml_dom_intern_(dom, name);
+    attr->value = tcxml_dom_strdup_(dom, value);
+    dom->nodes.ptr[node].nattrs++;
+}
+
+static void tcxml_dom_cb_xml_decl_(tcxml_string_t version, tcxml_string_t encoding, bool* standalone, void* udata)
+{
+    tcxml_dom_t* dom = udata;
+    uint32_t node = tcxml_dom_add_node_(dom, TCXML_NODE_XML_DECL);
+    dom->nodes.ptr[node].name = tcxml_dom_intern_(dom, (tcxml_string_t){ 3, "xml", false });
+    tcxml_dom_add_attr_(dom, node, (tcxml_string_t){ 7, "version", false }, version);
+    if(encoding.ptr)
+        tcxml_dom_add_attr_(dom, node, (tcxml_string_t){ 8, "encoding", false }, encoding);
+    if(standalone)
+        tcxml_dom_add_attr_(dom, node, (tcxml_string_t){ 10, "standalone", false }, *standalone ? (tcxml_string_t){ 3, "yes", false } : (tcxml_string_t){ 2, "no", false });
+}
+static void tcxml_dom_cb_cdata_(tcxml_string_t data, void* udata)
+{
+    tcxml_dom_t* dom = udata;
+    uint32_t node = tcxml_dom_add_node_(dom, TCXML_NODE_CDATA);
+    dom->nodes.ptr[node].text = tcxml_dom_strdup_(dom, data);
+}
+static void tcxml_dom_cb_text_(tcxml_string_t text, size_t body_head, size_t body_tail, void* udata)
+{
+    (void)body_head; (void)body_tail;
+    tcxml_dom_t* dom = udata;
+    uint32_t node = tcxml_dom_add_node_(dom, TCXML_NODE_TEXT);
+    dom->nodes.ptr[node].text = tcxml_dom_strdup_(dom, text);
+}
+static void tcxml_dom_cb_element_start_(tcxml_string_t tag, tcxml_string_t* attrs, size_t nattrs, void* udata)
+{
+    tcxml_dom_t* dom = udata;
+    uint32_t node = tcxml_dom_add_node_(dom, TCXML_NODE_ELEMENT);
+    dom->nodes.ptr[node].name = tcxml_dom_intern_(dom, tag);
+    for(size_t i = 0; i < nattrs; i++)
+        tcxml_dom_add_attr_(dom, node, attrs[2*i+0], attrs[2*i+1]);
+    dom->current = node;
+}
+static void tcxml_dom_cb_element_end_(tcxml_string_t tag, void* udata)
+{
+    (void)tag; // (the parser has already matched it against the start tag)
+    tcxml_dom_t* dom = udata;
+    dom->current = dom->nodes.ptr[dom->current].parent;
+}
+static void tcxml_dom_cb_processing_instruction_(tcxml_string_t target, tcxml_string_t body, void* udata)
+{
+    tcxml_dom_t* dom = udata;
+    uint32_t node = tcxml_dom_add_node_(dom, TCXML_NODE_PROCESSING_INSTRUCTION);
+    dom->nodes.ptr[node].name = tcxml_dom_intern_(dom, target);
+    dom->nodes.ptr[node].text = tcxml_dom_strdup_(dom, body);
+}
+static void tcxml_dom_cb_comment_(tcxml_string_t text, void* udata)
+{
+    tcxml_dom_t* dom = udata;
+    uint32_t node = tcxml_dom_add_node_(dom, TCXML_NODE_COMMENT);
+    dom->nodes.ptr[node].text = tcxml_dom_strdup_(dom, text);
+}
+
+tcxml_dom_t* tcxml_dom_init(tcxml_dom_t* dom)
+{
+    if(!dom) return NULL;
+    *dom = (tcxml_dom_t){
+        .current = TCXML_DOM_NONE,
+        .cbs = {
+            // we copy everything into our own storage anyways, so there's no point in having the parser copy it first
+            .flags = TCXML_BORROW_STRINGS,
+            .xml_decl = tcxml_dom_cb_xml_decl_,
+            .cdata = tcxml_dom_cb_cdata_,
+            .text = tcxml_dom_cb_text_,
+            .element_start = tcxml_dom_cb_element_start_,
+            .element_end = tcxml_dom_cb_element_end_,
+            .processing_instruction = tcxml_dom_cb_processing_instruction_,
+            .comment = tcxml_dom_cb_comment_,
+        },
+    };
+    tcxml_dom_reset(dom);
+    return dom;
+}
+void tcxml_dom_deinit(tcxml_dom_t* dom)
+{
+    if(!dom) return;
+    free(dom->nodes.ptr);
+    free(dom->attrs.ptr);
+    free(dom->names.ptr);
+    free(dom->name_table.ptr);
+    while(dom->blocks)
+    {
+        struct tcxml_dom_block_* next = dom->blocks->next;
+        free(dom->blocks);
+        dom->blocks = next;
+    }
+}
+void tcxml_dom_reset(tcxml_dom_t* dom)
+{
+    // if the last document needed several blocks, replace them with one that fits it all (so that similar documents will only need one)
+    struct tcxml_dom_block_* block = dom->blocks;
+    if(block && block->next)
+    {
+        size_t size = 0;
+        while(dom->blocks)
+        {
+            struct tcxml_dom_block_* next = dom->blocks->next;
+            size += dom->blocks->size;
+            free(dom->blocks);
+            dom->blocks = next;
+        }
+        tcxml_dom_reserve_(dom, size);
+    }
+    else if(block)
+        block->used = 0;
+
+    dom->nodes.len = 0;
+    dom->attrs.len = 0;
+    dom->names.len = 0;
+    if(dom->name_table.ptr)
+        memset(dom->name_table.ptr, 0xFF, dom->name_table.mem * sizeof(*dom->name_table.ptr));
+
+    dom->current = TCXML_DOM_NONE;
+    dom->current = tcxml_dom_add_node_(dom, TCXML_NODE_DOCUMENT);
+}
+
+static void tcxml_dom_begin_(tcxml_dom_t* dom, uint32_t flags)
+{
+    tcxml_dom_reset(dom);
+    dom->cbs.flags = TCXML_BORROW_STRINGS | flags;
+}
+tcxml_error_t tcxml_dom_parse(tcxml_dom_t* dom, tcxml_sax_buffers_t* bufs, const char* src, uint32_t flags)
+{
+    tcxml_dom_begin_(dom, flags);
+    // the strings cannot be longer than the source (each needs a delimiter where we put the `\0`), bar unusual entity replacements
+    tcxml_dom_reserve_(dom, strlen(src) + 1);
+    return tcxml_sax_process(bufs, src, &dom->cbs, dom);
+}
+tcxml_sax_context_t* tcxml_dom_begin(tcxml_dom_t* dom, tcxml_sax_buffers_t* bufs, uint32_t flags)
+{
+    tcxml_dom_begin_(dom, flags);
+    return tcxml_sax_begin(bufs, &dom->cbs, dom);
+}
+
+uint32_t tcxml_dom_name_find(const tcxml_dom_t* dom, const char* name)
+{
+    if(!dom->names.len)
+        return TCXML_DOM_NONE;
+    return *tcxml_dom_name_slot_(dom->name_table.ptr, dom->name_table.mem, dom->names.ptr, name, strlen(name));
+}
+uint32_t tcxml_dom_root(const tcxml_dom_t* dom)
+{
+    return tcxml_dom_first_element(dom, 0, TCXML_DOM_NONE);
+}
+static uint32_t tcxml_dom_find_element_(const tcxml_dom_t* dom, uint32_t node, uint32_t name)
+{
+    for(; node != TCXML_DOM_NONE; node = dom->nodes.ptr[node].next_sibling)
+        if(dom->nodes.ptr[node].type == TCXML_NODE_ELEMENT && (name == TCXML_DOM_NONE || dom->nodes.ptr[node].name == name))
+            break;
+    return node;
+}
+uint32_t tcxml_dom_first_element(const tcxml_dom_t* dom, uint32_t node, uint32_t name)
+{
+    if(node == TCXML_DOM_NONE) return TCXML_DOM_NONE;
+    return tcxml_dom_find_element_(dom, dom->nodes.ptr[node].first_child, name);
+}
+uint32_t tcxml_dom_next_element(const tcxml_dom_t* dom, uint32_t node, uint32_t name)
+{
+    if(node == TCXML_DOM_NONE) return TCXML_DOM_NONE;
+    return tcxml_dom_find_element_(dom, dom->nodes.ptr[node].next_sibling, name);
+}
+const tcxml_string_t* tcxml_dom_attr_find(const tcxml_dom_t* dom, uint32_t node, uint32_t name)
+{
+    if(node == TCXML_DOM_NONE || name == TCXML_DOM_NONE) return NULL;
+    const tcxml_dom_node_t* n = &dom->nodes.ptr[node];
+    for(uint32_t i = 0; i < n->nattrs; i++)
+        if(dom->attrs.ptr[n->attr_head + i].name == name)
+            return &dom->attrs.ptr[n->attr_head + i].value;
+    return NULL;
+}
 
 #endif /* TC_XML_IMPLEMENTATION */
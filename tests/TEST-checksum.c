@@ -0,0 +1,272 @@
+#define TC_CHECKSUM_IMPLEMENTATION
+#include "../tc_checksum.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "test.h"
+
+/* test buffer: byte `i` is `(i * 2654435761) >> 15` (truncated) */
+#define TEST_BUF_SIZE   (1 << 20)
+static unsigned char* make_buf(void)
+{
+    unsigned char* buf = malloc(TEST_BUF_SIZE);
+    size_t i;
+    for(i = 0; i < TEST_BUF_SIZE; i++)
+        buf[i] = (unsigned char)((i * 2654435761u) >> 15);
+    return buf;
+}
+static const unsigned int accels[] = { TCSUM_ACCEL_ALL, TCSUM_ACCEL_X86_SSE2 | TCSUM_ACCEL_X86_SSE42, TCSUM_ACCEL_NONE };
+
+/* expected values: zlib's `crc32()`, and a bitwise CRC32C */
+static const struct
+{
+    size_t len;
+    uint32_t crc32, crc32c;
+} crc_vectors[] = {
+    {       0, 0x00000000U, 0x00000000U },
+    {       1, 0xD202EF8DU, 0x527D5351U },
+    {       3, 0xFC5D3152U, 0x78D8B98EU },
+    {      15, 0xEA945EA9U, 0x439F4B3AU },
+    {      16, 0x905AE3BFU, 0x8BC996EBU },
+    {      63, 0x207E3F27U, 0xB67E2EDFU },
+    {      64, 0x7F4519F4U, 0x2158A19FU },
+    {      65, 0xAA7A6336U, 0x61B176DAU },
+    {     127, 0xF9CB9216U, 0x34BBF45DU },
+    {     128, 0xC6FA7850U, 0xD7A6569DU },
+    {     255, 0x999641D9U, 0x31B8B20FU },
+    {     256, 0xC7415485U, 0x49337BA0U },
+    {     257, 0x6BA37AD0U, 0x1041490DU },
+    {    1000, 0xBCAAFFD8U, 0x9B8393A2U },
+    {    1023, 0x567FA209U, 0x3708C7ABU },
+    {    1024, 0x275B5478U, 0x94D520FFU },
+    {    1025, 0x692EF3DAU, 0x8331BF37U },
+    {    4095, 0xADC512AFU, 0x25E09BBBU },
+    {    4096, 0x91C6C3F5U, 0x6E832817U },
+    {   10000, 0x4F06FC4AU, 0x7E53AF82U },
+    {   65537, 0xC94D7C53U, 0x5AA5E63CU },
+    { 1048576, 0x5428F918U, 0xCD9F0CC9U },
+};
+/* expected values: the xxHash reference implementation; seeds are `0` and `0x9E3779B185EBCA8D` (truncated for XXH32) */
+static const uint64_t xxh_seeds[] = { 0, UINT64_C(0x9E3779B185EBCA8D) };
+static const struct
+{
+    size_t len;
+    int seed;
+    uint32_t xxh32;
+    uint64_t xxh64, xxh3_64, xxh3_128_hi, xxh3_128_lo;
+} xxh_vectors[] = {
+    {       0, 0, 0x02CC5D05U, 0xEF46DB3751D8E999ULL, 0x2D06800538D394C2ULL, 0x99AA06D3014798D8ULL, 0x6001C324468D497FULL },
+    {       1, 0, 0xCF65B03EU, 0xE934A84ADB052768ULL, 0xC44BDFF4074EECDBULL, 0xA6CD5E9392000F6AULL, 0xC44BDFF4074EECDBULL },
+    {       2, 0, 0xA4D47ED9U, 0x79678ADAA61D5D9BULL, 0x2C1E0EF066462F1BULL, 0x29B3234A220A04D2ULL, 0x2C1E0EF066462F1BULL },
+    {       3, 0, 0xE0351203U, 0x6B2277B405E3331DULL, 0xA4EED9ABF09D47ACULL, 0xAF088AAAD70FB12CULL, 0xA4EED9ABF09D47ACULL },
+    {       4, 0, 0xCAE7A524U, 0x965353B52AA20B79ULL, 0x965EF06D0C1EBDC3ULL, 0xF24F27AB9351A5C9ULL, 0x854C1216981E4AC8ULL },
+    {       5, 0, 0xCBC11BEEU, 0xC68896959A4B6B97ULL, 0x429FC34EE6C79D58ULL, 0x045FDB15D729BB1BULL, 0x74099C5CE274365AULL },
+    {       7, 0, 0xF581A2B5U, 0xE42AA8DA39A8F8DEULL, 0xD117A009201E6312ULL, 0x301D121A7A7EC6FCULL, 0x1996800CC2B075DCULL },
+    {       8, 0, 0x46E77DD2U, 0xC8C49FD657D077DEULL, 0xABFDFCC2704415B9ULL, 0x97DEE7A077AB0750ULL, 0xB49366D21A6ECAF0ULL },
+    {       9, 0, 0xA03524BCU, 0xD95FAF3100EE7CD2ULL, 0x7EE31E13CA03B864ULL, 0x2307C845F055C724ULL, 0x962D547B4614FDEDULL },
+    {      15, 0, 0xA87FD9ECU, 0xFBE1C8199E9E5F3CULL, 0x0581D6D9AFF09637ULL, 0xBE1D7C8345F18868ULL, 0xD140C83A234413DFULL },
+    {      16, 0, 0xDED4FD0CU, 0xC6D2E29A477C4DECULL, 0xE026709A0303FEB4ULL, 0x4CECE2E2B6939098ULL, 0x882369657CFC90E0ULL },
+    {      17, 0, 0x5F0B028BU, 0x7392C66AA7DAFCA2ULL, 0x64F3775E144D480BULL, 0x9DBF02C30914D0CFULL, 0x68AF0CE4B80D2033ULL },
+    {      31, 0, 0xE9D10299U, 0xA73D04F25F886A1FULL, 0xAAF2D866AAAB972CULL, 0xB5C40F7FCCBE7577ULL, 0x8C80E3209EEF952BULL },
+    {      32, 0, 0x2D3DA39CU, 0x03F644041BC47CC1ULL, 0x03003034F068BF99ULL, 0x4526999C9C119A78ULL, 0xA33E110BF0D8B4A4ULL },
+    {      33, 0, 0x953AB1D8U, 0xCA4DA074CE4DF4ACULL, 0xE068AEDC3172E2A5ULL, 0x42B34A3436C7B8AFULL, 0x3E132A857F5B171BULL },
+    {      63, 0, 0x64523399U, 0x71EC591376E17D0FULL, 0xB59342B9EE12A3E1ULL, 0x862B2E442B81BE36ULL, 0x7981DDAE6CF86A5DULL },
+    {      64, 0, 0x36C59FB2U, 0xB3D9B0C93F2F2062ULL, 0xA84912F206D28F87ULL, 0x8438181387C908AAULL, 0x626AC64B40390103ULL },
+    {      65, 0, 0x58F6806CU, 0xDAB7CB8F7833327FULL, 0x79FD686B2DE193A3ULL, 0x0C6D70DB1135FA4BULL, 0x5F7B6D941E46B892ULL },
+    {      96, 0, 0x985A7D14U, 0x67F2263797710216ULL, 0x72AE3630A5D3E697ULL, 0x3E658F1DB5ED469CULL, 0xC98B06F421E6F637ULL },
+    {     127, 0, 0x49C2B538U, 0xCF7E659BF392CCA8ULL, 0x8272D3CC9CD46B11ULL, 0xBB4ED4D787F847C6ULL, 0x1A5889993994AC18ULL },
+    {     128, 0, 0x7D33FB3CU, 0x9197F664B9E55DCEULL, 0xE5F156DC5FE630A0ULL, 0x40D1618B0C754E85ULL, 0xCA484D732761A016ULL },
+    {     129, 0, 0x6C0D095FU, 0xF1B892F90556D264ULL, 0x47D4AF6DA81C5726ULL, 0x3BFFAB9F277A8653ULL, 0x3C9795439B6F88C4ULL },
+    {     200, 0, 0x774C23A8U, 0xCA53F9A7C9E1347AULL, 0x0D4862E3BD3A37C7ULL, 0x27FF58F505A822D0ULL, 0xCFD7579749EF60AAULL },
+    {     239, 0, 0x88F7A7F4U, 0xE5A3242EA157B344ULL, 0x59073E2C8538B334ULL, 0xF88D16E028C05BC5ULL, 0xE1F748749D07680BULL },
+    {     240, 0, 0x5FD3D389U, 0xF9F5C1CFC049DC83ULL, 0x2AAFA6DE57FA5CA1ULL, 0x3450632CA92FAFDCULL, 0x2175DE94D6982E15ULL },
+    {     241, 0, 0x34DCD8BFU, 0xA565CC196C9555E7ULL, 0xF31E195C6BC41010ULL, 0xACCCFEB258B6817DULL, 0xF31E195C6BC41010ULL },
+    {     255, 0, 0xF38A30E6U, 0xAE07CBEDD2327A24ULL, 0x16169AED3EF8C7C9ULL, 0x0530E6F6D0CF00C8ULL, 0x16169AED3EF8C7C9ULL },
+    {     256, 0, 0xFD0EDA26U, 0xB3B0608E8E5EB278ULL, 0xB5372DF0D21AADC9ULL, 0x0E610CDBE98D5B66ULL, 0xB5372DF0D21AADC9ULL },
+    {     257, 0, 0x60987558U, 0x21ED654ADEFD58EAULL, 0xCFD8841CC5BA9BB3ULL, 0x9B89B6E54E73B665ULL, 0xCFD8841CC5BA9BB3ULL },
+    {    1000, 0, 0xB9A8BCF9U, 0xA8AC181C3E1EFAC6ULL, 0x19AF85DAAB2747E5ULL, 0x6E1C6B10F88A0EB5ULL, 0x19AF85DAAB2747E5ULL },
+    {    1024, 0, 0x74693DCBU, 0x3B645DBEA32D7927ULL, 0x3B57796E1CC51813ULL, 0x18A8AD2592179BADULL, 0x3B57796E1CC51813ULL },
+    {    1025, 0, 0x6E637087U, 0xA94090A1D8FD4531ULL, 0x527907EC08B955EAULL, 0x6E4A73AC9D83551FULL, 0x527907EC08B955EAULL },
+    {    2047, 0, 0x3B67D3FFU, 0x16F7BEF60A18E1A8ULL, 0xD3EC7871C805B03DULL, 0x3E157E90C75774E1ULL, 0xD3EC7871C805B03DULL },
+    {    2048, 0, 0x9E453D35U, 0x6DDFB2DD76D2FD43ULL, 0x0F86DA03D9C531F7ULL, 0x455BD742699B5B0DULL, 0x0F86DA03D9C531F7ULL },
+    {    4096, 0, 0x05C15099U, 0xFCE57A548B9483F2ULL, 0x251164DE5FD59974ULL, 0x380C4D02779B2708ULL, 0x251164DE5FD59974ULL },
+    {   10000, 0, 0x5A237182U, 0xD3BD2B70D2721B83ULL, 0xF2559081794B5602ULL, 0x26CDE4A21088DBA8ULL, 0xF2559081794B5602ULL },
+    {  100000, 0, 0x04B7E9DDU, 0xAF7C46E820ADEFEEULL, 0xD2CE8C7AB04FC204ULL, 0xD5A1B96C8D3BCEAFULL, 0xD2CE8C7AB04FC204ULL },
+    { 1048576, 0, 0x2DFC4799U, 0x54CBAC3004DB215CULL, 0xB4263C6230CB60CEULL, 0xEC7A92E44AAB40C4ULL, 0xB4263C6230CB60CEULL },
+    {       0, 1, 0x058EFD0EU, 0x0B303D920EC349DFULL, 0xA8A6B918B2F0364AULL, 0x00FEAA732A3CE25EULL, 0xA986DFC5D7605BFEULL },
+    {       1, 1, 0x66A77325U, 0x9C6678669FCD2E6DULL, 0x032BE332DD766EF8ULL, 0x20E49ABCC53B3842ULL, 0x032BE332DD766EF8ULL },
+    {       2, 1, 0x06F9433EU, 0x1BB957AD557ADD71ULL, 0x8471EBD4B07BB0B9ULL, 0x21F487624BEA1AD0ULL, 0x8471EBD4B07BB0B9ULL },
+    {       3, 1, 0xA1D69707U, 0xD35E906E0154BC00ULL, 0xB253EB798F000663ULL, 0x079E3DA6A6653A77ULL, 0xB253EB798F000663ULL },
+    {       4, 1, 0xAE902DDBU, 0x202FB001FC1EB388ULL, 0x48D8BDD3D9DA0BC5ULL, 0x4A2C0E71B1D04859ULL, 0x209632037C14DCA4ULL },
+    {       5, 1, 0xE004671EU, 0x291E67DABB5DCBC1ULL, 0xD7AB3A504B508BD3ULL, 0xCAFBDBF386D4AA6EULL, 0x0E595C1045545C24ULL },
+    {       7, 1, 0x31C22D3AU, 0xE0EB735249A6ED20ULL, 0x2969189173EE9F49ULL, 0x93E90C0A8FEC1453ULL, 0x949CDF9A02B15D45ULL },
+    {       8, 1, 0x2511FFE1U, 0x7EF6E7F5D152C34EULL, 0x1B66889BCF3C22A9ULL, 0xA4186A1155782932ULL, 0xAD0ADEE884A1443AULL },
+    {       9, 1, 0x0280B8EFU, 0x247E33C6F610CEB3ULL, 0xCBBF0B441A274987ULL, 0x24C2697170EA5B71ULL, 0x6C50A0EB512C81DBULL },
+    {      15, 1, 0xD1FF47E9U, 0x125D1707C2CC4DFFULL, 0x1C35BD775C4B1ED0ULL, 0xC0C6242BF5711662ULL, 0x7BE25505C73643E6ULL },
+    {      16, 1, 0x3CF2275DU, 0x0178D0F2F782579FULL, 0xA04B9473A4AB8DF0ULL, 0x66DA1C39BF50A424ULL, 0xBB7EA01D9C85BFF1ULL },
+    {      17, 1, 0x66B9743CU, 0x9603D6C7F24A7DE2ULL, 0x7AA94E35590657B0ULL, 0xFAFE24750F8DAC78ULL, 0x3D584CB5307883F0ULL },
+    {      31, 1, 0x6EF5F63EU, 0x082F57E9BAD404EBULL, 0xADD21488D455D911ULL, 0x6D49722C1C0D0722ULL, 0x48C9053331ECD569ULL },
+    {      32, 1, 0xB3B63D4CU, 0x6EEAA0220FE09465ULL, 0x9BFEA1CC23420198ULL, 0xDB62A50B176BDF6CULL, 0x54B3F5DE2425EF7AULL },
+    {      33, 1, 0x4B255AEEU, 0x35B644D83DF33E9CULL, 0x3A244D0EA216A3F4ULL, 0x0D9F18D73FA50B8BULL, 0x5ABB8F3ED07174A0ULL },
+    {      63, 1, 0x79EB5B98U, 0xAB2CB10016088AA2ULL, 0x30C7F85EFB09FC8CULL, 0xE886D9DF2DA1AEE5ULL, 0x61DEB2019338A152ULL },
+    {      64, 1, 0x314DCE6DU, 0x30FC7162BF9BBF30ULL, 0x366E996323F0AD77ULL, 0xB608034293D7C3DAULL, 0xF4F653FE8B9E9D8BULL },
+    {      65, 1, 0x89066DCFU, 0xBF70E27F843A5B69ULL, 0x82452D071A38EED7ULL, 0x263EC27715EA2184ULL, 0xD8D1CD967664D425ULL },
+    {      96, 1, 0x6C3610CBU, 0xFF177F343A1B77C0ULL, 0xB594306BC4622263ULL, 0x8F405D3669D462BEULL, 0xC610A84E65B69B6BULL },
+    {     127, 1, 0x5DFE3C4CU, 0x11DD71DB89F30BBDULL, 0x910F70D7BBC41B7BULL, 0x5733EAF31CA30100ULL, 0x3E7EF36ED82C554AULL },
+    {     128, 1, 0xCACD8E11U, 0xB8BFFF8D96F81D62ULL, 0x21A1F7E12D12AE26ULL, 0x092E0CB5BA090A20ULL, 0x371104118B5B5086ULL },
+    {     129, 1, 0x1F52B486U, 0xE85F3FE78F693C69ULL, 0x3F1BC86A661BA549ULL, 0xFDB9F141C512F4DCULL, 0xC1E6B342AF86BB9FULL },
+    {     200, 1, 0x0B37D8ECU, 0x55C960A99EDBB2C2ULL, 0xC6DA67CBE043C0DFULL, 0xB48EF5134727199AULL, 0x0CA1B60A2546F46DULL },
+    {     239, 1, 0xC1D4C315U, 0x8BB91BF96855A719ULL, 0xC824E622E6EC220AULL, 0x4283AD88FBCADCF1ULL, 0xCDFCDED530EAB442ULL },
+    {     240, 1, 0xFBFA892CU, 0xDACB1FC85CBA3564ULL, 0x82C202ED78FEC1E7ULL, 0xFC04AB0A6F351A27ULL, 0x956ACCE0DFEAC6BBULL },
+    {     241, 1, 0x359D940EU, 0xD99B442F19F854A5ULL, 0x6A86EFA60C8E12DDULL, 0x1CDE641EEAA0F45BULL, 0x6A86EFA60C8E12DDULL },
+    {     255, 1, 0x1A34B622U, 0xD64D2E2A022FF407ULL, 0xF33155C943D8388AULL, 0x608BE02D217A2E14ULL, 0xF33155C943D8388AULL },
+    {     256, 1, 0x7386F6AAU, 0xD38A56849F56CFF7ULL, 0xFCFC894776E2F785ULL, 0x42870F459159AF3CULL, 0xFCFC894776E2F785ULL },
+    {     257, 1, 0xC814A080U, 0x265BD6F52482369FULL, 0x5595461F40A37484ULL, 0x002BD4C4B31AD80EULL, 0x5595461F40A37484ULL },
+    {    1000, 1, 0x85C56B25U, 0xEE6A8CA6590F25B5ULL, 0x1D87CED4C36680C1ULL, 0xEA642D1A708F30BAULL, 0x1D87CED4C36680C1ULL },
+    {    1024, 1, 0xFC217049U, 0x35EE402AFA39C6D8ULL, 0xF06BAC00497805F2ULL, 0x008847C250C118BFULL, 0xF06BAC00497805F2ULL },
+    {    1025, 1, 0x486C8B27U, 0x0034F1E99FDAA4CDULL, 0xA011A38374F2B928ULL, 0x37972311A287AFADULL, 0xA011A38374F2B928ULL },
+    {    2047, 1, 0xBCA28B54U, 0xC2AA8DCF04AE5B5CULL, 0x9A069B450F275B02ULL, 0xA7C922C1D8243264ULL, 0x9A069B450F275B02ULL },
+    {    2048, 1, 0x3125A3B7U, 0xAE67A55286CA274BULL, 0x56521905D12FCE75ULL, 0x43A2B678912601BBULL, 0x56521905D12FCE75ULL },
+    {    4096, 1, 0xD312F5F2U, 0xDFC5A6BD5D37CBA2ULL, 0xDCC1AA629FA82328ULL, 0x1797555319E57A5EULL, 0xDCC1AA629FA82328ULL },
+    {   10000, 1, 0x0E425691U, 0x1B44177F8AACBA3AULL, 0x998ED94F7CC5BEF6ULL, 0x9846D151EB172DFAULL, 0x998ED94F7CC5BEF6ULL },
+    {  100000, 1, 0x16D1AFEBU, 0x51A3BB7BE1331CF5ULL, 0x9C25AB338D02FB00ULL, 0x86EB1E64D22E8644ULL, 0x9C25AB338D02FB00ULL },
+    { 1048576, 1, 0xD33B9071U, 0xFE5859048210062CULL, 0x49C625D7E65752EEULL, 0x95F5E414BD555361ULL, 0x49C625D7E65752EEULL },
+};
+
+TEST(CRC32_Check,(
+    ASSERT_EQ(tcsum_crc32("123456789", 9), 0xCBF43926U);
+    ASSERT_EQ(tcsum_crc32("The quick brown fox jumps over the lazy dog", 43), 0x414FA339U);
+    ASSERT_EQ(tcsum_crc32c("123456789", 9), 0xE3069283U);
+))
+
+#define HELPER_CRC(LSUM,USUM) (                                                \
+    unsigned char* buf = make_buf();                                           \
+    size_t a, i;                                                               \
+    for(a = 0; a < sizeof(accels) / sizeof(*accels); a++)                      \
+    {                                                                          \
+        tcsum_accel_set(accels[a]);                                            \
+        for(i = 0; i < sizeof(crc_vectors) / sizeof(*crc_vectors); i++)        \
+        {                                                                      \
+            size_t len = crc_vectors[i].len;                                   \
+            TCSum_##USUM state;                                                \
+            ASSERT_EQ(tcsum_##LSUM(buf, len), crc_vectors[i].LSUM);            \
+            /* split at an odd point, so that neither part is aligned */       \
+            tcsum_##LSUM##_init(&state);                                       \
+            tcsum_##LSUM##_process(&state, buf, len / 3);                      \
+            tcsum_##LSUM##_process(&state, buf + len / 3, len - len / 3);      \
+            ASSERT_EQ(tcsum_##LSUM##_get(&state), crc_vectors[i].LSUM);        \
+            ASSERT_EQ(tcsum_##LSUM##_combine(tcsum_##LSUM(buf, len / 3), tcsum_##LSUM(buf + len / 3, len - len / 3), len - len / 3), crc_vectors[i].LSUM);\
+        }                                                                      \
+    }                                                                          \
+    tcsum_accel_set(TCSUM_ACCEL_ALL);                                          \
+    free(buf); )
+
+TEST(CRC32,HELPER_CRC(crc32,CRC32))
+TEST(CRC32C,HELPER_CRC(crc32c,CRC32C))
+
+TEST(CRC_Combine,(
+    unsigned char* buf = make_buf();
+    uint32_t crc32 = tcsum_crc32(buf, 0), crc32c = tcsum_crc32c(buf, 0);
+    size_t pos, clen;
+    /* uneven chunks, combined one by one */
+    for(pos = 0, clen = 1; pos < TEST_BUF_SIZE; pos += clen, clen = clen * 3 + 1)
+    {
+        if(clen > TEST_BUF_SIZE - pos) clen = TEST_BUF_SIZE - pos;
+        crc32 = tcsum_crc32_combine(crc32, tcsum_crc32(buf + pos, clen), clen);
+        crc32c = tcsum_crc32c_combine(crc32c, tcsum_crc32c(buf + pos, clen), clen);
+    }
+    ASSERT_EQ(crc32, 0x5428F918U);
+    ASSERT_EQ(crc32c, 0xCD9F0CC9U);
+    /* empty `B` must be a no-op */
+    ASSERT_EQ(tcsum_crc32_combine(crc32, tcsum_crc32(buf, 0), 0), crc32);
+    free(buf);
+))
+
+#define HELPER_XXH(LSUM,FIELD,SEEDT,USUM) (                                    \
+    unsigned char* buf = make_buf();                                           \
+    size_t a, i, j;                                                            \
+    for(a = 0; a < sizeof(accels) / sizeof(*accels); a++)                      \
+    {                                                                          \
+        tcsum_accel_set(accels[a]);                                            \
+        for(i = 0; i < sizeof(xxh_vectors) / sizeof(*xxh_vectors); i++)        \
+        {                                                                      \
+            size_t len = xxh_vectors[i].len;                                   \
+            SEEDT seed = (SEEDT)xxh_seeds[xxh_vectors[i].seed];                \
+            ASSERT_EQ(tcsum_##LSUM(buf, len, seed), xxh_vectors[i].FIELD);     \
+            /* streaming, in chunks of various sizes */                        \
+            for(j = 1; j <= 1025; j = j * 4 + 1)                               \
+            {                                                                  \
+                size_t pos, clen;                                              \
+                TCSum_##USUM state;                                             \
+                tcsum_##LSUM##_init(&state, seed);                             \
+                for(pos = 0; pos < len; pos += clen)                           \
+                {                                                              \
+                    clen = len - pos < j ? len - pos : j;                      \
+                    tcsum_##LSUM##_process(&state, buf + pos, clen);           \
+                }                                                              \
+                ASSERT_EQ(tcsum_##LSUM##_get(&state), xxh_vectors[i].FIELD);   \
+            }                                                                  \
+        }                                                                      \
+    }                                                                          \
+    tcsum_accel_set(TCSUM_ACCEL_ALL);                                          \
+    free(buf); )
+
+TEST(XXH32,HELPER_XXH(xxh32,xxh32,uint32_t,XXH32))
+TEST(XXH64,HELPER_XXH(xxh64,xxh64,uint64_t,XXH64))
+
+TEST(XXH3,(
+    unsigned char* buf = make_buf();
+    size_t a, i, j;
+    for(a = 0; a < sizeof(accels) / sizeof(*accels); a++)
+    {
+        tcsum_accel_set(accels[a]);
+        for(i = 0; i < sizeof(xxh_vectors) / sizeof(*xxh_vectors); i++)
+        {
+            size_t len = xxh_vectors[i].len;
+            uint64_t seed = xxh_seeds[xxh_vectors[i].seed];
+            TCSum_U128 h = tcsum_xxh3_128(buf, len, seed);
+            ASSERT_EQ(tcsum_xxh3_64(buf, len, seed), xxh_vectors[i].xxh3_64);
+            ASSERT_EQ(h.hi, xxh_vectors[i].xxh3_128_hi);
+            ASSERT_EQ(h.lo, xxh_vectors[i].xxh3_128_lo);
+            /* streaming, in chunks of various sizes; the state is shared between the 64- and 128-bit variants */
+            for(j = 1; j <= 4097; j = j * 4 + 1)
+            {
+                size_t pos, clen;
+                TCSum_XXH3 state;
+                tcsum_xxh3_init(&state, seed);
+                for(pos = 0; pos < len; pos += clen)
+                {
+                    clen = len - pos < j ? len - pos : j;
+                    tcsum_xxh3_process(&state, buf + pos, clen);
+                }
+                h = tcsum_xxh3_128_get(&state);
+                ASSERT_EQ(tcsum_xxh3_64_get(&state), xxh_vectors[i].xxh3_64);
+                ASSERT_EQ(h.hi, xxh_vectors[i].xxh3_128_hi);
+                ASSERT_EQ(h.lo, xxh_vectors[i].xxh3_128_lo);
+            }
+        }
+    }
+    tcsum_accel_set(TCSUM_ACCEL_ALL);
+    free(buf);
+))
+
+int main(void)
+{
+    TESTS_BEGIN();
+
+    TEST_HEADER("CRC");
+        TEST_EXEC(CRC32_Check);
+        TEST_EXEC(CRC32);
+        TEST_EXEC(CRC32C);
+        TEST_EXEC(CRC_Combine);
+    TEST_HEADER("xxHash");
+        TEST_EXEC(XXH32);
+        TEST_EXEC(XXH64);
+        TEST_EXEC(XXH3);
+
+    TESTS_END();
+
+    return 0;
+}
@@ -1,3 +1,7 @@
+/* for `tchash_blake3_mt()` */
+#define TC_THREAD_IMPLEMENTATION
+#include "../tc_thread.h"
+
 #define TC_HASH_IMPLEMENTATION
 #include "../tc_hash.h"
 
@@ -704,6 +708,480 @@ TEST(SHAKE256_LongMsg,HELPER_MSG_DSIZE(shake256,SHAKE256,"shake/SHAKE256LongMsg"
 TEST(SHAKE256_VariableOut,HELPER_VAROUT(shake256,SHAKE256,"shake/SHAKE256VariableOut",256/8))
 TEST(SHAKE256_MonteCarlo,HELPER_MONTE_SHAKE(shake256,SHAKE256,"shake/SHAKE256Monte"))
 
+// 4-way SHA3/SHAKE: lane 0 gets the test vector, while the other lanes get variations of it (checked against the 1-way functions)
+static void* helper_keccak_x4(void* digest, size_t digestlen, const void* data, size_t dlen, int shake)
+{
+    unsigned char* copies = malloc(3 * dlen + 1);
+    unsigned char* results = malloc(5 * digestlen);
+    const void* datas[4];
+    void* digests[4];
+    size_t j;
+    if(!copies || !results)
+    {
+        free(copies);
+        free(results);
+        return NULL;
+    }
+
+    datas[0] = data;
+    for(j = 0; j < 4; j++)
+        digests[j] = results + j * digestlen;
+    for(j = 1; j < 4; j++)
+    {
+        unsigned char* copy = copies + (j - 1) * dlen;
+        memcpy(copy, data, dlen);
+        if(dlen) copy[(j * 7919) % dlen] ^= j;
+        datas[j] = copy;
+    }
+
+    if(shake) tchash_shake128_x4(digests, digestlen, datas, dlen);
+    else tchash_sha3_256_x4(digests, datas, dlen);
+
+    memcpy(digest, digests[0], digestlen);
+    for(j = 1; j < 4; j++)
+    {
+        unsigned char* expected = results + 4 * digestlen;
+        if(shake) tchash_shake128(expected, digestlen, datas[j], dlen);
+        else tchash_sha3_256(expected, datas[j], dlen);
+        if(memcmp(digests[j], expected, digestlen))
+            memset(digest, 0, digestlen);   /* so that the caller's comparison fails */
+    }
+    free(copies);
+    free(results);
+    return digest;
+}
+static void* tchash_sha3_256_x4_check(void* digest, const void* data, size_t dlen) { return helper_keccak_x4(digest, TCHASH_SHA3_256_DIGEST_SIZE, data, dlen, 0); }
+static void* tchash_shake128_x4_check(void* digest, size_t digestlen, const void* data, size_t dlen) { return helper_keccak_x4(digest, digestlen, data, dlen, 1); }
+TEST(SHA3_256_X4_ShortMsg,HELPER_MSG(sha3_256_x4_check,SHA3_256,"sha3/SHA3_256ShortMsg"))
+TEST(SHA3_256_X4_LongMsg,HELPER_MSG(sha3_256_x4_check,SHA3_256,"sha3/SHA3_256LongMsg"))
+TEST(SHAKE128_X4_ShortMsg,HELPER_MSG_DSIZE(shake128_x4_check,SHAKE128,"shake/SHAKE128ShortMsg","Output",128/8,(result, sizeof(result), data, nbytes)))
+TEST(SHAKE128_X4_LongMsg,HELPER_MSG_DSIZE(shake128_x4_check,SHAKE128,"shake/SHAKE128LongMsg","Output",128/8,(result, sizeof(result), data, nbytes)))
+TEST(SHAKE128_X4_VariableOut,HELPER_VAROUT(shake128_x4_check,SHAKE128,"shake/SHAKE128VariableOut",128/8))
+
+// BLAKE2 & BLAKE3
+/* message bytes are `i % 251` & keys are `00 01 02 ...` (as in the reference test vectors) */
+static const size_t Blake2bLens[] = { 0, 1, 127, 128, 129, 255, 256, 1000 };
+static const char* Blake2bKeyed[] = {
+    "10ebb67700b1868efb4417987acf4690ae9d972fb7a590c2f02871799aaa4786b5e996e8f0f4eb981fc214b005f42d2ff4233499391653df7aefcbc13fc51568",
+    "961f6dd1e4dd30f63901690c512e78e4b45e4742ed197c3c5e45c549fd25f2e4187b0bc9fe30492b16b0d0bc4ef9b0f34c7003fac09a5ef1532e69430234cebd",
+    "76d2d819c92bce55fa8e092ab1bf9b9eab237a25267986cacf2b8ee14d214d730dc9a5aa2d7b596e86a1fd8fa0804c77402d2fcd45083688b218b1cdfa0dcbcb",
+    "72065ee4dd91c2d8509fa1fc28a37c7fc9fa7d5b3f8ad3d0d7a25626b57b1b44788d4caf806290425f9890a3a2a35a905ab4b37acfd0da6e4517b2525c9651e4",
+    "64475dfe7600d7171bea0b394e27c9b00d8e74dd1e416a79473682ad3dfdbb706631558055cfc8a40e07bd015a4540dcdea15883cbbf31412df1de1cd4152b91",
+    "8e1e2c579262b7c01966c3133c2bb704a165be2308ff8925a2f070dec7275740fa9fe004ee25c8e1a3dd57317065ee744f0821c4e911eee8e484e770f21dd958",
+    "38efcfc158f8057f5365285db9184c77ddf4d53090fd89ef261815370fd994a1b23b3e3336d7ff97823271e7e50042576ce14feadab1e8357346ffa335a3e97e",
+    "715377e0611515b904d259ce52fc8e5d2c50468b1680b2984786b6949cc571f453d28cfb6969cb523ec84e06bf2a4465f3f37511db7792228d038942935750c1",
+};
+static const size_t Blake2sLens[] = { 0, 1, 63, 64, 65, 127, 128, 1000 };
+static const char* Blake2sKeyed[] = {
+    "48a8997da407876b3d79c0d92325ad3b89cbb754d86ab71aee047ad345fd2c49",
+    "40d15fee7c328830166ac3f918650f807e7e01e177258cdc0a39b11f598066f1",
+    "c65382513f07460da39833cb666c5ed82e61b9e998f4b0c4287cee56c3cc9bcd",
+    "8975b0577fd35566d750b362b0897a26c399136df07bababbde6203ff2954ed4",
+    "21fe0ceb0052be7fb0f004187cacd7de67fa6eb0938d927677f2398c132317a8",
+    "ddbfea75cc467882eb3483ce5e2e756a4f4701b76b445519e89f22d60fa86e06",
+    "0c311f38c35a4fb90d651c289d486856cd1413df9b0677f53ece2cd9e477c60a",
+    "d5c42863172fb2424de520ff25866bf2ac9201ce81b6a8b703f67ea4c6735767",
+};
+static const size_t Blake3Lens[] = { 0, 1, 63, 64, 65, 1023, 1024, 1025, 2048, 2049, 3072, 3073, 4096, 4097, 5120, 5121, 6144, 6145, 7168, 7169, 8192, 8193, 16384, 31744, 102400, 300000 };
+static const char* Blake3Hash[] = {
+    "af1349b9f5f9a1a6a0404dea36dcc9499bcb25c9adc112b7cc9a93cae41f3262",
+    "2d3adedff11b61f14c886e35afa036736dcd87a74d27b5c1510225d0f592e213",
+    "e9bc37a594daad83be9470df7f7b3798297c3d834ce80ba85d6e207627b7db7b",
+    "4eed7141ea4a5cd4b788606bd23f46e212af9cacebacdc7d1f4c6dc7f2511b98",
+    "de1e5fa0be70df6d2be8fffd0e99ceaa8eb6e8c93a63f2d8d1c30ecb6b263dee",
+    "10108970eeda3eb932baac1428c7a2163b0e924c9a9e25b35bba72b28f70bd11",
+    "42214739f095a406f3fc83deb889744ac00df831c10daa55189b5d121c855af7",
+    "d00278ae47eb27b34faecf67b4fe263f82d5412916c1ffd97c8cb7fb814b8444",
+    "e776b6028c7cd22a4d0ba182a8bf62205d2ef576467e838ed6f2529b85fba24a",
+    "5f4d72f40d7a5f82b15ca2b2e44b1de3c2ef86c426c95c1af0b6879522563030",
+    "b98cb0ff3623be03326b373de6b9095218513e64f1ee2edd2525c7ad1e5cffd2",
+    "7124b49501012f81cc7f11ca069ec9226cecb8a2c850cfe644e327d22d3e1cd3",
+    "015094013f57a5277b59d8475c0501042c0b642e531b0a1c8f58d2163229e969",
+    "9b4052b38f1c5fc8b1f9ff7ac7b27cd242487b3d890d15c96a1c25b8aa0fb995",
+    "9cadc15fed8b5d854562b26a9536d9707cadeda9b143978f319ab34230535833",
+    "628bd2cb2004694adaab7bbd778a25df25c47b9d4155a55f8fbd79f2fe154cff",
+    "3e2e5b74e048f3add6d21faab3f83aa44d3b2278afb83b80b3c35164ebeca205",
+    "f1323a8631446cc50536a9f705ee5cb619424d46887f3c376c695b70e0f0507f",
+    "61da957ec2499a95d6b8023e2b0e604ec7f6b50e80a9678b89d2628e99ada77a",
+    "a003fc7a51754a9b3c7fae0367ab3d782dccf28855a03d435f8cfe74605e7817",
+    "aae792484c8efe4f19e2ca7d371d8c467ffb10748d8a5a1ae579948f718a2a63",
+    "bab6c09cb8ce8cf459261398d2e7aef35700bf488116ceb94a36d0f5f1b7bc3b",
+    "f875d6646de28985646f34ee13be9a576fd515f76b5b0a26bb324735041ddde4",
+    "62b6960e1a44bcc1eb1a611a8d6235b6b4b78f32e7abc4fb4c6cdcce94895c47",
+    "bc3e3d41a1146b069abffad3c0d44860cf664390afce4d9661f7902e7943e085",
+    "6cc9dce05d4cff8c5bef5c5a24681e42b13f03e34a0bc5e66f65a91d48c944fa",
+};
+static const char* Blake3Keyed[] = {
+    "73492b19995d71cdb1e9d74decc09809eb732f1b00bc95c27cb15f9dd4d6478f",
+    "d08b45c6b127ee94f3f8527a0b82a5f80be1695a0eaec6022e772c0eb95a7e8b",
+    "e471df92f6f7dee100138af7da29695906b0dc34ccde2142a730dd4ebcbc09cc",
+    "cfaf838ff320e0d87301dcba02b1a4bb397d65119f57403df2817a51d4025f9b",
+    "d8a45528bfa93a0d9b7bf4c840b68f64af0b9ad3d0bbd6c1421c2a4cf1cdf3b4",
+    "da1f18069871512af22af9f13dc005800dfd52c55f42753b5ae718086fe2ee44",
+    "f45a9249a627fdf1fcf13c0e6376f6a9a9b2056d6e1b5693a4b119a3453665f9",
+    "82223147a9b804a0c3f9a921b8d8aee250d1a51bb76be72152e6d5e8f27349b3",
+    "636bfa717d4f9fc3e59da9b2e5cce6a2b78eb70469c0fce49da38b5419892423",
+    "5442eec85e3fd173dcff07c39cd8cff9689f17224471e655618ed728cf03b056",
+    "66315151ac08f5cdf077f76e1b5f584a4da7b48a75036de5729be38dac835fb7",
+    "66eabf3a0a1a262221ee9eed633621a5065e4e73d098277c7de4162559edb9b4",
+    "e8c6e859e0480c4b062457defd04d2f4303b6cc280a0fe080ec5c4346a171937",
+    "a3b7fe277011b5efcde8a33d90b0edb88c29e73831f34d9b02aebab51c98e2a6",
+    "8bb4f2ab4db1d207713b4240105ec14d57452bc53073c480f8377279fa959a95",
+    "f5e92bc50eb02296aad75a7fb1faf6bf95c0f3eccfaaed506e2448df16b45c0b",
+    "40b1e813ec046e44a9818020f1e04cdc0e849d86636492191229f3f7257a636a",
+    "cc71dac5c78b3343de37fb4da9813f21a5b5ad63d9a2b1ca21a49a54373f9426",
+    "fabe20ee334b76c0b7fe08a7592829f8493c150393c8532f9505d27a22574fab",
+    "accec9095f0b3bed3223a28fa90c84f8c7b4cd5570331664b4ecc52041468ade",
+    "c659141d9d7e6efafd2f274d4307b9ab3369f058c6d03cd5ba17d4518d77bd49",
+    "c666ccf5fa240c07a9d0a6b8ae92c67668b482e7c2751fb5e1d9d7078fa9637e",
+    "8880ce020ab0459420eee7e95f173d8a0d55c9b499d857880b0c661eb4162bae",
+    "55253f057bce59e7811fea47ac0e72751ca12c40c4a5b8f3c42e54daa5073272",
+    "ab2ecf0478e816065ba6039d8ec583cbce8a2335efe903e2d7313c04ba5330d2",
+    "ed8c20bf3713d493770ce067d4d875fc0383f68f2dc1b733242ea7ccd413b7d5",
+};
+static unsigned char* blake_test_data(size_t len)
+{
+    unsigned char* data = malloc(len ? len : 1);
+    size_t i;
+    if(data)
+        for(i = 0; i < len; i++)
+            data[i] = i % 251;
+    return data;
+}
+/* process in uneven pieces, to exercise the buffering */
+static const size_t BlakeSplits[] = { 1, 63, 64, 65, 1000, 127, 2048, 7 };
+#define HELPER_BLAKE_SPLIT(LHASH,DATA,DLEN) do {                               \
+        size_t o_ = 0, s_ = 0;                                                 \
+        while(o_ < (DLEN))                                                     \
+        {                                                                      \
+            size_t c_ = BlakeSplits[s_++ % (sizeof(BlakeSplits) / sizeof(*BlakeSplits))];\
+            if(c_ > (DLEN) - o_) c_ = (DLEN) - o_;                             \
+            tchash_##LHASH##_process(&LHASH, (DATA) + o_, c_);                 \
+            o_ += c_;                                                          \
+        }                                                                      \
+    } while(0)
+#define HELPER_BLAKE_KAT(LHASH,UHASH,TESTVECTORS,HARGS) (                      \
+    char bytes[TCHASH_##UHASH##_DIGEST_SIZE];                                  \
+    char hexstr[2*sizeof(bytes)+1];                                            \
+                                                                               \
+    size_t i;                                                                  \
+    for(i = 0; i < sizeof(TESTVECTORS) / sizeof(*TESTVECTORS); i += 2)         \
+    {                                                                          \
+        const char* data = TESTVECTORS[i+0];                                   \
+        size_t dlen = strlen(data);                                            \
+        const char* expected = TESTVECTORS[i+1];                               \
+                                                                               \
+        tchash_##LHASH HARGS;                                                  \
+        tchash_xstring_from_bytes(hexstr, bytes, sizeof(bytes), 0);            \
+        ASSERT_STREQ(hexstr, expected);                                        \
+    }                                                                          \
+)
+#define HELPER_BLAKE2_KEYED(LHASH,UHASH,LENS,VECTORS) (                        \
+    unsigned char key[TCHASH_##UHASH##_KEY_SIZE];                              \
+    char bytes[TCHASH_##UHASH##_DIGEST_SIZE];                                  \
+    char hexstr[2*sizeof(bytes)+1];                                            \
+    TCHash_##UHASH LHASH;                                                      \
+    size_t i;                                                                  \
+    for(i = 0; i < sizeof(key); i++)                                           \
+        key[i] = i;                                                            \
+                                                                               \
+    for(i = 0; i < sizeof(LENS) / sizeof(*LENS); i++)                          \
+    {                                                                          \
+        unsigned char* data = blake_test_data(LENS[i]);                        \
+        ASSERT_NOTNULL(data);                                                  \
+                                                                               \
+        ASSERT_NOTNULL(tchash_##LHASH##_init_key(&LHASH, sizeof(bytes), key, sizeof(key)));\
+        tchash_##LHASH##_process(&LHASH, data, LENS[i]);                       \
+        tchash_##LHASH##_get(&LHASH, bytes);                                   \
+        tchash_xstring_from_bytes(hexstr, bytes, sizeof(bytes), 0);            \
+        ASSERT_STREQ(hexstr, VECTORS[i]);                                      \
+                                                                               \
+        tchash_##LHASH##_init_key(&LHASH, sizeof(bytes), key, sizeof(key));    \
+        HELPER_BLAKE_SPLIT(LHASH, data, LENS[i]);                              \
+        tchash_##LHASH##_get(&LHASH, bytes);                                   \
+        tchash_xstring_from_bytes(hexstr, bytes, sizeof(bytes), 0);            \
+        ASSERT_STREQ(hexstr, VECTORS[i]);                                      \
+        free(data);                                                            \
+    }                                                                          \
+    /* digest & key limits */                                                  \
+    ASSERT_NULL(tchash_##LHASH##_init_key(&LHASH, 0, NULL, 0));                \
+    ASSERT_NULL(tchash_##LHASH##_init_key(&LHASH, sizeof(bytes) + 1, NULL, 0));\
+    ASSERT_NULL(tchash_##LHASH##_init_key(&LHASH, sizeof(bytes), key, sizeof(key) + 1));\
+)
+static const char* Blake2bVectors[] = {
+        "", "786a02f742015903c6c6fd852552d272912f4740e15847618a86e217f71f5419d25e1031afee585313896444934eb04b903a685b1448b755d56f701afe9be2ce",
+        "abc", "ba80a53f981c4d0d6a2797b69f12f6e94c212f14685ac4b74b12bb6fdbffa2d17d87c5392aab792dc252d5de4533cc9518d38aa8dbf1925ab92386edd4009923",
+        "The quick brown fox jumps over the lazy dog", "a8add4bdddfd93e4877d2746e62817b116364a1fa7bc148d95090bc7333b3673f82401cf7aa2e4cb1ecd90296e3f14cb5413f8ed77be73045b13914cdcd6a918",
+};
+static const char* Blake2sVectors[] = {
+        "", "69217a3079908094e11121d042354a7c1f55b6482ca1a51e1b250dfd1ed0eef9",
+        "abc", "508c5e8c327c14e2e1a72ba34eeb452f37458b209ed63a294d999b4c86675982",
+        "The quick brown fox jumps over the lazy dog", "606beeec743ccbeff6cbcdf5d5302aa855c256c29b88c8ed331ea1a6bf3c8812",
+};
+static const char* Blake3Vectors[] = {
+        "", "af1349b9f5f9a1a6a0404dea36dcc9499bcb25c9adc112b7cc9a93cae41f3262",
+        "abc", "6437b3ac38465133ffb63b75273a8db548c558465d79db03fd359c6cd5bd9d85",
+        "The quick brown fox jumps over the lazy dog", "2f1514181aadccd913abd94cfa592701a5686ab23f8df1dff1b74710febc6d4a",
+};
+TEST(BLAKE2b,HELPER_BLAKE_KAT(blake2b,BLAKE2B,Blake2bVectors,(bytes, data, dlen)))
+TEST(BLAKE2b_Keyed,HELPER_BLAKE2_KEYED(blake2b,BLAKE2B,Blake2bLens,Blake2bKeyed))
+TEST(BLAKE2s,HELPER_BLAKE_KAT(blake2s,BLAKE2S,Blake2sVectors,(bytes, data, dlen)))
+TEST(BLAKE2s_Keyed,HELPER_BLAKE2_KEYED(blake2s,BLAKE2S,Blake2sLens,Blake2sKeyed))
+TEST(BLAKE3,HELPER_BLAKE_KAT(blake3,BLAKE3,Blake3Vectors,(bytes, sizeof(bytes), data, dlen)))
+TEST(BLAKE3_Tree,(
+    unsigned char key[TCHASH_BLAKE3_KEY_SIZE];
+    char bytes[TCHASH_BLAKE3_DIGEST_SIZE];
+    char hexstr[2*sizeof(bytes)+1];
+    TCHash_BLAKE3 blake3;
+    size_t i;
+    for(i = 0; i < sizeof(key); i++)
+        key[i] = i;
+
+    for(i = 0; i < sizeof(Blake3Lens) / sizeof(*Blake3Lens); i++)
+    {
+        unsigned char* data = blake_test_data(Blake3Lens[i]);
+        ASSERT_NOTNULL(data);
+
+        tchash_blake3(bytes, sizeof(bytes), data, Blake3Lens[i]);
+        tchash_xstring_from_bytes(hexstr, bytes, sizeof(bytes), 0);
+        ASSERT_STREQ(hexstr, Blake3Hash[i]);
+
+        tchash_blake3_init(&blake3);
+        HELPER_BLAKE_SPLIT(blake3, data, Blake3Lens[i]);
+        tchash_blake3_get(&blake3, bytes, sizeof(bytes));
+        tchash_xstring_from_bytes(hexstr, bytes, sizeof(bytes), 0);
+        ASSERT_STREQ(hexstr, Blake3Hash[i]);
+
+        tchash_blake3_init_key(&blake3, key);
+        HELPER_BLAKE_SPLIT(blake3, data, Blake3Lens[i]);
+        tchash_blake3_get(&blake3, bytes, sizeof(bytes));
+        tchash_xstring_from_bytes(hexstr, bytes, sizeof(bytes), 0);
+        ASSERT_STREQ(hexstr, Blake3Keyed[i]);
+        free(data);
+    }
+))
+TEST(BLAKE3_XOF,(
+    /* a longer output must start with the shorter one */
+    unsigned char* data = blake_test_data(5000);
+    unsigned char shorter[TCHASH_BLAKE3_DIGEST_SIZE], longer[333];
+    ASSERT_NOTNULL(data);
+    size_t i;
+    for(i = 0; i < 3; i++)
+    {
+        size_t dlen = i == 0 ? 0 : i == 1 ? 1000 : 5000;
+        tchash_blake3(shorter, sizeof(shorter), data, dlen);
+        tchash_blake3(longer, sizeof(longer), data, dlen);
+        ASSERT_MEMEQ(longer, sizeof(shorter), shorter, sizeof(shorter));
+    }
+    free(data);
+))
+TEST(BLAKE3_MT,(
+    /* large enough to be split between threads */
+    static const unsigned int nthreads[] = { 0, 1, 2, 3, 8 };
+    static const size_t lens[] = { 131072, 300000, 1048576, 3000001 };
+    unsigned char* data = blake_test_data(lens[sizeof(lens) / sizeof(*lens) - 1]);
+    unsigned char expected[TCHASH_BLAKE3_DIGEST_SIZE], result[TCHASH_BLAKE3_DIGEST_SIZE];
+    ASSERT_NOTNULL(data);
+    size_t i, t;
+    for(i = 0; i < sizeof(lens) / sizeof(*lens); i++)
+    {
+        tchash_blake3(expected, sizeof(expected), data, lens[i]);
+        for(t = 0; t < sizeof(nthreads) / sizeof(*nthreads); t++)
+        {
+            memset(result, 0, sizeof(result));
+            tchash_blake3_mt(result, sizeof(result), data, lens[i], nthreads[t]);
+            ASSERT_MEMEQ(result, sizeof(result), expected, sizeof(expected));
+        }
+    }
+    free(data);
+))
+
+// HMAC & HKDF
+/* the NIST file has one `[L=n]` section per hash; each MAC is truncated to `Tlen` bytes */
+#define HELPER_HMAC(LHASH,UHASH,SECTION) (                                     \
+    size_t dlen;                                                               \
+    char* text = read_all(&dlen, TESTDATA_ROOT "/HMAC.rsp");                   \
+    ASSERT_NOTNULL(text);                                                      \
+    char* ptr = strstr(text, SECTION);                                         \
+    ASSERT_NOTNULL(ptr);                                                       \
+    ptr += strlen(SECTION);                                                    \
+    char* next = strstr(ptr, "\n[");                                           \
+    if(next) *next = 0;                                                        \
+                                                                               \
+    char result[TCHASH_##UHASH##_DIGEST_SIZE];                                 \
+    char kresult[TCHASH_##UHASH##_DIGEST_SIZE];                                \
+    char tresult[TCHASH_##UHASH##_DIGEST_SIZE*2+1];                            \
+    unsigned char key[256], data[256];                                         \
+    TCHash_HMAC_##UHASH hmac;                                                  \
+    size_t ncases = 0;                                                         \
+                                                                               \
+    for(;;)                                                                    \
+    {                                                                          \
+        char* klen = get_field(&ptr, "Klen");                                  \
+        if(!klen) break;                                                       \
+        size_t tlen = strtoul(get_field(&ptr, "Tlen"), NULL, 10);              \
+        char* skey = get_field(&ptr, "Key");                                   \
+        char* msg = get_field(&ptr, "Msg");                                    \
+        char* mac = get_field(&ptr, "Mac");                                    \
+        ASSERT_NOTNULL(mac);                                                   \
+        ASSERT_LE(tlen, sizeof(result));                                       \
+        ASSERT_EQ(tlen * 2, strlen(mac));                                      \
+                                                                               \
+        size_t nkey = tchash_bytes_from_xstring(key, skey, -1);                \
+        ASSERT_EQ(nkey, strtoul(klen, NULL, 10));                              \
+        size_t nbytes = tchash_bytes_from_xstring(data, msg, -1);              \
+        ASSERT_NE(nbytes, 0);                                                  \
+                                                                               \
+        tchash_hmac_##LHASH(result, key, nkey, data, nbytes);                  \
+        tchash_xstring_from_bytes(tresult, result, tlen, 0);                   \
+        ASSERT_STREQ(tresult, mac);                                            \
+                                                                               \
+        /* a precomputed key must give the same result (and stay reusable) */  \
+        tchash_hmac_##LHASH##_init(&hmac, key, nkey);                          \
+        tchash_hmac_##LHASH##_keyed(kresult, &hmac, data, nbytes);             \
+        ASSERT_MEMEQ(kresult, sizeof(kresult), result, sizeof(result));        \
+        tchash_hmac_##LHASH##_keyed(kresult, &hmac, data, nbytes);             \
+        ASSERT_MEMEQ(kresult, sizeof(kresult), result, sizeof(result));        \
+        tchash_hmac_##LHASH##_process(&hmac, data, 1);                         \
+        tchash_hmac_##LHASH##_process(&hmac, data + 1, nbytes - 1);            \
+        tchash_hmac_##LHASH##_get(&hmac, kresult);                             \
+        ASSERT_MEMEQ(kresult, sizeof(kresult), result, sizeof(result));        \
+        ncases++;                                                              \
+    }                                                                          \
+    ASSERT_NE(ncases, 0);                                                      \
+                                                                               \
+    free(text); )
+TEST(HMAC_SHA1,HELPER_HMAC(sha1,SHA1,"[L=20]"))
+TEST(HMAC_SHA2_224,HELPER_HMAC(sha2_224,SHA2_224,"[L=28]"))
+TEST(HMAC_SHA2_256,HELPER_HMAC(sha2_256,SHA2_256,"[L=32]"))
+TEST(HMAC_SHA2_384,HELPER_HMAC(sha2_384,SHA2_384,"[L=48]"))
+TEST(HMAC_SHA2_512,HELPER_HMAC(sha2_512,SHA2_512,"[L=64]"))
+/* a short key & message, then a key longer than any block (`i % 251`, 200 bytes) with a 1000-byte message (as in the BLAKE tests) */
+#define HELPER_HMAC_KAT(LHASH,UHASH,SHORTMAC,LONGMAC) (                        \
+    char result[TCHASH_##UHASH##_DIGEST_SIZE];                                 \
+    char tresult[TCHASH_##UHASH##_DIGEST_SIZE*2+1];                            \
+    unsigned char* key = blake_test_data(200);                                 \
+    unsigned char* data = blake_test_data(1000);                               \
+    ASSERT_NOTNULL(key);                                                       \
+    ASSERT_NOTNULL(data);                                                      \
+                                                                               \
+    tchash_hmac_##LHASH(result, "key", 3, "The quick brown fox jumps over the lazy dog", 43);\
+    tchash_xstring_from_bytes(tresult, result, sizeof(result), 0);             \
+    ASSERT_STREQ(tresult, SHORTMAC);                                           \
+    tchash_hmac_##LHASH(result, key, 200, data, 1000);                         \
+    tchash_xstring_from_bytes(tresult, result, sizeof(result), 0);             \
+    ASSERT_STREQ(tresult, LONGMAC);                                            \
+                                                                               \
+    free(data);                                                                \
+    free(key); )
+TEST(HMAC_MD5,HELPER_HMAC_KAT(md5,MD5,"80070713463e7749b90c2dc24911e275","770204521d6579819e0eb63a91d8e008"))
+TEST(HMAC_RIPEMD160,HELPER_HMAC_KAT(ripemd160,RIPEMD160,"50278a77d4d7670561ab72e867383aef6ce50b3e","95da9666ca2523027b68f79fb620d5162f3f09c1"))
+TEST(HMAC_SHA2_512_224,HELPER_HMAC_KAT(sha2_512_224,SHA2_512_224,"a1afb4f708cb63570639195121785ada3dc615989cc3c73f38e306a3","b86ec1b5ec5f05dce04ab8363cdee4d5f18e383e199fa7409a484b07"))
+TEST(HMAC_SHA2_512_256,HELPER_HMAC_KAT(sha2_512_256,SHA2_512_256,"7fb65e03577da9151a1016e9c2e514d4d48842857f13927f348588173dca6d89","b744390cf1b6e389260ea3d73bf40562262e850f211f8eff872887eb96b21ab8"))
+TEST(HMAC_SHA3_224,HELPER_HMAC_KAT(sha3_224,SHA3_224,"ff6fa8447ce10fb1efdccfe62caf8b640fe46c4fb1007912bf85100f","1a1f968e84d2ceb409afcbdd1b581bf0fece2ce8700dfc8c2299ccb3"))
+TEST(HMAC_SHA3_256,HELPER_HMAC_KAT(sha3_256,SHA3_256,"8c6e0683409427f8931711b10ca92a506eb1fafa48fadd66d76126f47ac2c333","7cd2aceaad4cd0bea38b87ecf91e8489cff84617933b0a2f930b03f04549885e"))
+TEST(HMAC_SHA3_384,HELPER_HMAC_KAT(sha3_384,SHA3_384,"aa739ad9fcdf9be4a04f06680ade7a1bd1e01a0af64accb04366234cf9f6934a0f8589772f857681fcde8acc256091a2","d47aba4326e6f3a0ec310d9a2ffb13fecaa811697b5f0be1d12df18c49d09945f13eac6be9b947c6470c272124b58c8a"))
+TEST(HMAC_SHA3_512,HELPER_HMAC_KAT(sha3_512,SHA3_512,"237a35049c40b3ef5ddd960b3dc893d8284953b9a4756611b1b61bffcf53edd979f93547db714b06ef0a692062c609b70208ab8d4a280ceee40ed8100f293063","a834e71f39b8f5b2b9ba70f7089a5643e6cc85a250ee81895546a151af60a422c93679ccea2785c8fd4ab0a4659be802eed0d31e252ab09f8ed945231156e2c1"))
+TEST(HMAC_BLAKE2b,HELPER_HMAC_KAT(blake2b,BLAKE2B,"92294f92c0dfb9b00ec9ae8bd94d7e7d8a036b885a499f149dfe2fd2199394aaaf6b8894a1730cccb2cd050f9bcf5062a38b51b0dab33207f8ef35ae2c9df51b","d94499456011aadb8b8c269137b2cf2cb9337a8bf76e96d05c25a19b168dcd44bfe1b0b16af146475b751b12f1a4ad4f564934070014f169176ef8a205e8baa5"))
+TEST(HMAC_BLAKE2s,HELPER_HMAC_KAT(blake2s,BLAKE2S,"f93215bb90d4af4c3061cd932fb169fb8bb8a91d0b4022baea1271e1323cd9a0","b0d53b61b3c640ce455c347558e6bfc119bd04c2460330f9de207580932b69dd"))
+/* RFC 5869, appendix A */
+#define HELPER_HKDF(LHASH,UHASH,SALT,IKM,INFO,PRK,OKM) (                       \
+    unsigned char salt[128], ikm[128], info[128], prk[TCHASH_##UHASH##_DIGEST_SIZE], okm[128];\
+    char tstr[2*sizeof(okm)+1];                                                \
+    size_t slen = tchash_bytes_from_xstring(salt, SALT, -1);                   \
+    size_t ilen = tchash_bytes_from_xstring(ikm, IKM, -1);                     \
+    size_t infolen = tchash_bytes_from_xstring(info, INFO, -1);                \
+    size_t olen = strlen(OKM) / 2;                                             \
+                                                                               \
+    ASSERT_EQ(tchash_hkdf_##LHASH##_extract(prk, salt, slen, ikm, ilen), prk); \
+    tchash_xstring_from_bytes(tstr, prk, sizeof(prk), 0);                      \
+    ASSERT_STREQ(tstr, PRK);                                                   \
+    ASSERT_EQ(tchash_hkdf_##LHASH##_expand(okm, olen, prk, sizeof(prk), info, infolen), okm);\
+    tchash_xstring_from_bytes(tstr, okm, olen, 0);                             \
+    ASSERT_STREQ(tstr, OKM);                                                   \
+                                                                               \
+    memset(okm, 0, sizeof(okm));                                               \
+    ASSERT_EQ(tchash_hkdf_##LHASH(okm, olen, salt, slen, ikm, ilen, info, infolen), okm);\
+    tchash_xstring_from_bytes(tstr, okm, olen, 0);                             \
+    ASSERT_STREQ(tstr, OKM); )
+TEST(HKDF_SHA2_256,HELPER_HKDF(sha2_256,SHA2_256,"000102030405060708090a0b0c","0b0b0b0b0b0b0b0b0b0b0b0b0b0b0b0b0b0b0b0b0b0b","f0f1f2f3f4f5f6f7f8f9",
+    "077709362c2e32df0ddc3f0dc47bba6390b6c73bb50f9c3122ec844ad7c2b3e5",
+    "3cb25f25faacd57a90434f64d0362f2a2d2d0a90cf1a5a4c5db02d56ecc4c5bf34007208d5b887185865"))
+TEST(HKDF_SHA2_256_NoSalt,HELPER_HKDF(sha2_256,SHA2_256,"","0b0b0b0b0b0b0b0b0b0b0b0b0b0b0b0b0b0b0b0b0b0b","",
+    "19ef24a32c717b167f33a91d6f648bdf96596776afdb6377ac434c1c293ccb04",
+    "8da4e775a563c18f715f802a063c5a31b8a11f5c5ee1879ec3454e5f3c738d2d9d201395faa4b61a96c8"))
+TEST(HKDF_SHA1,HELPER_HKDF(sha1,SHA1,
+    "606162636465666768696a6b6c6d6e6f707172737475767778797a7b7c7d7e7f808182838485868788898a8b8c8d8e8f909192939495969798999a9b9c9d9e9fa0a1a2a3a4a5a6a7a8a9aaabacadaeaf",
+    "000102030405060708090a0b0c0d0e0f101112131415161718191a1b1c1d1e1f202122232425262728292a2b2c2d2e2f303132333435363738393a3b3c3d3e3f404142434445464748494a4b4c4d4e4f",
+    "b0b1b2b3b4b5b6b7b8b9babbbcbdbebfc0c1c2c3c4c5c6c7c8c9cacbcccdcecfd0d1d2d3d4d5d6d7d8d9dadbdcdddedfe0e1e2e3e4e5e6e7e8e9eaebecedeeeff0f1f2f3f4f5f6f7f8f9fafbfcfdfeff",
+    "8adae09a2a307059478d309b26c4115a224cfaf6",
+    "0bd770a74d1160f7c9f12cd5912a06ebff6adcae899d92191fe4305673ba2ffe8fa3f1a4e5ad79f3f334b3b202b2173c486ea37ce3d397ed034c7f9dfeb15c5e927336d0441f4c4300e2cff0d0900b52d3b4"))
+TEST(HKDF_Limits,(
+    /* at most 255 blocks of output; the last block must still be correct */
+    static const char lastblock[] = "033276c47093c6f7185cbbdd927d6c1df563b4658881b6daf74d47f08b98d39c";
+    unsigned char* okm = malloc(255 * TCHASH_SHA3_256_DIGEST_SIZE + 1);
+    char tstr[2*TCHASH_SHA3_256_DIGEST_SIZE+1];
+    ASSERT_NOTNULL(okm);
+    ASSERT_NULL(tchash_hkdf_sha3_256(okm, 255 * TCHASH_SHA3_256_DIGEST_SIZE + 1, "salt", 4, "ikm", 3, "info", 4));
+    ASSERT_EQ(tchash_hkdf_sha3_256(okm, 255 * TCHASH_SHA3_256_DIGEST_SIZE, "salt", 4, "ikm", 3, "info", 4), okm);
+    tchash_xstring_from_bytes(tstr, okm + 254 * TCHASH_SHA3_256_DIGEST_SIZE, TCHASH_SHA3_256_DIGEST_SIZE, 0);
+    ASSERT_STREQ(tstr, lastblock);
+    free(okm);
+))
+
+// multi-buffer: must match the single-message function, for every available SIMD width
+#define HELPER_MANY(LHASH,UHASH) (                                             \
+    static const unsigned int accels[] = {                                     \
+        TCHASH_ACCEL_ALL,                                                      \
+        ~(TCHASH_ACCEL_X86_SHA | TCHASH_ACCEL_ARM_SHA2 | TCHASH_ACCEL_X86_AVX512),\
+        ~(TCHASH_ACCEL_X86_SHA | TCHASH_ACCEL_ARM_SHA2 | TCHASH_ACCEL_X86_AVX512 | TCHASH_ACCEL_X86_AVX2),\
+        TCHASH_ACCEL_NONE,                                                     \
+    };                                                                         \
+    enum { NMSG = 333, MAXLEN = 521 };                                         \
+    unsigned char* data = malloc(NMSG * MAXLEN);                               \
+    unsigned char (*results)[TCHASH_##UHASH##_DIGEST_SIZE] = malloc(NMSG * TCHASH_##UHASH##_DIGEST_SIZE);\
+    void* digests[NMSG];                                                       \
+    const void* datas[NMSG];                                                   \
+    size_t lens[NMSG];                                                         \
+    ASSERT_NOTNULL(data);                                                      \
+    ASSERT_NOTNULL(results);                                                   \
+                                                                               \
+    uint32_t seed = 1;                                                         \
+    size_t i, a;                                                               \
+    for(i = 0; i < NMSG * MAXLEN; i++)                                         \
+    {                                                                          \
+        seed = seed * 1103515245 + 12345;                                      \
+        data[i] = seed >> 16;                                                  \
+    }                                                                          \
+    for(i = 0; i < NMSG; i++)                                                  \
+    {                                                                          \
+        /* every length around the block boundaries, then a mix */             \
+        lens[i] = i < 2 * TCHASH_##UHASH##_BLOCK_SIZE + 8 ? i : (i * 37) % MAXLEN;\
+        datas[i] = data + i * MAXLEN;                                          \
+        digests[i] = results[i];                                               \
+    }                                                                          \
+                                                                               \
+    for(a = 0; a < sizeof(accels) / sizeof(*accels); a++)                      \
+    {                                                                          \
+        tchash_accel_set(accels[a]);                                           \
+        memset(results, 0, NMSG * TCHASH_##UHASH##_DIGEST_SIZE);               \
+        tchash_##LHASH##_many(digests, datas, lens, NMSG);                     \
+        for(i = 0; i < NMSG; i++)                                              \
+        {                                                                      \
+            unsigned char expected[TCHASH_##UHASH##_DIGEST_SIZE];              \
+            tchash_##LHASH(expected, datas[i], lens[i]);                       \
+            ASSERT_MEMEQ(results[i], sizeof(results[i]), expected, sizeof(expected));\
+        }                                                                      \
+    }                                                                          \
+    tchash_accel_set(TCHASH_ACCEL_ALL);                                        \
+                                                                               \
+    free(results);                                                             \
+    free(data); )
+
+TEST(MD5_Many,HELPER_MANY(md5,MD5))
+TEST(SHA2_256_Many,HELPER_MANY(sha2_256,SHA2_256))
+TEST(SHA3_256_Many,HELPER_MANY(sha3_256,SHA3_256))
+
 int main(void)
 {
     TESTS_BEGIN();
@@ -749,6 +1227,19 @@ int main(void)
         TEST_EXEC(SHA2_512_256_ShortMsg);
         TEST_EXEC(SHA2_512_256_LongMsg);
         TEST_EXEC(SHA2_512_256_MonteCarlo);
+    TEST_HEADER("SHA-1/SHA-2 (portable)");
+        // same vectors, with hardware acceleration (if any) disabled
+        tchash_accel_set(TCHASH_ACCEL_NONE);
+        TEST_EXEC(SHA1_ShortMsg);
+        TEST_EXEC(SHA1_LongMsg);
+        TEST_EXEC(SHA1_MonteCarlo);
+        TEST_EXEC(SHA2_256_ShortMsg);
+        TEST_EXEC(SHA2_256_LongMsg);
+        TEST_EXEC(SHA2_256_MonteCarlo);
+        TEST_EXEC(SHA2_224_ShortMsg);
+        TEST_EXEC(SHA2_224_LongMsg);
+        TEST_EXEC(SHA2_224_MonteCarlo);
+        tchash_accel_set(TCHASH_ACCEL_ALL);
     TEST_HEADER("SHA-3");
         TEST_EXEC(SHA3_224_ShortMsg);
         TEST_EXEC(SHA3_224_LongMsg);
@@ -771,6 +1262,57 @@ int main(void)
         TEST_EXEC(SHAKE256_LongMsg);
         TEST_EXEC(SHAKE256_VariableOut);
         TEST_EXEC(SHAKE256_MonteCarlo);
+    TEST_HEADER("SHA-3/SHAKE (4-way)");
+        {
+            // AVX2 (4 lanes), SSE2/NEON (2 lanes), and portable
+            static const unsigned int accels[] = { TCHASH_ACCEL_ALL, ~TCHASH_ACCEL_X86_AVX2, TCHASH_ACCEL_NONE };
+            volatile size_t a; // (volatile, as it lives across the `setjmp()` in `TEST_EXEC`)
+            for(a = 0; a < sizeof(accels) / sizeof(*accels); a++)
+            {
+                tchash_accel_set(accels[a]);
+                TEST_EXEC(SHA3_256_X4_ShortMsg);
+                TEST_EXEC(SHA3_256_X4_LongMsg);
+                TEST_EXEC(SHAKE128_X4_ShortMsg);
+                TEST_EXEC(SHAKE128_X4_LongMsg);
+                TEST_EXEC(SHAKE128_X4_VariableOut);
+            }
+            tchash_accel_set(TCHASH_ACCEL_ALL);
+        }
+    TEST_HEADER("BLAKE2");
+        TEST_EXEC(BLAKE2b);
+        TEST_EXEC(BLAKE2b_Keyed);
+        TEST_EXEC(BLAKE2s);
+        TEST_EXEC(BLAKE2s_Keyed);
+    TEST_HEADER("BLAKE3");
+        TEST_EXEC(BLAKE3);
+        TEST_EXEC(BLAKE3_Tree);
+        TEST_EXEC(BLAKE3_XOF);
+        TEST_EXEC(BLAKE3_MT);
+    TEST_HEADER("HMAC");
+        TEST_EXEC(HMAC_SHA1);
+        TEST_EXEC(HMAC_SHA2_224);
+        TEST_EXEC(HMAC_SHA2_256);
+        TEST_EXEC(HMAC_SHA2_384);
+        TEST_EXEC(HMAC_SHA2_512);
+        TEST_EXEC(HMAC_MD5);
+        TEST_EXEC(HMAC_RIPEMD160);
+        TEST_EXEC(HMAC_SHA2_512_224);
+        TEST_EXEC(HMAC_SHA2_512_256);
+        TEST_EXEC(HMAC_SHA3_224);
+        TEST_EXEC(HMAC_SHA3_256);
+        TEST_EXEC(HMAC_SHA3_384);
+        TEST_EXEC(HMAC_SHA3_512);
+        TEST_EXEC(HMAC_BLAKE2b);
+        TEST_EXEC(HMAC_BLAKE2s);
+    TEST_HEADER("HKDF");
+        TEST_EXEC(HKDF_SHA2_256);
+        TEST_EXEC(HKDF_SHA2_256_NoSalt);
+        TEST_EXEC(HKDF_SHA1);
+        TEST_EXEC(HKDF_Limits);
+    TEST_HEADER("Multi-buffer");
+        TEST_EXEC(MD5_Many);
+        TEST_EXEC(SHA2_256_Many);
+        TEST_EXEC(SHA3_256_Many);
 
     TESTS_END();
 
@@ -0,0 +1,363 @@
+/* (counted, to check that strings only reallocate a logarithmic number of times) */
+#include <stdlib.h>
+static size_t nallocs;
+static void* count_malloc(size_t size)
+{
+    nallocs++;
+    return malloc(size);
+}
+static void* count_realloc(void* ptr, size_t size)
+{
+    nallocs++;
+    return realloc(ptr, size);
+}
+#define TC_MALLOC(size)         count_malloc(size)
+#define TC_REALLOC(ptr,size)    count_realloc(ptr, size)
+
+#define TC_STRING_IMPLEMENTATION
+#define TC_HISTORY_IMPLEMENTATION
+#include "../tc_string.h"
+#include "../tc_history.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "test.h"
+
+static uint32_t rng_state = 1;
+static uint32_t rng(void)
+{
+    rng_state = rng_state * 1664525u + 1013904223u;
+    return rng_state >> 8;
+}
+
+/* ASCII, and 2-, 3- & 4-byte characters */
+static const char* const pieces[] = { "a", "b", " ", "xyz", "\xC3\xB6", "\xE6\x97\xA5", "\xF0\x9F\x98\x80", "q\xC3\xB6\xE6\x97\xA5", "\xF0\x9F\x98\x80z" };
+#define NPIECES (sizeof(pieces) / sizeof(*pieces))
+
+/* the same definition of a character boundary as the library's: anything but a continuation byte */
+static bool is_sync(char c)
+{
+    return ((unsigned char)c & 0xC0) != 0x80;
+}
+static size_t ref_find_char(const char* ptr, size_t len, size_t off)
+{
+    size_t i, chr = 0;
+    if(off > len) off = len;
+    for(i = 0; i < off; i++)
+        chr += is_sync(ptr[i]);
+    return chr;
+}
+static size_t ref_find_offset(const char* ptr, size_t len, size_t chr)
+{
+    size_t off;
+    for(off = 0; off < len; off++)
+        if(is_sync(ptr[off]) && !chr--)
+            break;
+    return off;
+}
+/* look up random characters & offsets (in a random order, so that the cache is used in both directions) */
+static int check_utf8(const TC_String* str, size_t nlookups)
+{
+    size_t nchars = ref_find_char(str->ptr, str->len, str->len), i;
+    for(i = 0; i < nlookups; i++)
+    {
+        size_t chr = rng() % (nchars + 2);
+        size_t off = tcstr_utf8_find_offset(str, chr);
+        if(off != ref_find_offset(str->ptr, str->len, chr))
+            return 0;
+        if(tcstr_utf8_find_char(str, off) != (chr < nchars ? chr : nchars))
+            return 0;
+        off = rng() % (str->len + 2);
+        if(tcstr_utf8_find_char(str, off) != ref_find_char(str->ptr, str->len, off))
+            return 0;
+    }
+    return 1;
+}
+
+TEST(String_SSO,(
+    TC_String a, b;
+    ASSERT_NOTNULL(tcstr_inits(&a, "short", -1));
+    ASSERT_TRUE(a.ptr == a._sso);
+    ASSERT_STREQ(a.ptr, "short");
+
+    /* moving an inline string points it at the new structure */
+    ASSERT_TRUE(tcstr_move(&b, &a) == &b);
+    ASSERT_TRUE(b.ptr == b._sso);
+    ASSERT_STREQ(b.ptr, "short");
+    ASSERT_NULL(a.ptr);
+
+    /* it stays inline up to `TCSTR_SSO_SIZE-1` bytes, and then moves to the heap (a moved heap string isn't copied) */
+    char buf[TCSTR_SSO_SIZE + 1];
+    memset(buf, 'x', sizeof(buf));
+    ASSERT_NOTNULL(tcstr_reinits(&b, buf, TCSTR_SSO_SIZE - 1));
+    ASSERT_TRUE(b.ptr == b._sso);
+    ASSERT_NOTNULL(tcstr_splices(&b, 0, 0, "y", 1));
+    ASSERT_TRUE(b.ptr != b._sso);
+    ASSERT_EQ(b.len, TCSTR_SSO_SIZE);
+    ASSERT_EQ(b.ptr[0], 'y');
+    ASSERT_EQ(b.ptr[b.len], 0);
+    char* heap = b.ptr;
+    tcstr_move(&a, &b);
+    ASSERT_TRUE(a.ptr == heap);
+
+    /* ... and back, once it's short again */
+    ASSERT_NOTNULL(tcstr_reinits(&a, "ok", 2));
+    ASSERT_TRUE(a.ptr == a._sso);
+    ASSERT_STREQ(a.ptr, "ok");
+    tcstr_deinit(&a);
+    tcstr_deinit(&b);
+))
+TEST(String_Growth,(
+    TC_String str;
+    size_t i;
+    tcstr_inits(&str, "", 0);
+    nallocs = 0;
+    for(i = 0; i < 100000; i++)
+        ASSERT_NOTNULL(tcstr_splices(&str, str.len, 0, "\xC3\xB6", 2));
+    ASSERT_EQ(str.len, 200000);
+    ASSERT_LT(nallocs, 40);
+
+    /* a reservation is enough for everything up to it */
+    tcstr_reinits(&str, "", 0);
+    ASSERT_NOTNULL(tcstr_reserve(&str, 10000));
+    nallocs = 0;
+    for(i = 0; i < 10000; i++)
+        tcstr_splices(&str, str.len, 0, "z", 1);
+    ASSERT_EQ(nallocs, 0);
+    tcstr_deinit(&str);
+))
+TEST(String_Splice_Random,(
+    static char model[8192];
+    size_t len = 0, i;
+    TC_String str;
+    tcstr_init(&str, NULL);
+    rng_state = 1;
+    for(i = 0; i < 20000; i++)
+    {
+        size_t pos = len ? rng() % (len + 1) : 0, del = rng() % 8;
+        const char* piece = pieces[rng() % NPIECES];
+        size_t plen = rng() % 4 ? strlen(piece) : 0;
+        if(pos + del > len) del = len - pos;
+        if(len - del + plen >= sizeof(model)) { plen = 0; del = len - pos; }
+
+        memmove(model + pos + plen, model + pos + del, len - pos - del);
+        memcpy(model + pos, piece, plen);
+        len += plen - del;
+        ASSERT_NOTNULL(tcstr_splices(&str, pos, del, piece, plen));
+        ASSERT_MEMEQ(str.ptr, str.len, model, len);
+        ASSERT_EQ(str.ptr[str.len], 0);
+        /* (spliced strings keep the cache valid, without an explicit `tcstr_invalidate()`) */
+        if(!(i % 4))
+            ASSERT_TRUE(check_utf8(&str, 4));
+    }
+    tcstr_deinit(&str);
+))
+
+/*
+ * A model of the history: an array of entries (oldest first; the last is the line being entered), each either unedited, or with
+ * an edited copy of its original. The cursor is a byte offset.
+ */
+#define MAXLEN      6
+#define LINE_MAX_   2048
+typedef struct Line
+{
+    size_t len;
+    char ptr[LINE_MAX_];
+} Line;
+typedef struct Model
+{
+    struct { Line orig, edit; bool edited; } entries[MAXLEN];
+    size_t nentries, v, c;
+} Model;
+
+static Line* model_line(Model* m)
+{
+    return m->entries[m->v].edited ? &m->entries[m->v].edit : &m->entries[m->v].orig;
+}
+static Line* model_edit(Model* m)
+{
+    if(!m->entries[m->v].edited)
+    {
+        m->entries[m->v].edit = m->entries[m->v].orig;
+        m->entries[m->v].edited = true;
+    }
+    return &m->entries[m->v].edit;
+}
+static size_t model_next(const Line* line, size_t c)
+{
+    if(c >= line->len) return c;
+    do c++;
+    while(c < line->len && !is_sync(line->ptr[c]));
+    return c;
+}
+static size_t model_prev(const Line* line, size_t c)
+{
+    if(!c) return c;
+    do c--;
+    while(c && !is_sync(line->ptr[c]));
+    return c;
+}
+static void model_splice(Line* line, size_t pos, size_t del, const char* str, size_t len)
+{
+    memmove(line->ptr + pos + len, line->ptr + pos + del, line->len - pos - del);
+    memcpy(line->ptr + pos, str, len);
+    line->len += len - del;
+}
+
+static int check_history(TC_History* hist, Model* m)
+{
+    const Line* line = model_line(m);
+    const char *head, *tail;
+    size_t headlen, taillen;
+    tchist_get_parts(hist, &head, &headlen, &tail, &taillen);
+    return tchist_get_hpos(hist) == m->c
+        && headlen == m->c && !memcmp(head, line->ptr, headlen)
+        && taillen == line->len - m->c && !memcmp(tail, line->ptr + m->c, taillen);
+}
+
+TEST(History_Random,(
+    static Model m;
+    TC_History hist;
+    Line* line;
+    size_t i, j;
+    int n;
+    char buf[64];
+
+    memset(&m, 0, sizeof(m));
+    m.nentries = 1;
+    tchist_init(&hist, MAXLEN);
+    rng_state = 3;
+    for(i = 0; i < 100000; i++)
+    {
+        uint32_t op = rng() % 100;
+        if(op < 45)
+        {
+            /* insert or (sometimes) overwrite; overwriting replaces bytes, not characters */
+            bool insert = op < 40;
+            size_t len = 0;
+            for(j = rng() % 3 + 1; j; j--)
+            {
+                const char* piece = pieces[rng() % NPIECES];
+                memcpy(buf + len, piece, strlen(piece));
+                len += strlen(piece);
+            }
+            line = model_line(&m);
+            if(line->len + len > LINE_MAX_)
+                continue;
+            line = model_edit(&m);
+            size_t del = insert ? 0 : line->len - m.c < len ? line->len - m.c : len;
+            model_splice(line, m.c, del, buf, len);
+            m.c += len;
+            tchist_str_input(&hist, buf, len, insert);
+        }
+        else if(op < 65)
+        {
+            /* delete or backspace */
+            n = rng() % 3 + 1;
+            line = model_edit(&m);
+            for(j = 0; j < (size_t)n; j++)
+            {
+                if(op < 55)
+                    model_splice(line, m.c, model_next(line, m.c) - m.c, NULL, 0);
+                else
+                {
+                    size_t p = model_prev(line, m.c);
+                    model_splice(line, p, m.c - p, NULL, 0);
+                    m.c = p;
+                }
+            }
+            tchist_str_delete(&hist, op < 55 ? n : -n);
+        }
+        else if(op < 80)
+        {
+            n = rng() % 11 - 5;
+            line = model_line(&m);
+            for(j = 0; j < (size_t)(n < 0 ? -n : n); j++)
+                m.c = n < 0 ? model_prev(line, m.c) : model_next(line, m.c);
+            tchist_cmd_hmove(&hist, n);
+        }
+        else if(op < 84)
+        {
+            n = rng() % 2 ? +1 : -1;
+            m.c = n > 0 ? model_line(&m)->len : 0;
+            tchist_cmd_hmove_full(&hist, n);
+        }
+        else if(op < 88)
+        {
+            n = rng() % 5 - 2;
+            if(op < 87)
+                m.v = (int)m.v + n < 0 ? 0 : (int)m.v + n >= (int)m.nentries ? m.nentries - 1 : m.v + n;
+            else
+                m.v = n > 0 ? m.nentries - 1 : n < 0 ? 0 : m.v;
+            m.c = model_line(&m)->len;
+            if(op < 87)
+                tchist_cmd_vmove(&hist, n);
+            else
+                tchist_cmd_vmove_full(&hist, n);
+        }
+        else if(op < 89)
+        {
+            line = model_edit(&m);
+            line->len = 0;
+            m.c = 0;
+            tchist_str_clear(&hist);
+        }
+        else if(op < 91)
+        {
+            /* an empty line reverts its entry; anything else becomes the newest entry (and the edited entry reverts) */
+            Line exec = *model_line(&m);
+            TC_String* str = tchist_exec(&hist);
+            ASSERT_MEMEQ(str->ptr, str->len, exec.ptr, exec.len);
+            if(!exec.len)
+                m.entries[m.v].edited = false;
+            else
+            {
+                m.entries[m.v].edited = false;
+                m.entries[m.nentries - 1].orig = exec;
+                m.entries[m.nentries - 1].edited = false;
+                if(m.nentries == MAXLEN)
+                    memmove(&m.entries[0], &m.entries[1], --m.nentries * sizeof(*m.entries));
+                m.entries[m.nentries].orig.len = 0;
+                m.entries[m.nentries].edited = false;
+                m.nentries++;
+            }
+            /* (as `tcedit_readline()` does for each line) */
+            m.v = m.nentries - 1;
+            m.c = model_line(&m)->len;
+            tchist_cmd_vmove_full(&hist, +1);
+        }
+        else
+        {
+            /* closing the gap gives the same string, and the lookup cache has to survive all of the edits in between */
+            line = model_line(&m);
+            TC_String* str = tchist_get_string(&hist);
+            ASSERT_MEMEQ(str->ptr ? str->ptr : "", str->len, line->ptr, line->len);
+            if(str->ptr)
+            {
+                ASSERT_EQ(str->ptr[str->len], 0);
+                ASSERT_TRUE(check_utf8(str, 8));
+            }
+        }
+        if(!check_history(&hist, &m))
+            fprintf(stderr, "    step %u (operation %u)\n", (unsigned int)i, (unsigned int)op);
+        ASSERT_TRUE(check_history(&hist, &m));
+    }
+    tchist_deinit(&hist);
+))
+
+int main(void)
+{
+    TESTS_BEGIN();
+
+    TEST_HEADER("String");
+        TEST_EXEC(String_SSO);
+        TEST_EXEC(String_Growth);
+        TEST_EXEC(String_Splice_Random);
+    TEST_HEADER("History");
+        TEST_EXEC(History_Random);
+
+    TESTS_END();
+}
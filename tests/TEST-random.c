@@ -177,6 +177,338 @@ void TEST_mt19937_64(void)
     tcrand_deinit(&rgen);
 }
 
+void TEST_pcg_xsh_rr(void)
+{
+    /* pcg32-demo, seeded with (42, 54) */
+    static const uint32_t expected_vals[] = {
+        UINT32_C(0xA15C02B7),UINT32_C(0x7B47F409),UINT32_C(0xBA1D3330),UINT32_C(0x83D2F293),
+        UINT32_C(0xBFA4784B),UINT32_C(0xCBED606E),
+    };
+    static const uint64_t seed[] = { 42, 54 };
+    TC_RandGen rgen;
+
+    tcrand_init_pcg_xsh_rr(&rgen);
+    tcrand_seed_raw(&rgen, (const uint32_t*)seed);
+
+    size_t i;
+    for(i = 0; i < sizeof(expected_vals) / sizeof(*expected_vals); i++)
+    {
+        uint32_t v;
+        tcrand_next_raw(&rgen, &v);
+        assert(v == expected_vals[i]);
+    }
+    tcrand_deinit(&rgen);
+
+    TC_RandPCG32 g;
+    uint32_t vals[sizeof(expected_vals) / sizeof(*expected_vals)];
+    tcrand_pcg32_seed(&g, 42, 54);
+    tcrand_pcg32_fill_u32(&g, vals, sizeof(vals) / sizeof(*vals));
+    for(i = 0; i < sizeof(expected_vals) / sizeof(*expected_vals); i++)
+        assert(vals[i] == expected_vals[i]);
+}
+
+void TEST_fill_raw(void)
+{
+    TC_RandGen rgen, cgen;
+    uint32_t vals32[1000];
+    uint64_t vals64[1000];
+    size_t i;
+
+    tcrand_init_mt19937(&rgen);
+    tcrand_seed_raw(&rgen, tcrand_mt19937_default_seed);
+    tcrand_clone(&cgen, &rgen);
+    tcrand_fill_raw(&rgen, vals32, sizeof(vals32) / sizeof(*vals32));
+    for(i = 0; i < sizeof(vals32) / sizeof(*vals32); i++)
+    {
+        uint32_t v;
+        tcrand_next_raw(&cgen, &v);
+        assert(v == vals32[i]);
+    }
+    tcrand_deinit(&cgen);
+    tcrand_deinit(&rgen);
+
+    TC_RandXoroshiro128Plus g;
+    tcrand_xoroshiro128plus_seed(&g, 1234);
+    tcrand_init_xoroshiro128plus(&rgen);
+    tcrand_seed_raw(&rgen, (const uint32_t*)g.state);
+    tcrand_fill_raw(&rgen, vals64, sizeof(vals64) / sizeof(*vals64));
+    for(i = 0; i < sizeof(vals64) / sizeof(*vals64); i++)
+        assert(tcrand_xoroshiro128plus_next(&g) == vals64[i]);
+    tcrand_deinit(&rgen);
+}
+
+void TEST_fill_lanes(void)
+{
+    TC_RandXoroshiro128PlusX4 gx4;
+    TC_RandXoroshiro128Plus g;
+    TC_RandPCG32X8 pcgx8;
+    TC_RandPCG32 pcg;
+    uint64_t vals64[4 * 25 + 3];
+    uint32_t vals32[8 * 25 + 5];
+    size_t i;
+
+    tcrand_xoroshiro128plus_x4_seed(&gx4, 99);
+    tcrand_xoroshiro128plus_x4_fill_u64(&gx4, vals64, sizeof(vals64) / sizeof(*vals64));
+    tcrand_xoroshiro128plus_x4_seed(&gx4, 99);
+    g.state[0] = gx4.s0[1];
+    g.state[1] = gx4.s1[1];
+    for(i = 1; i < sizeof(vals64) / sizeof(*vals64); i += 4)
+        assert(tcrand_xoroshiro128plus_next(&g) == vals64[i]);
+
+    tcrand_pcg32_x8_seed(&pcgx8, 42, 7);
+    tcrand_pcg32_x8_fill_u32(&pcgx8, vals32, sizeof(vals32) / sizeof(*vals32));
+    tcrand_pcg32_seed(&pcg, 42, 7 * 8 + 3);
+    for(i = 3; i < sizeof(vals32) / sizeof(*vals32); i += 8)
+        assert(tcrand_pcg32_next(&pcg) == vals32[i]);
+}
+
+void TEST_fill_uniform_normal(void)
+{
+    static float valsf[1001];
+    static double valsd[1001];
+    static uint32_t valsu[1001];
+    TC_RandGen rgen;
+    size_t i;
+
+    tcrand_init_splitmix64(&rgen);
+    tcrand_seed_u32(&rgen, 5);
+
+    tcrand_fill_u32(&rgen, valsu, 1001, 10, 16);
+    for(i = 0; i < 1001; i++)
+        assert(10 <= valsu[i] && valsu[i] <= 16);
+
+    tcrand_fill_uniform_f_oo(&rgen, valsf, 1001, 0.0f, 1.0f);
+    for(i = 0; i < 1001; i++)
+        assert(0.0f < valsf[i] && valsf[i] < 1.0f);
+    tcrand_fill_uniform_d_co(&rgen, valsd, 1001, -2.0, 2.0);
+    for(i = 0; i < 1001; i++)
+        assert(-2.0 <= valsd[i] && valsd[i] < 2.0);
+    tcrand_fill_uniform_d_oc(&rgen, valsd, 1001, 0.0, 1.0);
+    for(i = 0; i < 1001; i++)
+        assert(0.0 < valsd[i] && valsd[i] <= 1.0);
+
+    double sum = 0.0, sum2 = 0.0;
+    tcrand_fill_normal_d(&rgen, valsd, 1001, 3.0, 2.0);
+    for(i = 0; i < 1001; i++)
+    {
+        sum += valsd[i];
+        sum2 += valsd[i] * valsd[i];
+    }
+    double mean = sum / 1001;
+    double var = sum2 / 1001 - mean * mean;
+    assert(2.6 < mean && mean < 3.4);
+    assert(3.2 < var && var < 4.8);
+
+    tcrand_deinit(&rgen);
+}
+
+void TEST_xoroshiro128plus_jump(void)
+{
+    static const uint64_t expected_jump[] = {
+        UINT64_C(16207791888676488095),UINT64_C(3143017713353449133),UINT64_C(16165527609494048453),UINT64_C(3835027756214388936),
+    };
+    static const uint64_t expected_long_jump[] = {
+        UINT64_C(1063673068199174443),UINT64_C(15347773331662976996),UINT64_C(14007979962628966284),UINT64_C(16998408099005842758),
+    };
+    TC_RandXoroshiro128Plus g;
+    TC_RandGen rgen;
+    size_t i;
+
+    tcrand_xoroshiro128plus_seed(&g, 1);
+    tcrand_init_xoroshiro128plus(&rgen);
+    tcrand_seed_raw(&rgen, (const uint32_t*)g.state);
+
+    tcrand_xoroshiro128plus_jump(&g);
+    assert(tcrand_jump(&rgen));
+    for(i = 0; i < sizeof(expected_jump) / sizeof(*expected_jump); i++)
+    {
+        uint64_t v;
+        tcrand_next_raw(&rgen, &v);
+        assert(v == expected_jump[i]);
+        assert(tcrand_xoroshiro128plus_next(&g) == expected_jump[i]);
+    }
+    tcrand_deinit(&rgen);
+
+    tcrand_xoroshiro128plus_seed(&g, 1);
+    tcrand_xoroshiro128plus_long_jump(&g);
+    for(i = 0; i < sizeof(expected_long_jump) / sizeof(*expected_long_jump); i++)
+        assert(tcrand_xoroshiro128plus_next(&g) == expected_long_jump[i]);
+}
+void TEST_mt19937_jump(void)
+{
+    static const uint32_t expected_jump[] = {
+        UINT32_C(2170487254),UINT32_C(3928228602),UINT32_C(1921267510),UINT32_C(2322844418),
+        UINT32_C(1014264064),UINT32_C(1554540097),UINT32_C(1573508303),UINT32_C(1382815914),
+    };
+    static const uint32_t expected_long_jump[] = {
+        UINT32_C(75724735),UINT32_C(1931792014),UINT32_C(2865015883),UINT32_C(1965580223),
+        UINT32_C(818994957),UINT32_C(2808010557),UINT32_C(3457768182),UINT32_C(3121647611),
+    };
+    TC_RandGen rgen, cgen;
+    size_t i;
+
+    tcrand_init_mt19937(&rgen);
+    tcrand_seed_raw(&rgen, tcrand_mt19937_default_seed);
+    assert(tcrand_jump(&rgen));
+    for(i = 0; i < sizeof(expected_jump) / sizeof(*expected_jump); i++)
+    {
+        uint32_t v;
+        tcrand_next_raw(&rgen, &v);
+        assert(v == expected_jump[i]);
+    }
+    tcrand_seed_raw(&rgen, tcrand_mt19937_default_seed);
+    assert(tcrand_long_jump(&rgen));
+    for(i = 0; i < sizeof(expected_long_jump) / sizeof(*expected_long_jump); i++)
+    {
+        uint32_t v;
+        tcrand_next_raw(&rgen, &v);
+        assert(v == expected_long_jump[i]);
+    }
+
+    /* a jump polynomial of x^1000 must match 1000 steps, from mid-block */
+    static uint32_t poly[624];
+    poly[1000 / 32] = UINT32_C(1) << (1000 % 32);
+    for(i = 0; i < 700; i++)
+    {
+        uint32_t v;
+        tcrand_next_raw(&rgen, &v);
+    }
+    tcrand_clone(&cgen, &rgen);
+    tcrand_i_mt19937_jump_by(TC__VOID_CAST(struct TC_I_RandGen_MTData*,rgen.data), poly);
+    for(i = 0; i < 1000; i++)
+    {
+        uint32_t v;
+        tcrand_next_raw(&cgen, &v);
+    }
+    for(i = 0; i < 1000; i++)
+    {
+        uint32_t v, w;
+        tcrand_next_raw(&rgen, &v);
+        tcrand_next_raw(&cgen, &w);
+        assert(v == w);
+    }
+    tcrand_deinit(&cgen);
+    tcrand_deinit(&rgen);
+}
+
+void TEST_h_advance(TC_RandGen* rgen, size_t delta)
+{
+    TC_RandGen cgen;
+    uint64_t v = 0, w = 0;
+    size_t i;
+
+    tcrand_next_raw(rgen, &v);
+    tcrand_clone(&cgen, rgen);
+    assert(tcrand_advance(rgen, delta));
+    for(i = 0; i < delta; i++)
+        tcrand_next_raw(&cgen, &w);
+    for(i = 0; i < 10; i++)
+    {
+        tcrand_next_raw(rgen, &v);
+        tcrand_next_raw(&cgen, &w);
+        assert(v == w);
+    }
+    tcrand_deinit(&cgen);
+}
+void TEST_advance(void)
+{
+    static const uint32_t seed_lcg64[] = { 7, 0 };
+    static const uint32_t seed_pcg[] = { 42, 0, 54, 0 };
+    static const uint32_t seed_key[] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+    TC_RandGen rgen;
+
+    tcrand_init_minstd(&rgen);
+    tcrand_seed_raw(&rgen, tcrand_minstd_default_seed);
+    TEST_h_advance(&rgen, 12345);
+    assert(!tcrand_jump(&rgen));
+    tcrand_deinit(&rgen);
+
+    tcrand_init_lcg64(&rgen, 48271, 0, UINT64_C(0x7FFFFFFF));
+    tcrand_seed_raw(&rgen, seed_lcg64);
+    TEST_h_advance(&rgen, 777);
+    tcrand_deinit(&rgen);
+
+    tcrand_init_pcg_xsh_rr(&rgen);
+    tcrand_seed_raw(&rgen, seed_pcg);
+    TEST_h_advance(&rgen, 10001);
+    tcrand_deinit(&rgen);
+
+    tcrand_init_splitmix64(&rgen);
+    tcrand_seed_u32(&rgen, 3);
+    TEST_h_advance(&rgen, 99);
+    tcrand_deinit(&rgen);
+
+    tcrand_init_philox4x32(&rgen);
+    tcrand_seed_raw(&rgen, seed_key);
+    TEST_h_advance(&rgen, 1001);
+    tcrand_deinit(&rgen);
+
+    tcrand_init_threefry4x64(&rgen);
+    tcrand_seed_raw(&rgen, seed_key);
+    TEST_h_advance(&rgen, 33);
+    tcrand_deinit(&rgen);
+
+    tcrand_init_mt19937_64(&rgen);
+    assert(!tcrand_advance(&rgen, 1));
+    assert(!tcrand_jump(&rgen));
+    tcrand_deinit(&rgen);
+}
+
+void TEST_philox4x32(void)
+{
+    /* Random123 known-answer tests */
+    static const uint32_t ctr[3][4] = {
+        { 0, 0, 0, 0 },
+        { UINT32_C(0xFFFFFFFF), UINT32_C(0xFFFFFFFF), UINT32_C(0xFFFFFFFF), UINT32_C(0xFFFFFFFF) },
+        { UINT32_C(0x243F6A88), UINT32_C(0x85A308D3), UINT32_C(0x13198A2E), UINT32_C(0x03707344) },
+    };
+    static const uint32_t key[3][2] = {
+        { 0, 0 },
+        { UINT32_C(0xFFFFFFFF), UINT32_C(0xFFFFFFFF) },
+        { UINT32_C(0xA4093822), UINT32_C(0x299F31D0) },
+    };
+    static const uint32_t expected[3][4] = {
+        { UINT32_C(0x6627E8D5), UINT32_C(0xE169C58D), UINT32_C(0xBC57AC4C), UINT32_C(0x9B00DBD8) },
+        { UINT32_C(0x408F276D), UINT32_C(0x41C83B0E), UINT32_C(0xA20BC7C6), UINT32_C(0x6D5451FD) },
+        { UINT32_C(0xD16CFE09), UINT32_C(0x94FDCCEB), UINT32_C(0x5001E420), UINT32_C(0x24126EA1) },
+    };
+    size_t i, j;
+    for(i = 0; i < 3; i++)
+    {
+        uint32_t out[4];
+        tcrand_philox4x32_10(out, ctr[i], key[i]);
+        for(j = 0; j < 4; j++)
+            assert(out[j] == expected[i][j]);
+    }
+
+    /* the stream is block-addressable */
+    TC_RandGen rgen;
+    uint32_t vals[4 * 5 + 2];
+    uint32_t blk[4];
+    static const uint32_t bctr[4] = { 3, 0, 0, 0 };
+    tcrand_init_philox4x32(&rgen);
+    tcrand_seed_raw(&rgen, key[2]);
+    tcrand_fill_raw(&rgen, vals, sizeof(vals) / sizeof(*vals));
+    tcrand_philox4x32_10(blk, bctr, key[2]);
+    for(j = 0; j < 4; j++)
+        assert(vals[3 * 4 + j] == blk[j]);
+    tcrand_deinit(&rgen);
+}
+void TEST_threefry4x64(void)
+{
+    /* Random123 known-answer tests */
+    static const uint64_t ctr[4] = { 0, 0, 0, 0 };
+    static const uint64_t key[4] = { 0, 0, 0, 0 };
+    static const uint64_t expected[4] = {
+        UINT64_C(0x09218EBDE6C85537), UINT64_C(0x55941F5266D86105), UINT64_C(0x4BD25E16282434DC), UINT64_C(0xEE29EC846BD2E40B),
+    };
+    uint64_t out[4];
+    size_t j;
+    tcrand_threefry4x64_20(out, ctr, key);
+    for(j = 0; j < 4; j++)
+        assert(out[j] == expected[j]);
+}
+
 #include <float.h>
 int main(void)
 {
@@ -188,6 +520,17 @@ int main(void)
     TEST_minstd();
     TEST_mt19937();
     TEST_mt19937_64();
+    TEST_pcg_xsh_rr();
+
+    TEST_fill_raw();
+    TEST_fill_lanes();
+    TEST_fill_uniform_normal();
+
+    TEST_xoroshiro128plus_jump();
+    TEST_mt19937_jump();
+    TEST_advance();
+    TEST_philox4x32();
+    TEST_threefry4x64();
 
     return 0;
 }
@@ -0,0 +1,191 @@
+#define _GNU_SOURCE /* posix_openpt() & co */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+/* (all output is captured here, one record per `write()` call, instead of going to the terminal) */
+#define MAX_WRITES  64
+static struct
+{
+    int fd;
+    char data[256];
+    size_t len;
+} writes[MAX_WRITES];
+static size_t nwrites;
+static ssize_t capture_write(int fd, const void* buf, size_t len)
+{
+    if(nwrites == MAX_WRITES) return -1;
+    writes[nwrites].fd = fd;
+    writes[nwrites].len = len < sizeof(writes[nwrites].data) ? len : sizeof(writes[nwrites].data);
+    memcpy(writes[nwrites].data, buf, writes[nwrites].len);
+    nwrites++;
+    return len;
+}
+#define write(fd,buf,len)   capture_write(fd, buf, len)
+
+#define TC_STRING_IMPLEMENTATION
+#define TC_TERMINAL_IMPLEMENTATION
+#define TC_HISTORY_IMPLEMENTATION
+#define TC_EDITLINE_IMPLEMENTATION
+#include "../tc_string.h"
+#include "../tc_terminal.h"
+#include "../tc_history.h"
+#include "../tc_editline.h"
+
+#include "test.h"
+
+/* master side of the pseudo-terminal used as stdin, so that the terminal modes can be set */
+static int pty = -1;
+static int open_pty(void)
+{
+    int master = posix_openpt(O_RDWR | O_NOCTTY);
+    if(master < 0) return -1;
+    if(grantpt(master) || unlockpt(master))
+    {
+        close(master);
+        return -1;
+    }
+    int slave = open(ptsname(master), O_RDWR | O_NOCTTY);
+    if(slave < 0 || dup2(slave, STDIN_FILENO) < 0)
+    {
+        close(master);
+        return -1;
+    }
+    close(slave);
+    return master;
+}
+
+#define ASSERT_WRITE(I,FD,STR)  do { ASSERT_EQ(writes[I].fd, FD); ASSERT_MEMEQ(writes[I].data, writes[I].len, STR, sizeof(STR) - 1); } while(0)
+
+TEST(Buffered_Flush,(
+    ASSERT_TRUE(tcterm_init_stdio());
+    /* (colors are only enabled for ttys) */
+    tcterm__ctx.hascol = TCTERM_FG_WHITE | TCTERM_BG_WHITE | TCTERM_FG_INTENSE | TCTERM_BG_INTENSE;
+    ASSERT_TRUE(tcterm_set_buffered(1));
+    nwrites = 0;
+
+    ASSERT_EQ(tcterm_print("abc", 3), 3);
+    ASSERT_TRUE(tcterm_set_cursor_pos(4, 2));
+    ASSERT_TRUE(tcterm_clear_to_eol(TCTERM_STDOUT));
+    ASSERT_EQ(tcterm_printf("%d", 42), 2);
+    ASSERT_EQ(nwrites, 0);
+
+    ASSERT_TRUE(tcterm_flush());
+    ASSERT_EQ(nwrites, 1);
+    ASSERT_WRITE(0, STDOUT_FILENO, "abc\033[3;5H\033[K42");
+
+    /* nothing left to write */
+    ASSERT_TRUE(tcterm_flush());
+    ASSERT_EQ(nwrites, 1);
+
+    /* stderr isn't buffered, but mustn't overtake buffered stdout */
+    ASSERT_EQ(tcterm_print("out", 3), 3);
+    ASSERT_EQ(tcterm_fprint(TCTERM_STDERR, "err", 3), 3);
+    ASSERT_EQ(nwrites, 3);
+    ASSERT_WRITE(1, STDOUT_FILENO, "out");
+    ASSERT_WRITE(2, STDERR_FILENO, "err");
+
+    ASSERT_TRUE(tcterm_deinit());
+))
+TEST(Buffered_Redundant,(
+    ASSERT_TRUE(tcterm_init_stdio());
+    tcterm__ctx.hascol = TCTERM_FG_WHITE | TCTERM_BG_WHITE | TCTERM_FG_INTENSE | TCTERM_BG_INTENSE;
+    ASSERT_TRUE(tcterm_set_buffered(1));
+    nwrites = 0;
+
+    /* overriden before any text was printed */
+    ASSERT_TRUE(tcterm_set_attr(TCTERM_FG_RED | TCTERM_BG_DEFAULT));
+    ASSERT_TRUE(tcterm_set_attr(TCTERM_FG_GREEN | TCTERM_BG_DEFAULT));
+    ASSERT_EQ(tcterm_print("a", 1), 1);
+    /* no change */
+    ASSERT_TRUE(tcterm_set_attr(TCTERM_FG_GREEN | TCTERM_BG_DEFAULT));
+    ASSERT_EQ(tcterm_print("b", 1), 1);
+    ASSERT_TRUE(tcterm_set_attr(TCTERM_FG_BLUE | TCTERM_BG_RED));
+    ASSERT_EQ(tcterm_print("c", 1), 1);
+    ASSERT_TRUE(tcterm_set_attr_default());
+
+    /* overriden */
+    ASSERT_TRUE(tcterm_set_cursor_pos(0, 0));
+    ASSERT_TRUE(tcterm_set_cursor_pos(7, 3));
+    ASSERT_EQ(tcterm_print("d", 1), 1);
+    /* no move, as far as we know */
+    ASSERT_TRUE(tcterm_set_cursor_pos(9, 9));
+    ASSERT_TRUE(tcterm_clear_to_eol(TCTERM_STDOUT));
+    ASSERT_TRUE(tcterm_set_cursor_pos(9, 9));
+    /* unknown after text, so it must be repeated */
+    ASSERT_EQ(tcterm_print("e", 1), 1);
+    ASSERT_TRUE(tcterm_set_cursor_pos(9, 9));
+
+    ASSERT_TRUE(tcterm_flush());
+    ASSERT_EQ(nwrites, 1);
+    ASSERT_WRITE(0, STDOUT_FILENO, "\033[0;32mab\033[0;34;41mc\033[0m\033[4;8Hd\033[10;10H\033[Ke\033[10;10H");
+
+    /* what was already written can't be dropped */
+    ASSERT_TRUE(tcterm_set_attr(TCTERM_FG_RED | TCTERM_BG_DEFAULT));
+    ASSERT_TRUE(tcterm_flush());
+    ASSERT_TRUE(tcterm_set_attr(TCTERM_FG_GREEN | TCTERM_BG_DEFAULT));
+    ASSERT_TRUE(tcterm_flush());
+    ASSERT_EQ(nwrites, 3);
+    ASSERT_WRITE(1, STDOUT_FILENO, "\033[0;31m");
+    ASSERT_WRITE(2, STDOUT_FILENO, "\033[0;32m");
+
+    ASSERT_TRUE(tcterm_deinit());
+))
+TEST(Editline_Redraw,(
+    ASSERT_TRUE(tcedit_attach_stdio(8));
+    nwrites = 0;
+
+    /* the reply to the cursor position query comes first, then the keys: "abc", LEFT, "X", ENTER */
+    static const char input[] = "\033[5;3R" "abc" "\033[D" "X" "\n";
+    /* (the parentheses avoid the capturing macro) */
+    ASSERT_EQ((write)(pty, input, sizeof(input) - 1), (ssize_t)(sizeof(input) - 1));
+
+    TC_String* line = tcedit_readline(NULL, 0, NULL);
+    ASSERT_NOTNULL(line);
+    ASSERT_MEMEQ(line->ptr, line->len, "abXc", 4);
+
+    /* one flush per key, and each only writes what changed */
+    ASSERT_EQ(nwrites, 7);
+    ASSERT_WRITE(0, STDOUT_FILENO, "\033[6n");
+    ASSERT_WRITE(1, STDOUT_FILENO, "\033[Ka\033[5;4H");
+    ASSERT_WRITE(2, STDOUT_FILENO, "\033[Kb\033[5;5H");
+    ASSERT_WRITE(3, STDOUT_FILENO, "\033[Kc\033[5;6H");
+    ASSERT_WRITE(4, STDOUT_FILENO, "\033[5;5H");
+    ASSERT_WRITE(5, STDOUT_FILENO, "\033[KXc\033[5;6H");
+    ASSERT_WRITE(6, STDOUT_FILENO, "\n");
+
+    ASSERT_TRUE(tcedit_detach());
+))
+
+int main()
+{
+    TESTS_BEGIN();
+
+    pty = open_pty();
+
+    TEST_HEADER("Buffered output");
+    if(pty >= 0)
+    {
+        TEST_EXEC(Buffered_Flush);
+        TEST_EXEC(Buffered_Redundant);
+    }
+    else
+    {
+        TEST_SKIP_MSG(Buffered_Flush, "no pseudo-terminal");
+        TEST_SKIP_MSG(Buffered_Redundant, "no pseudo-terminal");
+    }
+
+    TEST_HEADER("Editline");
+    if(pty >= 0)
+        TEST_EXEC(Editline_Redraw);
+    else
+        TEST_SKIP_MSG(Editline_Redraw, "no pseudo-terminal");
+
+    if(pty >= 0)
+        close(pty);
+
+    TESTS_END();
+    return 0;
+}
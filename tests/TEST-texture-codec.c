@@ -0,0 +1,796 @@
+/* for `tctex_decompress_parallel*()` */
+#define TC_THREAD_IMPLEMENTATION
+#include "../tc_thread.h"
+
+/* small bands, so that even the test images get split */
+#define TCTEX_PARALLEL_BAND_BYTES   512
+#define TC_TEXTURE_CODEC_IMPLEMENTATION
+#include "../tc_texture_codec.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "test.h"
+
+/* the odd width exercises both the SIMD tail and the chunking through the temporary buffer */
+#define TEST_W  (4 * 37)
+#define TEST_H  (4 * 2)
+#define TEST_NBLOCKS    ((TEST_W / 4) * (TEST_H / 4))
+
+static const unsigned int accels[] = { TCTEX_ACCEL_ALL, TCTEX_ACCEL_X86_SSE41, TCTEX_ACCEL_X86_F16C, TCTEX_ACCEL_ARM_NEON };
+
+static uint32_t rng_state;
+static uint32_t rng_next(void)
+{
+    rng_state = rng_state * 1664525u + 1013904223u;
+    return rng_state >> 8;
+}
+static void fill_random(uint8_t* blocks, size_t size)
+{
+    size_t i;
+    for(i = 0; i < size; i++)
+        blocks[i] = (uint8_t)rng_next();
+}
+
+typedef enum Format
+{
+    FORMAT_BC1,
+    FORMAT_BC1A,
+    FORMAT_BC1_NOSELECT,
+    FORMAT_BC2,
+    FORMAT_BC3,
+    FORMAT_BC4,
+    FORMAT_BC4S,
+    FORMAT_BC5,
+    FORMAT_BC5S,
+    FORMAT_BC7,
+} Format;
+static const struct
+{
+    size_t bsize;   /* bytes per block */
+    size_t nchan;   /* channels written */
+} formats[] = {
+    { 8, 3},
+    { 8, 4},
+    { 8, 4},
+    {16, 4},
+    {16, 4},
+    { 8, 1},
+    { 8, 1},
+    {16, 2},
+    {16, 2},
+    {16, 4},
+};
+static void decompress(Format format, uint8_t* dst, size_t dstride, const uint8_t* src)
+{
+    size_t dpitch = TEST_W * dstride;
+    switch(format)
+    {
+    case FORMAT_BC1: tctex_decompress_bc1(dst, dstride, dpitch, src, TEST_W, TEST_H, true, false); break;
+    case FORMAT_BC1A: tctex_decompress_bc1(dst, dstride, dpitch, src, TEST_W, TEST_H, true, true); break;
+    case FORMAT_BC1_NOSELECT: tctex_decompress_bc1(dst, dstride, dpitch, src, TEST_W, TEST_H, false, true); break;
+    case FORMAT_BC2: tctex_decompress_bc2(dst, dstride, dpitch, src, TEST_W, TEST_H); break;
+    case FORMAT_BC3: tctex_decompress_bc3(dst, dstride, dpitch, src, TEST_W, TEST_H); break;
+    case FORMAT_BC4: tctex_decompress_bc4(dst, dstride, dpitch, src, TEST_W, TEST_H, false); break;
+    case FORMAT_BC4S: tctex_decompress_bc4(dst, dstride, dpitch, src, TEST_W, TEST_H, true); break;
+    case FORMAT_BC5: tctex_decompress_bc5(dst, dstride, dpitch, src, TEST_W, TEST_H, false); break;
+    case FORMAT_BC5S: tctex_decompress_bc5(dst, dstride, dpitch, src, TEST_W, TEST_H, true); break;
+    case FORMAT_BC7: tctex_decompress_bc7(dst, dstride, dpitch, src, TEST_W, TEST_H); break;
+    }
+}
+
+/* random blocks, with a few degenerate endpoints (to hit the alternate BC1 & BC4 modes) */
+static void make_blocks(Format format, uint8_t* blocks)
+{
+    size_t bsize = formats[format].bsize;
+    size_t i;
+    fill_random(blocks, TEST_NBLOCKS * bsize);
+    for(i = 0; i < TEST_NBLOCKS; i += 5)
+    {
+        uint8_t* block = &blocks[i * bsize];
+        switch(format)
+        {
+        case FORMAT_BC2: case FORMAT_BC3: block += 8; /* fallthrough */
+        case FORMAT_BC1: case FORMAT_BC1A: case FORMAT_BC1_NOSELECT:
+            block[2] = block[0];
+            block[3] = block[1];
+            break;
+        case FORMAT_BC5: case FORMAT_BC5S: block[9] = block[8]; /* fallthrough */
+        case FORMAT_BC4: case FORMAT_BC4S:
+            block[1] = block[0];
+            break;
+        case FORMAT_BC7: break;
+        }
+        if(format == FORMAT_BC3) blocks[i * bsize + 1] = blocks[i * bsize];
+    }
+    /* BC7: force every mode (including an invalid one) */
+    if(format == FORMAT_BC7)
+        for(i = 0; i < TEST_NBLOCKS; i++)
+            blocks[i * 16] = (uint8_t)(((blocks[i * 16] << 1) | 1) << (i % 9));
+}
+
+TEST(Accel_Identical,(
+    uint8_t* blocks = malloc(TEST_NBLOCKS * 16);
+    uint8_t* expected = malloc(TEST_W * TEST_H * 5);
+    uint8_t* actual = malloc(TEST_W * TEST_H * 5);
+    size_t a, f, s, r;
+    rng_state = 12345;
+    for(f = 0; f < sizeof(formats) / sizeof(*formats); f++)
+    {
+        for(r = 0; r < 16; r++)
+        {
+            make_blocks((Format)f, blocks);
+            /* tightly-packed, narrower than a pixel (BC1 without alpha) and padded */
+            size_t strides[] = { formats[f].nchan, 3, 5 };
+            for(s = 0; s < sizeof(strides) / sizeof(*strides); s++)
+            {
+                size_t dstride = strides[s];
+                if(dstride < formats[f].nchan) continue;
+                size_t size = TEST_W * TEST_H * dstride;
+
+                tctex_accel_set(TCTEX_ACCEL_NONE);
+                memset(expected, 0xCD, size);
+                decompress((Format)f, expected, dstride, blocks);
+                for(a = 0; a < sizeof(accels) / sizeof(*accels); a++)
+                {
+                    tctex_accel_set(accels[a]);
+                    memset(actual, 0xCD, size);
+                    decompress((Format)f, actual, dstride, blocks);
+                    ASSERT_MEMEQ(actual, size, expected, size);
+                }
+            }
+        }
+    }
+    tctex_accel_set(TCTEX_ACCEL_ALL);
+    free(actual);
+    free(expected);
+    free(blocks);
+))
+
+/* every pair of BC4 endpoints, for both signed & unsigned */
+TEST(Accel_BC4_Endpoints,(
+    enum { W = 4 * 256, H = 4 * 256 };
+    uint8_t* blocks = malloc((W / 4) * (H / 4) * 8);
+    uint8_t* expected = malloc(W * H);
+    uint8_t* actual = malloc(W * H);
+    size_t a, i;
+    int is_signed;
+    rng_state = 54321;
+    fill_random(blocks, (W / 4) * (H / 4) * 8);
+    for(i = 0; i < (W / 4) * (H / 4); i++)
+    {
+        blocks[i * 8 + 0] = (uint8_t)(i >> 8);
+        blocks[i * 8 + 1] = (uint8_t)i;
+    }
+    for(is_signed = 0; is_signed < 2; is_signed++)
+    {
+        tctex_accel_set(TCTEX_ACCEL_NONE);
+        tctex_decompress_bc4(expected, 1, W, blocks, W, H, is_signed);
+        for(a = 0; a < sizeof(accels) / sizeof(*accels); a++)
+        {
+            tctex_accel_set(accels[a]);
+            memset(actual, 0xCD, W * H);
+            tctex_decompress_bc4(actual, 1, W, blocks, W, H, is_signed);
+            ASSERT_MEMEQ(actual, W * H, expected, W * H);
+        }
+    }
+    tctex_accel_set(TCTEX_ACCEL_ALL);
+    free(actual);
+    free(expected);
+    free(blocks);
+))
+
+/* known values, for the reference decoders */
+TEST(BC1_ThreeColor,(
+    /* c0 = black, c1 = white (c0 <= c1, so 3-color mode); indices: 0,1,2,3 in each row */
+    static const uint8_t block[8] = { 0x00,0x00, 0xFF,0xFF, 0xE4,0xE4,0xE4,0xE4 };
+    static const uint8_t row[16] = { 0,0,0,255, 255,255,255,255, 123,125,123,255, 0,0,0,0 };
+    uint8_t out[4 * 4 * 4];
+    size_t y;
+    tctex_decompress_bc1_block(out, 4, 16, block, true, true);
+    for(y = 0; y < 4; y++)
+        ASSERT_MEMEQ(&out[y * 16], 16, row, 16);
+))
+TEST(BC2_AlphaOrder,(
+    /* the first pixel is in the low nibble */
+    static const uint8_t block[16] = { 0x10,0x32,0x54,0x76, 0x98,0xBA,0xDC,0xFE };
+    uint8_t out[4 * 4 * 4];
+    size_t i;
+    tctex_decompress_bc2(out, 4, 16, block, 4, 4);
+    for(i = 0; i < 16; i++)
+        ASSERT_EQ(out[i * 4 + 3], i * 17);
+))
+TEST(BC4_SignedMode,(
+    /* a0 = -1, a1 = 1: a0 <= a1 (signed), so 6-value mode; index 6 is -128 */
+    static const uint8_t block[8] = { 0xFF,0x01, 0xB6,0x6D,0xDB,0xB6,0x6D,0xDB };
+    uint8_t out[4 * 4];
+    size_t i;
+    tctex_decompress_bc4(out, 1, 4, block, 4, 4, true);
+    for(i = 0; i < 16; i++)
+        ASSERT_EQ(out[i], 0x80);
+))
+TEST(BC7_Invalid,(
+    static const uint8_t block[16] = { 0x00, 0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF, 0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF };
+    static const uint8_t zero[4 * 4 * 4] = {0};
+    uint8_t out[4 * 4 * 4];
+    memset(out, 0xCD, sizeof(out));
+    tctex_decompress_bc7(out, 4, 16, block, 4, 4);
+    ASSERT_MEMEQ(out, sizeof(out), zero, sizeof(zero));
+))
+
+/* parallel decompression */
+#define TEST_NTHREADS   4
+#define TEST_DSTRIDE    8   /* large enough for every format (BC6H is 6) */
+/* a mip chain, down to the sizes that are smaller than a block */
+static const struct { size_t w, h; } test_mips[] = {
+    {4 * 37, 4 * 16}, {4 * 19, 4 * 8}, {4 * 9, 4 * 4}, {4 * 5, 4 * 2}, {8, 4}, {4, 4}, {2, 2}, {1, 1},
+};
+#define TEST_NMIPS  (sizeof(test_mips) / sizeof(*test_mips))
+/* the whole chain takes less than twice the top level */
+#define TEST_MIPS_SRC_SIZE  (2 * 37 * 16 * 16)
+#define TEST_MIPS_DST_SIZE  (2 * 4 * 37 * 4 * 16 * TEST_DSTRIDE)
+
+static size_t codec_block_size(TCTex_CodecFormat format)
+{
+    switch(format)
+    {
+    case TCTEX_CODEC_BC1: case TCTEX_CODEC_BC1_ALPHA:
+    case TCTEX_CODEC_BC4: case TCTEX_CODEC_BC4_SIGNED:
+        return 8;
+    default:
+        return 16;
+    }
+}
+/* sets up `images` with random blocks in `src` (one after another, as with a DDS mip chain), returning the size of the output */
+static size_t make_images(TCTex_DecompressImage* images, uint8_t* src, uint8_t* dst, TCTex_CodecFormat format)
+{
+    size_t i, soffset = 0, doffset = 0;
+    for(i = 0; i < TEST_NMIPS; i++)
+    {
+        size_t bw = (test_mips[i].w + 3) / 4, bh = (test_mips[i].h + 3) / 4;
+        images[i].dst = dst + doffset;
+        images[i].dstride_x = TEST_DSTRIDE;
+        images[i].dpitch_y = 4 * bw * TEST_DSTRIDE;
+        images[i].src = src + soffset;
+        images[i].w = test_mips[i].w;
+        images[i].h = test_mips[i].h;
+        fill_random(src + soffset, bw * bh * codec_block_size(format));
+        soffset += bw * bh * codec_block_size(format);
+        doffset += 4 * bh * images[i].dpitch_y;
+    }
+    return doffset;
+}
+
+TEST(Parallel_Identical,(
+    tcthread_pool_t pool = tcthread_pool_create(TEST_NTHREADS, 0);
+    tcthread_pool_t nopool = {0};
+    TCTex_DecompressImage images[TEST_NMIPS];
+    uint8_t* src = malloc(TEST_MIPS_SRC_SIZE);
+    uint8_t* expected = malloc(TEST_MIPS_DST_SIZE);
+    uint8_t* actual = malloc(TEST_MIPS_DST_SIZE);
+    int f;
+    ASSERT_TRUE(tcthread_pool_is_valid(pool));
+    rng_state = 4321;
+    for(f = TCTEX_CODEC_BC1; f <= TCTEX_CODEC_BC7; f++)
+    {
+        TCTex_CodecFormat format = (TCTex_CodecFormat)f;
+        make_images(images, src, expected, format);
+        size_t size = images[0].h * images[0].dpitch_y;
+
+        memset(expected, 0xCD, size);
+        tctex_decompress(format, expected, images[0].dstride_x, images[0].dpitch_y, src, images[0].w, images[0].h);
+        memset(actual, 0xCD, size);
+        tctex_decompress_parallel(format, actual, images[0].dstride_x, images[0].dpitch_y, src, images[0].w, images[0].h, pool);
+        ASSERT_MEMEQ(actual, size, expected, size);
+        /* no pool: serial */
+        memset(actual, 0xCD, size);
+        tctex_decompress_parallel(format, actual, images[0].dstride_x, images[0].dpitch_y, src, images[0].w, images[0].h, nopool);
+        ASSERT_MEMEQ(actual, size, expected, size);
+    }
+    tcthread_pool_destroy(pool);
+    free(actual);
+    free(expected);
+    free(src);
+))
+TEST(Parallel_Images,(
+    tcthread_pool_t pool = tcthread_pool_create(TEST_NTHREADS, 0);
+    TCTex_DecompressImage images[TEST_NMIPS];
+    uint8_t* src = malloc(TEST_MIPS_SRC_SIZE);
+    uint8_t* expected = malloc(TEST_MIPS_DST_SIZE);
+    uint8_t* actual = malloc(TEST_MIPS_DST_SIZE);
+    size_t i;
+    int f;
+    ASSERT_TRUE(tcthread_pool_is_valid(pool));
+    rng_state = 8765;
+    for(f = TCTEX_CODEC_BC1; f <= TCTEX_CODEC_BC7; f++)
+    {
+        TCTex_CodecFormat format = (TCTex_CodecFormat)f;
+        size_t size = make_images(images, src, expected, format);
+
+        memset(expected, 0xCD, size);
+        for(i = 0; i < TEST_NMIPS; i++)
+            tctex_decompress(format, images[i].dst, images[i].dstride_x, images[i].dpitch_y, images[i].src, images[i].w, images[i].h);
+        /* same layout, but into `actual` */
+        for(i = 0; i < TEST_NMIPS; i++)
+            images[i].dst = actual + (TC__STATIC_CAST(uint8_t*,images[i].dst) - expected);
+        memset(actual, 0xCD, size);
+        tctex_decompress_parallel_images(format, images, TEST_NMIPS, pool);
+        ASSERT_MEMEQ(actual, size, expected, size);
+    }
+    tcthread_pool_destroy(pool);
+    free(actual);
+    free(expected);
+    free(src);
+))
+
+/* encoders */
+static const int qualities[] = { TCTEX_QUALITY_FAST, TCTEX_QUALITY_NORMAL, TCTEX_QUALITY_SLOW };
+
+/* smooth gradients with a little noise, and a hard edge in alpha */
+static void make_image(uint8_t* img)
+{
+    size_t x, y;
+    for(y = 0; y < TEST_H; y++)
+        for(x = 0; x < TEST_W; x++)
+        {
+            uint8_t* p = &img[(y * TEST_W + x) * 4];
+            uint8_t noise = (uint8_t)(rng_next() & 7);
+            p[0] = (uint8_t)(x * 255 / TEST_W + noise);
+            p[1] = (uint8_t)(y * 255 / TEST_H + noise);
+            p[2] = (uint8_t)(255 - x * 127 / TEST_W - noise);
+            p[3] = (uint8_t)(x % 16 < 8 ? 255 : 32 + 3 * y + noise);
+        }
+}
+/* squared error over the first `nchan` channels */
+static uint64_t image_error(const uint8_t* a, const uint8_t* b, size_t stride, size_t nchan)
+{
+    uint64_t err = 0;
+    size_t i, c;
+    for(i = 0; i < TEST_W * TEST_H; i++)
+        for(c = 0; c < nchan; c++)
+        {
+            int d = a[i * stride + c] - b[i * stride + c];
+            err += d * d;
+        }
+    return err;
+}
+static uint32_t image_error_block(const uint8_t* a, const uint8_t* b)
+{
+    uint32_t err = 0;
+    size_t i;
+    for(i = 0; i < 16 * 4; i++)
+        err += (a[i] - b[i]) * (a[i] - b[i]);
+    return err;
+}
+static double image_psnr(uint64_t err, size_t nchan)
+{
+    double mse = (double)err / (TEST_W * TEST_H * nchan);
+    return mse ? 10.0 * log10(255.0 * 255.0 / mse) : 99.0;
+}
+/* returns the error of the round-trip, on the channels that the format keeps */
+static uint64_t roundtrip(Format format, uint8_t* blocks, const uint8_t* img, int quality)
+{
+    uint8_t* out = malloc(TEST_W * TEST_H * 4);
+    size_t pitch = TEST_W * 4;
+    uint64_t err = 0;
+    memcpy(out, img, TEST_W * TEST_H * 4);
+    switch(format)
+    {
+    case FORMAT_BC1: tctex_compress_bc1(blocks, img, 4, pitch, TEST_W, TEST_H, quality, false); break;
+    case FORMAT_BC3: tctex_compress_bc3(blocks, img, 4, pitch, TEST_W, TEST_H, quality); break;
+    case FORMAT_BC4: tctex_compress_bc4(blocks, img, 4, pitch, TEST_W, TEST_H, quality, false); break;
+    case FORMAT_BC5: tctex_compress_bc5(blocks, img, 4, pitch, TEST_W, TEST_H, quality, false); break;
+    case FORMAT_BC7: tctex_compress_bc7(blocks, img, 4, pitch, TEST_W, TEST_H, quality); break;
+    default: break;
+    }
+    decompress(format, out, 4, blocks);
+    err = image_error(out, img, 4, format == FORMAT_BC1 ? 3 : formats[format].nchan);
+    free(out);
+    return err;
+}
+
+static const struct
+{
+    Format format;
+    double min_psnr;
+} encoders[] = {
+    { FORMAT_BC1, 33.0 },
+    { FORMAT_BC3, 34.0 },
+    { FORMAT_BC4, 50.0 },
+    { FORMAT_BC5, 37.0 },
+    { FORMAT_BC7, 36.0 },
+};
+TEST(Encode_Quality,(
+    uint8_t* img = malloc(TEST_W * TEST_H * 4);
+    uint8_t* blocks = malloc(TEST_NBLOCKS * 16);
+    size_t e, q;
+    rng_state = 777;
+    make_image(img);
+    for(e = 0; e < sizeof(encoders) / sizeof(*encoders); e++)
+    {
+        Format format = encoders[e].format;
+        uint64_t prev = UINT64_MAX;
+        for(q = 0; q < sizeof(qualities) / sizeof(*qualities); q++)
+        {
+            uint64_t err = roundtrip(format, blocks, img, qualities[q]);
+            ASSERT_GE(image_psnr(err, formats[format].nchan), encoders[e].min_psnr);
+            /* a higher quality never does worse */
+            ASSERT_LE(err, prev);
+            prev = err;
+        }
+    }
+    free(blocks);
+    free(img);
+))
+TEST(Encode_Accel_Identical,(
+    uint8_t* img = malloc(TEST_W * TEST_H * 4);
+    uint8_t* expected = malloc(TEST_NBLOCKS * 16);
+    uint8_t* actual = malloc(TEST_NBLOCKS * 16);
+    size_t e, q, a;
+    rng_state = 888;
+    make_image(img);
+    for(e = 0; e < sizeof(encoders) / sizeof(*encoders); e++)
+        for(q = 0; q < sizeof(qualities) / sizeof(*qualities); q++)
+        {
+            Format format = encoders[e].format;
+            size_t size = TEST_NBLOCKS * formats[format].bsize;
+            tctex_accel_set(TCTEX_ACCEL_NONE);
+            roundtrip(format, expected, img, qualities[q]);
+            for(a = 0; a < sizeof(accels) / sizeof(*accels); a++)
+            {
+                tctex_accel_set(accels[a]);
+                roundtrip(format, actual, img, qualities[q]);
+                ASSERT_MEMEQ(actual, size, expected, size);
+            }
+        }
+    tctex_accel_set(TCTEX_ACCEL_ALL);
+    free(actual);
+    free(expected);
+    free(img);
+))
+/* the error reported by each BC7 mode must be that of the decoded block */
+TEST(Encode_BC7_Modes,(
+    uint8_t px[16][4], block[16], out[16][4];
+    size_t r, i;
+    uint8_t mode, rotation, isel;
+    rng_state = 999;
+    for(r = 0; r < 64; r++)
+    {
+        fill_random(px[0], sizeof(px));
+        for(i = 0; i < 16 && r & 1; i++)
+            px[i][3] = 0xFF;
+        for(mode = 0; mode < 8; mode++)
+        {
+            const TCTex_BC7_ModeInfo* minfo = &tctex_i_bc7_modeinfos[mode];
+            uint8_t partition = (uint8_t)(r & ((1 << minfo->PB) - 1));
+            for(rotation = 0; rotation < (1 << minfo->RB); rotation++)
+                for(isel = 0; isel < (1 << minfo->ISB); isel++)
+                {
+                    uint32_t err = tctex_i_bc7_encode_mode(block, px, mode, partition, rotation, isel, r % 3, tctex_i_fit_rgba_ref);
+                    tctex_decompress_bc7_block(out, 4, 16, block);
+                    ASSERT_EQ(block[0] & ((2 << mode) - 1), 1 << mode);
+                    ASSERT_EQ(err, image_error_block(out[0], px[0]));
+                }
+        }
+    }
+))
+TEST(Encode_BC1_Transparent,(
+    uint8_t px[16][4], block[8], out[16][4];
+    size_t i;
+    rng_state = 1234;
+    fill_random(px[0], sizeof(px));
+    for(i = 0; i < 16; i++)
+        px[i][3] = i & 1 ? 0x00 : 0xFF;
+    tctex_compress_bc1_block(block, px, 4, 16, TCTEX_QUALITY_NORMAL, true);
+    tctex_decompress_bc1_block(out, 4, 16, block, true, true);
+    for(i = 0; i < 16; i++)
+        ASSERT_EQ(out[i][3], px[i][3]);
+    /* without alpha, the transparent black is never used */
+    tctex_compress_bc1_block(block, px, 4, 16, TCTEX_QUALITY_SLOW, false);
+    tctex_decompress_bc1_block(out, 4, 16, block, true, true);
+    for(i = 0; i < 16; i++)
+        ASSERT_EQ(out[i][3], 0xFF);
+))
+TEST(Encode_BC4_Solid,(
+    uint8_t px[16], block[8], out[16];
+    int v, is_signed;
+    size_t i;
+    for(is_signed = 0; is_signed < 2; is_signed++)
+        for(v = 0; v < 256; v++)
+        {
+            memset(px, v, sizeof(px));
+            tctex_compress_bc4_block(block, px, 1, 4, TCTEX_QUALITY_FAST, is_signed);
+            tctex_decompress_bc4_block(out, 1, 4, block, is_signed);
+            for(i = 0; i < 16; i++)
+                ASSERT_EQ(out[i], v);
+        }
+))
+
+/* the sRGB encode must round to the nearest code, and round-trip all of them */
+TEST(Util_SRGB_RoundTrip,(
+    static float linear[256], sweep[4099];
+    static uint8_t codes[256], back[256], swept[4099];
+    size_t i;
+    for(i = 0; i < 256; i++)
+        codes[i] = (uint8_t)i;
+    tctex_util_linear_from_srgb_n(linear, codes, 256);
+    tctex_util_srgb_from_linear_n(back, linear, 256);
+    ASSERT_MEMEQ(back, 256, codes, 256);
+    for(i = 0; i < 256; i++)
+    {
+        ASSERT_EQ(linear[i], tctex_util_linear_from_srgb((uint8_t)i));
+        ASSERT_EQ(tctex_util_srgb_from_linear(linear[i]), i);
+    }
+    ASSERT_EQ(linear[0], 0.0f);
+    ASSERT_EQ(linear[255], 1.0f);
+
+    for(i = 0; i < 4096; i++)
+        sweep[i] = (i + 0.37f) / 4096.0f;
+    sweep[4096] = -1.0f;
+    sweep[4097] = 2.0f;
+    sweep[4098] = NAN;
+    tctex_util_srgb_from_linear_n(swept, sweep, 4099);
+    for(i = 0; i < 4096; i++)
+    {
+        double x = sweep[i];
+        double srgb = x <= 0.0031308 ? x * 12.92 : 1.055 * pow(x, 1.0 / 2.4) - 0.055;
+        ASSERT_EQ(swept[i], (uint8_t)floor(srgb * 255.0 + 0.5));
+    }
+    ASSERT_EQ(swept[4096], 0);
+    ASSERT_EQ(swept[4097], 255);
+    ASSERT_EQ(swept[4098], 0);
+))
+static uint32_t bits_from_float(float f)
+{
+    uint32_t u;
+    memcpy(&u, &f, sizeof(u));
+    return u;
+}
+static float float_from_bits(uint32_t u)
+{
+    float f;
+    memcpy(&f, &u, sizeof(f));
+    return f;
+}
+/* every half goes to float & back (NaNs come back quieted) */
+TEST(Util_Half_RoundTrip,(
+    static uint16_t halves[65536], back[65536];
+    static float floats[65536];
+    size_t i;
+    for(i = 0; i < 65536; i++)
+        halves[i] = (uint16_t)i;
+    tctex_util_float_from_half_n(floats, halves, 65536);
+    tctex_util_half_from_float_n(back, floats, 65536);
+    for(i = 0; i < 65536; i++)
+    {
+        uint16_t expected = (i & 0x7C00) == 0x7C00 && (i & 0x3FF) ? (uint16_t)(i | 0x200) : (uint16_t)i;
+        ASSERT_EQ(back[i], expected);
+        ASSERT_EQ(tctex_util_half_from_float(tctex_util_float_from_half((uint16_t)i)), expected);
+        ASSERT_EQ(bits_from_float(floats[i]), bits_from_float(tctex_util_float_from_half((uint16_t)i)));
+    }
+    ASSERT_EQ(tctex_util_float_from_half(0x3C00), 1.0f);
+    ASSERT_EQ(tctex_util_float_from_half(0xC000), -2.0f);
+    ASSERT_EQ(tctex_util_float_from_half(0x0001), ldexpf(1.0f, -24));
+    ASSERT_EQ(tctex_util_float_from_half(0x7BFF), 65504.0f);
+    ASSERT_TRUE(isinf(tctex_util_float_from_half(0xFC00)));
+    /* ties go to even, and overflow to infinity */
+    ASSERT_EQ(tctex_util_half_from_float(1.0f + ldexpf(1.0f, -11)), 0x3C00);
+    ASSERT_EQ(tctex_util_half_from_float(1.0f + 3.0f * ldexpf(1.0f, -11)), 0x3C02);
+    ASSERT_EQ(tctex_util_half_from_float(ldexpf(1.0f, -25)), 0x0000);
+    ASSERT_EQ(tctex_util_half_from_float(ldexpf(1.5f, -25)), 0x0001);
+    ASSERT_EQ(tctex_util_half_from_float(65519.0f), 0x7BFF);
+    ASSERT_EQ(tctex_util_half_from_float(65520.0f), 0x7C00);
+    ASSERT_EQ(tctex_util_half_from_float(-1e10f), 0xFC00);
+))
+/* random bit patterns (so including NaNs, infinities & subnormals), with an odd count for the SIMD tail */
+TEST(Util_Half_Accel_Identical,(
+    enum { N = 4099 };
+    static float floats[N], expectedf[N], actualf[N];
+    static uint16_t halves[N], expectedh[N], actualh[N];
+    size_t a, i, r;
+    rng_state = 4321;
+    for(r = 0; r < 16; r++)
+    {
+        for(i = 0; i < N; i++)
+        {
+            uint32_t u = rng_next() << 8 ^ rng_next();
+            /* keep most of them within the range of halves */
+            if(i & 1) u = (u & 0x8FFFFFFFu) | 0x30000000u;
+            floats[i] = float_from_bits(u);
+            halves[i] = (uint16_t)u;
+        }
+        tctex_accel_set(TCTEX_ACCEL_NONE);
+        tctex_util_float_from_half_n(expectedf, halves, N);
+        tctex_util_half_from_float_n(expectedh, floats, N);
+        for(a = 0; a < sizeof(accels) / sizeof(*accels); a++)
+        {
+            tctex_accel_set(accels[a]);
+            tctex_util_float_from_half_n(actualf, halves, N);
+            tctex_util_half_from_float_n(actualh, floats, N);
+            ASSERT_MEMEQ(actualf, sizeof(actualf), expectedf, sizeof(expectedf));
+            ASSERT_MEMEQ(actualh, sizeof(actualh), expectedh, sizeof(expectedh));
+        }
+    }
+    tctex_accel_set(TCTEX_ACCEL_ALL);
+))
+
+/* odd sizes, so that some levels have to filter 3 pixels down to 1 */
+#define TEST_MIP_W  37
+#define TEST_MIP_H  19
+static const TCTex_MipFilter mip_filters[] = { TCTEX_MIP_FILTER_BOX, TCTEX_MIP_FILTER_KAISER, TCTEX_MIP_FILTER_LANCZOS3 };
+
+TEST(Mip_Layout,(
+    uint8_t src[TEST_MIP_H][TEST_MIP_W * 4 + 3];
+    size_t x, y, offset = 0, w = TEST_MIP_W, h = TEST_MIP_H;
+    uint32_t i;
+    ASSERT_EQ(tctex_mipmap_count(TEST_MIP_W, TEST_MIP_H), 6);
+    ASSERT_EQ(tctex_mipmap_count(1, 1), 1);
+    ASSERT_EQ(tctex_mipmap_count(256, 4), 9);
+    size_t size = tctex_mipmap_chain_size(TEST_MIP_W, TEST_MIP_H, 4, 0);
+    for(i = 0; i < 6; i++)
+    {
+        offset += w * h * 4;
+        w = w > 1 ? w >> 1 : 1;
+        h = h > 1 ? h >> 1 : 1;
+    }
+    ASSERT_EQ(size, offset);
+    ASSERT_EQ(tctex_mipmap_chain_size(TEST_MIP_W, TEST_MIP_H, 4, 2), (size_t)(TEST_MIP_W * TEST_MIP_H + 18 * 9) * 4);
+
+    /* level 0 is a (tightly-packed) copy of the source */
+    rng_state = 777;
+    for(y = 0; y < TEST_MIP_H; y++)
+        for(x = 0; x < sizeof(src[y]); x++)
+            src[y][x] = (uint8_t)rng_next();
+    uint8_t* chain = malloc(size);
+    ASSERT_TRUE(tctex_generate_mipmaps(chain, src, sizeof(src[0]), TEST_MIP_W, TEST_MIP_H, 4, 0, TCTEX_MIP_FILTER_BOX, 0, 0.0f));
+    for(y = 0; y < TEST_MIP_H; y++)
+        ASSERT_MEMEQ(&chain[y * TEST_MIP_W * 4], TEST_MIP_W * 4, src[y], TEST_MIP_W * 4);
+    free(chain);
+))
+TEST(Mip_Box,(
+    static const uint8_t src[4 * 4] = {
+        0, 2, 10, 20,
+        4, 6, 30, 41,
+        255, 255, 0, 1,
+        255, 254, 0, 0,
+    };
+    static const uint8_t expected[4 * 4 + 2 * 2 + 1] = {
+        0, 2, 10, 20,
+        4, 6, 30, 41,
+        255, 255, 0, 1,
+        255, 254, 0, 0,
+        3, 25,
+        255, 0, /* 254.75 & 0.25 */
+        71, /* (3 + 25 + 255 + 0) / 4 = 70.75 */
+    };
+    uint8_t chain[sizeof(expected)];
+    ASSERT_EQ(tctex_mipmap_chain_size(4, 4, 1, 0), sizeof(chain));
+    ASSERT_TRUE(tctex_generate_mipmaps(chain, src, 4, 4, 4, 1, 0, TCTEX_MIP_FILTER_BOX, 0, 0.0f));
+    ASSERT_MEMEQ(chain, sizeof(chain), expected, sizeof(expected));
+))
+/* the filters are normalized (and sRGB round-trips), so a solid color stays the same in every level */
+TEST(Mip_Solid,(
+    static const uint8_t color[4] = { 17, 128, 250, 99 };
+    size_t size = tctex_mipmap_chain_size(TEST_MIP_W, TEST_MIP_H, 4, 0);
+    uint8_t* src = malloc(TEST_MIP_W * TEST_MIP_H * 4);
+    uint8_t* chain = malloc(size);
+    size_t f, i;
+    unsigned int flags;
+    for(i = 0; i < TEST_MIP_W * TEST_MIP_H; i++)
+        memcpy(&src[i * 4], color, 4);
+    for(f = 0; f < sizeof(mip_filters) / sizeof(*mip_filters); f++)
+        for(flags = 0; flags <= TCTEX_MIP_SRGB; flags += TCTEX_MIP_SRGB)
+        {
+            memset(chain, 0xCD, size);
+            ASSERT_TRUE(tctex_generate_mipmaps(chain, src, TEST_MIP_W * 4, TEST_MIP_W, TEST_MIP_H, 4, 0, mip_filters[f], flags, 0.0f));
+            for(i = 0; i < size / 4; i++)
+                ASSERT_MEMEQ(&chain[i * 4], 4, color, 4);
+        }
+    free(chain);
+    free(src);
+))
+static double mip_coverage(const uint8_t* pixels, size_t npixels, uint8_t ref)
+{
+    size_t count = 0, i;
+    for(i = 0; i < npixels; i++)
+        count += pixels[i * 4 + 3] >= ref;
+    return count / (double)npixels;
+}
+/* mostly-transparent noise: plain filtering averages it down below the alpha test */
+TEST(Mip_AlphaCoverage,(
+    size_t w = 128, h = 128, x, y, f;
+    size_t size = tctex_mipmap_chain_size(w, h, 4, 0);
+    uint8_t* src = malloc(w * h * 4);
+    uint8_t* chain = malloc(size);
+    rng_state = 99;
+    for(y = 0; y < h; y++)
+        for(x = 0; x < w; x++)
+        {
+            uint8_t* p = &src[(y * w + x) * 4];
+            p[0] = p[1] = p[2] = (uint8_t)rng_next();
+            uint32_t r = rng_next() & 0xFF;
+            p[3] = (uint8_t)(r * r / 255);
+        }
+    double target = mip_coverage(src, w * h, 128);
+    for(f = 0; f < sizeof(mip_filters) / sizeof(*mip_filters); f++)
+    {
+        uint8_t* level = chain;
+        ASSERT_TRUE(tctex_generate_mipmaps(chain, src, w * 4, w, h, 4, 0, mip_filters[f], TCTEX_MIP_SRGB | TCTEX_MIP_ALPHA_COVERAGE, 0.5f));
+        size_t lw = w, lh = h;
+        while(lw >= 8) /* the smallest levels don't have enough pixels to get close */
+        {
+            ASSERT_LE(fabs(mip_coverage(level, lw * lh, 128) - target), 0.05);
+            level += lw * lh * 4;
+            lw >>= 1;
+            lh >>= 1;
+        }
+    }
+    /* without it, coverage drops (which is what this is about) */
+    ASSERT_TRUE(tctex_generate_mipmaps(chain, src, w * 4, w, h, 4, 0, TCTEX_MIP_FILTER_BOX, 0, 0.5f));
+    ASSERT_LT(mip_coverage(chain + w * h * 4, (w / 2) * (h / 2), 128), target - 0.1);
+    free(chain);
+    free(src);
+))
+TEST(Mip_Parallel_Identical,(
+    tcthread_pool_t pool = tcthread_pool_create(TEST_NTHREADS, 0);
+    size_t w = 150, h = 70, i, f;
+    size_t size = tctex_mipmap_chain_size(w, h, 4, 0);
+    uint8_t* src = malloc(w * h * 4);
+    uint8_t* expected = malloc(size);
+    uint8_t* actual = malloc(size);
+    ASSERT_TRUE(tcthread_pool_is_valid(pool));
+    rng_state = 1234;
+    for(i = 0; i < w * h * 4; i++)
+        src[i] = (uint8_t)rng_next();
+    for(f = 0; f < sizeof(mip_filters) / sizeof(*mip_filters); f++)
+    {
+        unsigned int flags = TCTEX_MIP_SRGB | TCTEX_MIP_ALPHA_COVERAGE;
+        ASSERT_TRUE(tctex_generate_mipmaps(expected, src, w * 4, w, h, 4, 0, mip_filters[f], flags, 0.5f));
+        memset(actual, 0xCD, size);
+        ASSERT_TRUE(tctex_generate_mipmaps_parallel(actual, src, w * 4, w, h, 4, 0, mip_filters[f], flags, 0.5f, pool));
+        ASSERT_MEMEQ(actual, size, expected, size);
+    }
+    tcthread_pool_destroy(pool);
+    free(actual);
+    free(expected);
+    free(src);
+))
+
+int main(void)
+{
+    TESTS_BEGIN();
+
+    TEST_HEADER("Reference");
+        TEST_EXEC(BC1_ThreeColor);
+        TEST_EXEC(BC2_AlphaOrder);
+        TEST_EXEC(BC4_SignedMode);
+        TEST_EXEC(BC7_Invalid);
+    TEST_HEADER("Acceleration");
+        TEST_EXEC(Accel_Identical);
+        TEST_EXEC(Accel_BC4_Endpoints);
+    TEST_HEADER("Parallel");
+        TEST_EXEC(Parallel_Identical);
+        TEST_EXEC(Parallel_Images);
+    TEST_HEADER("Encoders");
+        TEST_EXEC(Encode_Quality);
+        TEST_EXEC(Encode_Accel_Identical);
+        TEST_EXEC(Encode_BC7_Modes);
+        TEST_EXEC(Encode_BC1_Transparent);
+        TEST_EXEC(Encode_BC4_Solid);
+    TEST_HEADER("Utility");
+        TEST_EXEC(Util_SRGB_RoundTrip);
+        TEST_EXEC(Util_Half_RoundTrip);
+        TEST_EXEC(Util_Half_Accel_Identical);
+    TEST_HEADER("Mipmaps");
+        TEST_EXEC(Mip_Layout);
+        TEST_EXEC(Mip_Box);
+        TEST_EXEC(Mip_Solid);
+        TEST_EXEC(Mip_AlphaCoverage);
+        TEST_EXEC(Mip_Parallel_Identical);
+
+    TESTS_END();
+
+    return 0;
+}
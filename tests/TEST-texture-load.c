@@ -0,0 +1,334 @@
+/* for `tctex_read_level()` of supercompressed levels, if available (link with `-lzstd`) */
+#if defined(__has_include)
+#if __has_include(<zstd.h>)
+#include <zstd.h>
+#endif
+#endif
+
+#define TC_TEXTURE_LOAD_IMPLEMENTATION
+#include "../tc_texture_load.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "test.h"
+
+static void write_le32(uint8_t* p, uint32_t v)
+{
+    p[0] = v;
+    p[1] = v >> 8;
+    p[2] = v >> 16;
+    p[3] = v >> 24;
+}
+
+/* a BC1 DDS file with a full mipmap chain; each block is filled with its index in the file */
+#define DDS_BC1_SIZE    128
+#define DDS_BC1_NMIPS   8
+#define DDS_DATA_OFFSET (4 + 124)
+static size_t make_dds_bc1(uint8_t* buf)
+{
+    size_t len = DDS_DATA_OFFSET, i;
+    uint32_t s;
+    for(s = DDS_BC1_SIZE; s; s >>= 1)
+        len += (s + 3) / 4 * ((s + 3) / 4) * 8;
+
+    if(!buf) return len;
+    memset(buf, 0, DDS_DATA_OFFSET);
+    memcpy(buf, "DDS ", 4);
+    write_le32(buf + 4, 124);                               /* dwSize */
+    write_le32(buf + 8, 0x1 | 0x2 | 0x4 | 0x1000 | 0x20000 | 0x80000); /* CAPS | HEIGHT | WIDTH | PIXELFORMAT | MIPMAPCOUNT | LINEARSIZE */
+    write_le32(buf + 12, DDS_BC1_SIZE);                     /* dwHeight */
+    write_le32(buf + 16, DDS_BC1_SIZE);                     /* dwWidth */
+    write_le32(buf + 20, DDS_BC1_SIZE / 4 * (DDS_BC1_SIZE / 4) * 8); /* dwPitchOrLinearSize */
+    write_le32(buf + 28, DDS_BC1_NMIPS);                    /* dwMipMapCount */
+    write_le32(buf + 76, 32);                               /* ddspf.dwSize */
+    write_le32(buf + 80, 0x4);                              /* ddspf.dwFlags = DDPF_FOURCC */
+    memcpy(buf + 84, "DXT1", 4);                            /* ddspf.dwFourCC */
+    write_le32(buf + 108, 0x1000 | 0x400000 | 0x8);         /* dwCaps = TEXTURE | MIPMAP | COMPLEX */
+    for(i = DDS_DATA_OFFSET; i + 8 <= len; i += 8)
+    {
+        write_le32(buf + i, (uint32_t)(i - DDS_DATA_OFFSET) / 8);
+        write_le32(buf + i + 4, 0);
+    }
+    return len;
+}
+
+TEST(DDS_Region,(
+    size_t len = make_dds_bc1(NULL);
+    uint8_t* file = malloc(len);
+    make_dds_bc1(file);
+
+    TCTex_Texture tex;
+    ASSERT_NOTNULL(tctex_load_mem(&tex, file, len));
+    ASSERT_EQ(tex.iformat, TCTEX_IFORMAT_COMPRESSED_BC1_UNORM);
+    ASSERT_EQ(tex.nmiplevels, DDS_BC1_NMIPS);
+
+    /* (a 2x2-block region at block 3,5 of level 1, which is 16x16 blocks) */
+    uint8_t blocks[4 * 8];
+    TCTex_Region region;
+    ASSERT_NOTNULL(tctex_read_region(&tex, blocks, sizeof(blocks), &region, 1, 0, 12, 20, 8, 8, NULL, NULL));
+    ASSERT_EQ(region.x, 12);
+    ASSERT_EQ(region.y, 20);
+    ASSERT_EQ(region.w, 8);
+    ASSERT_EQ(region.h, 8);
+    uint32_t level1 = DDS_BC1_SIZE / 4 * (DDS_BC1_SIZE / 4);
+    ASSERT_EQ(blocks[0], (uint8_t)(level1 + 5 * 16 + 3));
+    ASSERT_EQ(blocks[8], (uint8_t)(level1 + 5 * 16 + 4));
+    ASSERT_EQ(blocks[16], (uint8_t)(level1 + 6 * 16 + 3));
+    ASSERT_EQ(blocks[24], (uint8_t)(level1 + 6 * 16 + 4));
+
+    tctex_close(&tex);
+    free(file);
+))
+TEST(DDS_Region_Truncated,(
+    size_t len = make_dds_bc1(NULL);
+    uint8_t* file = malloc(len);
+    make_dds_bc1(file);
+
+    /* the header is intact, but the data ends partway through the first level */
+    size_t tlen = DDS_DATA_OFFSET + 1000;
+    uint8_t* trunc = malloc(tlen);
+    memcpy(trunc, file, tlen);
+
+    TCTex_Texture tex;
+    ASSERT_NOTNULL(tctex_load_mem(&tex, trunc, tlen));
+
+    uint8_t blocks[DDS_BC1_SIZE / 4 * (DDS_BC1_SIZE / 4) * 8];
+    /* (the first rows are still there) */
+    ASSERT_NOTNULL(tctex_read_region(&tex, blocks, sizeof(blocks), NULL, 0, 0, 0, 0, DDS_BC1_SIZE, 4, NULL, NULL));
+    ASSERT_MEMEQ(blocks, DDS_BC1_SIZE / 4 * 8, file + DDS_DATA_OFFSET, DDS_BC1_SIZE / 4 * 8);
+    ASSERT_NULL(tctex_read_region(&tex, blocks, sizeof(blocks), NULL, 0, 0, 0, 0, DDS_BC1_SIZE, DDS_BC1_SIZE, NULL, NULL));
+    ASSERT_STREQ(tex.errmsg, "Unable to read the texture data (file truncated)");
+    ASSERT_NULL(tctex_read_region(&tex, blocks, sizeof(blocks), NULL, 3, 0, 0, 0, 4, 4, NULL, NULL));
+    ASSERT_STREQ(tex.errmsg, "Unable to read the texture data (file truncated)");
+
+    tctex_close(&tex);
+    free(trunc);
+    free(file);
+))
+TEST(DDS_Level_Truncated,(
+    size_t len = make_dds_bc1(NULL);
+    uint8_t* file = malloc(len);
+    make_dds_bc1(file);
+
+    /* (everything but the last byte of the smallest level) */
+    TCTex_Texture tex;
+    ASSERT_NOTNULL(tctex_load_mem(&tex, file, len - 1));
+
+    uint8_t level[DDS_BC1_SIZE / 4 * (DDS_BC1_SIZE / 4) * 8];
+    ASSERT_NOTNULL(tctex_read_level(&tex, level, sizeof(level), 0, NULL, NULL, NULL, NULL));
+    ASSERT_MEMEQ(level, sizeof(level), file + DDS_DATA_OFFSET, sizeof(level));
+    ASSERT_NULL(tctex_read_level(&tex, level, sizeof(level), DDS_BC1_NMIPS - 1, NULL, NULL, NULL, NULL));
+    ASSERT_STREQ(tex.errmsg, "Unable to read the texture data (file truncated)");
+
+    tctex_close(&tex);
+    free(file);
+))
+
+/* see `load_images/generate-ktx2.py` */
+#define TESTDATA_ROOT   "../tests/load_images"
+#define KTX2_SIZE       16
+#define KTX2_NLEVELS    5
+static int ktx2_check_level(const uint8_t* data, uint32_t level)
+{
+    uint32_t size = KTX2_SIZE >> level, x, y, c;
+    for(y = 0; y < size; y++)
+        for(x = 0; x < size; x++)
+            for(c = 0; c < 4; c++)
+                if(*data++ != (uint8_t)(level * 31 + y * 7 + x * 3 + c * 50))
+                    return 0;
+    return 1;
+}
+
+TEST(KTX2_Load,(
+    static const char* const fnames[] = { TESTDATA_ROOT "/rgba8.ktx2", TESTDATA_ROOT "/rgba8.zstd.ktx2" };
+    size_t i;
+    for(i = 0; i < sizeof(fnames) / sizeof(*fnames); i++)
+    {
+        TCTex_Texture tex;
+        if(!tctex_load_fname(&tex, fnames[i])) fprintf(stderr, "%s: %s\n", fnames[i], tex.errmsg);
+        ASSERT_NOTNULL(tex.memory);
+        ASSERT_EQ(tex.iformat, TCTEX_IFORMAT_R8G8B8A8_UNORM);
+        ASSERT_EQ(tex.supercompression, i ? TCTEX_SUPERCOMPRESSION_ZSTD : TCTEX_SUPERCOMPRESSION_NONE);
+        ASSERT_EQ(tex.size.x, KTX2_SIZE);
+        ASSERT_EQ(tex.size.y, KTX2_SIZE);
+        ASSERT_EQ(tex.nmiplevels, KTX2_NLEVELS);
+        ASSERT_EQ(tex.pitch.y, KTX2_SIZE * 4);
+        ASSERT_EQ(tctex_get_level_size(&tex, 0), KTX2_SIZE * KTX2_SIZE * 4);
+        ASSERT_EQ(tctex_get_level_size(&tex, KTX2_NLEVELS - 1), 4);
+        tctex_close(&tex);
+    }
+))
+TEST(KTX2_Level,(
+    TCTex_Texture tex;
+    uint8_t level[KTX2_SIZE * KTX2_SIZE * 4];
+    uint32_t i;
+
+    ASSERT_NOTNULL(tctex_load_fname(&tex, TESTDATA_ROOT "/rgba8.ktx2"));
+    for(i = 0; i < KTX2_NLEVELS; i++)
+    {
+        ASSERT_NOTNULL(tctex_read_level(&tex, level, sizeof(level), i, NULL, NULL, NULL, NULL));
+        ASSERT_TRUE(ktx2_check_level(level, i));
+    }
+    tctex_close(&tex);
+))
+#ifdef ZSTD_VERSION_MAJOR
+TEST(KTX2_Level_Zstd,(
+    TCTex_Texture tex;
+    uint8_t level[KTX2_SIZE * KTX2_SIZE * 4];
+    uint32_t i;
+
+    /* decompressed from memory */
+    ASSERT_NOTNULL(tctex_load_fname(&tex, TESTDATA_ROOT "/rgba8.zstd.ktx2"));
+    for(i = 0; i < KTX2_NLEVELS; i++)
+    {
+        memset(level, 0, sizeof(level));
+        ASSERT_NOTNULL(tctex_read_level(&tex, level, sizeof(level), i, NULL, NULL, NULL, NULL));
+        ASSERT_TRUE(ktx2_check_level(level, i));
+    }
+    tctex_close(&tex);
+
+    /* streamed through a reader */
+    FILE* file = fopen(TESTDATA_ROOT "/rgba8.zstd.ktx2", "rb");
+    ASSERT_NOTNULL(file);
+    ASSERT_NOTNULL(tctex_load_reader(&tex, tctex_read_stdio, file));
+    for(i = 0; i < KTX2_NLEVELS; i++)
+    {
+        memset(level, 0, sizeof(level));
+        ASSERT_NOTNULL(tctex_read_level(&tex, level, sizeof(level), i, tctex_read_stdio, file, NULL, NULL));
+        ASSERT_TRUE(ktx2_check_level(level, i));
+    }
+    tctex_close(&tex);
+    fclose(file);
+))
+#endif
+
+/* `tctex_load_mapped()` must give the same texture as `tctex_load_fname()`, down to the mipmaps and their data */
+static int textures_equal(const TCTex_Texture* a, const TCTex_Texture* b)
+{
+    TCTex_MipMapInfo ma[16], mb[16];
+    uint32_t na, nb;
+    if(a->memlen != b->memlen || memcmp(a->memory, b->memory, a->memlen))
+        return 0;
+    if(a->iformat != b->iformat || a->supercompression != b->supercompression || a->nmiplevels != b->nmiplevels
+    || a->size.x != b->size.x || a->size.y != b->size.y || a->size.z != b->size.z)
+        return 0;
+    na = tctex_get_mipmaps(a, ma, 16, 0);
+    nb = tctex_get_mipmaps(b, mb, 16, 0);
+    return na == a->nmiplevels && na == nb && !memcmp(ma, mb, na * sizeof(*ma));
+}
+#define DDS_TMP_FNAME   "TEST-texture-load.dds"
+
+TEST(Mapped_DDS,(
+    size_t len = make_dds_bc1(NULL);
+    uint8_t* file = malloc(len);
+    make_dds_bc1(file);
+    FILE* f = fopen(DDS_TMP_FNAME, "wb");
+    ASSERT_NOTNULL(f);
+    ASSERT_EQ(fwrite(file, 1, len, f), len);
+    fclose(f);
+
+    TCTex_Texture mtex, ftex;
+    ASSERT_NOTNULL(tctex_load_mapped(&mtex, DDS_TMP_FNAME));
+    ASSERT_NOTNULL(tctex_load_fname(&ftex, DDS_TMP_FNAME));
+    /* (the buffer is owned by the texture, and freed by `tctex_close()`; it used to be leaked) */
+    ASSERT_NOTNULL(ftex.imem_);
+    ASSERT_EQ(mtex.memlen, len);
+    ASSERT_TRUE(textures_equal(&mtex, &ftex));
+
+    uint8_t blocks[4 * 8];
+    ASSERT_NOTNULL(tctex_read_region(&mtex, blocks, sizeof(blocks), NULL, 1, 0, 12, 20, 8, 8, NULL, NULL));
+    uint32_t level1 = DDS_BC1_SIZE / 4 * (DDS_BC1_SIZE / 4);
+    ASSERT_EQ(blocks[0], (uint8_t)(level1 + 5 * 16 + 3));
+    ASSERT_EQ(blocks[24], (uint8_t)(level1 + 6 * 16 + 4));
+
+    tctex_close(&mtex);
+    tctex_close(&ftex);
+    remove(DDS_TMP_FNAME);
+    free(file);
+))
+TEST(Mapped_KTX2,(
+    static const char* const fnames[] = { TESTDATA_ROOT "/rgba8.ktx2", TESTDATA_ROOT "/rgba8.zstd.ktx2" };
+    uint8_t level[KTX2_SIZE * KTX2_SIZE * 4];
+    size_t i;
+    uint32_t l;
+    for(i = 0; i < sizeof(fnames) / sizeof(*fnames); i++)
+    {
+        TCTex_Texture mtex, ftex;
+        ASSERT_NOTNULL(tctex_load_mapped(&mtex, fnames[i]));
+        ASSERT_NOTNULL(tctex_load_fname(&ftex, fnames[i]));
+        ASSERT_NOTNULL(ftex.imem_);
+        ASSERT_TRUE(textures_equal(&mtex, &ftex));
+#ifndef ZSTD_VERSION_MAJOR
+        if(mtex.supercompression == TCTEX_SUPERCOMPRESSION_NONE)
+#endif
+        for(l = 0; l < KTX2_NLEVELS; l++)
+        {
+            memset(level, 0, sizeof(level));
+            ASSERT_NOTNULL(tctex_read_level(&mtex, level, sizeof(level), l, NULL, NULL, NULL, NULL));
+            ASSERT_TRUE(ktx2_check_level(level, l));
+        }
+        tctex_close(&mtex);
+        tctex_close(&ftex);
+    }
+))
+TEST(Mapped_Prefetch,(
+    TCTex_Texture tex;
+    TCTex_MipMapInfo mips[KTX2_NLEVELS];
+    uint8_t level[KTX2_SIZE * KTX2_SIZE * 4];
+    uint32_t l;
+    ASSERT_NOTNULL(tctex_load_mapped(&tex, TESTDATA_ROOT "/rgba8.ktx2"));
+    ASSERT_EQ(tctex_get_mipmaps(&tex, mips, KTX2_NLEVELS, 0), KTX2_NLEVELS);
+
+    /* a valid range (all of the levels, or just a few) */
+    tctex_prefetch_mipmaps(&tex, mips, KTX2_NLEVELS);
+    tctex_prefetch_mipmaps(&tex, mips + 1, 2);
+    /* ... and ranges that go past the end of the file, or start there; these are clamped (or ignored) */
+    TCTex_MipMapInfo bad[2] = { mips[0], mips[0] };
+    bad[0].nbytes = UINT32_MAX;
+    bad[1].offset = tex.memlen + 65536;
+    tctex_prefetch_mipmaps(&tex, bad, 2);
+    tctex_prefetch_mipmaps(&tex, bad + 1, 1);
+    tctex_prefetch_mipmaps(&tex, mips, 0);
+    tctex_prefetch_mipmaps(NULL, mips, KTX2_NLEVELS);
+
+    /* (which has no effect on the data) */
+    for(l = 0; l < KTX2_NLEVELS; l++)
+    {
+        ASSERT_NOTNULL(tctex_read_level(&tex, level, sizeof(level), l, NULL, NULL, NULL, NULL));
+        ASSERT_TRUE(ktx2_check_level(level, l));
+    }
+    tctex_close(&tex);
+
+    /* and it's a no-op for a texture that is already in memory */
+    ASSERT_NOTNULL(tctex_load_fname(&tex, TESTDATA_ROOT "/rgba8.ktx2"));
+    tctex_prefetch_mipmaps(&tex, bad, 2);
+    ASSERT_NOTNULL(tctex_read_level(&tex, level, sizeof(level), 0, NULL, NULL, NULL, NULL));
+    ASSERT_TRUE(ktx2_check_level(level, 0));
+    tctex_close(&tex);
+))
+
+int main(void)
+{
+    TESTS_BEGIN();
+
+    TEST_HEADER("DDS");
+        TEST_EXEC(DDS_Region);
+        TEST_EXEC(DDS_Region_Truncated);
+        TEST_EXEC(DDS_Level_Truncated);
+    TEST_HEADER("KTX2");
+        TEST_EXEC(KTX2_Load);
+        TEST_EXEC(KTX2_Level);
+#ifdef ZSTD_VERSION_MAJOR
+        TEST_EXEC(KTX2_Level_Zstd);
+#else
+        TEST_SKIP_MSG(KTX2_Level_Zstd, "zstd.h not available");
+#endif
+    TEST_HEADER("Mapped");
+        TEST_EXEC(Mapped_DDS);
+        TEST_EXEC(Mapped_KTX2);
+        TEST_EXEC(Mapped_Prefetch);
+
+    TESTS_END();
+}
@@ -0,0 +1,561 @@
+#define _GNU_SOURCE /* for thread pinning on Linux */
+#define TC_THREAD_IMPLEMENTATION
+#include "../tc_thread.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "test.h"
+
+#define NTHREADS    4
+
+static void job_count(tcthread_job_t job, void* udata)
+{
+    (void)job;
+    tcthread_atomic32_inc_explicit((volatile tcthread_atomic32_t*)udata, TCTHREAD_MEMORDER_RELAXED);
+}
+
+/* recursively spawns children (2 per level) with itself as the parent, counting the leaves */
+struct tree_node { struct tree_ctx* ctx; uint32_t depth; };
+struct tree_ctx
+{
+    tcthread_pool_t pool;
+    volatile tcthread_atomic32_t nleaves;
+    struct tree_node* nodes;
+    volatile tcthread_atomic32_t nnodes;
+};
+static void job_tree(tcthread_job_t job, void* udata)
+{
+    struct tree_node* node = (struct tree_node*)udata;
+    struct tree_ctx* ctx = node->ctx;
+    if(!node->depth)
+    {
+        tcthread_atomic32_inc_explicit(&ctx->nleaves, TCTHREAD_MEMORDER_RELAXED);
+        return;
+    }
+    int i;
+    for(i = 0; i < 2; i++)
+    {
+        struct tree_node* child = &ctx->nodes[tcthread_atomic32_fetch_add_explicit(&ctx->nnodes, 1, TCTHREAD_MEMORDER_RELAXED)];
+        child->ctx = ctx;
+        child->depth = node->depth - 1;
+        tcthread_job_t cjob = tcthread_job_create(ctx->pool, job, job_tree, child);
+        tcthread_job_submit(cjob);
+        tcthread_job_release(cjob);
+    }
+}
+
+/* each job in a chain appends its index; continuations must preserve the order */
+struct chain_ctx
+{
+    uint32_t order[64];
+    uint32_t norder;
+};
+struct chain_item { struct chain_ctx* ctx; uint32_t index; };
+static void job_chain(tcthread_job_t job, void* udata)
+{
+    (void)job;
+    struct chain_item* item = (struct chain_item*)udata;
+    item->ctx->order[item->ctx->norder++] = item->index;
+}
+
+/* a diamond: C must only run after both A and B */
+static volatile tcthread_atomic32_t diamond_done;
+static volatile tcthread_atomic32_t diamond_seen;
+static void job_diamond_pred(tcthread_job_t job, void* udata)
+{
+    (void)job; (void)udata;
+    tcthread_sleep(10);
+    tcthread_atomic32_inc_explicit(&diamond_done, TCTHREAD_MEMORDER_RELEASE);
+}
+static void job_diamond_cont(tcthread_job_t job, void* udata)
+{
+    (void)job; (void)udata;
+    tcthread_atomic32_store_explicit(&diamond_seen, tcthread_atomic32_load_explicit(&diamond_done, TCTHREAD_MEMORDER_ACQUIRE), TCTHREAD_MEMORDER_RELAXED);
+}
+
+/* waits on an unrelated job from within a job (must not deadlock, even with 1 worker) */
+struct nested_ctx { tcthread_pool_t pool; volatile tcthread_atomic32_t count; uint32_t depth; };
+static void job_nested(tcthread_job_t job, void* udata)
+{
+    (void)job;
+    struct nested_ctx* ctx = (struct nested_ctx*)udata;
+    tcthread_atomic32_inc_explicit(&ctx->count, TCTHREAD_MEMORDER_RELAXED);
+    if(!ctx->depth--)
+        return;
+    tcthread_job_t none = {0};
+    tcthread_job_t inner = tcthread_job_create(ctx->pool, none, job_nested, ctx);
+    tcthread_job_submit(inner);
+    tcthread_job_wait(inner);
+    tcthread_job_release(inner);
+}
+
+struct range_ctx
+{
+    tcthread_pool_t pool;
+    unsigned char* hits;
+    volatile tcthread_atomicsz_t sum;
+    volatile tcthread_atomic32_t bad_index;
+};
+static void range_sum(size_t begin, size_t end, void* udata)
+{
+    struct range_ctx* ctx = (struct range_ctx*)udata;
+    int32_t index = tcthread_pool_get_worker_index(ctx->pool);
+    if(index >= (int32_t)tcthread_pool_get_thread_count(ctx->pool))
+        tcthread_atomic32_inc_explicit(&ctx->bad_index, TCTHREAD_MEMORDER_RELAXED);
+    size_t sum = 0, i;
+    for(i = begin; i < end; i++)
+    {
+        ctx->hits[i]++;
+        sum += i;
+    }
+    tcthread_atomicsz_fetch_add_explicit(&ctx->sum, sum, TCTHREAD_MEMORDER_RELAXED);
+}
+
+/* N threads incrementing a shared (non-atomic) counter under a lock */
+#define LOCK_NTHREADS   8
+#define LOCK_NITERS     20000
+struct lock_ctx
+{
+    tcthread_spinlock_t spinlock;
+    tcthread_amutex_t amutex;
+    uint32_t counter;
+};
+static void* run_spinlock(void* udata)
+{
+    struct lock_ctx* ctx = (struct lock_ctx*)udata;
+    int i;
+    for(i = 0; i < LOCK_NITERS; i++)
+    {
+        tcthread_spinlock_lock(&ctx->spinlock);
+        ctx->counter++;
+        tcthread_spinlock_unlock(&ctx->spinlock);
+    }
+    return NULL;
+}
+static void* run_amutex(void* udata)
+{
+    struct lock_ctx* ctx = (struct lock_ctx*)udata;
+    int i;
+    for(i = 0; i < LOCK_NITERS; i++)
+    {
+        tcthread_amutex_lock(&ctx->amutex);
+        ctx->counter++;
+        tcthread_amutex_unlock(&ctx->amutex);
+    }
+    return NULL;
+}
+
+/* ping-pong: each side waits for `turn` to become its own, then hands it over */
+#define PINGPONG_NITERS 10000
+static volatile tcthread_atomic32_t pingpong_turn;
+static void* run_pingpong(void* udata)
+{
+    tcthread_atomic32_t self = *(const tcthread_atomic32_t*)udata;
+    int i;
+    for(i = 0; i < PINGPONG_NITERS; i++)
+    {
+        tcthread_atomic32_t turn;
+        while((turn = tcthread_atomic32_load_explicit(&pingpong_turn, TCTHREAD_MEMORDER_ACQUIRE)) != self)
+            tcthread_atomic32_wait(&pingpong_turn, turn);
+        tcthread_atomic32_store_explicit(&pingpong_turn, !self, TCTHREAD_MEMORDER_RELEASE);
+        tcthread_atomic32_notify_one(&pingpong_turn);
+    }
+    return NULL;
+}
+static volatile tcthread_atomic32_t gate;
+static volatile tcthread_atomic32_t gate_passed;
+static void* run_gate(void* udata)
+{
+    (void)udata;
+    while(!tcthread_atomic32_load_explicit(&gate, TCTHREAD_MEMORDER_ACQUIRE))
+        tcthread_atomic32_wait(&gate, 0);
+    tcthread_atomic32_inc_explicit(&gate_passed, TCTHREAD_MEMORDER_RELAXED);
+    return NULL;
+}
+
+/* queues: items are `(producer << 24) | (seq + 1)`, so that order can be verified per producer */
+#define QUEUE_NITEMS    200000
+#define QUEUE_NTHREADS  4
+struct queue_ctx
+{
+    tcthread_spsc_queue_t spsc;
+    tcthread_mpmc_queue_t mpmc;
+    uint32_t producer;
+    volatile tcthread_atomic32_t npopped;
+    volatile tcthread_atomicsz_t sum;
+    volatile tcthread_atomic32_t bad_order;
+};
+static void* run_spsc_producer(void* udata)
+{
+    struct queue_ctx* ctx = (struct queue_ctx*)udata;
+    uintptr_t i;
+    for(i = 1; i <= QUEUE_NITEMS; i++)
+        while(!tcthread_spsc_queue_try_push(ctx->spsc, (void*)i))
+            tcthread_yield();
+    return NULL;
+}
+static void* run_mpmc_producer(void* udata)
+{
+    struct queue_ctx* ctx = (struct queue_ctx*)udata;
+    uint32_t producer = tcthread_atomic32_inc_explicit(&ctx->producer, TCTHREAD_MEMORDER_RELAXED) - 1;
+    uintptr_t i;
+    for(i = 1; i <= QUEUE_NITEMS; i++)
+        while(!tcthread_mpmc_queue_try_push(ctx->mpmc, (void*)(((uintptr_t)producer << 24) | i)))
+            tcthread_yield();
+    return NULL;
+}
+static void* run_mpmc_consumer(void* udata)
+{
+    struct queue_ctx* ctx = (struct queue_ctx*)udata;
+    uintptr_t last[QUEUE_NTHREADS] = {0};
+    size_t sum = 0;
+    while(tcthread_atomic32_load_explicit(&ctx->npopped, TCTHREAD_MEMORDER_RELAXED) < QUEUE_NTHREADS * QUEUE_NITEMS)
+    {
+        void* item;
+        if(!tcthread_mpmc_queue_try_pop(ctx->mpmc, &item))
+        {
+            tcthread_yield();
+            continue;
+        }
+        uintptr_t producer = (uintptr_t)item >> 24, seq = (uintptr_t)item & 0xFFFFFF;
+        if(producer >= QUEUE_NTHREADS || seq <= last[producer])
+            tcthread_atomic32_inc_explicit(&ctx->bad_order, TCTHREAD_MEMORDER_RELAXED);
+        else
+            last[producer] = seq;
+        sum += seq;
+        tcthread_atomic32_inc_explicit(&ctx->npopped, TCTHREAD_MEMORDER_RELAXED);
+    }
+    tcthread_atomicsz_fetch_add_explicit(&ctx->sum, sum, TCTHREAD_MEMORDER_RELAXED);
+    return NULL;
+}
+
+TEST(Pool_Create,(
+    tcthread_pool_t pool = tcthread_pool_create(NTHREADS, 0);
+    ASSERT_TRUE(tcthread_pool_is_valid(pool));
+    ASSERT_EQ(tcthread_pool_get_thread_count(pool), NTHREADS);
+    ASSERT_EQ(tcthread_pool_get_worker_index(pool), -1);
+    tcthread_pool_destroy(pool);
+
+    uint32_t ncpu = tcthread_get_cpu_count();
+    pool = tcthread_pool_create(0, TCTHREAD_POOL_PIN_THREADS);
+    ASSERT_TRUE(tcthread_pool_is_valid(pool));
+    ASSERT_EQ(tcthread_pool_get_thread_count(pool), ncpu ? ncpu : 1);
+    tcthread_pool_destroy(pool);
+
+    tcthread_pool_t null_pool = {0};
+    tcthread_pool_destroy(null_pool);
+))
+TEST(Job_Parent,(
+    tcthread_pool_t pool = tcthread_pool_create(NTHREADS, 0);
+    volatile tcthread_atomic32_t count = 0;
+    tcthread_job_t none = {0};
+    // children are created before the parent is submitted; the parent itself has no function
+    tcthread_job_t parent = tcthread_job_create(pool, none, NULL, NULL);
+    int i;
+    for(i = 0; i < 10000; i++)
+    {
+        tcthread_job_t child = tcthread_job_create(pool, parent, job_count, (void*)&count);
+        ASSERT_TRUE(tcthread_job_is_valid(child));
+        tcthread_job_submit(child);
+        tcthread_job_release(child);
+    }
+    tcthread_job_submit(parent);
+    tcthread_job_wait(parent);
+    ASSERT_TRUE(tcthread_job_is_done(parent));
+    ASSERT_EQ(count, 10000);
+    tcthread_job_release(parent);
+    tcthread_pool_destroy(pool);
+))
+TEST(Job_Tree,(
+    tcthread_pool_t pool = tcthread_pool_create(NTHREADS, 0);
+    struct tree_ctx ctx;
+    const uint32_t depth = 14;
+    ctx.pool = pool;
+    ctx.nleaves = 0;
+    ctx.nodes = malloc(sizeof(*ctx.nodes) << (depth + 1));
+    ctx.nnodes = 1;
+    ctx.nodes[0].ctx = &ctx;
+    ctx.nodes[0].depth = depth;
+    tcthread_job_t none = {0};
+    tcthread_job_t root = tcthread_job_create(pool, none, job_tree, &ctx.nodes[0]);
+    tcthread_job_submit(root);
+    tcthread_job_wait(root);
+    ASSERT_EQ(ctx.nleaves, 1u << depth);
+    ASSERT_EQ(ctx.nnodes, (2u << depth) - 1);
+    tcthread_job_release(root);
+    free(ctx.nodes);
+    tcthread_pool_destroy(pool);
+))
+TEST(Job_Then,(
+    tcthread_pool_t pool = tcthread_pool_create(NTHREADS, 0);
+    tcthread_job_t none = {0};
+
+    // chain: 0 -> 1 -> ... -> 63, submitted in reverse
+    struct chain_ctx chain;
+    struct chain_item items[64];
+    tcthread_job_t jobs[64];
+    uint32_t i;
+    chain.norder = 0;
+    for(i = 0; i < 64; i++)
+    {
+        items[i].ctx = &chain;
+        items[i].index = i;
+        jobs[i] = tcthread_job_create(pool, none, job_chain, &items[i]);
+        if(i) ASSERT_TRUE(tcthread_job_then(jobs[i-1], jobs[i]));
+    }
+    for(i = 64; i-- > 0;)
+        tcthread_job_submit(jobs[i]);
+    tcthread_job_wait(jobs[63]);
+    ASSERT_EQ(chain.norder, 64);
+    for(i = 0; i < 64; i++)
+    {
+        ASSERT_EQ(chain.order[i], i);
+        tcthread_job_release(jobs[i]);
+    }
+
+    // diamond: A, B -> C
+    diamond_done = 0;
+    diamond_seen = 0;
+    tcthread_job_t a = tcthread_job_create(pool, none, job_diamond_pred, NULL);
+    tcthread_job_t b = tcthread_job_create(pool, none, job_diamond_pred, NULL);
+    tcthread_job_t c = tcthread_job_create(pool, none, job_diamond_cont, NULL);
+    ASSERT_TRUE(tcthread_job_then(a, c));
+    ASSERT_TRUE(tcthread_job_then(b, c));
+    tcthread_job_submit(c);
+    tcthread_job_submit(a);
+    tcthread_job_submit(b);
+    // release early; the jobs must remain alive until they're done
+    tcthread_job_release(a);
+    tcthread_job_release(b);
+    tcthread_job_wait(c);
+    ASSERT_EQ(diamond_seen, 2);
+    tcthread_job_release(c);
+
+    // continuation limit
+    tcthread_job_t p = tcthread_job_create(pool, none, NULL, NULL);
+    tcthread_job_t q = tcthread_job_create(pool, none, NULL, NULL);
+    for(i = 0; i < TCTHREAD_JOB_MAX_CONTINUATIONS; i++)
+        ASSERT_TRUE(tcthread_job_then(p, q));
+    ASSERT_FALSE(tcthread_job_then(p, q));
+    tcthread_job_submit(q);
+    tcthread_job_submit(p);
+    tcthread_job_wait(q);
+    tcthread_job_release(p);
+    tcthread_job_release(q);
+
+    tcthread_pool_destroy(pool);
+))
+TEST(Job_NestedWait,(
+    uint32_t nthreads;
+    for(nthreads = 1; nthreads <= NTHREADS; nthreads *= 2)
+    {
+        tcthread_pool_t pool = tcthread_pool_create(nthreads, 0);
+        struct nested_ctx ctx;
+        ctx.pool = pool;
+        ctx.count = 0;
+        ctx.depth = 32;
+        tcthread_job_t none = {0};
+        tcthread_job_t job = tcthread_job_create(pool, none, job_nested, &ctx);
+        tcthread_job_submit(job);
+        tcthread_job_wait(job);
+        ASSERT_EQ(ctx.count, 33);
+        tcthread_job_release(job);
+        tcthread_pool_destroy(pool);
+    }
+))
+TEST(Pool_Drain,(
+    tcthread_pool_t pool = tcthread_pool_create(NTHREADS, 0);
+    volatile tcthread_atomic32_t count = 0;
+    tcthread_job_t none = {0};
+    int i;
+    for(i = 0; i < 1000; i++)
+    {
+        tcthread_job_t job = tcthread_job_create(pool, none, job_count, (void*)&count);
+        tcthread_job_submit(job);
+        tcthread_job_release(job);
+    }
+    tcthread_pool_destroy(pool);
+    ASSERT_EQ(count, 1000);
+))
+TEST(Pool_ParallelFor,(
+    static const size_t counts[] = { 0, 1, 7, 1000, 1000003 };
+    static const size_t grains[] = { 0, 1, 64, 5000000 };
+    size_t c, g, i;
+    uint32_t flags;
+    for(flags = 0; flags <= TCTHREAD_POOL_PIN_THREADS; flags += TCTHREAD_POOL_PIN_THREADS)
+    {
+        tcthread_pool_t pool = tcthread_pool_create(NTHREADS, flags);
+        for(c = 0; c < sizeof(counts) / sizeof(*counts); c++)
+            for(g = 0; g < sizeof(grains) / sizeof(*grains); g++)
+            {
+                struct range_ctx ctx;
+                ctx.pool = pool;
+                ctx.hits = calloc(counts[c] + 1, 1);
+                ctx.sum = 0;
+                ctx.bad_index = 0;
+                tcthread_pool_parallel_for(pool, counts[c], grains[g], range_sum, &ctx);
+                ASSERT_EQ(ctx.sum, counts[c] ? counts[c] * (counts[c] - 1) / 2 : 0);
+                ASSERT_EQ(ctx.bad_index, 0);
+                for(i = 0; i < counts[c]; i++)
+                    ASSERT_EQ(ctx.hits[i], 1);
+                free(ctx.hits);
+            }
+        tcthread_pool_destroy(pool);
+    }
+))
+
+TEST(Spinlock,(
+    static struct lock_ctx ctx = { TCTHREAD_SPINLOCK_INIT, TCTHREAD_AMUTEX_INIT, 0 };
+    ASSERT_TRUE(tcthread_spinlock_try_lock(&ctx.spinlock));
+    ASSERT_FALSE(tcthread_spinlock_try_lock(&ctx.spinlock));
+    tcthread_spinlock_unlock(&ctx.spinlock);
+
+    tcthread_t threads[LOCK_NTHREADS];
+    int i;
+    for(i = 0; i < LOCK_NTHREADS; i++)
+        threads[i] = tcthread_create(0, run_spinlock, &ctx);
+    for(i = 0; i < LOCK_NTHREADS; i++)
+        tcthread_join(threads[i], NULL);
+    ASSERT_EQ(ctx.counter, LOCK_NTHREADS * LOCK_NITERS);
+))
+TEST(AMutex,(
+    struct lock_ctx ctx;
+    tcthread_amutex_init(&ctx.amutex);
+    ctx.counter = 0;
+    ASSERT_TRUE(tcthread_amutex_try_lock(&ctx.amutex));
+    ASSERT_FALSE(tcthread_amutex_try_lock(&ctx.amutex));
+    tcthread_amutex_unlock(&ctx.amutex);
+
+    tcthread_t threads[LOCK_NTHREADS];
+    int i;
+    for(i = 0; i < LOCK_NTHREADS; i++)
+        threads[i] = tcthread_create(0, run_amutex, &ctx);
+    for(i = 0; i < LOCK_NTHREADS; i++)
+        tcthread_join(threads[i], NULL);
+    ASSERT_EQ(ctx.counter, LOCK_NTHREADS * LOCK_NITERS);
+    ASSERT_EQ(ctx.amutex.state, 0);
+))
+TEST(Atomic_Wait,(
+    // returns immediately if the value differs
+    volatile tcthread_atomic32_t value = 1;
+    tcthread_atomic32_wait(&value, 0);
+
+    static const tcthread_atomic32_t sides[2] = { 0, 1 };
+    pingpong_turn = 0;
+    tcthread_t a = tcthread_create(0, run_pingpong, (void*)&sides[0]);
+    tcthread_t b = tcthread_create(0, run_pingpong, (void*)&sides[1]);
+    tcthread_join(a, NULL);
+    tcthread_join(b, NULL);
+    ASSERT_EQ(pingpong_turn, 0);
+
+    tcthread_t threads[LOCK_NTHREADS];
+    int i;
+    gate = 0;
+    gate_passed = 0;
+    for(i = 0; i < LOCK_NTHREADS; i++)
+        threads[i] = tcthread_create(0, run_gate, NULL);
+    tcthread_sleep(20);
+    ASSERT_EQ(gate_passed, 0);
+    tcthread_atomic32_store_explicit(&gate, 1, TCTHREAD_MEMORDER_RELEASE);
+    tcthread_atomic32_notify_all(&gate);
+    for(i = 0; i < LOCK_NTHREADS; i++)
+        tcthread_join(threads[i], NULL);
+    ASSERT_EQ(gate_passed, LOCK_NTHREADS);
+))
+
+TEST(Queue_SPSC,(
+    struct queue_ctx ctx;
+    void* item;
+    uintptr_t i;
+    ctx.spsc = tcthread_spsc_queue_create(5);   // rounded up to 8
+    ASSERT_TRUE(tcthread_spsc_queue_is_valid(ctx.spsc));
+    ASSERT_FALSE(tcthread_spsc_queue_try_pop(ctx.spsc, &item));
+    for(i = 0; i < 8; i++)
+        ASSERT_TRUE(tcthread_spsc_queue_try_push(ctx.spsc, (void*)i));
+    ASSERT_FALSE(tcthread_spsc_queue_try_push(ctx.spsc, NULL));
+    for(i = 0; i < 8; i++)
+    {
+        ASSERT_TRUE(tcthread_spsc_queue_try_pop(ctx.spsc, &item));
+        ASSERT_EQ((uintptr_t)item, i);
+    }
+    ASSERT_FALSE(tcthread_spsc_queue_try_pop(ctx.spsc, &item));
+    tcthread_spsc_queue_destroy(ctx.spsc);
+
+    ctx.spsc = tcthread_spsc_queue_create(256);
+    tcthread_t producer = tcthread_create(0, run_spsc_producer, &ctx);
+    for(i = 1; i <= QUEUE_NITEMS; i++)
+    {
+        while(!tcthread_spsc_queue_try_pop(ctx.spsc, &item))
+            tcthread_yield();
+        ASSERT_EQ((uintptr_t)item, i);
+    }
+    tcthread_join(producer, NULL);
+    tcthread_spsc_queue_destroy(ctx.spsc);
+))
+TEST(Queue_MPMC,(
+    struct queue_ctx ctx;
+    void* item;
+    uintptr_t i;
+    ctx.mpmc = tcthread_mpmc_queue_create(1);   // rounded up to 2
+    ASSERT_TRUE(tcthread_mpmc_queue_is_valid(ctx.mpmc));
+    ASSERT_FALSE(tcthread_mpmc_queue_try_pop(ctx.mpmc, &item));
+    ASSERT_TRUE(tcthread_mpmc_queue_try_push(ctx.mpmc, (void*)1));
+    ASSERT_TRUE(tcthread_mpmc_queue_try_push(ctx.mpmc, (void*)2));
+    ASSERT_FALSE(tcthread_mpmc_queue_try_push(ctx.mpmc, (void*)3));
+    for(i = 1; i <= 2; i++)
+    {
+        ASSERT_TRUE(tcthread_mpmc_queue_try_pop(ctx.mpmc, &item));
+        ASSERT_EQ((uintptr_t)item, i);
+    }
+    ASSERT_FALSE(tcthread_mpmc_queue_try_pop(ctx.mpmc, &item));
+    tcthread_mpmc_queue_destroy(ctx.mpmc);
+
+    ctx.mpmc = tcthread_mpmc_queue_create(256);
+    ctx.producer = 0;
+    ctx.npopped = 0;
+    ctx.sum = 0;
+    ctx.bad_order = 0;
+    tcthread_t producers[QUEUE_NTHREADS], consumers[QUEUE_NTHREADS];
+    for(i = 0; i < QUEUE_NTHREADS; i++)
+    {
+        producers[i] = tcthread_create(0, run_mpmc_producer, &ctx);
+        consumers[i] = tcthread_create(0, run_mpmc_consumer, &ctx);
+    }
+    for(i = 0; i < QUEUE_NTHREADS; i++)
+    {
+        tcthread_join(producers[i], NULL);
+        tcthread_join(consumers[i], NULL);
+    }
+    ASSERT_EQ(ctx.npopped, QUEUE_NTHREADS * QUEUE_NITEMS);
+    ASSERT_EQ(ctx.sum, (size_t)QUEUE_NTHREADS * QUEUE_NITEMS * (QUEUE_NITEMS + 1) / 2);
+    ASSERT_EQ(ctx.bad_order, 0);
+    tcthread_mpmc_queue_destroy(ctx.mpmc);
+))
+
+int main(void)
+{
+    TESTS_BEGIN();
+
+    TEST_HEADER("Lightweight Locks");
+        TEST_EXEC(Spinlock);
+        TEST_EXEC(AMutex);
+        TEST_EXEC(Atomic_Wait);
+    TEST_HEADER("Lock-Free Queues");
+        TEST_EXEC(Queue_SPSC);
+        TEST_EXEC(Queue_MPMC);
+    TEST_HEADER("Thread Pool");
+        TEST_EXEC(Pool_Create);
+        TEST_EXEC(Pool_Drain);
+        TEST_EXEC(Pool_ParallelFor);
+    TEST_HEADER("Jobs");
+        TEST_EXEC(Job_Parent);
+        TEST_EXEC(Job_Tree);
+        TEST_EXEC(Job_Then);
+        TEST_EXEC(Job_NestedWait);
+
+    TESTS_END();
+
+    return 0;
+}
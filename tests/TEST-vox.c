@@ -0,0 +1,373 @@
+#define TC_VOX_IMPLEMENTATION
+#include "../tc_vox.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "test.h"
+
+/* see `vox_models/generate-vox.py` */
+#define TESTDATA_ROOT   "../tests/vox_models"
+#define SX  20
+#define SY  11
+#define SZ  9
+static uint8_t vox_index(int32_t x, int32_t y, int32_t z)
+{
+    if(x < 0 || y < 0 || z < 0 || x >= SX || y >= SY || z >= SZ)
+        return 0;
+    if((x - 10) * (x - 10) + 2 * (y - 5) * (y - 5) + 3 * (z - 4) * (z - 4) >= 70 || (7 * x + 13 * y + 5 * z) % 17 == 0)
+        return 0;
+    return 1 + (x / 4 + y / 3 + z / 3) % 3;
+}
+
+/* neighbour in the direction of face bit `f` (i.e. `normal` of a mesh vertex) */
+static const int32_t face_dirs[6][3] = { {-1,0,0}, {+1,0,0}, {0,-1,0}, {0,+1,0}, {0,0,-1}, {0,0,+1} };
+static uint8_t vox_faces(int32_t x, int32_t y, int32_t z)
+{
+    uint8_t faces = 0;
+    for(int f = 0; f < 6; f++)
+        if(!vox_index(x + face_dirs[f][0], y + face_dirs[f][1], z + face_dirs[f][2]))
+            faces |= 1 << f;
+    return faces;
+}
+
+TEST(Model_Get,(
+    tcvox_scene_t scene;
+    if(!tcvox_load_fname(&scene, TESTDATA_ROOT "/scene.vox"))
+        fprintf(stderr, "    %s\n", scene.error);
+    ASSERT_NULL(scene.error);
+    ASSERT_EQ(scene.nmodels, 1);
+    tcvox_model_t* model = &scene.models[0];
+    ASSERT_EQ(model->size.x, SX);
+    ASSERT_EQ(model->size.y, SY);
+    ASSERT_EQ(model->size.z, SZ);
+
+    /* first via a linear search, then via the brick map (including positions outside of the model) */
+    int pass, x, y, z;
+    for(pass = 0; pass < 2; pass++)
+    {
+        if(pass)
+            ASSERT_TRUE(tcvox_model_build_bricks(model));
+        for(z = -1; z <= SZ; z++)
+            for(y = -1; y <= SY; y++)
+                for(x = -1; x <= SX; x++)
+                    ASSERT_EQ(tcvox_model_get(model, x, y, z), vox_index(x, y, z));
+    }
+    tcvox_unload(&scene);
+))
+TEST(Surface_Iter,(
+    tcvox_scene_t scene;
+    ASSERT_NOTNULL(tcvox_load_fname(&scene, TESTDATA_ROOT "/scene.vox"));
+    tcvox_model_t* model = &scene.models[0];
+    ASSERT_TRUE(tcvox_model_build_bricks(model));
+
+    static uint8_t seen[SZ][SY][SX];
+    memset(seen, 0, sizeof(seen));
+    size_t nseen = 0, nexpected = 0;
+    tcvox_surface_iter_t it = tcvox_model_iter_surface(model);
+    while(tcvox_surface_iter_next(&it))
+    {
+        int32_t x = it.pos.x, y = it.pos.y, z = it.pos.z;
+        ASSERT_TRUE(vox_index(x, y, z));
+        ASSERT_FALSE(seen[z][y][x]);
+        seen[z][y][x] = 1;
+        nseen++;
+        ASSERT_EQ(it.index, vox_index(x, y, z));
+        ASSERT_EQ(it.faces, vox_faces(x, y, z));
+    }
+    int x, y, z;
+    for(z = 0; z < SZ; z++)
+        for(y = 0; y < SY; y++)
+            for(x = 0; x < SX; x++)
+                if(vox_index(x, y, z) && vox_faces(x, y, z))
+                    nexpected++;
+    ASSERT_EQ(nseen, nexpected);
+    tcvox_unload(&scene);
+))
+
+/* `dedupe.vox` has the model of `scene.vox` 3 times; the 2nd one with a different index in the last voxel (in file order) */
+static void last_voxel(int32_t* px, int32_t* py, int32_t* pz)
+{
+    int32_t x, y, z;
+    for(z = SZ - 1; z >= 0; z--)
+        for(y = SY - 1; y >= 0; y--)
+            for(x = SX - 1; x >= 0; x--)
+                if(vox_index(x, y, z))
+                {
+                    *px = x; *py = y; *pz = z;
+                    return;
+                }
+}
+TEST(Model_Dedupe,(
+    tcvox_scene_t scene;
+    ASSERT_NOTNULL(tcvox_load_fname(&scene, TESTDATA_ROOT "/dedupe.vox"));
+    ASSERT_EQ(scene.nmodels, 3);
+
+    /* only the identical model is merged (into the first one), and shares its voxels */
+    ASSERT_NULL(scene.models[0].original);
+    ASSERT_NULL(scene.models[1].original);
+    ASSERT_TRUE(scene.models[2].original == &scene.models[0]);
+    ASSERT_TRUE(scene.models[2].voxels == scene.models[0].voxels);
+    ASSERT_TRUE(scene.models[1].voxels != scene.models[0].voxels);
+
+    int32_t lx, ly, lz, x, y, z;
+    last_voxel(&lx, &ly, &lz);
+    for(z = 0; z < SZ; z++)
+        for(y = 0; y < SY; y++)
+            for(x = 0; x < SX; x++)
+            {
+                uint8_t index = vox_index(x, y, z);
+                ASSERT_EQ(tcvox_model_get(&scene.models[0], x, y, z), index);
+                if(x == lx && y == ly && z == lz)
+                    index = index % 3 + 1;
+                ASSERT_EQ(tcvox_model_get(&scene.models[1], x, y, z), index);
+            }
+
+    /* the shape nodes refer to the original instead of the duplicate */
+    static const uint32_t shape_models[] = { 0, 1, 0 };
+    int nshapes = 0;
+    tcvox_iter_t it = tcvox_scene_iter_shapes(&scene, false);
+    while(tcvox_iter_next(&it))
+    {
+        ASSERT_LT(nshapes, 3);
+        ASSERT_EQ(it.shape->nmodels, 1);
+        ASSERT_TRUE(it.shape->models[0].model == &scene.models[shape_models[nshapes]]);
+        nshapes++;
+    }
+    ASSERT_EQ(nshapes, 3);
+    tcvox_unload(&scene);
+))
+
+/* `tcvox_load_memory()` copies everything it needs out of its input, so it must give the same scene as `tcvox_load_fname()` (which uses the mapping) */
+static int scenes_equal(tcvox_scene_t* a, tcvox_scene_t* b)
+{
+    if(a->nmodels != b->nmodels || memcmp(a->palette.abgr, b->palette.abgr, sizeof(a->palette.abgr)))
+        return 0;
+    for(uint32_t m = 0; m < a->nmodels; m++)
+    {
+        const tcvox_model_t* ma = &a->models[m];
+        const tcvox_model_t* mb = &b->models[m];
+        if(ma->size.x != mb->size.x || ma->size.y != mb->size.y || ma->size.z != mb->size.z || ma->nvoxels != mb->nvoxels)
+            return 0;
+        if(memcmp(ma->voxels, mb->voxels, ma->nvoxels * sizeof(*ma->voxels)))
+            return 0;
+        if((ma->original ? ma->original - a->models : -1) != (mb->original ? mb->original - b->models : -1))
+            return 0;
+    }
+    tcvox_iter_t ia = tcvox_scene_iter_shapes(a, false);
+    tcvox_iter_t ib = tcvox_scene_iter_shapes(b, false);
+    bool more;
+    while((more = tcvox_iter_next(&ia)) == tcvox_iter_next(&ib) && more)
+    {
+        int8_t ra[3][3], rb[3][3];
+        tcvox_rotation_to_mat3(ia.transform.r, ra);
+        tcvox_rotation_to_mat3(ib.transform.r, rb);
+        if(memcmp(ra, rb, sizeof(ra)) || ia.transform.t.x != ib.transform.t.x || ia.transform.t.y != ib.transform.t.y || ia.transform.t.z != ib.transform.t.z)
+            break;
+        if(ia.shape->models[0].model - a->models != ib.shape->models[0].model - b->models)
+            break;
+    }
+    return !more && ia.is_finished && ib.is_finished;
+}
+TEST(Load_Memory,(
+    static const char* const fnames[] = { TESTDATA_ROOT "/scene.vox", TESTDATA_ROOT "/dedupe.vox" };
+    for(size_t f = 0; f < sizeof(fnames) / sizeof(*fnames); f++)
+    {
+        FILE* file = fopen(fnames[f], "rb");
+        ASSERT_NOTNULL(file);
+        fseek(file, 0, SEEK_END);
+        long len = ftell(file);
+        fseek(file, 0, SEEK_SET);
+        char* data = malloc(len);
+        ASSERT_EQ(fread(data, 1, len, file), (size_t)len);
+        fclose(file);
+
+        tcvox_scene_t mscene, fscene;
+        ASSERT_NOTNULL(tcvox_load_memory(&mscene, data, len));
+        /* (so that anything still pointing into the buffer would show up as different, or as a use-after-free with ASan) */
+        memset(data, 0xAA, len);
+        free(data);
+        ASSERT_NOTNULL(tcvox_load_fname(&fscene, fnames[f]));
+        ASSERT_TRUE(scenes_equal(&mscene, &fscene));
+
+        int32_t x, y, z;
+        for(z = 0; z < SZ; z++)
+            for(y = 0; y < SY; y++)
+                for(x = 0; x < SX; x++)
+                    ASSERT_EQ(tcvox_model_get(&mscene.models[0], x, y, z), vox_index(x, y, z));
+        tcvox_unload(&mscene);
+        tcvox_unload(&fscene);
+    }
+))
+
+/*
+ * Checks the quads of one model instance (with transform `tf`) against the exposed faces of the model, in the same space:
+ * each face must be covered by exactly one quad of the same palette index, and each quad must be counter-clockwise when seen
+ * from outside (i.e. along its normal). Returns the number of faces covered, or -1 on failure.
+ */
+#define W   (2 * SX + 2)    /* (enough for any rotation of the model, plus a border) */
+static long check_quads(const tcvox_mesh_vertex_t* vertices, uint32_t nvertices, tcvox_transform_t tf)
+{
+    /* the model (as cells, in the transformed space), offset so that it fits into `world` */
+    static uint8_t world[W][W][W];
+    static uint8_t covered[W][W][W];
+    memset(world, 0, sizeof(world));
+    memset(covered, 0, sizeof(covered));
+    tcvox_ivec3_t origin = {{ tf.t.x - W / 2, tf.t.y - W / 2, tf.t.z - W / 2 }};
+
+    int32_t x, y, z, i, f;
+    for(z = 0; z < SZ; z++)
+        for(y = 0; y < SY; y++)
+            for(x = 0; x < SX; x++)
+            {
+                uint8_t index = vox_index(x, y, z);
+                if(!index) continue;
+                /* the cell spans (x,y,z) to (x+1,y+1,z+1); after the transform, its minimum can be either corner */
+                tcvox_ivec3_t a = tcvox_transform_apply(tf, (tcvox_ivec3_t){{ x - SX / 2, y - SY / 2, z - SZ / 2 }}, true);
+                tcvox_ivec3_t b = tcvox_transform_apply(tf, (tcvox_ivec3_t){{ x + 1 - SX / 2, y + 1 - SY / 2, z + 1 - SZ / 2 }}, true);
+                for(i = 0; i < 3; i++)
+                    a.xyz[i] = (a.xyz[i] < b.xyz[i] ? a.xyz[i] : b.xyz[i]) - origin.xyz[i];
+                world[a.z][a.y][a.x] = index;
+            }
+
+    long nfaces = 0;
+    uint32_t v;
+    for(v = 0; v < nvertices; v += 4)
+    {
+        const tcvox_mesh_vertex_t* q = &vertices[v];
+        uint8_t normal = q[0].normal, axis = normal >> 1;
+        int32_t p[4][3];
+        for(i = 0; i < 4; i++)
+        {
+            if(q[i].normal != normal || q[i].index != q[0].index)
+                return -1;
+            for(f = 0; f < 3; f++)
+                p[i][f] = q[i].xyz[f] - origin.xyz[f];
+            /* (a quad lies in the plane of its face) */
+            if(p[i][axis] != p[0][axis])
+                return -1;
+        }
+
+        /* counter-clockwise, seen from outside: both triangles' normals point along the outward normal */
+        for(i = 1; i <= 2; i++)
+        {
+            int32_t e0[3], e1[3];
+            for(f = 0; f < 3; f++)
+            {
+                e0[f] = p[i][f] - p[0][f];
+                e1[f] = p[i + 1][f] - p[0][f];
+            }
+            int32_t n[3] = { e0[1] * e1[2] - e0[2] * e1[1], e0[2] * e1[0] - e0[0] * e1[2], e0[0] * e1[1] - e0[1] * e1[0] };
+            if(n[0] * face_dirs[normal][0] + n[1] * face_dirs[normal][1] + n[2] * face_dirs[normal][2] <= 0)
+                return -1;
+        }
+
+        /* each face of the quad belongs to the cell on its inner side */
+        int32_t lo[3], hi[3];
+        for(f = 0; f < 3; f++)
+        {
+            lo[f] = hi[f] = p[0][f];
+            for(i = 1; i < 4; i++)
+            {
+                if(p[i][f] < lo[f]) lo[f] = p[i][f];
+                if(p[i][f] > hi[f]) hi[f] = p[i][f];
+            }
+        }
+        if(normal & 1) lo[axis]--;
+        hi[axis] = lo[axis] + 1;
+        for(z = lo[2]; z < hi[2]; z++)
+            for(y = lo[1]; y < hi[1]; y++)
+                for(x = lo[0]; x < hi[0]; x++)
+                {
+                    if(x < 1 || y < 1 || z < 1 || x >= W - 1 || y >= W - 1 || z >= W - 1)
+                        return -1;
+                    /* the cell must have this index, and the face must be exposed (and not covered yet) */
+                    if(world[z][y][x] != q[0].index || world[z + face_dirs[normal][2]][y + face_dirs[normal][1]][x + face_dirs[normal][0]])
+                        return -1;
+                    if(covered[z][y][x] & (1 << normal))
+                        return -1;
+                    covered[z][y][x] |= 1 << normal;
+                    nfaces++;
+                }
+    }
+
+    /* and every exposed face was covered */
+    for(z = 1; z < W - 1; z++)
+        for(y = 1; y < W - 1; y++)
+            for(x = 1; x < W - 1; x++)
+                if(world[z][y][x])
+                    for(f = 0; f < 6; f++)
+                        if(!world[z + face_dirs[f][2]][y + face_dirs[f][1]][x + face_dirs[f][0]] && !(covered[z][y][x] & (1 << f)))
+                            return -1;
+    return nfaces;
+}
+
+TEST(Mesh_Model,(
+    tcvox_scene_t scene;
+    ASSERT_NOTNULL(tcvox_load_fname(&scene, TESTDATA_ROOT "/scene.vox"));
+    tcvox_model_t* model = &scene.models[0];
+    ASSERT_TRUE(tcvox_model_build_mesh(model));
+    ASSERT_EQ(model->mesh.nvertices % 4, 0);
+
+    /* (in model space, i.e. undoing the centering that `check_quads()` does, as the scene mesh does it) */
+    tcvox_transform_t tf = tcvox_transform_identity;
+    tf.t = (tcvox_ivec3_t){{ SX / 2, SY / 2, SZ / 2 }};
+    long nfaces = check_quads(model->mesh.vertices, model->mesh.nvertices, tf);
+    ASSERT_GT(nfaces, 0);
+    /* (neighbouring faces were merged) */
+    ASSERT_LT(model->mesh.nvertices / 4, (uint32_t)nfaces);
+    tcvox_unload(&scene);
+))
+TEST(Mesh_Scene_Transforms,(
+    tcvox_scene_t scene;
+    ASSERT_NOTNULL(tcvox_load_fname(&scene, TESTDATA_ROOT "/scene.vox"));
+    size_t nvertices = tcvox_scene_get_mesh(&scene, NULL, 0, false);
+    ASSERT_EQ(nvertices, 4 * (size_t)scene.models[0].mesh.nvertices);
+    tcvox_mesh_vertex_t* vertices = malloc(nvertices * sizeof(*vertices));
+    ASSERT_EQ(tcvox_scene_get_mesh(&scene, vertices, nvertices, false), nvertices);
+
+    /* the shapes come out in the same order as the iterator visits them; with the mirrored root transform, 2 of the 4 are reflections */
+    size_t offset = 0;
+    int nshapes = 0, nreflections = 0;
+    tcvox_iter_t it = tcvox_scene_iter_shapes(&scene, false);
+    while(tcvox_iter_next(&it))
+    {
+        int8_t m[3][3];
+        tcvox_rotation_to_mat3(it.transform.r, m);
+        int det = m[0][0] * (m[1][1] * m[2][2] - m[1][2] * m[2][1])
+                - m[0][1] * (m[1][0] * m[2][2] - m[1][2] * m[2][0])
+                + m[0][2] * (m[1][0] * m[2][1] - m[1][1] * m[2][0]);
+        nreflections += det < 0;
+
+        uint32_t n = it.shape->models[0].model->mesh.nvertices;
+        long nfaces = check_quads(vertices + offset, n, it.transform);
+        if(nfaces < 0) fprintf(stderr, "    shape %d (determinant %d)\n", nshapes, det);
+        ASSERT_GT(nfaces, 0);
+        offset += n;
+        nshapes++;
+    }
+    ASSERT_EQ(nshapes, 4);
+    ASSERT_EQ(nreflections, 2);
+    ASSERT_EQ(offset, nvertices);
+
+    free(vertices);
+    tcvox_unload(&scene);
+))
+
+int main(void)
+{
+    TESTS_BEGIN();
+
+    TEST_HEADER("Voxels");
+        TEST_EXEC(Model_Get);
+        TEST_EXEC(Surface_Iter);
+    TEST_HEADER("Loading");
+        TEST_EXEC(Model_Dedupe);
+        TEST_EXEC(Load_Memory);
+    TEST_HEADER("Mesh");
+        TEST_EXEC(Mesh_Model);
+        TEST_EXEC(Mesh_Scene_Transforms);
+
+    TESTS_END();
+}
@@ -0,0 +1,1049 @@
+/* (for `tcxml_sax_process_parallel()`) */
+#define TC_THREAD_IMPLEMENTATION
+#include "../tc_thread.h"
+
+#define TC_XML_IMPLEMENTATION
+#include "../tc_xml.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+
+#include "test.h"
+
+/* all callbacks are recorded as one line of text each, so that two parses can be compared with a single `strcmp()` */
+typedef struct Log
+{
+    size_t mem, len;
+    char* ptr;
+} Log;
+
+static void log_append(Log* log, const char* str, size_t len)
+{
+    if(log->len + len + 1 > log->mem)
+    {
+        log->mem = (log->len + len + 1) * 2;
+        log->ptr = realloc(log->ptr, log->mem);
+    }
+    if(len) memcpy(log->ptr + log->len, str, len);
+    log->len += len;
+    log->ptr[log->len] = 0;
+}
+static void log_printf(Log* log, const char* format, ...)
+{
+    char buf[256];
+    va_list args;
+    va_start(args, format);
+    int len = vsnprintf(buf, sizeof(buf), format, args);
+    va_end(args);
+    log_append(log, buf, len);
+}
+/* (with the length, as strings can contain anything) */
+static void log_string(Log* log, tcxml_string_t str)
+{
+    log_printf(log, " %u:", (unsigned int)str.len);
+    log_append(log, str.ptr, str.len);
+}
+static void log_free(Log* log)
+{
+    free(log->ptr);
+    log->mem = log->len = 0;
+    log->ptr = NULL;
+}
+
+static void cb_start(void* udata)
+{
+    log_printf(udata, "start\n");
+}
+static void cb_end(void* udata)
+{
+    log_printf(udata, "end\n");
+}
+static void cb_xml_decl(tcxml_string_t version, tcxml_string_t encoding, bool* standalone, void* udata)
+{
+    log_printf(udata, "xml_decl");
+    log_string(udata, version);
+    log_string(udata, encoding);
+    log_printf(udata, " %d\n", standalone ? *standalone : -1);
+}
+static void cb_cdata(tcxml_string_t data, void* udata)
+{
+    log_printf(udata, "cdata");
+    log_string(udata, data);
+    log_printf(udata, "\n");
+}
+static void cb_text(tcxml_string_t text, size_t body_head, size_t body_tail, void* udata)
+{
+    log_printf(udata, "text");
+    log_string(udata, text);
+    log_printf(udata, " [%u,%u)\n", (unsigned int)body_head, (unsigned int)body_tail);
+}
+static void cb_element_start(tcxml_string_t tag, tcxml_string_t* attrs, size_t nattrs, void* udata)
+{
+    log_printf(udata, "element_start");
+    log_string(udata, tag);
+    for(size_t i = 0; i < 2 * nattrs; i++)
+        log_string(udata, attrs[i]);
+    log_printf(udata, "\n");
+}
+static void cb_element_end(tcxml_string_t tag, void* udata)
+{
+    log_printf(udata, "element_end");
+    log_string(udata, tag);
+    log_printf(udata, "\n");
+}
+static void cb_processing_instruction(tcxml_string_t target, tcxml_string_t body, void* udata)
+{
+    log_printf(udata, "processing_instruction");
+    log_string(udata, target);
+    log_string(udata, body);
+    log_printf(udata, "\n");
+}
+static void cb_comment(tcxml_string_t text, void* udata)
+{
+    log_printf(udata, "comment");
+    log_string(udata, text);
+    log_printf(udata, "\n");
+}
+
+static tcxml_sax_callbacks_t make_callbacks(uint32_t flags)
+{
+    tcxml_sax_callbacks_t cbs = {
+        .flags = flags,
+        .start = cb_start,
+        .end = cb_end,
+        .xml_decl = cb_xml_decl,
+        .cdata = cb_cdata,
+        .text = cb_text,
+        .element_start = cb_element_start,
+        .element_end = cb_element_end,
+        .processing_instruction = cb_processing_instruction,
+        .comment = cb_comment,
+    };
+    return cbs;
+}
+
+static tcxml_error_t parse_chunked(Log* log, const char* src, size_t chunk, const tcxml_sax_callbacks_t* cbs)
+{
+    size_t len = strlen(src), n;
+    tcxml_sax_context_t* ctx = tcxml_sax_begin(NULL, cbs, log);
+    for(; len; src += n, len -= n)
+    {
+        n = len < chunk ? len : chunk;
+        if(!TCXML_ERROR_IS_OK(tcxml_sax_feed(ctx, src, n)))
+            break;
+    }
+    return tcxml_sax_end(ctx);
+}
+
+static int errors_equal(tcxml_error_t a, tcxml_error_t b)
+{
+    if(!a.message || !b.message)
+        return a.message == b.message;
+    return a.offset == b.offset && a.line == b.line && a.column == b.column && !strcmp(a.message, b.message);
+}
+
+/* a root element with `n` records, with a bit of everything in each one */
+static char* make_records(size_t n, const char* bad)
+{
+    Log doc = {0};
+    log_printf(&doc, "<?xml version=\"1.0\"?>\n<!-- records -->\n<root>\n");
+    for(size_t i = 0; i < n; i++)
+    {
+        if(bad && i == n / 2)
+            log_printf(&doc, "%s\n", bad);
+        log_printf(&doc, "  <rec id=\"%u\" name='r&amp;%u'>text %u &lt;&#x263A;&gt;<![CDATA[<c>]]><?pi %u?><!--c--><e/></rec >\r\n", (unsigned int)i, (unsigned int)i, (unsigned int)i, (unsigned int)i);
+    }
+    log_printf(&doc, "</root>\n<!-- end -->\n");
+    return doc.ptr;
+}
+
+static const char* const valid_docs[] = {
+    "<a/>",
+    "<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"yes\"?>\n"
+    "<!-- comment --><?pi body?>\n"
+    "<root a=\"1\" b='x&amp;y' c=\"&quot;&apos;&#65;\">\n"
+    "  text &amp; more &lt;&gt; &#65;&#x42; \r\n"
+    "  <![CDATA[ <raw> & ]]><e/><f x=\"\t\"></f ><g>h&#233;llo w\xC3\xB6rld \xE6\x97\xA5\xE6\x9C\xAC</g>\n"
+    "</root>\n"
+    "<!-- trailing -->\n",
+    "<a>\r\n\r\n<b>\r</b>\n</a>",
+};
+static const char* const invalid_docs[] = {
+    "",
+    "<a><b></a>",
+    "<a>&foo;</a>",
+    "<a x=\"1></a>",
+    "<a x=\"1\" x></a>",
+    "<a>text",
+    "<a>x</a><b/>",
+    "<a><!-- x -- y --></a>",
+    "<a>&#x110000;</a>",
+    "<?xml version=\"2.0\"?><a/>",
+    "<a><![CDATA[ x ]></a>",
+};
+
+static const size_t chunk_sizes[] = { 1, 2, 3, 17, 4096 };
+static const uint32_t flag_sets[] = { 0, TCXML_BORROW_STRINGS, TCXML_VALIDATE_UTF8 };
+
+/* returns the index of the first chunk size that gives a different result, or -1 if there's none */
+static int check_chunked(const char* src)
+{
+    for(size_t f = 0; f < sizeof(flag_sets) / sizeof(*flag_sets); f++)
+    {
+        tcxml_sax_callbacks_t cbs = make_callbacks(flag_sets[f]);
+        Log expect = {0};
+        tcxml_error_t experr = tcxml_sax_process(NULL, src, &cbs, &expect);
+        for(size_t c = 0; c < sizeof(chunk_sizes) / sizeof(*chunk_sizes); c++)
+        {
+            Log log = {0};
+            tcxml_error_t err = parse_chunked(&log, src, chunk_sizes[c], &cbs);
+            int same = errors_equal(err, experr) && log.len == expect.len && !memcmp(log.ptr, expect.ptr, log.len);
+            if(!same)
+                fprintf(stderr, "    chunk size %u, flags 0x%x: `%s` (%u bytes of events) vs `%s` (%u bytes)\n",
+                    (unsigned int)chunk_sizes[c], (unsigned int)flag_sets[f],
+                    err.message ? err.message : "OK", (unsigned int)log.len,
+                    experr.message ? experr.message : "OK", (unsigned int)expect.len);
+            log_free(&log);
+            if(!same)
+            {
+                log_free(&expect);
+                return c;
+            }
+        }
+        log_free(&expect);
+    }
+    return -1;
+}
+
+TEST(Chunked_Valid,(
+    for(size_t i = 0; i < sizeof(valid_docs) / sizeof(*valid_docs); i++)
+    {
+        tcxml_sax_callbacks_t cbs = make_callbacks(0);
+        Log log = {0};
+        ASSERT_TRUE(TCXML_ERROR_IS_OK(tcxml_sax_process(NULL, valid_docs[i], &cbs, &log)));
+        log_free(&log);
+        ASSERT_EQ(check_chunked(valid_docs[i]), -1);
+    }
+))
+TEST(Chunked_Invalid,(
+    for(size_t i = 0; i < sizeof(invalid_docs) / sizeof(*invalid_docs); i++)
+    {
+        tcxml_sax_callbacks_t cbs = make_callbacks(0);
+        Log log = {0};
+        ASSERT_FALSE(TCXML_ERROR_IS_OK(tcxml_sax_process(NULL, invalid_docs[i], &cbs, &log)));
+        log_free(&log);
+        ASSERT_EQ(check_chunked(invalid_docs[i]), -1);
+    }
+))
+TEST(Chunked_Records,(
+    /* (large enough for the 4096-byte chunks to split items, too) */
+    char* doc = make_records(200, NULL);
+    ASSERT_EQ(check_chunked(doc), -1);
+    free(doc);
+
+    doc = make_records(200, "<rec><bad></rec>");
+    ASSERT_EQ(check_chunked(doc), -1);
+    free(doc);
+))
+
+/*
+ * For parallel parsing, each record's events go to a log of their own (a record is only ever parsed by one thread), and the logs
+ * are concatenated in order afterwards. Events outside of records are either before the first one, or from the root's end tag on.
+ */
+#define NTHREADS    4
+typedef struct RecordLogs
+{
+    size_t nrecords;
+    Log* records;
+    Log pre, post;
+    bool in_post;
+    bool bad_seq;
+    volatile tcthread_atomic32_t pooled;    // whether any events came from the pool's threads (i.e. the document wasn't just parsed serially)
+} RecordLogs;
+
+static Log* record_log(void* udata)
+{
+    tcxml_sax_record_t* record = udata;
+    RecordLogs* logs = record->udata;
+    if(record->seq == TCXML_SEQ_NONE)
+        return logs->in_post ? &logs->post : &logs->pre;
+    if(record->worker < NTHREADS)
+        tcthread_atomic32_store_explicit(&logs->pooled, 1, TCTHREAD_MEMORDER_RELAXED);
+    if(record->seq >= logs->nrecords)
+    {
+        logs->bad_seq = true;
+        return &logs->post;
+    }
+    return &logs->records[record->seq];
+}
+static void pcb_start(void* udata)
+{
+    cb_start(record_log(udata));
+}
+static void pcb_end(void* udata)
+{
+    cb_end(record_log(udata));
+}
+static void pcb_xml_decl(tcxml_string_t version, tcxml_string_t encoding, bool* standalone, void* udata)
+{
+    cb_xml_decl(version, encoding, standalone, record_log(udata));
+}
+static void pcb_cdata(tcxml_string_t data, void* udata)
+{
+    cb_cdata(data, record_log(udata));
+}
+static void pcb_text(tcxml_string_t text, size_t body_head, size_t body_tail, void* udata)
+{
+    cb_text(text, body_head, body_tail, record_log(udata));
+}
+static void pcb_element_start(tcxml_string_t tag, tcxml_string_t* attrs, size_t nattrs, void* udata)
+{
+    cb_element_start(tag, attrs, nattrs, record_log(udata));
+}
+static void pcb_element_end(tcxml_string_t tag, void* udata)
+{
+    tcxml_sax_record_t* record = udata;
+    /* (the only element outside of records is the root) */
+    if(record->seq == TCXML_SEQ_NONE)
+        ((RecordLogs*)record->udata)->in_post = true;
+    cb_element_end(tag, record_log(udata));
+}
+static void pcb_processing_instruction(tcxml_string_t target, tcxml_string_t body, void* udata)
+{
+    cb_processing_instruction(target, body, record_log(udata));
+}
+static void pcb_comment(tcxml_string_t text, void* udata)
+{
+    cb_comment(text, record_log(udata));
+}
+
+/* `nrecords` only needs to be an upper bound; `pooled` is set if the document was (at least partly) parsed by the pool */
+static int check_parallel(const char* src, size_t nrecords, tcthread_pool_t pool, bool* pooled)
+{
+    if(pooled) *pooled = false;
+    for(size_t f = 0; f < sizeof(flag_sets) / sizeof(*flag_sets); f++)
+    {
+        tcxml_sax_callbacks_t cbs = make_callbacks(flag_sets[f]);
+        Log expect = {0};
+        tcxml_error_t experr = tcxml_sax_process(NULL, src, &cbs, &expect);
+
+        tcxml_sax_callbacks_t pcbs = {
+            .flags = flag_sets[f],
+            .start = pcb_start,
+            .end = pcb_end,
+            .xml_decl = pcb_xml_decl,
+            .cdata = pcb_cdata,
+            .text = pcb_text,
+            .element_start = pcb_element_start,
+            .element_end = pcb_element_end,
+            .processing_instruction = pcb_processing_instruction,
+            .comment = pcb_comment,
+        };
+        RecordLogs logs = {0};
+        logs.nrecords = nrecords;
+        logs.records = calloc(nrecords, sizeof(*logs.records));
+        tcxml_error_t err = tcxml_sax_process_parallel(NULL, src, &pcbs, &logs, pool);
+        if(pooled && logs.pooled) *pooled = true;
+
+        Log log = {0};
+        log_append(&log, logs.pre.ptr, logs.pre.len);
+        for(size_t i = 0; i < nrecords; i++)
+        {
+            log_append(&log, logs.records[i].ptr, logs.records[i].len);
+            log_free(&logs.records[i]);
+        }
+        log_append(&log, logs.post.ptr, logs.post.len);
+        free(logs.records);
+        log_free(&logs.pre);
+        log_free(&logs.post);
+
+        /* on error, records after the one with the error may have been parsed as well */
+        int same = !logs.bad_seq && errors_equal(err, experr) && (experr.message ? log.len >= expect.len : log.len == expect.len) && !memcmp(log.ptr, expect.ptr, expect.len);
+        if(!same)
+            fprintf(stderr, "    flags 0x%x: `%s` (%u bytes of events) vs `%s` (%u bytes)\n", (unsigned int)flag_sets[f],
+                err.message ? err.message : "OK", (unsigned int)log.len,
+                experr.message ? experr.message : "OK", (unsigned int)expect.len);
+        log_free(&log);
+        log_free(&expect);
+        if(!same)
+            return 0;
+    }
+    return 1;
+}
+
+TEST(Parallel_Records,(
+    tcthread_pool_t pool = tcthread_pool_create(NTHREADS, 0);
+    ASSERT_TRUE(tcthread_pool_is_valid(pool));
+
+    /* (large enough to be split into several ranges of records) */
+    bool pooled;
+    char* doc = make_records(5000, NULL);
+    ASSERT_TRUE(check_parallel(doc, 5000, pool, &pooled));
+    ASSERT_TRUE(pooled);
+    free(doc);
+
+    tcthread_pool_destroy(pool);
+))
+TEST(Parallel_Records_Invalid,(
+    /* (mismatched tags throw the pre-scan's element depth off, so such a document is parsed serially) */
+    static const struct { const char* xml; bool pooled; } bad[] = {
+        { "<rec><bad></rec>", false },
+        { "<rec x=\"1\" x></rec>", true },
+        { "<rec>&foo;</rec>", true },
+        { "<rec><!-- x -- y --></rec>", true },
+    };
+    tcthread_pool_t pool = tcthread_pool_create(NTHREADS, 0);
+    ASSERT_TRUE(tcthread_pool_is_valid(pool));
+
+    bool pooled;
+    for(size_t i = 0; i < sizeof(bad) / sizeof(*bad); i++)
+    {
+        char* doc = make_records(5000, bad[i].xml);
+        ASSERT_TRUE(check_parallel(doc, 5001, pool, &pooled));
+        ASSERT_EQ(pooled, bad[i].pooled);
+        free(doc);
+    }
+
+    /* an error after the root element */
+    char* doc = make_records(5000, NULL);
+    doc = realloc(doc, strlen(doc) + sizeof("<x/>"));
+    strcat(doc, "<x/>");
+    ASSERT_TRUE(check_parallel(doc, 5000, pool, &pooled));
+    ASSERT_TRUE(pooled);
+    free(doc);
+
+    tcthread_pool_destroy(pool);
+))
+TEST(Parallel_Fallback,(
+    /* (too few records to split up, or not well-formed enough for the pre-scan; these are parsed serially) */
+    tcthread_pool_t pool = tcthread_pool_create(NTHREADS, 0);
+    ASSERT_TRUE(tcthread_pool_is_valid(pool));
+
+    size_t i;
+    for(i = 0; i < sizeof(valid_docs) / sizeof(*valid_docs); i++)
+        ASSERT_TRUE(check_parallel(valid_docs[i], 16, pool, NULL));
+    for(i = 0; i < sizeof(invalid_docs) / sizeof(*invalid_docs); i++)
+        ASSERT_TRUE(check_parallel(invalid_docs[i], 16, pool, NULL));
+
+    tcthread_pool_destroy(pool);
+))
+
+/* these were once broken, in push mode or both modes */
+static int check_events(const char* src, const char* expect)
+{
+    tcxml_sax_callbacks_t cbs = make_callbacks(0);
+    cbs.start = cbs.end = NULL;
+    Log log = {0};
+    tcxml_error_t err = tcxml_sax_process(NULL, src, &cbs, &log);
+    if(!err.message && log.ptr && !strcmp(log.ptr, expect))
+    {
+        log_free(&log);
+        err = parse_chunked(&log, src, 1, &cbs);
+    }
+    int ok = !err.message && log.ptr && !strcmp(log.ptr, expect);
+    if(!ok)
+        fprintf(stderr, "    `%s`:\n%s    %s\n", src, log.ptr ? log.ptr : "", err.message ? err.message : "");
+    log_free(&log);
+    return ok;
+}
+TEST(Fixed_References_In_Text,(
+    ASSERT_TRUE(check_events("<a>x &amp; y&#33;&lt;</a>",
+        "element_start 1:a\n"
+        "text 7:x & y!< [0,7)\n"
+        "element_end 1:a\n"));
+))
+TEST(Fixed_End_Tag_Whitespace,(
+    ASSERT_TRUE(check_events("<a><b></b ></a\t\n>",
+        "element_start 1:a\n"
+        "element_start 1:b\n"
+        "element_end 1:b\n"
+        "element_end 1:a\n"));
+))
+TEST(Fixed_Attribute_Reference,(
+    ASSERT_TRUE(check_events("<a x=\"x&amp;y\"/>",
+        "element_start 1:a 1:x 3:x&y\n"
+        "element_end 1:a\n"));
+))
+
+/* records each string as borrowed (`b`) or copied (`c`), marked with `!` if a borrowed one isn't in the source, or a copied one is (or isn't `\0`-terminated) */
+typedef struct Borrow
+{
+    /* the source is either `[head,tail)`, or (in push mode) the unparsed input in `bufs` */
+    const char* head;
+    const char* tail;
+    const tcxml_sax_buffers_t* bufs;
+    Log log;
+} Borrow;
+static void borrow_string(Borrow* b, tcxml_string_t str)
+{
+    const char* head = b->bufs ? b->bufs->input.ptr : b->head;
+    const char* tail = b->bufs ? b->bufs->input.ptr + b->bufs->input.len : b->tail;
+    bool inside = head <= str.ptr && str.ptr + str.len <= tail;
+    bool ok = str.borrowed ? inside : !inside && !str.ptr[str.len];
+    log_printf(&b->log, " %c%s:", str.borrowed ? 'b' : 'c', ok ? "" : "!");
+    log_append(&b->log, str.ptr, str.len);
+}
+static void borrow_cdata(tcxml_string_t data, void* udata)
+{
+    log_printf(&((Borrow*)udata)->log, "cdata");
+    borrow_string(udata, data);
+    log_printf(&((Borrow*)udata)->log, "\n");
+}
+static void borrow_text(tcxml_string_t text, size_t body_head, size_t body_tail, void* udata)
+{
+    (void)body_head; (void)body_tail;
+    log_printf(&((Borrow*)udata)->log, "text");
+    borrow_string(udata, text);
+    log_printf(&((Borrow*)udata)->log, "\n");
+}
+static void borrow_element_start(tcxml_string_t tag, tcxml_string_t* attrs, size_t nattrs, void* udata)
+{
+    log_printf(&((Borrow*)udata)->log, "element_start");
+    borrow_string(udata, tag);
+    for(size_t i = 0; i < 2 * nattrs; i++)
+        borrow_string(udata, attrs[i]);
+    log_printf(&((Borrow*)udata)->log, "\n");
+}
+static void borrow_element_end(tcxml_string_t tag, void* udata)
+{
+    log_printf(&((Borrow*)udata)->log, "element_end");
+    borrow_string(udata, tag);
+    log_printf(&((Borrow*)udata)->log, "\n");
+}
+static void borrow_processing_instruction(tcxml_string_t target, tcxml_string_t body, void* udata)
+{
+    log_printf(&((Borrow*)udata)->log, "processing_instruction");
+    borrow_string(udata, target);
+    borrow_string(udata, body);
+    log_printf(&((Borrow*)udata)->log, "\n");
+}
+static void borrow_comment(tcxml_string_t text, void* udata)
+{
+    log_printf(&((Borrow*)udata)->log, "comment");
+    borrow_string(udata, text);
+    log_printf(&((Borrow*)udata)->log, "\n");
+}
+static const tcxml_sax_callbacks_t borrow_callbacks = {
+    .flags = TCXML_BORROW_STRINGS,
+    .cdata = borrow_cdata,
+    .text = borrow_text,
+    .element_start = borrow_element_start,
+    .element_end = borrow_element_end,
+    .processing_instruction = borrow_processing_instruction,
+    .comment = borrow_comment,
+};
+
+static const char borrow_doc[] =
+    "<root a=\"1\" b='x&amp;y' c=\"l1\r\nl2\rl3\">"
+    "plain<![CDATA[c1\r\nc2]]><![CDATA[cd]]>t&lt;u<!--c--><?pi body?>"
+    "</root>";
+static const char borrow_events[] =
+    "element_start b:root b:a b:1 b:b c:x&y b:c c:l1\nl2\nl3\n"
+    "text b:plain\n"
+    "cdata c:c1\nc2\n"
+    "cdata b:cd\n"
+    "text c:t<u\n"
+    "comment b:c\n"
+    "processing_instruction b:pi b:body\n"
+    "element_end b:root\n";
+
+TEST(Borrow_Slices,(
+    Borrow b = { borrow_doc, borrow_doc + sizeof(borrow_doc) - 1, NULL, {0} };
+    ASSERT_TRUE(TCXML_ERROR_IS_OK(tcxml_sax_process(NULL, borrow_doc, &borrow_callbacks, &b)));
+    ASSERT_STREQ(b.log.ptr, borrow_events);
+    log_free(&b.log);
+
+    /* without the flag, everything is copied */
+    tcxml_sax_callbacks_t cbs = borrow_callbacks;
+    cbs.flags = 0;
+    b = (Borrow){ borrow_doc, borrow_doc + sizeof(borrow_doc) - 1, NULL, {0} };
+    ASSERT_TRUE(TCXML_ERROR_IS_OK(tcxml_sax_process(NULL, borrow_doc, &cbs, &b)));
+    ASSERT_EQ(strstr(b.log.ptr, " b:"), NULL);
+    ASSERT_EQ(strchr(b.log.ptr, '!'), NULL);
+    log_free(&b.log);
+))
+TEST(Borrow_Push,(
+    tcxml_sax_buffers_t bufs;
+    ASSERT_NOTNULL(tcxml_sax_buffers_init(&bufs));
+    for(size_t c = 0; c < sizeof(chunk_sizes) / sizeof(*chunk_sizes); c++)
+    {
+        /* each chunk is overwritten right after it was fed, so strings must come from the parser's own copy of the input */
+        char chunk[4096];
+        Borrow b = { NULL, NULL, &bufs, {0} };
+        tcxml_sax_context_t* ctx = tcxml_sax_begin(&bufs, &borrow_callbacks, &b);
+        ASSERT_NOTNULL(ctx);
+        const char* src = borrow_doc;
+        size_t len = sizeof(borrow_doc) - 1, n;
+        for(; len; src += n, len -= n)
+        {
+            n = len < chunk_sizes[c] ? len : chunk_sizes[c];
+            memcpy(chunk, src, n);
+            ASSERT_TRUE(TCXML_ERROR_IS_OK(tcxml_sax_feed(ctx, chunk, n)));
+            memset(chunk, '#', n);
+        }
+        ASSERT_TRUE(TCXML_ERROR_IS_OK(tcxml_sax_end(ctx)));
+        ASSERT_STREQ(b.log.ptr, borrow_events);
+        log_free(&b.log);
+    }
+    tcxml_sax_buffers_deinit(&bufs);
+))
+
+/* a straightforward decoder, as a reference for `tcxml_utf8_validate()` */
+static size_t ref_utf8_validate(const char* utf8, size_t len)
+{
+    const unsigned char* u = (const unsigned char*)utf8;
+    size_t i = 0, n, k;
+    while(i < len)
+    {
+        uint32_t c = u[i], min;
+        if(c < 0x80) { n = 1; min = 0; }
+        else if((c & 0xE0) == 0xC0) { n = 2; min = 0x80; c &= 0x1F; }
+        else if((c & 0xF0) == 0xE0) { n = 3; min = 0x800; c &= 0x0F; }
+        else if((c & 0xF8) == 0xF0) { n = 4; min = 0x10000; c &= 0x07; }
+        else return i;
+        if(len - i < n)
+            return i;
+        for(k = 1; k < n; k++)
+        {
+            if((u[i + k] & 0xC0) != 0x80)
+                return i;
+            c = c << 6 | (u[i + k] & 0x3F);
+        }
+        if(c < min || c > 0x10FFFF || (0xD800 <= c && c <= 0xDFFF))
+            return i;
+        i += n;
+    }
+    return len;
+}
+
+static const unsigned int accels[] = { TCXML_ACCEL_NONE, TCXML_ACCEL_X86_SSE2, TCXML_ACCEL_ALL };
+
+/* random mixes of ASCII runs (of various lengths, to hit every position within a SIMD block) and multi-byte sequences, some of them invalid */
+static uint32_t rng_state = 1;
+static uint32_t rng(void)
+{
+    rng_state = rng_state * 1664525u + 1013904223u;
+    return rng_state >> 8;
+}
+static size_t make_utf8(char* buf, size_t mem, bool invalid)
+{
+    static const char* const valid_seqs[] = { "\xC2\x80", "\xDF\xBF", "\xC3\xB6", "\xE0\xA0\x80", "\xE6\x97\xA5", "\xED\x9F\xBF", "\xEE\x80\x80", "\xEF\xBF\xBF",
+        "\xF0\x90\x80\x80", "\xF0\x9F\x98\x80", "\xF3\xBF\xBF\xBF", "\xF4\x8F\xBF\xBF" };
+    static const char* const invalid_seqs[] = { "\x80", "\xBF", "\xC0\x80", "\xC1\xBF", "\xE0\x9F\xBF", "\xED\xA0\x80", "\xED\xBF\xBF", "\xF0\x8F\xBF\xBF",
+        "\xF4\x90\x80\x80", "\xF5\x80\x80\x80", "\xF8\x88\x80\x80\x80", "\xFF", "\xF0\x9F\x98", "\xE6\x97", "\xC3", "\xF0\x9F\x98\x41" };
+    size_t len = 0;
+    while(len + 64 < mem)
+    {
+        size_t run = rng() % 40;
+        while(run--)
+            buf[len++] = 'a' + rng() % 26;
+        const char* seq = invalid && !(rng() % 8)
+            ? invalid_seqs[rng() % (sizeof(invalid_seqs) / sizeof(*invalid_seqs))]
+            : valid_seqs[rng() % (sizeof(valid_seqs) / sizeof(*valid_seqs))];
+        memcpy(buf + len, seq, strlen(seq));
+        len += strlen(seq);
+        if(!(rng() % 16))
+            break;
+    }
+    return len;
+}
+
+TEST(UTF8_Validate,(
+    char buf[512];
+    volatile size_t a;  /* (volatile, as it's modified between `setjmp()` and a possible `longjmp()`) */
+    size_t i, n;
+    for(a = 0; a < sizeof(accels) / sizeof(*accels); a++)
+    {
+        tcxml_accel_set(accels[a]);
+        rng_state = 1;
+        for(i = 0; i < 400; i++)
+        {
+            size_t len = make_utf8(buf, sizeof(buf), i & 1);
+            /* every prefix, so that sequences are also cut short */
+            for(n = 0; n <= len; n++)
+                ASSERT_EQ(tcxml_utf8_validate(buf, n), ref_utf8_validate(buf, n));
+        }
+    }
+    tcxml_accel_set(TCXML_ACCEL_ALL);
+))
+TEST(UTF8_Four_Byte,(
+    static const struct { uint32_t utf32; const char* utf8; } valid[] = {
+        { 0x10000, "\xF0\x90\x80\x80" },
+        { 0x1F600, "\xF0\x9F\x98\x80" },
+        { 0x10FFFF, "\xF4\x8F\xBF\xBF" },
+    };
+    char utf8[4];
+    uint32_t utf32;
+    size_t i;
+    for(i = 0; i < sizeof(valid) / sizeof(*valid); i++)
+    {
+        ASSERT_EQ(tcxml_utf8_from_utf32(utf8, valid[i].utf32), 4);
+        ASSERT_MEMEQ(utf8, 4, valid[i].utf8, 4);
+        ASSERT_EQ(tcxml_utf32_from_utf8(&utf32, valid[i].utf8, 4), 4);
+        ASSERT_EQ(utf32, valid[i].utf32);
+        ASSERT_EQ(tcxml_utf8_validate(valid[i].utf8, 4), 4);
+        /* (truncated) */
+        ASSERT_EQ(tcxml_utf32_from_utf8(&utf32, valid[i].utf8, 3), 0);
+        ASSERT_EQ(tcxml_utf8_validate(valid[i].utf8, 3), 0);
+    }
+    ASSERT_EQ(tcxml_utf8_from_utf32(utf8, 0x110000), 0);
+    ASSERT_EQ(tcxml_utf32_from_utf8(&utf32, "\xF0\x9F\x98\x41", 4), 0);
+    ASSERT_EQ(tcxml_utf8_validate("\xF4\x90\x80\x80", 4), 0);
+    ASSERT_EQ(tcxml_utf8_validate("\xF0\x8F\xBF\xBF", 4), 0);
+    ASSERT_EQ(tcxml_utf8_validate("x\xF0\x9F\x98\x80\xF5\x80\x80\x80", 9), 5);
+
+    /* character references are encoded as UTF-8, and raw 4-byte sequences pass through */
+    ASSERT_TRUE(check_events("<a x=\"&#x10FFFF;\">&#x1F600;\xF0\x9F\x98\x80</a>",
+        "element_start 1:a 1:x 4:\xF4\x8F\xBF\xBF\n"
+        "text 8:\xF0\x9F\x98\x80\xF0\x9F\x98\x80 [0,8)\n"
+        "element_end 1:a\n"));
+
+    /* and invalid ones are caught by `TCXML_VALIDATE_UTF8` (in push mode, too) */
+    static const char* const invalid[] = {
+        "<a>\xF4\x90\x80\x80</a>",
+        "<a>\xF0\x8F\xBF\xBF</a>",
+        "<a>\xF0\x9F\x98</a>",
+        "<a x=\"\xF5\x80\x80\x80\"/>",
+        "<a><!-- \xF0\x9F\x98\x41 --></a>",
+    };
+    tcxml_sax_callbacks_t cbs = make_callbacks(TCXML_VALIDATE_UTF8);
+    for(i = 0; i < sizeof(invalid) / sizeof(*invalid); i++)
+    {
+        Log log = {0};
+        ASSERT_FALSE(TCXML_ERROR_IS_OK(tcxml_sax_process(NULL, invalid[i], &cbs, &log)));
+        log_free(&log);
+        ASSERT_EQ(check_chunked(invalid[i]), -1);
+    }
+))
+TEST(Accel_Parse,(
+    /* documents with long runs of text, attributes & whitespace, as these are what is scanned with SIMD */
+    char text[512];
+    size_t len;
+    rng_state = 7;
+    do len = make_utf8(text, sizeof(text), false);
+    while(len < 128);
+    Log doc = {0};
+    log_printf(&doc, "<root>\n");
+    /* (shifted by a few bytes each time, to start the runs at every position within a SIMD block) */
+    for(int r = 0; r < 64; r++)
+    {
+        log_printf(&doc, "%*s<item a=\"%.*s", r % 37, "", r, "................................................................");
+        log_append(&doc, text, len);
+        log_printf(&doc, "\"   b='%d'>%*s", r, r, "");
+        log_append(&doc, text, len);
+        log_printf(&doc, "&amp;<!--%*s", r, "");
+        log_append(&doc, text, len);
+        log_printf(&doc, "--><![CDATA[%*s", r, "");
+        log_append(&doc, text, len);
+        log_printf(&doc, "]]></item  >\r\n");
+    }
+    log_printf(&doc, "</root>\n");
+
+    const char* docs[sizeof(valid_docs) / sizeof(*valid_docs) + sizeof(invalid_docs) / sizeof(*invalid_docs) + 2];
+    size_t ndocs = 0, i, f;
+    for(i = 0; i < sizeof(valid_docs) / sizeof(*valid_docs); i++)
+        docs[ndocs++] = valid_docs[i];
+    for(i = 0; i < sizeof(invalid_docs) / sizeof(*invalid_docs); i++)
+        docs[ndocs++] = invalid_docs[i];
+    char* records = make_records(200, NULL);
+    docs[ndocs++] = records;
+    docs[ndocs++] = doc.ptr;
+    tcxml_sax_callbacks_t cbs0 = make_callbacks(TCXML_VALIDATE_UTF8);
+    Log log0 = {0};
+    ASSERT_TRUE(TCXML_ERROR_IS_OK(tcxml_sax_process(NULL, doc.ptr, &cbs0, &log0)));
+    log_free(&log0);
+
+    /* every level must give the same events (and errors) as the scalar code */
+    volatile size_t a;
+    for(i = 0; i < ndocs; i++)
+        for(f = 0; f < sizeof(flag_sets) / sizeof(*flag_sets); f++)
+        {
+            tcxml_sax_callbacks_t cbs = make_callbacks(flag_sets[f]);
+            Log expect = {0};
+            tcxml_accel_set(TCXML_ACCEL_NONE);
+            ASSERT_EQ(tcxml_accel_get(), TCXML_ACCEL_NONE);
+            tcxml_error_t experr = tcxml_sax_process(NULL, docs[i], &cbs, &expect);
+            for(a = 1; a < sizeof(accels) / sizeof(*accels); a++)
+            {
+                ASSERT_EQ(tcxml_accel_set(accels[a]), accels[a] & tcxml_accel_get_supported());
+                Log log = {0};
+                tcxml_error_t err = tcxml_sax_process(NULL, docs[i], &cbs, &log);
+                int same = errors_equal(err, experr) && log.len == expect.len && !memcmp(log.ptr, expect.ptr, log.len);
+                log_free(&log);
+                if(!same) fprintf(stderr, "    document %u, flags 0x%x, accel 0x%x\n", (unsigned int)i, (unsigned int)flag_sets[f], accels[a]);
+                ASSERT_TRUE(same);
+            }
+            log_free(&expect);
+        }
+    tcxml_accel_set(TCXML_ACCEL_ALL);
+    free(records);
+    log_free(&doc);
+))
+
+/*
+ * The DOM is compared as text: the tree is written out depth-first, checking the links on the way (each child's `parent`, and
+ * the parent's `last_child`). Returns 0 if a link is wrong.
+ */
+static int dom_dump(Log* log, const tcxml_dom_t* dom, uint32_t index)
+{
+    const tcxml_dom_node_t* node = &dom->nodes.ptr[index];
+    static const char* const types[] = { "xml_decl", "cdata", "text", "element", "pi", "comment", "document" };
+    log_printf(log, "(%s", types[node->type]);
+    if(node->name != TCXML_DOM_NONE)
+        log_string(log, dom->names.ptr[node->name]);
+    for(uint32_t a = 0; a < node->nattrs; a++)
+    {
+        log_string(log, dom->names.ptr[dom->attrs.ptr[node->attr_head + a].name]);
+        log_string(log, dom->attrs.ptr[node->attr_head + a].value);
+    }
+    if(node->text.ptr)
+        log_string(log, node->text);
+    uint32_t child, last = TCXML_DOM_NONE;
+    for(child = node->first_child; child != TCXML_DOM_NONE; child = dom->nodes.ptr[child].next_sibling)
+    {
+        if(dom->nodes.ptr[child].parent != index || !dom_dump(log, dom, child))
+            return 0;
+        last = child;
+    }
+    log_printf(log, ")");
+    return node->last_child == last;
+}
+static char* dom_string(const tcxml_dom_t* dom)
+{
+    Log log = {0};
+    if(!dom_dump(&log, dom, 0) || dom->nodes.ptr[0].parent != TCXML_DOM_NONE)
+        log_free(&log);
+    return log.ptr;
+}
+
+TEST(DOM_Links,(
+    tcxml_dom_t dom;
+    tcxml_dom_init(&dom);
+    ASSERT_TRUE(TCXML_ERROR_IS_OK(tcxml_dom_parse(&dom, NULL,
+        "<?xml version=\"1.0\" standalone=\"no\"?><!--c--><list n=\"3\">"
+        "<item id=\"a\">x &amp; y</item>"
+        "<?pi body?>"
+        "<other/>"
+        "<item id=\"b\" extra=\"\"><![CDATA[<z>]]></item>"
+        "<item/>"
+        "</list>", 0)));
+
+    char* str = dom_string(&dom);
+    ASSERT_NOTNULL(str);
+    ASSERT_STREQ(str,
+        "(document"
+        "(xml_decl 3:xml 7:version 3:1.0 10:standalone 2:no)"
+        "(comment 1:c)"
+        "(element 4:list 1:n 1:3"
+        "(element 4:item 2:id 1:a(text 5:x & y))"
+        "(pi 2:pi 4:body)"
+        "(element 5:other)"
+        "(element 4:item 2:id 1:b 5:extra 0:(cdata 3:<z>))"
+        "(element 4:item)))");
+    free(str);
+
+    uint32_t list = tcxml_dom_root(&dom), item = tcxml_dom_name_find(&dom, "item"), id = tcxml_dom_name_find(&dom, "id");
+    ASSERT_NE(list, TCXML_DOM_NONE);
+    ASSERT_STREQ(dom.names.ptr[dom.nodes.ptr[list].name].ptr, "list");
+    ASSERT_EQ(dom.nodes.ptr[list].parent, 0);
+    ASSERT_EQ(tcxml_dom_name_find(&dom, "missing"), TCXML_DOM_NONE);
+
+    /* walking `item` elements skips the other children */
+    static const char* const ids[] = { "a", "b", NULL };
+    uint32_t i = tcxml_dom_first_element(&dom, list, item);
+    for(size_t n = 0; n < 3; n++, i = tcxml_dom_next_element(&dom, i, item))
+    {
+        ASSERT_NE(i, TCXML_DOM_NONE);
+        ASSERT_EQ(dom.nodes.ptr[i].parent, list);
+        const tcxml_string_t* value = tcxml_dom_attr_find(&dom, i, id);
+        if(ids[n])
+            ASSERT_TRUE(value && !strcmp(value->ptr, ids[n]));
+        else
+            ASSERT_NULL(value);
+    }
+    ASSERT_EQ(i, TCXML_DOM_NONE);
+    ASSERT_EQ(tcxml_dom_next_element(&dom, tcxml_dom_first_element(&dom, list, TCXML_DOM_NONE), TCXML_DOM_NONE), tcxml_dom_first_element(&dom, list, tcxml_dom_name_find(&dom, "other")));
+    ASSERT_NULL(tcxml_dom_attr_find(&dom, list, id));
+    ASSERT_NULL(tcxml_dom_attr_find(&dom, list, TCXML_DOM_NONE));
+    ASSERT_EQ(tcxml_dom_first_element(&dom, TCXML_DOM_NONE, TCXML_DOM_NONE), TCXML_DOM_NONE);
+    tcxml_dom_deinit(&dom);
+))
+TEST(DOM_Interning,(
+    /* (enough distinct names to grow the hash table a few times; each is used by an element and an attribute) */
+    Log doc = {0};
+    log_printf(&doc, "<root>");
+    for(unsigned int i = 0; i < 300; i++)
+        log_printf(&doc, "<n%u n%u=\"%u\"/><n%u/>", i, (i * 7) % 300, i, i);
+    log_printf(&doc, "</root>");
+
+    tcxml_dom_t dom;
+    tcxml_dom_init(&dom);
+    ASSERT_TRUE(TCXML_ERROR_IS_OK(tcxml_dom_parse(&dom, NULL, doc.ptr, 0)));
+    ASSERT_EQ(dom.names.len, 301);
+
+    char name[16];
+    uint32_t root = tcxml_dom_root(&dom), e = tcxml_dom_first_element(&dom, root, TCXML_DOM_NONE);
+    for(unsigned int i = 0; i < 300; i++)
+    {
+        snprintf(name, sizeof(name), "n%u", i);
+        uint32_t index = tcxml_dom_name_find(&dom, name);
+        ASSERT_NE(index, TCXML_DOM_NONE);
+        ASSERT_STREQ(dom.names.ptr[index].ptr, name);
+
+        /* both elements, and the attribute on the (i * 7)th, share the same string */
+        uint32_t e2 = tcxml_dom_next_element(&dom, e, TCXML_DOM_NONE);
+        ASSERT_EQ(dom.nodes.ptr[e].name, index);
+        ASSERT_EQ(dom.nodes.ptr[e2].name, index);
+        snprintf(name, sizeof(name), "n%u", (i * 7) % 300);
+        ASSERT_TRUE(dom.names.ptr[dom.attrs.ptr[dom.nodes.ptr[e].attr_head].name].ptr == dom.names.ptr[tcxml_dom_name_find(&dom, name)].ptr);
+        e = tcxml_dom_next_element(&dom, e2, TCXML_DOM_NONE);
+    }
+    ASSERT_EQ(e, TCXML_DOM_NONE);
+    ASSERT_TRUE(dom.names.ptr[dom.nodes.ptr[root].name].ptr == dom.names.ptr[tcxml_dom_name_find(&dom, "root")].ptr);
+
+    tcxml_dom_deinit(&dom);
+    log_free(&doc);
+))
+TEST(DOM_Reset,(
+    char* big = make_records(2000, NULL);
+    static const char* const small = "<a x=\"1\"><b>text</b></a>";
+    tcxml_dom_t dom, fresh;
+    tcxml_dom_init(&dom);
+    tcxml_dom_init(&fresh);
+
+    ASSERT_TRUE(TCXML_ERROR_IS_OK(tcxml_dom_parse(&fresh, NULL, big, 0)));
+    char* big_str = dom_string(&fresh);
+    ASSERT_TRUE(TCXML_ERROR_IS_OK(tcxml_dom_parse(&fresh, NULL, small, 0)));
+    char* small_str = dom_string(&fresh);
+    ASSERT_NOTNULL(big_str);
+    ASSERT_NOTNULL(small_str);
+
+    /* alternating documents in the same DOM give the same trees as a fresh parse, with no names left over from the last one */
+    for(int i = 0; i < 3; i++)
+    {
+        ASSERT_TRUE(TCXML_ERROR_IS_OK(tcxml_dom_parse(&dom, NULL, small, 0)));
+        char* str = dom_string(&dom);
+        ASSERT_TRUE(str && !strcmp(str, small_str));
+        free(str);
+        ASSERT_EQ(tcxml_dom_name_find(&dom, "rec"), TCXML_DOM_NONE);
+        ASSERT_EQ(dom.names.len, 3);
+
+        ASSERT_TRUE(TCXML_ERROR_IS_OK(tcxml_dom_parse(&dom, NULL, big, 0)));
+        str = dom_string(&dom);
+        ASSERT_TRUE(str && !strcmp(str, big_str));
+        free(str);
+        ASSERT_EQ(tcxml_dom_name_find(&dom, "b"), TCXML_DOM_NONE);
+    }
+
+    /* an explicit reset leaves just the document node */
+    tcxml_dom_reset(&dom);
+    ASSERT_EQ(dom.nodes.len, 1);
+    ASSERT_EQ(dom.nodes.ptr[0].type, TCXML_NODE_DOCUMENT);
+    ASSERT_EQ(dom.nodes.ptr[0].first_child, TCXML_DOM_NONE);
+    ASSERT_EQ(tcxml_dom_root(&dom), TCXML_DOM_NONE);
+    ASSERT_EQ(tcxml_dom_name_find(&dom, "root"), TCXML_DOM_NONE);
+
+    free(big_str);
+    free(small_str);
+    tcxml_dom_deinit(&fresh);
+    tcxml_dom_deinit(&dom);
+    free(big);
+))
+TEST(DOM_Error,(
+    tcxml_dom_t dom;
+    tcxml_dom_init(&dom);
+    tcxml_error_t err = tcxml_dom_parse(&dom, NULL, "<a n=\"1\"><b>x</b><c>y<!--z--></a><d/>", 0);
+    ASSERT_FALSE(TCXML_ERROR_IS_OK(err));
+    ASSERT_EQ(err.offset, 29);  /* (the `</a>`) */
+
+    /* the DOM holds everything before the error, with consistent links */
+    char* str = dom_string(&dom);
+    ASSERT_NOTNULL(str);
+    ASSERT_STREQ(str, "(document(element 1:a 1:n 1:1(element 1:b(text 1:x))(element 1:c(text 1:y)(comment 1:z))))");
+    free(str);
+    ASSERT_EQ(tcxml_dom_name_find(&dom, "d"), TCXML_DOM_NONE);
+
+    /* and can be reused after that */
+    ASSERT_TRUE(TCXML_ERROR_IS_OK(tcxml_dom_parse(&dom, NULL, "<d/>", 0)));
+    str = dom_string(&dom);
+    ASSERT_TRUE(str && !strcmp(str, "(document(element 1:d))"));
+    free(str);
+    tcxml_dom_deinit(&dom);
+))
+TEST(DOM_Push,(
+    const char* docs[sizeof(valid_docs) / sizeof(*valid_docs) + 2];
+    size_t ndocs = 0, i, c;
+    for(i = 0; i < sizeof(valid_docs) / sizeof(*valid_docs); i++)
+        docs[ndocs++] = valid_docs[i];
+    /* (the larger one needs several blocks of string storage when it's pushed, as its size isn't known up front) */
+    char* small = make_records(20, NULL);
+    char* big = make_records(2000, NULL);
+    docs[ndocs++] = small;
+    docs[ndocs++] = big;
+
+    tcxml_dom_t dom;
+    tcxml_dom_init(&dom);
+    for(i = 0; i < ndocs; i++)
+    {
+        ASSERT_TRUE(TCXML_ERROR_IS_OK(tcxml_dom_parse(&dom, NULL, docs[i], 0)));
+        char* expect = dom_string(&dom);
+        ASSERT_NOTNULL(expect);
+        for(c = 0; c < sizeof(chunk_sizes) / sizeof(*chunk_sizes); c++)
+        {
+            const char* src = docs[i];
+            size_t len = strlen(src), n;
+            tcxml_sax_context_t* ctx = tcxml_dom_begin(&dom, NULL, 0);
+            for(; len; src += n, len -= n)
+            {
+                n = len < chunk_sizes[c] ? len : chunk_sizes[c];
+                if(!TCXML_ERROR_IS_OK(tcxml_sax_feed(ctx, src, n)))
+                    break;
+            }
+            ASSERT_TRUE(TCXML_ERROR_IS_OK(tcxml_sax_end(ctx)));
+            char* str = dom_string(&dom);
+            int same = str && !strcmp(str, expect);
+            free(str);
+            if(!same) fprintf(stderr, "    document %u, chunk size %u\n", (unsigned int)i, (unsigned int)chunk_sizes[c]);
+            ASSERT_TRUE(same);
+        }
+        free(expect);
+    }
+    tcxml_dom_deinit(&dom);
+    free(small);
+    free(big);
+))
+
+int main(void)
+{
+    TESTS_BEGIN();
+
+    TEST_HEADER("Push mode");
+        TEST_EXEC(Chunked_Valid);
+        TEST_EXEC(Chunked_Invalid);
+        TEST_EXEC(Chunked_Records);
+    TEST_HEADER("Parallel");
+        TEST_EXEC(Parallel_Records);
+        TEST_EXEC(Parallel_Records_Invalid);
+        TEST_EXEC(Parallel_Fallback);
+    TEST_HEADER("Fixed bugs");
+        TEST_EXEC(Fixed_References_In_Text);
+        TEST_EXEC(Fixed_End_Tag_Whitespace);
+        TEST_EXEC(Fixed_Attribute_Reference);
+    TEST_HEADER("Borrowed strings");
+        TEST_EXEC(Borrow_Slices);
+        TEST_EXEC(Borrow_Push);
+    TEST_HEADER("UTF-8 & acceleration");
+        TEST_EXEC(UTF8_Validate);
+        TEST_EXEC(UTF8_Four_Byte);
+        TEST_EXEC(Accel_Parse);
+    TEST_HEADER("DOM");
+        TEST_EXEC(DOM_Links);
+        TEST_EXEC(DOM_Interning);
+        TEST_EXEC(DOM_Reset);
+        TEST_EXEC(DOM_Error);
+        TEST_EXEC(DOM_Push);
+
+    TESTS_END();
+}
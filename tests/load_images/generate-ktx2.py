@@ -0,0 +1,58 @@
+#!/usr/bin/env python3
+# Generates the KTX2 test files (needs the `zstd` command-line tool).
+#
+# The texels are a simple function of their position, so that the tests can
+# check them without a reference image:
+#   texel(level, x, y)[c] = (level * 31 + y * 7 + x * 3 + c * 50) & 0xFF
+
+import struct
+import subprocess
+
+SIZE = 16
+NLEVELS = 5
+
+VK_FORMAT_R8G8B8A8_UNORM = 37
+SUPERCOMPRESSION_NONE = 0
+SUPERCOMPRESSION_ZSTD = 2
+
+def level_data(level):
+    size = SIZE >> level
+    return bytes((level * 31 + y * 7 + x * 3 + c * 50) & 0xFF for y in range(size) for x in range(size) for c in range(4))
+
+def dfd(bytes_plane0):
+    # basic descriptor block: RGBSDA, BT709, linear, straight alpha, 4 x 8-bit samples
+    samples = b''.join(struct.pack('<HBB4BII', c * 8, 8 - 1, (15 if c == 3 else c), 0, 0, 0, 0, 0, 255) for c in range(4))
+    block = struct.pack('<IHHBBBB4B8B', 0, 2, 24 + len(samples), 1, 1, 1, 0, 0, 0, 0, 0, bytes_plane0, 0, 0, 0, 0, 0, 0, 0) + samples
+    return struct.pack('<I', 4 + len(block)) + block
+
+def zstd(data):
+    return subprocess.run(['zstd', '-19', '-q', '-c', '--no-check'], input=data, stdout=subprocess.PIPE, check=True).stdout
+
+def ktx2(fname, scheme):
+    levels = [level_data(i) for i in range(NLEVELS)]
+    stored = [zstd(data) if scheme == SUPERCOMPRESSION_ZSTD else data for data in levels]
+    # bytesPlane0 must be 0 if the levels are supercompressed
+    d = dfd(0 if scheme else 4)
+
+    dfd_offset = 80 + NLEVELS * 24
+    offset = dfd_offset + len(d)
+    index = [None] * NLEVELS
+    body = b''
+    # the levels are stored smallest first (with 4-byte alignment, unless supercompressed)
+    for i in reversed(range(NLEVELS)):
+        if not scheme:
+            pad = -offset % 4
+            body += b'\0' * pad
+            offset += pad
+        index[i] = struct.pack('<QQQ', offset, len(stored[i]), len(levels[i]))
+        body += stored[i]
+        offset += len(stored[i])
+
+    header = bytes([0xAB, 0x4B, 0x54, 0x58, 0x20, 0x32, 0x30, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A])
+    header += struct.pack('<9I', VK_FORMAT_R8G8B8A8_UNORM, 1, SIZE, SIZE, 0, 0, 1, NLEVELS, scheme)
+    header += struct.pack('<4I2Q', dfd_offset, len(d), 0, 0, 0, 0)
+    with open(fname, 'wb') as f:
+        f.write(header + b''.join(index) + d + body)
+
+ktx2('rgba8.ktx2', SUPERCOMPRESSION_NONE)
+ktx2('rgba8.zstd.ktx2', SUPERCOMPRESSION_ZSTD)
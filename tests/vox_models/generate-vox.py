@@ -0,0 +1,74 @@
+#!/usr/bin/env python3
+# Generates the .vox test scenes.
+#
+# `scene.vox` has a single model, which is a function of position (so that the
+# tests can check it without a reference file):
+#   index(x, y, z) = 1 + (x // 4 + y // 3 + z // 3) % 3   if inside, else 0
+#   inside(x, y, z) = (x - 10)^2 + 2 (y - 5)^2 + 3 (z - 4)^2 < 70 and (7x + 13y + 5z) % 17 != 0
+# It is placed 4 times, with a mirrored root transform, and a different
+# rotation (two of which are reflections) on each instance.
+#
+# `dedupe.vox` has the same model 3 times: as-is, with the index of its last
+# voxel changed (a near-duplicate), and unchanged (an identical duplicate, which
+# the loader should merge into the first one). Each is placed once.
+
+import struct
+
+SIZE = (20, 11, 9)
+
+def index(x, y, z):
+    if (x - 10) ** 2 + 2 * (y - 5) ** 2 + 3 * (z - 4) ** 2 >= 70 or (7 * x + 13 * y + 5 * z) % 17 == 0:
+        return 0
+    return 1 + (x // 4 + y // 3 + z // 3) % 3
+
+def chunk(tag, data, children=b''):
+    return tag + struct.pack('<II', len(data), len(children)) + data + children
+
+def string(s):
+    return struct.pack('<I', len(s)) + s.encode()
+
+def dict_(d):
+    return struct.pack('<I', len(d)) + b''.join(string(k) + string(v) for k, v in d.items())
+
+def ntrn(node, child, frame):
+    return chunk(b'nTRN', struct.pack('<I', node) + dict_({}) + struct.pack('<iiiI', child, -1, -1, 1) + dict_(frame))
+
+def ngrp(node, children):
+    return chunk(b'nGRP', struct.pack('<I', node) + dict_({}) + struct.pack('<I', len(children)) + b''.join(struct.pack('<I', c) for c in children))
+
+def nshp(node, model):
+    return chunk(b'nSHP', struct.pack('<I', node) + dict_({}) + struct.pack('<II', 1, model) + dict_({}))
+
+# `_r` packs the index of the non-zero entry in the first two rows (2 bits each), and the sign of each row (bits 4-6)
+def rotation(xi, yi, xs, ys, zs):
+    return str(xi | yi << 2 | xs << 4 | ys << 5 | zs << 6)
+
+voxels = [(x, y, z, index(x, y, z)) for z in range(SIZE[2]) for y in range(SIZE[1]) for x in range(SIZE[0]) if index(x, y, z)]
+# a duplicate voxel; the last one wins
+voxels.insert(0, (10, 5, 4, 99))
+xyzi = struct.pack('<I', len(voxels)) + b''.join(struct.pack('<4B', *v) for v in voxels)
+
+instances = [
+    {'_t': '0 0 0'},                                          # identity
+    {'_r': rotation(1, 0, 0, 1, 0), '_t': '40 0 0'},          # 90 degrees about Z
+    {'_r': rotation(0, 1, 1, 0, 0), '_t': '0 40 0'},          # mirrored in X
+    {'_r': rotation(2, 0, 1, 0, 0), '_t': '40 40 0'},         # axes rotated, and mirrored in X
+]
+nodes = ntrn(0, 1, {'_r': rotation(0, 1, 0, 0, 1), '_t': '0 0 10'})  # mirrored in Z
+nodes += ngrp(1, [2 + 2 * i for i in range(len(instances))])
+for i, frame in enumerate(instances):
+    nodes += ntrn(2 + 2 * i, 3 + 2 * i, frame) + nshp(3 + 2 * i, 0)
+
+def write(fname, models, nodes):
+    main = b''.join(chunk(b'SIZE', struct.pack('<3I', *SIZE)) + chunk(b'XYZI', m) for m in models) + nodes
+    with open(fname, 'wb') as f:
+        f.write(b'VOX ' + struct.pack('<I', 150) + chunk(b'MAIN', b'', main))
+
+write('scene.vox', [xyzi], nodes)
+
+near = voxels[:-1] + [voxels[-1][:3] + (voxels[-1][3] % 3 + 1,)]
+nodes = ntrn(0, 1, {})
+nodes += ngrp(1, [2 + 2 * i for i in range(3)])
+for i in range(3):
+    nodes += ntrn(2 + 2 * i, 3 + 2 * i, {'_t': '%d 0 0' % (40 * i)}) + nshp(3 + 2 * i, i)
+write('dedupe.vox', [xyzi, struct.pack('<I', len(near)) + b''.join(struct.pack('<4B', *v) for v in near), xyzi], nodes)